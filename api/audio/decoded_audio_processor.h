@@ -0,0 +1,34 @@
+/*
+ *  Copyright (c) 2024 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef API_AUDIO_DECODED_AUDIO_PROCESSOR_H_
+#define API_AUDIO_DECODED_AUDIO_PROCESSOR_H_
+
+namespace webrtc {
+
+class AudioFrame;
+
+// If set on an audio receive stream, processes the decoded audio of the stream
+// in place, after NetEq and before the audio sink and the mixer, e.g. to
+// denoise it ahead of recording or transcription. Unlike
+// AudioFrameProcessor, the processing is synchronous: Process() is called on
+// the audio playout thread, once per 10 ms frame, and must not block.
+class DecodedAudioProcessor {
+ public:
+  virtual ~DecodedAudioProcessor() = default;
+
+  // Processes `frame`, whose format may change between calls. Muted frames
+  // are passed as well, so that the processor can follow the stream.
+  virtual void Process(AudioFrame* frame) = 0;
+};
+
+}  // namespace webrtc
+
+#endif  // API_AUDIO_DECODED_AUDIO_PROCESSOR_H_
@@ -117,6 +117,11 @@ bool EchoCanceller3Config::Validate(EchoCanceller3Config* config) {
   res = res & Limit(&c->delay.delay_candidate_detection_threshold, 0.f, 1.f);
   res = res & Limit(&c->delay.delay_selection_thresholds.initial, 1, 250);
   res = res & Limit(&c->delay.delay_selection_thresholds.converged, 1, 250);
+  res = res & Limit(&c->delay.tracking_search.stable_blocks, 0, 250000);
+  res = res & Limit(&c->delay.tracking_search.full_search_interval_blocks, 1,
+                    250000);
+  res = res & Limit(&c->delay.tracking_search.full_search_duration_blocks, 0,
+                    c->delay.tracking_search.full_search_interval_blocks);
 
   res = res & FloorLimit(&c->filter.refined.length_blocks, 1);
   res = res & Limit(&c->filter.refined.leakage_converged, 0.f, 1000.f);
@@ -154,6 +159,14 @@ bool EchoCanceller3Config::Validate(EchoCanceller3Config* config) {
   res = res & Limit(&c->filter.config_change_duration_blocks, 0, 100000);
   res = res & Limit(&c->filter.initial_state_seconds, 0.f, 100.f);
   res = res & Limit(&c->filter.coarse_reset_hangover_blocks, 0, 250000);
+  res = res & Limit(&c->filter.length_auto_sizing.min_length_blocks, 1,
+                    c->filter.refined.length_blocks);
+  res = res & Limit(&c->filter.length_auto_sizing.margin_blocks, 0,
+                    c->filter.refined.length_blocks);
+  res = res & Limit(&c->filter.length_auto_sizing.tail_energy_threshold, 0.f,
+                    1.f);
+  res = res & Limit(&c->filter.length_auto_sizing.shrink_hold_blocks, 0,
+                    250000);
 
   res = res & Limit(&c->erle.min, 1.f, 100000.f);
   res = res & Limit(&c->erle.max_l, 1.f, 100000.f);
@@ -60,6 +60,16 @@ struct RTC_EXPORT EchoCanceller3Config {
     AlignmentMixing render_alignment_mixing = {false, true, 10000.f, true};
     AlignmentMixing capture_alignment_mixing = {false, true, 10000.f, false};
     bool detect_pre_echo = true;
+    // Once the delay has been stable for `stable_blocks`, the matched filter
+    // only searches around the current delay, except for
+    // `full_search_duration_blocks` out of every `full_search_interval_blocks`
+    // blocks.
+    struct TrackingSearch {
+      bool enabled = false;
+      size_t stable_blocks = 500;
+      size_t full_search_interval_blocks = 1000;
+      size_t full_search_duration_blocks = 50;
+    } tracking_search;
   } delay;
 
   struct Filter {
@@ -94,6 +104,18 @@ struct RTC_EXPORT EchoCanceller3Config {
     bool use_linear_filter = true;
     bool high_pass_filter_echo_reference = false;
     bool export_linear_aec_output = false;
+    // Once the linear filter is usable, the refined filters are shrunk to
+    // the blocks holding the energy of the estimated echo path above
+    // `tail_energy_threshold` times the energy of the strongest block, plus
+    // `margin_blocks`, and grown back when the tail reaches the filter end.
+    // The filters are never longer than `refined.length_blocks`.
+    struct LengthAutoSizing {
+      bool enabled = false;
+      size_t min_length_blocks = 4;
+      size_t margin_blocks = 2;
+      float tail_energy_threshold = 0.001f;
+      size_t shrink_hold_blocks = 500;
+    } length_auto_sizing;
   } filter;
 
   struct Erle {
@@ -221,6 +221,16 @@ void Aec3ConfigFromJsonString(absl::string_view json_string,
     ReadParam(section, "capture_alignment_mixing",
               &cfg.delay.capture_alignment_mixing);
     ReadParam(section, "detect_pre_echo", &cfg.delay.detect_pre_echo);
+
+    if (rtc::GetValueFromJsonObject(section, "tracking_search", &subsection)) {
+      ReadParam(subsection, "enabled", &cfg.delay.tracking_search.enabled);
+      ReadParam(subsection, "stable_blocks",
+                &cfg.delay.tracking_search.stable_blocks);
+      ReadParam(subsection, "full_search_interval_blocks",
+                &cfg.delay.tracking_search.full_search_interval_blocks);
+      ReadParam(subsection, "full_search_duration_blocks",
+                &cfg.delay.tracking_search.full_search_duration_blocks);
+    }
   }
 
   if (rtc::GetValueFromJsonObject(aec3_root, "filter", &section)) {
@@ -243,6 +253,20 @@ void Aec3ConfigFromJsonString(absl::string_view json_string,
               &cfg.filter.high_pass_filter_echo_reference);
     ReadParam(section, "export_linear_aec_output",
               &cfg.filter.export_linear_aec_output);
+
+    Json::Value subsection;
+    if (rtc::GetValueFromJsonObject(section, "length_auto_sizing",
+                                    &subsection)) {
+      ReadParam(subsection, "enabled", &cfg.filter.length_auto_sizing.enabled);
+      ReadParam(subsection, "min_length_blocks",
+                &cfg.filter.length_auto_sizing.min_length_blocks);
+      ReadParam(subsection, "margin_blocks",
+                &cfg.filter.length_auto_sizing.margin_blocks);
+      ReadParam(subsection, "tail_energy_threshold",
+                &cfg.filter.length_auto_sizing.tail_energy_threshold);
+      ReadParam(subsection, "shrink_hold_blocks",
+                &cfg.filter.length_auto_sizing.shrink_hold_blocks);
+    }
   }
 
   if (rtc::GetValueFromJsonObject(aec3_root, "erle", &section)) {
@@ -508,7 +532,17 @@ std::string Aec3ConfigToJsonString(const EchoCanceller3Config& config) {
               : "false");
   ost << "},";
   ost << "\"detect_pre_echo\": "
-      << (config.delay.detect_pre_echo ? "true" : "false");
+      << (config.delay.detect_pre_echo ? "true" : "false") << ",";
+  ost << "\"tracking_search\": {";
+  ost << "\"enabled\": "
+      << (config.delay.tracking_search.enabled ? "true" : "false") << ",";
+  ost << "\"stable_blocks\": " << config.delay.tracking_search.stable_blocks
+      << ",";
+  ost << "\"full_search_interval_blocks\": "
+      << config.delay.tracking_search.full_search_interval_blocks << ",";
+  ost << "\"full_search_duration_blocks\": "
+      << config.delay.tracking_search.full_search_duration_blocks;
+  ost << "}";
   ost << "},";
 
   ost << "\"filter\": {";
@@ -560,7 +594,19 @@ std::string Aec3ConfigToJsonString(const EchoCanceller3Config& config) {
       << (config.filter.high_pass_filter_echo_reference ? "true" : "false")
       << ",";
   ost << "\"export_linear_aec_output\": "
-      << (config.filter.export_linear_aec_output ? "true" : "false");
+      << (config.filter.export_linear_aec_output ? "true" : "false") << ",";
+  ost << "\"length_auto_sizing\": {";
+  ost << "\"enabled\": "
+      << (config.filter.length_auto_sizing.enabled ? "true" : "false") << ",";
+  ost << "\"min_length_blocks\": "
+      << config.filter.length_auto_sizing.min_length_blocks << ",";
+  ost << "\"margin_blocks\": " << config.filter.length_auto_sizing.margin_blocks
+      << ",";
+  ost << "\"tail_energy_threshold\": "
+      << config.filter.length_auto_sizing.tail_energy_threshold << ",";
+  ost << "\"shrink_hold_blocks\": "
+      << config.filter.length_auto_sizing.shrink_hold_blocks;
+  ost << "}";
 
   ost << "},";
 
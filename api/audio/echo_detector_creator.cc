@@ -18,4 +18,11 @@ rtc::scoped_refptr<EchoDetector> CreateEchoDetector() {
   return rtc::make_ref_counted<ResidualEchoDetector>();
 }
 
+rtc::scoped_refptr<EchoDetector> CreateLowComplexityEchoDetector() {
+  ResidualEchoDetector::Config config;
+  config.frames_per_update = 2;
+  config.power_decimation_factor = 4;
+  return rtc::make_ref_counted<ResidualEchoDetector>(config);
+}
+
 }  // namespace webrtc
@@ -21,6 +21,11 @@ namespace webrtc {
 // usual residual echo metrics.
 rtc::scoped_refptr<EchoDetector> CreateEchoDetector();
 
+// Same as above, but the detector averages the signal powers over two frames
+// and computes them on decimated audio, which cuts its complexity by about a
+// factor of four. The delays are estimated with a resolution of 20 ms.
+rtc::scoped_refptr<EchoDetector> CreateLowComplexityEchoDetector();
+
 }  // namespace webrtc
 
 #endif  // API_AUDIO_ECHO_DETECTOR_CREATOR_H_
@@ -19,8 +19,12 @@ TEST(EchoCanceller3JsonHelpers, ToStringAndParseJson) {
   EchoCanceller3Config cfg;
   cfg.delay.down_sampling_factor = 1u;
   cfg.delay.log_warning_on_delay_changes = true;
+  cfg.delay.tracking_search.enabled = true;
+  cfg.delay.tracking_search.full_search_interval_blocks = 123;
   cfg.filter.refined.error_floor = 2.f;
   cfg.filter.coarse_initial.length_blocks = 3u;
+  cfg.filter.length_auto_sizing.enabled = true;
+  cfg.filter.length_auto_sizing.margin_blocks = 3u;
   cfg.filter.high_pass_filter_echo_reference =
       !cfg.filter.high_pass_filter_echo_reference;
   cfg.comfort_noise.noise_floor_dbfs = 100.f;
@@ -52,8 +56,16 @@ TEST(EchoCanceller3JsonHelpers, ToStringAndParseJson) {
             cfg_transformed.delay.down_sampling_factor);
   EXPECT_EQ(cfg.delay.log_warning_on_delay_changes,
             cfg_transformed.delay.log_warning_on_delay_changes);
+  EXPECT_EQ(cfg.delay.tracking_search.enabled,
+            cfg_transformed.delay.tracking_search.enabled);
+  EXPECT_EQ(cfg.delay.tracking_search.full_search_interval_blocks,
+            cfg_transformed.delay.tracking_search.full_search_interval_blocks);
   EXPECT_EQ(cfg.filter.coarse_initial.length_blocks,
             cfg_transformed.filter.coarse_initial.length_blocks);
+  EXPECT_EQ(cfg.filter.length_auto_sizing.enabled,
+            cfg_transformed.filter.length_auto_sizing.enabled);
+  EXPECT_EQ(cfg.filter.length_auto_sizing.margin_blocks,
+            cfg_transformed.filter.length_auto_sizing.margin_blocks);
   EXPECT_EQ(cfg.filter.refined.error_floor,
             cfg_transformed.filter.refined.error_floor);
   EXPECT_EQ(cfg.filter.high_pass_filter_echo_reference,
@@ -70,6 +70,9 @@ bool AudioEncoderOpusConfig::IsOk() const {
     return false;
   if (low_rate_complexity < 0 || low_rate_complexity > 10)
     return false;
+  if (encode_time_budget_percent && (*encode_time_budget_percent <= 0 ||
+                                     *encode_time_budget_percent > 100))
+    return false;
   return true;
 }
 }  // namespace webrtc
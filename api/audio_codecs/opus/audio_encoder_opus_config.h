@@ -60,6 +60,12 @@ struct RTC_EXPORT AudioEncoderOpusConfig {
   int complexity_threshold_bps;
   int complexity_threshold_window_bps;
 
+  // If set, the complexity is stepped down whenever encoding takes more than
+  // this percentage of the duration of the encoded audio, and stepped back up
+  // towards the complexity above once there is headroom again. Intended for
+  // devices whose CPU may be throttled.
+  absl::optional<int> encode_time_budget_percent;
+
   bool dtx_enabled;
   std::vector<int> supported_frame_lengths_ms;
   int uplink_bandwidth_update_interval_ms;
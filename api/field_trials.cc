@@ -91,7 +91,7 @@ FieldTrials::~FieldTrials() {
 }
 
 std::string FieldTrials::GetValue(absl::string_view key) const {
-  auto it = key_value_map_.find(std::string(key));
+  auto it = key_value_map_.find(key);
   if (it != key_value_map_.end())
     return it->second;
 
@@ -99,7 +99,7 @@ std::string FieldTrials::GetValue(absl::string_view key) const {
   // a mix between FieldTrials and the global string continue to work
   // TODO(bugs.webrtc.org/10335): Remove the global string!
   if (uses_global_) {
-    return field_trial::FindFullName(std::string(key));
+    return field_trial::FindFullName(key);
   }
   return "";
 }
@@ -33,6 +33,12 @@ class TransformableFrameInterface {
   // Copies `data` into the owned frame payload data.
   virtual void SetData(rtc::ArrayView<const uint8_t> data) = 0;
 
+  // Returns the frame payload data for transforming it in place, which avoids
+  // the copies of GetData() and SetData() when the transform doesn't change
+  // the payload size. The data is valid until the next non-const method call.
+  // Returns an empty view if the frame doesn't support in-place transforms.
+  virtual rtc::ArrayView<uint8_t> GetMutableData() { return {}; }
+
   virtual uint8_t GetPayloadType() const = 0;
   virtual uint32_t GetSsrc() const = 0;
   virtual uint32_t GetTimestamp() const = 0;
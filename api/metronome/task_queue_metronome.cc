@@ -0,0 +1,133 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "api/metronome/task_queue_metronome.h"
+
+#include <utility>
+#include <vector>
+
+#include "absl/types/optional.h"
+#include "api/task_queue/task_queue_base.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/containers/flat_map.h"
+#include "rtc_base/logging.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/thread_annotations.h"
+
+namespace webrtc {
+namespace {
+
+using Callbacks = std::vector<absl::AnyInvocable<void() &&>>;
+
+}  // namespace
+
+struct TaskQueueMetronome::State {
+  Mutex mutex;
+  // Callbacks requested for the next tick, per task queue. Owned by the
+  // scheduled Tick.
+  flat_map<TaskQueueBase*, Callbacks*> pending RTC_GUARDED_BY(mutex);
+  Stats stats RTC_GUARDED_BY(mutex);
+};
+
+// The task that runs the callbacks requested on one task queue for one tick.
+// When the task queue is destroyed with the tick pending, the tick is
+// forgotten so that a task queue later created at the same address is not
+// left waiting for it.
+class TaskQueueMetronome::Tick {
+ public:
+  Tick(std::shared_ptr<State> state, TaskQueueBase* task_queue)
+      : state_(std::move(state)),
+        task_queue_(task_queue),
+        callbacks_(std::make_unique<Callbacks>()) {}
+  Tick(Tick&&) = default;
+  Tick& operator=(Tick&&) = default;
+  ~Tick() {
+    if (callbacks_) {
+      MutexLock lock(&state_->mutex);
+      Forget();
+    }
+  }
+
+  Callbacks* callbacks() { return callbacks_.get(); }
+
+  void operator()() && {
+    Callbacks callbacks;
+    {
+      MutexLock lock(&state_->mutex);
+      Forget();
+      callbacks.swap(*callbacks_);
+      ++state_->stats.wakeups;
+      state_->stats.callbacks += callbacks.size();
+    }
+    for (auto& callback : callbacks) {
+      std::move(callback)();
+    }
+  }
+
+ private:
+  void Forget() RTC_EXCLUSIVE_LOCKS_REQUIRED(state_->mutex) {
+    auto it = state_->pending.find(task_queue_);
+    // Callbacks requested while running this tick belong to the next one.
+    if (it != state_->pending.end() && it->second == callbacks_.get()) {
+      state_->pending.erase(it);
+    }
+  }
+
+  std::shared_ptr<State> state_;
+  TaskQueueBase* task_queue_;
+  std::unique_ptr<Callbacks> callbacks_;
+};
+
+TaskQueueMetronome::TaskQueueMetronome(Clock* clock, TimeDelta tick_period)
+    : clock_(clock),
+      tick_period_(tick_period),
+      state_(std::make_shared<State>()) {
+  RTC_DCHECK(clock_);
+  RTC_DCHECK_GT(tick_period_, TimeDelta::Zero());
+}
+
+TaskQueueMetronome::~TaskQueueMetronome() {
+  Stats stats = GetStats();
+  RTC_LOG(LS_INFO) << "Metronome ticks woke up task queues " << stats.wakeups
+                   << " times to run " << stats.callbacks << " callbacks.";
+}
+
+void TaskQueueMetronome::RequestCallOnNextTick(
+    absl::AnyInvocable<void() &&> callback) {
+  TaskQueueBase* current = TaskQueueBase::Current();
+  RTC_DCHECK(current);
+  absl::optional<Tick> tick;
+  {
+    MutexLock lock(&state_->mutex);
+    auto it = state_->pending.find(current);
+    if (it != state_->pending.end()) {
+      it->second->push_back(std::move(callback));
+      return;
+    }
+    tick.emplace(state_, current);
+    tick->callbacks()->push_back(std::move(callback));
+    state_->pending.emplace(current, tick->callbacks());
+  }
+  const int64_t now_us = clock_->TimeInMicroseconds();
+  const TimeDelta delay =
+      TimeDelta::Micros(tick_period_.us() - now_us % tick_period_.us());
+  current->PostDelayedHighPrecisionTask(std::move(*tick), delay);
+}
+
+TimeDelta TaskQueueMetronome::TickPeriod() const {
+  return tick_period_;
+}
+
+TaskQueueMetronome::Stats TaskQueueMetronome::GetStats() const {
+  MutexLock lock(&state_->mutex);
+  return state_->stats;
+}
+
+}  // namespace webrtc
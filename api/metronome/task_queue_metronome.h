@@ -0,0 +1,67 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef API_METRONOME_TASK_QUEUE_METRONOME_H_
+#define API_METRONOME_TASK_QUEUE_METRONOME_H_
+
+#include <stdint.h>
+
+#include <memory>
+
+#include "absl/functional/any_invocable.h"
+#include "api/metronome/metronome.h"
+#include "api/units/time_delta.h"
+#include "rtc_base/system/rtc_export.h"
+#include "system_wrappers/include/clock.h"
+
+namespace webrtc {
+
+// A Metronome that ticks with delayed tasks on the task queues that request
+// ticks. Ticks are aligned to multiples of the tick period on the clock, so
+// the task queues that use the same metronome wake up together, and the
+// callbacks requested on one task queue before a tick run in a single task.
+//
+// Beyond what the Metronome interface requires, this metronome may be used
+// from several task queues, and may be destroyed before its pending ticks
+// run; those still run the requested callbacks.
+class RTC_EXPORT TaskQueueMetronome : public Metronome {
+ public:
+  struct Stats {
+    // Number of times a task queue woke up for a tick.
+    int64_t wakeups = 0;
+    // Number of callbacks run on those wakeups.
+    int64_t callbacks = 0;
+  };
+
+  // The default tick period, as used by Chromium.
+  static constexpr TimeDelta kDefaultTickPeriod = TimeDelta::Micros(15625);
+
+  TaskQueueMetronome(Clock* clock, TimeDelta tick_period);
+  ~TaskQueueMetronome() override;
+
+  // Metronome implementation.
+  void RequestCallOnNextTick(absl::AnyInvocable<void() &&> callback) override;
+  TimeDelta TickPeriod() const override;
+
+  Stats GetStats() const;
+
+ private:
+  struct State;
+  class Tick;
+
+  Clock* const clock_;
+  const TimeDelta tick_period_;
+  // Shared with the pending ticks.
+  const std::shared_ptr<State> state_;
+};
+
+}  // namespace webrtc
+
+#endif  // API_METRONOME_TASK_QUEUE_METRONOME_H_
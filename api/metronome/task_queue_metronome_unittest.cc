@@ -0,0 +1,115 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "api/metronome/task_queue_metronome.h"
+
+#include <memory>
+#include <vector>
+
+#include "api/task_queue/task_queue_base.h"
+#include "api/task_queue/task_queue_factory.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "test/gmock.h"
+#include "test/gtest.h"
+#include "test/time_controller/simulated_time_controller.h"
+
+namespace webrtc {
+namespace {
+
+using ::testing::ElementsAre;
+
+constexpr TimeDelta kTickPeriod = TimeDelta::Millis(10);
+
+class TaskQueueMetronomeTest : public ::testing::Test {
+ protected:
+  TaskQueueMetronomeTest()
+      : time_controller_(Timestamp::Millis(1002)),
+        metronome_(time_controller_.GetClock(), kTickPeriod) {}
+
+  std::unique_ptr<TaskQueueBase, TaskQueueDeleter> CreateTaskQueue() {
+    return time_controller_.GetTaskQueueFactory()->CreateTaskQueue(
+        "TaskQueue", TaskQueueFactory::Priority::NORMAL);
+  }
+
+  void RequestTick(TaskQueueBase* task_queue, std::vector<Timestamp>* ticks) {
+    task_queue->PostTask([this, ticks] {
+      metronome_.RequestCallOnNextTick([this, ticks] {
+        ticks->push_back(time_controller_.GetClock()->CurrentTime());
+      });
+    });
+  }
+
+  GlobalSimulatedTimeController time_controller_;
+  TaskQueueMetronome metronome_;
+};
+
+TEST_F(TaskQueueMetronomeTest, RunsCallbacksOfATaskQueueOnOneWakeup) {
+  auto task_queue = CreateTaskQueue();
+  std::vector<Timestamp> ticks;
+  RequestTick(task_queue.get(), &ticks);
+  RequestTick(task_queue.get(), &ticks);
+  time_controller_.AdvanceTime(kTickPeriod);
+
+  EXPECT_THAT(ticks, ElementsAre(Timestamp::Millis(1010),
+                                 Timestamp::Millis(1010)));
+  TaskQueueMetronome::Stats stats = metronome_.GetStats();
+  EXPECT_EQ(stats.wakeups, 1);
+  EXPECT_EQ(stats.callbacks, 2);
+}
+
+TEST_F(TaskQueueMetronomeTest, AlignsTicksOfTaskQueues) {
+  auto first = CreateTaskQueue();
+  auto second = CreateTaskQueue();
+  std::vector<Timestamp> first_ticks;
+  std::vector<Timestamp> second_ticks;
+  RequestTick(first.get(), &first_ticks);
+  time_controller_.AdvanceTime(TimeDelta::Millis(5));
+  RequestTick(second.get(), &second_ticks);
+  time_controller_.AdvanceTime(kTickPeriod);
+
+  EXPECT_THAT(first_ticks, ElementsAre(Timestamp::Millis(1010)));
+  EXPECT_THAT(second_ticks, ElementsAre(Timestamp::Millis(1010)));
+  EXPECT_EQ(metronome_.GetStats().wakeups, 2);
+}
+
+TEST_F(TaskQueueMetronomeTest, CallbackRequestedOnTickRunsOnNextTick) {
+  auto task_queue = CreateTaskQueue();
+  std::vector<Timestamp> ticks;
+  task_queue->PostTask([&] {
+    metronome_.RequestCallOnNextTick([&] {
+      ticks.push_back(time_controller_.GetClock()->CurrentTime());
+      metronome_.RequestCallOnNextTick([&] {
+        ticks.push_back(time_controller_.GetClock()->CurrentTime());
+      });
+    });
+  });
+  time_controller_.AdvanceTime(3 * kTickPeriod);
+
+  EXPECT_THAT(ticks, ElementsAre(Timestamp::Millis(1010),
+                                 Timestamp::Millis(1020)));
+  EXPECT_EQ(metronome_.GetStats().wakeups, 2);
+}
+
+TEST_F(TaskQueueMetronomeTest, TicksAgainAfterTaskQueueWithPendingTickIsGone) {
+  auto task_queue = CreateTaskQueue();
+  std::vector<Timestamp> ticks;
+  RequestTick(task_queue.get(), &ticks);
+  time_controller_.AdvanceTime(TimeDelta::Zero());
+  task_queue = nullptr;
+
+  task_queue = CreateTaskQueue();
+  RequestTick(task_queue.get(), &ticks);
+  time_controller_.AdvanceTime(kTickPeriod);
+  EXPECT_THAT(ticks, ElementsAre(Timestamp::Millis(1010)));
+}
+
+}  // namespace
+}  // namespace webrtc
@@ -136,6 +136,11 @@ class NetEq {
     int min_delay_ms = 0;
     bool enable_fast_accelerate = false;
     bool enable_muted_state = false;
+    // If muted state is enabled and this is positive, the decoder is no longer
+    // asked for codec-internal comfort noise (e.g. Opus DTX) once it has been
+    // generated for this long. Muted frames are output instead, until the
+    // next packet arrives.
+    int mute_codec_internal_cng_after_ms = 0;
     bool enable_rtx_handling = false;
     absl::optional<AudioCodecPairId> codec_pair_id;
     bool for_test_no_time_stretching = false;  // Use only for testing.
@@ -201,7 +206,9 @@ class NetEq {
   // `vad_activity_` are updated upon success. If an error is returned, some
   // fields may not have been updated, or may contain inconsistent values.
   // If muted state is enabled (through Config::enable_muted_state), `muted`
-  // may be set to true after a prolonged expand period. When this happens, the
+  // may be set to true after a prolonged expand period, or after a prolonged
+  // codec-internal comfort noise period if
+  // Config::mute_codec_internal_cng_after_ms is set. When this happens, the
   // `data_` in `audio_frame` is not written, but should be interpreted as being
   // all zeros. For testing purposes, an override can be supplied in the
   // `action_override` argument, which will cause NetEq to take this action
@@ -0,0 +1,28 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "api/neteq/passthrough_neteq_controller_factory.h"
+
+#include "modules/audio_coding/neteq/passthrough_decision_logic.h"
+
+namespace webrtc {
+
+PassthroughNetEqControllerFactory::PassthroughNetEqControllerFactory() =
+    default;
+PassthroughNetEqControllerFactory::~PassthroughNetEqControllerFactory() =
+    default;
+
+std::unique_ptr<NetEqController>
+PassthroughNetEqControllerFactory::CreateNetEqController(
+    const NetEqController::Config& config) const {
+  return std::make_unique<PassthroughDecisionLogic>(config);
+}
+
+}  // namespace webrtc
@@ -0,0 +1,38 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef API_NETEQ_PASSTHROUGH_NETEQ_CONTROLLER_FACTORY_H_
+#define API_NETEQ_PASSTHROUGH_NETEQ_CONTROLLER_FACTORY_H_
+
+#include <memory>
+
+#include "api/neteq/neteq_controller_factory.h"
+
+namespace webrtc {
+
+// This NetEqControllerFactory creates a lightweight controller meant for links
+// with negligible jitter, such as wired links within a datacenter. It plays
+// packets out against a fixed small target delay and keeps no arrival delay
+// statistics, so it does not adapt to jittery networks.
+class PassthroughNetEqControllerFactory : public NetEqControllerFactory {
+ public:
+  PassthroughNetEqControllerFactory();
+  ~PassthroughNetEqControllerFactory() override;
+  PassthroughNetEqControllerFactory(const PassthroughNetEqControllerFactory&) =
+      delete;
+  PassthroughNetEqControllerFactory& operator=(
+      const PassthroughNetEqControllerFactory&) = delete;
+
+  std::unique_ptr<NetEqController> CreateNetEqController(
+      const NetEqController::Config& config) const override;
+};
+
+}  // namespace webrtc
+#endif  // API_NETEQ_PASSTHROUGH_NETEQ_CONTROLLER_FACTORY_H_
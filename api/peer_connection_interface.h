@@ -1444,6 +1444,10 @@ struct RTC_EXPORT PeerConnectionFactoryDependencies final {
   std::unique_ptr<FieldTrialsView> trials;
   std::unique_ptr<RtpTransportControllerSendFactoryInterface>
       transport_controller_send_factory;
+  // Metronome shared by the calls of the factory, e.g. to decode the frames of
+  // all receive streams on the same ticks. If not set, a TaskQueueMetronome
+  // with the default tick period is used, unless the WebRTC-DefaultMetronome
+  // field trial is disabled.
   std::unique_ptr<Metronome> metronome;
 };
 
@@ -123,6 +123,17 @@ class RTC_EXPORT RTCStatsReport final
   // listing all of its stats objects.
   std::string ToJson() const;
 
+  // Creates a compact binary representation of the report, intended for
+  // machine consumption where parsing `ToJson()` output is too costly.
+  // Every stats object is written as its type, ID and timestamp followed by
+  // its defined members, which are identified by their index in
+  // `RTCStats::Members()` rather than by name. Integers are varint encoded.
+  // If `previous` is not null, integer members that were also defined on the
+  // stats object with the same ID and type in `previous` are written as deltas
+  // against that value, so slowly changing counters take a byte or two. A
+  // reader needs the same `previous` report to decode the output.
+  std::string ToBinary(const RTCStatsReport* previous = nullptr) const;
+
  protected:
   friend class rtc::RefCountedNonVirtual<RTCStatsReport>;
   ~RTCStatsReport() = default;
@@ -501,6 +501,15 @@ class RTC_EXPORT RTCAudioPlayoutStats final : public RTCStats {
   RTCStatsMember<double> total_samples_duration;
   RTCStatsMember<double> total_playout_delay;
   RTCStatsMember<uint64_t> total_samples_count;
+  // Non-standard. Histograms of the time between two successive audio device
+  // callbacks and of the time spent in each callback. The keys are the lower
+  // bounds of the buckets in milliseconds.
+  RTCStatsMember<std::map<std::string, uint64_t>> playout_callback_interval;
+  RTCStatsMember<std::map<std::string, uint64_t>>
+      playout_callback_processing_time;
+  RTCStatsMember<std::map<std::string, uint64_t>> recording_callback_interval;
+  RTCStatsMember<std::map<std::string, uint64_t>>
+      recording_callback_processing_time;
 };
 
 }  // namespace webrtc
@@ -153,10 +153,15 @@ class ScopedTaskSafetyDetached final {
       PendingTaskSafetyFlag::CreateDetached();
 };
 
-inline absl::AnyInvocable<void() &&> SafeTask(
+// Returns a task that runs `task` if `flag` is still alive. `task` is stored
+// as is in the returned closure rather than wrapped in an AnyInvocable of its
+// own, so that a closure needs at most one allocation.
+template <typename Closure>
+absl::AnyInvocable<void() &&> SafeTask(
     rtc::scoped_refptr<PendingTaskSafetyFlag> flag,
-    absl::AnyInvocable<void() &&> task) {
-  return [flag = std::move(flag), task = std::move(task)]() mutable {
+    Closure&& task) {
+  return [flag = std::move(flag),
+          task = std::forward<Closure>(task)]() mutable {
     if (flag->alive()) {
       std::move(task)();
     }
@@ -139,6 +139,30 @@ TEST_P(TaskQueueTest, PostMultipleDelayed) {
     EXPECT_TRUE(e.Wait(TimeDelta::Seconds(1)));
 }
 
+TEST_P(TaskQueueTest, PostMultipleDelayedWithMixedPrecision) {
+  std::unique_ptr<webrtc::TaskQueueFactory> factory = GetParam()(nullptr);
+  auto queue =
+      CreateTaskQueue(factory, "PostMultipleDelayedWithMixedPrecision");
+
+  std::vector<rtc::Event> events(100);
+  for (int i = 0; i < 100; ++i) {
+    rtc::Event* event = &events[i];
+    auto task = [event, &queue] {
+      EXPECT_TRUE(queue->IsCurrent());
+      event->Set();
+    };
+    if (i % 2 == 0) {
+      queue->PostDelayedTask(std::move(task), TimeDelta::Millis(i));
+    } else {
+      queue->PostDelayedHighPrecisionTask(std::move(task),
+                                          TimeDelta::Millis(i));
+    }
+  }
+
+  for (rtc::Event& e : events)
+    EXPECT_TRUE(e.Wait(TimeDelta::Seconds(1)));
+}
+
 TEST_P(TaskQueueTest, PostDelayedAfterDestruct) {
   std::unique_ptr<webrtc::TaskQueueFactory> factory = GetParam()(nullptr);
   rtc::Event run;
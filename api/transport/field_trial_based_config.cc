@@ -13,6 +13,6 @@
 
 namespace webrtc {
 std::string FieldTrialBasedConfig::GetValue(absl::string_view key) const {
-  return webrtc::field_trial::FindFullName(std::string(key));
+  return webrtc::field_trial::FindFullName(key);
 }
 }  // namespace webrtc
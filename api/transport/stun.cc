@@ -426,8 +426,10 @@ bool StunMessage::ValidateMessageIntegrityOfType(int mi_attr_type,
 
   // Getting length of the message to calculate Message Integrity.
   size_t mi_pos = current_pos;
-  std::unique_ptr<char[]> temp_data(new char[current_pos]);
-  memcpy(temp_data.get(), data, current_pos);
+  // The HMAC covers the message up to the M-I attribute, hashed as is unless
+  // the length field needs adjusting below.
+  const char* hmac_input = data;
+  std::unique_ptr<char[]> temp_data;
   if (size > mi_pos + kStunAttributeHeaderSize + mi_attr_size) {
     // Stun message has other attributes after message integrity.
     // Adjust the length parameter in stun message to calculate HMAC.
@@ -441,13 +443,16 @@ bool StunMessage::ValidateMessageIntegrityOfType(int mi_attr_type,
     //     +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
     //     |0 0|     STUN Message Type     |         Message Length        |
     //     +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+    temp_data.reset(new char[mi_pos]);
+    memcpy(temp_data.get(), data, mi_pos);
     rtc::SetBE16(temp_data.get() + 2, static_cast<uint16_t>(new_adjusted_len));
+    hmac_input = temp_data.get();
   }
 
   char hmac[kStunMessageIntegritySize];
   size_t ret =
       rtc::ComputeHmac(rtc::DIGEST_SHA_1, password.c_str(), password.size(),
-                       temp_data.get(), mi_pos, hmac, sizeof(hmac));
+                       hmac_input, mi_pos, hmac, sizeof(hmac));
   RTC_DCHECK(ret == sizeof(hmac));
   if (ret != sizeof(hmac)) {
     return false;
@@ -111,6 +111,12 @@ bool FrameBuffer::InsertFrame(std::unique_ptr<EncodedFrame> frame) {
                          << " inserted, buffer is now full.";
   }
 
+  if (decodable_scan_.last_scanned_frame_id &&
+      frame_id < *decodable_scan_.last_scanned_frame_id) {
+    // The frame may change the decodability of already scanned temporal units.
+    ResetDecodableScan();
+  }
+
   PropagateContinuity(insert_res.first);
   FindNextAndLastDecodableTemporalUnit();
   return true;
@@ -145,6 +151,9 @@ void FrameBuffer::DropNextDecodableTemporalUnit() {
       [](const auto& f) { return f.second.encoded_frame != nullptr; });
 
   frames_.erase(frames_.begin(), end_it);
+  // The decoded frame history changed, so all remaining frames must be scanned
+  // again.
+  ResetDecodableScan();
   FindNextAndLastDecodableTemporalUnit();
 }
 
@@ -210,18 +219,22 @@ void FrameBuffer::PropagateContinuity(const FrameIterator& frame_it) {
 }
 
 void FrameBuffer::FindNextAndLastDecodableTemporalUnit() {
-  next_decodable_temporal_unit_.reset();
-  decodable_temporal_units_info_.reset();
-
   if (!last_continuous_temporal_unit_frame_id_) {
     return;
   }
 
-  FrameIterator first_frame_it = frames_.begin();
-  FrameIterator last_frame_it = frames_.begin();
-  absl::InlinedVector<int64_t, 4> frames_in_temporal_unit;
-  uint32_t last_decodable_temporal_unit_timestamp;
-  for (auto frame_it = frames_.begin(); frame_it != frames_.end();) {
+  FrameIterator frame_it;
+  if (decodable_scan_.last_scanned_frame_id) {
+    frame_it = frames_.upper_bound(*decodable_scan_.last_scanned_frame_id);
+  } else {
+    frame_it = frames_.begin();
+    decodable_scan_.first_frame_in_temporal_unit = frames_.begin();
+  }
+
+  FrameIterator& first_frame_it = decodable_scan_.first_frame_in_temporal_unit;
+  absl::InlinedVector<int64_t, 4>& frames_in_temporal_unit =
+      decodable_scan_.frames_in_temporal_unit;
+  while (frame_it != frames_.end()) {
     if (GetFrameId(frame_it) > *last_continuous_temporal_unit_frame_id_) {
       break;
     }
@@ -232,8 +245,9 @@ void FrameBuffer::FindNextAndLastDecodableTemporalUnit() {
     }
 
     frames_in_temporal_unit.push_back(GetFrameId(frame_it));
+    decodable_scan_.last_scanned_frame_id = GetFrameId(frame_it);
 
-    last_frame_it = frame_it++;
+    FrameIterator last_frame_it = frame_it++;
 
     if (IsLastFrameInTemporalUnit(last_frame_it)) {
       bool temporal_unit_decodable = true;
@@ -255,7 +269,8 @@ void FrameBuffer::FindNextAndLastDecodableTemporalUnit() {
           next_decodable_temporal_unit_ = {first_frame_it, last_frame_it};
         }
 
-        last_decodable_temporal_unit_timestamp = GetTimestamp(first_frame_it);
+        decodable_scan_.last_decodable_temporal_unit_timestamp =
+            GetTimestamp(first_frame_it);
       }
     }
   }
@@ -264,14 +279,20 @@ void FrameBuffer::FindNextAndLastDecodableTemporalUnit() {
     decodable_temporal_units_info_ = {
         .next_rtp_timestamp =
             GetTimestamp(next_decodable_temporal_unit_->first_frame),
-        .last_rtp_timestamp = last_decodable_temporal_unit_timestamp};
+        .last_rtp_timestamp =
+            decodable_scan_.last_decodable_temporal_unit_timestamp};
   }
 }
 
-void FrameBuffer::Clear() {
-  frames_.clear();
+void FrameBuffer::ResetDecodableScan() {
+  decodable_scan_ = DecodableScan();
   next_decodable_temporal_unit_.reset();
   decodable_temporal_units_info_.reset();
+}
+
+void FrameBuffer::Clear() {
+  frames_.clear();
+  ResetDecodableScan();
   last_continuous_frame_id_.reset();
   last_continuous_temporal_unit_frame_id_.reset();
   decoded_frame_history_.Clear();
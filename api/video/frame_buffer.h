@@ -83,15 +83,28 @@ class FrameBuffer {
     FrameIterator last_frame;
   };
 
+  // Where FindNextAndLastDecodableTemporalUnit() stopped scanning. Frames
+  // inserted after `last_scanned_frame_id` don't change the result for the
+  // frames already scanned, so the scan is resumed from there instead of
+  // restarting from the oldest frame.
+  struct DecodableScan {
+    absl::optional<int64_t> last_scanned_frame_id;
+    FrameIterator first_frame_in_temporal_unit;
+    absl::InlinedVector<int64_t, 4> frames_in_temporal_unit;
+    uint32_t last_decodable_temporal_unit_timestamp = 0;
+  };
+
   bool IsContinuous(const FrameIterator& it) const;
   void PropagateContinuity(const FrameIterator& frame_it);
   void FindNextAndLastDecodableTemporalUnit();
+  void ResetDecodableScan();
   void Clear();
 
   const bool legacy_frame_id_jump_behavior_;
   const size_t max_size_;
   FrameMap frames_;
   absl::optional<TemporalUnit> next_decodable_temporal_unit_;
+  DecodableScan decodable_scan_;
   absl::optional<DecodabilityInfo> decodable_temporal_units_info_;
   absl::optional<int64_t> last_continuous_frame_id_;
   absl::optional<int64_t> last_continuous_temporal_unit_frame_id_;
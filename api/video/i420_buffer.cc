@@ -12,6 +12,7 @@
 #include <string.h>
 
 #include <algorithm>
+#include <memory>
 #include <utility>
 
 #include "api/make_ref_counted.h"
@@ -19,6 +20,7 @@
 #include "third_party/libyuv/include/libyuv/convert.h"
 #include "third_party/libyuv/include/libyuv/planar_functions.h"
 #include "third_party/libyuv/include/libyuv/scale.h"
+#include "third_party/libyuv/include/libyuv/scale_uv.h"
 
 // Aligning pointer to 64 bytes for improved performance, e.g. use SIMD.
 static const int kBufferAlignment = 64;
@@ -213,6 +215,53 @@ void I420Buffer::CropAndScaleFrom(const I420BufferInterface& src,
   RTC_DCHECK_EQ(res, 0);
 }
 
+void I420Buffer::CropAndScaleFrom(const NV12BufferInterface& src,
+                                  int offset_x,
+                                  int offset_y,
+                                  int crop_width,
+                                  int crop_height) {
+  RTC_CHECK_LE(crop_width, src.width());
+  RTC_CHECK_LE(crop_height, src.height());
+  RTC_CHECK_LE(crop_width + offset_x, src.width());
+  RTC_CHECK_LE(crop_height + offset_y, src.height());
+  RTC_CHECK_GE(offset_x, 0);
+  RTC_CHECK_GE(offset_y, 0);
+
+  // Make sure offset is even so that u/v plane becomes aligned.
+  const int uv_offset_x = offset_x / 2;
+  const int uv_offset_y = offset_y / 2;
+  offset_x = uv_offset_x * 2;
+  offset_y = uv_offset_y * 2;
+
+  const uint8_t* y_plane = src.DataY() + src.StrideY() * offset_y + offset_x;
+  const uint8_t* uv_plane =
+      src.DataUV() + src.StrideUV() * uv_offset_y + uv_offset_x * 2;
+  if (crop_width == width() && crop_height == height()) {
+    int res = libyuv::NV12ToI420(y_plane, src.StrideY(), uv_plane,
+                                 src.StrideUV(), MutableDataY(), StrideY(),
+                                 MutableDataU(), StrideU(), MutableDataV(),
+                                 StrideV(), width(), height());
+    RTC_DCHECK_EQ(res, 0);
+    return;
+  }
+
+  // Scale the interleaved chroma before splitting it, so that only the
+  // destination sized chroma goes through the temporary buffer.
+  const int chroma_width = ChromaWidth();
+  const int chroma_height = ChromaHeight();
+  std::unique_ptr<uint8_t, AlignedFreeDeleter> uv(static_cast<uint8_t*>(
+      AlignedMalloc(chroma_width * chroma_height * 2, kBufferAlignment)));
+  libyuv::ScalePlane(y_plane, src.StrideY(), crop_width, crop_height,
+                     MutableDataY(), StrideY(), width(), height(),
+                     libyuv::kFilterBox);
+  int res = libyuv::UVScale(uv_plane, src.StrideUV(), (crop_width + 1) / 2,
+                            (crop_height + 1) / 2, uv.get(), chroma_width * 2,
+                            chroma_width, chroma_height, libyuv::kFilterBox);
+  RTC_DCHECK_EQ(res, 0);
+  libyuv::SplitUVPlane(uv.get(), chroma_width * 2, MutableDataU(), StrideU(),
+                       MutableDataV(), StrideV(), chroma_width, chroma_height);
+}
+
 void I420Buffer::CropAndScaleFrom(const I420BufferInterface& src) {
   const int crop_width =
       height() > 0 ? std::min(src.width(), width() * src.height() / height())
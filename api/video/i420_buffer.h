@@ -91,6 +91,15 @@ class RTC_EXPORT I420Buffer : public I420BufferInterface {
                         int crop_width,
                         int crop_height);
 
+  // Same as above, but converts from NV12 in the same pass. Cheaper than
+  // cropping and scaling `src` as NV12 and then converting it with ToI420(),
+  // for encoders that only take I420.
+  void CropAndScaleFrom(const NV12BufferInterface& src,
+                        int offset_x,
+                        int offset_y,
+                        int crop_width,
+                        int crop_height);
+
   // The common case of a center crop, when needed to adjust the
   // aspect ratio without distorting the image.
   void CropAndScaleFrom(const I420BufferInterface& src);
@@ -49,6 +49,21 @@ void FillNV12Buffer(rtc::scoped_refptr<NV12Buffer> buf) {
   }
 }
 
+void FillNV12BufferWithGradient(rtc::scoped_refptr<NV12Buffer> buf) {
+  for (int row = 0; row < buf->height(); ++row) {
+    for (int col = 0; col < buf->width(); ++col) {
+      buf->MutableDataY()[row * buf->StrideY() + col] = row * 4 + col;
+    }
+  }
+  for (int row = 0; row < buf->ChromaHeight(); ++row) {
+    for (int col = 0; col < buf->ChromaWidth(); ++col) {
+      int uv_index = row * buf->StrideUV() + col * 2;
+      buf->MutableDataUV()[uv_index] = row * 8 + col;
+      buf->MutableDataUV()[uv_index + 1] = 255 - row * 8 - col;
+    }
+  }
+}
+
 }  // namespace
 
 TEST(NV12BufferTest, InitialData) {
@@ -116,4 +131,27 @@ TEST(NV12BufferTest, ToI420) {
   EXPECT_TRUE(test::FrameBufsEqual(reference, i420_buffer));
 }
 
+TEST(NV12BufferTest, CropAndScaleToI420MatchesCropScaleAndConvert) {
+  rtc::scoped_refptr<NV12Buffer> nv12_buffer(NV12Buffer::Create(40, 30));
+  FillNV12BufferWithGradient(nv12_buffer);
+
+  // Cropping only, scaling down, and scaling up.
+  const struct {
+    int offset_x, offset_y, crop_width, crop_height, width, height;
+  } kCases[] = {{2, 4, 36, 22, 36, 22},
+                {3, 1, 32, 24, 15, 11},
+                {0, 0, 40, 30, 60, 46}};
+  for (const auto& c : kCases) {
+    rtc::scoped_refptr<NV12Buffer> scaled_nv12(
+        NV12Buffer::Create(c.width, c.height));
+    scaled_nv12->CropAndScaleFrom(*nv12_buffer, c.offset_x, c.offset_y,
+                                  c.crop_width, c.crop_height);
+    rtc::scoped_refptr<I420Buffer> i420_buffer(
+        I420Buffer::Create(c.width, c.height));
+    i420_buffer->CropAndScaleFrom(*nv12_buffer, c.offset_x, c.offset_y,
+                                  c.crop_width, c.crop_height);
+    EXPECT_TRUE(test::FrameBufsEqual(scaled_nv12->ToI420(), i420_buffer));
+  }
+}
+
 }  // namespace webrtc
@@ -43,6 +43,12 @@ struct RTC_EXPORT VideoSinkWants {
   // Tells the source that the sink only wants black frames.
   bool black_frames = false;
 
+  // Tells the source that the sink reads the pixels of I420 frames, e.g. on
+  // the CPU. Sources that forward native or other non-I420 buffers, such as
+  // hardware decoder output, convert frames for such sinks only. Other sinks
+  // get the buffers as produced.
+  bool requires_i420 = false;
+
   // Tells the source the maximum number of pixels the sink wants.
   int max_pixel_count = std::numeric_limits<int>::max();
   // Tells the source the desired number of pixels the sinks wants. This will
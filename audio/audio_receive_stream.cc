@@ -347,6 +347,12 @@ void AudioReceiveStreamImpl::SetSink(AudioSinkInterface* sink) {
   channel_receive_->SetSink(sink);
 }
 
+void AudioReceiveStreamImpl::SetDecodedAudioProcessor(
+    DecodedAudioProcessor* processor) {
+  RTC_DCHECK_RUN_ON(&worker_thread_checker_);
+  channel_receive_->SetDecodedAudioProcessor(processor);
+}
+
 void AudioReceiveStreamImpl::SetGain(float gain) {
   RTC_DCHECK_RUN_ON(&worker_thread_checker_);
   channel_receive_->SetChannelOutputVolumeScaling(gain);
@@ -98,6 +98,7 @@ class AudioReceiveStreamImpl final : public webrtc::AudioReceiveStreamInterface,
   webrtc::AudioReceiveStreamInterface::Stats GetStats(
       bool get_and_clear_legacy_stats) const override;
   void SetSink(AudioSinkInterface* sink) override;
+  void SetDecodedAudioProcessor(DecodedAudioProcessor* processor) override;
   void SetGain(float gain) override;
   bool SetBaseMinimumPlayoutDelayMs(int delay_ms) override;
   int GetBaseMinimumPlayoutDelayMs() const override;
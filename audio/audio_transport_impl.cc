@@ -20,7 +20,9 @@
 #include "modules/async_audio_processing/async_audio_processing.h"
 #include "modules/audio_processing/include/audio_frame_proxies.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/time_utils.h"
 #include "rtc_base/trace_event.h"
+#include "system_wrappers/include/metrics.h"
 
 namespace webrtc {
 
@@ -53,11 +55,15 @@ void ProcessCaptureFrame(uint32_t delay_ms,
                          AudioFrame* audio_frame) {
   RTC_DCHECK(audio_frame);
   if (audio_processing) {
+    TRACE_EVENT0("webrtc", "ProcessCaptureFrame");
+    const int64_t process_start_us = rtc::TimeMicros();
     audio_processing->set_stream_delay_ms(delay_ms);
     audio_processing->set_stream_key_pressed(key_pressed);
     int error = ProcessAudioFrame(audio_processing, audio_frame);
 
     RTC_DCHECK_EQ(0, error) << "ProcessStream() error: " << error;
+    RTC_HISTOGRAM_COUNTS_10000("WebRTC.Audio.CaptureProcessingTimeUs",
+                               rtc::TimeMicros() - process_start_us);
   }
 
   if (swap_stereo_channels) {
@@ -170,6 +176,11 @@ int32_t AudioTransportImpl::RecordedDataIsAvailable(
   if (estimated_capture_time_ns) {
     audio_frame->set_absolute_capture_timestamp_ms(*estimated_capture_time_ns /
                                                    1000000);
+    // Time from capture until the audio has been through the device buffers,
+    // resampling and audio processing.
+    RTC_HISTOGRAM_COUNTS_1000(
+        "WebRTC.Audio.CaptureToProcessedDelayMs",
+        rtc::TimeMillis() - *audio_frame->absolute_capture_timestamp_ms());
   }
 
   RTC_DCHECK_GT(audio_frame->samples_per_channel_, 0);
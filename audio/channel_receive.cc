@@ -108,6 +108,7 @@ class ChannelReceive : public ChannelReceiveInterface,
   ~ChannelReceive() override;
 
   void SetSink(AudioSinkInterface* sink) override;
+  void SetDecodedAudioProcessor(DecodedAudioProcessor* processor) override;
 
   void SetReceiveCodecs(const std::map<int, SdpAudioFormat>& codecs) override;
 
@@ -250,6 +251,8 @@ class ChannelReceive : public ChannelReceiveInterface,
   // The AcmReceiver is thread safe, using its own lock.
   acm2::AcmReceiver acm_receiver_;
   AudioSinkInterface* audio_sink_ = nullptr;
+  DecodedAudioProcessor* decoded_audio_processor_
+      RTC_GUARDED_BY(callback_mutex_) = nullptr;
   AudioLevel _outputAudioLevel;
 
   Clock* const clock_;
@@ -413,8 +416,12 @@ AudioMixer::Source::AudioFrameInfo ChannelReceive::GetAudioFrameWithInfo(
     // Pass the audio buffers to an optional sink callback, before applying
     // scaling/panning, as that applies to the mix operation.
     // External recipients of the audio (e.g. via AudioTrack), will do their
-    // own mixing/dynamic processing.
+    // own mixing/dynamic processing. The decoded audio processor runs first,
+    // so that the sink receives the processed audio.
     MutexLock lock(&callback_mutex_);
+    if (decoded_audio_processor_) {
+      decoded_audio_processor_->Process(audio_frame);
+    }
     if (audio_sink_) {
       AudioSinkInterface::Data data(
           audio_frame->data(), audio_frame->samples_per_channel_,
@@ -616,6 +623,13 @@ void ChannelReceive::SetSink(AudioSinkInterface* sink) {
   audio_sink_ = sink;
 }
 
+void ChannelReceive::SetDecodedAudioProcessor(
+    DecodedAudioProcessor* processor) {
+  RTC_DCHECK_RUN_ON(&worker_thread_checker_);
+  MutexLock lock(&callback_mutex_);
+  decoded_audio_processor_ = processor;
+}
+
 void ChannelReceive::StartPlayout() {
   RTC_DCHECK_RUN_ON(&worker_thread_checker_);
   playing_ = true;
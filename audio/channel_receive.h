@@ -18,6 +18,7 @@
 
 #include "absl/types/optional.h"
 #include "api/audio/audio_mixer.h"
+#include "api/audio/decoded_audio_processor.h"
 #include "api/audio_codecs/audio_decoder_factory.h"
 #include "api/call/audio_sink.h"
 #include "api/call/transport.h"
@@ -90,6 +91,7 @@ class ChannelReceiveInterface : public RtpPacketSinkInterface {
   virtual ~ChannelReceiveInterface() = default;
 
   virtual void SetSink(AudioSinkInterface* sink) = 0;
+  virtual void SetDecodedAudioProcessor(DecodedAudioProcessor* processor) = 0;
 
   virtual void SetReceiveCodecs(
       const std::map<int, SdpAudioFormat>& codecs) = 0;
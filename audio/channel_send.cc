@@ -35,6 +35,7 @@
 #include "rtc_base/event.h"
 #include "rtc_base/logging.h"
 #include "rtc_base/numerics/safe_conversions.h"
+#include "rtc_base/numerics/safe_minmax.h"
 #include "rtc_base/race_checker.h"
 #include "rtc_base/rate_limiter.h"
 #include "rtc_base/synchronization/mutex.h"
@@ -175,6 +176,10 @@ class ChannelSend : public ChannelSendInterface,
   void InitFrameTransformerDelegate(
       rtc::scoped_refptr<webrtc::FrameTransformerInterface> frame_transformer);
 
+  // Mutes, analyzes the level of and encodes one 10 ms frame.
+  void EncodeFrame(const std::unique_ptr<AudioFrame>& audio_frame)
+      RTC_RUN_ON(encoder_queue_);
+
   // Thread checkers document and lock usage of some methods on voe::Channel to
   // specific threads we know about. The goal is to eventually split up
   // voe::Channel into parts with single-threaded semantics, and thereby reduce
@@ -203,6 +208,17 @@ class ChannelSend : public ChannelSendInterface,
   absl::optional<int64_t> last_capture_timestamp_ms_
       RTC_GUARDED_BY(audio_thread_race_checker_);
 
+  // When enabled, 10 ms frames are collected into batches spanning one encoder
+  // packet and each batch is encoded in a single task, instead of posting one
+  // task per frame.
+  const bool frame_batching_enabled_;
+  std::vector<std::unique_ptr<AudioFrame>> pending_frames_
+      RTC_GUARDED_BY(audio_thread_race_checker_);
+  std::atomic<int> frames_per_batch_ = 1;
+  // Set when the encoder has produced a packet, used to align the batches with
+  // the packet boundaries.
+  bool packet_encoded_ RTC_GUARDED_BY(encoder_queue_) = false;
+
   RmsLevel rms_level_ RTC_GUARDED_BY(encoder_queue_);
   bool input_mute_ RTC_GUARDED_BY(volume_settings_mutex_) = false;
   bool previous_frame_muted_ RTC_GUARDED_BY(encoder_queue_) = false;
@@ -240,6 +256,8 @@ class ChannelSend : public ChannelSendInterface,
 };
 
 const int kTelephoneEventAttenuationdB = 10;
+// Batches are limited to the longest packet time in common use.
+constexpr int kMaxFramesPerBatch = 6;
 
 class RtpPacketSenderProxy : public RtpPacketSender {
  public:
@@ -275,6 +293,7 @@ int32_t ChannelSend::SendData(AudioFrameType frameType,
                               size_t payloadSize,
                               int64_t absolute_capture_timestamp_ms) {
   RTC_DCHECK_RUN_ON(&encoder_queue_);
+  packet_encoded_ = true;
   rtc::ArrayView<const uint8_t> payload(payloadData, payloadSize);
   if (frame_transformer_delegate_) {
     // Asynchronously transform the payload before sending it. After the payload
@@ -294,6 +313,15 @@ int32_t ChannelSend::SendRtpAudio(AudioFrameType frameType,
                                   uint32_t rtp_timestamp,
                                   rtc::ArrayView<const uint8_t> payload,
                                   int64_t absolute_capture_timestamp_ms) {
+  if (absolute_capture_timestamp_ms >= 0) {
+    // Time from capture until the encoded audio is packetized, which adds the
+    // encoder task queue and the encoder's frame buffering to the delay of
+    // WebRTC.Audio.CaptureToProcessedDelayMs.
+    RTC_HISTOGRAM_COUNTS_1000(
+        "WebRTC.Audio.CaptureToEncodedDelayMs",
+        rtc::TimeMillis() - absolute_capture_timestamp_ms);
+  }
+
   if (include_audio_level_indication_.load()) {
     // Store current audio level in the RTP sender.
     // The level will be used in combination with voice-activity state
@@ -384,6 +412,8 @@ ChannelSend::ChannelSend(
     const FieldTrialsView& field_trials)
     : ssrc_(ssrc),
       event_log_(rtc_event_log),
+      frame_batching_enabled_(
+          field_trials.IsEnabled("WebRTC-Audio-EncoderFrameBatching")),
       rtp_packet_pacer_proxy_(new RtpPacketSenderProxy()),
       retransmission_rate_limiter_(
           new RateLimiter(clock, kMaxRetransmissionWindowMs)),
@@ -503,6 +533,9 @@ void ChannelSend::SetEncoder(int payload_type,
                                           encoder->RtpTimestampRateHz(),
                                           encoder->NumChannels(), 0);
 
+  frames_per_batch_.store(rtc::SafeClamp(
+      static_cast<int>(encoder->Num10MsFramesInNextPacket()), 1,
+      kMaxFramesPerBatch));
   audio_coding_->SetEncoder(std::move(encoder));
 }
 
@@ -721,6 +754,8 @@ void ChannelSend::ProcessAndEncodeAudio(
   // after sending is resumed.
   if (first_frame_.load()) {
     first_frame_.store(false);
+    // Frames batched before sending was stopped are dropped.
+    pending_frames_.clear();
     if (last_capture_timestamp_ms_ &&
         audio_frame->absolute_capture_timestamp_ms()) {
       int64_t diff_ms = *audio_frame->absolute_capture_timestamp_ms() -
@@ -739,47 +774,83 @@ void ChannelSend::ProcessAndEncodeAudio(
   timestamp_ += audio_frame->samples_per_channel_;
   last_capture_timestamp_ms_ = audio_frame->absolute_capture_timestamp_ms();
 
-  // Profile time between when the audio frame is added to the task queue and
-  // when the task is actually executed.
-  audio_frame->UpdateProfileTimeStamp();
-  encoder_queue_.PostTask(
-      [this, audio_frame = std::move(audio_frame)]() mutable {
-        RTC_DCHECK_RUN_ON(&encoder_queue_);
-        if (!encoder_queue_is_active_.load()) {
-          return;
-        }
-        // Measure time between when the audio frame is added to the task queue
-        // and when the task is actually executed. Goal is to keep track of
-        // unwanted extra latency added by the task queue.
-        RTC_HISTOGRAM_COUNTS_10000("WebRTC.Audio.EncodingTaskQueueLatencyMs",
-                                   audio_frame->ElapsedProfileTimeMs());
-
-        bool is_muted = InputMute();
-        AudioFrameOperations::Mute(audio_frame.get(), previous_frame_muted_,
-                                   is_muted);
-
-        if (include_audio_level_indication_.load()) {
-          size_t length =
-              audio_frame->samples_per_channel_ * audio_frame->num_channels_;
-          RTC_CHECK_LE(length, AudioFrame::kMaxDataSizeBytes);
-          if (is_muted && previous_frame_muted_) {
-            rms_level_.AnalyzeMuted(length);
-          } else {
-            rms_level_.Analyze(
-                rtc::ArrayView<const int16_t>(audio_frame->data(), length));
+  if (!frame_batching_enabled_) {
+    // Profile time between when the audio frame is added to the task queue and
+    // when the task is actually executed.
+    audio_frame->UpdateProfileTimeStamp();
+    encoder_queue_.PostTask(
+        [this, audio_frame = std::move(audio_frame)]() {
+          RTC_DCHECK_RUN_ON(&encoder_queue_);
+          if (!encoder_queue_is_active_.load()) {
+            return;
           }
-        }
-        previous_frame_muted_ = is_muted;
-
-        // This call will trigger AudioPacketizationCallback::SendData if
-        // encoding is done and payload is ready for packetization and
-        // transmission. Otherwise, it will return without invoking the
-        // callback.
-        if (audio_coding_->Add10MsData(*audio_frame) < 0) {
-          RTC_DLOG(LS_ERROR) << "ACM::Add10MsData() failed.";
-          return;
-        }
+          EncodeFrame(audio_frame);
+        });
+    return;
+  }
+
+  pending_frames_.push_back(std::move(audio_frame));
+  if (static_cast<int>(pending_frames_.size()) < frames_per_batch_.load()) {
+    return;
+  }
+  for (auto& frame : pending_frames_) {
+    frame->UpdateProfileTimeStamp();
+  }
+  encoder_queue_.PostTask([this, frames = std::move(pending_frames_)]() {
+    RTC_DCHECK_RUN_ON(&encoder_queue_);
+    if (!encoder_queue_is_active_.load()) {
+      return;
+    }
+    for (const auto& frame : frames) {
+      packet_encoded_ = false;
+      EncodeFrame(frame);
+    }
+    // Unless the last frame completed a packet, the batches are not aligned
+    // with the packets; post single frames until they are.
+    int frames_per_batch = 1;
+    if (packet_encoded_) {
+      CallEncoder([&frames_per_batch](AudioEncoder* encoder) {
+        frames_per_batch =
+            static_cast<int>(encoder->Num10MsFramesInNextPacket());
       });
+    }
+    frames_per_batch_.store(
+        rtc::SafeClamp(frames_per_batch, 1, kMaxFramesPerBatch));
+  });
+  pending_frames_.clear();
+}
+
+void ChannelSend::EncodeFrame(const std::unique_ptr<AudioFrame>& audio_frame) {
+  // Measure time between when the audio frame is added to the task queue
+  // and when the task is actually executed. Goal is to keep track of
+  // unwanted extra latency added by the task queue.
+  RTC_HISTOGRAM_COUNTS_10000("WebRTC.Audio.EncodingTaskQueueLatencyMs",
+                             audio_frame->ElapsedProfileTimeMs());
+
+  bool is_muted = InputMute();
+  AudioFrameOperations::Mute(audio_frame.get(), previous_frame_muted_,
+                             is_muted);
+
+  if (include_audio_level_indication_.load()) {
+    size_t length =
+        audio_frame->samples_per_channel_ * audio_frame->num_channels_;
+    RTC_CHECK_LE(length, AudioFrame::kMaxDataSizeBytes);
+    if (is_muted && previous_frame_muted_) {
+      rms_level_.AnalyzeMuted(length);
+    } else {
+      rms_level_.Analyze(
+          rtc::ArrayView<const int16_t>(audio_frame->data(), length));
+    }
+  }
+  previous_frame_muted_ = is_muted;
+
+  // This call will trigger AudioPacketizationCallback::SendData if
+  // encoding is done and payload is ready for packetization and
+  // transmission. Otherwise, it will return without invoking the
+  // callback.
+  if (audio_coding_->Add10MsData(*audio_frame) < 0) {
+    RTC_DLOG(LS_ERROR) << "ACM::Add10MsData() failed.";
+  }
 }
 
 ANAStats ChannelSend::GetANAStatistics() const {
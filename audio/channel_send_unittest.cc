@@ -10,8 +10,11 @@
 
 #include "audio/channel_send.h"
 
+#include <string>
 #include <utility>
+#include <vector>
 
+#include "absl/strings/string_view.h"
 #include "api/audio/audio_frame.h"
 #include "api/audio_codecs/builtin_audio_encoder_factory.h"
 #include "api/rtc_event_log/rtc_event_log.h"
@@ -48,8 +51,9 @@ BitrateConstraints GetBitrateConfig() {
 
 class ChannelSendTest : public ::testing::Test {
  protected:
-  ChannelSendTest()
+  explicit ChannelSendTest(absl::string_view field_trials = "")
       : time_controller_(Timestamp::Seconds(1)),
+        field_trials_(std::string(field_trials)),
         transport_controller_(
             time_controller_.GetClock(),
             RtpTransportConfig{
@@ -145,6 +149,46 @@ TEST_F(ChannelSendTest, IncreaseRtpTimestampByPauseDuration) {
   EXPECT_EQ(timestamp_gap_ms, 10020);
 }
 
+class ChannelSendFrameBatchingTest : public ChannelSendTest {
+ protected:
+  ChannelSendFrameBatchingTest()
+      : ChannelSendTest("WebRTC-Audio-EncoderFrameBatching/Enabled/") {}
+};
+
+TEST_F(ChannelSendFrameBatchingTest, SendsOnePacketPerBatch) {
+  channel_->StartSend();
+  std::vector<uint32_t> timestamps;
+  auto send_rtp = [&](const uint8_t* data, size_t length,
+                      const PacketOptions& options) {
+    RtpPacketReceived packet;
+    packet.Parse(data, length);
+    timestamps.push_back(packet.Timestamp());
+    return true;
+  };
+  EXPECT_CALL(transport_, SendRtp).WillRepeatedly(Invoke(send_rtp));
+  for (int i = 0; i < 6; ++i) {
+    ProcessNextFrame();
+    EXPECT_EQ(timestamps.size(), static_cast<size_t>((i + 1) / 2));
+  }
+  ASSERT_EQ(timestamps.size(), 3u);
+  EXPECT_EQ(timestamps[1] - timestamps[0], 960u);
+  EXPECT_EQ(timestamps[2] - timestamps[1], 960u);
+}
+
+TEST_F(ChannelSendFrameBatchingTest, StopSendDropsPendingFrames) {
+  channel_->StartSend();
+  EXPECT_CALL(transport_, SendRtp).Times(1);
+  ProcessNextFrame();
+  ProcessNextFrame();
+  ProcessNextFrame();
+  channel_->StopSend();
+  channel_->StartSend();
+  // The frame batched before StopSend is dropped, so a single frame does not
+  // complete a packet.
+  EXPECT_CALL(transport_, SendRtp).Times(0);
+  ProcessNextFrame();
+}
+
 }  // namespace
 }  // namespace voe
 }  // namespace webrtc
@@ -50,6 +50,10 @@ class MockChannelReceive : public voe::ChannelReceiveInterface {
   MOCK_METHOD(double, GetTotalOutputDuration, (), (const, override));
   MOCK_METHOD(uint32_t, GetDelayEstimate, (), (const, override));
   MOCK_METHOD(void, SetSink, (AudioSinkInterface*), (override));
+  MOCK_METHOD(void,
+              SetDecodedAudioProcessor,
+              (DecodedAudioProcessor*),
+              (override));
   MOCK_METHOD(void, OnRtpPacket, (const RtpPacketReceived& packet), (override));
   MOCK_METHOD(void,
               ReceivedRTCPPacket,
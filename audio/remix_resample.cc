@@ -47,6 +47,16 @@ void RemixAndResample(const int16_t* src_data,
     RTC_DCHECK(dst_frame->num_channels_ == 1 || dst_frame->num_channels_ == 2)
         << "dst_frame->num_channels_: " << dst_frame->num_channels_;
 
+    if (sample_rate_hz == dst_frame->sample_rate_hz_) {
+      // No resampling needed, downmix directly into `dst_frame` instead of
+      // having the resampler copy the downmixed audio.
+      AudioFrameOperations::DownmixChannels(
+          src_data, num_channels, samples_per_channel,
+          dst_frame->num_channels_, dst_frame->mutable_data());
+      dst_frame->samples_per_channel_ = samples_per_channel;
+      return;
+    }
+
     AudioFrameOperations::DownmixChannels(
         src_data, num_channels, samples_per_channel, dst_frame->num_channels_,
         downmixed_audio);
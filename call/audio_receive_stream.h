@@ -17,6 +17,7 @@
 #include <vector>
 
 #include "absl/types/optional.h"
+#include "api/audio/decoded_audio_processor.h"
 #include "api/audio_codecs/audio_decoder_factory.h"
 #include "api/call/transport.h"
 #include "api/crypto/crypto_options.h"
@@ -180,6 +181,11 @@ class AudioReceiveStreamInterface : public MediaReceiveStreamInterface {
   // of feeding to the AEC.
   virtual void SetSink(AudioSinkInterface* sink) = 0;
 
+  // Sets a processor applied to the decoded audio of the stream, ahead of the
+  // audio sink and the mixer. Ownership of the processor is managed by the
+  // caller. Only one processor can be set and passing null clears it.
+  virtual void SetDecodedAudioProcessor(DecodedAudioProcessor* processor) = 0;
+
   // Sets playback gain of the stream, applied when mixing, and thus after it
   // is potentially forwarded to any attached AudioSinkInterface implementation.
   virtual void SetGain(float gain) = 0;
@@ -17,6 +17,7 @@
 #include <utility>
 
 #include "absl/algorithm/container.h"
+#include "absl/types/optional.h"
 #include "api/units/data_rate.h"
 #include "api/units/time_delta.h"
 #include "rtc_base/checks.h"
@@ -41,6 +42,10 @@ const uint32_t kMinToggleBitrateBps = 20000;
 
 const int64_t kBweLogIntervalMs = 5000;
 
+// Observers that report using less than their allocation keep this much more
+// than they used, so that they can still increase their rate.
+const double kUtilizationHeadroomFactor = 1.2;
+
 double MediaRatio(uint32_t allocated_bitrate, uint32_t protection_bitrate) {
   RTC_DCHECK_GT(allocated_bitrate, 0);
   if (protection_bitrate == 0)
@@ -183,6 +188,70 @@ void DistributeBitrateRelatively(
   }
 }
 
+// Moves the bitrate that observers report they do not use, e.g. because their
+// encoders undershoot the target on simple content, to the other observers.
+// An observer with a utilization factor below one keeps
+// `kUtilizationHeadroomFactor` times the bitrate it used of its previous
+// allocation, and at least its min bitrate. No more is moved than the other
+// observers can be allocated below their max bitrate.
+void ReassignUnusedBitrate(
+    const std::vector<AllocatableTrack>& allocatable_tracks,
+    std::map<BitrateAllocatorObserver*, int>* allocation) {
+  std::map<BitrateAllocatorObserver*, int64_t> unused_bitrates;
+  int64_t sum_unused_bitrate = 0;
+  for (const auto& observer_config : allocatable_tracks) {
+    absl::optional<double> utilization =
+        observer_config.observer->GetUtilizationFactor();
+    // An observer that uses all of its allocation may be limited by it, so it
+    // is given its share as usual.
+    if (!utilization || *utilization >= 1.0 ||
+        observer_config.allocated_bitrate_bps <= 0) {
+      continue;
+    }
+    int64_t used_bitrate = std::max<int64_t>(
+        observer_config.config.min_bitrate_bps,
+        std::max(*utilization, 0.0) * kUtilizationHeadroomFactor *
+            observer_config.allocated_bitrate_bps);
+    int64_t unused_bitrate =
+        allocation->at(observer_config.observer) - used_bitrate;
+    if (unused_bitrate > 0) {
+      unused_bitrates[observer_config.observer] = unused_bitrate;
+      sum_unused_bitrate += unused_bitrate;
+    }
+  }
+  if (sum_unused_bitrate == 0)
+    return;
+
+  std::map<BitrateAllocatorObserver*, int> observers_capacities;
+  int64_t sum_capacities = 0;
+  for (const auto& observer_config : allocatable_tracks) {
+    int capacity = 0;
+    if (unused_bitrates.find(observer_config.observer) ==
+        unused_bitrates.end()) {
+      capacity = std::max<int>(observer_config.config.max_bitrate_bps -
+                                   allocation->at(observer_config.observer),
+                               0);
+    }
+    observers_capacities[observer_config.observer] = capacity;
+    sum_capacities += capacity;
+  }
+  if (sum_capacities == 0)
+    return;
+
+  double reassigned_fraction =
+      std::min(1.0, static_cast<double>(sum_capacities) / sum_unused_bitrate);
+  uint32_t reassigned_bitrate = 0;
+  for (const auto& [observer, unused_bitrate] : unused_bitrates) {
+    int bitrate = reassigned_fraction * unused_bitrate;
+    allocation->at(observer) -= bitrate;
+    reassigned_bitrate += bitrate;
+  }
+  if (reassigned_bitrate > 0) {
+    DistributeBitrateRelatively(allocatable_tracks, reassigned_bitrate,
+                                observers_capacities, allocation);
+  }
+}
+
 // Allocates bitrate to observers when there isn't enough to allocate the
 // minimum to all observers.
 std::map<BitrateAllocatorObserver*, int> LowRateAllocation(
@@ -287,6 +356,7 @@ std::map<BitrateAllocatorObserver*, int> NormalRateAllocation(
     DistributeBitrateRelatively(allocatable_tracks, bitrate,
                                 observers_capacities, &allocation);
 
+  ReassignUnusedBitrate(allocatable_tracks, &allocation);
   return allocation;
 }
 
@@ -19,6 +19,7 @@
 #include <utility>
 #include <vector>
 
+#include "absl/types/optional.h"
 #include "api/call/bitrate_allocation.h"
 #include "api/sequence_checker.h"
 #include "api/transport/network_types.h"
@@ -38,6 +39,15 @@ class BitrateAllocatorObserver {
   // implementation, as bitrate in bps.
   virtual uint32_t OnBitrateUpdated(BitrateAllocationUpdate update) = 0;
 
+  // Returns the ratio between the bitrate the observer has produced and the
+  // target bitrate it was last allocated, e.g. the network rate utilization
+  // factor of its encoder, or nullopt if it is not known. An observer that
+  // uses less than its allocation gives the unused part to the other
+  // observers.
+  virtual absl::optional<double> GetUtilizationFactor() const {
+    return absl::nullopt;
+  }
+
  protected:
   virtual ~BitrateAllocatorObserver() {}
 };
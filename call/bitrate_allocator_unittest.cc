@@ -15,6 +15,7 @@
 #include <vector>
 
 #include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
 #include "system_wrappers/include/clock.h"
 #include "test/gmock.h"
 #include "test/gtest.h"
@@ -67,6 +68,10 @@ class TestBitrateObserver : public BitrateAllocatorObserver {
     protection_ratio_ = protection_ratio;
   }
 
+  void SetUtilizationFactor(absl::optional<double> utilization_factor) {
+    utilization_factor_ = utilization_factor;
+  }
+
   uint32_t OnBitrateUpdated(BitrateAllocationUpdate update) override {
     last_bitrate_bps_ = update.target_bitrate.bps();
     last_fraction_loss_ =
@@ -75,11 +80,15 @@ class TestBitrateObserver : public BitrateAllocatorObserver {
     last_probing_interval_ms_ = update.bwe_period.ms();
     return update.target_bitrate.bps() * protection_ratio_;
   }
+  absl::optional<double> GetUtilizationFactor() const override {
+    return utilization_factor_;
+  }
   uint32_t last_bitrate_bps_;
   uint8_t last_fraction_loss_;
   int64_t last_rtt_ms_;
   int last_probing_interval_ms_;
   double protection_ratio_;
+  absl::optional<double> utilization_factor_;
 };
 
 constexpr int64_t kDefaultProbingIntervalMs = 3000;
@@ -1034,4 +1043,60 @@ TEST_F(BitrateAllocatorTest, PriorityRateThreeObserversTwoAllocatedToMax) {
   allocator_->RemoveObserver(&observer_high);
 }
 
+TEST_F(BitrateAllocatorTest, ReassignsBitrateUnusedByObserver) {
+  TestBitrateObserver observer_low_utilization;
+  TestBitrateObserver observer_full_utilization;
+  AddObserver(&observer_low_utilization, 100000, 1500000, 0, true,
+              kDefaultBitratePriority);
+  AddObserver(&observer_full_utilization, 100000, 1500000, 0, true,
+              kDefaultBitratePriority);
+  EXPECT_EQ(150000u, observer_low_utilization.last_bitrate_bps_);
+  EXPECT_EQ(150000u, observer_full_utilization.last_bitrate_bps_);
+
+  // The observer used 75 kbps of its 150 kbps and keeps 20 % on top of that,
+  // but at least its min bitrate.
+  observer_low_utilization.SetUtilizationFactor(0.5);
+  observer_full_utilization.SetUtilizationFactor(1.0);
+  allocator_->OnNetworkEstimateChanged(
+      CreateTargetRateMessage(1000000, 0, 0, kDefaultProbingIntervalMs));
+  EXPECT_EQ(100000u, observer_low_utilization.last_bitrate_bps_);
+  EXPECT_EQ(900000u, observer_full_utilization.last_bitrate_bps_);
+
+  // Still using less than its allocation, the observer keeps the headroom on
+  // top of what it used.
+  observer_low_utilization.SetUtilizationFactor(0.9);
+  allocator_->OnNetworkEstimateChanged(
+      CreateTargetRateMessage(1000000, 0, 0, kDefaultProbingIntervalMs));
+  EXPECT_EQ(108000u, observer_low_utilization.last_bitrate_bps_);
+  EXPECT_EQ(892000u, observer_full_utilization.last_bitrate_bps_);
+
+  // Using all of its allocation, the bitrate is shared as usual.
+  observer_low_utilization.SetUtilizationFactor(1.0);
+  allocator_->OnNetworkEstimateChanged(
+      CreateTargetRateMessage(1000000, 0, 0, kDefaultProbingIntervalMs));
+  EXPECT_EQ(500000u, observer_low_utilization.last_bitrate_bps_);
+  EXPECT_EQ(500000u, observer_full_utilization.last_bitrate_bps_);
+
+  allocator_->RemoveObserver(&observer_low_utilization);
+  allocator_->RemoveObserver(&observer_full_utilization);
+}
+
+TEST_F(BitrateAllocatorTest, ReassignsUnusedBitrateOnlyUpToMaxBitrate) {
+  TestBitrateObserver observer_low_utilization;
+  TestBitrateObserver observer_low_max;
+  AddObserver(&observer_low_utilization, 100000, 1500000, 0, true,
+              kDefaultBitratePriority);
+  AddObserver(&observer_low_max, 100000, 600000, 0, true,
+              kDefaultBitratePriority);
+
+  observer_low_utilization.SetUtilizationFactor(0.5);
+  allocator_->OnNetworkEstimateChanged(
+      CreateTargetRateMessage(1000000, 0, 0, kDefaultProbingIntervalMs));
+  EXPECT_EQ(400000u, observer_low_utilization.last_bitrate_bps_);
+  EXPECT_EQ(600000u, observer_low_max.last_bitrate_bps_);
+
+  allocator_->RemoveObserver(&observer_low_utilization);
+  allocator_->RemoveObserver(&observer_low_max);
+}
+
 }  // namespace webrtc
@@ -159,6 +159,7 @@ bool RtpDemuxer::AddSink(const RtpDemuxerCriteria& criteria,
   }
 
   RefreshKnownMids();
+  cached_sink_by_ssrc_.clear();
 
   RTC_DLOG(LS_INFO) << "Added sink = " << sink << " for criteria "
                     << criteria.ToString();
@@ -252,6 +253,7 @@ bool RtpDemuxer::RemoveSink(const RtpPacketSinkInterface* sink) {
                        RemoveFromMapByValue(&sink_by_mid_and_rsid_, sink) +
                        RemoveFromMapByValue(&sink_by_rsid_, sink);
   RefreshKnownMids();
+  cached_sink_by_ssrc_.clear();
   return num_removed > 0;
 }
 
@@ -266,6 +268,29 @@ bool RtpDemuxer::OnRtpPacket(const RtpPacketReceived& packet) {
 
 RtpPacketSinkInterface* RtpDemuxer::ResolveSink(
     const RtpPacketReceived& packet) {
+  uint32_t ssrc = packet.Ssrc();
+  if ((use_mid_ && packet.HasExtension<RtpMid>()) ||
+      packet.HasExtension<RtpStreamId>() ||
+      packet.HasExtension<RepairedRtpStreamId>()) {
+    // The packet may update the MID or RSID learnt for its SSRC.
+    cached_sink_by_ssrc_.erase(ssrc);
+    return ResolveSinkUncached(packet);
+  }
+
+  const auto cached_it = cached_sink_by_ssrc_.find(ssrc);
+  if (cached_it != cached_sink_by_ssrc_.end()) {
+    return cached_it->second;
+  }
+  RtpPacketSinkInterface* sink = ResolveSinkUncached(packet);
+  // Without a binding the sink may depend on the payload type of the packet.
+  if (sink != nullptr && sink_by_ssrc_.find(ssrc) != sink_by_ssrc_.end()) {
+    cached_sink_by_ssrc_.emplace(ssrc, sink);
+  }
+  return sink;
+}
+
+RtpPacketSinkInterface* RtpDemuxer::ResolveSinkUncached(
+    const RtpPacketReceived& packet) {
   // See the BUNDLE spec for high level reference to this algorithm:
   // https://tools.ietf.org/html/draft-ietf-mmusic-sdp-bundle-negotiation-38#section-10.2
 
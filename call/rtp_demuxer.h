@@ -13,6 +13,7 @@
 
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -165,6 +166,7 @@ class RtpDemuxer {
   // Will record any SSRC<->ID associations along the way.
   // If the packet should be dropped, this method returns null.
   RtpPacketSinkInterface* ResolveSink(const RtpPacketReceived& packet);
+  RtpPacketSinkInterface* ResolveSinkUncached(const RtpPacketReceived& packet);
 
   // Used by the ResolveSink algorithm.
   RtpPacketSinkInterface* ResolveSinkByMid(absl::string_view mid,
@@ -207,6 +209,13 @@ class RtpDemuxer {
   flat_map<uint32_t, std::string> mid_by_ssrc_;
   flat_map<uint32_t, std::string> rsid_by_ssrc_;
 
+  // Sinks resolved for packets without MID and RSID header extensions, by
+  // SSRC. The demux algorithm gives these packets the same sink until a sink
+  // is added or removed, or a packet of the SSRC carries a MID or RSID, so
+  // most packets are resolved by a single lookup here. Only SSRCs bound in
+  // `sink_by_ssrc_` are cached, so the size is bounded by kMaxSsrcBindings.
+  std::unordered_map<uint32_t, RtpPacketSinkInterface*> cached_sink_by_ssrc_;
+
   // Adds a binding from the SSRC to the given sink.
   void AddSsrcSinkBinding(uint32_t ssrc, RtpPacketSinkInterface* sink);
 
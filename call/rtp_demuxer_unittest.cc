@@ -1090,6 +1090,52 @@ TEST_F(RtpDemuxerTest, SignaledMidShouldOverwriteSignalledSsrcPersistent) {
   EXPECT_TRUE(demuxer_.OnRtpPacket(*packet_without_mid));
 }
 
+// Packets that are routed by SSRC alone must follow a MID that is learned
+// for the SSRC after earlier packets have been routed.
+TEST_F(RtpDemuxerTest, MidLearnedAfterRoutingBySsrcOverwritesSsrcSink) {
+  constexpr uint32_t ssrc = 11;
+  const std::string mid = "mid";
+
+  MockRtpPacketSink ssrc_sink;
+  AddSinkOnlySsrc(ssrc, &ssrc_sink);
+
+  MockRtpPacketSink mid_sink;
+  AddSinkOnlyMid(mid, &mid_sink);
+
+  InSequence sequence;
+  auto packet_before_mid = CreatePacketWithSsrc(ssrc);
+  EXPECT_CALL(ssrc_sink, OnRtpPacket(SamePacketAs(*packet_before_mid)));
+  EXPECT_TRUE(demuxer_.OnRtpPacket(*packet_before_mid));
+
+  auto packet_with_mid = CreatePacketWithSsrcMid(ssrc, mid);
+  EXPECT_CALL(mid_sink, OnRtpPacket(SamePacketAs(*packet_with_mid)));
+  EXPECT_TRUE(demuxer_.OnRtpPacket(*packet_with_mid));
+
+  auto packet_after_mid = CreatePacketWithSsrc(ssrc);
+  EXPECT_CALL(mid_sink, OnRtpPacket(SamePacketAs(*packet_after_mid)));
+  EXPECT_TRUE(demuxer_.OnRtpPacket(*packet_after_mid));
+}
+
+TEST_F(RtpDemuxerTest, PacketsRoutedToSinkAddedAfterSsrcSinkRemoved) {
+  constexpr uint32_t ssrc = 11;
+
+  MockRtpPacketSink removed_sink;
+  AddSinkOnlySsrc(ssrc, &removed_sink);
+  auto first_packet = CreatePacketWithSsrc(ssrc);
+  EXPECT_CALL(removed_sink, OnRtpPacket(SamePacketAs(*first_packet)));
+  EXPECT_TRUE(demuxer_.OnRtpPacket(*first_packet));
+  ASSERT_TRUE(RemoveSink(&removed_sink));
+
+  auto dropped_packet = CreatePacketWithSsrc(ssrc);
+  EXPECT_FALSE(demuxer_.OnRtpPacket(*dropped_packet));
+
+  MockRtpPacketSink added_sink;
+  AddSinkOnlySsrc(ssrc, &added_sink);
+  auto last_packet = CreatePacketWithSsrc(ssrc);
+  EXPECT_CALL(added_sink, OnRtpPacket(SamePacketAs(*last_packet)));
+  EXPECT_TRUE(demuxer_.OnRtpPacket(*last_packet));
+}
+
 TEST_F(RtpDemuxerTest, RouteByPayloadTypeMultipleMatch) {
   constexpr uint32_t ssrc = 10;
   constexpr uint8_t pt1 = 30;
@@ -14,6 +14,7 @@
 #include <memory>
 
 #include "api/field_trials_view.h"
+#include "api/metronome/metronome.h"
 #include "api/network_state_predictor.h"
 #include "api/rtc_event_log/rtc_event_log.h"
 #include "api/transport/bitrate_settings.h"
@@ -47,6 +48,11 @@ struct RtpTransportConfig {
 
   // The burst interval of the pacer, see TaskQueuePacedSender constructor.
   absl::optional<TimeDelta> pacer_burst_interval;
+
+  // Metronome shared by the calls of a PeerConnectionFactory. The pacer
+  // sends on its ticks if the WebRTC-PacerMetronome field trial is enabled,
+  // see TaskQueuePacedSender constructor.
+  Metronome* metronome = nullptr;
 };
 }  // namespace webrtc
 
@@ -85,7 +85,10 @@ RtpTransportControllerSend::RtpTransportControllerSend(
              *config.trials,
              TimeDelta::Millis(5),
              3,
-             config.pacer_burst_interval),
+             config.pacer_burst_interval,
+             IsEnabled(*config.trials, "WebRTC-PacerMetronome")
+                 ? config.metronome
+                 : nullptr),
       observer_(nullptr),
       controller_factory_override_(config.network_controller_factory),
       controller_factory_fallback_(
@@ -291,6 +291,24 @@ class VideoReceiveStreamInterface : public MediaReceiveStreamInterface {
   // Cause eventual generation of a key frame from the sender.
   virtual void GenerateKeyFrame() = 0;
 
+  // Which frames to decode, e.g. to save decoder CPU when the video is
+  // rendered small or not at all. Frames that are not decoded are dropped
+  // before the frame buffer.
+  enum class DecodeLimit {
+    // Decode all frames.
+    kNone,
+    // Decode only the lowest spatial layer and temporal layer 0, which do not
+    // reference the other layers.
+    kBaseLayer,
+    // Decode only the lowest spatial layer of key frames. Key frames are not
+    // requested for this, so the decoded video may stay frozen.
+    kKeyFramesOnly,
+  };
+  // When the limit is relaxed, a key frame is requested and no frames are
+  // decoded until it arrives, since the next frames may reference frames that
+  // were dropped. Must be called on the packet delivery thread.
+  virtual void SetDecodeLimit(DecodeLimit limit) = 0;
+
   virtual void SetRtcpMode(RtcpMode mode) = 0;
 
   // Sets or clears a flexfec RTP sink. This affects `rtp.packet_sink_` and
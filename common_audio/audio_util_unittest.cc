@@ -190,6 +190,24 @@ TEST(AudioUtilTest, DownmixInterleavedToMono) {
                              deinterleaved);
     const int16_t expected[kNumFrames] = {28000, -11, -30333};
 
+    EXPECT_THAT(deinterleaved, ElementsAreArray(expected));
+  }
+  {
+    // Odd sums round towards zero, as in the generic implementation.
+    const size_t kNumFrames = 480;
+    const int kNumChannels = 2;
+    int16_t interleaved[kNumChannels * kNumFrames];
+    int16_t expected[kNumFrames];
+    for (size_t i = 0; i < kNumFrames; ++i) {
+      interleaved[2 * i] = static_cast<int16_t>(i * 137 - 32768);
+      interleaved[2 * i + 1] = static_cast<int16_t>(32767 - i * 61);
+      expected[i] = (interleaved[2 * i] + interleaved[2 * i + 1]) / 2;
+    }
+    int16_t deinterleaved[kNumFrames];
+
+    DownmixInterleavedToMono(interleaved, kNumFrames, kNumChannels,
+                             deinterleaved);
+
     EXPECT_THAT(deinterleaved, ElementsAreArray(expected));
   }
 }
@@ -126,8 +126,10 @@ void SincResampler::InitializeCPUSpecificFeatures() {
 #if defined(WEBRTC_HAS_NEON)
   convolve_proc_ = Convolve_NEON;
 #elif defined(WEBRTC_ARCH_X86_FAMILY)
-  // Using AVX2 instead of SSE2 when AVX2/FMA3 supported.
-  if (GetCPUInfo(kAVX2) && GetCPUInfo(kFMA3))
+  // Using AVX-512 or AVX2 instead of SSE2 when supported.
+  if (GetCPUInfo(kAVX512) && GetCPUInfo(kFMA3))
+    convolve_proc_ = Convolve_AVX512;
+  else if (GetCPUInfo(kAVX2) && GetCPUInfo(kFMA3))
     convolve_proc_ = Convolve_AVX2;
   else if (GetCPUInfo(kSSE2))
     convolve_proc_ = Convolve_SSE;
@@ -118,6 +118,10 @@ class SincResampler {
                              const float* k1,
                              const float* k2,
                              double kernel_interpolation_factor);
+  static float Convolve_AVX512(const float* input_ptr,
+                               const float* k1,
+                               const float* k2,
+                               double kernel_interpolation_factor);
 #elif defined(WEBRTC_HAS_NEON)
   static float Convolve_NEON(const float* input_ptr,
                              const float* k1,
@@ -0,0 +1,64 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <immintrin.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <xmmintrin.h>
+
+#include "common_audio/resampler/sinc_resampler.h"
+
+namespace webrtc {
+
+float SincResampler::Convolve_AVX512(const float* input_ptr,
+                                     const float* k1,
+                                     const float* k2,
+                                     double kernel_interpolation_factor) {
+  static_assert(kKernelSize % 16 == 0, "");
+  __m512 m_input;
+  __m512 m_sums1 = _mm512_setzero_ps();
+  __m512 m_sums2 = _mm512_setzero_ps();
+
+  // The kernels are only guaranteed to be 32-byte aligned, hence unaligned
+  // loads are used; they are as fast as aligned loads on aligned data.
+  for (size_t i = 0; i < kKernelSize; i += 16) {
+    m_input = _mm512_loadu_ps(input_ptr + i);
+    m_sums1 = _mm512_fmadd_ps(m_input, _mm512_loadu_ps(k1 + i), m_sums1);
+    m_sums2 = _mm512_fmadd_ps(m_input, _mm512_loadu_ps(k2 + i), m_sums2);
+  }
+
+  // Linearly interpolate the two "convolutions".
+  __m256 m256_sums1 = _mm256_add_ps(_mm512_castps512_ps256(m_sums1),
+                                    _mm256_castpd_ps(_mm512_extractf64x4_pd(
+                                        _mm512_castps_pd(m_sums1), 1)));
+  __m256 m256_sums2 = _mm256_add_ps(_mm512_castps512_ps256(m_sums2),
+                                    _mm256_castpd_ps(_mm512_extractf64x4_pd(
+                                        _mm512_castps_pd(m_sums2), 1)));
+  __m128 m128_sums1 = _mm_add_ps(_mm256_extractf128_ps(m256_sums1, 0),
+                                 _mm256_extractf128_ps(m256_sums1, 1));
+  __m128 m128_sums2 = _mm_add_ps(_mm256_extractf128_ps(m256_sums2, 0),
+                                 _mm256_extractf128_ps(m256_sums2, 1));
+  m128_sums1 = _mm_mul_ps(
+      m128_sums1,
+      _mm_set_ps1(static_cast<float>(1.0 - kernel_interpolation_factor)));
+  m128_sums2 = _mm_mul_ps(
+      m128_sums2, _mm_set_ps1(static_cast<float>(kernel_interpolation_factor)));
+  m128_sums1 = _mm_add_ps(m128_sums1, m128_sums2);
+
+  // Sum components together.
+  float result;
+  m128_sums2 = _mm_add_ps(_mm_movehl_ps(m128_sums1, m128_sums1), m128_sums1);
+  _mm_store_ss(&result, _mm_add_ss(m128_sums2,
+                                   _mm_shuffle_ps(m128_sums2, m128_sums2, 1)));
+
+  return result;
+}
+
+}  // namespace webrtc
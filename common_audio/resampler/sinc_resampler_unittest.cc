@@ -21,6 +21,7 @@
 #include <algorithm>
 #include <memory>
 #include <tuple>
+#include <vector>
 
 #include "common_audio/resampler/sinusoidal_linear_chirp_source.h"
 #include "rtc_base/system/arch.h"
@@ -152,6 +153,33 @@ TEST(SincResamplerTest, Convolve) {
       resampler.kernel_storage_.get() + 1, resampler.kernel_storage_.get(),
       resampler.kernel_storage_.get(), kKernelInterpolationFactor);
   EXPECT_NEAR(result2, result, kEpsilon);
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  // Test the variants that are not selected on this CPU.
+  using ConvolveProc = float (*)(const float*, const float*, const float*,
+                                 double);
+  std::vector<ConvolveProc> convolve_procs = {SincResampler::Convolve_SSE};
+  if (GetCPUInfo(kAVX2) && GetCPUInfo(kFMA3)) {
+    convolve_procs.push_back(SincResampler::Convolve_AVX2);
+  }
+  if (GetCPUInfo(kAVX512) && GetCPUInfo(kFMA3)) {
+    convolve_procs.push_back(SincResampler::Convolve_AVX512);
+  }
+  for (ConvolveProc convolve_proc : convolve_procs) {
+    for (int offset : {0, 1}) {
+      SCOPED_TRACE(offset);
+      result = resampler.Convolve_C(resampler.kernel_storage_.get() + offset,
+                                    resampler.kernel_storage_.get(),
+                                    resampler.kernel_storage_.get(),
+                                    kKernelInterpolationFactor);
+      result2 = convolve_proc(resampler.kernel_storage_.get() + offset,
+                              resampler.kernel_storage_.get(),
+                              resampler.kernel_storage_.get(),
+                              kKernelInterpolationFactor);
+      EXPECT_NEAR(result2, result, kEpsilon);
+    }
+  }
+#endif
 }
 
 // Benchmark for the various Convolve() methods.  Make sure to build with
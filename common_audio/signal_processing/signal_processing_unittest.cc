@@ -539,10 +539,10 @@ TEST(SplTest, CrossCorrelationTest) {
   const int32_t kExpected[kCrossCorrelationDimension] = {-266947903, -15579555,
                                                          -171282001};
   const int32_t* expected = kExpected;
-#if !defined(MIPS32_LE)
+#if defined(WEBRTC_HAS_NEON)
   const int32_t kExpectedNeon[kCrossCorrelationDimension] = {
       -266947901, -15579553, -171281999};
-  if (WebRtcSpl_CrossCorrelation != WebRtcSpl_CrossCorrelationC) {
+  if (WebRtcSpl_CrossCorrelation == WebRtcSpl_CrossCorrelationNeon) {
     expected = kExpectedNeon;
   }
 #endif
@@ -551,6 +551,45 @@ TEST(SplTest, CrossCorrelationTest) {
   }
 }
 
+#if defined(WEBRTC_ARCH_X86_64)
+TEST(SplTest, CrossCorrelationSse2IsBitExact) {
+  constexpr size_t kSeqDimension = 37;
+  constexpr size_t kCrossCorrelationDimension = 9;
+  int16_t seq1[kSeqDimension];
+  int16_t seq2[kSeqDimension + 2 * kCrossCorrelationDimension];
+  uint32_t state = 17;
+  for (int16_t& x : seq1) {
+    state = state * 1664525 + 1013904223;
+    x = static_cast<int16_t>(state >> 16);
+  }
+  for (int16_t& x : seq2) {
+    state = state * 1664525 + 1013904223;
+    x = static_cast<int16_t>(state >> 16);
+  }
+  seq1[0] = seq2[0] = WEBRTC_SPL_WORD16_MIN;
+
+  for (int right_shifts : {0, 1, 6}) {
+    for (int step_seq2 : {-1, 1, 2}) {
+      SCOPED_TRACE(right_shifts);
+      SCOPED_TRACE(step_seq2);
+      const int16_t* seq2_start =
+          step_seq2 < 0 ? &seq2[kCrossCorrelationDimension] : seq2;
+      int32_t expected[kCrossCorrelationDimension];
+      int32_t actual[kCrossCorrelationDimension];
+      WebRtcSpl_CrossCorrelationC(expected, seq1, seq2_start, kSeqDimension,
+                                  kCrossCorrelationDimension, right_shifts,
+                                  step_seq2);
+      WebRtcSpl_CrossCorrelationSSE2(actual, seq1, seq2_start, kSeqDimension,
+                                     kCrossCorrelationDimension, right_shifts,
+                                     step_seq2);
+      for (size_t i = 0; i < kCrossCorrelationDimension; ++i) {
+        EXPECT_EQ(expected[i], actual[i]);
+      }
+    }
+  }
+}
+#endif
+
 TEST(SplTest, AutoCorrelationTest) {
   int scale = 0;
   int32_t vector32[kVector16Size];
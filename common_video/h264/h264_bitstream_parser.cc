@@ -11,6 +11,7 @@
 
 #include <stdlib.h>
 
+#include <array>
 #include <cstdint>
 #include <vector>
 
@@ -24,6 +25,8 @@ namespace {
 constexpr int kMaxAbsQpDeltaValue = 51;
 constexpr int kMinQpValue = 0;
 constexpr int kMaxQpValue = 51;
+// Number of unescaped bytes enough for most slice headers, up to the QP delta.
+constexpr size_t kSliceHeaderRbspSize = 64;
 
 }  // namespace
 
@@ -38,8 +41,39 @@ H264BitstreamParser::Result H264BitstreamParser::ParseNonParameterSetNalu(
     return kInvalidStream;
 
   last_slice_qp_delta_ = absl::nullopt;
-  const std::vector<uint8_t> slice_rbsp =
-      H264::ParseRbsp(source, source_length);
+  // The slice header is usually much shorter than the slice, so only its
+  // beginning is unescaped unless the header turns out to be longer.
+  std::array<uint8_t, kSliceHeaderRbspSize> slice_header_rbsp;
+  const size_t slice_header_rbsp_size =
+      H264::ParseRbsp(rtc::MakeArrayView(source, source_length),
+                      slice_header_rbsp);
+  int last_slice_qp_delta;
+  Result result = ParseSliceHeader(
+      rtc::MakeArrayView(slice_header_rbsp.data(), slice_header_rbsp_size),
+      nalu_type, &last_slice_qp_delta);
+  if (result == kInvalidStream &&
+      slice_header_rbsp_size == slice_header_rbsp.size()) {
+    const std::vector<uint8_t> slice_rbsp =
+        H264::ParseRbsp(source, source_length);
+    result = ParseSliceHeader(slice_rbsp, nalu_type, &last_slice_qp_delta);
+  }
+  if (result != kOk) {
+    return result;
+  }
+  if (abs(last_slice_qp_delta) > kMaxAbsQpDeltaValue) {
+    // Something has gone wrong, and the parsed value is invalid.
+    RTC_LOG(LS_WARNING) << "Parsed QP value out of range.";
+    return kInvalidStream;
+  }
+
+  last_slice_qp_delta_ = last_slice_qp_delta;
+  return kOk;
+}
+
+H264BitstreamParser::Result H264BitstreamParser::ParseSliceHeader(
+    rtc::ArrayView<const uint8_t> slice_rbsp,
+    uint8_t nalu_type,
+    int* slice_qp_delta) const {
   if (slice_rbsp.size() < H264::kNaluTypeSize)
     return kInvalidStream;
 
@@ -48,8 +82,8 @@ H264BitstreamParser::Result H264BitstreamParser::ParseNonParameterSetNalu(
 
   // Check to see if this is an IDR slice, which has an extra field to parse
   // out.
-  bool is_idr = (source[0] & 0x0F) == H264::NaluType::kIdr;
-  uint8_t nal_ref_idc = (source[0] & 0x60) >> 5;
+  bool is_idr = (slice_rbsp[0] & 0x0F) == H264::NaluType::kIdr;
+  uint8_t nal_ref_idc = (slice_rbsp[0] & 0x60) >> 5;
 
   // first_mb_in_slice: ue(v)
   slice_reader.ReadExponentialGolomb();
@@ -233,17 +267,10 @@ H264BitstreamParser::Result H264BitstreamParser::ParseNonParameterSetNalu(
     slice_reader.ReadExponentialGolomb();
   }
 
-  int last_slice_qp_delta = slice_reader.ReadSignedExponentialGolomb();
+  *slice_qp_delta = slice_reader.ReadSignedExponentialGolomb();
   if (!slice_reader.Ok()) {
     return kInvalidStream;
   }
-  if (abs(last_slice_qp_delta) > kMaxAbsQpDeltaValue) {
-    // Something has gone wrong, and the parsed value is invalid.
-    RTC_LOG(LS_WARNING) << "Parsed QP value out of range.";
-    return kInvalidStream;
-  }
-
-  last_slice_qp_delta_ = last_slice_qp_delta;
   return kOk;
 }
 
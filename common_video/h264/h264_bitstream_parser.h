@@ -14,6 +14,7 @@
 #include <stdint.h>
 
 #include "absl/types/optional.h"
+#include "api/array_view.h"
 #include "api/video_codecs/bitstream_parser.h"
 #include "common_video/h264/pps_parser.h"
 #include "common_video/h264/sps_parser.h"
@@ -44,6 +45,11 @@ class H264BitstreamParser : public BitstreamParser {
   Result ParseNonParameterSetNalu(const uint8_t* source,
                                   size_t source_length,
                                   uint8_t nalu_type);
+  // Parses the header of the slice in `slice_rbsp`, which may be truncated,
+  // through the QP delta.
+  Result ParseSliceHeader(rtc::ArrayView<const uint8_t> slice_rbsp,
+                          uint8_t nalu_type,
+                          int* slice_qp_delta) const;
 
   // SPS/PPS state, updated when parsing new SPS/PPS, used to parse slices.
   absl::optional<SpsParser::SpsState> sps_;
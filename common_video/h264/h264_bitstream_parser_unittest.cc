@@ -10,6 +10,9 @@
 
 #include "common_video/h264/h264_bitstream_parser.h"
 
+#include <iterator>
+#include <vector>
+
 #include "test/gtest.h"
 
 namespace webrtc {
@@ -69,6 +72,21 @@ TEST(H264BitstreamParserTest, ReportsLastSliceQpForImageSlices) {
   EXPECT_EQ(37, *qp);
 }
 
+TEST(H264BitstreamParserTest, ReportsLastSliceQpForLongImageSlices) {
+  // Extend the image slice with escaped data, the slice header being parsed
+  // from its unescaped beginning only.
+  std::vector<uint8_t> bitstream(std::begin(kH264BitstreamChunk),
+                                 std::end(kH264BitstreamChunk));
+  for (int i = 0; i < 1000; ++i) {
+    bitstream.insert(bitstream.end(), {0x00, 0x00, 0x03, 0x01, 0xa5});
+  }
+  H264BitstreamParser h264_parser;
+  h264_parser.ParseBitstream(bitstream);
+  absl::optional<int> qp = h264_parser.GetLastSliceQp();
+  ASSERT_TRUE(qp.has_value());
+  EXPECT_EQ(35, *qp);
+}
+
 TEST(H264BitstreamParserTest, ReportsLastSliceQpForCABACImageSlices) {
   H264BitstreamParser h264_parser;
   h264_parser.ParseBitstream(kH264BitstreamChunkCabac);
@@ -89,6 +89,28 @@ std::vector<uint8_t> ParseRbsp(const uint8_t* data, size_t length) {
   return out;
 }
 
+size_t ParseRbsp(rtc::ArrayView<const uint8_t> data,
+                 rtc::ArrayView<uint8_t> destination) {
+  const size_t length = data.size();
+  size_t written = 0;
+  for (size_t i = 0; i < length && written < destination.size();) {
+    if (length - i >= 3 && !data[i] && !data[i + 1] && data[i + 2] == 3) {
+      // Two rbsp bytes, as far as they fit.
+      destination[written++] = data[i++];
+      if (written == destination.size()) {
+        break;
+      }
+      destination[written++] = data[i++];
+      // Skip the emulation byte.
+      i++;
+    } else {
+      // Single rbsp byte.
+      destination[written++] = data[i++];
+    }
+  }
+  return written;
+}
+
 void WriteRbsp(const uint8_t* bytes, size_t length, rtc::Buffer* destination) {
   static const uint8_t kZerosInStartSequence = 2;
   static const uint8_t kEmulationByte = 0x03u;
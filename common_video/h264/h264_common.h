@@ -16,6 +16,7 @@
 
 #include <vector>
 
+#include "api/array_view.h"
 #include "rtc_base/buffer.h"
 
 namespace webrtc {
@@ -81,6 +82,12 @@ NaluType ParseNaluType(uint8_t data);
 // Parse the given data and remove any emulation byte escaping.
 std::vector<uint8_t> ParseRbsp(const uint8_t* data, size_t length);
 
+// Like above, but writes at most `destination.size()` unescaped bytes from the
+// beginning of `data` to `destination` without allocating. Returns the number
+// of bytes written.
+size_t ParseRbsp(rtc::ArrayView<const uint8_t> data,
+                 rtc::ArrayView<uint8_t> destination);
+
 // Write the given data to the destination buffer, inserting and emulation
 // bytes in order to escape any data the could be interpreted as a start
 // sequence.
@@ -32,12 +32,29 @@ namespace webrtc {
 // Create(I420|NV12)Buffer. When the buffer is destructed, the memory is
 // returned to the pool for use by subsequent calls to Create(I420|NV12)Buffer.
 // If the resolution passed to Create(I420|NV12)Buffer changes or requested
-// pixel format changes, old buffers will be purged from the pool.
+// pixel format changes, old buffers will be purged from the pool. Purged
+// buffers that are free are kept aside, up to kMaxRetainedBytes, and reused
+// if the resolution and pixel format switch back, which is common for
+// decoders that follow the sender's resolution adaptation.
 // Note that Create(I420|NV12)Buffer will crash if more than
 // kMaxNumberOfFramesBeforeCrash are created. This is to prevent memory leaks
 // where frames are not returned.
 class VideoFrameBufferPool {
  public:
+  // Free buffers of other resolutions or pixel formats than the latest
+  // requested one are kept up to this amount of memory.
+  static constexpr size_t kMaxRetainedBytes = 8 * 1024 * 1024;
+
+  struct Stats {
+    // Number of buffers allocated by the pool.
+    size_t num_allocated_buffers = 0;
+    // Number of buffers returned by the pool that were reused.
+    size_t num_reused_buffers = 0;
+    // Free buffers kept for other resolutions or pixel formats.
+    size_t num_retained_buffers = 0;
+    size_t retained_bytes = 0;
+  };
+
   VideoFrameBufferPool();
   explicit VideoFrameBufferPool(bool zero_initialize);
   VideoFrameBufferPool(bool zero_initialize, size_t max_number_of_buffers);
@@ -63,12 +80,23 @@ class VideoFrameBufferPool {
   // later from another thread.
   void Release();
 
+  Stats GetStats() const;
+
  private:
   rtc::scoped_refptr<VideoFrameBuffer>
   GetExistingBuffer(int width, int height, VideoFrameBuffer::Type type);
+  // Keeps a free `buffer` in `retained_buffers_`, evicting the least recently
+  // retained buffers beyond kMaxRetainedBytes.
+  void RetainBuffer(rtc::scoped_refptr<VideoFrameBuffer> buffer);
 
   rtc::RaceChecker race_checker_;
   std::list<rtc::scoped_refptr<VideoFrameBuffer>> buffers_;
+  // Free buffers with another resolution or type than `buffers_`, most
+  // recently retained first. Only the pool references them.
+  std::list<rtc::scoped_refptr<VideoFrameBuffer>> retained_buffers_;
+  size_t retained_bytes_ = 0;
+  size_t num_allocated_buffers_ = 0;
+  size_t num_reused_buffers_ = 0;
   // If true, newly allocated buffers are zero-initialized. Note that recycled
   // buffers are not zero'd before reuse. This is required of buffers used by
   // FFmpeg according to http://crbug.com/390941, which only requires it for the
@@ -11,6 +11,7 @@
 #include "common_video/include/video_frame_buffer_pool.h"
 
 #include <limits>
+#include <utility>
 
 #include "api/make_ref_counted.h"
 #include "rtc_base/checks.h"
@@ -58,6 +59,30 @@ bool HasOneRef(const rtc::scoped_refptr<VideoFrameBuffer>& buffer) {
   return false;
 }
 
+// Returns the approximate amount of memory used by the pixel data of
+// `buffer`, which is one of the types created by the pool.
+size_t BufferSizeInBytes(const VideoFrameBuffer& buffer) {
+  const size_t num_pixels = static_cast<size_t>(buffer.width()) *
+                            static_cast<size_t>(buffer.height());
+  switch (buffer.type()) {
+    case VideoFrameBuffer::Type::kI420:
+    case VideoFrameBuffer::Type::kNV12:
+      return num_pixels * 3 / 2;
+    case VideoFrameBuffer::Type::kI422:
+      return num_pixels * 2;
+    case VideoFrameBuffer::Type::kI444:
+    case VideoFrameBuffer::Type::kI010:
+      return num_pixels * 3;
+    case VideoFrameBuffer::Type::kI210:
+      return num_pixels * 4;
+    case VideoFrameBuffer::Type::kI410:
+      return num_pixels * 6;
+    default:
+      RTC_DCHECK_NOTREACHED();
+  }
+  return 0;
+}
+
 }  // namespace
 
 VideoFrameBufferPool::VideoFrameBufferPool() : VideoFrameBufferPool(false) {}
@@ -75,6 +100,17 @@ VideoFrameBufferPool::~VideoFrameBufferPool() = default;
 
 void VideoFrameBufferPool::Release() {
   buffers_.clear();
+  retained_buffers_.clear();
+  retained_bytes_ = 0;
+}
+
+VideoFrameBufferPool::Stats VideoFrameBufferPool::GetStats() const {
+  Stats stats;
+  stats.num_allocated_buffers = num_allocated_buffers_;
+  stats.num_reused_buffers = num_reused_buffers_;
+  stats.num_retained_buffers = retained_buffers_.size();
+  stats.retained_bytes = retained_bytes_;
+  return stats;
 }
 
 bool VideoFrameBufferPool::Resize(size_t max_number_of_buffers) {
@@ -135,6 +171,7 @@ rtc::scoped_refptr<I420Buffer> VideoFrameBufferPool::CreateI420Buffer(
     buffer->InitializeData();
 
   buffers_.push_back(buffer);
+  ++num_allocated_buffers_;
   return buffer;
 }
 
@@ -166,6 +203,7 @@ rtc::scoped_refptr<I444Buffer> VideoFrameBufferPool::CreateI444Buffer(
     buffer->InitializeData();
 
   buffers_.push_back(buffer);
+  ++num_allocated_buffers_;
   return buffer;
 }
 
@@ -197,6 +235,7 @@ rtc::scoped_refptr<I422Buffer> VideoFrameBufferPool::CreateI422Buffer(
     buffer->InitializeData();
 
   buffers_.push_back(buffer);
+  ++num_allocated_buffers_;
   return buffer;
 }
 
@@ -228,6 +267,7 @@ rtc::scoped_refptr<NV12Buffer> VideoFrameBufferPool::CreateNV12Buffer(
     buffer->InitializeData();
 
   buffers_.push_back(buffer);
+  ++num_allocated_buffers_;
   return buffer;
 }
 
@@ -255,6 +295,7 @@ rtc::scoped_refptr<I010Buffer> VideoFrameBufferPool::CreateI010Buffer(
   rtc::scoped_refptr<I010Buffer> buffer = I010Buffer::Create(width, height);
 
   buffers_.push_back(buffer);
+  ++num_allocated_buffers_;
   return buffer;
 }
 
@@ -282,6 +323,7 @@ rtc::scoped_refptr<I210Buffer> VideoFrameBufferPool::CreateI210Buffer(
   rtc::scoped_refptr<I210Buffer> buffer = I210Buffer::Create(width, height);
 
   buffers_.push_back(buffer);
+  ++num_allocated_buffers_;
   return buffer;
 }
 
@@ -309,6 +351,7 @@ rtc::scoped_refptr<I410Buffer> VideoFrameBufferPool::CreateI410Buffer(
   rtc::scoped_refptr<I410Buffer> buffer = I410Buffer::Create(width, height);
 
   buffers_.push_back(buffer);
+  ++num_allocated_buffers_;
   return buffer;
 }
 
@@ -316,11 +359,15 @@ rtc::scoped_refptr<VideoFrameBuffer> VideoFrameBufferPool::GetExistingBuffer(
     int width,
     int height,
     VideoFrameBuffer::Type type) {
-  // Release buffers with wrong resolution or different type.
+  // Release buffers with wrong resolution or different type. Free ones are
+  // retained in case the resolution or type switches back.
   for (auto it = buffers_.begin(); it != buffers_.end();) {
     const auto& buffer = *it;
     if (buffer->width() != width || buffer->height() != height ||
         buffer->type() != type) {
+      if (HasOneRef(buffer)) {
+        RetainBuffer(buffer);
+      }
       it = buffers_.erase(it);
     } else {
       ++it;
@@ -334,10 +381,41 @@ rtc::scoped_refptr<VideoFrameBuffer> VideoFrameBufferPool::GetExistingBuffer(
     // to reuse.
     if (HasOneRef(buffer)) {
       RTC_CHECK(buffer->type() == type);
+      ++num_reused_buffers_;
       return buffer;
     }
   }
+  // Look for a retained buffer.
+  if (buffers_.size() >= max_number_of_buffers_) {
+    return nullptr;
+  }
+  for (auto it = retained_buffers_.begin(); it != retained_buffers_.end();
+       ++it) {
+    const auto& buffer = *it;
+    if (buffer->width() == width && buffer->height() == height &&
+        buffer->type() == type) {
+      buffers_.push_back(buffer);
+      retained_bytes_ -= BufferSizeInBytes(*buffer);
+      retained_buffers_.erase(it);
+      ++num_reused_buffers_;
+      return buffers_.back();
+    }
+  }
   return nullptr;
 }
 
+void VideoFrameBufferPool::RetainBuffer(
+    rtc::scoped_refptr<VideoFrameBuffer> buffer) {
+  const size_t size = BufferSizeInBytes(*buffer);
+  if (size > kMaxRetainedBytes) {
+    return;
+  }
+  retained_bytes_ += size;
+  retained_buffers_.push_front(std::move(buffer));
+  while (retained_bytes_ > kMaxRetainedBytes) {
+    retained_bytes_ -= BufferSizeInBytes(*retained_buffers_.back());
+    retained_buffers_.pop_back();
+  }
+}
+
 }  // namespace webrtc
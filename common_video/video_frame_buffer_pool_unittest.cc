@@ -129,4 +129,58 @@ TEST(TestVideoFrameBufferPool, SwitchingPixelFormat) {
   EXPECT_EQ(nullptr, pool.CreateI210Buffer(16, 16).get());
 }
 
+TEST(TestVideoFrameBufferPool, ReusesBufferAfterSwitchingBackResolution) {
+  VideoFrameBufferPool pool(/*zero_initialize=*/false, 1);
+  auto buffer = pool.CreateI420Buffer(16, 16);
+  const uint8_t* y_ptr = buffer->DataY();
+  buffer = nullptr;
+
+  buffer = pool.CreateI420Buffer(32, 16);
+  ASSERT_TRUE(buffer);
+  EXPECT_NE(y_ptr, buffer->DataY());
+  EXPECT_EQ(pool.GetStats().num_retained_buffers, 1u);
+  EXPECT_EQ(pool.GetStats().retained_bytes, 16u * 16u * 3 / 2);
+  buffer = nullptr;
+
+  buffer = pool.CreateI420Buffer(16, 16);
+  ASSERT_TRUE(buffer);
+  EXPECT_EQ(y_ptr, buffer->DataY());
+
+  VideoFrameBufferPool::Stats stats = pool.GetStats();
+  EXPECT_EQ(stats.num_allocated_buffers, 2u);
+  EXPECT_EQ(stats.num_reused_buffers, 1u);
+  // The 32x16 buffer is retained in turn.
+  EXPECT_EQ(stats.num_retained_buffers, 1u);
+  EXPECT_EQ(stats.retained_bytes, 32u * 16u * 3 / 2);
+}
+
+TEST(TestVideoFrameBufferPool, DoesNotRetainBuffersInUse) {
+  VideoFrameBufferPool pool(/*zero_initialize=*/false, 1);
+  auto nv12_buffer = pool.CreateNV12Buffer(16, 16);
+  auto i420_buffer = pool.CreateI420Buffer(16, 16);
+  ASSERT_TRUE(i420_buffer);
+  EXPECT_EQ(pool.GetStats().num_retained_buffers, 0u);
+}
+
+TEST(TestVideoFrameBufferPool, LimitsRetainedMemory) {
+  VideoFrameBufferPool pool;
+  constexpr int kWidth = 1280;
+  constexpr int kHeight = 720;
+  constexpr size_t kBufferSize = kWidth * kHeight * 3 / 2;
+  constexpr size_t kMaxRetainedBuffers =
+      VideoFrameBufferPool::kMaxRetainedBytes / kBufferSize;
+  for (size_t i = 0; i <= kMaxRetainedBuffers; ++i) {
+    // Each height change retains the previous buffer.
+    EXPECT_TRUE(pool.CreateI420Buffer(kWidth, kHeight - 2 * i));
+  }
+  EXPECT_TRUE(pool.CreateI420Buffer(kWidth, kHeight / 2));
+  VideoFrameBufferPool::Stats stats = pool.GetStats();
+  EXPECT_EQ(stats.num_retained_buffers, kMaxRetainedBuffers);
+  EXPECT_LE(stats.retained_bytes, VideoFrameBufferPool::kMaxRetainedBytes);
+
+  pool.Release();
+  EXPECT_EQ(pool.GetStats().num_retained_buffers, 0u);
+  EXPECT_EQ(pool.GetStats().retained_bytes, 0u);
+}
+
 }  // namespace webrtc
@@ -99,6 +99,8 @@ bool RtcEventLogImpl::StartLogging(std::unique_ptr<RtcEventLogOutput> output,
   logging_state_started_ = true;
   immediately_output_mode_ = (output_period_ms == kImmediateOutput);
   need_schedule_output_ = (output_period_ms != kImmediateOutput);
+  immediate_output_pending_ = false;
+  ++logging_session_;
 
   // Binding to `this` is safe because `this` outlives the `task_queue_`.
   task_queue_->PostTask([this, output_period_ms, timestamp_us, utc_time_us,
@@ -149,6 +151,7 @@ void RtcEventLogImpl::StopLogging(std::function<void()> callback) {
   RTC_DCHECK_RUN_ON(&logging_state_checker_);
   MutexLock lock(&mutex_);
   logging_state_started_ = false;
+  immediate_output_pending_ = false;
   task_queue_->PostTask(
       [this, callback, histories = ExtractRecentHistories()]() mutable {
         RTC_DCHECK_RUN_ON(task_queue_.get());
@@ -173,7 +176,16 @@ void RtcEventLogImpl::Log(std::unique_ptr<RtcEvent> event) {
 
   LogToMemory(std::move(event));
   if (logging_state_started_) {
-    if (ShouldOutputImmediately()) {
+    if (immediately_output_mode_) {
+      if (!immediate_output_pending_) {
+        immediate_output_pending_ = true;
+        // Binding to `this` is safe because `this` outlives the `task_queue_`.
+        task_queue_->PostTask([this, session = logging_session_] {
+          RTC_DCHECK_RUN_ON(task_queue_.get());
+          OutputPendingEvents(session);
+        });
+      }
+    } else if (ShouldOutputImmediately()) {
       // Binding to `this` is safe because `this` outlives the `task_queue_`.
       task_queue_->PostTask(
           [this, histories = ExtractRecentHistories()]() mutable {
@@ -207,6 +219,24 @@ bool RtcEventLogImpl::ShouldOutputImmediately() {
   return immediately_output_mode_;
 }
 
+void RtcEventLogImpl::OutputPendingEvents(uint64_t logging_session) {
+  EventHistories histories;
+  {
+    MutexLock lock(&mutex_);
+    // StopLogging() and StartLogging() output the events logged before them,
+    // so only the session that posted the task still has events to output.
+    if (!logging_state_started_ || logging_session != logging_session_) {
+      return;
+    }
+    immediate_output_pending_ = false;
+    histories = ExtractRecentHistories();
+  }
+  if (event_output_) {
+    RTC_DCHECK(event_output_->IsActive());
+    LogEventsToOutput(std::move(histories));
+  }
+}
+
 void RtcEventLogImpl::ScheduleOutput() {
   RTC_DCHECK(output_period_ms_ != kImmediateOutput);
   // Binding to `this` is safe because `this` outlives the `task_queue_`.
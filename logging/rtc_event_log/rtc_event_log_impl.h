@@ -87,6 +87,7 @@ class RtcEventLogImpl final : public RtcEventLog {
   void StopLoggingInternal() RTC_RUN_ON(task_queue_);
 
   bool ShouldOutputImmediately() RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+  void OutputPendingEvents(uint64_t logging_session) RTC_RUN_ON(task_queue_);
   void ScheduleOutput() RTC_RUN_ON(task_queue_);
 
   // Max size of event history.
@@ -113,6 +114,13 @@ class RtcEventLogImpl final : public RtcEventLog {
   bool logging_state_started_ RTC_GUARDED_BY(mutex_) = false;
   bool immediately_output_mode_ RTC_GUARDED_BY(mutex_) = false;
   bool need_schedule_output_ RTC_GUARDED_BY(mutex_) = false;
+  // In immediate output mode, set while an output task is posted and has not
+  // yet extracted the recent events, so that events logged meanwhile are
+  // output in the same batch.
+  bool immediate_output_pending_ RTC_GUARDED_BY(mutex_) = false;
+  // Incremented on every StartLogging(), to tell apart the output tasks of
+  // different logging sessions.
+  uint64_t logging_session_ RTC_GUARDED_BY(mutex_) = 0;
 
   // Since we are posting tasks bound to `this`,  it is critical that the event
   // log and its members outlive `task_queue_`. Keep the `task_queue_`
@@ -43,6 +43,7 @@ class MockEventEncoder : public RtcEventLogEncoder {
   std::string EncodeBatch(
       std::deque<std::unique_ptr<RtcEvent>>::const_iterator a,
       std::deque<std::unique_ptr<RtcEvent>>::const_iterator b) override {
+    ++num_encoded_batches_;
     std::string result;
     while (a != b) {
       result += OnEncode(**a);
@@ -50,6 +51,11 @@ class MockEventEncoder : public RtcEventLogEncoder {
     }
     return result;
   }
+
+  size_t num_encoded_batches() const { return num_encoded_batches_; }
+
+ private:
+  size_t num_encoded_batches_ = 0;
 };
 
 class FakeOutput : public RtcEventLogOutput {
@@ -260,6 +266,23 @@ TEST_F(RtcEventLogImplTest, DoNotDropEventsIfHistoryFullAfterStarted) {
   Mock::VerifyAndClearExpectations(encoder_ptr_);
 }
 
+TEST_F(RtcEventLogImplTest, BatchesEventsLoggedBeforeImmediateOutput) {
+  event_log_.StartLogging(std::move(output_), RtcEventLog::kImmediateOutput);
+  time_controller_.AdvanceTime(TimeDelta::Zero());
+  const size_t num_batches_on_start = encoder_ptr_->num_encoded_batches();
+
+  for (int i = 0; i < 3; ++i) {
+    event_log_.Log(std::make_unique<FakeEvent>());
+  }
+  EXPECT_CALL(*encoder_ptr_,
+              OnEncode(Property(&RtcEvent::IsConfigEvent, false)))
+      .Times(3);
+  time_controller_.AdvanceTime(TimeDelta::Zero());
+  // The config events and the other events are encoded in one batch each.
+  EXPECT_EQ(encoder_ptr_->num_encoded_batches() - num_batches_on_start, 2u);
+  Mock::VerifyAndClearExpectations(encoder_ptr_);
+}
+
 TEST_F(RtcEventLogImplTest, StopOutputOnWriteFailure) {
   constexpr size_t kNumberOfEvents = 10;
   constexpr size_t kFailsWriteOnEventsCount = 5;
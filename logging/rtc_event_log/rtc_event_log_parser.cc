@@ -14,6 +14,7 @@
 #include <string.h>
 
 #include <algorithm>
+#include <atomic>
 #include <limits>
 #include <map>
 #include <utility>
@@ -44,8 +45,10 @@
 #include "rtc_base/logging.h"
 #include "rtc_base/numerics/safe_conversions.h"
 #include "rtc_base/numerics/sequence_number_unwrapper.h"
+#include "rtc_base/platform_thread.h"
 #include "rtc_base/protobuf_utils.h"
 #include "rtc_base/system/file_wrapper.h"
+#include "system_wrappers/include/cpu_info.h"
 
 using webrtc_event_logging::ToSigned;
 using webrtc_event_logging::ToUnsigned;
@@ -54,6 +57,9 @@ namespace webrtc {
 
 namespace {
 constexpr int64_t kMaxLogSize = 250000000;
+constexpr size_t kReadChunkSize = 1 << 20;
+// Smaller v3 logs, or chunks of them, are decoded on the calling thread.
+constexpr size_t kMinParallelDecodeSize = 1 << 16;
 
 constexpr size_t kIpv4Overhead = 20;
 constexpr size_t kIpv6Overhead = 40;
@@ -66,6 +72,28 @@ constexpr uint16_t kDefaultOverhead =
 constexpr char kIncompleteLogError[] =
     "Could not parse the entire log. Only the beginning will be used.";
 
+// Returns the size of the longest prefix of `s` that consists of whole events.
+// All log formats frame an event as a varint tag, followed by a varint length
+// and that many bytes.
+size_t CompleteEventsSize(absl::string_view s) {
+  size_t size = 0;
+  while (true) {
+    absl::string_view event = s.substr(size);
+    uint64_t tag = 0;
+    uint64_t length = 0;
+    bool success = false;
+    std::tie(success, event) = DecodeVarInt(event, &tag);
+    if (!success) {
+      return size;
+    }
+    std::tie(success, event) = DecodeVarInt(event, &length);
+    if (!success || length > event.size()) {
+      return size;
+    }
+    size = s.size() - event.size() + length;
+  }
+}
+
 struct MediaStreamInfo {
   MediaStreamInfo() = default;
   MediaStreamInfo(LoggedMediaType media_type, bool rtx)
@@ -1085,6 +1113,10 @@ void ParsedRtcEventLog::Clear() {
 
   last_incoming_rtcp_packet_.clear();
 
+  v3_log_ = false;
+  expect_v3_begin_log_event_ = true;
+  incomplete_log_ = false;
+
   first_timestamp_ = Timestamp::PlusInfinity();
   last_timestamp_ = Timestamp::MinusInfinity();
   first_log_segment_ = LogSegment(0, std::numeric_limits<int64_t>::max());
@@ -1106,17 +1138,40 @@ ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseFile(
   long signed_filesize = file.FileSize();  // NOLINT(runtime/int)
   RTC_PARSE_CHECK_OR_RETURN_GE(signed_filesize, 0);
   RTC_PARSE_CHECK_OR_RETURN_LE(signed_filesize, kMaxLogSize);
-  size_t filesize = rtc::checked_cast<size_t>(signed_filesize);
-
-  // Read file into memory.
-  std::string buffer(filesize, '\0');
-  size_t bytes_read = file.Read(&buffer[0], buffer.size());
-  if (bytes_read != filesize) {
-    RTC_LOG(LS_WARNING) << "Failed to read file " << filename;
-    RTC_PARSE_CHECK_OR_RETURN_EQ(bytes_read, filesize);
+  if (signed_filesize == 0) {
+    return ParseStream(absl::string_view());
   }
 
-  return ParseStream(buffer);
+  // Parse the events that have been read completely after reading each chunk,
+  // and keep only the partially read event at the end in the buffer.
+  Clear();
+  std::string buffer;
+  ParseStatus status = ParseStatus::Success();
+  bool end_of_file = false;
+  while (status.ok() && !incomplete_log_ && !end_of_file) {
+    size_t buffered = buffer.size();
+    buffer.resize(buffered + kReadChunkSize);
+    size_t bytes_read = file.Read(&buffer[buffered], kReadChunkSize);
+    buffer.resize(buffered + bytes_read);
+    if (bytes_read < kReadChunkSize) {
+      if (!file.ReadEof()) {
+        RTC_LOG(LS_WARNING) << "Failed to read file " << filename;
+        RTC_PARSE_CHECK_OR_RETURN(file.ReadEof());
+      }
+      end_of_file = true;
+    }
+
+    // Whatever is left at the end of the file is parsed as is, to report
+    // any truncated event.
+    size_t parse_size =
+        end_of_file ? buffer.size() : CompleteEventsSize(buffer);
+    if (parse_size > 0) {
+      status =
+          ParseStreamInternal(absl::string_view(buffer).substr(0, parse_size));
+      buffer.erase(0, parse_size);
+    }
+  }
+  return FinishParsing(status);
 }
 
 ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseString(
@@ -1127,8 +1182,11 @@ ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseString(
 ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseStream(
     absl::string_view s) {
   Clear();
-  ParseStatus status = ParseStreamInternal(s);
+  return FinishParsing(ParseStreamInternal(s));
+}
 
+ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::FinishParsing(
+    ParseStatus status) {
   // Cache the configured SSRCs.
   for (const auto& video_recv_config : video_recv_configs()) {
     incoming_video_ssrcs_.insert(video_recv_config.config.remote_ssrc);
@@ -1279,6 +1337,11 @@ ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseStream(
   return status;
 }
 
+bool ParsedRtcEventLog::SkipIncompleteLog() {
+  incomplete_log_ = allow_incomplete_logs_;
+  return incomplete_log_;
+}
+
 ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseStreamInternal(
     absl::string_view s) {
   constexpr uint64_t kMaxEventSize = 10000000;  // Sanity check.
@@ -1296,14 +1359,16 @@ ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseStreamInternal(
   std::tie(success, std::ignore) = DecodeVarInt(s, &tag);
   if (!success) {
     RTC_LOG(LS_WARNING) << "Failed to read varint from beginning of event log.";
-    RTC_PARSE_WARN_AND_RETURN_SUCCESS_IF(allow_incomplete_logs_,
+    RTC_PARSE_WARN_AND_RETURN_SUCCESS_IF(SkipIncompleteLog(),
                                          kIncompleteLogError);
     return ParseStatus::Error("Failed to read field tag varint", __FILE__,
                               __LINE__);
   }
   s = event_start;
 
-  if (tag >> 1 == static_cast<uint64_t>(RtcEvent::Type::BeginV3Log)) {
+  if (v3_log_ ||
+      tag >> 1 == static_cast<uint64_t>(RtcEvent::Type::BeginV3Log)) {
+    v3_log_ = true;
     return ParseStreamInternalV3(s);
   }
 
@@ -1314,7 +1379,7 @@ ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseStreamInternal(
     if (!success) {
       RTC_LOG(LS_WARNING)
           << "Failed to read field tag from beginning of protobuf event.";
-      RTC_PARSE_WARN_AND_RETURN_SUCCESS_IF(allow_incomplete_logs_,
+      RTC_PARSE_WARN_AND_RETURN_SUCCESS_IF(SkipIncompleteLog(),
                                            kIncompleteLogError);
       return ParseStatus::Error("Failed to read field tag varint", __FILE__,
                                 __LINE__);
@@ -1326,7 +1391,7 @@ ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseStreamInternal(
       RTC_LOG(LS_WARNING) << "Expected field tag with wire type 2 (length "
                              "delimited message). Found wire type "
                           << wire_type;
-      RTC_PARSE_WARN_AND_RETURN_SUCCESS_IF(allow_incomplete_logs_,
+      RTC_PARSE_WARN_AND_RETURN_SUCCESS_IF(SkipIncompleteLog(),
                                            kIncompleteLogError);
       RTC_PARSE_CHECK_OR_RETURN_EQ(wire_type, 2);
     }
@@ -1336,7 +1401,7 @@ ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseStreamInternal(
     std::tie(success, s) = DecodeVarInt(s, &message_length);
     if (!success) {
       RTC_LOG(LS_WARNING) << "Missing message length after protobuf field tag.";
-      RTC_PARSE_WARN_AND_RETURN_SUCCESS_IF(allow_incomplete_logs_,
+      RTC_PARSE_WARN_AND_RETURN_SUCCESS_IF(SkipIncompleteLog(),
                                            kIncompleteLogError);
       return ParseStatus::Error("Failed to read message length varint",
                                 __FILE__, __LINE__);
@@ -1345,7 +1410,7 @@ ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseStreamInternal(
     if (message_length > s.size()) {
       RTC_LOG(LS_WARNING) << "Protobuf message length is larger than the "
                              "remaining bytes in the proto.";
-      RTC_PARSE_WARN_AND_RETURN_SUCCESS_IF(allow_incomplete_logs_,
+      RTC_PARSE_WARN_AND_RETURN_SUCCESS_IF(SkipIncompleteLog(),
                                            kIncompleteLogError);
       return ParseStatus::Error(
           "Incomplete message: the length of the next message is larger than "
@@ -1365,7 +1430,7 @@ ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseStreamInternal(
       if (!event_stream.ParseFromArray(event_start.data(), total_event_size)) {
         RTC_LOG(LS_WARNING)
             << "Failed to parse legacy-format protobuf message.";
-        RTC_PARSE_WARN_AND_RETURN_SUCCESS_IF(allow_incomplete_logs_,
+        RTC_PARSE_WARN_AND_RETURN_SUCCESS_IF(SkipIncompleteLog(),
                                              kIncompleteLogError);
         RTC_PARSE_CHECK_OR_RETURN(false);
       }
@@ -1378,7 +1443,7 @@ ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseStreamInternal(
       rtclog2::EventStream event_stream;
       if (!event_stream.ParseFromArray(event_start.data(), total_event_size)) {
         RTC_LOG(LS_WARNING) << "Failed to parse new-format protobuf message.";
-        RTC_PARSE_WARN_AND_RETURN_SUCCESS_IF(allow_incomplete_logs_,
+        RTC_PARSE_WARN_AND_RETURN_SUCCESS_IF(SkipIncompleteLog(),
                                              kIncompleteLogError);
         RTC_PARSE_CHECK_OR_RETURN(false);
       }
@@ -1392,8 +1457,9 @@ ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseStreamInternal(
 ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseStreamInternalV3(
     absl::string_view s) {
   constexpr uint64_t kMaxEventSize = 10000000;  // Sanity check.
-  bool expect_begin_log_event = true;
   bool success = false;
+  std::map<uint64_t, std::vector<V3Event>> events_by_type;
+  size_t total_size = 0;
 
   while (!s.empty()) {
     // Read event type.
@@ -1417,19 +1483,60 @@ ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseStreamInternalV3(
     absl::string_view event_fields = s.substr(0, event_size_bytes);
     s = s.substr(event_size_bytes);
 
-    if (expect_begin_log_event) {
+    if (expect_v3_begin_log_event_) {
       RTC_PARSE_CHECK_OR_RETURN_EQ(
           event_type, static_cast<uint32_t>(RtcEvent::Type::BeginV3Log));
-      expect_begin_log_event = false;
+      expect_v3_begin_log_event_ = false;
     }
 
+    if (event_type == static_cast<uint32_t>(RtcEvent::Type::EndV3Log)) {
+      expect_v3_begin_log_event_ = true;
+    }
+    events_by_type[event_type].push_back({event_fields, batched});
+    total_size += event_fields.size();
+  }
+
+  // Events of different types are stored in different containers, so each
+  // type can be decoded on its own thread. The events of one type are decoded
+  // in the order they were logged.
+  std::vector<std::pair<uint64_t, std::vector<V3Event>>> work(
+      events_by_type.begin(), events_by_type.end());
+  size_t num_threads =
+      std::min<size_t>(work.size(), CpuInfo::DetectNumberOfCores());
+  if (total_size < kMinParallelDecodeSize || num_threads <= 1) {
+    for (const auto& [event_type, events] : work) {
+      ParseEventsV3(event_type, events);
+    }
+    return ParseStatus::Success();
+  }
+
+  std::atomic<size_t> next_type(0);
+  auto decode = [&] {
+    for (size_t i = next_type++; i < work.size(); i = next_type++) {
+      ParseEventsV3(work[i].first, work[i].second);
+    }
+  };
+  std::vector<rtc::PlatformThread> threads;
+  for (size_t i = 1; i < num_threads; ++i) {
+    threads.push_back(
+        rtc::PlatformThread::SpawnJoinable(decode, "RtcEventLogParser"));
+  }
+  decode();
+  // Joins the threads.
+  threads.clear();
+
+  return ParseStatus::Success();
+}
+
+void ParsedRtcEventLog::ParseEventsV3(uint64_t event_type,
+                                      const std::vector<V3Event>& events) {
+  for (const auto& [event_fields, batched] : events) {
     switch (event_type) {
       case static_cast<uint32_t>(RtcEvent::Type::BeginV3Log):
         RtcEventBeginLog::Parse(event_fields, batched, start_log_events_);
         break;
       case static_cast<uint32_t>(RtcEvent::Type::EndV3Log):
         RtcEventEndLog::Parse(event_fields, batched, stop_log_events_);
-        expect_begin_log_event = true;
         break;
       case static_cast<uint32_t>(RtcEvent::Type::AlrStateEvent):
         RtcEventAlrState::Parse(event_fields, batched, alr_state_events_);
@@ -1534,8 +1641,6 @@ ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseStreamInternalV3(
         break;
     }
   }
-
-  return ParseStatus::Success();
 }
 
 template <typename T>
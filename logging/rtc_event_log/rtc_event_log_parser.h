@@ -381,6 +381,8 @@ class ParsedRtcEventLog {
   void Clear();
 
   // Reads an RtcEventLog file and returns success if parsing was successful.
+  // The file is read and parsed a chunk at a time, so only the parsed events
+  // and not the whole encoded log are kept in memory.
   ParseStatus ParseFile(absl::string_view file_name);
 
   // Reads an RtcEventLog from a string and returns success if successful.
@@ -668,9 +670,29 @@ class ParsedRtcEventLog {
   std::vector<InferredRouteChangeEvent> GetRouteChanges() const;
 
  private:
+  // Parses the events in `s`, which must begin at an event boundary. Can be
+  // called repeatedly to parse a log a chunk at a time.
   ABSL_MUST_USE_RESULT ParseStatus ParseStreamInternal(absl::string_view s);
   ABSL_MUST_USE_RESULT ParseStatus ParseStreamInternalV3(absl::string_view s);
 
+  // An encoded v3 event, or batch of events of the same type.
+  struct V3Event {
+    absl::string_view fields;
+    bool batched;
+  };
+  // Decodes the v3 `events` of type `event_type` into the container for that
+  // type. Different types may be decoded concurrently.
+  void ParseEventsV3(uint64_t event_type, const std::vector<V3Event>& events);
+
+  // Returns true, and stops parsing any later chunks, if parse errors should
+  // be ignored and only the beginning of the log used.
+  bool SkipIncompleteLog();
+
+  // Derives the per SSRC packet streams, RTCP blocks, timestamps and log
+  // segments from the parsed events. Returns `status`, the result of parsing
+  // the events, unless this fails.
+  ABSL_MUST_USE_RESULT ParseStatus FinishParsing(ParseStatus status);
+
   ABSL_MUST_USE_RESULT ParseStatus
   StoreParsedLegacyEvent(const rtclog::Event& event);
 
@@ -903,6 +925,12 @@ class ParsedRtcEventLog {
 
   std::vector<uint8_t> last_incoming_rtcp_packet_;
 
+  // Parsing state that is carried over between the chunks of a log.
+  bool v3_log_ = false;
+  bool expect_v3_begin_log_event_ = true;
+  // Set when the remainder of an incomplete log was skipped.
+  bool incomplete_log_ = false;
+
   Timestamp first_timestamp_ = Timestamp::PlusInfinity();
   Timestamp last_timestamp_ = Timestamp::MinusInfinity();
 
@@ -670,6 +670,9 @@ class FakeVideoMediaReceiveChannel
       override;
   void ClearRecordableEncodedFrameCallback(uint32_t ssrc) override;
   void RequestRecvKeyFrame(uint32_t ssrc) override;
+  void SetRecvDecodeLimit(
+      uint32_t ssrc,
+      webrtc::VideoReceiveStreamInterface::DecodeLimit limit) override {}
   void SetReceiverFeedbackParameters(bool lntf_enabled,
                                      bool nack_enabled,
                                      webrtc::RtcpMode rtcp_mode,
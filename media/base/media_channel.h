@@ -987,6 +987,11 @@ class VideoMediaReceiveChannelInterface : public MediaReceiveChannelInterface {
   // Request generation of a keyframe for `ssrc` on a receiving channel via
   // RTCP feedback.
   virtual void RequestRecvKeyFrame(uint32_t ssrc) = 0;
+  // Limits which frames of `ssrc` are decoded, e.g. while the video is hidden
+  // or rendered small.
+  virtual void SetRecvDecodeLimit(
+      uint32_t ssrc,
+      webrtc::VideoReceiveStreamInterface::DecodeLimit limit) = 0;
 
   virtual std::vector<webrtc::RtpSource> GetSources(uint32_t ssrc) const = 0;
   // Set recordable encoded frame callback for `ssrc`
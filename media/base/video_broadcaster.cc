@@ -66,6 +66,9 @@ VideoSinkWants VideoBroadcaster::wants() const {
 void VideoBroadcaster::OnFrame(const webrtc::VideoFrame& frame) {
   webrtc::MutexLock lock(&sinks_and_wants_lock_);
   bool current_frame_was_discarded = false;
+  // Converted on first use, for the sinks that require I420.
+  absl::optional<webrtc::VideoFrame> i420_frame;
+  bool i420_conversion_failed = false;
   for (auto& sink_pair : sink_pairs()) {
     if (sink_pair.wants.rotation_applied &&
         frame.rotation() != webrtc::kVideoRotation_0) {
@@ -88,14 +91,37 @@ void VideoBroadcaster::OnFrame(const webrtc::VideoFrame& frame) {
               .set_id(frame.id())
               .build();
       sink_pair.sink->OnFrame(black_frame);
-    } else if (!previous_frame_sent_to_all_sinks_ && frame.has_update_rect()) {
+      continue;
+    }
+    const webrtc::VideoFrame* sink_frame = &frame;
+    if (sink_pair.wants.requires_i420 &&
+        frame.video_frame_buffer()->GetI420() == nullptr) {
+      if (!i420_frame && !i420_conversion_failed) {
+        rtc::scoped_refptr<webrtc::I420BufferInterface> i420_buffer =
+            frame.video_frame_buffer()->ToI420();
+        if (i420_buffer) {
+          i420_frame = frame;
+          i420_frame->set_video_frame_buffer(i420_buffer);
+        } else {
+          RTC_LOG(LS_ERROR) << "Failed to convert frame to I420.";
+          i420_conversion_failed = true;
+        }
+      }
+      if (!i420_frame) {
+        sink_pair.sink->OnDiscardedFrame();
+        current_frame_was_discarded = true;
+        continue;
+      }
+      sink_frame = &*i420_frame;
+    }
+    if (!previous_frame_sent_to_all_sinks_ && sink_frame->has_update_rect()) {
       // Since last frame was not sent to some sinks, no reliable update
       // information is available, so we need to clear the update rect.
-      webrtc::VideoFrame copy = frame;
+      webrtc::VideoFrame copy = *sink_frame;
       copy.clear_update_rect();
       sink_pair.sink->OnFrame(copy);
     } else {
-      sink_pair.sink->OnFrame(frame);
+      sink_pair.sink->OnFrame(*sink_frame);
     }
   }
   previous_frame_sent_to_all_sinks_ = !current_frame_was_discarded;
@@ -151,6 +177,10 @@ void VideoBroadcaster::UpdateWants() {
     if (sink.wants.rotation_applied) {
       wants.rotation_applied = true;
     }
+    // wants.requires_i420 == ANY(sink.wants.requires_i420)
+    if (sink.wants.requires_i420) {
+      wants.requires_i420 = true;
+    }
     // wants.max_pixel_count == MIN(sink.wants.max_pixel_count)
     if (sink.wants.max_pixel_count < wants.max_pixel_count) {
       wants.max_pixel_count = sink.wants.max_pixel_count;
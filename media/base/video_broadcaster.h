@@ -52,6 +52,8 @@ class VideoBroadcaster : public VideoSourceBase,
   // it will never receive a frame with pending rotation. Our caller
   // may pass in frames without precise synchronization with changes
   // to the VideoSinkWants.
+  // Sinks that set requires_i420 get the frame converted to I420 if it is not
+  // already; the conversion is done once per frame and shared by those sinks.
   void OnFrame(const webrtc::VideoFrame& frame) override;
 
   void OnDiscardedFrame() override;
@@ -14,6 +14,7 @@
 
 #include "absl/types/optional.h"
 #include "api/video/i420_buffer.h"
+#include "api/video/nv12_buffer.h"
 #include "api/video/video_frame.h"
 #include "api/video/video_rotation.h"
 #include "api/video/video_source_interface.h"
@@ -252,6 +253,59 @@ TEST(VideoBroadcasterTest, SinkWantsBlackFrames) {
   EXPECT_EQ(30, sink2.timestamp_us());
 }
 
+class FrameBufferSink : public rtc::VideoSinkInterface<webrtc::VideoFrame> {
+ public:
+  void OnFrame(const webrtc::VideoFrame& frame) override {
+    buffer = frame.video_frame_buffer();
+  }
+
+  rtc::scoped_refptr<webrtc::VideoFrameBuffer> buffer;
+};
+
+TEST(VideoBroadcasterTest, ConvertsToI420OnlyForSinksRequiringIt) {
+  VideoBroadcaster broadcaster;
+  EXPECT_FALSE(broadcaster.wants().requires_i420);
+
+  FrameBufferSink native_sink;
+  broadcaster.AddOrUpdateSink(&native_sink, VideoSinkWants());
+  EXPECT_FALSE(broadcaster.wants().requires_i420);
+
+  VideoSinkWants i420_wants;
+  i420_wants.requires_i420 = true;
+  FrameBufferSink i420_sink1;
+  broadcaster.AddOrUpdateSink(&i420_sink1, i420_wants);
+  FrameBufferSink i420_sink2;
+  broadcaster.AddOrUpdateSink(&i420_sink2, i420_wants);
+  EXPECT_TRUE(broadcaster.wants().requires_i420);
+
+  rtc::scoped_refptr<webrtc::NV12Buffer> buffer =
+      webrtc::NV12Buffer::Create(100, 50);
+  buffer->InitializeData();
+  broadcaster.OnFrame(webrtc::VideoFrame::Builder()
+                          .set_video_frame_buffer(buffer)
+                          .set_timestamp_us(0)
+                          .build());
+  EXPECT_EQ(native_sink.buffer, buffer);
+  ASSERT_TRUE(i420_sink1.buffer);
+  EXPECT_EQ(i420_sink1.buffer->type(), webrtc::VideoFrameBuffer::Type::kI420);
+  // The frame is converted once for all sinks requiring I420.
+  EXPECT_EQ(i420_sink2.buffer, i420_sink1.buffer);
+
+  // I420 frames are forwarded as they are.
+  rtc::scoped_refptr<webrtc::I420Buffer> i420_buffer =
+      webrtc::I420Buffer::Create(100, 50);
+  webrtc::I420Buffer::SetBlack(i420_buffer.get());
+  broadcaster.OnFrame(webrtc::VideoFrame::Builder()
+                          .set_video_frame_buffer(i420_buffer)
+                          .set_timestamp_us(1)
+                          .build());
+  EXPECT_EQ(i420_sink1.buffer, i420_buffer);
+
+  broadcaster.RemoveSink(&i420_sink1);
+  broadcaster.RemoveSink(&i420_sink2);
+  EXPECT_FALSE(broadcaster.wants().requires_i420);
+}
+
 TEST(VideoBroadcasterTest, ConstraintsChangedNotCalledOnSinkAddition) {
   MockSink sink;
   VideoBroadcaster broadcaster;
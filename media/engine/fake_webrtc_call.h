@@ -130,6 +130,8 @@ class FakeAudioReceiveStream final
   webrtc::AudioReceiveStreamInterface::Stats GetStats(
       bool get_and_clear_legacy_stats) const override;
   void SetSink(webrtc::AudioSinkInterface* sink) override;
+  void SetDecodedAudioProcessor(
+      webrtc::DecodedAudioProcessor* processor) override {}
   void SetGain(float gain) override;
   bool SetBaseMinimumPlayoutDelayMs(int delay_ms) override {
     base_mininum_playout_delay_ms_ = delay_ms;
@@ -273,6 +275,8 @@ class FakeVideoReceiveStream final
     return RecordingState();
   }
   void GenerateKeyFrame() override {}
+  void SetDecodeLimit(DecodeLimit limit) override { decode_limit_ = limit; }
+  DecodeLimit decode_limit() const { return decode_limit_; }
 
   void SetRtcpMode(webrtc::RtcpMode mode) override {
     config_.rtp.rtcp_mode = mode;
@@ -326,6 +330,7 @@ class FakeVideoReceiveStream final
   webrtc::VideoReceiveStreamInterface::Stats stats_;
 
   int base_mininum_playout_delay_ms_ = 0;
+  DecodeLimit decode_limit_ = DecodeLimit::kNone;
 };
 
 class FakeFlexfecReceiveStream final : public webrtc::FlexfecReceiveStream {
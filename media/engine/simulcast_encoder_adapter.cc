@@ -17,6 +17,7 @@
 #include <cstdint>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "absl/algorithm/container.h"
 #include "api/scoped_refptr.h"
@@ -144,6 +145,26 @@ std::vector<uint32_t> GetStreamStartBitratesKbps(
   return start_bitrates;
 }
 
+// Scales `buffer` for `encoder`. NV12 buffers are converted to I420 in the
+// same pass when the encoder does not take NV12, instead of having the
+// encoder convert the scaled NV12 buffer.
+rtc::scoped_refptr<webrtc::VideoFrameBuffer> ScaleForEncoder(
+    const rtc::scoped_refptr<webrtc::VideoFrameBuffer>& buffer,
+    int width,
+    int height,
+    const webrtc::VideoEncoder& encoder) {
+  if (buffer->type() != webrtc::VideoFrameBuffer::Type::kNV12 ||
+      absl::c_linear_search(encoder.GetEncoderInfo().preferred_pixel_formats,
+                            webrtc::VideoFrameBuffer::Type::kNV12)) {
+    return buffer->Scale(width, height);
+  }
+  rtc::scoped_refptr<webrtc::I420Buffer> scaled =
+      webrtc::I420Buffer::Create(width, height);
+  scaled->CropAndScaleFrom(*buffer->GetNV12(), 0, 0, buffer->width(),
+                           buffer->height());
+  return scaled;
+}
+
 }  // namespace
 
 namespace webrtc {
@@ -474,10 +495,17 @@ int SimulcastEncoderAdapter::Encode(
     }
   }
 
-  // Temporary thay may hold the result of texture to i420 buffer conversion.
-  rtc::scoped_refptr<VideoFrameBuffer> src_buffer;
-  int src_width = input_image.width();
-  int src_height = input_image.height();
+  // The layers to encode this frame, in `stream_contexts_` order, with the
+  // frame types to encode them with.
+  struct LayerToEncode {
+    StreamContext* layer;
+    std::vector<VideoFrameType> frame_types;
+    // Null if the layer is given the input image as is.
+    rtc::scoped_refptr<VideoFrameBuffer> scaled_buffer;
+  };
+  std::vector<LayerToEncode> layers_to_encode;
+  const int src_width = input_image.width();
+  const int src_height = input_image.height();
 
   for (auto& layer : stream_contexts_) {
     // Don't encode frames in resolutions that we don't intend to send.
@@ -526,47 +554,77 @@ int SimulcastEncoderAdapter::Encode(
     } else if (layer.ShouldDropFrame(frame_timestamp)) {
       continue;
     }
+    layers_to_encode.push_back({&layer, std::move(stream_frame_types),
+                                /*scaled_buffer=*/nullptr});
+  }
 
-    // If scaling isn't required, because the input resolution
-    // matches the destination or the input image is empty (e.g.
-    // a keyframe request for encoders with internal camera
-    // sources) or the source image has a native handle, pass the image on
-    // directly. Otherwise, we'll scale it to match what the encoder expects
-    // (below).
-    // For texture frames, the underlying encoder is expected to be able to
-    // correctly sample/scale the source texture.
-    // TODO(perkj): ensure that works going forward, and figure out how this
-    // affects webrtc:5683.
-    if ((layer.width() == src_width && layer.height() == src_height) ||
-        (input_image.video_frame_buffer()->type() ==
-             VideoFrameBuffer::Type::kNative &&
-         layer.encoder().GetEncoderInfo().supports_native_handle)) {
-      int ret = layer.encoder().Encode(input_image, &stream_frame_types);
-      if (ret != WEBRTC_VIDEO_CODEC_OK) {
-        return ret;
-      }
-    } else {
-      if (src_buffer == nullptr) {
-        src_buffer = input_image.video_frame_buffer();
-      }
-      rtc::scoped_refptr<VideoFrameBuffer> dst_buffer =
-          src_buffer->Scale(layer.width(), layer.height());
-      if (!dst_buffer) {
-        RTC_LOG(LS_ERROR) << "Failed to scale video frame";
-        return WEBRTC_VIDEO_CODEC_ENCODER_FAILURE;
-      }
+  // If scaling isn't required, because the input resolution
+  // matches the destination or the input image is empty (e.g.
+  // a keyframe request for encoders with internal camera
+  // sources) or the source image has a native handle, pass the image on
+  // directly. Otherwise, we'll scale it to match what the encoder expects
+  // (below).
+  // For texture frames, the underlying encoder is expected to be able to
+  // correctly sample/scale the source texture.
+  // TODO(perkj): ensure that works going forward, and figure out how this
+  // affects webrtc:5683.
+  std::vector<LayerToEncode*> layers_to_scale;
+  for (auto& layer_to_encode : layers_to_encode) {
+    StreamContext& layer = *layer_to_encode.layer;
+    if ((layer.width() != src_width || layer.height() != src_height) &&
+        (input_image.video_frame_buffer()->type() !=
+             VideoFrameBuffer::Type::kNative ||
+         !layer.encoder().GetEncoderInfo().supports_native_handle)) {
+      layers_to_scale.push_back(&layer_to_encode);
+    }
+  }
+
+  // Scale the layers from the largest to the smallest, each one from the
+  // previous one when that is large enough, instead of all of them from the
+  // input image. Scale() keeps buffers that implement CropAndScale(), e.g.
+  // native ones, in their own format, and buffers that don't are converted to
+  // I420 only once.
+  absl::c_stable_sort(layers_to_scale, [](const LayerToEncode* a,
+                                          const LayerToEncode* b) {
+    return a->layer->width() * a->layer->height() >
+           b->layer->width() * b->layer->height();
+  });
+  rtc::scoped_refptr<VideoFrameBuffer> src_buffer =
+      input_image.video_frame_buffer();
+  for (LayerToEncode* layer_to_encode : layers_to_scale) {
+    const StreamContext& layer = *layer_to_encode->layer;
+    if (src_buffer->width() < layer.width() ||
+        src_buffer->height() < layer.height()) {
+      src_buffer = input_image.video_frame_buffer();
+    }
+    layer_to_encode->scaled_buffer =
+        ScaleForEncoder(src_buffer, layer.width(), layer.height(),
+                        layer.encoder());
+    if (!layer_to_encode->scaled_buffer) {
+      RTC_LOG(LS_ERROR) << "Failed to scale video frame";
+      return WEBRTC_VIDEO_CODEC_ENCODER_FAILURE;
+    }
+    src_buffer = layer_to_encode->scaled_buffer;
+  }
 
+  for (auto& layer_to_encode : layers_to_encode) {
+    int ret;
+    if (!layer_to_encode.scaled_buffer) {
+      ret = layer_to_encode.layer->encoder().Encode(
+          input_image, &layer_to_encode.frame_types);
+    } else {
       // UpdateRect is not propagated to lower simulcast layers currently.
       // TODO(ilnik): Consider scaling UpdateRect together with the buffer.
       VideoFrame frame(input_image);
-      frame.set_video_frame_buffer(dst_buffer);
+      frame.set_video_frame_buffer(layer_to_encode.scaled_buffer);
       frame.set_rotation(webrtc::kVideoRotation_0);
       frame.set_update_rect(
           VideoFrame::UpdateRect{0, 0, frame.width(), frame.height()});
-      int ret = layer.encoder().Encode(frame, &stream_frame_types);
-      if (ret != WEBRTC_VIDEO_CODEC_OK) {
-        return ret;
-      }
+      ret = layer_to_encode.layer->encoder().Encode(
+          frame, &layer_to_encode.frame_types);
+    }
+    if (ret != WEBRTC_VIDEO_CODEC_OK) {
+      return ret;
     }
   }
 
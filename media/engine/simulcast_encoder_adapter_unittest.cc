@@ -1004,6 +1004,7 @@ class FakeNativeBufferI420 : public VideoFrameBuffer {
   int height() const override { return height_; }
 
   rtc::scoped_refptr<I420BufferInterface> ToI420() override {
+    ++num_to_i420_calls_;
     if (allow_to_i420_) {
       return I420Buffer::Create(width_, height_);
     } else {
@@ -1012,10 +1013,13 @@ class FakeNativeBufferI420 : public VideoFrameBuffer {
     return nullptr;
   }
 
+  int num_to_i420_calls() const { return num_to_i420_calls_; }
+
  private:
   const int width_;
   const int height_;
   const bool allow_to_i420_;
+  int num_to_i420_calls_ = 0;
 };
 
 TEST_F(TestSimulcastEncoderAdapterFake,
@@ -1097,6 +1101,44 @@ TEST_F(TestSimulcastEncoderAdapterFake, NativeHandleForwardingOnlyIfSupported) {
   EXPECT_EQ(0, adapter_->Encode(input_frame, &frame_types));
 }
 
+TEST_F(TestSimulcastEncoderAdapterFake, ScalesLayersFromTheNextLargerLayer) {
+  SimulcastTestFixtureImpl::DefaultSettings(
+      &codec_, static_cast<const int*>(kTestTemporalLayerProfile),
+      kVideoCodecVP8);
+  codec_.numberOfSimulcastStreams = 3;
+  // High start bitrate, so all streams are enabled.
+  codec_.startBitrate = 3000;
+  EXPECT_EQ(0, adapter_->InitEncode(&codec_, kSettings));
+  adapter_->RegisterEncodeCompleteCallback(this);
+  auto& encoders = helper_->factory()->encoders();
+  ASSERT_EQ(3u, encoders.size());
+
+  auto buffer = rtc::make_ref_counted<FakeNativeBufferI420>(
+      1280, 720, /*allow_to_i420=*/true);
+  VideoFrame input_frame = VideoFrame::Builder()
+                               .set_video_frame_buffer(buffer)
+                               .set_timestamp_rtp(100)
+                               .set_timestamp_ms(1000)
+                               .build();
+  EXPECT_CALL(*encoders[2], Encode(::testing::Ref(input_frame), _)).Times(1);
+  for (int i = 0; i < 2; ++i) {
+    EXPECT_CALL(*encoders[i], Encode)
+        .WillOnce([&, i](const VideoFrame& frame,
+                         const std::vector<VideoFrameType>* frame_types) {
+          EXPECT_EQ(frame.width(), codec_.simulcastStream[i].width);
+          EXPECT_EQ(frame.height(), codec_.simulcastStream[i].height);
+          EXPECT_EQ(frame.video_frame_buffer()->type(),
+                    VideoFrameBuffer::Type::kI420);
+          return 0;
+        });
+  }
+  std::vector<VideoFrameType> frame_types(3, VideoFrameType::kVideoFrameKey);
+  EXPECT_EQ(0, adapter_->Encode(input_frame, &frame_types));
+  // The lowest layer is scaled from the middle one, so the native buffer is
+  // converted only once.
+  EXPECT_EQ(buffer->num_to_i420_calls(), 1);
+}
+
 TEST_F(TestSimulcastEncoderAdapterFake, GeneratesKeyFramesOnRequestedLayers) {
   // Set up common settings for three streams.
   SimulcastTestFixtureImpl::DefaultSettings(
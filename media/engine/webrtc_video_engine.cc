@@ -3562,6 +3562,7 @@ void WebRtcVideoChannel::WebRtcVideoReceiveStream::RecreateReceiveStream() {
     stream_->SetAndGetRecordingState(std::move(*recording_state),
                                      /*generate_key_frame=*/false);
   }
+  stream_->SetDecodeLimit(decode_limit_);
   if (receiving_) {
     StartReceiveStream();
   }
@@ -3809,6 +3810,14 @@ void WebRtcVideoReceiveChannel::WebRtcVideoReceiveStream::GenerateKeyFrame() {
   }
 }
 
+void WebRtcVideoReceiveChannel::WebRtcVideoReceiveStream::SetDecodeLimit(
+    webrtc::VideoReceiveStreamInterface::DecodeLimit limit) {
+  decode_limit_ = limit;
+  if (stream_) {
+    stream_->SetDecodeLimit(limit);
+  }
+}
+
 void WebRtcVideoReceiveChannel::WebRtcVideoReceiveStream::
     SetDepacketizerToDecoderFrameTransformer(
         rtc::scoped_refptr<webrtc::FrameTransformerInterface>
@@ -3911,6 +3920,19 @@ void WebRtcVideoReceiveChannel::RequestRecvKeyFrame(uint32_t ssrc) {
   }
 }
 
+void WebRtcVideoReceiveChannel::SetRecvDecodeLimit(
+    uint32_t ssrc,
+    webrtc::VideoReceiveStreamInterface::DecodeLimit limit) {
+  RTC_DCHECK_RUN_ON(&thread_checker_);
+  WebRtcVideoReceiveStream* stream = FindReceiveStream(ssrc);
+  if (stream) {
+    stream->SetDecodeLimit(limit);
+  } else {
+    RTC_LOG(LS_ERROR)
+        << "Absent receive stream; ignoring decode limit for ssrc " << ssrc;
+  }
+}
+
 void WebRtcVideoReceiveChannel::SetDepacketizerToDecoderFrameTransformer(
     uint32_t ssrc,
     rtc::scoped_refptr<webrtc::FrameTransformerInterface> frame_transformer) {
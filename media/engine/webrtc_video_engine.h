@@ -634,6 +634,9 @@ class WebRtcVideoReceiveChannel : public MediaChannelUtil,
       override;
   void ClearRecordableEncodedFrameCallback(uint32_t ssrc) override;
   void RequestRecvKeyFrame(uint32_t ssrc) override;
+  void SetRecvDecodeLimit(
+      uint32_t ssrc,
+      webrtc::VideoReceiveStreamInterface::DecodeLimit limit) override;
   void SetDepacketizerToDecoderFrameTransformer(
       uint32_t ssrc,
       rtc::scoped_refptr<webrtc::FrameTransformerInterface> frame_transformer)
@@ -741,6 +744,7 @@ class WebRtcVideoReceiveChannel : public MediaChannelUtil,
         std::function<void(const webrtc::RecordableEncodedFrame&)> callback);
     void ClearRecordableEncodedFrameCallback();
     void GenerateKeyFrame();
+    void SetDecodeLimit(webrtc::VideoReceiveStreamInterface::DecodeLimit limit);
 
     void SetDepacketizerToDecoderFrameTransformer(
         rtc::scoped_refptr<webrtc::FrameTransformerInterface>
@@ -790,6 +794,9 @@ class WebRtcVideoReceiveChannel : public MediaChannelUtil,
 
     RTC_NO_UNIQUE_ADDRESS webrtc::SequenceChecker thread_checker_;
     bool receiving_ RTC_GUARDED_BY(&thread_checker_);
+    // Kept to be applied again when `stream_` is recreated.
+    webrtc::VideoReceiveStreamInterface::DecodeLimit decode_limit_ =
+        webrtc::VideoReceiveStreamInterface::DecodeLimit::kNone;
   };
   bool GetChangedRecvParameters(const VideoReceiverParameters& params,
                                 ChangedRecvParameters* changed_params) const
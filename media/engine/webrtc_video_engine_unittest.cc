@@ -7327,6 +7327,27 @@ TEST_F(WebRtcVideoChannelTest, BaseMinimumPlayoutDelayMsUnsignaledRecvStream) {
   EXPECT_EQ(recv_stream->base_mininum_playout_delay_ms(), 300);
 }
 
+TEST_F(WebRtcVideoChannelTest, DecodeLimitIsKeptWhenRecreatingRecvStream) {
+  using DecodeLimit = webrtc::VideoReceiveStreamInterface::DecodeLimit;
+  cricket::VideoReceiverParameters parameters;
+  parameters.codecs.push_back(GetEngineCodec("VP8"));
+  ASSERT_TRUE(receive_channel_->SetRecvParameters(parameters));
+  EXPECT_TRUE(AddRecvStream());
+  EXPECT_EQ(fake_call_->GetVideoReceiveStream(last_ssrc_)->decode_limit(),
+            DecodeLimit::kNone);
+
+  receive_channel_->SetRecvDecodeLimit(last_ssrc_, DecodeLimit::kBaseLayer);
+  EXPECT_EQ(fake_call_->GetVideoReceiveStream(last_ssrc_)->decode_limit(),
+            DecodeLimit::kBaseLayer);
+
+  // Changing the receive codecs recreates the stream.
+  parameters.codecs.push_back(GetEngineCodec("VP9"));
+  ASSERT_TRUE(receive_channel_->SetRecvParameters(parameters));
+  EXPECT_EQ(fake_call_->GetNumCreatedReceiveStreams(), 2);
+  EXPECT_EQ(fake_call_->GetVideoReceiveStream(last_ssrc_)->decode_limit(),
+            DecodeLimit::kBaseLayer);
+}
+
 void WebRtcVideoChannelTest::TestReceiveUnsignaledSsrcPacket(
     uint8_t payload_type,
     bool expect_created_receive_stream) {
@@ -19,6 +19,7 @@
 #include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
 #include "api/array_view.h"
+#include "api/priority.h"
 #include "media/base/media_channel.h"
 #include "net/dcsctp/public/dcsctp_socket_factory.h"
 #include "net/dcsctp/public/packet_observer.h"
@@ -32,6 +33,7 @@
 #include "rtc_base/thread.h"
 #include "rtc_base/trace_event.h"
 #include "system_wrappers/include/clock.h"
+#include "system_wrappers/include/field_trial.h"
 
 namespace webrtc {
 
@@ -68,6 +70,21 @@ WebrtcPPID ToPPID(DataMessageType message_type, size_t size) {
   }
 }
 
+// https://www.rfc-editor.org/rfc/rfc8831.html#section-6.4
+dcsctp::StreamPriority ToStreamPriority(Priority priority) {
+  switch (priority) {
+    case Priority::kVeryLow:
+      return dcsctp::StreamPriority(128);
+    case Priority::kLow:
+      return dcsctp::StreamPriority(256);
+    case Priority::kMedium:
+      return dcsctp::StreamPriority(512);
+    case Priority::kHigh:
+      return dcsctp::StreamPriority(1024);
+  }
+  RTC_CHECK_NOTREACHED();
+}
+
 absl::optional<DataMessageType> ToDataMessageType(dcsctp::PPID ppid) {
   switch (static_cast<WebrtcPPID>(ppid.value())) {
     case WebrtcPPID::kDCEP:
@@ -191,6 +208,10 @@ bool DcSctpTransport::Start(int local_sctp_port,
     // Don't close the connection automatically on too many retransmissions.
     options.max_retransmissions = absl::nullopt;
     options.max_init_retransmits = absl::nullopt;
+    // Stream priorities are only honored within a message when messages on
+    // different streams can be interleaved.
+    options.enable_message_interleaving =
+        field_trial::IsEnabled("WebRTC-DataChannelMessageInterleaving");
 
     std::unique_ptr<dcsctp::PacketObserver> packet_observer;
     if (RTC_LOG_CHECK_LEVEL(LS_VERBOSE)) {
@@ -200,6 +221,9 @@ bool DcSctpTransport::Start(int local_sctp_port,
 
     socket_ = socket_factory_->Create(debug_name_, *this,
                                       std::move(packet_observer), options);
+    for (const auto& [stream_id, stream_state] : stream_states_) {
+      socket_->SetStreamPriority(stream_id, stream_state.priority);
+    }
   } else {
     if (local_sctp_port != socket_->options().local_port ||
         remote_sctp_port != socket_->options().remote_port) {
@@ -217,13 +241,18 @@ bool DcSctpTransport::Start(int local_sctp_port,
   return true;
 }
 
-bool DcSctpTransport::OpenStream(int sid) {
+bool DcSctpTransport::OpenStream(int sid, Priority priority) {
   RTC_DCHECK_RUN_ON(network_thread_);
-  RTC_DLOG(LS_INFO) << debug_name_ << "->OpenStream(" << sid << ").";
+  RTC_DLOG(LS_INFO) << debug_name_ << "->OpenStream(" << sid << ", "
+                    << static_cast<int>(priority) << ").";
 
+  dcsctp::StreamID stream_id(static_cast<uint16_t>(sid));
   StreamState stream_state;
-  stream_states_.insert_or_assign(dcsctp::StreamID(static_cast<uint16_t>(sid)),
-                                  stream_state);
+  stream_state.priority = ToStreamPriority(priority);
+  stream_states_.insert_or_assign(stream_id, stream_state);
+  if (socket_) {
+    socket_->SetStreamPriority(stream_id, stream_state.priority);
+  }
   return true;
 }
 
@@ -17,6 +17,7 @@
 #include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
 #include "api/array_view.h"
+#include "api/priority.h"
 #include "api/task_queue/task_queue_base.h"
 #include "media/sctp/sctp_transport_internal.h"
 #include "net/dcsctp/public/dcsctp_options.h"
@@ -55,7 +56,7 @@ class DcSctpTransport : public cricket::SctpTransportInternal,
   bool Start(int local_sctp_port,
              int remote_sctp_port,
              int max_message_size) override;
-  bool OpenStream(int sid) override;
+  bool OpenStream(int sid, Priority priority) override;
   bool ResetStream(int sid) override;
   RTCError SendData(int sid,
                     const SendDataParams& params,
@@ -126,6 +127,9 @@ class DcSctpTransport : public cricket::SctpTransportInternal,
     bool incoming_reset_done = false;
     // True when the local connection received OnStreamsResetPerformed
     bool outgoing_reset_done = false;
+    // The priority the stream was opened with, which is applied to the socket
+    // once it has been created.
+    dcsctp::StreamPriority priority = dcsctp::StreamPriority(0);
   };
 
   // Map of all currently open or closing data channels
@@ -114,8 +114,8 @@ TEST(DcSctpTransportTest, CloseSequence) {
 
   peer_a.sctp_transport_->Start(5000, 5000, 256 * 1024);
   peer_b.sctp_transport_->Start(5000, 5000, 256 * 1024);
-  peer_a.sctp_transport_->OpenStream(1);
-  peer_b.sctp_transport_->OpenStream(1);
+  peer_a.sctp_transport_->OpenStream(1, Priority::kLow);
+  peer_b.sctp_transport_->OpenStream(1, Priority::kLow);
   peer_a.sctp_transport_->ResetStream(1);
 
   // Simulate the callbacks from the stream resets
@@ -156,8 +156,8 @@ TEST(DcSctpTransportTest, CloseSequenceSimultaneous) {
 
   peer_a.sctp_transport_->Start(5000, 5000, 256 * 1024);
   peer_b.sctp_transport_->Start(5000, 5000, 256 * 1024);
-  peer_a.sctp_transport_->OpenStream(1);
-  peer_b.sctp_transport_->OpenStream(1);
+  peer_a.sctp_transport_->OpenStream(1, Priority::kLow);
+  peer_b.sctp_transport_->OpenStream(1, Priority::kLow);
   peer_a.sctp_transport_->ResetStream(1);
   peer_b.sctp_transport_->ResetStream(1);
 
@@ -193,7 +193,7 @@ TEST(DcSctpTransportTest, DiscardMessageClosingChannel) {
 
   EXPECT_CALL(*peer_a.socket_, Send(_, _)).Times(0);
 
-  peer_a.sctp_transport_->OpenStream(1);
+  peer_a.sctp_transport_->OpenStream(1, Priority::kLow);
   peer_a.sctp_transport_->Start(5000, 5000, 256 * 1024);
   peer_a.sctp_transport_->ResetStream(1);
 
@@ -211,7 +211,7 @@ TEST(DcSctpTransportTest, SendDataOpenChannel) {
   EXPECT_CALL(*peer_a.socket_, Send(_, _)).Times(1);
   EXPECT_CALL(*peer_a.socket_, options()).WillOnce(ReturnPointee(&options));
 
-  peer_a.sctp_transport_->OpenStream(1);
+  peer_a.sctp_transport_->OpenStream(1, Priority::kLow);
   peer_a.sctp_transport_->Start(5000, 5000, 256 * 1024);
 
   SendDataParams params;
@@ -227,7 +227,7 @@ TEST(DcSctpTransportTest, DeliversMessage) {
               OnDataReceived(1, webrtc::DataMessageType::kBinary, _))
       .Times(1);
 
-  peer_a.sctp_transport_->OpenStream(1);
+  peer_a.sctp_transport_->OpenStream(1, Priority::kLow);
   peer_a.sctp_transport_->Start(5000, 5000, 256 * 1024);
 
   static_cast<dcsctp::DcSctpSocketCallbacks*>(peer_a.sctp_transport_.get())
@@ -235,13 +235,29 @@ TEST(DcSctpTransportTest, DeliversMessage) {
           dcsctp::DcSctpMessage(dcsctp::StreamID(1), dcsctp::PPID(53), {0}));
 }
 
+TEST(DcSctpTransportTest, SetsStreamPriority) {
+  rtc::AutoThread main_thread;
+  Peer peer_a;
+
+  // Priorities of streams opened before the socket is created are applied
+  // once it has been created.
+  EXPECT_CALL(*peer_a.socket_, SetStreamPriority(dcsctp::StreamID(1),
+                                                 dcsctp::StreamPriority(1024)));
+  EXPECT_CALL(*peer_a.socket_, SetStreamPriority(dcsctp::StreamID(2),
+                                                 dcsctp::StreamPriority(128)));
+
+  peer_a.sctp_transport_->OpenStream(1, Priority::kHigh);
+  peer_a.sctp_transport_->Start(5000, 5000, 256 * 1024);
+  peer_a.sctp_transport_->OpenStream(2, Priority::kVeryLow);
+}
+
 TEST(DcSctpTransportTest, DropMessageWithUnknownPpid) {
   rtc::AutoThread main_thread;
   Peer peer_a;
 
   EXPECT_CALL(peer_a.sink_, OnDataReceived(_, _, _)).Times(0);
 
-  peer_a.sctp_transport_->OpenStream(1);
+  peer_a.sctp_transport_->OpenStream(1, Priority::kLow);
   peer_a.sctp_transport_->Start(5000, 5000, 256 * 1024);
 
   static_cast<dcsctp::DcSctpSocketCallbacks*>(peer_a.sctp_transport_.get())
@@ -18,6 +18,7 @@
 #include <string>
 #include <vector>
 
+#include "api/priority.h"
 #include "api/rtc_error.h"
 #include "api/transport/data_channel_transport_interface.h"
 #include "media/base/media_channel.h"
@@ -113,7 +114,9 @@ class SctpTransportInternal {
   // TODO(deadbeef): Actually implement the "returns false if `sid` can't be
   // used" part. See:
   // https://bugs.chromium.org/p/chromium/issues/detail?id=619849
-  virtual bool OpenStream(int sid) = 0;
+  // Outgoing data on streams with a higher `priority` is preferred over that
+  // on streams with a lower one.
+  virtual bool OpenStream(int sid, webrtc::Priority priority) = 0;
   // The inverse of OpenStream. Begins the closing procedure, which will
   // eventually result in SignalClosingProcedureComplete on the side that
   // initiates it, and both SignalClosingProcedureStartedRemotely and
@@ -0,0 +1,104 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_coding/codecs/g711/g711_interface.h"
+#include "modules/audio_coding/codecs/tools/audio_codec_speed_test.h"
+
+using ::std::string;
+
+namespace webrtc {
+
+static const int kG711BlockDurationMs = 20;
+static const int kG711SamplingKhz = 8;
+
+// Measures the time spent in G.711 encoding and decoding. The "real time"
+// percentage printed by EncodeDecode() is the inverse of the number of streams
+// a single core can transcode.
+class G711SpeedTest : public AudioCodecSpeedTest {
+ protected:
+  G711SpeedTest();
+  float EncodeABlock(int16_t* in_data,
+                     uint8_t* bit_stream,
+                     size_t max_bytes,
+                     size_t* encoded_bytes) override;
+  float DecodeABlock(const uint8_t* bit_stream,
+                     size_t encoded_bytes,
+                     int16_t* out_data) override;
+  bool a_law_ = false;
+};
+
+G711SpeedTest::G711SpeedTest()
+    : AudioCodecSpeedTest(kG711BlockDurationMs,
+                          kG711SamplingKhz,
+                          kG711SamplingKhz) {}
+
+float G711SpeedTest::EncodeABlock(int16_t* in_data,
+                                  uint8_t* bit_stream,
+                                  size_t max_bytes,
+                                  size_t* encoded_bytes) {
+  const size_t num_samples = input_length_sample_ * channels_;
+  EXPECT_LE(num_samples, max_bytes);
+  clock_t clocks = clock();
+  *encoded_bytes =
+      a_law_ ? WebRtcG711_EncodeA(in_data, num_samples, bit_stream)
+             : WebRtcG711_EncodeU(in_data, num_samples, bit_stream);
+  clocks = clock() - clocks;
+  EXPECT_EQ(num_samples, *encoded_bytes);
+  return 1000.0 * clocks / CLOCKS_PER_SEC;
+}
+
+float G711SpeedTest::DecodeABlock(const uint8_t* bit_stream,
+                                  size_t encoded_bytes,
+                                  int16_t* out_data) {
+  int16_t speech_type;
+  clock_t clocks = clock();
+  size_t value =
+      a_law_ ? WebRtcG711_DecodeA(bit_stream, encoded_bytes, out_data,
+                                  &speech_type)
+             : WebRtcG711_DecodeU(bit_stream, encoded_bytes, out_data,
+                                  &speech_type);
+  clocks = clock() - clocks;
+  EXPECT_EQ(output_length_sample_ * channels_, value);
+  return 1000.0 * clocks / CLOCKS_PER_SEC;
+}
+
+/* Test audio length in second. */
+constexpr size_t kDurationSec = 400;
+
+TEST_P(G711SpeedTest, PcmuTest) {
+  a_law_ = false;
+  EncodeDecode(kDurationSec);
+}
+
+TEST_P(G711SpeedTest, PcmaTest) {
+  a_law_ = true;
+  EncodeDecode(kDurationSec);
+}
+
+// List all test cases: (channel, bit rate, filename, extension). The input is
+// played out at 8 kHz regardless of its original rate, which does not matter
+// for the timing.
+const coding_param param_set[] = {
+    std::make_tuple(1,
+                    64000,
+                    string("audio_coding/speech_mono_16kHz"),
+                    string("pcm"),
+                    false),
+    std::make_tuple(2,
+                    128000,
+                    string("audio_coding/music_stereo_48kHz"),
+                    string("pcm"),
+                    false)};
+
+INSTANTIATE_TEST_SUITE_P(AllTest,
+                         G711SpeedTest,
+                         ::testing::ValuesIn(param_set));
+
+}  // namespace webrtc
@@ -69,6 +69,11 @@ constexpr int kOpusSupportedFrameLengths[] = {10, 20, 40, 60};
 constexpr float kAlphaForPacketLossFractionSmoother = 0.9999f;
 constexpr float kMaxPacketLossFraction = 0.2f;
 
+constexpr int kMaxComplexity = 10;
+// Length of audio over which the encode time is measured before the
+// complexity is adapted to the encode time budget.
+constexpr int kComplexityAdaptationPeriodMs = 1000;
+
 int CalculateDefaultBitrate(int max_playback_rate, size_t num_channels) {
   const int bitrate = [&] {
     if (max_playback_rate <= 8000) {
@@ -296,6 +301,26 @@ absl::optional<int> AudioEncoderOpusImpl::GetNewComplexity(
   }
 }
 
+absl::optional<int> AudioEncoderOpusImpl::GetNewComplexityCap(
+    const AudioEncoderOpusConfig& config,
+    int complexity,
+    int64_t encode_time_ns,
+    int64_t audio_duration_ns) {
+  RTC_DCHECK(config.encode_time_budget_percent);
+  RTC_DCHECK_GT(audio_duration_ns, 0);
+  const int64_t budget_ns =
+      audio_duration_ns * *config.encode_time_budget_percent / 100;
+  if (encode_time_ns > budget_ns && complexity > 0) {
+    return complexity - 1;
+  }
+  // Only step up with a wide margin, since a higher complexity is expected to
+  // take noticeably longer.
+  if (encode_time_ns < budget_ns / 2 && complexity < kMaxComplexity) {
+    return complexity + 1;
+  }
+  return absl::nullopt;
+}
+
 absl::optional<int> AudioEncoderOpusImpl::GetNewBandwidth(
     const AudioEncoderOpusConfig& config,
     OpusEncInst* inst) {
@@ -370,6 +395,7 @@ AudioEncoderOpusImpl::AudioEncoderOpusImpl(
       bitrate_multipliers_(GetBitrateMultipliers()),
       packet_loss_rate_(0.0),
       inst_(nullptr),
+      complexity_cap_(kMaxComplexity),
       packet_loss_fraction_smoother_(new PacketLossFractionSmoother()),
       audio_network_adaptor_creator_(audio_network_adaptor_creator),
       bitrate_smoother_(std::move(bitrate_smoother)),
@@ -593,6 +619,8 @@ AudioEncoder::EncodedInfo AudioEncoderOpusImpl::EncodeImpl(
                Num10msFramesPerPacket() * SamplesPer10msFrame());
 
   const size_t max_encoded_bytes = SufficientOutputBufferSize();
+  const int64_t encode_start_ns =
+      config_.encode_time_budget_percent ? rtc::TimeNanos() : 0;
   EncodedInfo info;
   info.encoded_bytes = encoded->AppendData(
       max_encoded_bytes, [&](rtc::ArrayView<uint8_t> encoded) {
@@ -607,6 +635,11 @@ AudioEncoder::EncodedInfo AudioEncoderOpusImpl::EncodeImpl(
       });
   input_buffer_.clear();
 
+  if (config_.encode_time_budget_percent) {
+    UpdateEncodeTime(rtc::TimeNanos() - encode_start_ns,
+                     config_.frame_size_ms);
+  }
+
   bool dtx_frame = (info.encoded_bytes <= 2);
 
   // Will use new packet size for next encoding.
@@ -686,7 +719,10 @@ bool AudioEncoderOpusImpl::RecreateEncoderInstance(
   // Use the default complexity if the start bitrate is within the hysteresis
   // window.
   complexity_ = GetNewComplexity(config).value_or(config.complexity);
-  RTC_CHECK_EQ(0, WebRtcOpus_SetComplexity(inst_, complexity_));
+  applied_complexity_ = std::min(complexity_, complexity_cap_);
+  RTC_CHECK_EQ(0, WebRtcOpus_SetComplexity(inst_, applied_complexity_));
+  encode_time_ns_ = 0;
+  encoded_audio_ns_ = 0;
   bitrate_changed_ = true;
   if (config.dtx_enabled) {
     RTC_CHECK_EQ(0, WebRtcOpus_EnableDtx(inst_));
@@ -755,7 +791,33 @@ void AudioEncoderOpusImpl::SetTargetBitrate(int bits_per_second) {
   const auto new_complexity = GetNewComplexity(config_);
   if (new_complexity && complexity_ != *new_complexity) {
     complexity_ = *new_complexity;
-    RTC_CHECK_EQ(0, WebRtcOpus_SetComplexity(inst_, complexity_));
+    ApplyComplexity();
+  }
+}
+
+void AudioEncoderOpusImpl::UpdateEncodeTime(int64_t encode_time_ns,
+                                            int audio_duration_ms) {
+  encode_time_ns_ += encode_time_ns;
+  encoded_audio_ns_ += audio_duration_ms * rtc::kNumNanosecsPerMillisec;
+  if (encoded_audio_ns_ <
+      kComplexityAdaptationPeriodMs * rtc::kNumNanosecsPerMillisec) {
+    return;
+  }
+  const auto new_cap = GetNewComplexityCap(config_, applied_complexity_,
+                                           encode_time_ns_, encoded_audio_ns_);
+  if (new_cap) {
+    complexity_cap_ = *new_cap;
+    ApplyComplexity();
+  }
+  encode_time_ns_ = 0;
+  encoded_audio_ns_ = 0;
+}
+
+void AudioEncoderOpusImpl::ApplyComplexity() {
+  const int complexity = std::min(complexity_, complexity_cap_);
+  if (complexity != applied_complexity_) {
+    applied_complexity_ = complexity;
+    RTC_CHECK_EQ(0, WebRtcOpus_SetComplexity(inst_, applied_complexity_));
   }
 }
 
@@ -38,6 +38,16 @@ class AudioEncoderOpusImpl final : public AudioEncoder {
   static absl::optional<int> GetNewComplexity(
       const AudioEncoderOpusConfig& config);
 
+  // Returns the new upper bound for the complexity, given that encoding at
+  // `complexity` took `encode_time_ns` for `audio_duration_ns` of audio.
+  // Returns empty if the encode time is within the budget set in `config` and
+  // there is not enough headroom to step the complexity up.
+  static absl::optional<int> GetNewComplexityCap(
+      const AudioEncoderOpusConfig& config,
+      int complexity,
+      int64_t encode_time_ns,
+      int64_t audio_duration_ns);
+
   // Returns OPUS_AUTO if the the current bitrate is above wideband threshold.
   // Returns empty if it is below, but bandwidth coincides with the desired one.
   // Otherwise returns the desired bandwidth.
@@ -152,6 +162,13 @@ class AudioEncoderOpusImpl final : public AudioEncoder {
 
   void MaybeUpdateUplinkBandwidth();
 
+  // Accumulates the time spent encoding a packet of `audio_duration_ms` and
+  // adapts `complexity_cap_` at the end of each measurement period.
+  void UpdateEncodeTime(int64_t encode_time_ns, int audio_duration_ms);
+
+  // Applies `complexity_`, limited to `complexity_cap_`, to the encoder.
+  void ApplyComplexity();
+
   AudioEncoderOpusConfig config_;
   const int payload_type_;
   const bool use_stable_target_for_adaptation_;
@@ -168,6 +185,12 @@ class AudioEncoderOpusImpl final : public AudioEncoder {
   size_t num_channels_to_encode_;
   int next_frame_length_ms_;
   int complexity_;
+  // Upper bound on the complexity, enforced when
+  // `config_.encode_time_budget_percent` is set.
+  int complexity_cap_;
+  int applied_complexity_;
+  int64_t encode_time_ns_ = 0;
+  int64_t encoded_audio_ns_ = 0;
   std::unique_ptr<PacketLossFractionSmoother> packet_loss_fraction_smoother_;
   const AudioNetworkAdaptorCreator audio_network_adaptor_creator_;
   std::unique_ptr<AudioNetworkAdaptor> audio_network_adaptor_;
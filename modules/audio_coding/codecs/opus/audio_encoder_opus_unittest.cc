@@ -406,6 +406,37 @@ TEST(AudioEncoderOpusTest, ConfigComplexityAdaptation) {
   EXPECT_EQ(6, AudioEncoderOpusImpl::GetNewComplexity(config));
 }
 
+// Verifies that the complexity follows the encode time budget.
+TEST(AudioEncoderOpusTest, EncodeTimeBudgetComplexityAdaptation) {
+  constexpr int64_t kAudioDurationNs = 1000000000;
+  AudioEncoderOpusConfig config;
+  config.encode_time_budget_percent = 10;
+  EXPECT_TRUE(config.IsOk());
+
+  // Over budget. Expect lower complexity.
+  EXPECT_EQ(8, AudioEncoderOpusImpl::GetNewComplexityCap(
+                   config, 9, kAudioDurationNs / 5, kAudioDurationNs));
+  // Within budget, but without enough headroom. Expect empty output.
+  EXPECT_EQ(absl::nullopt,
+            AudioEncoderOpusImpl::GetNewComplexityCap(
+                config, 9, kAudioDurationNs / 15, kAudioDurationNs));
+  // Well within budget. Expect higher complexity.
+  EXPECT_EQ(10, AudioEncoderOpusImpl::GetNewComplexityCap(
+                    config, 9, kAudioDurationNs / 50, kAudioDurationNs));
+  // The complexity stays within [0, 10].
+  EXPECT_EQ(absl::nullopt,
+            AudioEncoderOpusImpl::GetNewComplexityCap(
+                config, 0, kAudioDurationNs / 5, kAudioDurationNs));
+  EXPECT_EQ(absl::nullopt,
+            AudioEncoderOpusImpl::GetNewComplexityCap(
+                config, 10, kAudioDurationNs / 50, kAudioDurationNs));
+
+  config.encode_time_budget_percent = 0;
+  EXPECT_FALSE(config.IsOk());
+  config.encode_time_budget_percent = 101;
+  EXPECT_FALSE(config.IsOk());
+}
+
 // Verifies that the bandwidth adaptation in the config works as intended.
 TEST_P(AudioEncoderOpusTest, ConfigBandwidthAdaptation) {
   AudioEncoderOpusConfig config;
@@ -61,15 +61,22 @@ AudioEncoderCopyRed::AudioEncoderCopyRed(Config&& config,
 
   auto number_of_redundant_encodings =
       GetMaxRedundancyFromFieldTrial(field_trials);
-  for (size_t i = 0; i < number_of_redundant_encodings; i++) {
-    std::pair<EncodedInfo, rtc::Buffer> redundant;
+  redundant_encodings_.resize(number_of_redundant_encodings);
+  for (auto& redundant : redundant_encodings_) {
     redundant.second.EnsureCapacity(kAudioMaxRtpPacketLen);
-    redundant_encodings_.push_front(std::move(redundant));
   }
 }
 
 AudioEncoderCopyRed::~AudioEncoderCopyRed() = default;
 
+std::pair<AudioEncoder::EncodedInfoLeaf, rtc::Buffer>&
+AudioEncoderCopyRed::RedundantEncoding(size_t age) {
+  RTC_DCHECK_LT(age, redundant_encodings_.size());
+  const size_t size = redundant_encodings_.size();
+  return redundant_encodings_[(oldest_redundant_encoding_ + size - 1 - age) %
+                              size];
+}
+
 int AudioEncoderCopyRed::SampleRateHz() const {
   return speech_encoder_->SampleRateHz();
 }
@@ -118,42 +125,48 @@ AudioEncoder::EncodedInfo AudioEncoderCopyRed::EncodeImpl(
 
   size_t header_length_bytes = kRedLastHeaderLength;
   size_t bytes_available = max_packet_length_ - info.encoded_bytes;
-  auto it = redundant_encodings_.begin();
+  size_t payload_length_bytes = info.encoded_bytes;
+  size_t num_redundant = 0;
 
   // Determine how much redundancy we can fit into our packet by
   // iterating forward. This is determined both by the length as well
   // as the timestamp difference. The latter can occur with opus DTX which
   // has timestamp gaps of 400ms which exceeds REDs timestamp delta field size.
-  for (; it != redundant_encodings_.end(); it++) {
-    if (bytes_available < kRedHeaderLength + it->first.encoded_bytes) {
+  for (; num_redundant < redundant_encodings_.size(); num_redundant++) {
+    const EncodedInfoLeaf& redundant = RedundantEncoding(num_redundant).first;
+    if (bytes_available < kRedHeaderLength + redundant.encoded_bytes) {
       break;
     }
-    if (it->first.encoded_bytes == 0) {
+    if (redundant.encoded_bytes == 0) {
       break;
     }
-    if (rtp_timestamp - it->first.encoded_timestamp >= kRedMaxTimestampDelta) {
+    if (rtp_timestamp - redundant.encoded_timestamp >= kRedMaxTimestampDelta) {
       break;
     }
-    bytes_available -= kRedHeaderLength + it->first.encoded_bytes;
+    bytes_available -= kRedHeaderLength + redundant.encoded_bytes;
     header_length_bytes += kRedHeaderLength;
+    payload_length_bytes += redundant.encoded_bytes;
   }
 
-  // Allocate room for RFC 2198 header.
+  // Allocate room for RFC 2198 header and all the payloads at once, so that
+  // appending the payloads does not reallocate.
+  encoded->EnsureCapacity(header_length_bytes + payload_length_bytes);
   encoded->SetSize(header_length_bytes);
 
-  // Iterate backwards and append the data.
+  // Iterate backwards, from the oldest encoding, and append the data.
   size_t header_offset = 0;
-  while (it-- != redundant_encodings_.begin()) {
-    encoded->AppendData(it->second);
+  while (num_redundant-- > 0) {
+    const auto& redundant = RedundantEncoding(num_redundant);
+    encoded->AppendData(redundant.second);
 
     const uint32_t timestamp_delta =
-        info.encoded_timestamp - it->first.encoded_timestamp;
-    encoded->data()[header_offset] = it->first.payload_type | 0x80;
+        info.encoded_timestamp - redundant.first.encoded_timestamp;
+    encoded->data()[header_offset] = redundant.first.payload_type | 0x80;
     rtc::SetBE16(static_cast<uint8_t*>(encoded->data()) + header_offset + 1,
-                 (timestamp_delta << 2) | (it->first.encoded_bytes >> 8));
-    encoded->data()[header_offset + 3] = it->first.encoded_bytes & 0xff;
+                 (timestamp_delta << 2) | (redundant.first.encoded_bytes >> 8));
+    encoded->data()[header_offset + 3] = redundant.first.encoded_bytes & 0xff;
     header_offset += kRedHeaderLength;
-    info.redundant.push_back(it->first);
+    info.redundant.push_back(redundant.first);
   }
 
   // `info` will be implicitly cast to an EncodedInfoLeaf struct, effectively
@@ -169,17 +182,14 @@ AudioEncoder::EncodedInfo AudioEncoderCopyRed::EncodeImpl(
   RTC_DCHECK_EQ(header_offset, header_length_bytes - 1);
   encoded->data()[header_offset] = info.payload_type;
 
-  // Shift the redundant encodings.
-  auto rit = redundant_encodings_.rbegin();
-  for (auto next = std::next(rit); next != redundant_encodings_.rend();
-       rit++, next = std::next(rit)) {
-    rit->first = next->first;
-    rit->second.SetData(next->second);
-  }
-  it = redundant_encodings_.begin();
-  if (it != redundant_encodings_.end()) {
-    it->first = info;
-    it->second.SetData(primary_encoded_);
+  // Replace the oldest redundant encoding by the primary one. The buffer of
+  // the oldest encoding is reused for the next primary encoding.
+  if (!redundant_encodings_.empty()) {
+    auto& oldest = redundant_encodings_[oldest_redundant_encoding_];
+    oldest.first = info;
+    std::swap(oldest.second, primary_encoded_);
+    oldest_redundant_encoding_ =
+        (oldest_redundant_encoding_ + 1) % redundant_encodings_.size();
   }
 
   // Update main EncodedInfo.
@@ -190,13 +200,11 @@ AudioEncoder::EncodedInfo AudioEncoderCopyRed::EncodeImpl(
 
 void AudioEncoderCopyRed::Reset() {
   speech_encoder_->Reset();
-  auto number_of_redundant_encodings = redundant_encodings_.size();
-  redundant_encodings_.clear();
-  for (size_t i = 0; i < number_of_redundant_encodings; i++) {
-    std::pair<EncodedInfo, rtc::Buffer> redundant;
-    redundant.second.EnsureCapacity(kAudioMaxRtpPacketLen);
-    redundant_encodings_.push_front(std::move(redundant));
+  for (auto& redundant : redundant_encodings_) {
+    redundant.first = EncodedInfoLeaf();
+    redundant.second.Clear();
   }
+  oldest_redundant_encoding_ = 0;
 }
 
 bool AudioEncoderCopyRed::SetFec(bool enable) {
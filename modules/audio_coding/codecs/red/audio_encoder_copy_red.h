@@ -14,9 +14,9 @@
 #include <stddef.h>
 #include <stdint.h>
 
-#include <list>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "absl/types/optional.h"
 #include "api/array_view.h"
@@ -90,11 +90,19 @@ class AudioEncoderCopyRed final : public AudioEncoder {
                          rtc::Buffer* encoded) override;
 
  private:
+  // Returns the `age`-th most recent stored encoding, starting at zero.
+  std::pair<EncodedInfoLeaf, rtc::Buffer>& RedundantEncoding(size_t age);
+
   std::unique_ptr<AudioEncoder> speech_encoder_;
   rtc::Buffer primary_encoded_;
   size_t max_packet_length_;
   int red_payload_type_;
-  std::list<std::pair<EncodedInfo, rtc::Buffer>> redundant_encodings_;
+  // Ring of the most recent primary encodings. Storing a new encoding swaps
+  // its buffer with the one of the oldest encoding, which is then reused for
+  // the next primary encoding, so that no payload is copied.
+  std::vector<std::pair<EncodedInfoLeaf, rtc::Buffer>> redundant_encodings_;
+  // Index of the oldest encoding in `redundant_encodings_`.
+  size_t oldest_redundant_encoding_ = 0;
 };
 
 }  // namespace webrtc
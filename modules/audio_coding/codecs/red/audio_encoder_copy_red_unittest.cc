@@ -315,6 +315,44 @@ TEST_F(AudioEncoderCopyRedTest, CheckPayloadSizes3) {
   }
 }
 
+// Checks that Reset() drops the stored redundant encodings, also when the
+// redundancy ring has wrapped around.
+TEST_F(AudioEncoderCopyRedTest, ResetDropsRedundancy) {
+  webrtc::test::ScopedKeyValueConfig field_trials(
+      field_trials_, "WebRTC-Audio-Red-For-Opus/Enabled-2/");
+  // Recreate the RED encoder to take the new field trial setting into account.
+  AudioEncoderCopyRed::Config config;
+  config.payload_type = red_payload_type_;
+  config.speech_encoder = std::move(red_->ReclaimContainedEncoders()[0]);
+  red_.reset(new AudioEncoderCopyRed(std::move(config), field_trials));
+
+  // Let the mock encoder return payload sizes 1, 2, ..., 7 for the sequence
+  // of calls, with a reset after the fifth one.
+  static const int kNumPackets = 7;
+  static const int kNumPacketsBeforeReset = 5;
+  InSequence s;
+  for (int encode_size = 1; encode_size <= kNumPackets; ++encode_size) {
+    EXPECT_CALL(*mock_encoder_, EncodeImpl(_, _, _))
+        .WillOnce(Invoke(MockAudioEncoder::FakeEncoding(encode_size)));
+    if (encode_size == kNumPacketsBeforeReset) {
+      EXPECT_CALL(*mock_encoder_, Reset());
+    }
+  }
+  for (int i = 0; i < kNumPacketsBeforeReset; ++i) {
+    Encode();
+  }
+  red_->Reset();
+
+  Encode();
+  EXPECT_EQ(0u, encoded_info_.redundant.size());
+  EXPECT_EQ(kRedLastHeaderLength + 6u, encoded_info_.encoded_bytes);
+
+  Encode();
+  ASSERT_EQ(2u, encoded_info_.redundant.size());
+  EXPECT_EQ(6u, encoded_info_.redundant[0].encoded_bytes);
+  EXPECT_EQ(7u, encoded_info_.redundant[1].encoded_bytes);
+}
+
 // Checks that packets encoded larger than REDs 1024 maximum are returned as-is.
 TEST_F(AudioEncoderCopyRedTest, VeryLargePacket) {
   AudioEncoder::EncodedInfo info;
@@ -11,10 +11,18 @@
 #include "modules/audio_coding/neteq/audio_multi_vector.h"
 
 #include <algorithm>
+#include <memory>
 
 #include "rtc_base/checks.h"
 
 namespace webrtc {
+namespace {
+
+// Number of samples per channel that the interleaving helpers keep on the
+// stack; 60 ms at 48 kHz.
+constexpr size_t kMaxStackSamplesPerChannel = 2880;
+
+}  // namespace
 
 AudioMultiVector::AudioMultiVector(size_t N) {
   RTC_DCHECK_GT(N, 0);
@@ -77,7 +85,14 @@ void AudioMultiVector::PushBackInterleaved(
     return;
   }
   size_t length_per_channel = append_this.size() / num_channels_;
-  int16_t* temp_array = new int16_t[length_per_channel];  // Temporary storage.
+  // Temporary storage, only allocated for unusually long inputs.
+  int16_t stack_array[kMaxStackSamplesPerChannel];
+  std::unique_ptr<int16_t[]> heap_array;
+  int16_t* temp_array = stack_array;
+  if (length_per_channel > kMaxStackSamplesPerChannel) {
+    heap_array.reset(new int16_t[length_per_channel]);
+    temp_array = heap_array.get();
+  }
   for (size_t channel = 0; channel < num_channels_; ++channel) {
     // Copy elements to `temp_array`.
     for (size_t i = 0; i < length_per_channel; ++i) {
@@ -85,7 +100,6 @@ void AudioMultiVector::PushBackInterleaved(
     }
     channels_[channel]->PushBack(temp_array, length_per_channel);
   }
-  delete[] temp_array;
 }
 
 void AudioMultiVector::PushBack(const AudioMultiVector& append_this) {
@@ -131,7 +145,6 @@ size_t AudioMultiVector::ReadInterleavedFromIndex(size_t start_index,
                                                   size_t length,
                                                   int16_t* destination) const {
   RTC_DCHECK(destination);
-  size_t index = 0;  // Number of elements written to `destination` so far.
   RTC_DCHECK_LE(start_index, Size());
   start_index = std::min(start_index, Size());
   if (length + start_index > Size()) {
@@ -142,13 +155,21 @@ size_t AudioMultiVector::ReadInterleavedFromIndex(size_t start_index,
     (*this)[0].CopyTo(length, start_index, destination);
     return length;
   }
-  for (size_t i = 0; i < length; ++i) {
+  // Copy each channel in contiguous chunks, instead of indexing the ring
+  // buffers of all channels sample by sample.
+  int16_t chunk[kMaxStackSamplesPerChannel];
+  for (size_t i = 0; i < length; i += kMaxStackSamplesPerChannel) {
+    const size_t chunk_length =
+        std::min(length - i, kMaxStackSamplesPerChannel);
     for (size_t channel = 0; channel < num_channels_; ++channel) {
-      destination[index] = (*this)[channel][i + start_index];
-      ++index;
+      (*this)[channel].CopyTo(chunk_length, start_index + i, chunk);
+      int16_t* interleaved = &destination[i * num_channels_ + channel];
+      for (size_t j = 0; j < chunk_length; ++j) {
+        interleaved[j * num_channels_] = chunk[j];
+      }
     }
   }
-  return index;
+  return length * num_channels_;
 }
 
 size_t AudioMultiVector::ReadInterleavedFromEnd(size_t length,
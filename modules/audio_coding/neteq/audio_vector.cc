@@ -17,9 +17,9 @@
 
 namespace webrtc {
 
-AudioVector::AudioVector() : AudioVector(kDefaultInitialSize) {
-  Clear();
-}
+// No storage is allocated until samples are added. A capacity of one leaves
+// room for zero samples and keeps the index arithmetic valid.
+AudioVector::AudioVector() : capacity_(1), begin_index_(0), end_index_(0) {}
 
 AudioVector::AudioVector(size_t initial_size)
     : array_(new int16_t[initial_size + 1]),
@@ -46,9 +46,9 @@ void AudioVector::CopyTo(AudioVector* copy_to) const {
 void AudioVector::CopyTo(size_t length,
                          size_t position,
                          int16_t* copy_to) const {
+  length = std::min(length, Size() - position);
   if (length == 0)
     return;
-  length = std::min(length, Size() - position);
   const size_t copy_index = (begin_index_ + position) % capacity_;
   const size_t first_chunk_length = std::min(length, capacity_ - copy_index);
   memcpy(copy_to, &array_[copy_index], first_chunk_length * sizeof(int16_t));
@@ -22,7 +22,7 @@ namespace webrtc {
 
 class AudioVector {
  public:
-  // Creates an empty AudioVector.
+  // Creates an empty AudioVector, without allocating any storage.
   AudioVector();
 
   // Creates an AudioVector with an initial size.
@@ -124,8 +124,6 @@ class AudioVector {
   }
 
  private:
-  static const size_t kDefaultInitialSize = 10;
-
   // This method is used by the [] operators to calculate an index within the
   // capacity of the array, but without using the modulo operation (%).
   static inline size_t WrapIndex(size_t index,
@@ -46,6 +46,27 @@ TEST_F(AudioVectorTest, CreateAndDestroy) {
   EXPECT_EQ(initial_size, vec2.Size());
 }
 
+// Verify that an empty vector, which has no storage, can be operated on and
+// grows when samples are added.
+TEST_F(AudioVectorTest, OperateOnEmptyVector) {
+  AudioVector vec;
+  AudioVector vec_copy;
+  vec.CopyTo(&vec_copy);
+  EXPECT_TRUE(vec_copy.Empty());
+  int16_t output[1] = {17};
+  vec.CopyTo(1, 0, output);
+  EXPECT_EQ(17, output[0]);
+  vec.PopFront(1);
+  vec.PopBack(1);
+  EXPECT_TRUE(vec.Empty());
+
+  vec.PushFront(array_, array_length());
+  ASSERT_EQ(array_length(), vec.Size());
+  for (size_t i = 0; i < array_length(); ++i) {
+    EXPECT_EQ(array_[i], vec[i]);
+  }
+}
+
 // Test the subscript operator [] for getting and setting.
 TEST_F(AudioVectorTest, SubscriptOperator) {
   AudioVector vec(array_length());
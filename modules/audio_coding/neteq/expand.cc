@@ -115,14 +115,13 @@ int Expand::Process(AudioMultiVector* output) {
       parameters.expand_vector0.CopyTo(temp_length, expansion_vector_position,
                                        voiced_vector_storage);
     } else if (current_lag_index_ == 1) {
-      std::unique_ptr<int16_t[]> temp_0(new int16_t[temp_length]);
+      RTC_DCHECK_LE(temp_length, kMaxMixLength);
       parameters.expand_vector0.CopyTo(temp_length, expansion_vector_position,
-                                       temp_0.get());
-      std::unique_ptr<int16_t[]> temp_1(new int16_t[temp_length]);
+                                       mix_vector0_);
       parameters.expand_vector1.CopyTo(temp_length, expansion_vector_position,
-                                       temp_1.get());
+                                       mix_vector1_);
       // Mix 3/4 of expand_vector0 with 1/4 of expand_vector1.
-      WebRtcSpl_ScaleAndAddVectorsWithRound(temp_0.get(), 3, temp_1.get(), 1, 2,
+      WebRtcSpl_ScaleAndAddVectorsWithRound(mix_vector0_, 3, mix_vector1_, 1, 2,
                                             voiced_vector_storage, temp_length);
     } else if (current_lag_index_ == 2) {
       // Mix 1/2 of expand_vector0 with 1/2 of expand_vector1.
@@ -131,13 +130,12 @@ int Expand::Process(AudioMultiVector* output) {
       RTC_DCHECK_LE(expansion_vector_position + temp_length,
                     parameters.expand_vector1.Size());
 
-      std::unique_ptr<int16_t[]> temp_0(new int16_t[temp_length]);
+      RTC_DCHECK_LE(temp_length, kMaxMixLength);
       parameters.expand_vector0.CopyTo(temp_length, expansion_vector_position,
-                                       temp_0.get());
-      std::unique_ptr<int16_t[]> temp_1(new int16_t[temp_length]);
+                                       mix_vector0_);
       parameters.expand_vector1.CopyTo(temp_length, expansion_vector_position,
-                                       temp_1.get());
-      WebRtcSpl_ScaleAndAddVectorsWithRound(temp_0.get(), 1, temp_1.get(), 1, 1,
+                                       mix_vector1_);
+      WebRtcSpl_ScaleAndAddVectorsWithRound(mix_vector0_, 1, mix_vector1_, 1, 1,
                                             voiced_vector_storage, temp_length);
     }
 
@@ -100,6 +100,9 @@ class Expand {
   static const size_t kLpcAnalysisLength = 160;
   static const size_t kMaxSampleRate = 48000;
   static const int kNumLags = 3;
+  // Maximum length of the lag plus overlap segment mixed from the two
+  // expansion vectors.
+  static const size_t kMaxMixLength = kMaxSampleRate / 8000 * 125 + 30;
 
   struct ChannelParameters {
     ChannelParameters();
@@ -135,6 +138,9 @@ class Expand {
   bool stop_muting_;
   size_t expand_duration_samples_;
   std::unique_ptr<ChannelParameters[]> channel_parameters_;
+  // Work arrays holding the segments of the two expansion vectors to mix.
+  int16_t mix_vector0_[kMaxMixLength];
+  int16_t mix_vector1_[kMaxMixLength];
 };
 
 struct ExpandFactory {
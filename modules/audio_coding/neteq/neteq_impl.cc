@@ -129,6 +129,8 @@ NetEqImpl::NetEqImpl(const NetEq::Config& config,
       enable_fast_accelerate_(config.enable_fast_accelerate),
       nack_enabled_(false),
       enable_muted_state_(config.enable_muted_state),
+      mute_codec_internal_cng_after_ms_(
+          config.mute_codec_internal_cng_after_ms),
       expand_uma_logger_("WebRTC.Audio.ExpandRatePercent",
                          10,  // Report once every 10 s.
                          tick_timer_.get()),
@@ -786,9 +788,18 @@ int NetEqImpl::GetAudioInternal(AudioFrame* audio_frame,
           lifetime_stats.silent_concealed_samples,
       fs_hz_);
 
-  // Check for muted state.
-  if (enable_muted_state_ && expand_->Muted() && packet_buffer_->Empty()) {
-    RTC_DCHECK_EQ(last_mode_, Mode::kExpand);
+  // Check for muted state. Besides a muted expansion, a long enough period of
+  // codec-internal comfort noise is also muted, so that the decoder is not
+  // asked for more comfort noise until the next packet arrives.
+  const bool long_codec_internal_cng =
+      mute_codec_internal_cng_after_ms_ > 0 &&
+      last_mode_ == Mode::kCodecInternalCng &&
+      codec_internal_cng_samples_ >=
+          static_cast<size_t>(mute_codec_internal_cng_after_ms_ * fs_hz_ /
+                              1000);
+  if (enable_muted_state_ && (expand_->Muted() || long_codec_internal_cng) &&
+      packet_buffer_->Empty()) {
+    RTC_DCHECK(last_mode_ == Mode::kExpand || long_codec_internal_cng);
     audio_frame->Reset();
     RTC_DCHECK(audio_frame->muted());  // Reset() should mute the frame.
     playout_timestamp_ += static_cast<uint32_t>(output_size_samples_);
@@ -805,7 +816,12 @@ int NetEqImpl::GetAudioInternal(AudioFrame* audio_frame,
             : timestamp_scaler_->ToExternal(playout_timestamp_) -
                   static_cast<uint32_t>(audio_frame->samples_per_channel_);
     audio_frame->num_channels_ = sync_buffer_->Channels();
-    stats_->ExpandedNoiseSamples(output_size_samples_, false);
+    if (long_codec_internal_cng) {
+      codec_internal_cng_samples_ += output_size_samples_;
+      stats_->GeneratedNoiseSamples(output_size_samples_);
+    } else {
+      stats_->ExpandedNoiseSamples(output_size_samples_, false);
+    }
     controller_->NotifyMutedState();
     *muted = true;
     return 0;
@@ -1019,6 +1035,12 @@ int NetEqImpl::GetAudioInternal(AudioFrame* audio_frame,
     generated_noise_stopwatch_.reset();
   }
 
+  if (last_mode_ == Mode::kCodecInternalCng) {
+    codec_internal_cng_samples_ += output_size_samples_;
+  } else {
+    codec_internal_cng_samples_ = 0;
+  }
+
   if (decode_return_value)
     return decode_return_value;
   return return_value;
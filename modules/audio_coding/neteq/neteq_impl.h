@@ -391,6 +391,10 @@ class NetEqImpl : public webrtc::NetEq {
   std::unique_ptr<NackTracker> nack_ RTC_GUARDED_BY(mutex_);
   bool nack_enabled_ RTC_GUARDED_BY(mutex_);
   const bool enable_muted_state_ RTC_GUARDED_BY(mutex_);
+  const int mute_codec_internal_cng_after_ms_ RTC_GUARDED_BY(mutex_);
+  // Number of samples per channel output since the start of the current
+  // codec-internal comfort noise period.
+  size_t codec_internal_cng_samples_ RTC_GUARDED_BY(mutex_) = 0;
   AudioFrame::VADActivity last_vad_activity_ RTC_GUARDED_BY(mutex_) =
       AudioFrame::kVadPassive;
   std::unique_ptr<TickTimer::Stopwatch> generated_noise_stopwatch_
@@ -51,6 +51,7 @@ using ::testing::InSequence;
 using ::testing::Invoke;
 using ::testing::IsEmpty;
 using ::testing::IsNull;
+using ::testing::NotNull;
 using ::testing::Pointee;
 using ::testing::Return;
 using ::testing::ReturnNull;
@@ -1168,6 +1169,86 @@ TEST_F(NetEqImplTest, CodecInternalCng) {
   EXPECT_CALL(mock_decoder, Die());
 }
 
+// Verifies that a long codec-internal CNG period is muted, without asking the
+// decoder for more comfort noise, when Config::mute_codec_internal_cng_after_ms
+// is set.
+TEST_F(NetEqImplTest, MutesLongCodecInternalCng) {
+  UseNoMocks();
+  enable_muted_state_ = true;
+  constexpr int kMuteAfterMs = 100;
+  config_.mute_codec_internal_cng_after_ms = kMuteAfterMs;
+  MockAudioDecoder mock_decoder;
+  CreateInstance(
+      rtc::make_ref_counted<test::AudioDecoderProxyFactory>(&mock_decoder));
+
+  const uint8_t kPayloadType = 17;  // Just an arbitrary number.
+  const int kSampleRateKhz = 48;
+  const size_t kPayloadLengthSamples =
+      static_cast<size_t>(20 * kSampleRateKhz);  // 20 ms.
+  const size_t kPayloadLengthBytes = 10;
+  uint8_t payload[kPayloadLengthBytes] = {0};
+  int16_t dummy_output[kPayloadLengthSamples] = {0};
+
+  RTPHeader rtp_header;
+  rtp_header.payloadType = kPayloadType;
+  rtp_header.sequenceNumber = 0x1234;
+  rtp_header.timestamp = 0x12345678;
+  rtp_header.ssrc = 0x87654321;
+
+  EXPECT_CALL(mock_decoder, Reset()).WillRepeatedly(Return());
+  EXPECT_CALL(mock_decoder, SampleRateHz())
+      .WillRepeatedly(Return(kSampleRateKhz * 1000));
+  EXPECT_CALL(mock_decoder, Channels()).WillRepeatedly(Return(1));
+  EXPECT_CALL(mock_decoder, PacketDuration(_, _))
+      .WillRepeatedly(Return(rtc::checked_cast<int>(kPayloadLengthSamples)));
+  EXPECT_TRUE(neteq_->RegisterPayloadType(kPayloadType,
+                                          SdpAudioFormat("opus", 48000, 2)));
+
+  // A single DTX packet, decoded as comfort noise.
+  EXPECT_CALL(mock_decoder, DecodeInternal(NotNull(), kPayloadLengthBytes,
+                                           kSampleRateKhz * 1000, _, _))
+      .WillOnce(DoAll(SetArrayArgument<3>(dummy_output,
+                                          dummy_output + kPayloadLengthSamples),
+                      SetArgPointee<4>(AudioDecoder::kComfortNoise),
+                      Return(rtc::checked_cast<int>(kPayloadLengthSamples))));
+  EXPECT_EQ(NetEq::kOK, neteq_->InsertPacket(rtp_header, payload));
+
+  // Count the requests for more comfort noise from the decoder.
+  int num_cng_decodes = 0;
+  EXPECT_CALL(mock_decoder,
+              DecodeInternal(IsNull(), 0, kSampleRateKhz * 1000, _, _))
+      .WillRepeatedly(DoAll(
+          [&num_cng_decodes] { ++num_cng_decodes; },
+          SetArrayArgument<3>(dummy_output,
+                              dummy_output + kPayloadLengthSamples),
+          SetArgPointee<4>(AudioDecoder::kComfortNoise),
+          Return(rtc::checked_cast<int>(kPayloadLengthSamples))));
+
+  AudioFrame output;
+  bool muted = false;
+  constexpr int kNumFrames = 50;  // 500 ms.
+  for (int i = 0; i < kNumFrames; ++i) {
+    EXPECT_EQ(NetEq::kOK, neteq_->GetAudio(&output, &muted));
+  }
+  EXPECT_TRUE(muted);
+  // At most one decoder call per 10 ms frame before the mute.
+  EXPECT_GT(num_cng_decodes, 0);
+  EXPECT_LE(num_cng_decodes, kMuteAfterMs / 10);
+
+  // The next packet ends the muted period, and the decoder is asked for
+  // comfort noise again until it is time to decode the packet.
+  rtp_header.sequenceNumber += 1;
+  rtp_header.timestamp += kNumFrames * 10 * kSampleRateKhz;
+  EXPECT_EQ(NetEq::kOK, neteq_->InsertPacket(rtp_header, payload));
+  const int num_cng_decodes_before_packet = num_cng_decodes;
+  EXPECT_EQ(NetEq::kOK, neteq_->GetAudio(&output, &muted));
+  EXPECT_FALSE(muted);
+  EXPECT_EQ(AudioFrame::kCNG, output.speech_type_);
+  EXPECT_GT(num_cng_decodes, num_cng_decodes_before_packet);
+
+  EXPECT_CALL(mock_decoder, Die());
+}
+
 TEST_F(NetEqImplTest, UnsupportedDecoder) {
   UseNoMocks();
   ::testing::NiceMock<MockAudioDecoder> decoder;
@@ -9,13 +9,12 @@
  */
 
 // This is the implementation of the PacketBuffer class. It is mostly based on
-// an STL list. The list is kept sorted at all times so that the next packet to
-// decode is at the beginning of the list.
+// an STL deque. The deque is kept sorted at all times so that the next packet
+// to decode is at the beginning of the deque.
 
 #include "modules/audio_coding/neteq/packet_buffer.h"
 
 #include <algorithm>
-#include <list>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -32,7 +31,7 @@
 
 namespace webrtc {
 namespace {
-// Predicate used when inserting packets in the buffer list.
+// Predicate used when inserting packets in the buffer.
 // Operator() returns true when `packet` goes before `new_packet`.
 class NewTimestampIsLarger {
  public:
@@ -178,14 +177,14 @@ int PacketBuffer::InsertPacket(Packet&& packet,
   }
 
   // Get an iterator pointing to the place in the buffer where the new packet
-  // should be inserted. The list is searched from the back, since the most
-  // likely case is that the new packet should be near the end of the list.
-  PacketList::reverse_iterator rit = std::find_if(
+  // should be inserted. The buffer is searched from the back, since the most
+  // likely case is that the new packet should be near the end of the buffer.
+  auto rit = std::find_if(
       buffer_.rbegin(), buffer_.rend(), NewTimestampIsLarger(packet));
 
   // The new packet is to be inserted to the right of `rit`. If it has the same
   // timestamp as `rit`, which has a higher priority, do not insert the new
-  // packet to list.
+  // packet to the buffer.
   if (rit != buffer_.rend() && packet.timestamp == rit->timestamp) {
     LogPacketDiscarded(packet.priority.codec_level, stats);
     return return_val;
@@ -194,7 +193,7 @@ int PacketBuffer::InsertPacket(Packet&& packet,
   // The new packet is to be inserted to the left of `it`. If it has the same
   // timestamp as `it`, which has a lower priority, replace `it` with the new
   // packet.
-  PacketList::iterator it = rit.base();
+  auto it = rit.base();
   if (it != buffer_.end() && packet.timestamp == it->timestamp) {
     LogPacketDiscarded(it->priority.codec_level, stats);
     it = buffer_.erase(it);
@@ -274,11 +273,10 @@ int PacketBuffer::NextHigherTimestamp(uint32_t timestamp,
   if (!next_timestamp) {
     return kInvalidPointer;
   }
-  PacketList::const_iterator it;
-  for (it = buffer_.begin(); it != buffer_.end(); ++it) {
-    if (it->timestamp >= timestamp) {
+  for (const Packet& packet : buffer_) {
+    if (packet.timestamp >= timestamp) {
       // Found a packet matching the search.
-      *next_timestamp = it->timestamp;
+      *next_timestamp = packet.timestamp;
       return kOK;
     }
   }
@@ -318,14 +316,17 @@ int PacketBuffer::DiscardNextPacket(StatisticsCalculator* stats) {
 void PacketBuffer::DiscardOldPackets(uint32_t timestamp_limit,
                                      uint32_t horizon_samples,
                                      StatisticsCalculator* stats) {
-  buffer_.remove_if([timestamp_limit, horizon_samples, stats](const Packet& p) {
+  auto is_obsolete = [timestamp_limit, horizon_samples,
+                      stats](const Packet& p) {
     if (timestamp_limit == p.timestamp ||
         !IsObsoleteTimestamp(p.timestamp, timestamp_limit, horizon_samples)) {
       return false;
     }
     LogPacketDiscarded(p.priority.codec_level, stats);
     return true;
-  });
+  };
+  buffer_.erase(std::remove_if(buffer_.begin(), buffer_.end(), is_obsolete),
+                buffer_.end());
 }
 
 void PacketBuffer::DiscardAllOldPackets(uint32_t timestamp_limit,
@@ -335,13 +336,16 @@ void PacketBuffer::DiscardAllOldPackets(uint32_t timestamp_limit,
 
 void PacketBuffer::DiscardPacketsWithPayloadType(uint8_t payload_type,
                                                  StatisticsCalculator* stats) {
-  buffer_.remove_if([payload_type, stats](const Packet& p) {
+  auto has_payload_type = [payload_type, stats](const Packet& p) {
     if (p.payload_type != payload_type) {
       return false;
     }
     LogPacketDiscarded(p.priority.codec_level, stats);
     return true;
-  });
+  };
+  buffer_.erase(
+      std::remove_if(buffer_.begin(), buffer_.end(), has_payload_type),
+      buffer_.end());
 }
 
 size_t PacketBuffer::NumPacketsInBuffer() const {
@@ -11,6 +11,8 @@
 #ifndef MODULES_AUDIO_CODING_NETEQ_PACKET_BUFFER_H_
 #define MODULES_AUDIO_CODING_NETEQ_PACKET_BUFFER_H_
 
+#include <deque>
+
 #include "absl/types/optional.h"
 #include "modules/audio_coding/neteq/decoder_database.h"
 #include "modules/audio_coding/neteq/packet.h"
@@ -173,7 +175,10 @@ class PacketBuffer {
  private:
   absl::optional<SmartFlushingConfig> smart_flushing_config_;
   size_t max_number_of_packets_;
-  PacketList buffer_;
+  // Sorted so that the next packet to decode is at the front. A deque is used
+  // rather than a `PacketList` since packets are mostly inserted at the back
+  // and removed from the front, and the storage is allocated in blocks.
+  std::deque<Packet> buffer_;
   const TickTimer* tick_timer_;
 };
 
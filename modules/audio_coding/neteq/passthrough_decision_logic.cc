@@ -0,0 +1,230 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_coding/neteq/passthrough_decision_logic.h"
+
+#include <algorithm>
+
+#include "modules/audio_coding/neteq/packet_buffer.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/numerics/safe_conversions.h"
+
+namespace webrtc {
+
+namespace {
+
+// The buffer is accelerated once it exceeds the target level by this margin,
+// which is larger than the granularity of a single accelerate operation.
+constexpr int kAccelerateMarginMs = 40;
+constexpr int kMaxBaseMinimumDelayMs = 10000;
+constexpr int kReinitAfterExpandsMs = 1000;
+// The value 5 sets maximum time-stretch rate to about 100 ms/s.
+constexpr int kMinTimescaleInterval = 5;
+
+bool IsTimestretch(NetEq::Mode mode) {
+  return mode == NetEq::Mode::kAccelerateSuccess ||
+         mode == NetEq::Mode::kAccelerateLowEnergy ||
+         mode == NetEq::Mode::kPreemptiveExpandSuccess ||
+         mode == NetEq::Mode::kPreemptiveExpandLowEnergy;
+}
+
+bool IsCng(NetEq::Mode mode) {
+  return mode == NetEq::Mode::kRfc3389Cng ||
+         mode == NetEq::Mode::kCodecInternalCng;
+}
+
+bool IsExpand(NetEq::Mode mode) {
+  return mode == NetEq::Mode::kExpand || mode == NetEq::Mode::kCodecPlc;
+}
+
+}  // namespace
+
+PassthroughDecisionLogic::PassthroughDecisionLogic(
+    NetEqController::Config config)
+    : tick_timer_(config.tick_timer),
+      disallow_time_stretching_(!config.allow_time_stretching),
+      base_minimum_delay_ms_(config.base_min_delay_ms),
+      timescale_countdown_(
+          tick_timer_->GetNewCountdown(kMinTimescaleInterval + 1)) {}
+
+PassthroughDecisionLogic::~PassthroughDecisionLogic() = default;
+
+void PassthroughDecisionLogic::SoftReset() {
+  packet_length_samples_ = 0;
+  buffer_level_samples_ = 0;
+  timescale_countdown_ =
+      tick_timer_->GetNewCountdown(kMinTimescaleInterval + 1);
+}
+
+void PassthroughDecisionLogic::SetSampleRate(int fs_hz,
+                                             size_t output_size_samples) {
+  RTC_DCHECK(fs_hz == 8000 || fs_hz == 16000 || fs_hz == 32000 ||
+             fs_hz == 48000);
+  sample_rate_khz_ = fs_hz / 1000;
+}
+
+NetEq::Operation PassthroughDecisionLogic::GetDecision(
+    const NetEqStatus& status,
+    bool* reset_decoder) {
+  if (IsTimestretch(status.last_mode)) {
+    timescale_countdown_ = tick_timer_->GetNewCountdown(kMinTimescaleInterval);
+  }
+  buffer_level_samples_ =
+      rtc::saturated_cast<int>(status.packet_buffer_info.span_samples);
+
+  // Guard for errors, to avoid getting stuck in error mode.
+  if (status.last_mode == NetEq::Mode::kError) {
+    return status.next_packet ? NetEq::Operation::kUndefined
+                              : NetEq::Operation::kExpand;
+  }
+
+  if (!status.next_packet) {
+    return NoPacket(status);
+  }
+
+  if (status.next_packet->is_cng) {
+    const int32_t timestamp_diff = static_cast<int32_t>(
+        static_cast<uint32_t>(status.generated_noise_samples +
+                              status.target_timestamp) -
+        status.next_packet->timestamp);
+    if (timestamp_diff < 0 && status.last_mode == NetEq::Mode::kRfc3389Cng) {
+      return NetEq::Operation::kRfc3389CngNoPacket;
+    }
+    return NetEq::Operation::kRfc3389Cng;
+  }
+
+  // If the expand period was very long, reset NetEQ since it is likely that the
+  // sender was restarted.
+  if (IsExpand(status.last_mode) &&
+      status.generated_noise_samples >
+          static_cast<size_t>(kReinitAfterExpandsMs * sample_rate_khz_)) {
+    *reset_decoder = true;
+    return NetEq::Operation::kNormal;
+  }
+
+  if (status.target_timestamp == status.next_packet->timestamp) {
+    return ExpectedPacketAvailable(status);
+  }
+  const uint32_t five_seconds_samples =
+      static_cast<uint32_t>(5000 * sample_rate_khz_);
+  if (!PacketBuffer::IsObsoleteTimestamp(status.next_packet->timestamp,
+                                         status.target_timestamp,
+                                         five_seconds_samples)) {
+    return FuturePacketAvailable(status);
+  }
+  // The available packet is older than the target timestamp, which can happen
+  // when a new stream or codec is received. Signal for a reset.
+  return NetEq::Operation::kUndefined;
+}
+
+int PassthroughDecisionLogic::TargetLevelMs() const {
+  int target_level_ms = UnlimitedTargetLevelMs();
+  if (maximum_delay_ms_ > 0) {
+    target_level_ms = std::min(target_level_ms, maximum_delay_ms_);
+  }
+  return std::max(target_level_ms,
+                  static_cast<int>(packet_length_samples_ / sample_rate_khz_));
+}
+
+int PassthroughDecisionLogic::UnlimitedTargetLevelMs() const {
+  return std::max({kDefaultTargetLevelMs, minimum_delay_ms_,
+                   base_minimum_delay_ms_});
+}
+
+absl::optional<int> PassthroughDecisionLogic::PacketArrived(
+    int fs_hz,
+    bool should_update_stats,
+    const PacketArrivedInfo& info) {
+  if (should_update_stats && !info.is_cng_or_dtmf &&
+      info.packet_length_samples > 0) {
+    packet_length_samples_ = info.packet_length_samples;
+  }
+  // No arrival statistics are kept.
+  return absl::nullopt;
+}
+
+bool PassthroughDecisionLogic::SetMaximumDelay(int delay_ms) {
+  // Zero unsets the maximum delay.
+  if (delay_ms != 0 && delay_ms < minimum_delay_ms_) {
+    return false;
+  }
+  maximum_delay_ms_ = delay_ms;
+  return true;
+}
+
+bool PassthroughDecisionLogic::SetMinimumDelay(int delay_ms) {
+  if (delay_ms < 0 || (maximum_delay_ms_ > 0 && delay_ms > maximum_delay_ms_)) {
+    return false;
+  }
+  minimum_delay_ms_ = delay_ms;
+  return true;
+}
+
+bool PassthroughDecisionLogic::SetBaseMinimumDelay(int delay_ms) {
+  if (delay_ms < 0 || delay_ms > kMaxBaseMinimumDelayMs) {
+    return false;
+  }
+  base_minimum_delay_ms_ = delay_ms;
+  return true;
+}
+
+NetEq::Operation PassthroughDecisionLogic::NoPacket(
+    const NetEqController::NetEqStatus& status) const {
+  switch (status.last_mode) {
+    case NetEq::Mode::kRfc3389Cng:
+      return NetEq::Operation::kRfc3389CngNoPacket;
+    case NetEq::Mode::kCodecInternalCng:
+      return NetEq::Operation::kCodecInternalCng;
+    default:
+      return status.play_dtmf ? NetEq::Operation::kDtmf
+                              : NetEq::Operation::kExpand;
+  }
+}
+
+NetEq::Operation PassthroughDecisionLogic::ExpectedPacketAvailable(
+    const NetEqController::NetEqStatus& status) const {
+  if (disallow_time_stretching_ || status.last_mode == NetEq::Mode::kExpand ||
+      status.play_dtmf) {
+    return NetEq::Operation::kNormal;
+  }
+  const int high_limit_samples =
+      (TargetLevelMs() + kAccelerateMarginMs) * sample_rate_khz_;
+  if (buffer_level_samples_ >= 4 * high_limit_samples) {
+    return NetEq::Operation::kFastAccelerate;
+  }
+  if (buffer_level_samples_ >= high_limit_samples &&
+      timescale_countdown_->Finished()) {
+    return NetEq::Operation::kAccelerate;
+  }
+  return NetEq::Operation::kNormal;
+}
+
+NetEq::Operation PassthroughDecisionLogic::FuturePacketAvailable(
+    const NetEqController::NetEqStatus& status) const {
+  // Keep generating comfort noise until it covers the gap to the next packet.
+  if (IsCng(status.last_mode) &&
+      status.next_packet->timestamp - status.target_timestamp >
+          status.generated_noise_samples) {
+    return NoPacket(status);
+  }
+  switch (status.last_mode) {
+    case NetEq::Mode::kExpand:
+      return NetEq::Operation::kMerge;
+    case NetEq::Mode::kCodecPlc:
+    case NetEq::Mode::kRfc3389Cng:
+    case NetEq::Mode::kCodecInternalCng:
+      return NetEq::Operation::kNormal;
+    default:
+      return status.play_dtmf ? NetEq::Operation::kDtmf
+                              : NetEq::Operation::kExpand;
+  }
+}
+
+}  // namespace webrtc
@@ -0,0 +1,97 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_AUDIO_CODING_NETEQ_PASSTHROUGH_DECISION_LOGIC_H_
+#define MODULES_AUDIO_CODING_NETEQ_PASSTHROUGH_DECISION_LOGIC_H_
+
+#include <memory>
+
+#include "api/neteq/neteq.h"
+#include "api/neteq/neteq_controller.h"
+#include "api/neteq/tick_timer.h"
+
+namespace webrtc {
+
+// Minimal decision logic for links with negligible jitter. Unlike
+// DecisionLogic, it does not estimate the arrival delay distribution nor filter
+// the buffer level: packets are played out as soon as they are due, against a
+// fixed target delay, and the buffer is only accelerated when it has grown well
+// beyond that target.
+class PassthroughDecisionLogic : public NetEqController {
+ public:
+  // Target delay used when no minimum delay is set.
+  static constexpr int kDefaultTargetLevelMs = 20;
+
+  explicit PassthroughDecisionLogic(NetEqController::Config config);
+  ~PassthroughDecisionLogic() override;
+
+  PassthroughDecisionLogic(const PassthroughDecisionLogic&) = delete;
+  PassthroughDecisionLogic& operator=(const PassthroughDecisionLogic&) = delete;
+
+  void Reset() override {}
+  void SoftReset() override;
+  void SetSampleRate(int fs_hz, size_t output_size_samples) override;
+  NetEq::Operation GetDecision(const NetEqController::NetEqStatus& status,
+                               bool* reset_decoder) override;
+  void ExpandDecision(NetEq::Operation operation) override {}
+  void AddSampleMemory(int32_t value) override {}
+  int TargetLevelMs() const override;
+  int UnlimitedTargetLevelMs() const override;
+  absl::optional<int> PacketArrived(int fs_hz,
+                                    bool should_update_stats,
+                                    const PacketArrivedInfo& info) override;
+  void RegisterEmptyPacket() override {}
+  bool SetMaximumDelay(int delay_ms) override;
+  bool SetMinimumDelay(int delay_ms) override;
+  bool SetBaseMinimumDelay(int delay_ms) override;
+  int GetBaseMinimumDelay() const override { return base_minimum_delay_ms_; }
+  bool PeakFound() const override { return false; }
+
+  // Returns the unfiltered span of the packet buffer, as of the last decision.
+  int GetFilteredBufferLevel() const override { return buffer_level_samples_; }
+
+  // Accessors and mutators.
+  void set_sample_memory(int32_t value) override {}
+  size_t noise_fast_forward() const override { return 0; }
+  size_t packet_length_samples() const override {
+    return packet_length_samples_;
+  }
+  void set_packet_length_samples(size_t value) override {
+    packet_length_samples_ = value;
+  }
+  void set_prev_time_scale(bool value) override {}
+
+ private:
+  // Returns the operation given that no packets are available (except maybe
+  // a DTMF event, flagged by setting `play_dtmf` true).
+  NetEq::Operation NoPacket(const NetEqController::NetEqStatus& status) const;
+
+  // Returns the operation to do given that the expected packet is available.
+  NetEq::Operation ExpectedPacketAvailable(
+      const NetEqController::NetEqStatus& status) const;
+
+  // Returns the operation to do given that the expected packet is not
+  // available, but a packet further into the future is at hand.
+  NetEq::Operation FuturePacketAvailable(
+      const NetEqController::NetEqStatus& status) const;
+
+  const TickTimer* tick_timer_;
+  const bool disallow_time_stretching_;
+  int sample_rate_khz_ = 8;
+  size_t packet_length_samples_ = 0;
+  int buffer_level_samples_ = 0;
+  int minimum_delay_ms_ = 0;
+  int base_minimum_delay_ms_;
+  int maximum_delay_ms_ = 0;
+  std::unique_ptr<TickTimer::Countdown> timescale_countdown_;
+};
+
+}  // namespace webrtc
+#endif  // MODULES_AUDIO_CODING_NETEQ_PASSTHROUGH_DECISION_LOGIC_H_
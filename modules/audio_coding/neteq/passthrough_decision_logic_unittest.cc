@@ -0,0 +1,158 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_coding/neteq/passthrough_decision_logic.h"
+
+#include "api/neteq/neteq_controller.h"
+#include "api/neteq/tick_timer.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+
+namespace {
+
+constexpr int kSampleRate = 8000;
+constexpr int kSamplesPerMs = kSampleRate / 1000;
+constexpr int kOutputSizeSamples = kSamplesPerMs * 10;
+constexpr int kMinTimescaleInterval = 5;
+
+NetEqController::NetEqStatus CreateNetEqStatus(NetEq::Mode last_mode,
+                                               int current_delay_ms) {
+  NetEqController::NetEqStatus status;
+  status.play_dtmf = false;
+  status.last_mode = last_mode;
+  status.target_timestamp = 1234;
+  status.generated_noise_samples = 0;
+  status.expand_mutefactor = 0;
+  status.packet_buffer_info.num_samples = current_delay_ms * kSamplesPerMs;
+  status.packet_buffer_info.span_samples = current_delay_ms * kSamplesPerMs;
+  status.packet_buffer_info.span_samples_wait_time =
+      current_delay_ms * kSamplesPerMs;
+  status.packet_buffer_info.dtx_or_cng = false;
+  status.next_packet = {status.target_timestamp, false, false};
+  return status;
+}
+
+}  // namespace
+
+class PassthroughDecisionLogicTest : public ::testing::Test {
+ protected:
+  PassthroughDecisionLogicTest() {
+    NetEqController::Config config;
+    config.tick_timer = &tick_timer_;
+    config.allow_time_stretching = true;
+    config.base_min_delay_ms = 0;
+    decision_logic_ = std::make_unique<PassthroughDecisionLogic>(config);
+    decision_logic_->SetSampleRate(kSampleRate, kOutputSizeSamples);
+  }
+
+  TickTimer tick_timer_;
+  std::unique_ptr<PassthroughDecisionLogic> decision_logic_;
+};
+
+TEST_F(PassthroughDecisionLogicTest, NormalOperation) {
+  bool reset_decoder = false;
+  tick_timer_.Increment(kMinTimescaleInterval + 1);
+  EXPECT_EQ(decision_logic_->GetDecision(
+                CreateNetEqStatus(NetEq::Mode::kNormal, 40), &reset_decoder),
+            NetEq::Operation::kNormal);
+  EXPECT_FALSE(reset_decoder);
+  EXPECT_EQ(decision_logic_->GetFilteredBufferLevel(), 40 * kSamplesPerMs);
+}
+
+TEST_F(PassthroughDecisionLogicTest, Accelerate) {
+  bool reset_decoder = false;
+  tick_timer_.Increment(kMinTimescaleInterval + 1);
+  EXPECT_EQ(decision_logic_->GetDecision(
+                CreateNetEqStatus(NetEq::Mode::kNormal, 100), &reset_decoder),
+            NetEq::Operation::kAccelerate);
+  EXPECT_EQ(decision_logic_->GetDecision(
+                CreateNetEqStatus(NetEq::Mode::kNormal, 400), &reset_decoder),
+            NetEq::Operation::kFastAccelerate);
+  EXPECT_FALSE(reset_decoder);
+}
+
+TEST_F(PassthroughDecisionLogicTest, NoAccelerateRightAfterTimeStretch) {
+  bool reset_decoder = false;
+  tick_timer_.Increment(kMinTimescaleInterval + 1);
+  EXPECT_EQ(decision_logic_->GetDecision(
+                CreateNetEqStatus(NetEq::Mode::kAccelerateSuccess, 100),
+                &reset_decoder),
+            NetEq::Operation::kNormal);
+  tick_timer_.Increment(kMinTimescaleInterval);
+  EXPECT_EQ(decision_logic_->GetDecision(
+                CreateNetEqStatus(NetEq::Mode::kNormal, 100), &reset_decoder),
+            NetEq::Operation::kAccelerate);
+}
+
+TEST_F(PassthroughDecisionLogicTest, ExpandAndMerge) {
+  bool reset_decoder = false;
+  NetEqController::NetEqStatus status =
+      CreateNetEqStatus(NetEq::Mode::kNormal, 0);
+  status.next_packet = absl::nullopt;
+  EXPECT_EQ(decision_logic_->GetDecision(status, &reset_decoder),
+            NetEq::Operation::kExpand);
+
+  status = CreateNetEqStatus(NetEq::Mode::kExpand, 20);
+  status.next_packet->timestamp += 10 * kSamplesPerMs;
+  EXPECT_EQ(decision_logic_->GetDecision(status, &reset_decoder),
+            NetEq::Operation::kMerge);
+  EXPECT_FALSE(reset_decoder);
+}
+
+TEST_F(PassthroughDecisionLogicTest, ResetAfterLongExpand) {
+  bool reset_decoder = false;
+  NetEqController::NetEqStatus status =
+      CreateNetEqStatus(NetEq::Mode::kExpand, 20);
+  status.generated_noise_samples = 2000 * kSamplesPerMs;
+  EXPECT_EQ(decision_logic_->GetDecision(status, &reset_decoder),
+            NetEq::Operation::kNormal);
+  EXPECT_TRUE(reset_decoder);
+}
+
+TEST_F(PassthroughDecisionLogicTest, CngContinuesUntilNextPacketIsDue) {
+  bool reset_decoder = false;
+  NetEqController::NetEqStatus status =
+      CreateNetEqStatus(NetEq::Mode::kCodecInternalCng, 20);
+  status.next_packet->timestamp += 100 * kSamplesPerMs;
+  status.generated_noise_samples = 50 * kSamplesPerMs;
+  EXPECT_EQ(decision_logic_->GetDecision(status, &reset_decoder),
+            NetEq::Operation::kCodecInternalCng);
+  status.generated_noise_samples = 100 * kSamplesPerMs;
+  EXPECT_EQ(decision_logic_->GetDecision(status, &reset_decoder),
+            NetEq::Operation::kNormal);
+}
+
+TEST_F(PassthroughDecisionLogicTest, TargetLevel) {
+  EXPECT_EQ(decision_logic_->TargetLevelMs(),
+            PassthroughDecisionLogic::kDefaultTargetLevelMs);
+  EXPECT_TRUE(decision_logic_->SetMinimumDelay(100));
+  EXPECT_EQ(decision_logic_->TargetLevelMs(), 100);
+  EXPECT_FALSE(decision_logic_->SetMaximumDelay(50));
+  EXPECT_TRUE(decision_logic_->SetMinimumDelay(0));
+  EXPECT_TRUE(decision_logic_->SetMaximumDelay(10));
+  EXPECT_EQ(decision_logic_->TargetLevelMs(), 10);
+
+  // The target level is never below the packet length.
+  NetEqController::PacketArrivedInfo info;
+  info.packet_length_samples = 60 * kSamplesPerMs;
+  info.main_timestamp = 0;
+  info.main_sequence_number = 0;
+  info.is_cng_or_dtmf = false;
+  info.is_dtx = false;
+  info.buffer_flush = false;
+  EXPECT_FALSE(decision_logic_
+                   ->PacketArrived(kSampleRate, /*should_update_stats=*/true,
+                                   info)
+                   .has_value());
+  EXPECT_EQ(decision_logic_->TargetLevelMs(), 60);
+}
+
+}  // namespace webrtc
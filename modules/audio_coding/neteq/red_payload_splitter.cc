@@ -13,6 +13,7 @@
 #include <stddef.h>
 
 #include <cstdint>
+#include <cstring>
 #include <list>
 #include <utility>
 #include <vector>
@@ -131,7 +132,16 @@ bool RedPayloadSplitter::SplitRed(PacketList* packet_list) {
         new_packet.sequence_number = red_packet.sequence_number;
         new_packet.priority.red_level =
             rtc::dchecked_cast<int>((new_headers.size() - 1) - i);
-        new_packet.payload.SetData(payload_ptr, payload_length);
+        if (i + 1 == new_headers.size()) {
+          // The last block ends the RED payload, which is discarded after the
+          // split. Move the block to the front of the RED payload buffer and
+          // hand the buffer over, instead of allocating a new one.
+          std::memmove(red_packet.payload.data(), payload_ptr, payload_length);
+          red_packet.payload.SetSize(payload_length);
+          new_packet.payload = std::move(red_packet.payload);
+        } else {
+          new_packet.payload.SetData(payload_ptr, payload_length);
+        }
         new_packets.push_front(std::move(new_packet));
         payload_ptr += payload_length;
       }
@@ -61,6 +61,8 @@ AudioDeviceBuffer::AudioDeviceBuffer(TaskQueueFactory* task_queue_factory,
       rec_stat_count_(0),
       play_stat_count_(0),
       play_start_time_(0),
+      last_play_callback_time_us_(-1),
+      last_rec_callback_time_us_(-1),
       only_silence_recorded_(true),
       log_stats_(false) {
   RTC_LOG(LS_INFO) << "AudioDeviceBuffer::ctor";
@@ -112,6 +114,9 @@ void AudioDeviceBuffer::StartPlayout() {
   // Clear members that are only touched on the main (creating) thread.
   play_start_time_ = now_time;
   playing_ = true;
+  // The native audio playout has not started yet, hence it is safe to modify
+  // this member here.
+  last_play_callback_time_us_ = -1;
 }
 
 void AudioDeviceBuffer::StartRecording() {
@@ -134,6 +139,7 @@ void AudioDeviceBuffer::StartRecording() {
   // It is safe to do so since we know by design that the owning ADM has not
   // yet started the native audio recording.
   only_silence_recorded_ = true;
+  last_rec_callback_time_us_ = -1;
 }
 
 void AudioDeviceBuffer::StopPlayout() {
@@ -250,7 +256,28 @@ int32_t AudioDeviceBuffer::SetRecordedBuffer(
   if (old_size != rec_buffer_.size()) {
     RTC_LOG(LS_INFO) << "Size of recording buffer: " << rec_buffer_.size();
   }
+  rec_data_ = rec_buffer_;
+  OnRecordedData(samples_per_channel, capture_timestamp_ns);
+  return 0;
+}
+
+int32_t AudioDeviceBuffer::SetRecordedBufferNoCopy(
+    const int16_t* audio_buffer,
+    size_t samples_per_channel,
+    absl::optional<int64_t> capture_timestamp_ns) {
+  const size_t old_size = rec_data_.size();
+  rec_data_ = rtc::ArrayView<const int16_t>(
+      audio_buffer, rec_channels_ * samples_per_channel);
+  if (old_size != rec_data_.size()) {
+    RTC_LOG(LS_INFO) << "Size of recording buffer: " << rec_data_.size();
+  }
+  OnRecordedData(samples_per_channel, capture_timestamp_ns);
+  return 0;
+}
 
+void AudioDeviceBuffer::OnRecordedData(
+    size_t samples_per_channel,
+    absl::optional<int64_t> capture_timestamp_ns) {
   if (capture_timestamp_ns) {
     int64_t align_offsync_estimation_time = rtc::TimeMicros();
     if (align_offsync_estimation_time -
@@ -280,7 +307,7 @@ int32_t AudioDeviceBuffer::SetRecordedBuffer(
   RTC_DCHECK_LT(rec_stat_count_, 50);
   if (++rec_stat_count_ >= 50) {
     // Returns the largest absolute value in a signed 16-bit vector.
-    max_abs = WebRtcSpl_MaxAbsValueW16(rec_buffer_.data(), rec_buffer_.size());
+    max_abs = WebRtcSpl_MaxAbsValueW16(rec_data_.data(), rec_data_.size());
     rec_stat_count_ = 0;
     // Set `only_silence_recorded_` to false as soon as at least one detection
     // of a non-zero audio packet is found. It can only be restored to true
@@ -292,7 +319,6 @@ int32_t AudioDeviceBuffer::SetRecordedBuffer(
   // Update recording stats which is used as base for periodic logging of the
   // audio input state.
   UpdateRecStats(max_abs, samples_per_channel);
-  return 0;
 }
 
 int32_t AudioDeviceBuffer::DeliverRecordedData() {
@@ -300,17 +326,19 @@ int32_t AudioDeviceBuffer::DeliverRecordedData() {
     RTC_LOG(LS_WARNING) << "Invalid audio transport";
     return 0;
   }
-  const size_t frames = rec_buffer_.size() / rec_channels_;
+  const size_t frames = rec_data_.size() / rec_channels_;
   const size_t bytes_per_frame = rec_channels_ * sizeof(int16_t);
   uint32_t new_mic_level_dummy = 0;
   uint32_t total_delay_ms = play_delay_ms_ + rec_delay_ms_;
+  const int64_t start_time_us = rtc::TimeMicros();
   int32_t res = audio_transport_cb_->RecordedDataIsAvailable(
-      rec_buffer_.data(), frames, bytes_per_frame, rec_channels_,
+      rec_data_.data(), frames, bytes_per_frame, rec_channels_,
       rec_sample_rate_, total_delay_ms, 0, 0, typing_status_,
       new_mic_level_dummy, capture_timestamp_ns_);
   if (res == -1) {
     RTC_LOG(LS_ERROR) << "RecordedDataIsAvailable() failed";
   }
+  UpdateRecCallbackStats(start_time_us, rtc::TimeMicros());
   return 0;
 }
 
@@ -326,7 +354,27 @@ int32_t AudioDeviceBuffer::RequestPlayoutData(size_t samples_per_channel) {
     play_buffer_.SetSize(total_samples);
     RTC_LOG(LS_INFO) << "Size of playout buffer: " << play_buffer_.size();
   }
+  return RequestPlayoutDataInternal(samples_per_channel, play_buffer_.data());
+}
 
+int32_t AudioDeviceBuffer::RequestAndGetPlayoutData(size_t samples_per_channel,
+                                                    int16_t* audio_buffer) {
+  TRACE_EVENT1("webrtc", "AudioDeviceBuffer::RequestAndGetPlayoutData",
+               "samples_per_channel", samples_per_channel);
+#ifdef AUDIO_DEVICE_PLAYS_SINUS_TONE
+  // Let GetPlayoutData() replace the decoded audio with the test tone.
+  int32_t frames = RequestPlayoutData(samples_per_channel);
+  if (frames > 0)
+    frames = GetPlayoutData(audio_buffer);
+  return frames;
+#else
+  return RequestPlayoutDataInternal(samples_per_channel, audio_buffer);
+#endif
+}
+
+int32_t AudioDeviceBuffer::RequestPlayoutDataInternal(
+    size_t samples_per_channel,
+    int16_t* destination) {
   size_t num_samples_out(0);
   // It is currently supported to start playout without a valid audio
   // transport object. Leads to warning and silence.
@@ -339,20 +387,23 @@ int32_t AudioDeviceBuffer::RequestPlayoutData(size_t samples_per_channel) {
   int64_t elapsed_time_ms = -1;
   int64_t ntp_time_ms = -1;
   const size_t bytes_per_frame = play_channels_ * sizeof(int16_t);
+  const int64_t start_time_us = rtc::TimeMicros();
   uint32_t res = audio_transport_cb_->NeedMorePlayData(
       samples_per_channel, bytes_per_frame, play_channels_, play_sample_rate_,
-      play_buffer_.data(), num_samples_out, &elapsed_time_ms, &ntp_time_ms);
+      destination, num_samples_out, &elapsed_time_ms, &ntp_time_ms);
   if (res != 0) {
     RTC_LOG(LS_ERROR) << "NeedMorePlayData() failed";
   }
+  UpdatePlayCallbackStats(start_time_us, rtc::TimeMicros(),
+                          num_samples_out / play_channels_);
 
   // Derive a new level value twice per second.
   int16_t max_abs = 0;
   RTC_DCHECK_LT(play_stat_count_, 50);
   if (++play_stat_count_ >= 50) {
     // Returns the largest absolute value in a signed 16-bit vector.
-    max_abs =
-        WebRtcSpl_MaxAbsValueW16(play_buffer_.data(), play_buffer_.size());
+    max_abs = WebRtcSpl_MaxAbsValueW16(destination,
+                                       play_channels_ * samples_per_channel);
     play_stat_count_ = 0;
   }
   // Update playout stats which is used as base for periodic logging of the
@@ -387,6 +438,11 @@ int32_t AudioDeviceBuffer::GetPlayoutData(void* audio_buffer) {
   return static_cast<int32_t>(play_buffer_.size() / play_channels_);
 }
 
+AudioDeviceModule::Stats AudioDeviceBuffer::GetStats() const {
+  MutexLock lock(&lock_);
+  return device_stats_;
+}
+
 void AudioDeviceBuffer::StartPeriodicLogging() {
   task_queue_.PostTask([this] { LogStats(AudioDeviceBuffer::LOG_START); });
 }
@@ -536,4 +592,43 @@ void AudioDeviceBuffer::UpdatePlayStats(int16_t max_abs,
   }
 }
 
+void AudioDeviceBuffer::UpdateRecCallbackStats(int64_t start_time_us,
+                                               int64_t end_time_us) {
+  const int64_t last_callback_time_us = last_rec_callback_time_us_;
+  last_rec_callback_time_us_ = start_time_us;
+  MutexLock lock(&lock_);
+  if (last_callback_time_us >= 0) {
+    device_stats_.recording_callback_interval.Add(start_time_us -
+                                                  last_callback_time_us);
+  }
+  device_stats_.recording_callback_processing_time.Add(end_time_us -
+                                                       start_time_us);
+}
+
+void AudioDeviceBuffer::UpdatePlayCallbackStats(int64_t start_time_us,
+                                                int64_t end_time_us,
+                                                size_t samples_per_channel) {
+  const int64_t last_callback_time_us = last_play_callback_time_us_;
+  last_play_callback_time_us_ = start_time_us;
+  const uint32_t sample_rate = play_sample_rate_;
+  MutexLock lock(&lock_);
+  if (last_callback_time_us >= 0) {
+    device_stats_.playout_callback_interval.Add(start_time_us -
+                                                last_callback_time_us);
+  }
+  device_stats_.playout_callback_processing_time.Add(end_time_us -
+                                                     start_time_us);
+  if (sample_rate > 0) {
+    const double duration_s =
+        static_cast<double>(samples_per_channel) / sample_rate;
+    device_stats_.total_samples_count += samples_per_channel;
+    device_stats_.total_samples_duration_s += duration_s;
+    // Each sample adds its own playout delay, so that the average delay is
+    // given by total_playout_delay_s / total_samples_count.
+    device_stats_.total_playout_delay_s +=
+        static_cast<double>(samples_per_channel) * play_delay_ms_ /
+        rtc::kNumMillisecsPerSec;
+  }
+}
+
 }  // namespace webrtc
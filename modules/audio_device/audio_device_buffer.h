@@ -16,8 +16,10 @@
 
 #include <atomic>
 
+#include "api/array_view.h"
 #include "api/sequence_checker.h"
 #include "api/task_queue/task_queue_factory.h"
+#include "modules/audio_device/include/audio_device.h"
 #include "modules/audio_device/include/audio_device_defines.h"
 #include "rtc_base/buffer.h"
 #include "rtc_base/synchronization/mutex.h"
@@ -110,6 +112,14 @@ class AudioDeviceBuffer {
       const void* audio_buffer,
       size_t samples_per_channel,
       absl::optional<int64_t> capture_timestamp_ns);
+  // Same as SetRecordedBuffer() but without copying `audio_buffer`, which
+  // must remain valid and unchanged until DeliverRecordedData() returns. Meant
+  // for audio layers that share a buffer with the platform, e.g. a Java direct
+  // ByteBuffer.
+  virtual int32_t SetRecordedBufferNoCopy(
+      const int16_t* audio_buffer,
+      size_t samples_per_channel,
+      absl::optional<int64_t> capture_timestamp_ns);
   virtual void SetVQEData(int play_delay_ms, int rec_delay_ms);
   virtual int32_t DeliverRecordedData();
   uint32_t NewMicLevel() const;
@@ -117,8 +127,18 @@ class AudioDeviceBuffer {
   virtual int32_t RequestPlayoutData(size_t samples_per_channel);
   virtual int32_t GetPlayoutData(void* audio_buffer);
 
+  // Combines RequestPlayoutData() and GetPlayoutData() by letting the audio
+  // transport decode directly into `audio_buffer`, which must have room for
+  // `samples_per_channel` interleaved frames.
+  virtual int32_t RequestAndGetPlayoutData(size_t samples_per_channel,
+                                           int16_t* audio_buffer);
+
   int32_t SetTypingStatus(bool typing_status);
 
+  // Returns the playout and recording stats accumulated since construction.
+  // Can be called on any thread.
+  AudioDeviceModule::Stats GetStats() const;
+
  private:
   // Starts/stops periodic logging of audio stats.
   void StartPeriodicLogging();
@@ -137,11 +157,29 @@ class AudioDeviceBuffer {
   void UpdateRecStats(int16_t max_abs, size_t samples_per_channel);
   void UpdatePlayStats(int16_t max_abs, size_t samples_per_channel);
 
+  // Updates the callback timing stats returned by GetStats(). `start_time_us`
+  // and `end_time_us` are the times just before and after the call to the
+  // AudioTransport.
+  void UpdateRecCallbackStats(int64_t start_time_us, int64_t end_time_us);
+  void UpdatePlayCallbackStats(int64_t start_time_us,
+                               int64_t end_time_us,
+                               size_t samples_per_channel);
+
   // Clears all members tracking stats for recording and playout.
   // These methods both run on the task queue.
   void ResetRecStats();
   void ResetPlayStats();
 
+  // Shared parts of SetRecordedBuffer() and SetRecordedBufferNoCopy(), run
+  // once `rec_data_` points at the recorded samples.
+  void OnRecordedData(size_t samples_per_channel,
+                      absl::optional<int64_t> capture_timestamp_ns);
+
+  // Asks the audio transport for `samples_per_channel` frames and writes them
+  // to `destination`. Returns the number of frames written.
+  int32_t RequestPlayoutDataInternal(size_t samples_per_channel,
+                                     int16_t* destination);
+
   // This object lives on the main (creating) thread and most methods are
   // called on that same thread. When audio has started some methods will be
   // called on either a native audio thread for playout or a native thread for
@@ -153,7 +191,7 @@ class AudioDeviceBuffer {
   // Main thread on which this object is created.
   SequenceChecker main_thread_checker_;
 
-  Mutex lock_;
+  mutable Mutex lock_;
 
   // Task queue used to invoke LogStats() periodically. Tasks are executed on a
   // worker thread but it does not necessarily have to be the same thread for
@@ -191,6 +229,10 @@ class AudioDeviceBuffer {
   // dynamically.
   rtc::BufferT<int16_t> rec_buffer_;
 
+  // The recorded samples to deliver; either `rec_buffer_` or a buffer owned
+  // by the audio layer (see SetRecordedBufferNoCopy()).
+  rtc::ArrayView<const int16_t> rec_data_;
+
   // Contains true of a key-press has been detected.
   bool typing_status_;
 
@@ -223,6 +265,16 @@ class AudioDeviceBuffer {
   // Contains counters for playout and recording statistics.
   Stats stats_ RTC_GUARDED_BY(lock_);
 
+  // Playout and recording stats returned by GetStats(). Unlike `stats_`, they
+  // are never reset.
+  AudioDeviceModule::Stats device_stats_ RTC_GUARDED_BY(lock_);
+
+  // Times of the last playout and recording callbacks, or -1 before the first
+  // callback since playout or recording started. Only modified on the native
+  // audio threads once audio is active.
+  int64_t last_play_callback_time_us_;
+  int64_t last_rec_callback_time_us_;
+
   // Stores current stats at each timer task. Used to calculate differences
   // between two successive timer events.
   Stats last_stats_ RTC_GUARDED_BY(task_queue_);
@@ -886,6 +886,14 @@ int32_t AudioDeviceModuleImpl::GetPlayoutUnderrunCount() const {
   return underrunCount;
 }
 
+absl::optional<AudioDeviceModule::Stats> AudioDeviceModuleImpl::GetStats()
+    const {
+  if (!initialized_) {
+    return absl::nullopt;
+  }
+  return audio_device_buffer_.GetStats();
+}
+
 #if defined(WEBRTC_IOS)
 int AudioDeviceModuleImpl::GetPlayoutAudioParameters(
     AudioParameters* params) const {
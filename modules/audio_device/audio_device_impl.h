@@ -17,6 +17,7 @@
 
 #include <memory>
 
+#include "absl/types/optional.h"
 #include "api/task_queue/task_queue_factory.h"
 #include "modules/audio_device/audio_device_buffer.h"
 #include "modules/audio_device/include/audio_device.h"
@@ -150,6 +151,9 @@ class AudioDeviceModuleImpl : public AudioDeviceModuleForTest {
   // Play underrun count.
   int32_t GetPlayoutUnderrunCount() const override;
 
+  // Playout stats and callback timing histograms from the AudioDeviceBuffer.
+  absl::optional<Stats> GetStats() const override;
+
 #if defined(WEBRTC_IOS)
   int GetPlayoutAudioParameters(AudioParameters* params) const override;
   int GetRecordAudioParameters(AudioParameters* params) const override;
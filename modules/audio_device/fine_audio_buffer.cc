@@ -10,6 +10,7 @@
 
 #include "modules/audio_device/fine_audio_buffer.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 
@@ -65,42 +66,62 @@ bool FineAudioBuffer::IsReadyForRecord() const {
 void FineAudioBuffer::GetPlayoutData(rtc::ArrayView<int16_t> audio_buffer,
                                      int playout_delay_ms) {
   RTC_DCHECK(IsReadyForPlayout());
-  // Ask WebRTC for new data in chunks of 10ms until we have enough to
-  // fulfill the request. It is possible that the buffer already contains
-  // enough samples from the last round.
-  while (playout_buffer_.size() < audio_buffer.size()) {
-    // Get 10ms decoded audio from WebRTC. The ADB knows about number of
-    // channels; hence we can ask for number of samples per channel here.
-    if (audio_device_buffer_->RequestPlayoutData(
-            playout_samples_per_channel_10ms_) ==
-        static_cast<int32_t>(playout_samples_per_channel_10ms_)) {
-      // Append 10ms to the end of the local buffer taking number of channels
-      // into account.
-      const size_t num_elements_10ms =
-          playout_channels_ * playout_samples_per_channel_10ms_;
-      const size_t written_elements = playout_buffer_.AppendData(
-          num_elements_10ms, [&](rtc::ArrayView<int16_t> buf) {
-            const size_t samples_per_channel_10ms =
-                audio_device_buffer_->GetPlayoutData(buf.data());
-            return playout_channels_ * samples_per_channel_10ms;
-          });
-      RTC_DCHECK_EQ(num_elements_10ms, written_elements);
-    } else {
-      // Provide silence if AudioDeviceBuffer::RequestPlayoutData() fails.
-      // Can e.g. happen when an AudioTransport has not been registered.
-      const size_t num_bytes = audio_buffer.size() * sizeof(int16_t);
-      std::memset(audio_buffer.data(), 0, num_bytes);
+  const size_t num_elements_10ms =
+      playout_channels_ * playout_samples_per_channel_10ms_;
+  // Get 10ms decoded audio from WebRTC. The ADB knows about number of
+  // channels; hence we can ask for number of samples per channel here.
+  auto request_10ms = [&] {
+    return audio_device_buffer_->RequestPlayoutData(
+               playout_samples_per_channel_10ms_) ==
+           static_cast<int32_t>(playout_samples_per_channel_10ms_);
+  };
+  // Provide silence if AudioDeviceBuffer::RequestPlayoutData() fails.
+  // Can e.g. happen when an AudioTransport has not been registered.
+  auto provide_silence = [&] {
+    std::memset(audio_buffer.data(), 0, audio_buffer.size() * sizeof(int16_t));
+  };
+
+  // Start with the samples that remain from the last round.
+  const size_t num_cached =
+      std::min(playout_buffer_.size(), audio_buffer.size());
+  std::memcpy(audio_buffer.data(), playout_buffer_.data(),
+              num_cached * sizeof(int16_t));
+  size_t num_written = num_cached;
+  // Let the ADB write whole 10ms chunks directly into `audio_buffer`.
+  while (audio_buffer.size() - num_written >= num_elements_10ms) {
+    if (!request_10ms()) {
+      provide_silence();
       return;
     }
+    audio_device_buffer_->GetPlayoutData(audio_buffer.data() + num_written);
+    num_written += num_elements_10ms;
   }
-
-  // Provide the requested number of bytes to the consumer.
-  const size_t num_bytes = audio_buffer.size() * sizeof(int16_t);
-  memcpy(audio_buffer.data(), playout_buffer_.data(), num_bytes);
   // Move remaining samples to start of buffer to prepare for next round.
-  memmove(playout_buffer_.data(), playout_buffer_.data() + audio_buffer.size(),
-          (playout_buffer_.size() - audio_buffer.size()) * sizeof(int16_t));
-  playout_buffer_.SetSize(playout_buffer_.size() - audio_buffer.size());
+  std::memmove(playout_buffer_.data(), playout_buffer_.data() + num_cached,
+               (playout_buffer_.size() - num_cached) * sizeof(int16_t));
+  playout_buffer_.SetSize(playout_buffer_.size() - num_cached);
+
+  // Fill up the rest from one more 10ms chunk and keep what is left of it.
+  if (num_written < audio_buffer.size()) {
+    RTC_DCHECK(playout_buffer_.empty());
+    if (!request_10ms()) {
+      provide_silence();
+      return;
+    }
+    const size_t written_elements = playout_buffer_.AppendData(
+        num_elements_10ms, [&](rtc::ArrayView<int16_t> buf) {
+          const size_t samples_per_channel_10ms =
+              audio_device_buffer_->GetPlayoutData(buf.data());
+          return playout_channels_ * samples_per_channel_10ms;
+        });
+    RTC_DCHECK_EQ(num_elements_10ms, written_elements);
+    const size_t num_missing = audio_buffer.size() - num_written;
+    std::memcpy(audio_buffer.data() + num_written, playout_buffer_.data(),
+                num_missing * sizeof(int16_t));
+    std::memmove(playout_buffer_.data(), playout_buffer_.data() + num_missing,
+                 (playout_buffer_.size() - num_missing) * sizeof(int16_t));
+    playout_buffer_.SetSize(playout_buffer_.size() - num_missing);
+  }
   // Cache playout latency for usage in DeliverRecordedData();
   playout_delay_ms_ = playout_delay_ms;
 }
@@ -109,22 +130,35 @@ void FineAudioBuffer::DeliverRecordedData(
     rtc::ArrayView<const int16_t> audio_buffer,
     int record_delay_ms) {
   RTC_DCHECK(IsReadyForRecord());
-  // Always append new data and grow the buffer when needed.
-  record_buffer_.AppendData(audio_buffer.data(), audio_buffer.size());
-  // Consume samples from buffer in chunks of 10ms until there is not
-  // enough data left. The number of remaining samples in the cache is given by
-  // the new size of the internal `record_buffer_`.
   const size_t num_elements_10ms =
       record_channels_ * record_samples_per_channel_10ms_;
-  while (record_buffer_.size() >= num_elements_10ms) {
-    audio_device_buffer_->SetRecordedBuffer(record_buffer_.data(),
+  auto deliver_10ms = [&](const int16_t* data) {
+    audio_device_buffer_->SetRecordedBuffer(data,
                                             record_samples_per_channel_10ms_);
     audio_device_buffer_->SetVQEData(playout_delay_ms_, record_delay_ms);
     audio_device_buffer_->DeliverRecordedData();
-    memmove(record_buffer_.data(), record_buffer_.data() + num_elements_10ms,
-            (record_buffer_.size() - num_elements_10ms) * sizeof(int16_t));
-    record_buffer_.SetSize(record_buffer_.size() - num_elements_10ms);
+  };
+
+  size_t num_consumed = 0;
+  // Complete and deliver the chunk cached from the last round, if any.
+  if (!record_buffer_.empty()) {
+    num_consumed = std::min(num_elements_10ms - record_buffer_.size(),
+                            audio_buffer.size());
+    record_buffer_.AppendData(audio_buffer.data(), num_consumed);
+    if (record_buffer_.size() < num_elements_10ms) {
+      return;
+    }
+    deliver_10ms(record_buffer_.data());
+    record_buffer_.Clear();
+  }
+  // Deliver the following whole 10ms chunks directly from `audio_buffer`.
+  while (audio_buffer.size() - num_consumed >= num_elements_10ms) {
+    deliver_10ms(audio_buffer.data() + num_consumed);
+    num_consumed += num_elements_10ms;
   }
+  // Cache the remaining samples until the next round.
+  record_buffer_.AppendData(audio_buffer.data() + num_consumed,
+                            audio_buffer.size() - num_consumed);
 }
 
 }  // namespace webrtc
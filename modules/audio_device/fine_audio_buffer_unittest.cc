@@ -155,4 +155,9 @@ TEST(FineBufferTest, GreaterThan10ms) {
   RunFineBufferTest(kFrameSizeSamples);
 }
 
+TEST(FineBufferTest, GreaterThan20ms) {
+  const int kFrameSizeSamples = 2 * kSamplesPer10Ms + 50;
+  RunFineBufferTest(kFrameSizeSamples);
+}
+
 }  // namespace webrtc
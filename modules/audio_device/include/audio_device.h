@@ -11,6 +11,8 @@
 #ifndef MODULES_AUDIO_DEVICE_INCLUDE_AUDIO_DEVICE_H_
 #define MODULES_AUDIO_DEVICE_INCLUDE_AUDIO_DEVICE_H_
 
+#include <array>
+
 #include "absl/types/optional.h"
 #include "api/scoped_refptr.h"
 #include "api/task_queue/task_queue_factory.h"
@@ -51,6 +53,27 @@ class AudioDeviceModule : public rtc::RefCountInterface {
     kDefaultDevice = -2
   };
 
+  // Histogram of durations measured in the audio device callbacks. Bucket `i`
+  // counts the durations in [kBucketLowerBoundsMs[i],
+  // kBucketLowerBoundsMs[i + 1]) milliseconds and the last bucket counts all
+  // durations from kBucketLowerBoundsMs.back() and up.
+  struct CallbackTimeHistogram {
+    static constexpr std::array<int, 10> kBucketLowerBoundsMs = {
+        0, 1, 2, 5, 10, 15, 20, 30, 50, 100};
+
+    // Adds one duration, given in microseconds.
+    void Add(int64_t duration_us) {
+      size_t bucket = counts.size() - 1;
+      while (bucket > 0 &&
+             duration_us < kBucketLowerBoundsMs[bucket] * int64_t{1000}) {
+        --bucket;
+      }
+      ++counts[bucket];
+    }
+
+    std::array<uint64_t, kBucketLowerBoundsMs.size()> counts = {};
+  };
+
   struct Stats {
     // The fields below correspond to similarly-named fields in the WebRTC stats
     // spec. https://w3c.github.io/webrtc-stats/#playoutstats-dict*
@@ -59,6 +82,13 @@ class AudioDeviceModule : public rtc::RefCountInterface {
     double total_samples_duration_s = 0;
     double total_playout_delay_s = 0;
     uint64_t total_samples_count = 0;
+
+    // Non-standard. Time between two successive playout and recording
+    // callbacks, and time spent in the AudioTransport in each callback.
+    CallbackTimeHistogram playout_callback_interval;
+    CallbackTimeHistogram playout_callback_processing_time;
+    CallbackTimeHistogram recording_callback_interval;
+    CallbackTimeHistogram recording_callback_processing_time;
   };
 
  public:
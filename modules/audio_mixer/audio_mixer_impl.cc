@@ -13,13 +13,16 @@
 #include <stdint.h>
 
 #include <algorithm>
+#include <atomic>
 #include <iterator>
+#include <string>
 #include <type_traits>
 #include <utility>
 
 #include "modules/audio_mixer/audio_frame_manipulator.h"
 #include "modules/audio_mixer/default_output_rate_calculator.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/event.h"
 #include "rtc_base/logging.h"
 #include "rtc_base/trace_event.h"
 #include "system_wrappers/include/metrics.h"
@@ -32,6 +35,8 @@ struct AudioMixerImpl::SourceStatus {
 
   // A frame that will be passed to audio_source->GetAudioFrameWithInfo.
   AudioFrame audio_frame;
+  // The value returned by the last audio_source->GetAudioFrameWithInfo call.
+  Source::AudioFrameInfo audio_frame_info = Source::AudioFrameInfo::kMuted;
 };
 
 namespace {
@@ -67,6 +72,21 @@ AudioMixerImpl::AudioMixerImpl(
       helper_containers_(std::make_unique<HelperContainers>()),
       frame_combiner_(use_limiter) {}
 
+AudioMixerImpl::AudioMixerImpl(
+    std::unique_ptr<OutputRateCalculator> output_rate_calculator,
+    bool use_limiter,
+    TaskQueueFactory* task_queue_factory,
+    int num_fetch_threads)
+    : AudioMixerImpl(std::move(output_rate_calculator), use_limiter) {
+  RTC_DCHECK_GE(num_fetch_threads, 0);
+  RTC_DCHECK(task_queue_factory || num_fetch_threads == 0);
+  for (int k = 0; k < num_fetch_threads; ++k) {
+    fetch_queues_.push_back(task_queue_factory->CreateTaskQueue(
+        "AudioMixerFetch" + std::to_string(k),
+        TaskQueueFactory::Priority::HIGH));
+  }
+}
+
 AudioMixerImpl::~AudioMixerImpl() {}
 
 rtc::scoped_refptr<AudioMixerImpl> AudioMixerImpl::Create() {
@@ -82,6 +102,16 @@ rtc::scoped_refptr<AudioMixerImpl> AudioMixerImpl::Create(
       std::move(output_rate_calculator), use_limiter);
 }
 
+rtc::scoped_refptr<AudioMixerImpl> AudioMixerImpl::Create(
+    std::unique_ptr<OutputRateCalculator> output_rate_calculator,
+    bool use_limiter,
+    TaskQueueFactory* task_queue_factory,
+    int num_fetch_threads) {
+  return rtc::make_ref_counted<AudioMixerImpl>(
+      std::move(output_rate_calculator), use_limiter, task_queue_factory,
+      num_fetch_threads);
+}
+
 void AudioMixerImpl::Mix(size_t number_of_channels,
                          AudioFrame* audio_frame_for_mixing) {
   TRACE_EVENT0("webrtc", "AudioMixerImpl::Mix");
@@ -127,12 +157,40 @@ void AudioMixerImpl::RemoveSource(Source* audio_source) {
 
 rtc::ArrayView<AudioFrame* const> AudioMixerImpl::GetAudioFromSources(
     int output_frequency) {
+  // The sources are handed out one at a time to the mixing thread and to the
+  // fetching threads, which all wait for each other before the frames are
+  // collected in the order of `audio_source_list_`.
+  const rtc::ArrayView<const std::unique_ptr<SourceStatus>> sources(
+      audio_source_list_);
+  std::atomic<size_t> next_source(0);
+  auto fetch_frames = [&] {
+    for (size_t k = next_source++; k < sources.size(); k = next_source++) {
+      SourceStatus& status = *sources[k];
+      status.audio_frame_info = status.audio_source->GetAudioFrameWithInfo(
+          output_frequency, &status.audio_frame);
+    }
+  };
+
+  const size_t num_fetch_tasks =
+      std::min(fetch_queues_.size(), sources.empty() ? 0 : sources.size() - 1);
+  std::atomic<size_t> num_pending_tasks(num_fetch_tasks);
+  rtc::Event tasks_done;
+  for (size_t k = 0; k < num_fetch_tasks; ++k) {
+    fetch_queues_[k]->PostTask([&] {
+      fetch_frames();
+      if (--num_pending_tasks == 0) {
+        tasks_done.Set();
+      }
+    });
+  }
+  fetch_frames();
+  if (num_fetch_tasks > 0) {
+    tasks_done.Wait(rtc::Event::kForever);
+  }
+
   int audio_to_mix_count = 0;
   for (auto& source_and_status : audio_source_list_) {
-    const auto audio_frame_info =
-        source_and_status->audio_source->GetAudioFrameWithInfo(
-            output_frequency, &source_and_status->audio_frame);
-    switch (audio_frame_info) {
+    switch (source_and_status->audio_frame_info) {
       case Source::AudioFrameInfo::kError:
         RTC_LOG_F(LS_WARNING)
             << "failed to GetAudioFrameWithInfo() from source";
@@ -20,6 +20,8 @@
 #include "api/audio/audio_frame.h"
 #include "api/audio/audio_mixer.h"
 #include "api/scoped_refptr.h"
+#include "api/task_queue/task_queue_base.h"
+#include "api/task_queue/task_queue_factory.h"
 #include "modules/audio_mixer/frame_combiner.h"
 #include "modules/audio_mixer/output_rate_calculator.h"
 #include "rtc_base/race_checker.h"
@@ -41,6 +43,17 @@ class AudioMixerImpl : public AudioMixer {
       std::unique_ptr<OutputRateCalculator> output_rate_calculator,
       bool use_limiter);
 
+  // Creates a mixer that fetches the audio frames of its sources on
+  // `num_fetch_threads` task queues created with `task_queue_factory`, in
+  // addition to the mixing thread. The sources must allow
+  // `GetAudioFrameWithInfo()` to be called concurrently for different sources.
+  // The mixed frame does not depend on the number of fetching threads.
+  static rtc::scoped_refptr<AudioMixerImpl> Create(
+      std::unique_ptr<OutputRateCalculator> output_rate_calculator,
+      bool use_limiter,
+      TaskQueueFactory* task_queue_factory,
+      int num_fetch_threads);
+
   ~AudioMixerImpl() override;
 
   AudioMixerImpl(const AudioMixerImpl&) = delete;
@@ -57,6 +70,10 @@ class AudioMixerImpl : public AudioMixer {
  protected:
   AudioMixerImpl(std::unique_ptr<OutputRateCalculator> output_rate_calculator,
                  bool use_limiter);
+  AudioMixerImpl(std::unique_ptr<OutputRateCalculator> output_rate_calculator,
+                 bool use_limiter,
+                 TaskQueueFactory* task_queue_factory,
+                 int num_fetch_threads);
 
  private:
   struct HelperContainers;
@@ -83,6 +100,11 @@ class AudioMixerImpl : public AudioMixer {
   // Component that handles actual adding of audio frames.
   FrameCombiner frame_combiner_;
 
+  // Task queues on which the audio frames are fetched in parallel, in addition
+  // to the mixing thread. Empty if the frames are fetched on the mixing thread
+  // only.
+  std::vector<std::unique_ptr<TaskQueueBase, TaskQueueDeleter>> fetch_queues_;
+
   // The highest source count this mixer has ever had. Used for UMA stats.
   size_t max_source_count_ever_ = 0;
 };
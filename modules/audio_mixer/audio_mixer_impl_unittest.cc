@@ -23,6 +23,7 @@
 #include "api/audio/audio_mixer.h"
 #include "api/rtp_packet_info.h"
 #include "api/rtp_packet_infos.h"
+#include "api/task_queue/default_task_queue_factory.h"
 #include "api/units/timestamp.h"
 #include "modules/audio_mixer/default_output_rate_calculator.h"
 #include "rtc_base/checks.h"
@@ -437,6 +438,44 @@ TEST(AudioMixer, MultipleChannelsManyParticipants) {
   }
 }
 
+TEST(AudioMixer, ParallelFetchingMixesLikeSerialFetching) {
+  constexpr int kNumSources = 10;
+  constexpr int kNumFetchThreads = 3;
+  std::vector<MockMixerAudioSource> sources(kNumSources);
+  for (int k = 0; k < kNumSources; ++k) {
+    ResetFrame(sources[k].fake_frame());
+    int16_t* data = sources[k].fake_frame()->mutable_data();
+    for (size_t i = 0; i < kDefaultSampleRateHz / 100; ++i) {
+      data[i] = static_cast<int16_t>((k + 1) * 100 + i % 50);
+    }
+    if (k % 4 == 3) {
+      sources[k].set_fake_info(AudioMixer::Source::AudioFrameInfo::kMuted);
+    }
+  }
+
+  const auto task_queue_factory = CreateDefaultTaskQueueFactory();
+  const auto serial_mixer = AudioMixerImpl::Create();
+  const auto parallel_mixer = AudioMixerImpl::Create(
+      std::make_unique<DefaultOutputRateCalculator>(), /*use_limiter=*/true,
+      task_queue_factory.get(), kNumFetchThreads);
+  for (auto& source : sources) {
+    serial_mixer->AddSource(&source);
+    parallel_mixer->AddSource(&source);
+  }
+
+  AudioFrame serial_frame;
+  AudioFrame parallel_frame;
+  for (int i = 0; i < 5; ++i) {
+    serial_mixer->Mix(1, &serial_frame);
+    parallel_mixer->Mix(1, &parallel_frame);
+    ASSERT_EQ(serial_frame.samples_per_channel_,
+              parallel_frame.samples_per_channel_);
+    for (size_t j = 0; j < serial_frame.samples_per_channel_; ++j) {
+      ASSERT_EQ(serial_frame.data()[j], parallel_frame.data()[j]);
+    }
+  }
+}
+
 TEST(AudioMixer, ShouldIncludeRtpPacketInfoFromAllMixedSources) {
   const uint32_t kSsrc0 = 10;
   const uint32_t kSsrc1 = 11;
@@ -103,6 +103,10 @@ void MixToFloatFrame(rtc::ArrayView<const AudioFrame* const> mix_list,
   // Convert to FloatS16 and mix.
   for (size_t i = 0; i < mix_list.size(); ++i) {
     const AudioFrame* const frame = mix_list[i];
+    // Muted frames only contribute zeros to the mix.
+    if (frame->muted()) {
+      continue;
+    }
     const int16_t* const frame_data = frame->data();
     for (size_t j = 0; j < std::min(number_of_channels,
                                     FrameCombiner::kMaximumNumberOfChannels);
@@ -116,12 +120,15 @@ void MixToFloatFrame(rtc::ArrayView<const AudioFrame* const> mix_list,
   }
 }
 
-void RunLimiter(AudioFrameView<float> mixing_buffer_view, Limiter* limiter) {
+// Returns the per-sample limiter gains for `mixing_buffer_view`.
+rtc::ArrayView<const float> RunLimiter(
+    AudioFrameView<const float> mixing_buffer_view,
+    Limiter* limiter) {
   const size_t sample_rate = mixing_buffer_view.samples_per_channel() * 1000 /
                              AudioMixerImpl::kFrameDurationInMs;
   // TODO(alessiob): Avoid calling SetSampleRate every time.
   limiter->SetSampleRate(sample_rate);
-  limiter->Process(mixing_buffer_view);
+  return limiter->ComputeScalingFactors(mixing_buffer_view);
 }
 
 // Both interleaves and rounds.
@@ -138,6 +145,26 @@ void InterleaveToAudioFrame(AudioFrameView<const float> mixing_buffer_view,
     }
   }
 }
+
+// Applies the limiter gains, hard-clips, interleaves and rounds in a single
+// pass over the mixing buffer.
+void ScaleAndInterleaveToAudioFrame(
+    AudioFrameView<const float> mixing_buffer_view,
+    rtc::ArrayView<const float> scaling_factors,
+    AudioFrame* audio_frame_for_mixing) {
+  const size_t number_of_channels = mixing_buffer_view.num_channels();
+  const size_t samples_per_channel = mixing_buffer_view.samples_per_channel();
+  RTC_DCHECK_EQ(samples_per_channel, scaling_factors.size());
+  int16_t* const mixing_data = audio_frame_for_mixing->mutable_data();
+  for (size_t i = 0; i < number_of_channels; ++i) {
+    rtc::ArrayView<const float> channel = mixing_buffer_view.channel(i);
+    for (size_t j = 0; j < samples_per_channel; ++j) {
+      // `FloatS16ToS16()` clamps to the same range as the limiter.
+      mixing_data[number_of_channels * j + i] =
+          FloatS16ToS16(channel[j] * scaling_factors[j]);
+    }
+  }
+}
 }  // namespace
 
 constexpr size_t FrameCombiner::kMaximumNumberOfChannels;
@@ -204,7 +231,10 @@ void FrameCombiner::Combine(rtc::ArrayView<AudioFrame* const> mix_list,
                                            output_samples_per_channel);
 
   if (use_limiter_) {
-    RunLimiter(mixing_buffer_view, &limiter_);
+    ScaleAndInterleaveToAudioFrame(mixing_buffer_view,
+                                   RunLimiter(mixing_buffer_view, &limiter_),
+                                   audio_frame_for_mixing);
+    return;
   }
 
   InterleaveToAudioFrame(mixing_buffer_view, audio_frame_for_mixing);
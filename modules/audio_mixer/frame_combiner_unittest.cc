@@ -276,6 +276,40 @@ TEST(FrameCombiner, CombiningOneFrameShouldNotChangeFrame) {
   }
 }
 
+// Muted frames are skipped when summing, but their RtpPacketInfos are still
+// part of the mixed frame.
+TEST(FrameCombiner, CombiningWithMutedFrameShouldNotChangeFrame) {
+  FrameCombiner combiner(false);
+  for (const int rate : {8000, 16000, 32000, 48000}) {
+    for (const int number_of_channels : {1, 2, 4}) {
+      SCOPED_TRACE(ProduceDebugText(rate, number_of_channels, 2));
+
+      AudioFrame audio_frame_for_mixing;
+
+      SetUpFrames(rate, number_of_channels);
+      int16_t* frame1_data = frame1.mutable_data();
+      std::iota(frame1_data, frame1_data + number_of_channels * rate / 100, 0);
+      frame2.Mute();
+      ASSERT_TRUE(frame2.muted());
+      const std::vector<AudioFrame*> frames_to_combine = {&frame1, &frame2};
+      combiner.Combine(frames_to_combine, number_of_channels, rate,
+                       frames_to_combine.size(), &audio_frame_for_mixing);
+
+      const int16_t* audio_frame_for_mixing_data =
+          audio_frame_for_mixing.data();
+      const std::vector<int16_t> mixed_data(
+          audio_frame_for_mixing_data,
+          audio_frame_for_mixing_data + number_of_channels * rate / 100);
+
+      std::vector<int16_t> expected(number_of_channels * rate / 100);
+      std::iota(expected.begin(), expected.end(), 0);
+      EXPECT_EQ(mixed_data, expected);
+      EXPECT_EQ(audio_frame_for_mixing.packet_infos_.size(),
+                frame1.packet_infos_.size() + frame2.packet_infos_.size());
+    }
+  }
+}
+
 // Send a sine wave through the FrameCombiner, and check that the
 // difference between input and output varies smoothly. Also check
 // that it is inside reasonable bounds. This is to catch issues like
@@ -0,0 +1,209 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <stdint.h>
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "api/array_view.h"
+#include "api/audio/echo_canceller3_config.h"
+#include "api/test/metrics/global_metrics_logger_and_exporter.h"
+#include "api/test/metrics/metric.h"
+#include "modules/audio_processing/aec3/adaptive_fir_filter.h"
+#include "modules/audio_processing/aec3/aec3_common.h"
+#include "modules/audio_processing/aec3/block.h"
+#include "modules/audio_processing/aec3/fft_data.h"
+#include "modules/audio_processing/aec3/matched_filter.h"
+#include "modules/audio_processing/aec3/render_delay_buffer.h"
+#include "modules/audio_processing/logging/apm_data_dumper.h"
+#include "rtc_base/random.h"
+#include "rtc_base/strings/string_builder.h"
+#include "rtc_base/system/arch.h"
+#include "rtc_base/time_utils.h"
+#include "system_wrappers/include/cpu_features_wrapper.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+using ::webrtc::test::GetGlobalMetricsLogger;
+using ::webrtc::test::ImprovementDirection;
+using ::webrtc::test::Unit;
+
+constexpr int kSampleRateHz = 16000;
+constexpr int kNumWarmupBlocks = 100;
+constexpr int kNumMeasuredBlocks = 2000;
+
+struct Optimization {
+  Aec3Optimization optimization;
+  absl::string_view name;
+};
+
+// Returns the optimizations supported by the CPU, including the generic one.
+std::vector<Optimization> AvailableOptimizations() {
+  std::vector<Optimization> optimizations = {{Aec3Optimization::kNone, "C"}};
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  if (GetCPUInfo(kSSE2) != 0) {
+    optimizations.push_back({Aec3Optimization::kSse2, "SSE2"});
+  }
+  if (GetCPUInfo(kAVX2) != 0) {
+    optimizations.push_back({Aec3Optimization::kAvx2, "AVX2"});
+  }
+  if (GetCPUInfo(kAVX512) != 0) {
+    optimizations.push_back({Aec3Optimization::kAvx512, "AVX512"});
+  }
+#endif
+#if defined(WEBRTC_HAS_NEON)
+  optimizations.push_back({Aec3Optimization::kNeon, "NEON"});
+#endif
+  return optimizations;
+}
+
+void RandomizeBlock(Random& random_generator, Block& block) {
+  for (int band = 0; band < block.NumBands(); ++band) {
+    for (int ch = 0; ch < block.NumChannels(); ++ch) {
+      for (float& sample : block.View(band, ch)) {
+        sample = static_cast<float>(random_generator.Gaussian(0.0, 3000.0));
+      }
+    }
+  }
+}
+
+void LogDuration(absl::string_view kernel,
+                 absl::string_view test_case,
+                 int64_t total_ns) {
+  GetGlobalMetricsLogger()->LogSingleValueMetric(
+      "aec3_" + std::string(kernel) + "_ns_per_block", test_case,
+      static_cast<double>(total_ns) / kNumMeasuredBlocks, Unit::kUnitless,
+      ImprovementDirection::kSmallerIsBetter);
+}
+
+}  // namespace
+
+// Measures the time in nanoseconds per 4 ms block spent in the matched filter
+// of the delay estimator for each of the available optimizations.
+TEST(Aec3KernelsPerformanceTest, MatchedFilterDuration) {
+  const EchoCanceller3Config config;
+  const size_t down_sampling_factor = config.delay.down_sampling_factor;
+  const size_t sub_block_size = kBlockSize / down_sampling_factor;
+  for (const Optimization& optimization : AvailableOptimizations()) {
+    SCOPED_TRACE(optimization.name);
+    ApmDataDumper data_dumper(0);
+    MatchedFilter filter(
+        &data_dumper, optimization.optimization, sub_block_size,
+        kMatchedFilterWindowSizeSubBlocks, config.delay.num_filters,
+        kMatchedFilterAlignmentShiftSizeSubBlocks,
+        config.render_levels.poor_excitation_render_limit,
+        config.delay.delay_estimate_smoothing,
+        config.delay.delay_estimate_smoothing_delay_found,
+        config.delay.delay_candidate_detection_threshold,
+        config.delay.detect_pre_echo);
+    std::unique_ptr<RenderDelayBuffer> render_delay_buffer(
+        RenderDelayBuffer::Create(config, kSampleRateHz,
+                                  /*num_render_channels=*/1));
+    Block render(NumBandsForRate(kSampleRateHz), /*num_channels=*/1);
+    std::vector<float> capture(sub_block_size);
+    Random random_generator(42U);
+
+    int64_t matched_filter_ns = 0;
+    for (int k = 0; k < kNumWarmupBlocks + kNumMeasuredBlocks; ++k) {
+      if (k == kNumWarmupBlocks) {
+        matched_filter_ns = 0;
+      }
+      RandomizeBlock(random_generator, render);
+      render_delay_buffer->Insert(render);
+      render_delay_buffer->PrepareCaptureProcessing();
+      for (size_t i = 0; i < sub_block_size; ++i) {
+        capture[i] = render.View(/*band=*/0, /*channel=*/0)[i];
+      }
+      const int64_t start_ns = rtc::TimeNanos();
+      for (size_t sub_block = 0; sub_block < down_sampling_factor;
+           ++sub_block) {
+        filter.Update(render_delay_buffer->GetDownsampledRenderBuffer(),
+                      capture, /*use_slow_smoothing=*/false);
+      }
+      matched_filter_ns += rtc::TimeNanos() - start_ns;
+    }
+
+    LogDuration("matched_filter", optimization.name, matched_filter_ns);
+    EXPECT_GT(matched_filter_ns, 0);
+  }
+}
+
+// Measures the time in nanoseconds per 4 ms block spent in the filtering, the
+// adaptation and the frequency response computation of the refined adaptive
+// filter for each of the available optimizations.
+TEST(Aec3KernelsPerformanceTest, AdaptiveFirFilterDuration) {
+  const EchoCanceller3Config config;
+  const size_t num_partitions = config.filter.refined.length_blocks;
+  for (size_t num_render_channels : {1, 2}) {
+    for (const Optimization& optimization : AvailableOptimizations()) {
+      rtc::StringBuilder test_case;
+      test_case << optimization.name << "_" << num_render_channels << "ch";
+      SCOPED_TRACE(test_case.str());
+      ApmDataDumper data_dumper(0);
+      AdaptiveFirFilter filter(num_partitions, num_partitions,
+                               config.filter.config_change_duration_blocks,
+                               num_render_channels, optimization.optimization,
+                               &data_dumper);
+      std::unique_ptr<RenderDelayBuffer> render_delay_buffer(
+          RenderDelayBuffer::Create(config, kSampleRateHz,
+                                    num_render_channels));
+      Block render(NumBandsForRate(kSampleRateHz), num_render_channels);
+      std::vector<std::array<float, kFftLengthBy2Plus1>> H2(num_partitions);
+      FftData S;
+      FftData G;
+      Random random_generator(42U);
+
+      int64_t filter_ns = 0;
+      int64_t adapt_ns = 0;
+      int64_t frequency_response_ns = 0;
+      for (int k = 0; k < kNumWarmupBlocks + kNumMeasuredBlocks; ++k) {
+        if (k == kNumWarmupBlocks) {
+          filter_ns = 0;
+          adapt_ns = 0;
+          frequency_response_ns = 0;
+        }
+        RandomizeBlock(random_generator, render);
+        render_delay_buffer->Insert(render);
+        render_delay_buffer->PrepareCaptureProcessing();
+        const RenderBuffer& render_buffer =
+            *render_delay_buffer->GetRenderBuffer();
+        for (size_t i = 0; i < kFftLengthBy2Plus1; ++i) {
+          G.re[i] = random_generator.Rand<float>() * 1e-6f;
+          G.im[i] = random_generator.Rand<float>() * 1e-6f;
+        }
+
+        const int64_t start_ns = rtc::TimeNanos();
+        filter.Filter(render_buffer, &S);
+        const int64_t filtered_ns = rtc::TimeNanos();
+        filter.Adapt(render_buffer, G);
+        const int64_t adapted_ns = rtc::TimeNanos();
+        filter.ComputeFrequencyResponse(&H2);
+        const int64_t computed_ns = rtc::TimeNanos();
+        filter_ns += filtered_ns - start_ns;
+        adapt_ns += adapted_ns - filtered_ns;
+        frequency_response_ns += computed_ns - adapted_ns;
+      }
+
+      LogDuration("adaptive_filter_filter", test_case.str(), filter_ns);
+      LogDuration("adaptive_filter_adapt", test_case.str(), adapt_ns);
+      LogDuration("adaptive_filter_frequency_response", test_case.str(),
+                  frequency_response_ns);
+      EXPECT_GT(filter_ns, 0);
+    }
+  }
+}
+
+}  // namespace webrtc
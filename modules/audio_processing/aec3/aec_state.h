@@ -154,6 +154,10 @@ class AecState {
     return filter_analyzer_.FilterLengthBlocks();
   }
 
+  // Returns the number of blocks of the filters that hold the significant part
+  // of the estimated echo path, when the filter length auto-sizing is enabled.
+  int FilterTailBlocks() const { return filter_analyzer_.FilterTailBlocks(); }
+
  private:
   static std::atomic<int> instance_count_;
   std::unique_ptr<ApmDataDumper> data_dumper_;
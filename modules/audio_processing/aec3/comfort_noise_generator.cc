@@ -16,6 +16,9 @@
 #if defined(WEBRTC_ARCH_X86_FAMILY)
 #include <emmintrin.h>
 #endif
+#if defined(WEBRTC_HAS_NEON)
+#include <arm_neon.h>
+#endif
 #include <algorithm>
 #include <array>
 #include <cmath>
@@ -48,6 +51,95 @@ constexpr float kSqrt2Sin[32] = {
     -1.3870398f, -1.3065630f, -1.1758756f, -1.0000000f, -0.7856950f,
     -0.5411961f, -0.2758994f};
 
+// Parameters of the linear congruential generator
+// `seed = (kLcgMultiplier * seed + 1) mod 2^31` used for the random phases.
+constexpr uint32_t kLcgMultiplier = 69069;
+constexpr uint32_t kLcgMask = 0x80000000 - 1;
+// Number of random phases generated for each spectrum.
+constexpr int kNumRandomPhases = kFftLengthBy2 - 1;
+
+// Multiplier and increment of the generator applied `n` times, computed modulo
+// 2^32 (which is consistent with the 2^31 modulo of the generator).
+constexpr uint32_t LcgJumpMultiplier(int n) {
+  return n == 0 ? 1u : kLcgMultiplier * LcgJumpMultiplier(n - 1);
+}
+constexpr uint32_t LcgJumpIncrement(int n) {
+  return n == 0 ? 0u : kLcgMultiplier * LcgJumpIncrement(n - 1) + 1u;
+}
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+// Multiplies the 32-bit lanes of `a` and `b` modulo 2^32.
+inline __m128i MultiplyLow32(__m128i a, __m128i b) {
+  const __m128i even = _mm_mul_epu32(a, b);
+  const __m128i odd =
+      _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+  return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                            _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+#endif
+
+// Generates the next `kNumRandomPhases` random 31-bit integers of the
+// generator seeded with `*seed`, which is updated. The optimized versions jump
+// ahead to compute four consecutive values at once and are bit-exact.
+void GenerateRandomValues(Aec3Optimization optimization,
+                          uint32_t* seed,
+                          std::array<uint32_t, kNumRandomPhases + 1>* values) {
+  static_assert((kNumRandomPhases + 1) % 4 == 0, "");
+  switch (optimization) {
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+    case Aec3Optimization::kSse2:
+    case Aec3Optimization::kAvx2:
+    case Aec3Optimization::kAvx512: {
+      const __m128i mask = _mm_set1_epi32(kLcgMask);
+      const __m128i multiplier_4 = _mm_set1_epi32(LcgJumpMultiplier(4));
+      const __m128i increment_4 = _mm_set1_epi32(LcgJumpIncrement(4));
+      const __m128i s = _mm_set1_epi32(*seed);
+      __m128i lanes = _mm_and_si128(
+          _mm_add_epi32(
+              MultiplyLow32(s, _mm_setr_epi32(
+                                   LcgJumpMultiplier(1), LcgJumpMultiplier(2),
+                                   LcgJumpMultiplier(3), LcgJumpMultiplier(4))),
+              _mm_setr_epi32(LcgJumpIncrement(1), LcgJumpIncrement(2),
+                             LcgJumpIncrement(3), LcgJumpIncrement(4))),
+          mask);
+      for (size_t k = 0; k < values->size(); k += 4) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&(*values)[k]), lanes);
+        lanes = _mm_and_si128(
+            _mm_add_epi32(MultiplyLow32(lanes, multiplier_4), increment_4),
+            mask);
+      }
+      *seed = (*values)[kNumRandomPhases - 1];
+    } break;
+#endif
+#if defined(WEBRTC_HAS_NEON)
+    case Aec3Optimization::kNeon: {
+      const uint32x4_t mask = vdupq_n_u32(kLcgMask);
+      const uint32x4_t multiplier_4 = vdupq_n_u32(LcgJumpMultiplier(4));
+      const uint32x4_t increment_4 = vdupq_n_u32(LcgJumpIncrement(4));
+      constexpr uint32_t kMultipliers[4] = {
+          LcgJumpMultiplier(1), LcgJumpMultiplier(2), LcgJumpMultiplier(3),
+          LcgJumpMultiplier(4)};
+      constexpr uint32_t kIncrements[4] = {
+          LcgJumpIncrement(1), LcgJumpIncrement(2), LcgJumpIncrement(3),
+          LcgJumpIncrement(4)};
+      uint32x4_t lanes = vandq_u32(
+          vmlaq_n_u32(vld1q_u32(kIncrements), vld1q_u32(kMultipliers), *seed),
+          mask);
+      for (size_t k = 0; k < values->size(); k += 4) {
+        vst1q_u32(&(*values)[k], lanes);
+        lanes = vandq_u32(vmlaq_u32(increment_4, lanes, multiplier_4), mask);
+      }
+      *seed = (*values)[kNumRandomPhases - 1];
+    } break;
+#endif
+    default:
+      for (int k = 0; k < kNumRandomPhases; ++k) {
+        *seed = (*seed * kLcgMultiplier + 1) & kLcgMask;
+        (*values)[k] = *seed;
+      }
+  }
+}
+
 void GenerateComfortNoise(Aec3Optimization optimization,
                           const std::array<float, kFftLengthBy2Plus1>& N2,
                           uint32_t* seed,
@@ -75,12 +167,12 @@ void GenerateComfortNoise(Aec3Optimization optimization,
   // (strong correlation).
   N_low->re[0] = N_low->re[kFftLengthBy2] = N_high->re[0] =
       N_high->re[kFftLengthBy2] = 0.f;
+  std::array<uint32_t, kNumRandomPhases + 1> random_values;
+  GenerateRandomValues(optimization, seed, &random_values);
   for (size_t k = 1; k < kFftLengthBy2; k++) {
     constexpr int kIndexMask = 32 - 1;
-    // Generate a random 31-bit integer.
-    seed[0] = (seed[0] * 69069 + 1) & (0x80000000 - 1);
     // Convert to a 5-bit index.
-    int i = seed[0] >> 26;
+    int i = random_values[k - 1] >> 26;
 
     // y = sqrt(2) * sin(a)
     const float x = kSqrt2Sin[i];
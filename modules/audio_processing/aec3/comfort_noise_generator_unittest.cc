@@ -68,5 +68,42 @@ TEST(ComfortNoiseGenerator, CorrectLevel) {
   }
 }
 
+// Verifies that the optimized comfort noise generation, if any, is bit-exact
+// with the generic code for the typical numbers of capture channels.
+TEST(ComfortNoiseGenerator, OptimizationsAreBitExact) {
+  const Aec3Optimization optimization = DetectOptimization();
+  if (optimization == Aec3Optimization::kNone) {
+    GTEST_SKIP() << "No optimizations available.";
+  }
+  EchoCanceller3Config config;
+  Random random_generator(42U);
+  for (size_t num_channels : {1, 2, 4}) {
+    SCOPED_TRACE(num_channels);
+    ComfortNoiseGenerator cng(config, Aec3Optimization::kNone, num_channels);
+    ComfortNoiseGenerator cng_optimized(config, optimization, num_channels);
+    std::vector<std::array<float, kFftLengthBy2Plus1>> N2(num_channels);
+    std::vector<FftData> n_lower(num_channels);
+    std::vector<FftData> n_upper(num_channels);
+    std::vector<FftData> n_lower_optimized(num_channels);
+    std::vector<FftData> n_upper_optimized(num_channels);
+
+    for (int k = 0; k < 100; ++k) {
+      for (auto& N2_ch : N2) {
+        for (float& n : N2_ch) {
+          n = 1000.f * 1000.f * random_generator.Rand<float>();
+        }
+      }
+      cng.Compute(false, N2, n_lower, n_upper);
+      cng_optimized.Compute(false, N2, n_lower_optimized, n_upper_optimized);
+      for (size_t ch = 0; ch < num_channels; ++ch) {
+        EXPECT_EQ(n_lower[ch].re, n_lower_optimized[ch].re);
+        EXPECT_EQ(n_lower[ch].im, n_lower_optimized[ch].im);
+        EXPECT_EQ(n_upper[ch].re, n_upper_optimized[ch].re);
+        EXPECT_EQ(n_upper[ch].im, n_upper_optimized[ch].im);
+      }
+    }
+  }
+}
+
 }  // namespace aec3
 }  // namespace webrtc
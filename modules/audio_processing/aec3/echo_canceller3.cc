@@ -386,6 +386,22 @@ EchoCanceller3Config AdjustConfig(const EchoCanceller3Config& config) {
     adjusted_cfg.delay.detect_pre_echo = false;
   }
 
+  if (field_trial::IsEnabled("WebRTC-Aec3FilterLengthAutoSizing")) {
+    adjusted_cfg.filter.length_auto_sizing.enabled = true;
+  }
+
+  if (field_trial::IsDisabled("WebRTC-Aec3FilterLengthAutoSizing")) {
+    adjusted_cfg.filter.length_auto_sizing.enabled = false;
+  }
+
+  if (field_trial::IsEnabled("WebRTC-Aec3DelayEstimatorTrackingSearch")) {
+    adjusted_cfg.delay.tracking_search.enabled = true;
+  }
+
+  if (field_trial::IsDisabled("WebRTC-Aec3DelayEstimatorTrackingSearch")) {
+    adjusted_cfg.delay.tracking_search.enabled = false;
+  }
+
   if (field_trial::IsEnabled("WebRTC-Aec3SensitiveDominantNearendActivation")) {
     adjusted_cfg.suppressor.dominant_nearend_detection.enr_threshold = 0.5f;
   } else if (field_trial::IsEnabled(
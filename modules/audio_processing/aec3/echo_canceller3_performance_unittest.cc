@@ -0,0 +1,144 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <stdint.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/types/optional.h"
+#include "api/audio/echo_canceller3_config.h"
+#include "api/test/metrics/global_metrics_logger_and_exporter.h"
+#include "api/test/metrics/metric.h"
+#include "modules/audio_processing/aec3/echo_canceller3.h"
+#include "modules/audio_processing/audio_buffer.h"
+#include "rtc_base/random.h"
+#include "rtc_base/strings/string_builder.h"
+#include "rtc_base/time_utils.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+using ::webrtc::test::GetGlobalMetricsLogger;
+using ::webrtc::test::ImprovementDirection;
+using ::webrtc::test::Unit;
+
+constexpr int kNumWarmupFrames = 200;
+constexpr int kNumMeasuredFrames = 1000;
+constexpr int kEchoDelaySamples = 480;
+
+// Fills the render channels with independent noise and the capture channels
+// with a channel-dependent mix of the render channels delayed by
+// `kEchoDelaySamples`, plus noise.
+class EchoSignalGenerator {
+ public:
+  EchoSignalGenerator(int sample_rate_hz,
+                      size_t num_render_channels,
+                      size_t num_capture_channels)
+      : frame_length_(sample_rate_hz / 100),
+        num_capture_channels_(num_capture_channels),
+        render_history_(num_render_channels,
+                        std::vector<float>(kEchoDelaySamples, 0.f)) {}
+
+  void Populate(AudioBuffer& render, AudioBuffer& capture) {
+    for (size_t i = 0; i < frame_length_; ++i) {
+      for (size_t ch = 0; ch < num_capture_channels_; ++ch) {
+        float y = static_cast<float>(random_generator_.Gaussian(0.0, 30.0));
+        for (size_t render_ch = 0; render_ch < render_history_.size();
+             ++render_ch) {
+          y += 0.3f / (1 + ch + render_ch) *
+               render_history_[render_ch][history_index_];
+        }
+        capture.channels()[ch][i] = y;
+      }
+      for (size_t ch = 0; ch < render_history_.size(); ++ch) {
+        const float x =
+            static_cast<float>(random_generator_.Gaussian(0.0, 3000.0));
+        render.channels()[ch][i] = x;
+        render_history_[ch][history_index_] = x;
+      }
+      history_index_ = (history_index_ + 1) % kEchoDelaySamples;
+    }
+  }
+
+ private:
+  const size_t frame_length_;
+  const size_t num_capture_channels_;
+  std::vector<std::vector<float>> render_history_;
+  size_t history_index_ = 0;
+  Random random_generator_{42U};
+};
+
+}  // namespace
+
+// Measures the time in nanoseconds per 10 ms frame spent in the render analysis
+// and in the capture processing of AEC3 with multi-channel render and capture.
+TEST(EchoCanceller3PerformanceTest, MultiChannelProcessingDuration) {
+  const std::pair<size_t, size_t> kChannelConfigs[] = {{1, 1}, {2, 4}, {2, 8}};
+  for (int sample_rate_hz : {16000, 48000}) {
+    for (const auto& [num_render_channels, num_capture_channels] :
+         kChannelConfigs) {
+      rtc::StringBuilder test_case;
+      test_case << sample_rate_hz << "Hz_" << num_render_channels << "x"
+                << num_capture_channels;
+      SCOPED_TRACE(test_case.str());
+      AudioBuffer render(sample_rate_hz, num_render_channels, sample_rate_hz,
+                         num_render_channels, sample_rate_hz,
+                         num_render_channels);
+      AudioBuffer capture(sample_rate_hz, num_capture_channels, sample_rate_hz,
+                          num_capture_channels, sample_rate_hz,
+                          num_capture_channels);
+      EchoCanceller3 aec3(EchoCanceller3Config(),
+                          /*multichannel_config=*/absl::nullopt,
+                          sample_rate_hz, num_render_channels,
+                          num_capture_channels);
+      EchoSignalGenerator signal_generator(sample_rate_hz, num_render_channels,
+                                           num_capture_channels);
+
+      int64_t render_ns = 0;
+      int64_t capture_ns = 0;
+      for (int frame_index = 0;
+           frame_index < kNumWarmupFrames + kNumMeasuredFrames;
+           ++frame_index) {
+        if (frame_index == kNumWarmupFrames) {
+          render_ns = 0;
+          capture_ns = 0;
+        }
+        signal_generator.Populate(render, capture);
+        aec3.AnalyzeCapture(&capture);
+        if (sample_rate_hz > 16000) {
+          render.SplitIntoFrequencyBands();
+          capture.SplitIntoFrequencyBands();
+        }
+        const int64_t start_ns = rtc::TimeNanos();
+        aec3.AnalyzeRender(&render);
+        const int64_t rendered_ns = rtc::TimeNanos();
+        aec3.ProcessCapture(&capture, /*level_change=*/false);
+        const int64_t processed_ns = rtc::TimeNanos();
+        render_ns += rendered_ns - start_ns;
+        capture_ns += processed_ns - rendered_ns;
+      }
+
+      GetGlobalMetricsLogger()->LogSingleValueMetric(
+          "aec3_render_ns_per_frame", test_case.str(),
+          static_cast<double>(render_ns) / kNumMeasuredFrames, Unit::kUnitless,
+          ImprovementDirection::kSmallerIsBetter);
+      GetGlobalMetricsLogger()->LogSingleValueMetric(
+          "aec3_capture_ns_per_frame", test_case.str(),
+          static_cast<double>(capture_ns) / kNumMeasuredFrames,
+          Unit::kUnitless, ImprovementDirection::kSmallerIsBetter);
+      EXPECT_GT(capture_ns, 0);
+    }
+  }
+}
+
+}  // namespace webrtc
@@ -9,6 +9,7 @@
  */
 #include "modules/audio_processing/aec3/echo_path_delay_estimator.h"
 
+#include <algorithm>
 #include <array>
 
 #include "api/audio/echo_canceller3_config.h"
@@ -47,7 +48,12 @@ EchoPathDelayEstimator::EchoPathDelayEstimator(
           config.delay.detect_pre_echo),
       matched_filter_lag_aggregator_(data_dumper_,
                                      matched_filter_.GetMaxFilterLag(),
-                                     config.delay) {
+                                     config.delay),
+      tracking_search_(config.delay.tracking_search),
+      delay_headroom_(down_sampling_factor_ != 0
+                          ? config.delay.delay_headroom_samples /
+                                down_sampling_factor_
+                          : 0) {
   RTC_DCHECK(data_dumper);
   RTC_DCHECK(down_sampling_factor_ > 0);
 }
@@ -78,6 +84,8 @@ absl::optional<DelayEstimate> EchoPathDelayEstimator::EstimateDelay(
       matched_filter_lag_aggregator_.Aggregate(
           matched_filter_.GetBestLagEstimate());
 
+  UpdateTrackingSearch(aggregated_matched_filter_lag);
+
   // Run clockdrift detection.
   if (aggregated_matched_filter_lag &&
       (*aggregated_matched_filter_lag).quality ==
@@ -119,9 +127,58 @@ void EchoPathDelayEstimator::Reset(bool reset_lag_aggregator,
                                    bool reset_delay_confidence) {
   if (reset_lag_aggregator) {
     matched_filter_lag_aggregator_.Reset(reset_delay_confidence);
+    stable_lag_ = absl::nullopt;
+    stable_lag_blocks_ = 0;
+    matched_filter_.SetTrackedLag(absl::nullopt);
   }
   matched_filter_.Reset(/*full_reset=*/reset_lag_aggregator);
   old_aggregated_lag_ = absl::nullopt;
   consistent_estimate_counter_ = 0;
 }
+
+void EchoPathDelayEstimator::UpdateTrackingSearch(
+    const absl::optional<DelayEstimate>& aggregated_lag) {
+  if (!tracking_search_.enabled) {
+    return;
+  }
+
+  // Blocks without an aggregated lag, e.g., during far-end silence, neither
+  // confirm nor contradict the stable lag.
+  if (!aggregated_lag) {
+    return;
+  }
+  if (aggregated_lag->quality == DelayEstimate::Quality::kRefined &&
+      stable_lag_ == aggregated_lag->delay) {
+    ++stable_lag_blocks_;
+  } else {
+    stable_lag_ =
+        aggregated_lag->quality == DelayEstimate::Quality::kRefined
+            ? absl::optional<size_t>(aggregated_lag->delay)
+            : absl::nullopt;
+    stable_lag_blocks_ = 0;
+  }
+
+  // Any change of the lag immediately restores the full search. Once the lag
+  // is stable, the full search is only done periodically.
+  bool full_search =
+      !stable_lag_ || stable_lag_blocks_ < tracking_search_.stable_blocks;
+  if (!full_search) {
+    const size_t tracking_blocks =
+        stable_lag_blocks_ - tracking_search_.stable_blocks;
+    const size_t interval =
+        std::max<size_t>(tracking_search_.full_search_interval_blocks, 1);
+    full_search = tracking_blocks % interval +
+                      tracking_search_.full_search_duration_blocks >=
+                  interval;
+  }
+  if (full_search) {
+    matched_filter_.SetTrackedLag(absl::nullopt);
+  } else {
+    // The aggregated lag excludes the headroom that the filter lags include.
+    matched_filter_.SetTrackedLag(
+        matched_filter_lag_aggregator_.GetDelayAtHighestPeak() +
+        delay_headroom_);
+  }
+}
+
 }  // namespace webrtc
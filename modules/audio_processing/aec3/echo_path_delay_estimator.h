@@ -15,6 +15,7 @@
 
 #include "absl/types/optional.h"
 #include "api/array_view.h"
+#include "api/audio/echo_canceller3_config.h"
 #include "modules/audio_processing/aec3/alignment_mixer.h"
 #include "modules/audio_processing/aec3/block.h"
 #include "modules/audio_processing/aec3/clockdrift_detector.h"
@@ -27,7 +28,6 @@ namespace webrtc {
 
 class ApmDataDumper;
 struct DownsampledRenderBuffer;
-struct EchoCanceller3Config;
 
 // Estimates the delay of the echo path.
 class EchoPathDelayEstimator {
@@ -71,9 +71,18 @@ class EchoPathDelayEstimator {
   absl::optional<DelayEstimate> old_aggregated_lag_;
   size_t consistent_estimate_counter_ = 0;
   ClockdriftDetector clockdrift_detector_;
+  const EchoCanceller3Config::Delay::TrackingSearch tracking_search_;
+  const size_t delay_headroom_;
+  absl::optional<size_t> stable_lag_;
+  size_t stable_lag_blocks_ = 0;
 
   // Internal reset method with more granularity.
   void Reset(bool reset_lag_aggregator, bool reset_delay_confidence);
+
+  // Restricts the matched filter search to the neighborhood of the aggregated
+  // lag once that has been stable for long enough.
+  void UpdateTrackingSearch(
+      const absl::optional<DelayEstimate>& aggregated_lag);
 };
 }  // namespace webrtc
 
@@ -125,6 +125,59 @@ TEST(EchoPathDelayEstimator, DelayEstimation) {
   }
 }
 
+// Verifies that the delay estimator keeps the delay when it only searches
+// around it, and that it finds a new delay after an echo path change.
+TEST(EchoPathDelayEstimator, DelayEstimationWithTrackingSearch) {
+  constexpr size_t kNumRenderChannels = 1;
+  constexpr size_t kNumCaptureChannels = 1;
+  constexpr int kSampleRateHz = 48000;
+  constexpr size_t kNumBands = NumBandsForRate(kSampleRateHz);
+  Random random_generator(42U);
+  Block render(kNumBands, kNumRenderChannels);
+  Block capture(/*num_bands=*/1, kNumCaptureChannels);
+  ApmDataDumper data_dumper(0);
+  EchoCanceller3Config config;
+  config.delay.delay_headroom_samples = 0;
+  config.delay.num_filters = 10;
+  config.delay.tracking_search.enabled = true;
+  config.delay.tracking_search.stable_blocks = 100;
+  config.delay.tracking_search.full_search_interval_blocks = 200;
+  config.delay.tracking_search.full_search_duration_blocks = 20;
+  std::unique_ptr<RenderDelayBuffer> render_delay_buffer(
+      RenderDelayBuffer::Create(config, kSampleRateHz, kNumRenderChannels));
+  EchoPathDelayEstimator estimator(&data_dumper, config, kNumCaptureChannels);
+
+  bool first_block = true;
+  for (size_t delay_samples : {4000, 200}) {
+    SCOPED_TRACE(ProduceDebugText(delay_samples,
+                                  config.delay.down_sampling_factor));
+    DelayBuffer<float> signal_delay_buffer(delay_samples);
+    // The echo path change is signaled as done by the render delay controller.
+    estimator.Reset(/*reset_delay_confidence=*/false);
+    absl::optional<DelayEstimate> estimated_delay_samples;
+    for (size_t k = 0; k < 1500; ++k) {
+      RandomizeSampleVector(&random_generator,
+                            render.View(/*band=*/0, /*channel=*/0));
+      signal_delay_buffer.Delay(render.View(/*band=*/0, /*channel=*/0),
+                                capture.View(/*band=*/0, /*channel=*/0));
+      render_delay_buffer->Insert(render);
+      if (first_block) {
+        render_delay_buffer->Reset();
+        first_block = false;
+      }
+      render_delay_buffer->PrepareCaptureProcessing();
+      auto estimate = estimator.EstimateDelay(
+          render_delay_buffer->GetDownsampledRenderBuffer(), capture);
+      if (estimate) {
+        estimated_delay_samples = estimate;
+      }
+    }
+
+    ASSERT_TRUE(estimated_delay_samples);
+    EXPECT_NEAR(delay_samples, estimated_delay_samples->delay, kBlockSize);
+  }
+}
+
 // Verifies that the delay estimator does not produce delay estimates for render
 // signals of low level.
 TEST(EchoPathDelayEstimator, NoDelayEstimatesForLowLevelRenderSignals) {
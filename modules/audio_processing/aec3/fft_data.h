@@ -63,6 +63,7 @@ struct FftData {
         power_spectrum[kFftLengthBy2] = re[kFftLengthBy2] * re[kFftLengthBy2] +
                                         im[kFftLengthBy2] * im[kFftLengthBy2];
       } break;
+      case Aec3Optimization::kAvx512:
       case Aec3Optimization::kAvx2:
         SpectrumAVX2(power_spectrum);
         break;
@@ -51,6 +51,12 @@ FilterAnalyzer::FilterAnalyzer(const EchoCanceller3Config& config,
     : data_dumper_(new ApmDataDumper(instance_count_.fetch_add(1) + 1)),
       bounded_erl_(config.ep_strength.bounded_erl),
       default_gain_(config.ep_strength.default_gain),
+      active_render_threshold_(config.render_levels.active_render_limit *
+                               config.render_levels.active_render_limit *
+                               kFftLengthBy2),
+      estimate_filter_tail_(config.filter.length_auto_sizing.enabled),
+      tail_energy_threshold_(
+          config.filter.length_auto_sizing.tail_energy_threshold),
       h_highpass_(num_capture_channels,
                   std::vector<float>(
                       GetTimeDomainLength(config.filter.refined.length_blocks),
@@ -58,6 +64,7 @@ FilterAnalyzer::FilterAnalyzer(const EchoCanceller3Config& config,
       filter_analysis_states_(num_capture_channels,
                               FilterAnalysisState(config)),
       filter_delays_blocks_(num_capture_channels, 0) {
+  render_activity_.reserve(num_capture_channels);
   Reset();
 }
 
@@ -70,6 +77,7 @@ void FilterAnalyzer::Reset() {
     state.Reset(default_gain_);
   }
   std::fill(filter_delays_blocks_.begin(), filter_delays_blocks_.end(), 0);
+  filter_tail_blocks_ = 0;
 }
 
 void FilterAnalyzer::Update(
@@ -91,6 +99,7 @@ void FilterAnalyzer::Update(
   *any_filter_consistent = st_ch0.consistent_estimate;
   *max_echo_path_gain = st_ch0.gain;
   min_filter_delay_blocks_ = filter_delays_blocks_[0];
+  filter_tail_blocks_ = st_ch0.tail_blocks;
   for (size_t ch = 1; ch < filters_time_domain.size(); ++ch) {
     auto& st_ch = filter_analysis_states_[ch];
     *any_filter_consistent =
@@ -98,6 +107,7 @@ void FilterAnalyzer::Update(
     *max_echo_path_gain = std::max(*max_echo_path_gain, st_ch.gain);
     min_filter_delay_blocks_ =
         std::min(min_filter_delay_blocks_, filter_delays_blocks_[ch]);
+    filter_tail_blocks_ = std::max(filter_tail_blocks_, st_ch.tail_blocks);
   }
 }
 
@@ -109,6 +119,21 @@ void FilterAnalyzer::AnalyzeRegion(
   PreProcessFilters(filters_time_domain);
   data_dumper_->DumpRaw("aec3_linear_filter_processed_td", h_highpass_[0]);
 
+  // The render activity only depends on the filter delay, hence it is computed
+  // at most once per delay for all capture channels.
+  render_activity_.clear();
+  auto is_active_render_block = [&](int delay_blocks) {
+    for (const auto& [delay, active] : render_activity_) {
+      if (delay == delay_blocks) {
+        return active;
+      }
+    }
+    const bool active =
+        IsActiveRenderBlock(render_buffer.GetBlock(-delay_blocks));
+    render_activity_.emplace_back(delay_blocks, active);
+    return active;
+  };
+
   constexpr float kOneByBlockSize = 1.f / kBlockSize;
   for (size_t ch = 0; ch < filters_time_domain.size(); ++ch) {
     RTC_DCHECK_LT(region_.start_sample_, filters_time_domain[ch].size());
@@ -126,14 +151,31 @@ void FilterAnalyzer::AnalyzeRegion(
     UpdateFilterGain(h_highpass_[ch], &st_ch);
     st_ch.filter_length_blocks =
         filters_time_domain[ch].size() * kOneByBlockSize;
+    if (estimate_filter_tail_) {
+      UpdateFilterTail(h_highpass_[ch], &st_ch);
+    }
 
+    const int delay_blocks = filter_delays_blocks_[ch];
     st_ch.consistent_estimate = st_ch.consistent_filter_detector.Detect(
         h_highpass_[ch], region_,
-        render_buffer.GetBlock(-filter_delays_blocks_[ch]), st_ch.peak_index,
-        filter_delays_blocks_[ch]);
+        [&] { return is_active_render_block(delay_blocks); }, st_ch.peak_index,
+        delay_blocks);
   }
 }
 
+bool FilterAnalyzer::IsActiveRenderBlock(const Block& x_block) const {
+  for (int ch = 0; ch < x_block.NumChannels(); ++ch) {
+    rtc::ArrayView<const float, kBlockSize> x_channel =
+        x_block.View(/*band=*/0, ch);
+    const float x_energy = std::inner_product(
+        x_channel.begin(), x_channel.end(), x_channel.begin(), 0.f);
+    if (x_energy > active_render_threshold_) {
+      return true;
+    }
+  }
+  return false;
+}
+
 void FilterAnalyzer::UpdateFilterGain(
     rtc::ArrayView<const float> filter_time_domain,
     FilterAnalysisState* st) {
@@ -154,6 +196,32 @@ void FilterAnalyzer::UpdateFilterGain(
   }
 }
 
+void FilterAnalyzer::UpdateFilterTail(
+    rtc::ArrayView<const float> filter_time_domain,
+    FilterAnalysisState* st) {
+  // Only the energies of the blocks in the analyzed region have changed. The
+  // blocks added by a growing filter are zero until they are analyzed.
+  st->block_energies.resize(filter_time_domain.size() >> kBlockSizeLog2, 0.f);
+  for (size_t block = region_.start_sample_ >> kBlockSizeLog2;
+       block <= region_.end_sample_ >> kBlockSizeLog2; ++block) {
+    const float* h = &filter_time_domain[block * kBlockSize];
+    st->block_energies[block] =
+        std::inner_product(h, h + kBlockSize, h, 0.f);
+  }
+
+  const float max_energy =
+      *std::max_element(st->block_energies.begin(), st->block_energies.end());
+  const float threshold = tail_energy_threshold_ * max_energy;
+  st->tail_blocks = 0;
+  for (int block = static_cast<int>(st->block_energies.size()); block > 0;
+       --block) {
+    if (st->block_energies[block - 1] > threshold) {
+      st->tail_blocks = block;
+      break;
+    }
+  }
+}
+
 void FilterAnalyzer::PreProcessFilters(
     rtc::ArrayView<const std::vector<float>> filters_time_domain) {
   for (size_t ch = 0; ch < filters_time_domain.size(); ++ch) {
@@ -201,11 +269,7 @@ void FilterAnalyzer::SetRegionToAnalyze(size_t filter_size) {
   RTC_DCHECK_LE(r.start_sample_, r.end_sample_);
 }
 
-FilterAnalyzer::ConsistentFilterDetector::ConsistentFilterDetector(
-    const EchoCanceller3Config& config)
-    : active_render_threshold_(config.render_levels.active_render_limit *
-                               config.render_levels.active_render_limit *
-                               kFftLengthBy2) {
+FilterAnalyzer::ConsistentFilterDetector::ConsistentFilterDetector() {
   Reset();
 }
 
@@ -222,7 +286,7 @@ void FilterAnalyzer::ConsistentFilterDetector::Reset() {
 bool FilterAnalyzer::ConsistentFilterDetector::Detect(
     rtc::ArrayView<const float> filter_to_analyze,
     const FilterRegion& region,
-    const Block& x_block,
+    rtc::FunctionView<bool()> is_active_render_block,
     size_t peak_index,
     int delay_blocks) {
   if (region.start_sample_ == 0) {
@@ -262,20 +326,8 @@ bool FilterAnalyzer::ConsistentFilterDetector::Detect(
   }
 
   if (significant_peak_) {
-    bool active_render_block = false;
-    for (int ch = 0; ch < x_block.NumChannels(); ++ch) {
-      rtc::ArrayView<const float, kBlockSize> x_channel =
-          x_block.View(/*band=*/0, ch);
-      const float x_energy = std::inner_product(
-          x_channel.begin(), x_channel.end(), x_channel.begin(), 0.f);
-      if (x_energy > active_render_threshold_) {
-        active_render_block = true;
-        break;
-      }
-    }
-
     if (consistent_delay_reference_ == delay_blocks) {
-      if (active_render_block) {
+      if (is_active_render_block()) {
         ++consistent_estimate_counter_;
       }
     } else {
@@ -16,9 +16,11 @@
 #include <array>
 #include <atomic>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "api/array_view.h"
+#include "api/function_view.h"
 #include "api/audio/echo_canceller3_config.h"
 #include "modules/audio_processing/aec3/aec3_common.h"
 #include "modules/audio_processing/aec3/block.h"
@@ -60,6 +62,12 @@ class FilterAnalyzer {
     return filter_analysis_states_[0].filter_length_blocks;
   }
 
+  // Returns the number of blocks from the start of the filters up to the last
+  // block holding a significant part of the filter energy, for the filter
+  // with the longest such tail. Only estimated when the filter length
+  // auto-sizing is enabled, and otherwise 0.
+  int FilterTailBlocks() const { return filter_tail_blocks_; }
+
   // Returns the preprocessed filter.
   rtc::ArrayView<const std::vector<float>> GetAdjustedFilters() const {
     return h_highpass_;
@@ -75,8 +83,13 @@ class FilterAnalyzer {
       rtc::ArrayView<const std::vector<float>> filters_time_domain,
       const RenderBuffer& render_buffer);
 
+  // Returns whether any channel of the render block is active.
+  bool IsActiveRenderBlock(const Block& x_block) const;
+
   void UpdateFilterGain(rtc::ArrayView<const float> filters_time_domain,
                         FilterAnalysisState* st);
+  void UpdateFilterTail(rtc::ArrayView<const float> filter_time_domain,
+                        FilterAnalysisState* st);
   void PreProcessFilters(
       rtc::ArrayView<const std::vector<float>> filters_time_domain);
 
@@ -91,11 +104,11 @@ class FilterAnalyzer {
   // consistent over time.
   class ConsistentFilterDetector {
    public:
-    explicit ConsistentFilterDetector(const EchoCanceller3Config& config);
+    ConsistentFilterDetector();
     void Reset();
     bool Detect(rtc::ArrayView<const float> filter_to_analyze,
                 const FilterRegion& region,
-                const Block& x_block,
+                rtc::FunctionView<bool()> is_active_render_block,
                 size_t peak_index,
                 int delay_blocks);
 
@@ -105,27 +118,30 @@ class FilterAnalyzer {
     float filter_secondary_peak_;
     size_t filter_floor_low_limit_;
     size_t filter_floor_high_limit_;
-    const float active_render_threshold_;
     size_t consistent_estimate_counter_ = 0;
     int consistent_delay_reference_ = -10;
   };
 
   struct FilterAnalysisState {
     explicit FilterAnalysisState(const EchoCanceller3Config& config)
-        : filter_length_blocks(config.filter.refined_initial.length_blocks),
-          consistent_filter_detector(config) {
+        : filter_length_blocks(config.filter.refined_initial.length_blocks) {
+      block_energies.reserve(config.filter.refined.length_blocks);
       Reset(config.ep_strength.default_gain);
     }
 
     void Reset(float default_gain) {
       peak_index = 0;
       gain = default_gain;
+      tail_blocks = 0;
+      block_energies.clear();
       consistent_filter_detector.Reset();
     }
 
     float gain;
     size_t peak_index;
     int filter_length_blocks;
+    int tail_blocks;
+    std::vector<float> block_energies;
     bool consistent_estimate = false;
     ConsistentFilterDetector consistent_filter_detector;
   };
@@ -134,6 +150,9 @@ class FilterAnalyzer {
   std::unique_ptr<ApmDataDumper> data_dumper_;
   const bool bounded_erl_;
   const float default_gain_;
+  const float active_render_threshold_;
+  const bool estimate_filter_tail_;
+  const float tail_energy_threshold_;
   std::vector<std::vector<float>> h_highpass_;
 
   size_t blocks_since_reset_ = 0;
@@ -141,8 +160,11 @@ class FilterAnalyzer {
 
   std::vector<FilterAnalysisState> filter_analysis_states_;
   std::vector<int> filter_delays_blocks_;
+  // Render activity per filter delay, valid during `AnalyzeRegion()`.
+  std::vector<std::pair<int, bool>> render_activity_;
 
   int min_filter_delay_blocks_ = 0;
+  int filter_tail_blocks_ = 0;
 };
 
 }  // namespace webrtc
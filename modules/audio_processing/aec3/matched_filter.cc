@@ -680,6 +680,7 @@ MatchedFilter::MatchedFilter(ApmDataDumper* data_dumper,
       filters_(
           num_matched_filters,
           std::vector<float>(window_size_sub_blocks * sub_block_size_, 0.f)),
+      last_searched_filter_(num_matched_filters - 1),
       filters_offsets_(num_matched_filters, 0),
       excitation_limit_(excitation_limit),
       smoothing_fast_(smoothing_fast),
@@ -725,6 +726,30 @@ void MatchedFilter::Reset(bool full_reset) {
   }
 }
 
+void MatchedFilter::SetTrackedLag(absl::optional<size_t> lag) {
+  first_searched_filter_ = 0;
+  last_searched_filter_ = static_cast<int>(filters_.size()) - 1;
+  if (!lag) {
+    return;
+  }
+
+  // The filters covering a lag are adjacent since they are uniformly spaced.
+  int first_filter = -1;
+  int last_filter = -1;
+  for (int n = 0; n < static_cast<int>(filters_.size()); ++n) {
+    const size_t alignment_shift = n * filter_intra_lag_shift_;
+    if (*lag >= alignment_shift &&
+        *lag < alignment_shift + filters_[n].size()) {
+      first_filter = first_filter < 0 ? n : first_filter;
+      last_filter = n;
+    }
+  }
+  if (first_filter >= 0) {
+    first_searched_filter_ = first_filter;
+    last_searched_filter_ = last_filter;
+  }
+}
+
 void MatchedFilter::Update(const DownsampledRenderBuffer& render_buffer,
                            rtc::ArrayView<const float> capture,
                            bool use_slow_smoothing) {
@@ -747,11 +772,10 @@ void MatchedFilter::Update(const DownsampledRenderBuffer& render_buffer,
   float winner_error_sum = error_sum_anchor;
   winner_lag_ = absl::nullopt;
   reported_lag_estimate_ = absl::nullopt;
-  size_t alignment_shift = 0;
+  size_t alignment_shift = first_searched_filter_ * filter_intra_lag_shift_;
   absl::optional<size_t> previous_lag_estimate;
-  const int num_filters = static_cast<int>(filters_.size());
   int winner_index = -1;
-  for (int n = 0; n < num_filters; ++n) {
+  for (int n = first_searched_filter_; n <= last_searched_filter_; ++n) {
     float error_sum = 0.f;
     bool filters_updated = false;
     const bool compute_pre_echo =
@@ -775,6 +799,12 @@ void MatchedFilter::Update(const DownsampledRenderBuffer& render_buffer,
             filters_[n], &filters_updated, &error_sum, compute_pre_echo,
             instantaneous_accumulated_error_, scratch_memory_);
         break;
+      case Aec3Optimization::kAvx512:
+        aec3::MatchedFilterCore_AVX512(
+            x_start_index, x2_sum_threshold, smoothing, render_buffer.buffer, y,
+            filters_[n], &filters_updated, &error_sum, compute_pre_echo,
+            instantaneous_accumulated_error_, scratch_memory_);
+        break;
 #endif
 #if defined(WEBRTC_HAS_NEON)
       case Aec3Optimization::kNeon:
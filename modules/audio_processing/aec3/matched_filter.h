@@ -73,6 +73,19 @@ void MatchedFilterCore_AVX2(size_t x_start_index,
                             rtc::ArrayView<float> accumulated_error,
                             rtc::ArrayView<float> scratch_memory);
 
+// Filter core for the matched filter that is optimized for AVX-512.
+void MatchedFilterCore_AVX512(size_t x_start_index,
+                              float x2_sum_threshold,
+                              float smoothing,
+                              rtc::ArrayView<const float> x,
+                              rtc::ArrayView<const float> y,
+                              rtc::ArrayView<float> h,
+                              bool* filters_updated,
+                              float* error_sum,
+                              bool compute_accumulated_error,
+                              rtc::ArrayView<float> accumulated_error,
+                              rtc::ArrayView<float> scratch_memory);
+
 #endif
 
 // Filter core for the matched filter.
@@ -137,6 +150,10 @@ class MatchedFilter {
   // Resets the matched filter.
   void Reset(bool full_reset);
 
+  // Restricts the updates to the filters covering `lag`, or lets all filters
+  // be updated if `lag` is not set.
+  void SetTrackedLag(absl::optional<size_t> lag);
+
   // Returns the current lag estimates.
   absl::optional<const MatchedFilter::LagEstimate> GetBestLagEstimate() const {
     return reported_lag_estimate_;
@@ -175,6 +192,8 @@ class MatchedFilter {
   absl::optional<MatchedFilter::LagEstimate> reported_lag_estimate_;
   absl::optional<size_t> winner_lag_;
   int last_detected_best_lag_filter_ = -1;
+  int first_searched_filter_ = 0;
+  int last_searched_filter_;
   std::vector<size_t> filters_offsets_;
   int number_pre_echo_updates_ = 0;
   const float excitation_limit_;
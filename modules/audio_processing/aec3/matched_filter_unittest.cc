@@ -219,6 +219,55 @@ TEST_P(MatchedFilterTest, TestAvx2Optimizations) {
   }
 }
 
+TEST_P(MatchedFilterTest, TestAvx512Optimizations) {
+  bool use_avx512 = (GetCPUInfo(kAVX512) != 0);
+  const bool kComputeAccumulatederror = GetParam();
+  if (use_avx512) {
+    Random random_generator(42U);
+    constexpr float kSmoothing = 0.7f;
+    for (auto down_sampling_factor : kDownSamplingFactors) {
+      const size_t sub_block_size = kBlockSize / down_sampling_factor;
+      std::vector<float> x(2000);
+      RandomizeSampleVector(&random_generator, x);
+      std::vector<float> y(sub_block_size);
+      std::vector<float> h_AVX512(512);
+      std::vector<float> h(512);
+      std::vector<float> accumulated_error(512 / 4);
+      std::vector<float> accumulated_error_AVX512(512 / 4);
+      std::vector<float> scratch_memory(512);
+      int x_index = 0;
+      for (int k = 0; k < 1000; ++k) {
+        RandomizeSampleVector(&random_generator, y);
+        bool filters_updated = false;
+        float error_sum = 0.f;
+        bool filters_updated_AVX512 = false;
+        float error_sum_AVX512 = 0.f;
+        MatchedFilterCore_AVX512(x_index, h.size() * 150.f * 150.f, kSmoothing,
+                                 x, y, h_AVX512, &filters_updated_AVX512,
+                                 &error_sum_AVX512, kComputeAccumulatederror,
+                                 accumulated_error_AVX512, scratch_memory);
+        MatchedFilterCore(x_index, h.size() * 150.f * 150.f, kSmoothing, x, y,
+                          h, &filters_updated, &error_sum,
+                          kComputeAccumulatederror, accumulated_error);
+        EXPECT_EQ(filters_updated, filters_updated_AVX512);
+        EXPECT_NEAR(error_sum, error_sum_AVX512, error_sum / 100000.f);
+        for (size_t j = 0; j < h.size(); ++j) {
+          EXPECT_NEAR(h[j], h_AVX512[j], 0.00001f);
+        }
+        for (size_t j = 0; j < accumulated_error.size(); j += 4) {
+          float difference =
+              std::abs(accumulated_error[j] - accumulated_error_AVX512[j]);
+          float relative_difference = accumulated_error[j] > 0
+                                          ? difference / accumulated_error[j]
+                                          : difference;
+          EXPECT_NEAR(relative_difference, 0.0f, 0.00001f);
+        }
+        x_index = (x_index + sub_block_size) % x.size();
+      }
+    }
+  }
+}
+
 #endif
 
 // Verifies that the (optimized) function MaxSquarePeakIndex() produces output
@@ -315,6 +364,69 @@ TEST_P(MatchedFilterTest, LagEstimation) {
   }
 }
 
+// Verifies that a tracked lag restricts the lag estimation to the filters
+// covering it.
+TEST_P(MatchedFilterTest, TrackedLagEstimation) {
+  const bool kDetectPreEcho = GetParam();
+  constexpr size_t kNumChannels = 1;
+  constexpr int kSampleRateHz = 48000;
+  constexpr size_t kNumBands = NumBandsForRate(kSampleRateHz);
+  constexpr size_t kDownSamplingFactor = 4;
+  constexpr size_t kSubBlockSize = kBlockSize / kDownSamplingFactor;
+  constexpr size_t kDelaySamples = 800;
+
+  for (size_t tracked_lag : {kDelaySamples, size_t{100}}) {
+    SCOPED_TRACE(tracked_lag);
+    Random random_generator(42U);
+    Block render(kNumBands, kNumChannels);
+    std::vector<float> capture(kBlockSize, 0.f);
+    ApmDataDumper data_dumper(0);
+    EchoCanceller3Config config;
+    config.delay.down_sampling_factor = kDownSamplingFactor;
+    config.delay.num_filters = kNumMatchedFilters;
+    Decimator capture_decimator(kDownSamplingFactor);
+    DelayBuffer<float> signal_delay_buffer(kDownSamplingFactor *
+                                           kDelaySamples);
+    MatchedFilter filter(
+        &data_dumper, DetectOptimization(), kSubBlockSize,
+        kWindowSizeSubBlocks, kNumMatchedFilters, kAlignmentShiftSubBlocks, 150,
+        config.delay.delay_estimate_smoothing,
+        config.delay.delay_estimate_smoothing_delay_found,
+        config.delay.delay_candidate_detection_threshold, kDetectPreEcho);
+    filter.SetTrackedLag(tracked_lag);
+    std::unique_ptr<RenderDelayBuffer> render_delay_buffer(
+        RenderDelayBuffer::Create(config, kSampleRateHz, kNumChannels));
+
+    for (size_t k = 0; k < 600 + kDelaySamples / kSubBlockSize; ++k) {
+      RandomizeSampleVector(&random_generator,
+                            render.View(/*band=*/0, /*channel=*/0));
+      signal_delay_buffer.Delay(render.View(/*band=*/0, /*channel=*/0),
+                                capture);
+      render_delay_buffer->Insert(render);
+      if (k == 0) {
+        render_delay_buffer->Reset();
+      }
+      render_delay_buffer->PrepareCaptureProcessing();
+      std::array<float, kBlockSize> downsampled_capture_data;
+      rtc::ArrayView<float> downsampled_capture(downsampled_capture_data.data(),
+                                                kSubBlockSize);
+      capture_decimator.Decimate(capture, downsampled_capture);
+      filter.Update(render_delay_buffer->GetDownsampledRenderBuffer(),
+                    downsampled_capture, /*use_slow_smoothing=*/false);
+    }
+
+    auto lag_estimate = filter.GetBestLagEstimate();
+    if (tracked_lag == kDelaySamples) {
+      ASSERT_TRUE(lag_estimate.has_value());
+      EXPECT_EQ(kDelaySamples, lag_estimate->lag);
+    } else {
+      // None of the searched filters covers the delay.
+      EXPECT_TRUE(!lag_estimate.has_value() ||
+                  lag_estimate->lag != kDelaySamples);
+    }
+  }
+}
+
 // Test the pre echo estimation.
 TEST_P(MatchedFilterTest, PreEchoEstimation) {
   const bool kDetectPreEcho = GetParam();
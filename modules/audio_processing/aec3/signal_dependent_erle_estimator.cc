@@ -145,7 +145,8 @@ SignalDependentErleEstimator::SignalDependentErleEstimator(
           num_capture_channels,
           std::vector<std::array<float, kSubbands>>(num_sections_)),
       num_updates_(num_capture_channels),
-      n_active_sections_(num_capture_channels) {
+      n_active_sections_(num_capture_channels),
+      X2_sections_(num_sections_) {
   RTC_DCHECK_LE(num_sections_, num_blocks_);
   RTC_DCHECK_GE(num_sections_, 1);
   Reset();
@@ -342,51 +343,73 @@ void SignalDependentErleEstimator::UpdateCorrectionFactors(
   }
 }
 
-void SignalDependentErleEstimator::ComputeEchoEstimatePerFilterSection(
+void SignalDependentErleEstimator::ComputeRenderPowerPerFilterSection(
     const RenderBuffer& render_buffer,
-    rtc::ArrayView<const std::vector<std::array<float, kFftLengthBy2Plus1>>>
-        filter_frequency_responses) {
+    size_t num_blocks) {
   const SpectrumBuffer& spectrum_render_buffer =
       render_buffer.GetSpectrumBuffer();
   const size_t num_render_channels = spectrum_render_buffer.buffer[0].size();
-  const size_t num_capture_channels = S2_section_accum_.size();
   const float one_by_num_render_channels = 1.f / num_render_channels;
 
+  size_t idx_render = render_buffer.Position();
+  idx_render = spectrum_render_buffer.OffsetIndex(
+      idx_render, section_boundaries_blocks_[0]);
+
+  for (size_t section = 0; section < num_sections_; ++section) {
+    std::array<float, kFftLengthBy2Plus1>& X2_section = X2_sections_[section];
+    X2_section.fill(0.f);
+    const size_t block_limit =
+        std::min(section_boundaries_blocks_[section + 1], num_blocks);
+    for (size_t block = section_boundaries_blocks_[section];
+         block < block_limit; ++block) {
+      for (size_t render_ch = 0;
+           render_ch < spectrum_render_buffer.buffer[idx_render].size();
+           ++render_ch) {
+        for (size_t k = 0; k < X2_section.size(); ++k) {
+          X2_section[k] +=
+              spectrum_render_buffer.buffer[idx_render][render_ch][k] *
+              one_by_num_render_channels;
+        }
+      }
+      idx_render = spectrum_render_buffer.IncIndex(idx_render);
+    }
+  }
+}
+
+void SignalDependentErleEstimator::ComputeEchoEstimatePerFilterSection(
+    const RenderBuffer& render_buffer,
+    rtc::ArrayView<const std::vector<std::array<float, kFftLengthBy2Plus1>>>
+        filter_frequency_responses) {
+  const size_t num_capture_channels = S2_section_accum_.size();
+
   RTC_DCHECK_EQ(S2_section_accum_.size(), filter_frequency_responses.size());
 
+  // The render power of the sections only depends on the filter length, hence
+  // it is only recomputed for capture channels with another filter length.
+  size_t X2_sections_num_blocks = 0;
   for (size_t capture_ch = 0; capture_ch < num_capture_channels; ++capture_ch) {
     RTC_DCHECK_EQ(S2_section_accum_[capture_ch].size() + 1,
                   section_boundaries_blocks_.size());
-    size_t idx_render = render_buffer.Position();
-    idx_render = spectrum_render_buffer.OffsetIndex(
-        idx_render, section_boundaries_blocks_[0]);
+    const size_t num_blocks = filter_frequency_responses[capture_ch].size();
+    if (capture_ch == 0 || num_blocks != X2_sections_num_blocks) {
+      ComputeRenderPowerPerFilterSection(render_buffer, num_blocks);
+      X2_sections_num_blocks = num_blocks;
+    }
 
     for (size_t section = 0; section < num_sections_; ++section) {
-      std::array<float, kFftLengthBy2Plus1> X2_section;
       std::array<float, kFftLengthBy2Plus1> H2_section;
-      X2_section.fill(0.f);
       H2_section.fill(0.f);
       const size_t block_limit =
-          std::min(section_boundaries_blocks_[section + 1],
-                   filter_frequency_responses[capture_ch].size());
+          std::min(section_boundaries_blocks_[section + 1], num_blocks);
       for (size_t block = section_boundaries_blocks_[section];
            block < block_limit; ++block) {
-        for (size_t render_ch = 0;
-             render_ch < spectrum_render_buffer.buffer[idx_render].size();
-             ++render_ch) {
-          for (size_t k = 0; k < X2_section.size(); ++k) {
-            X2_section[k] +=
-                spectrum_render_buffer.buffer[idx_render][render_ch][k] *
-                one_by_num_render_channels;
-          }
-        }
         std::transform(H2_section.begin(), H2_section.end(),
                        filter_frequency_responses[capture_ch][block].begin(),
                        H2_section.begin(), std::plus<float>());
-        idx_render = spectrum_render_buffer.IncIndex(idx_render);
       }
 
-      std::transform(X2_section.begin(), X2_section.end(), H2_section.begin(),
+      std::transform(X2_sections_[section].begin(),
+                     X2_sections_[section].end(), H2_section.begin(),
                      S2_section_accum_[capture_ch][section].begin(),
                      std::multiplies<float>());
     }
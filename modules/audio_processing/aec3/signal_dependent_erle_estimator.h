@@ -73,6 +73,11 @@ class SignalDependentErleEstimator {
       rtc::ArrayView<const std::array<float, kFftLengthBy2Plus1>> E2,
       const std::vector<bool>& converged_filters);
 
+  // Computes the render power in each filter section, for filters of
+  // `num_blocks` blocks, into `X2_sections_`.
+  void ComputeRenderPowerPerFilterSection(const RenderBuffer& render_buffer,
+                                          size_t num_blocks);
+
   void ComputeEchoEstimatePerFilterSection(
       const RenderBuffer& render_buffer,
       rtc::ArrayView<const std::vector<std::array<float, kFftLengthBy2Plus1>>>
@@ -97,6 +102,7 @@ class SignalDependentErleEstimator {
   std::vector<std::vector<std::array<float, kSubbands>>> correction_factors_;
   std::vector<std::array<int, kSubbands>> num_updates_;
   std::vector<std::array<size_t, kFftLengthBy2Plus1>> n_active_sections_;
+  std::vector<std::array<float, kFftLengthBy2Plus1>> X2_sections_;
 };
 
 }  // namespace webrtc
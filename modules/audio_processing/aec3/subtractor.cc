@@ -48,6 +48,25 @@ void PredictionError(const Aec3Fft& fft,
   }
 }
 
+// Returns true if the render FFTs of the `num_partitions` most recent render
+// blocks are zero in all render channels.
+bool RenderIsZero(const RenderBuffer& render_buffer, size_t num_partitions) {
+  rtc::ArrayView<const std::vector<FftData>> fft_buffer =
+      render_buffer.GetFftBuffer();
+  const auto is_zero = [](float a) { return a == 0.f; };
+  size_t position = render_buffer.Position();
+  for (size_t p = 0; p < num_partitions; ++p) {
+    for (const FftData& X : fft_buffer[position]) {
+      if (!std::all_of(X.re.begin(), X.re.end(), is_zero) ||
+          !std::all_of(X.im.begin(), X.im.end(), is_zero)) {
+        return false;
+      }
+    }
+    position = position < fft_buffer.size() - 1 ? position + 1 : 0;
+  }
+  return true;
+}
+
 void ScaleFilterOutput(rtc::ArrayView<const float> y,
                        float factor,
                        rtc::ArrayView<float> e,
@@ -150,6 +169,7 @@ void Subtractor::HandleEchoPathChange(
       coarse_filter_[ch]->SetSizePartitions(
           config_.filter.coarse_initial.length_blocks, true);
     }
+    auto_sizing_active_ = false;
   };
 
   if (echo_path_variability.delay_change !=
@@ -173,6 +193,50 @@ void Subtractor::ExitInitialState() {
     coarse_filter_[ch]->SetSizePartitions(config_.filter.coarse.length_blocks,
                                           false);
   }
+  auto_sizing_active_ = config_.filter.length_auto_sizing.enabled;
+  auto_sized_length_blocks_ = config_.filter.refined.length_blocks;
+  blocks_since_size_change_ = 0;
+  auto_sizing_shrink_counter_ = 0;
+}
+
+void Subtractor::AutoSizeFilters(const AecState& aec_state) {
+  const auto& sizing = config_.filter.length_auto_sizing;
+  ++blocks_since_size_change_;
+  if (!aec_state.UsableLinearEstimate() || aec_state.FilterTailBlocks() == 0) {
+    auto_sizing_shrink_counter_ = 0;
+    return;
+  }
+
+  const size_t length_blocks = rtc::SafeClamp(
+      static_cast<size_t>(aec_state.FilterTailBlocks()) + sizing.margin_blocks,
+      sizing.min_length_blocks, config_.filter.refined.length_blocks);
+  if (length_blocks < auto_sized_length_blocks_) {
+    // Shrink only once the echo path tail has stayed short for a while.
+    if (++auto_sizing_shrink_counter_ < sizing.shrink_hold_blocks) {
+      return;
+    }
+  } else {
+    auto_sizing_shrink_counter_ = 0;
+    if (length_blocks == auto_sized_length_blocks_) {
+      return;
+    }
+  }
+  // Let any ongoing size transition complete before the next one.
+  if (blocks_since_size_change_ <
+      config_.filter.config_change_duration_blocks) {
+    return;
+  }
+
+  auto_sized_length_blocks_ = length_blocks;
+  blocks_since_size_change_ = 0;
+  auto_sizing_shrink_counter_ = 0;
+  for (size_t ch = 0; ch < num_capture_channels_; ++ch) {
+    refined_filters_[ch]->SetSizePartitions(auto_sized_length_blocks_, false);
+    coarse_filter_[ch]->SetSizePartitions(
+        std::min(config_.filter.coarse.length_blocks,
+                 auto_sized_length_blocks_),
+        false);
+  }
 }
 
 void Subtractor::Process(const RenderBuffer& render_buffer,
@@ -182,6 +246,10 @@ void Subtractor::Process(const RenderBuffer& render_buffer,
                          rtc::ArrayView<SubtractorOutput> outputs) {
   RTC_DCHECK_EQ(num_capture_channels_, capture.NumChannels());
 
+  if (auto_sizing_active_) {
+    AutoSizeFilters(aec_state);
+  }
+
   // Compute the render powers.
   const bool same_filter_sizes = refined_filters_[0]->SizePartitions() ==
                                  coarse_filter_[0]->SizePartitions();
@@ -202,6 +270,15 @@ void Subtractor::Process(const RenderBuffer& render_buffer,
                                &X2_coarse);
   }
 
+  // When the render signal is zero throughout the filters, e.g., during
+  // far-end silence, the filter outputs and the updates of the filter
+  // partitions are zero. The filtering and the partition updates are then
+  // skipped while the filters are kept for when the render signal resumes.
+  const bool zero_render =
+      RenderIsZero(render_buffer,
+                   std::max(refined_filters_[0]->max_filter_size_partitions(),
+                            coarse_filter_[0]->max_filter_size_partitions()));
+
   // Process all capture channels
   for (size_t ch = 0; ch < num_capture_channels_; ++ch) {
     SubtractorOutput& output = outputs[ch];
@@ -215,11 +292,18 @@ void Subtractor::Process(const RenderBuffer& render_buffer,
     FftData& G = S;
 
     // Form the outputs of the refined and coarse filters.
-    refined_filters_[ch]->Filter(render_buffer, &S);
-    PredictionError(fft_, S, y, &e_refined, &output.s_refined);
+    if (zero_render) {
+      std::copy(y.begin(), y.end(), e_refined.begin());
+      std::copy(y.begin(), y.end(), e_coarse.begin());
+      output.s_refined.fill(0.f);
+      output.s_coarse.fill(0.f);
+    } else {
+      refined_filters_[ch]->Filter(render_buffer, &S);
+      PredictionError(fft_, S, y, &e_refined, &output.s_refined);
 
-    coarse_filter_[ch]->Filter(render_buffer, &S);
-    PredictionError(fft_, S, y, &e_coarse, &output.s_coarse);
+      coarse_filter_[ch]->Filter(render_buffer, &S);
+      PredictionError(fft_, S, y, &e_coarse, &output.s_coarse);
+    }
 
     // Compute the signal powers in the subtractor output.
     output.ComputeMetrics(y);
@@ -265,8 +349,13 @@ void Subtractor::Process(const RenderBuffer& render_buffer,
       G.re.fill(0.f);
       G.im.fill(0.f);
     }
-    refined_filters_[ch]->Adapt(render_buffer, G,
-                                &refined_impulse_responses_[ch]);
+    if (zero_render) {
+      refined_filters_[ch]->AdaptWithZeroRender(
+          &refined_impulse_responses_[ch]);
+    } else {
+      refined_filters_[ch]->Adapt(render_buffer, G,
+                                  &refined_impulse_responses_[ch]);
+    }
     refined_filters_[ch]->ComputeFrequencyResponse(
         &refined_frequency_responses_[ch]);
 
@@ -299,8 +388,15 @@ void Subtractor::Process(const RenderBuffer& render_buffer,
 
     if (ApmDataDumper::IsAvailable()) {
       RTC_DCHECK_LT(ch, coarse_impulse_responses_.size());
-      coarse_filter_[ch]->Adapt(render_buffer, G,
-                                &coarse_impulse_responses_[ch]);
+      if (zero_render) {
+        coarse_filter_[ch]->AdaptWithZeroRender(
+            &coarse_impulse_responses_[ch]);
+      } else {
+        coarse_filter_[ch]->Adapt(render_buffer, G,
+                                  &coarse_impulse_responses_[ch]);
+      }
+    } else if (zero_render) {
+      coarse_filter_[ch]->AdaptWithZeroRender();
     } else {
       coarse_filter_[ch]->Adapt(render_buffer, G);
     }
@@ -94,6 +94,10 @@ class Subtractor {
   }
 
  private:
+  // Shrinks the filters to the estimated echo path tail, or grows them back,
+  // when the filter length auto-sizing is active.
+  void AutoSizeFilters(const AecState& aec_state);
+
   class FilterMisadjustmentEstimator {
    public:
     FilterMisadjustmentEstimator() = default;
@@ -143,6 +147,10 @@ class Subtractor {
       refined_frequency_responses_;
   std::vector<std::vector<float>> refined_impulse_responses_;
   std::vector<std::vector<float>> coarse_impulse_responses_;
+  bool auto_sizing_active_ = false;
+  size_t auto_sized_length_blocks_ = 0;
+  size_t blocks_since_size_change_ = 0;
+  size_t auto_sizing_shrink_counter_ = 0;
 };
 
 }  // namespace webrtc
@@ -253,6 +253,160 @@ TEST(Subtractor, NonConvergenceOnUncorrelatedSignals) {
   }
 }
 
+// Verifies that the echo is not subtracted while the render signal is zero,
+// and that the filters are kept for when the render signal resumes.
+TEST(Subtractor, FiltersKeptDuringZeroRender) {
+  constexpr int kSampleRateHz = 48000;
+  constexpr size_t kNumBands = NumBandsForRate(kSampleRateHz);
+  constexpr int kDelaySamples = 64;
+  ApmDataDumper data_dumper(42);
+  EchoCanceller3Config config;
+  config.delay.default_delay = 1;
+  Subtractor subtractor(config, /*num_render_channels=*/1,
+                        /*num_capture_channels=*/1, &data_dumper,
+                        DetectOptimization());
+  std::unique_ptr<RenderDelayBuffer> render_delay_buffer(
+      RenderDelayBuffer::Create(config, kSampleRateHz,
+                                /*num_render_channels=*/1));
+  RenderSignalAnalyzer render_signal_analyzer(config);
+  AecState aec_state(config, /*num_capture_channels=*/1);
+  std::vector<std::array<float, kFftLengthBy2Plus1>> Y2(1);
+  std::vector<std::array<float, kFftLengthBy2Plus1>> E2_refined(1);
+  Y2[0].fill(0.f);
+  E2_refined[0].fill(0.f);
+  Block x(kNumBands, /*num_channels=*/1);
+  Block y(/*num_bands=*/1, /*num_channels=*/1);
+  std::vector<SubtractorOutput> output(1);
+  DelayBuffer<float> delay_buffer(kDelaySamples);
+  Random random_generator(42U);
+
+  constexpr size_t kNumActiveBlocks = 2000;
+  constexpr size_t kNumZeroBlocks = 200;
+  for (size_t k = 0; k < 2 * kNumActiveBlocks + kNumZeroBlocks; ++k) {
+    const bool zero_render =
+        k >= kNumActiveBlocks && k < kNumActiveBlocks + kNumZeroBlocks;
+    if (zero_render) {
+      std::fill(x.begin(/*band=*/0, /*channel=*/0),
+                x.end(/*band=*/0, /*channel=*/0), 0.f);
+    } else {
+      RandomizeSampleVector(&random_generator, x.View(/*band=*/0, 0));
+    }
+    delay_buffer.Delay(x.View(/*band=*/0, 0), y.View(/*band=*/0, 0));
+    if (zero_render) {
+      // Only near-end noise is captured.
+      RandomizeSampleVector(&random_generator, y.View(/*band=*/0, 0), 100.f);
+    }
+
+    render_delay_buffer->Insert(x);
+    if (k == 0) {
+      render_delay_buffer->Reset();
+    }
+    render_delay_buffer->PrepareCaptureProcessing();
+    render_signal_analyzer.Update(*render_delay_buffer->GetRenderBuffer(),
+                                  aec_state.MinDirectPathFilterDelay());
+    subtractor.Process(*render_delay_buffer->GetRenderBuffer(), y,
+                       render_signal_analyzer, aec_state, output);
+    aec_state.HandleEchoPathChange(EchoPathVariability(
+        false, EchoPathVariability::DelayAdjustment::kNone, false));
+    aec_state.Update(absl::nullopt, subtractor.FilterFrequencyResponses(),
+                     subtractor.FilterImpulseResponses(),
+                     *render_delay_buffer->GetRenderBuffer(), E2_refined, Y2,
+                     output);
+
+    const float y_power = std::inner_product(
+        y.begin(/*band=*/0, 0), y.end(/*band=*/0, 0), y.begin(/*band=*/0, 0),
+        0.f);
+    const float e_power =
+        std::inner_product(output[0].e_refined.begin(),
+                           output[0].e_refined.end(),
+                           output[0].e_refined.begin(), 0.f);
+    if (k >= kNumActiveBlocks + config.filter.refined.length_blocks &&
+        k < kNumActiveBlocks + kNumZeroBlocks) {
+      // The render signal is zero throughout the filters.
+      EXPECT_EQ(y_power, e_power);
+    } else if (k == kNumActiveBlocks + kNumZeroBlocks + 10 ||
+               k == kNumActiveBlocks - 1) {
+      // The echo is removed right after the render signal resumes.
+      EXPECT_GT(0.1f * y_power, e_power);
+    }
+  }
+}
+
+// Verifies that the filter length auto-sizing shrinks the filters for a short
+// echo path and grows them when the echo path gets longer.
+TEST(Subtractor, FilterLengthAutoSizing) {
+  constexpr int kSampleRateHz = 48000;
+  constexpr size_t kNumBands = NumBandsForRate(kSampleRateHz);
+  ApmDataDumper data_dumper(42);
+  EchoCanceller3Config config;
+  config.delay.default_delay = 1;
+  config.filter.length_auto_sizing.enabled = true;
+  config.filter.length_auto_sizing.shrink_hold_blocks = 100;
+  Subtractor subtractor(config, /*num_render_channels=*/1,
+                        /*num_capture_channels=*/1, &data_dumper,
+                        DetectOptimization());
+  std::unique_ptr<RenderDelayBuffer> render_delay_buffer(
+      RenderDelayBuffer::Create(config, kSampleRateHz,
+                                /*num_render_channels=*/1));
+  RenderSignalAnalyzer render_signal_analyzer(config);
+  AecState aec_state(config, /*num_capture_channels=*/1);
+  std::vector<std::array<float, kFftLengthBy2Plus1>> Y2(1);
+  std::vector<std::array<float, kFftLengthBy2Plus1>> E2_refined(1);
+  Y2[0].fill(0.f);
+  E2_refined[0].fill(0.f);
+  Block x(kNumBands, /*num_channels=*/1);
+  Block y(/*num_bands=*/1, /*num_channels=*/1);
+  std::array<float, kBlockSize> y_late;
+  std::vector<SubtractorOutput> output(1);
+  DelayBuffer<float> delay_buffer(/*delay=*/64);
+  DelayBuffer<float> late_delay_buffer(/*delay=*/224);
+  Random random_generator(42U);
+
+  // The echo path first spans two blocks, and then four blocks.
+  constexpr int kNumShortEchoPathBlocks = 4000;
+  constexpr int kNumLongEchoPathBlocks = 4000;
+  const size_t max_length = GetTimeDomainLength(
+      config.filter.refined.length_blocks);
+  size_t short_echo_path_length = max_length;
+  for (int k = 0; k < kNumShortEchoPathBlocks + kNumLongEchoPathBlocks; ++k) {
+    RandomizeSampleVector(&random_generator, x.View(/*band=*/0, 0));
+    delay_buffer.Delay(x.View(/*band=*/0, 0), y.View(/*band=*/0, 0));
+    late_delay_buffer.Delay(x.View(/*band=*/0, 0), y_late);
+    if (k >= kNumShortEchoPathBlocks) {
+      rtc::ArrayView<float, kBlockSize> y_view = y.View(/*band=*/0, 0);
+      for (size_t i = 0; i < kBlockSize; ++i) {
+        y_view[i] += 0.5f * y_late[i];
+      }
+    }
+
+    render_delay_buffer->Insert(x);
+    if (k == 0) {
+      render_delay_buffer->Reset();
+    }
+    render_delay_buffer->PrepareCaptureProcessing();
+    render_signal_analyzer.Update(*render_delay_buffer->GetRenderBuffer(),
+                                  aec_state.MinDirectPathFilterDelay());
+    if (aec_state.TransitionTriggered()) {
+      subtractor.ExitInitialState();
+    }
+    subtractor.Process(*render_delay_buffer->GetRenderBuffer(), y,
+                       render_signal_analyzer, aec_state, output);
+    aec_state.HandleEchoPathChange(EchoPathVariability(
+        false, EchoPathVariability::DelayAdjustment::kNone, false));
+    aec_state.Update(absl::nullopt, subtractor.FilterFrequencyResponses(),
+                     subtractor.FilterImpulseResponses(),
+                     *render_delay_buffer->GetRenderBuffer(), E2_refined, Y2,
+                     output);
+    if (k == kNumShortEchoPathBlocks - 1) {
+      short_echo_path_length = subtractor.FilterImpulseResponses()[0].size();
+    }
+  }
+
+  EXPECT_LT(short_echo_path_length, max_length);
+  EXPECT_GT(subtractor.FilterImpulseResponses()[0].size(),
+            short_echo_path_length);
+}
+
 class SubtractorMultiChannelUpToEightRender
     : public ::testing::Test,
       public ::testing::WithParamInterface<std::tuple<size_t, size_t>> {};
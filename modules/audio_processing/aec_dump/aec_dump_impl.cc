@@ -126,7 +126,14 @@ void AecDumpImpl::AddAudioProcessingState(const AudioProcessingState& state) {
 }
 
 void AecDumpImpl::WriteCaptureStreamMessage() {
-  PostWriteToFileTask(capture_stream_info_.FetchEvent());
+  worker_queue_->PostTask(
+      [frame = capture_stream_info_.FetchFrame(), this]() mutable {
+        audioproc::Event event;
+        event.set_type(audioproc::Event::STREAM);
+        frame->WriteTo(event.mutable_stream());
+        capture_stream_info_.ReleaseFrame(std::move(frame));
+        WriteToFile(event);
+      });
 }
 
 void AecDumpImpl::WriteRenderStreamMessage(const int16_t* const data,
@@ -200,6 +207,10 @@ void AecDumpImpl::WriteRuntimeSetting(
       setting->set_capture_fixed_post_gain(x);
       break;
     }
+    case AudioProcessing::RuntimeSetting::Type::kCaptureRnnoiseModelReload:
+      // Runtime RNNoise model reloads are ignored, the model file is not
+      // stored in aecdumps.
+      break;
     case AudioProcessing::RuntimeSetting::Type::kCaptureOutputUsed: {
       bool x;
       runtime_setting.GetBool(&x);
@@ -229,29 +240,32 @@ void AecDumpImpl::WriteRuntimeSetting(
 
 void AecDumpImpl::PostWriteToFileTask(std::unique_ptr<audioproc::Event> event) {
   RTC_DCHECK(event);
-  worker_queue_->PostTask([event = std::move(event), this] {
-    std::string event_string = event->SerializeAsString();
-    const size_t event_byte_size = event_string.size();
-
-    if (num_bytes_left_for_log_ >= 0) {
-      const int64_t next_message_size = sizeof(int32_t) + event_byte_size;
-      if (num_bytes_left_for_log_ < next_message_size) {
-        // Ensure that no further events are written, even if they're smaller
-        // than the current event.
-        num_bytes_left_for_log_ = 0;
-        return;
-      }
-      num_bytes_left_for_log_ -= next_message_size;
-    }
+  worker_queue_->PostTask(
+      [event = std::move(event), this] { WriteToFile(*event); });
+}
 
-    // Write message preceded by its size.
-    if (!debug_file_.Write(&event_byte_size, sizeof(int32_t))) {
-      RTC_DCHECK_NOTREACHED();
-    }
-    if (!debug_file_.Write(event_string.data(), event_string.size())) {
-      RTC_DCHECK_NOTREACHED();
+void AecDumpImpl::WriteToFile(const audioproc::Event& event) {
+  std::string event_string = event.SerializeAsString();
+  const size_t event_byte_size = event_string.size();
+
+  if (num_bytes_left_for_log_ >= 0) {
+    const int64_t next_message_size = sizeof(int32_t) + event_byte_size;
+    if (num_bytes_left_for_log_ < next_message_size) {
+      // Ensure that no further events are written, even if they're smaller
+      // than the current event.
+      num_bytes_left_for_log_ = 0;
+      return;
     }
-  });
+    num_bytes_left_for_log_ -= next_message_size;
+  }
+
+  // Write message preceded by its size.
+  if (!debug_file_.Write(&event_byte_size, sizeof(int32_t))) {
+    RTC_DCHECK_NOTREACHED();
+  }
+  if (!debug_file_.Write(event_string.data(), event_string.size())) {
+    RTC_DCHECK_NOTREACHED();
+  }
 }
 
 std::unique_ptr<AecDump> AecDumpFactory::Create(webrtc::FileWrapper file,
@@ -73,6 +73,8 @@ class AecDumpImpl : public AecDump {
 
  private:
   void PostWriteToFileTask(std::unique_ptr<audioproc::Event> event);
+  // Writes `event` to the debug file. Runs on the worker queue.
+  void WriteToFile(const audioproc::Event& event);
 
   FileWrapper debug_file_;
   int64_t num_bytes_left_for_log_ = 0;
@@ -10,52 +10,114 @@
 
 #include "modules/audio_processing/aec_dump/capture_stream_info.h"
 
+#include <utility>
+
 namespace webrtc {
 
-void CaptureStreamInfo::AddInput(const AudioFrameView<const float>& src) {
-  auto* stream = event_->mutable_stream();
+namespace {
+// Maximum number of released frames that are kept for reuse.
+constexpr size_t kMaxFreeFrames = 8;
 
+// Copies the channels of `src` into `dst` and returns the number of channels.
+size_t CopyChannels(const AudioFrameView<const float>& src,
+                    std::vector<std::vector<float>>& dst) {
+  const size_t num_channels = src.num_channels();
+  if (dst.size() < num_channels) {
+    dst.resize(num_channels);
+  }
   for (int i = 0; i < src.num_channels(); ++i) {
     const auto& channel_view = src.channel(i);
-    stream->add_input_channel(channel_view.begin(),
-                              sizeof(float) * channel_view.size());
+    dst[i].assign(channel_view.begin(), channel_view.end());
   }
+  return num_channels;
 }
+}  // namespace
 
-void CaptureStreamInfo::AddOutput(const AudioFrameView<const float>& src) {
-  auto* stream = event_->mutable_stream();
-
-  for (int i = 0; i < src.num_channels(); ++i) {
-    const auto& channel_view = src.channel(i);
-    stream->add_output_channel(channel_view.begin(),
-                               sizeof(float) * channel_view.size());
+void CaptureStreamInfo::Frame::WriteTo(audioproc::Stream* stream) const {
+  for (size_t i = 0; i < num_input_channels_; ++i) {
+    const auto& channel = input_channels_[i];
+    stream->add_input_channel(channel.data(), sizeof(float) * channel.size());
+  }
+  for (size_t i = 0; i < num_output_channels_; ++i) {
+    const auto& channel = output_channels_[i];
+    stream->add_output_channel(channel.data(), sizeof(float) * channel.size());
+  }
+  if (has_input_data_) {
+    stream->set_input_data(input_data_.data(),
+                           sizeof(int16_t) * input_data_.size());
+  }
+  if (has_output_data_) {
+    stream->set_output_data(output_data_.data(),
+                            sizeof(int16_t) * output_data_.size());
+  }
+  if (state_) {
+    stream->set_delay(state_->delay);
+    stream->set_drift(state_->drift);
+    if (state_->applied_input_volume.has_value()) {
+      stream->set_applied_input_volume(*state_->applied_input_volume);
+    }
+    stream->set_keypress(state_->keypress);
   }
 }
 
+void CaptureStreamInfo::Frame::Clear() {
+  num_input_channels_ = 0;
+  num_output_channels_ = 0;
+  has_input_data_ = false;
+  has_output_data_ = false;
+  state_ = absl::nullopt;
+}
+
+CaptureStreamInfo::CaptureStreamInfo() : frame_(std::make_unique<Frame>()) {}
+
+void CaptureStreamInfo::AddInput(const AudioFrameView<const float>& src) {
+  frame_->num_input_channels_ = CopyChannels(src, frame_->input_channels_);
+}
+
+void CaptureStreamInfo::AddOutput(const AudioFrameView<const float>& src) {
+  frame_->num_output_channels_ = CopyChannels(src, frame_->output_channels_);
+}
+
 void CaptureStreamInfo::AddInput(const int16_t* const data,
                                  int num_channels,
                                  int samples_per_channel) {
-  auto* stream = event_->mutable_stream();
-  const size_t data_size = sizeof(int16_t) * samples_per_channel * num_channels;
-  stream->set_input_data(data, data_size);
+  frame_->input_data_.assign(data, data + samples_per_channel * num_channels);
+  frame_->has_input_data_ = true;
 }
 
 void CaptureStreamInfo::AddOutput(const int16_t* const data,
                                   int num_channels,
                                   int samples_per_channel) {
-  auto* stream = event_->mutable_stream();
-  const size_t data_size = sizeof(int16_t) * samples_per_channel * num_channels;
-  stream->set_output_data(data, data_size);
+  frame_->output_data_.assign(data, data + samples_per_channel * num_channels);
+  frame_->has_output_data_ = true;
 }
 
 void CaptureStreamInfo::AddAudioProcessingState(
     const AecDump::AudioProcessingState& state) {
-  auto* stream = event_->mutable_stream();
-  stream->set_delay(state.delay);
-  stream->set_drift(state.drift);
-  if (state.applied_input_volume.has_value()) {
-    stream->set_applied_input_volume(*state.applied_input_volume);
+  frame_->state_ = state;
+}
+
+std::unique_ptr<CaptureStreamInfo::Frame> CaptureStreamInfo::FetchFrame() {
+  std::unique_ptr<Frame> result = std::move(frame_);
+  {
+    MutexLock lock(&free_frames_lock_);
+    if (!free_frames_.empty()) {
+      frame_ = std::move(free_frames_.back());
+      free_frames_.pop_back();
+    }
+  }
+  if (!frame_) {
+    frame_ = std::make_unique<Frame>();
+  }
+  return result;
+}
+
+void CaptureStreamInfo::ReleaseFrame(std::unique_ptr<Frame> frame) {
+  frame->Clear();
+  MutexLock lock(&free_frames_lock_);
+  if (free_frames_.size() < kMaxFreeFrames) {
+    free_frames_.push_back(std::move(frame));
   }
-  stream->set_keypress(state.keypress);
 }
+
 }  // namespace webrtc
@@ -12,10 +12,13 @@
 #define MODULES_AUDIO_PROCESSING_AEC_DUMP_CAPTURE_STREAM_INFO_H_
 
 #include <memory>
-#include <utility>
+#include <vector>
 
+#include "absl/types/optional.h"
 #include "modules/audio_processing/include/aec_dump.h"
 #include "rtc_base/ignore_wundef.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/thread_annotations.h"
 
 // Files generated at build-time by the protobuf compiler.
 RTC_PUSH_IGNORING_WUNDEF()
@@ -28,9 +31,37 @@ RTC_POP_IGNORING_WUNDEF()
 
 namespace webrtc {
 
+// Collects the contents of the capture stream messages. The audio is only
+// copied into reused buffers on the capture thread, and the protobuf message is
+// built from it on the worker.
 class CaptureStreamInfo {
  public:
-  CaptureStreamInfo() { CreateNewEvent(); }
+  // Raw contents of one capture stream message.
+  class Frame {
+   public:
+    // Writes the contents to `stream`.
+    void WriteTo(audioproc::Stream* stream) const;
+
+    // Marks the frame as empty, keeping the allocated buffers.
+    void Clear();
+
+   private:
+    friend class CaptureStreamInfo;
+
+    // The channel buffers are kept when a frame is cleared, so there may be
+    // more of them than channels in the frame.
+    std::vector<std::vector<float>> input_channels_;
+    std::vector<std::vector<float>> output_channels_;
+    size_t num_input_channels_ = 0;
+    size_t num_output_channels_ = 0;
+    bool has_input_data_ = false;
+    bool has_output_data_ = false;
+    std::vector<int16_t> input_data_;
+    std::vector<int16_t> output_data_;
+    absl::optional<AecDump::AudioProcessingState> state_;
+  };
+
+  CaptureStreamInfo();
   CaptureStreamInfo(const CaptureStreamInfo&) = delete;
   CaptureStreamInfo& operator=(const CaptureStreamInfo&) = delete;
   ~CaptureStreamInfo() = default;
@@ -47,18 +78,19 @@ class CaptureStreamInfo {
 
   void AddAudioProcessingState(const AecDump::AudioProcessingState& state);
 
-  std::unique_ptr<audioproc::Event> FetchEvent() {
-    std::unique_ptr<audioproc::Event> result = std::move(event_);
-    CreateNewEvent();
-    return result;
-  }
+  // Returns the collected frame and starts a new one, reusing a frame that has
+  // been released if there is one.
+  std::unique_ptr<Frame> FetchFrame();
+
+  // Returns `frame` for reuse once it has been written. Can be called on any
+  // thread.
+  void ReleaseFrame(std::unique_ptr<Frame> frame);
 
  private:
-  void CreateNewEvent() {
-    event_ = std::make_unique<audioproc::Event>();
-    event_->set_type(audioproc::Event::STREAM);
-  }
-  std::unique_ptr<audioproc::Event> event_;
+  std::unique_ptr<Frame> frame_;
+  Mutex free_frames_lock_;
+  std::vector<std::unique_ptr<Frame>> free_frames_
+      RTC_GUARDED_BY(free_frames_lock_);
 };
 
 }  // namespace webrtc
@@ -21,14 +21,15 @@ namespace {
 // TODO(kma): Re-write the corresponding assembly file, the offset
 // generating script and makefile, to replace these C functions.
 
+// Adds the lanes of `v` to `*ptr`, like the C code accumulates the energies.
 static inline void AddLanes(uint32_t* ptr, uint32x4_t v) {
 #if defined(WEBRTC_ARCH_ARM64)
-  *(ptr) = vaddvq_u32(v);
+  *(ptr) += vaddvq_u32(v);
 #else
   uint32x2_t tmp_v;
   tmp_v = vadd_u32(vget_low_u32(v), vget_high_u32(v));
   tmp_v = vpadd_u32(tmp_v, tmp_v);
-  *(ptr) = vget_lane_u32(tmp_v, 0);
+  *(ptr) += vget_lane_u32(tmp_v, 0);
 #endif
 }
 
@@ -0,0 +1,129 @@
+/*
+ *  Copyright (c) 2012 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <emmintrin.h>
+#include <string.h>
+
+#include "modules/audio_processing/aecm/aecm_core.h"
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+
+namespace {
+
+inline __m128i Load(const void* p) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+}
+
+inline void Store(void* p, __m128i v) {
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);
+}
+
+inline uint32_t AddLanes(__m128i v) {
+  v = _mm_add_epi32(v, _mm_srli_si128(v, 8));
+  v = _mm_add_epi32(v, _mm_srli_si128(v, 4));
+  return static_cast<uint32_t>(_mm_cvtsi128_si32(v));
+}
+
+// Computes the 32 bit products of eight pairs of 16 bit values. The channel
+// gains are never negative, hence the products are computed as unsigned, like
+// in the NEON code.
+inline void MultiplyU16(__m128i a, __m128i b, __m128i* low, __m128i* high) {
+  const __m128i product_low = _mm_mullo_epi16(a, b);
+  const __m128i product_high = _mm_mulhi_epu16(a, b);
+  *low = _mm_unpacklo_epi16(product_low, product_high);
+  *high = _mm_unpackhi_epi16(product_low, product_high);
+}
+
+}  // namespace
+
+void WebRtcAecm_CalcLinearEnergiesSse2(AecmCore* aecm,
+                                       const uint16_t* far_spectrum,
+                                       int32_t* echo_est,
+                                       uint32_t* far_energy,
+                                       uint32_t* echo_energy_adapt,
+                                       uint32_t* echo_energy_stored) {
+  const __m128i zero = _mm_setzero_si128();
+  __m128i far_energy_v = zero;
+  __m128i echo_adapt_v = zero;
+  __m128i echo_stored_v = zero;
+
+  // Get energy for the delayed far end signal and estimated
+  // echo using both stored and adapted channels.
+  for (int i = 0; i < PART_LEN; i += 8) {
+    const __m128i spectrum_v = Load(&far_spectrum[i]);
+    const __m128i adapt_v = Load(&aecm->channelAdapt16[i]);
+    const __m128i stored_v = Load(&aecm->channelStored[i]);
+
+    far_energy_v =
+        _mm_add_epi32(far_energy_v, _mm_unpacklo_epi16(spectrum_v, zero));
+    far_energy_v =
+        _mm_add_epi32(far_energy_v, _mm_unpackhi_epi16(spectrum_v, zero));
+
+    __m128i echo_est_v_low, echo_est_v_high;
+    MultiplyU16(stored_v, spectrum_v, &echo_est_v_low, &echo_est_v_high);
+    Store(&echo_est[i], echo_est_v_low);
+    Store(&echo_est[i + 4], echo_est_v_high);
+    echo_stored_v = _mm_add_epi32(echo_stored_v, echo_est_v_low);
+    echo_stored_v = _mm_add_epi32(echo_stored_v, echo_est_v_high);
+
+    __m128i echo_adapt_v_low, echo_adapt_v_high;
+    MultiplyU16(adapt_v, spectrum_v, &echo_adapt_v_low, &echo_adapt_v_high);
+    echo_adapt_v = _mm_add_epi32(echo_adapt_v, echo_adapt_v_low);
+    echo_adapt_v = _mm_add_epi32(echo_adapt_v, echo_adapt_v_high);
+  }
+
+  *far_energy += AddLanes(far_energy_v);
+  *echo_energy_stored += AddLanes(echo_stored_v);
+  *echo_energy_adapt += AddLanes(echo_adapt_v);
+
+  echo_est[PART_LEN] = WEBRTC_SPL_MUL_16_U16(aecm->channelStored[PART_LEN],
+                                             far_spectrum[PART_LEN]);
+  *echo_energy_stored += (uint32_t)echo_est[PART_LEN];
+  *far_energy += (uint32_t)far_spectrum[PART_LEN];
+  *echo_energy_adapt += aecm->channelAdapt16[PART_LEN] * far_spectrum[PART_LEN];
+}
+
+void WebRtcAecm_StoreAdaptiveChannelSse2(AecmCore* aecm,
+                                         const uint16_t* far_spectrum,
+                                         int32_t* echo_est) {
+  // During startup we store the channel every block.
+  memcpy(aecm->channelStored, aecm->channelAdapt16,
+         sizeof(int16_t) * PART_LEN1);
+  // Recalculate echo estimate.
+  for (int i = 0; i < PART_LEN; i += 8) {
+    __m128i echo_est_v_low, echo_est_v_high;
+    MultiplyU16(Load(&aecm->channelStored[i]), Load(&far_spectrum[i]),
+                &echo_est_v_low, &echo_est_v_high);
+    Store(&echo_est[i], echo_est_v_low);
+    Store(&echo_est[i + 4], echo_est_v_high);
+  }
+  echo_est[PART_LEN] = WEBRTC_SPL_MUL_16_U16(aecm->channelStored[PART_LEN],
+                                             far_spectrum[PART_LEN]);
+}
+
+void WebRtcAecm_ResetAdaptiveChannelSse2(AecmCore* aecm) {
+  // The stored channel has a significantly lower MSE than the adaptive one for
+  // two consecutive calculations. Reset the adaptive channel.
+  memcpy(aecm->channelAdapt16, aecm->channelStored,
+         sizeof(int16_t) * PART_LEN1);
+  // Restore the W32 channel. Interleaving with zeros shifts each value left by
+  // 16 bits.
+  const __m128i zero = _mm_setzero_si128();
+  for (int i = 0; i < PART_LEN; i += 8) {
+    const __m128i stored_v = Load(&aecm->channelStored[i]);
+    Store(&aecm->channelAdapt32[i], _mm_unpacklo_epi16(zero, stored_v));
+    Store(&aecm->channelAdapt32[i + 4], _mm_unpackhi_epi16(zero, stored_v));
+  }
+  aecm->channelAdapt32[PART_LEN] = (int32_t)aecm->channelStored[PART_LEN]
+                                   << 16;
+}
+
+}  // namespace webrtc
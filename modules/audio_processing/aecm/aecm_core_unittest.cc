@@ -0,0 +1,95 @@
+/*
+ *  Copyright (c) 2024 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_processing/aecm/aecm_core.h"
+
+#include <array>
+#include <random>
+
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+class AecmCoreTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    aecm_ = WebRtcAecm_CreateCore();
+    ASSERT_TRUE(aecm_);
+    ASSERT_EQ(0, WebRtcAecm_InitCore(aecm_, 16000));
+    // The channel gains are never negative.
+    std::uniform_int_distribution<int> channel(0, 32767);
+    std::uniform_int_distribution<int> spectrum(0, 65535);
+    for (int i = 0; i < PART_LEN1; ++i) {
+      aecm_->channelStored[i] = static_cast<int16_t>(channel(generator_));
+      aecm_->channelAdapt16[i] = static_cast<int16_t>(channel(generator_));
+      far_spectrum_[i] = static_cast<uint16_t>(spectrum(generator_));
+    }
+  }
+
+  void TearDown() override { WebRtcAecm_FreeCore(aecm_); }
+
+  std::mt19937 generator_{42};
+  AecmCore* aecm_ = nullptr;
+  std::array<uint16_t, PART_LEN1> far_spectrum_;
+  // Aligned like in `WebRtcAecm_ProcessBlock()`.
+  alignas(32) std::array<int32_t, PART_LEN1 + 8> echo_est_;
+};
+
+// Checks that the optimized linear energies computation, if any, is bit-exact
+// with the generic C code.
+TEST_F(AecmCoreTest, CalcLinearEnergiesIsBitExact) {
+  uint32_t far_energy = 0;
+  uint32_t echo_energy_adapt = 0;
+  uint32_t echo_energy_stored = 0;
+  WebRtcAecm_CalcLinearEnergies(aecm_, far_spectrum_.data(), echo_est_.data(),
+                                &far_energy, &echo_energy_adapt,
+                                &echo_energy_stored);
+  uint32_t expected_far_energy = 0;
+  uint32_t expected_echo_energy_adapt = 0;
+  uint32_t expected_echo_energy_stored = 0;
+  for (int i = 0; i < PART_LEN1; ++i) {
+    const int32_t expected_echo_est =
+        WEBRTC_SPL_MUL_16_U16(aecm_->channelStored[i], far_spectrum_[i]);
+    EXPECT_EQ(expected_echo_est, echo_est_[i]);
+    expected_far_energy += far_spectrum_[i];
+    expected_echo_energy_adapt += aecm_->channelAdapt16[i] * far_spectrum_[i];
+    expected_echo_energy_stored += static_cast<uint32_t>(expected_echo_est);
+  }
+  EXPECT_EQ(expected_far_energy, far_energy);
+  EXPECT_EQ(expected_echo_energy_adapt, echo_energy_adapt);
+  EXPECT_EQ(expected_echo_energy_stored, echo_energy_stored);
+}
+
+// Checks that the optimized adaptive channel storage, if any, is bit-exact
+// with the generic C code.
+TEST_F(AecmCoreTest, StoreAdaptiveChannelIsBitExact) {
+  WebRtcAecm_StoreAdaptiveChannel(aecm_, far_spectrum_.data(),
+                                  echo_est_.data());
+  for (int i = 0; i < PART_LEN1; ++i) {
+    EXPECT_EQ(aecm_->channelAdapt16[i], aecm_->channelStored[i]);
+    EXPECT_EQ(WEBRTC_SPL_MUL_16_U16(aecm_->channelAdapt16[i], far_spectrum_[i]),
+              echo_est_[i]);
+  }
+}
+
+// Checks that the optimized adaptive channel reset, if any, is bit-exact with
+// the generic C code.
+TEST_F(AecmCoreTest, ResetAdaptiveChannelIsBitExact) {
+  WebRtcAecm_ResetAdaptiveChannel(aecm_);
+  for (int i = 0; i < PART_LEN1; ++i) {
+    EXPECT_EQ(aecm_->channelStored[i], aecm_->channelAdapt16[i]);
+    EXPECT_EQ(static_cast<int32_t>(aecm_->channelStored[i]) << 16,
+              aecm_->channelAdapt32[i]);
+  }
+}
+
+}  // namespace
+}  // namespace webrtc
@@ -14,6 +14,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <utility>
 
 #include "modules/audio_processing/agc2/vector_float_frame.h"
 #include "rtc_base/gunit.h"
@@ -90,4 +91,35 @@ TEST(AutomaticGainController2GainApplier, RampingIsDone) {
   EXPECT_NEAR(next_fake_audio_frame.float_frame_view().channel(0)[0],
               initial_signal_level * target_gain_factor, 0.1f);
 }
+TEST(AutomaticGainController2GainApplier,
+     RampingIsTheSameForAllChannelsAndClipped) {
+  constexpr float initial_signal_level = 20000.f;
+  constexpr int num_channels = 8;
+  GainApplier gain_applier(true, /*initial_gain_factor=*/1.f);
+
+  // The gain ramp must follow changes of the frame size.
+  float last_gain_factor = 1.f;
+  for (const auto& [samples_per_channel, gain_factor] :
+       {std::pair<int, float>{160, 2.f}, std::pair<int, float>{480, 0.5f}}) {
+    VectorFloatFrame fake_audio(num_channels, samples_per_channel,
+                                initial_signal_level);
+    gain_applier.SetGainFactor(gain_factor);
+    gain_applier.ApplyGain(fake_audio.float_frame_view());
+
+    const float increment =
+        (gain_factor - last_gain_factor) / samples_per_channel;
+    for (int channel = 0; channel < num_channels; ++channel) {
+      rtc::ArrayView<const float> channel_view =
+          fake_audio.float_frame_view().channel(channel);
+      float gain = last_gain_factor;
+      for (int i = 0; i < samples_per_channel; ++i) {
+        EXPECT_FLOAT_EQ(channel_view[i],
+                        std::min(initial_signal_level * gain, 32767.f));
+        gain += increment;
+      }
+    }
+    last_gain_factor = gain_factor;
+  }
+}
+
 }  // namespace webrtc
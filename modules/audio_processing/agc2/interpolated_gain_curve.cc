@@ -10,8 +10,7 @@
 
 #include "modules/audio_processing/agc2/interpolated_gain_curve.h"
 
-#include <algorithm>
-#include <iterator>
+#include <array>
 
 #include "absl/strings/string_view.h"
 #include "modules/audio_processing/agc2/agc2_common.h"
@@ -30,6 +29,9 @@ constexpr std::array<float, kInterpolatedGainCurveTotalPoints>
 constexpr std::array<float, kInterpolatedGainCurveTotalPoints>
     InterpolatedGainCurve::approximation_params_q_;
 
+constexpr float InterpolatedGainCurve::kLookUpBinSize;
+constexpr int InterpolatedGainCurve::kNumLookUpBins;
+
 InterpolatedGainCurve::InterpolatedGainCurve(
     ApmDataDumper* apm_data_dumper,
     absl::string_view histogram_name_prefix)
@@ -47,7 +49,17 @@ InterpolatedGainCurve::InterpolatedGainCurve(
            << histogram_name_prefix
            << ".FixedDigitalGainCurveRegion.Saturation")
               .str()),
-      apm_data_dumper_(apm_data_dumper) {}
+      apm_data_dumper_(apm_data_dumper) {
+  for (int bin = 0; bin < kNumLookUpBins; ++bin) {
+    const float bin_start = approximation_params_x_[0] + bin * kLookUpBinSize;
+    int index = 0;
+    while (index < kInterpolatedGainCurveTotalPoints - 1 &&
+           approximation_params_x_[index + 1] < bin_start) {
+      ++index;
+    }
+    piece_index_look_up_[bin] = index;
+  }
+}
 
 InterpolatedGainCurve::~InterpolatedGainCurve() {
   if (stats_.available) {
@@ -163,8 +175,8 @@ void InterpolatedGainCurve::UpdateStats(float input_level) const {
 // falls.
 // For the identity and the saturation regions the cost is O(1).
 // For the other regions, namely knee and limiter, the cost is
-// O(2 + log2(`LightkInterpolatedGainCurveTotalPoints`), plus O(1) for the
-// linear interpolation (one product and one sum).
+// O(1) too since the linear piece is found with a look-up table, plus O(1) for
+// the linear interpolation (one product and one sum).
 float InterpolatedGainCurve::LookUpGainToApply(float input_level) const {
   UpdateStats(input_level);
 
@@ -180,16 +192,25 @@ float InterpolatedGainCurve::LookUpGainToApply(float input_level) const {
     return 32768.f / input_level;
   }
 
-  // Knee and limiter regions; find the linear piece index. Spelling
-  // out the complete type was the only way to silence both the clang
-  // plugin and the windows compilers.
-  std::array<float, kInterpolatedGainCurveTotalPoints>::const_iterator it =
-      std::lower_bound(approximation_params_x_.begin(),
-                       approximation_params_x_.end(), input_level);
-  const size_t index = std::distance(approximation_params_x_.begin(), it) - 1;
-  RTC_DCHECK_LE(0, index);
+  // Knee and limiter regions; find the linear piece index, i.e., the index of
+  // the last piece starting below `input_level`. Since the bins are narrower
+  // than the pieces, the piece found in the look-up table is at most one
+  // piece off.
+  constexpr float kOneByLookUpBinSize = 1.f / kLookUpBinSize;
+  const int bin = static_cast<int>((input_level - approximation_params_x_[0]) *
+                                   kOneByLookUpBinSize);
+  RTC_DCHECK_LE(0, bin);
+  RTC_DCHECK_LT(bin, kNumLookUpBins);
+  size_t index = piece_index_look_up_[bin];
+  if (index < approximation_params_x_.size() - 1 &&
+      approximation_params_x_[index + 1] < input_level) {
+    ++index;
+  } else if (index > 0 && approximation_params_x_[index] >= input_level) {
+    // Only reached by rounding errors in the bin computation.
+    --index;
+  }
   RTC_DCHECK_LT(index, approximation_params_m_.size());
-  RTC_DCHECK_LE(approximation_params_x_[index], input_level);
+  RTC_DCHECK_LT(approximation_params_x_[index], input_level);
   if (index < approximation_params_m_.size() - 1) {
     RTC_DCHECK_LE(input_level, approximation_params_x_[index + 1]);
   }
@@ -79,6 +79,8 @@ class InterpolatedGainCurve {
   // ComputeInterpolatedGainCurve.
   FRIEND_TEST_ALL_PREFIXES(GainController2InterpolatedGainCurve,
                            CheckApproximationParams);
+  FRIEND_TEST_ALL_PREFIXES(GainController2InterpolatedGainCurve,
+                           CheckLookUpOfLinearPieces);
 
   struct RegionLogger {
     metrics::Histogram* identity_histogram;
@@ -143,6 +145,18 @@ class InterpolatedGainCurve {
            1.659391283988952637, 1.645209431648254395, 1.631297469139099121,
            1.617647409439086914, 1.604251742362976074}};
 
+  // Input level range covered by each entry of `piece_index_look_up_`, which
+  // is smaller than the spacing of `approximation_params_x_`.
+  static constexpr float kLookUpBinSize = 64.f;
+  static constexpr int kNumLookUpBins =
+      static_cast<int>((kMaxInputLevelLinear - approximation_params_x_[0]) /
+                       kLookUpBinSize) +
+      1;
+
+  // For each bin of input levels above `approximation_params_x_[0]`, the
+  // index of the last linear piece starting below the bin.
+  std::array<int, kNumLookUpBins> piece_index_look_up_;
+
   // Stats.
   mutable Stats stats_;
 };
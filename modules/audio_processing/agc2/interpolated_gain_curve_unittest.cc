@@ -10,7 +10,10 @@
 
 #include "modules/audio_processing/agc2/interpolated_gain_curve.h"
 
+#include <algorithm>
 #include <array>
+#include <cmath>
+#include <iterator>
 #include <type_traits>
 #include <vector>
 
@@ -200,4 +203,33 @@ TEST(GainController2InterpolatedGainCurve, CheckApproximationParams) {
   }
 }
 
+// Checks that the linear pieces found with the look-up table are the ones
+// found by searching the starts of the pieces, including around the starts.
+TEST(GainController2InterpolatedGainCurve, CheckLookUpOfLinearPieces) {
+  InterpolatedGainCurve igc(&apm_data_dumper, "");
+  const auto& x = igc.approximation_params_x_;
+
+  std::vector<float> levels;
+  for (float level = x[0]; level < kMaxInputLevelLinear; level += 0.37f) {
+    levels.push_back(level);
+  }
+  for (float x_i : x) {
+    levels.push_back(x_i);
+    levels.push_back(std::nextafter(x_i, 0.f));
+    levels.push_back(std::nextafter(x_i, kMaxInputLevelLinear));
+  }
+
+  for (float level : levels) {
+    if (level <= x[0] || level >= kMaxInputLevelLinear) {
+      continue;
+    }
+    const size_t index =
+        std::distance(x.begin(), std::lower_bound(x.begin(), x.end(), level)) -
+        1;
+    const float expected_gain = igc.approximation_params_m_[index] * level +
+                                igc.approximation_params_q_[index];
+    EXPECT_EQ(expected_gain, igc.LookUpGainToApply(level)) << level;
+  }
+}
+
 }  // namespace webrtc
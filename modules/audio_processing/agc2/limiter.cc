@@ -20,7 +20,6 @@
 #include "modules/audio_processing/logging/apm_data_dumper.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/numerics/safe_conversions.h"
-#include "rtc_base/numerics/safe_minmax.h"
 
 namespace webrtc {
 namespace {
@@ -80,8 +79,10 @@ void ScaleSamples(rtc::ArrayView<const float> per_sample_scaling_factors,
   for (int i = 0; i < signal.num_channels(); ++i) {
     rtc::ArrayView<float> channel = signal.channel(i);
     for (int j = 0; j < samples_per_channel; ++j) {
-      channel[j] = rtc::SafeClamp(channel[j] * per_sample_scaling_factors[j],
-                                  kMinFloatS16Value, kMaxFloatS16Value);
+      channel[j] = std::min(
+          std::max(channel[j] * per_sample_scaling_factors[j],
+                   kMinFloatS16Value),
+          kMaxFloatS16Value);
     }
   }
 }
@@ -105,7 +106,8 @@ Limiter::Limiter(int sample_rate_hz,
 
 Limiter::~Limiter() = default;
 
-void Limiter::Process(AudioFrameView<float> signal) {
+rtc::ArrayView<const float> Limiter::ComputeScalingFactors(
+    AudioFrameView<const float> signal) {
   const std::array<float, kSubFramesInFrame> level_estimate =
       level_estimator_.ComputeLevel(signal);
 
@@ -123,7 +125,6 @@ void Limiter::Process(AudioFrameView<float> signal) {
       &per_sample_scaling_factors_[0], samples_per_channel);
   ComputePerSampleSubframeFactors(scaling_factors_, samples_per_channel,
                                   per_sample_scaling_factors);
-  ScaleSamples(per_sample_scaling_factors, signal);
 
   last_scaling_factor_ = scaling_factors_.back();
 
@@ -133,6 +134,12 @@ void Limiter::Process(AudioFrameView<float> signal) {
   apm_data_dumper_->DumpRaw(
       "agc2_limiter_region",
       static_cast<int>(interp_gain_curve_.get_stats().region));
+
+  return per_sample_scaling_factors;
+}
+
+void Limiter::Process(AudioFrameView<float> signal) {
+  ScaleSamples(ComputeScalingFactors(signal), signal);
 }
 
 InterpolatedGainCurve::Stats Limiter::GetGainCurveStats() const {
@@ -14,6 +14,7 @@
 #include <vector>
 
 #include "absl/strings/string_view.h"
+#include "api/array_view.h"
 #include "modules/audio_processing/agc2/fixed_digital_level_estimator.h"
 #include "modules/audio_processing/agc2/interpolated_gain_curve.h"
 #include "modules/audio_processing/include/audio_frame_view.h"
@@ -32,6 +33,13 @@ class Limiter {
 
   // Applies limiter and hard-clipping to `signal`.
   void Process(AudioFrameView<float> signal);
+
+  // Updates the limiter state with `signal` like `Process()` does, but instead
+  // of scaling `signal` returns the per-sample scaling factors to apply to all
+  // its channels before hard-clipping. The returned view is valid until the
+  // next call.
+  rtc::ArrayView<const float> ComputeScalingFactors(
+      AudioFrameView<const float> signal);
   InterpolatedGainCurve::Stats GetGainCurveStats() const;
 
   // Supported rates must be
@@ -10,6 +10,8 @@
 
 #include "modules/audio_processing/agc2/limiter.h"
 
+#include <algorithm>
+
 #include "common_audio/include/audio_util.h"
 #include "modules/audio_processing/agc2/agc2_common.h"
 #include "modules/audio_processing/agc2/agc2_testing_common.h"
@@ -57,4 +59,35 @@ TEST(Limiter, OutputVolumeAboveThreshold) {
   }
 }
 
+TEST(Limiter, ScalingFactorsMatchProcess) {
+  const int sample_rate_hz = 48000;
+  const float input_level =
+      (kMaxAbsFloatS16Value + DbfsToFloatS16(test::kLimiterMaxInputLevelDbFs)) /
+      2.f;
+  ApmDataDumper apm_data_dumper(0);
+
+  Limiter processing_limiter(sample_rate_hz, &apm_data_dumper, "");
+  Limiter scaling_factors_limiter(sample_rate_hz, &apm_data_dumper, "");
+
+  for (int i = 0; i < 5; ++i) {
+    VectorFloatFrame processed_frame(1, sample_rate_hz / 100, input_level);
+    VectorFloatFrame unprocessed_frame(1, sample_rate_hz / 100, input_level);
+    processing_limiter.Process(processed_frame.float_frame_view());
+    rtc::ArrayView<const float> scaling_factors =
+        scaling_factors_limiter.ComputeScalingFactors(
+            unprocessed_frame.float_frame_view());
+
+    rtc::ArrayView<const float> processed =
+        processed_frame.float_frame_view().channel(0);
+    rtc::ArrayView<const float> unprocessed =
+        unprocessed_frame.float_frame_view().channel(0);
+    ASSERT_EQ(scaling_factors.size(), processed.size());
+    for (size_t k = 0; k < processed.size(); ++k) {
+      EXPECT_EQ(processed[k],
+                std::min(unprocessed[k] * scaling_factors[k],
+                         kMaxFloatS16Value));
+    }
+  }
+}
+
 }  // namespace webrtc
@@ -14,6 +14,7 @@
 
 #include "modules/audio_processing/agc2/rnn_vad/lp_residual.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/numerics/safe_minmax.h"
 
 namespace webrtc {
 namespace rnn_vad {
@@ -52,6 +53,28 @@ void FeaturesExtractor::Reset() {
 bool FeaturesExtractor::CheckSilenceComputeFeatures(
     rtc::ArrayView<const float, kFrameSize10ms24kHz> samples,
     rtc::ArrayView<float, kFeatureVectorSize> feature_vector) {
+  PushSamples(samples);
+  // Extract the LP residual.
+  float lpc_coeffs[kNumLpcCoefficients];
+  ComputeAndPostProcessLpcCoefficients(pitch_buf_24kHz_view_, lpc_coeffs);
+  ComputeLpResidual(lpc_coeffs, pitch_buf_24kHz_view_, lp_residual_view_);
+  // Estimate pitch on the LP-residual.
+  pitch_period_48kHz_ = pitch_estimator_.Estimate(lp_residual_view_);
+  return ComputeFeatures(feature_vector);
+}
+
+bool FeaturesExtractor::CheckSilenceComputeFeatures(
+    rtc::ArrayView<const float, kFrameSize10ms24kHz> samples,
+    int pitch_period_48kHz,
+    rtc::ArrayView<float, kFeatureVectorSize> feature_vector) {
+  PushSamples(samples);
+  pitch_period_48kHz_ =
+      rtc::SafeClamp(pitch_period_48kHz, kMinPitch48kHz, kMaxPitch48kHz);
+  return ComputeFeatures(feature_vector);
+}
+
+void FeaturesExtractor::PushSamples(
+    rtc::ArrayView<const float, kFrameSize10ms24kHz> samples) {
   // Pre-processing.
   if (use_high_pass_filter_) {
     std::array<float, kFrameSize10ms24kHz> samples_filtered;
@@ -62,13 +85,12 @@ bool FeaturesExtractor::CheckSilenceComputeFeatures(
     // Feed buffer with `samples`.
     pitch_buf_24kHz_.Push(samples);
   }
-  // Extract the LP residual.
-  float lpc_coeffs[kNumLpcCoefficients];
-  ComputeAndPostProcessLpcCoefficients(pitch_buf_24kHz_view_, lpc_coeffs);
-  ComputeLpResidual(lpc_coeffs, pitch_buf_24kHz_view_, lp_residual_view_);
-  // Estimate pitch on the LP-residual and write the normalized pitch period
-  // into the output vector (normalization based on training data stats).
-  pitch_period_48kHz_ = pitch_estimator_.Estimate(lp_residual_view_);
+}
+
+bool FeaturesExtractor::ComputeFeatures(
+    rtc::ArrayView<float, kFeatureVectorSize> feature_vector) {
+  // Write the normalized pitch period into the output vector (normalization
+  // based on training data stats).
   feature_vector[kFeatureVectorSize - 2] = 0.01f * (pitch_period_48kHz_ - 300);
   // Extract lagged frames (according to the estimated pitch period).
   RTC_DCHECK_LE(pitch_period_48kHz_ / 2, kMaxPitch24kHz);
@@ -38,8 +38,23 @@ class FeaturesExtractor {
   bool CheckSilenceComputeFeatures(
       rtc::ArrayView<const float, kFrameSize10ms24kHz> samples,
       rtc::ArrayView<float, kFeatureVectorSize> feature_vector);
+  // Like `CheckSilenceComputeFeatures()` above, but uses the pitch period at
+  // 48 kHz estimated on the same signal by another module (e.g., the noise
+  // suppressor) instead of running the pitch search. `pitch_period_48kHz` is
+  // limited to [`kMinPitch48kHz`, `kMaxPitch48kHz`].
+  bool CheckSilenceComputeFeatures(
+      rtc::ArrayView<const float, kFrameSize10ms24kHz> samples,
+      int pitch_period_48kHz,
+      rtc::ArrayView<float, kFeatureVectorSize> feature_vector);
 
  private:
+  // Adds `samples` to the pitch buffer.
+  void PushSamples(rtc::ArrayView<const float, kFrameSize10ms24kHz> samples);
+  // Computes the features for the frames in the pitch buffer and the pitch
+  // period in `pitch_period_48kHz_`; returns true if silence is detected.
+  bool ComputeFeatures(
+      rtc::ArrayView<float, kFeatureVectorSize> feature_vector);
+
   const bool use_high_pass_filter_;
   // TODO(bugs.webrtc.org/7494): Remove HPF depending on how AGC2 is used in APM
   // and on whether an HPF is already used as pre-processing step in APM.
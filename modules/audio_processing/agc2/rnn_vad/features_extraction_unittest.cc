@@ -10,6 +10,7 @@
 
 #include "modules/audio_processing/agc2/rnn_vad/features_extraction.h"
 
+#include <array>
 #include <cmath>
 #include <vector>
 
@@ -98,6 +99,39 @@ TEST(RnnVadTest, FeatureExtractionLowHighPitch) {
   EXPECT_LT(low_pitch_period, high_pitch_period);
 }
 
+// Verifies that the features computed with a given pitch period match those
+// computed with the same period estimated by the pitch search.
+TEST(RnnVadTest, FeatureExtractionWithGivenPitchMatchesPitchSearch) {
+  constexpr float amplitude = 1000.f;
+  constexpr float pitch_hz = 150.f;
+  ASSERT_TRUE(PitchIsValid(pitch_hz));
+
+  const AvailableCpuFeatures cpu_features = GetAvailableCpuFeatures();
+  FeaturesExtractor searching_extractor(cpu_features);
+  FeaturesExtractor given_pitch_extractor(cpu_features);
+  std::vector<float> samples(kNumTestDataSize);
+  CreatePureTone(amplitude, pitch_hz, samples);
+  std::array<float, kFeatureVectorSize> expected_features;
+  std::array<float, kFeatureVectorSize> features;
+  constexpr int pitch_feature_index = kFeatureVectorSize - 2;
+  for (int i = 0; i < kNumTestDataFrames; ++i) {
+    rtc::ArrayView<const float, kFrameSize10ms24kHz> frame(
+        samples.data() + i * kFrameSize10ms24kHz, kFrameSize10ms24kHz);
+    const bool expected_is_silence =
+        searching_extractor.CheckSilenceComputeFeatures(frame,
+                                                        expected_features);
+    // Invert the normalization of the pitch period feature.
+    const int pitch_period_48kHz = static_cast<int>(
+        std::round(100.f * expected_features[pitch_feature_index] + 300.f));
+    ASSERT_EQ(given_pitch_extractor.CheckSilenceComputeFeatures(
+                  frame, pitch_period_48kHz, features),
+              expected_is_silence);
+    if (!expected_is_silence) {
+      EXPECT_EQ(features, expected_features);
+    }
+  }
+}
+
 }  // namespace
 }  // namespace rnn_vad
 }  // namespace webrtc
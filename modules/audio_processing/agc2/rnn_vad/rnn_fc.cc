@@ -31,25 +31,20 @@ std::vector<float> GetScaledParams(rtc::ArrayView<const int8_t> params) {
   return scaled_params;
 }
 
-// TODO(bugs.chromium.org/10480): Hard-code optimized layout and remove this
-// function to improve setup time.
-// Casts and scales `weights` and re-arranges the layout.
-std::vector<float> PreprocessWeights(rtc::ArrayView<const int8_t> weights,
-                                     int output_size) {
-  if (output_size == 1) {
-    return GetScaledParams(weights);
-  }
-  // Transpose, scale and cast.
+// Transposes, casts and packs `weights` (see `VectorMath::PackMatrix()`). The
+// coefficients are not scaled.
+template <typename T>
+std::vector<T> PackWeights(rtc::ArrayView<const int8_t> weights,
+                           int output_size) {
   const int input_size = rtc::CheckedDivExact(
       rtc::dchecked_cast<int>(weights.size()), output_size);
-  std::vector<float> w(weights.size());
+  std::vector<T> w(weights.size());
   for (int o = 0; o < output_size; ++o) {
     for (int i = 0; i < input_size; ++i) {
-      w[o * input_size + i] = rnnoise::kWeightsScale *
-                              static_cast<float>(weights[i * output_size + o]);
+      w[o * input_size + i] = static_cast<T>(weights[i * output_size + o]);
     }
   }
-  return w;
+  return VectorMath::PackMatrix<T>(w, output_size);
 }
 
 rtc::FunctionView<float(float)> GetActivationFunction(
@@ -71,11 +66,15 @@ FullyConnectedLayer::FullyConnectedLayer(
     const rtc::ArrayView<const int8_t> weights,
     ActivationFunction activation_function,
     const AvailableCpuFeatures& cpu_features,
-    absl::string_view layer_name)
+    absl::string_view layer_name,
+    bool int8_weights)
     : input_size_(input_size),
       output_size_(output_size),
       bias_(GetScaledParams(bias)),
-      weights_(PreprocessWeights(weights, output_size)),
+      weights_(int8_weights ? std::vector<float>()
+                            : PackWeights<float>(weights, output_size)),
+      weights_int8_(int8_weights ? PackWeights<int8_t>(weights, output_size)
+                                 : std::vector<int8_t>()),
       vector_math_(cpu_features),
       activation_function_(GetActivationFunction(activation_function)) {
   RTC_DCHECK_LE(output_size_, kFullyConnectedLayerMaxUnits)
@@ -83,7 +82,7 @@ FullyConnectedLayer::FullyConnectedLayer(
   RTC_DCHECK_EQ(output_size_, bias_.size())
       << "Mismatching output size and bias terms array size (" << layer_name
       << ").";
-  RTC_DCHECK_EQ(input_size_ * output_size_, weights_.size())
+  RTC_DCHECK_EQ(input_size_ * output_size_, weights.size())
       << "Mismatching input-output size and weight coefficients array size ("
       << layer_name << ").";
 }
@@ -92,11 +91,17 @@ FullyConnectedLayer::~FullyConnectedLayer() = default;
 
 void FullyConnectedLayer::ComputeOutput(rtc::ArrayView<const float> input) {
   RTC_DCHECK_EQ(input.size(), input_size_);
-  rtc::ArrayView<const float> weights(weights_);
+  rtc::ArrayView<float> output(output_.data(), output_size_);
+  std::copy(bias_.begin(), bias_.end(), output.begin());
+  if (weights_int8_.empty()) {
+    vector_math_.AddPackedMatrixVectorProduct(
+        weights_, ::rnnoise::kWeightsScale, input, output);
+  } else {
+    vector_math_.AddPackedMatrixVectorProduct(
+        weights_int8_, ::rnnoise::kWeightsScale, input, output);
+  }
   for (int o = 0; o < output_size_; ++o) {
-    output_[o] = activation_function_(
-        bias_[o] + vector_math_.DotProduct(
-                       input, weights.subview(o * input_size_, input_size_)));
+    output_[o] = activation_function_(output_[o]);
   }
 }
 
@@ -12,6 +12,7 @@
 #define MODULES_AUDIO_PROCESSING_AGC2_RNN_VAD_RNN_FC_H_
 
 #include <array>
+#include <cstdint>
 #include <vector>
 
 #include "absl/strings/string_view.h"
@@ -34,13 +35,16 @@ constexpr int kFullyConnectedLayerMaxUnits = 24;
 class FullyConnectedLayer {
  public:
   // Ctor. `output_size` cannot be greater than `kFullyConnectedLayerMaxUnits`.
+  // If `int8_weights` is true, the weights are kept as 8-bit coefficients,
+  // which takes a quarter of the memory and gives a bit-exact output.
   FullyConnectedLayer(int input_size,
                       int output_size,
                       rtc::ArrayView<const int8_t> bias,
                       rtc::ArrayView<const int8_t> weights,
                       ActivationFunction activation_function,
                       const AvailableCpuFeatures& cpu_features,
-                      absl::string_view layer_name);
+                      absl::string_view layer_name,
+                      bool int8_weights = false);
   FullyConnectedLayer(const FullyConnectedLayer&) = delete;
   FullyConnectedLayer& operator=(const FullyConnectedLayer&) = delete;
   ~FullyConnectedLayer();
@@ -59,7 +63,10 @@ class FullyConnectedLayer {
   const int input_size_;
   const int output_size_;
   const std::vector<float> bias_;
+  // Unscaled packed weights (see `VectorMath::PackMatrix()`); only the float or
+  // the 8-bit ones are allocated.
   const std::vector<float> weights_;
+  const std::vector<int8_t> weights_int8_;
   const VectorMath vector_math_;
   rtc::FunctionView<float(float)> activation_function_;
   // Over-allocated array with size equal to `output_size_`.
@@ -61,6 +61,27 @@ TEST_P(RnnFcParametrization, CheckFullyConnectedLayerOutput) {
   ExpectNearAbsolute(kFullyConnectedExpectedOutput, fc, 1e-5f);
 }
 
+// Checks that the output of a fully connected layer with 8-bit weights is
+// bit-exact.
+TEST_P(RnnFcParametrization, Int8WeightsAreBitExact) {
+  FullyConnectedLayer fc(kInputLayerInputSize, kInputLayerOutputSize,
+                         kInputDenseBias, kInputDenseWeights,
+                         ActivationFunction::kTansigApproximated,
+                         /*cpu_features=*/GetParam(),
+                         /*layer_name=*/"FC");
+  FullyConnectedLayer fc_int8(kInputLayerInputSize, kInputLayerOutputSize,
+                              kInputDenseBias, kInputDenseWeights,
+                              ActivationFunction::kTansigApproximated,
+                              /*cpu_features=*/GetParam(),
+                              /*layer_name=*/"FC",
+                              /*int8_weights=*/true);
+  fc.ComputeOutput(kFullyConnectedInputVector);
+  fc_int8.ComputeOutput(kFullyConnectedInputVector);
+  for (int o = 0; o < kInputLayerOutputSize; ++o) {
+    EXPECT_EQ(fc.data()[o], fc_int8.data()[o]);
+  }
+}
+
 TEST_P(RnnFcParametrization, DISABLED_BenchmarkFullyConnectedLayer) {
   const AvailableCpuFeatures cpu_features = GetParam();
   FullyConnectedLayer fc(kInputLayerInputSize, kInputLayerOutputSize,
@@ -10,6 +10,9 @@
 
 #include "modules/audio_processing/agc2/rnn_vad/rnn_gru.h"
 
+#include <algorithm>
+
+#include "modules/audio_processing/utility/rational_activations.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/numerics/safe_conversions.h"
 #include "third_party/rnnoise/src/rnn_activations.h"
@@ -43,6 +46,40 @@ std::vector<float> PreprocessGruTensor(rtc::ArrayView<const int8_t> tensor_src,
   return tensor_dst;
 }
 
+// Transposes, casts and packs the weights of each gate (see
+// `VectorMath::PackMatrix()`). The coefficients are not scaled.
+template <typename T>
+std::vector<T> PackGruWeights(rtc::ArrayView<const int8_t> tensor_src,
+                              int output_size) {
+  const int n = rtc::CheckedDivExact(rtc::dchecked_cast<int>(tensor_src.size()),
+                                     output_size * kNumGruGates);
+  const int stride_src = kNumGruGates * output_size;
+  std::vector<T> packed;
+  std::vector<T> gate_weights(output_size * n);
+  for (int g = 0; g < kNumGruGates; ++g) {
+    for (int o = 0; o < output_size; ++o) {
+      for (int i = 0; i < n; ++i) {
+        gate_weights[o * n + i] =
+            static_cast<T>(tensor_src[i * stride_src + g * output_size + o]);
+      }
+    }
+    const std::vector<T> packed_gate_weights =
+        VectorMath::PackMatrix<T>(gate_weights, output_size);
+    packed.insert(packed.end(), packed_gate_weights.begin(),
+                  packed_gate_weights.end());
+  }
+  return packed;
+}
+
+// Returns the size of the packed weights of one gate.
+int GetPackedGateWeightsSize(int input_size, int output_size) {
+  constexpr int kBlockSize = VectorMath::kMatrixBlockSize;
+  return ((output_size + kBlockSize - 1) / kBlockSize) * kBlockSize *
+         input_size;
+}
+
+}  // namespace
+
 // Computes the output for the update or the reset gate.
 // Operation: `g = sigmoid(W^T∙i + R^T∙s + b)` where
 // - `g`: output gate vector
@@ -51,28 +88,24 @@ std::vector<float> PreprocessGruTensor(rtc::ArrayView<const int8_t> tensor_src,
 // - `R`: recurrent weights matrix
 // - `s`: state gate vector
 // - `b`: bias vector
-void ComputeUpdateResetGate(int input_size,
-                            int output_size,
-                            const VectorMath& vector_math,
-                            rtc::ArrayView<const float> input,
-                            rtc::ArrayView<const float> state,
-                            rtc::ArrayView<const float> bias,
-                            rtc::ArrayView<const float> weights,
-                            rtc::ArrayView<const float> recurrent_weights,
-                            rtc::ArrayView<float> gate) {
-  RTC_DCHECK_EQ(input.size(), input_size);
-  RTC_DCHECK_EQ(state.size(), output_size);
-  RTC_DCHECK_EQ(bias.size(), output_size);
-  RTC_DCHECK_EQ(weights.size(), input_size * output_size);
-  RTC_DCHECK_EQ(recurrent_weights.size(), output_size * output_size);
-  RTC_DCHECK_GE(gate.size(), output_size);  // `gate` is over-allocated.
-  for (int o = 0; o < output_size; ++o) {
-    float x = bias[o];
-    x += vector_math.DotProduct(input,
-                                weights.subview(o * input_size, input_size));
-    x += vector_math.DotProduct(
-        state, recurrent_weights.subview(o * output_size, output_size));
-    gate[o] = ::rnnoise::SigmoidApproximated(x);
+void GatedRecurrentLayer::ComputeUpdateResetGate(
+    int gate_index,
+    rtc::ArrayView<const float> input,
+    rtc::ArrayView<float> gate) const {
+  RTC_DCHECK_EQ(input.size(), input_size_);
+  RTC_DCHECK_GE(gate.size(), output_size_);  // `gate` is over-allocated.
+  rtc::ArrayView<float> g(gate.data(), output_size_);
+  std::copy_n(&bias_[gate_index * output_size_], output_size_, g.begin());
+  AddWeightsProduct(gate_index, /*recurrent=*/false, input, g);
+  AddWeightsProduct(gate_index, /*recurrent=*/true,
+                    {state_.data(), static_cast<size_t>(output_size_)}, g);
+  if (rational_sigmoid_) {
+    // Branch-free, hence applied to all the units in a vectorized loop.
+    WebRtcApm_RationalSigmoidInPlace(g.data(), output_size_);
+  } else {
+    for (int o = 0; o < output_size_; ++o) {
+      g[o] = ::rnnoise::SigmoidApproximated(g[o]);
+    }
   }
 }
 
@@ -87,39 +120,54 @@ void ComputeUpdateResetGate(int input_size,
 // - `r`: reset gate vector
 // - `b`: bias vector
 // - `.*` element-wise product
-void ComputeStateGate(int input_size,
-                      int output_size,
-                      const VectorMath& vector_math,
-                      rtc::ArrayView<const float> input,
-                      rtc::ArrayView<const float> update,
-                      rtc::ArrayView<const float> reset,
-                      rtc::ArrayView<const float> bias,
-                      rtc::ArrayView<const float> weights,
-                      rtc::ArrayView<const float> recurrent_weights,
-                      rtc::ArrayView<float> state) {
-  RTC_DCHECK_EQ(input.size(), input_size);
-  RTC_DCHECK_GE(update.size(), output_size);  // `update` is over-allocated.
-  RTC_DCHECK_GE(reset.size(), output_size);   // `reset` is over-allocated.
-  RTC_DCHECK_EQ(bias.size(), output_size);
-  RTC_DCHECK_EQ(weights.size(), input_size * output_size);
-  RTC_DCHECK_EQ(recurrent_weights.size(), output_size * output_size);
-  RTC_DCHECK_EQ(state.size(), output_size);
+void GatedRecurrentLayer::ComputeStateGate(rtc::ArrayView<const float> input,
+                                           rtc::ArrayView<const float> update,
+                                           rtc::ArrayView<const float> reset) {
+  RTC_DCHECK_EQ(input.size(), input_size_);
+  RTC_DCHECK_GE(update.size(), output_size_);  // `update` is over-allocated.
+  RTC_DCHECK_GE(reset.size(), output_size_);   // `reset` is over-allocated.
+  constexpr int kStateGateIndex = 2;
   std::array<float, kGruLayerMaxUnits> reset_x_state;
-  for (int o = 0; o < output_size; ++o) {
-    reset_x_state[o] = state[o] * reset[o];
+  for (int o = 0; o < output_size_; ++o) {
+    reset_x_state[o] = state_[o] * reset[o];
   }
-  for (int o = 0; o < output_size; ++o) {
-    float x = bias[o];
-    x += vector_math.DotProduct(input,
-                                weights.subview(o * input_size, input_size));
-    x += vector_math.DotProduct(
-        {reset_x_state.data(), static_cast<size_t>(output_size)},
-        recurrent_weights.subview(o * output_size, output_size));
-    state[o] = update[o] * state[o] + (1.f - update[o]) * std::max(0.f, x);
+  std::array<float, kGruLayerMaxUnits> x;
+  rtc::ArrayView<float> x_view(x.data(), output_size_);
+  std::copy_n(&bias_[kStateGateIndex * output_size_], output_size_,
+              x_view.begin());
+  AddWeightsProduct(kStateGateIndex, /*recurrent=*/false, input, x_view);
+  AddWeightsProduct(kStateGateIndex, /*recurrent=*/true,
+                    {reset_x_state.data(), static_cast<size_t>(output_size_)},
+                    x_view);
+  for (int o = 0; o < output_size_; ++o) {
+    state_[o] =
+        update[o] * state_[o] + (1.f - update[o]) * std::max(0.f, x[o]);
   }
 }
 
-}  // namespace
+// Adds the product between the (recurrent) weights of the gate with index
+// `gate_index` and `x` to `y`.
+void GatedRecurrentLayer::AddWeightsProduct(int gate_index,
+                                            bool recurrent,
+                                            rtc::ArrayView<const float> x,
+                                            rtc::ArrayView<float> y) const {
+  const int stride =
+      GetPackedGateWeightsSize(recurrent ? output_size_ : input_size_,
+                               output_size_);
+  if (int8_weights_) {
+    rtc::ArrayView<const int8_t> weights(recurrent ? recurrent_weights_int8_
+                                                   : weights_int8_);
+    vector_math_.AddPackedMatrixVectorProduct(
+        weights.subview(gate_index * stride, stride), ::rnnoise::kWeightsScale,
+        x, y);
+  } else {
+    rtc::ArrayView<const float> weights(recurrent ? recurrent_weights_
+                                                  : weights_);
+    vector_math_.AddPackedMatrixVectorProduct(
+        weights.subview(gate_index * stride, stride), ::rnnoise::kWeightsScale,
+        x, y);
+  }
+}
 
 GatedRecurrentLayer::GatedRecurrentLayer(
     const int input_size,
@@ -128,23 +176,35 @@ GatedRecurrentLayer::GatedRecurrentLayer(
     const rtc::ArrayView<const int8_t> weights,
     const rtc::ArrayView<const int8_t> recurrent_weights,
     const AvailableCpuFeatures& cpu_features,
-    absl::string_view layer_name)
+    absl::string_view layer_name,
+    bool rational_sigmoid,
+    bool int8_weights)
     : input_size_(input_size),
       output_size_(output_size),
       bias_(PreprocessGruTensor(bias, output_size)),
-      weights_(PreprocessGruTensor(weights, output_size)),
-      recurrent_weights_(PreprocessGruTensor(recurrent_weights, output_size)),
-      vector_math_(cpu_features) {
+      weights_(int8_weights ? std::vector<float>()
+                            : PackGruWeights<float>(weights, output_size)),
+      recurrent_weights_(
+          int8_weights ? std::vector<float>()
+                       : PackGruWeights<float>(recurrent_weights, output_size)),
+      weights_int8_(int8_weights ? PackGruWeights<int8_t>(weights, output_size)
+                                 : std::vector<int8_t>()),
+      recurrent_weights_int8_(
+          int8_weights ? PackGruWeights<int8_t>(recurrent_weights, output_size)
+                       : std::vector<int8_t>()),
+      vector_math_(cpu_features),
+      rational_sigmoid_(rational_sigmoid),
+      int8_weights_(int8_weights) {
   RTC_DCHECK_LE(output_size_, kGruLayerMaxUnits)
       << "Insufficient GRU layer over-allocation (" << layer_name << ").";
   RTC_DCHECK_EQ(kNumGruGates * output_size_, bias_.size())
       << "Mismatching output size and bias terms array size (" << layer_name
       << ").";
-  RTC_DCHECK_EQ(kNumGruGates * input_size_ * output_size_, weights_.size())
+  RTC_DCHECK_EQ(kNumGruGates * input_size_ * output_size_, weights.size())
       << "Mismatching input-output size and weight coefficients array size ("
       << layer_name << ").";
   RTC_DCHECK_EQ(kNumGruGates * output_size_ * output_size_,
-                recurrent_weights_.size())
+                recurrent_weights.size())
       << "Mismatching input-output size and recurrent weight coefficients array"
          " size ("
       << layer_name << ").";
@@ -159,39 +219,14 @@ void GatedRecurrentLayer::Reset() {
 
 void GatedRecurrentLayer::ComputeOutput(rtc::ArrayView<const float> input) {
   RTC_DCHECK_EQ(input.size(), input_size_);
-
-  // The tensors below are organized as a sequence of flattened tensors for the
-  // `update`, `reset` and `state` gates.
-  rtc::ArrayView<const float> bias(bias_);
-  rtc::ArrayView<const float> weights(weights_);
-  rtc::ArrayView<const float> recurrent_weights(recurrent_weights_);
-  // Strides to access to the flattened tensors for a specific gate.
-  const int stride_weights = input_size_ * output_size_;
-  const int stride_recurrent_weights = output_size_ * output_size_;
-
-  rtc::ArrayView<float> state(state_.data(), output_size_);
-
   // Update gate.
   std::array<float, kGruLayerMaxUnits> update;
-  ComputeUpdateResetGate(
-      input_size_, output_size_, vector_math_, input, state,
-      bias.subview(0, output_size_), weights.subview(0, stride_weights),
-      recurrent_weights.subview(0, stride_recurrent_weights), update);
+  ComputeUpdateResetGate(/*gate_index=*/0, input, update);
   // Reset gate.
   std::array<float, kGruLayerMaxUnits> reset;
-  ComputeUpdateResetGate(input_size_, output_size_, vector_math_, input, state,
-                         bias.subview(output_size_, output_size_),
-                         weights.subview(stride_weights, stride_weights),
-                         recurrent_weights.subview(stride_recurrent_weights,
-                                                   stride_recurrent_weights),
-                         reset);
+  ComputeUpdateResetGate(/*gate_index=*/1, input, reset);
   // State gate.
-  ComputeStateGate(input_size_, output_size_, vector_math_, input, update,
-                   reset, bias.subview(2 * output_size_, output_size_),
-                   weights.subview(2 * stride_weights, stride_weights),
-                   recurrent_weights.subview(2 * stride_recurrent_weights,
-                                             stride_recurrent_weights),
-                   state);
+  ComputeStateGate(input, update, reset);
 }
 
 }  // namespace rnn_vad
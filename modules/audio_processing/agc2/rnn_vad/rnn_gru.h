@@ -12,6 +12,7 @@
 #define MODULES_AUDIO_PROCESSING_AGC2_RNN_VAD_RNN_GRU_H_
 
 #include <array>
+#include <cstdint>
 #include <vector>
 
 #include "absl/strings/string_view.h"
@@ -29,14 +30,20 @@ constexpr int kGruLayerMaxUnits = 24;
 // activation functions for the update/reset and output gates respectively.
 class GatedRecurrentLayer {
  public:
-  // Ctor. `output_size` cannot be greater than `kGruLayerMaxUnits`.
+  // Ctor. `output_size` cannot be greater than `kGruLayerMaxUnits`. If
+  // `rational_sigmoid` is true, the update and reset gates use the branch-free
+  // rational sigmoid approximation instead of the table based one. If
+  // `int8_weights` is true, the weights are kept as 8-bit coefficients, which
+  // takes a quarter of the memory and gives a bit-exact output.
   GatedRecurrentLayer(int input_size,
                       int output_size,
                       rtc::ArrayView<const int8_t> bias,
                       rtc::ArrayView<const int8_t> weights,
                       rtc::ArrayView<const int8_t> recurrent_weights,
                       const AvailableCpuFeatures& cpu_features,
-                      absl::string_view layer_name);
+                      absl::string_view layer_name,
+                      bool rational_sigmoid = false,
+                      bool int8_weights = false);
   GatedRecurrentLayer(const GatedRecurrentLayer&) = delete;
   GatedRecurrentLayer& operator=(const GatedRecurrentLayer&) = delete;
   ~GatedRecurrentLayer();
@@ -54,12 +61,29 @@ class GatedRecurrentLayer {
   void ComputeOutput(rtc::ArrayView<const float> input);
 
  private:
+  void ComputeUpdateResetGate(int gate_index,
+                              rtc::ArrayView<const float> input,
+                              rtc::ArrayView<float> gate) const;
+  void ComputeStateGate(rtc::ArrayView<const float> input,
+                        rtc::ArrayView<const float> update,
+                        rtc::ArrayView<const float> reset);
+  void AddWeightsProduct(int gate_index,
+                         bool recurrent,
+                         rtc::ArrayView<const float> x,
+                         rtc::ArrayView<float> y) const;
+
   const int input_size_;
   const int output_size_;
   const std::vector<float> bias_;
+  // Unscaled weights packed per gate (see `VectorMath::PackMatrix()`); only the
+  // float or the 8-bit ones are allocated.
   const std::vector<float> weights_;
   const std::vector<float> recurrent_weights_;
+  const std::vector<int8_t> weights_int8_;
+  const std::vector<int8_t> recurrent_weights_int8_;
   const VectorMath vector_math_;
+  const bool rational_sigmoid_;
+  const bool int8_weights_;
   // Over-allocated array with size equal to `output_size_`.
   std::array<float, kGruLayerMaxUnits> state_;
 };
@@ -29,7 +29,8 @@ namespace {
 void TestGatedRecurrentLayer(
     GatedRecurrentLayer& gru,
     rtc::ArrayView<const float> input_sequence,
-    rtc::ArrayView<const float> expected_output_sequence) {
+    rtc::ArrayView<const float> expected_output_sequence,
+    float tolerance) {
   const int input_sequence_length = rtc::CheckedDivExact(
       rtc::dchecked_cast<int>(input_sequence.size()), gru.input_size());
   const int output_sequence_length = rtc::CheckedDivExact(
@@ -44,7 +45,7 @@ void TestGatedRecurrentLayer(
         input_sequence.subview(i * gru.input_size(), gru.input_size()));
     const auto expected_output =
         expected_output_sequence.subview(i * gru.size(), gru.size());
-    ExpectNearAbsolute(expected_output, gru, 3e-6f);
+    ExpectNearAbsolute(expected_output, gru, tolerance);
   }
 }
 
@@ -114,7 +115,45 @@ TEST_P(RnnGruParametrization, CheckGatedRecurrentLayer) {
                           kGruRecurrentWeights,
                           /*cpu_features=*/GetParam(),
                           /*layer_name=*/"GRU");
-  TestGatedRecurrentLayer(gru, kGruInputSequence, kGruExpectedOutputSequence);
+  TestGatedRecurrentLayer(gru, kGruInputSequence, kGruExpectedOutputSequence,
+                          /*tolerance=*/3e-6f);
+}
+
+// Checks that the output of a GRU layer using the rational sigmoid
+// approximation is close to that of the table based one.
+TEST_P(RnnGruParametrization, RationalSigmoidMatchesTableApproximation) {
+  GatedRecurrentLayer gru(kGruInputSize, kGruOutputSize, kGruBias, kGruWeights,
+                          kGruRecurrentWeights,
+                          /*cpu_features=*/GetParam(),
+                          /*layer_name=*/"GRU",
+                          /*rational_sigmoid=*/true);
+  TestGatedRecurrentLayer(gru, kGruInputSequence, kGruExpectedOutputSequence,
+                          /*tolerance=*/5e-5f);
+}
+
+// Checks that the output of a GRU layer with 8-bit weights is bit-exact.
+TEST_P(RnnGruParametrization, Int8WeightsAreBitExact) {
+  GatedRecurrentLayer gru(kGruInputSize, kGruOutputSize, kGruBias, kGruWeights,
+                          kGruRecurrentWeights,
+                          /*cpu_features=*/GetParam(),
+                          /*layer_name=*/"GRU");
+  GatedRecurrentLayer gru_int8(kGruInputSize, kGruOutputSize, kGruBias,
+                               kGruWeights, kGruRecurrentWeights,
+                               /*cpu_features=*/GetParam(),
+                               /*layer_name=*/"GRU",
+                               /*rational_sigmoid=*/false,
+                               /*int8_weights=*/true);
+  rtc::ArrayView<const float> input_sequence(kGruInputSequence);
+  for (int i = 0; i < static_cast<int>(input_sequence.size()) / kGruInputSize;
+       ++i) {
+    SCOPED_TRACE(i);
+    const auto input = input_sequence.subview(i * kGruInputSize, kGruInputSize);
+    gru.ComputeOutput(input);
+    gru_int8.ComputeOutput(input);
+    for (int o = 0; o < kGruOutputSize; ++o) {
+      EXPECT_EQ(gru.data()[o], gru_int8.data()[o]);
+    }
+  }
 }
 
 TEST_P(RnnGruParametrization, DISABLED_BenchmarkGatedRecurrentLayer) {
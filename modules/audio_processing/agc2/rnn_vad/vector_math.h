@@ -21,7 +21,10 @@
 #include <emmintrin.h>
 #endif
 
+#include <algorithm>
+#include <cstdint>
 #include <numeric>
+#include <vector>
 
 #include "api/array_view.h"
 #include "modules/audio_processing/agc2/cpu_features.h"
@@ -101,9 +104,159 @@ class VectorMath {
     return std::inner_product(x.begin(), x.end(), y.begin(), 0.f);
   }
 
+  // Number of matrix rows computed at once by the packed matrix-vector
+  // products.
+  static constexpr int kMatrixBlockSize = 8;
+
+  // Packs the row-major matrix `matrix` with `num_rows` rows for the packed
+  // matrix-vector products. Each block of `kMatrixBlockSize` consecutive rows
+  // is stored column by column, so that the coefficients of one column of a
+  // block are contiguous; the last block is zero-padded.
+  template <typename T>
+  static std::vector<T> PackMatrix(rtc::ArrayView<const T> matrix,
+                                   int num_rows) {
+    const int num_columns = rtc::CheckedDivExact(
+        rtc::dchecked_cast<int>(matrix.size()), num_rows);
+    const int num_blocks =
+        (num_rows + kMatrixBlockSize - 1) / kMatrixBlockSize;
+    std::vector<T> packed(num_blocks * kMatrixBlockSize * num_columns, T{0});
+    for (int r = 0; r < num_rows; ++r) {
+      const int block_offset =
+          (r / kMatrixBlockSize) * kMatrixBlockSize * num_columns;
+      for (int c = 0; c < num_columns; ++c) {
+        packed[block_offset + c * kMatrixBlockSize + r % kMatrixBlockSize] =
+            matrix[r * num_columns + c];
+      }
+    }
+    return packed;
+  }
+
+  // Adds `scale` times the product between the matrix packed by `PackMatrix()`
+  // and `x` to `y`, whose size is the number of rows of the matrix.
+  void AddPackedMatrixVectorProduct(rtc::ArrayView<const float> packed_matrix,
+                                    float scale,
+                                    rtc::ArrayView<const float> x,
+                                    rtc::ArrayView<float> y) const {
+    AddPackedMatrixVectorProductImpl(packed_matrix, scale, x, y);
+  }
+  // Same as above with 8-bit coefficients, which are converted on the fly; the
+  // result is bit-exact with that of the float coefficients.
+  void AddPackedMatrixVectorProduct(rtc::ArrayView<const int8_t> packed_matrix,
+                                    float scale,
+                                    rtc::ArrayView<const float> x,
+                                    rtc::ArrayView<float> y) const {
+    AddPackedMatrixVectorProductImpl(packed_matrix, scale, x, y);
+  }
+
  private:
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  static void LoadBlock(const float* w, __m128* low, __m128* high) {
+    *low = _mm_loadu_ps(w);
+    *high = _mm_loadu_ps(w + 4);
+  }
+  static void LoadBlock(const int8_t* w, __m128* low, __m128* high) {
+    // Sign-extend to 16 and then to 32 bits by unpacking and shifting.
+    const __m128i w8 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(w));
+    const __m128i w16 = _mm_srai_epi16(_mm_unpacklo_epi8(w8, w8), 8);
+    *low = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(w16, w16), 16));
+    *high = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(w16, w16), 16));
+  }
+#elif defined(WEBRTC_HAS_NEON) && defined(WEBRTC_ARCH_ARM64)
+  static void LoadBlock(const float* w, float32x4_t* low, float32x4_t* high) {
+    *low = vld1q_f32(w);
+    *high = vld1q_f32(w + 4);
+  }
+  static void LoadBlock(const int8_t* w, float32x4_t* low, float32x4_t* high) {
+    const int16x8_t w16 = vmovl_s8(vld1_s8(w));
+    *low = vcvtq_f32_s32(vmovl_s16(vget_low_s16(w16)));
+    *high = vcvtq_f32_s32(vmovl_s16(vget_high_s16(w16)));
+  }
+#endif
+
+  template <typename T>
+  void AddPackedMatrixVectorProductImpl(rtc::ArrayView<const T> packed_matrix,
+                                        float scale,
+                                        rtc::ArrayView<const float> x,
+                                        rtc::ArrayView<float> y) const {
+    const int num_columns = rtc::dchecked_cast<int>(x.size());
+    const int num_rows = rtc::dchecked_cast<int>(y.size());
+    const int block_stride = kMatrixBlockSize * num_columns;
+    RTC_DCHECK_EQ(packed_matrix.size(),
+                  ((num_rows + kMatrixBlockSize - 1) / kMatrixBlockSize) *
+                      block_stride);
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+    if (cpu_features_.avx2) {
+      AddPackedMatrixVectorProductAvx2(packed_matrix, scale, x, y);
+      return;
+    }
+#endif
+    for (int r = 0; r < num_rows; r += kMatrixBlockSize) {
+      const T* w = &packed_matrix[(r / kMatrixBlockSize) * block_stride];
+      const int num_block_rows = std::min(kMatrixBlockSize, num_rows - r);
+      // Accumulate the dot products of the rows in the block in registers.
+      alignas(16) float block[kMatrixBlockSize];
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+      if (cpu_features_.sse2) {
+        __m128 accumulator_low = _mm_setzero_ps();
+        __m128 accumulator_high = _mm_setzero_ps();
+        for (int c = 0; c < num_columns; ++c) {
+          __m128 w_low, w_high;
+          LoadBlock(w + c * kMatrixBlockSize, &w_low, &w_high);
+          const __m128 x_c = _mm_set1_ps(x[c]);
+          accumulator_low = _mm_add_ps(accumulator_low, _mm_mul_ps(x_c, w_low));
+          accumulator_high =
+              _mm_add_ps(accumulator_high, _mm_mul_ps(x_c, w_high));
+        }
+        _mm_store_ps(block, accumulator_low);
+        _mm_store_ps(block + 4, accumulator_high);
+        for (int k = 0; k < num_block_rows; ++k) {
+          y[r + k] += scale * block[k];
+        }
+        continue;
+      }
+#elif defined(WEBRTC_HAS_NEON) && defined(WEBRTC_ARCH_ARM64)
+      if (cpu_features_.neon) {
+        float32x4_t accumulator_low = vdupq_n_f32(0.f);
+        float32x4_t accumulator_high = vdupq_n_f32(0.f);
+        for (int c = 0; c < num_columns; ++c) {
+          float32x4_t w_low, w_high;
+          LoadBlock(w + c * kMatrixBlockSize, &w_low, &w_high);
+          accumulator_low = vfmaq_n_f32(accumulator_low, w_low, x[c]);
+          accumulator_high = vfmaq_n_f32(accumulator_high, w_high, x[c]);
+        }
+        vst1q_f32(block, accumulator_low);
+        vst1q_f32(block + 4, accumulator_high);
+        for (int k = 0; k < num_block_rows; ++k) {
+          y[r + k] += scale * block[k];
+        }
+        continue;
+      }
+#endif
+      // Skip the zero-padded rows of the last block.
+      std::fill(block, block + num_block_rows, 0.f);
+      for (int c = 0; c < num_columns; ++c) {
+        for (int k = 0; k < num_block_rows; ++k) {
+          block[k] += x[c] * static_cast<float>(w[c * kMatrixBlockSize + k]);
+        }
+      }
+      for (int k = 0; k < num_block_rows; ++k) {
+        y[r + k] += scale * block[k];
+      }
+    }
+  }
+
   float DotProductAvx2(rtc::ArrayView<const float> x,
                        rtc::ArrayView<const float> y) const;
+  void AddPackedMatrixVectorProductAvx2(
+      rtc::ArrayView<const float> packed_matrix,
+      float scale,
+      rtc::ArrayView<const float> x,
+      rtc::ArrayView<float> y) const;
+  void AddPackedMatrixVectorProductAvx2(
+      rtc::ArrayView<const int8_t> packed_matrix,
+      float scale,
+      rtc::ArrayView<const float> x,
+      rtc::ArrayView<float> y) const;
 
   const AvailableCpuFeatures cpu_features_;
 };
@@ -10,6 +10,8 @@
 
 #include <immintrin.h>
 
+#include <cstdint>
+
 #include "api/array_view.h"
 #include "modules/audio_processing/agc2/rnn_vad/vector_math.h"
 #include "rtc_base/checks.h"
@@ -50,5 +52,81 @@ float VectorMath::DotProductAvx2(rtc::ArrayView<const float> x,
   return dot_product;
 }
 
+namespace {
+
+__m256 LoadBlock(const float* w) {
+  return _mm256_loadu_ps(w);
+}
+
+__m256 LoadBlock(const int8_t* w) {
+  return _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(
+      _mm_loadl_epi64(reinterpret_cast<const __m128i*>(w))));
+}
+
+template <typename T>
+void AddPackedBlocksProduct(rtc::ArrayView<const T> packed_matrix,
+                            float scale,
+                            rtc::ArrayView<const float> x,
+                            rtc::ArrayView<float> y) {
+  constexpr int kBlockSize = VectorMath::kMatrixBlockSize;
+  static_assert(kBlockSize == 8, "");
+  const int num_columns = rtc::dchecked_cast<int>(x.size());
+  const int num_rows = rtc::dchecked_cast<int>(y.size());
+  const int block_stride = kBlockSize * num_columns;
+  for (int r = 0; r < num_rows; r += kBlockSize) {
+    const T* w = &packed_matrix[(r / kBlockSize) * block_stride];
+    // Use two accumulators to hide the FMA latency.
+    __m256 accumulator_even = _mm256_setzero_ps();
+    __m256 accumulator_odd = _mm256_setzero_ps();
+    int c = 0;
+    for (; c + 1 < num_columns; c += 2) {
+      accumulator_even =
+          _mm256_fmadd_ps(_mm256_set1_ps(x[c]), LoadBlock(w + c * kBlockSize),
+                          accumulator_even);
+      accumulator_odd = _mm256_fmadd_ps(_mm256_set1_ps(x[c + 1]),
+                                        LoadBlock(w + (c + 1) * kBlockSize),
+                                        accumulator_odd);
+    }
+    if (c < num_columns) {
+      accumulator_even =
+          _mm256_fmadd_ps(_mm256_set1_ps(x[c]), LoadBlock(w + c * kBlockSize),
+                          accumulator_even);
+    }
+    const __m256 accumulator =
+        _mm256_mul_ps(_mm256_set1_ps(scale),
+                      _mm256_add_ps(accumulator_even, accumulator_odd));
+    if (r + kBlockSize <= num_rows) {
+      _mm256_storeu_ps(&y[r],
+                       _mm256_add_ps(_mm256_loadu_ps(&y[r]), accumulator));
+    } else {
+      alignas(32) float block[kBlockSize];
+      _mm256_store_ps(block, accumulator);
+      for (int k = 0; r + k < num_rows; ++k) {
+        y[r + k] += block[k];
+      }
+    }
+  }
+}
+
+}  // namespace
+
+void VectorMath::AddPackedMatrixVectorProductAvx2(
+    rtc::ArrayView<const float> packed_matrix,
+    float scale,
+    rtc::ArrayView<const float> x,
+    rtc::ArrayView<float> y) const {
+  RTC_DCHECK(cpu_features_.avx2);
+  AddPackedBlocksProduct(packed_matrix, scale, x, y);
+}
+
+void VectorMath::AddPackedMatrixVectorProductAvx2(
+    rtc::ArrayView<const int8_t> packed_matrix,
+    float scale,
+    rtc::ArrayView<const float> x,
+    rtc::ArrayView<float> y) const {
+  RTC_DCHECK(cpu_features_.avx2);
+  AddPackedBlocksProduct(packed_matrix, scale, x, y);
+}
+
 }  // namespace rnn_vad
 }  // namespace webrtc
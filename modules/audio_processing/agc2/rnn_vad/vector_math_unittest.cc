@@ -10,6 +10,7 @@
 
 #include "modules/audio_processing/agc2/rnn_vad/vector_math.h"
 
+#include <cstdint>
 #include <vector>
 
 #include "modules/audio_processing/agc2/cpu_features.h"
@@ -41,6 +42,36 @@ TEST_P(VectorMathParametrization, TestDotProduct) {
       kEnergyOfXSubspan);
 }
 
+// Checks that the packed matrix-vector products match the dot products
+// between the rows of the matrix and the vector, including for a number of
+// rows that is not a multiple of the block size.
+TEST_P(VectorMathParametrization, TestPackedMatrixVectorProduct) {
+  constexpr int kNumRows = 13;
+  static_assert(kNumRows % VectorMath::kMatrixBlockSize != 0, "");
+  constexpr float kScale = 1.f / 256.f;
+  std::vector<int8_t> matrix(kNumRows * kSizeOfX);
+  for (int i = 0; i < static_cast<int>(matrix.size()); ++i) {
+    matrix[i] = static_cast<int8_t>((i * 37) % 255 - 127);
+  }
+  const std::vector<float> matrix_float(matrix.begin(), matrix.end());
+  VectorMath vector_math(/*cpu_features=*/GetParam());
+  std::vector<float> y(kNumRows, 1.f);
+  vector_math.AddPackedMatrixVectorProduct(
+      VectorMath::PackMatrix<float>(matrix_float, kNumRows), kScale, kX, y);
+  std::vector<float> y_int8(kNumRows, 1.f);
+  vector_math.AddPackedMatrixVectorProduct(
+      VectorMath::PackMatrix<int8_t>(matrix, kNumRows), kScale, kX, y_int8);
+  VectorMath reference_vector_math(NoAvailableCpuFeatures());
+  for (int r = 0; r < kNumRows; ++r) {
+    SCOPED_TRACE(r);
+    const float expected =
+        1.f + kScale * reference_vector_math.DotProduct(
+                           kX, {&matrix_float[r * kSizeOfX], kSizeOfX});
+    EXPECT_NEAR(y[r], expected, 1e-5f);
+    EXPECT_EQ(y[r], y_int8[r]);
+  }
+}
+
 // Finds the relevant CPU features combinations to test.
 std::vector<AvailableCpuFeatures> GetCpuFeaturesToTest() {
   std::vector<AvailableCpuFeatures> v;
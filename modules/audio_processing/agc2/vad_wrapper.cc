@@ -26,6 +26,15 @@ namespace {
 
 constexpr int kNumFramesPerSecond = 100;
 
+// Fourth-order Butterworth low-pass filter with cut-off frequency at 11 kHz for
+// a sample rate of 48 kHz, split into two second-order sections.
+constexpr BiQuadFilter::Config kAntiAliasingFilterConfig1{
+    {0.22690106f, 0.45380213f, 0.22690106f},
+    {-0.13625037f, 0.04385462f}};
+constexpr BiQuadFilter::Config kAntiAliasingFilterConfig2{
+    {0.31516159f, 0.63032319f, 0.31516159f},
+    {-0.18924937f, 0.44989575f}};
+
 class MonoVadImpl : public VoiceActivityDetectorWrapper::MonoVad {
  public:
   explicit MonoVadImpl(const AvailableCpuFeatures& cpu_features)
@@ -44,6 +53,15 @@ class MonoVadImpl : public VoiceActivityDetectorWrapper::MonoVad {
         feature_vector);
     return rnn_vad_.ComputeVadProbability(feature_vector, is_silence);
   }
+  float AnalyzeWithPitchPeriod(rtc::ArrayView<const float> frame,
+                               int pitch_period_48kHz) override {
+    RTC_DCHECK_EQ(frame.size(), rnn_vad::kFrameSize10ms24kHz);
+    std::array<float, rnn_vad::kFeatureVectorSize> feature_vector;
+    const bool is_silence = features_extractor_.CheckSilenceComputeFeatures(
+        /*samples=*/{frame.data(), rnn_vad::kFrameSize10ms24kHz},
+        pitch_period_48kHz, feature_vector);
+    return rnn_vad_.ComputeVadProbability(feature_vector, is_silence);
+  }
 
  private:
   rnn_vad::FeaturesExtractor features_extractor_;
@@ -71,12 +89,42 @@ VoiceActivityDetectorWrapper::VoiceActivityDetectorWrapper(
     int vad_reset_period_ms,
     std::unique_ptr<MonoVad> vad,
     int sample_rate_hz)
+    : VoiceActivityDetectorWrapper(vad_reset_period_ms,
+                                   /*analysis_period_ms=*/kFrameDurationMs,
+                                   /*decimate_48kHz=*/false,
+                                   std::move(vad),
+                                   sample_rate_hz) {}
+
+VoiceActivityDetectorWrapper::VoiceActivityDetectorWrapper(
+    int vad_reset_period_ms,
+    int analysis_period_ms,
+    bool decimate_48kHz,
+    const AvailableCpuFeatures& cpu_features,
+    int sample_rate_hz)
+    : VoiceActivityDetectorWrapper(vad_reset_period_ms,
+                                   analysis_period_ms,
+                                   decimate_48kHz,
+                                   std::make_unique<MonoVadImpl>(cpu_features),
+                                   sample_rate_hz) {}
+
+VoiceActivityDetectorWrapper::VoiceActivityDetectorWrapper(
+    int vad_reset_period_ms,
+    int analysis_period_ms,
+    bool decimate_48kHz,
+    std::unique_ptr<MonoVad> vad,
+    int sample_rate_hz)
     : vad_reset_period_frames_(
           rtc::CheckedDivExact(vad_reset_period_ms, kFrameDurationMs)),
+      analysis_period_frames_(
+          rtc::CheckedDivExact(analysis_period_ms, kFrameDurationMs)),
+      decimate_48kHz_(decimate_48kHz),
       time_to_vad_reset_(vad_reset_period_frames_),
+      anti_aliasing_filter_1_(kAntiAliasingFilterConfig1),
+      anti_aliasing_filter_2_(kAntiAliasingFilterConfig2),
       vad_(std::move(vad)) {
   RTC_DCHECK(vad_);
   RTC_DCHECK_GT(vad_reset_period_frames_, 1);
+  RTC_DCHECK_GE(analysis_period_frames_, 1);
   resampled_buffer_.resize(
       rtc::CheckedDivExact(vad_->SampleRateHz(), kNumFramesPerSecond));
   Initialize(sample_rate_hz);
@@ -87,27 +135,65 @@ VoiceActivityDetectorWrapper::~VoiceActivityDetectorWrapper() = default;
 void VoiceActivityDetectorWrapper::Initialize(int sample_rate_hz) {
   RTC_DCHECK_GT(sample_rate_hz, 0);
   frame_size_ = rtc::CheckedDivExact(sample_rate_hz, kNumFramesPerSecond);
-  int status =
-      resampler_.InitializeIfNeeded(sample_rate_hz, vad_->SampleRateHz(),
-                                    /*num_channels=*/1);
-  constexpr int kStatusOk = 0;
-  RTC_DCHECK_EQ(status, kStatusOk);
+  const int vad_sample_rate_hz = vad_->SampleRateHz();
+  decimate_ = decimate_48kHz_ && sample_rate_hz == 48000 &&
+              vad_sample_rate_hz == sample_rate_hz / 2;
+  if (decimate_) {
+    filtered_buffer_.resize(frame_size_);
+    anti_aliasing_filter_1_.Reset();
+    anti_aliasing_filter_2_.Reset();
+  } else {
+    int status = resampler_.InitializeIfNeeded(
+        sample_rate_hz, vad_sample_rate_hz, /*num_channels=*/1);
+    constexpr int kStatusOk = 0;
+    RTC_DCHECK_EQ(status, kStatusOk);
+  }
+  time_to_analysis_ = 0;
+  speech_probability_ = 0.0f;
   vad_->Reset();
 }
 
 float VoiceActivityDetectorWrapper::Analyze(AudioFrameView<const float> frame) {
+  return Analyze(frame, /*pitch_period_48kHz=*/absl::nullopt);
+}
+
+float VoiceActivityDetectorWrapper::Analyze(
+    AudioFrameView<const float> frame,
+    absl::optional<int> pitch_period_48kHz) {
   // Periodically reset the VAD.
   time_to_vad_reset_--;
   if (time_to_vad_reset_ <= 0) {
     vad_->Reset();
     time_to_vad_reset_ = vad_reset_period_frames_;
   }
-  // Resample the first channel of `frame`.
-  RTC_DCHECK_EQ(frame.samples_per_channel(), frame_size_);
-  resampler_.Resample(frame.channel(0).data(), frame_size_,
-                      resampled_buffer_.data(), resampled_buffer_.size());
+  // Hold the last speech probability until the next frame to analyze.
+  if (time_to_analysis_ > 0) {
+    time_to_analysis_--;
+    return speech_probability_;
+  }
+  time_to_analysis_ = analysis_period_frames_ - 1;
+
+  Resample(frame);
+  speech_probability_ =
+      pitch_period_48kHz.has_value()
+          ? vad_->AnalyzeWithPitchPeriod(resampled_buffer_, *pitch_period_48kHz)
+          : vad_->Analyze(resampled_buffer_);
+  return speech_probability_;
+}
 
-  return vad_->Analyze(resampled_buffer_);
+void VoiceActivityDetectorWrapper::Resample(AudioFrameView<const float> frame) {
+  RTC_DCHECK_EQ(frame.samples_per_channel(), frame_size_);
+  if (!decimate_) {
+    resampler_.Resample(frame.channel(0).data(), frame_size_,
+                        resampled_buffer_.data(), resampled_buffer_.size());
+    return;
+  }
+  RTC_DCHECK_EQ(filtered_buffer_.size(), 2 * resampled_buffer_.size());
+  anti_aliasing_filter_1_.Process(frame.channel(0), filtered_buffer_);
+  anti_aliasing_filter_2_.Process(filtered_buffer_, filtered_buffer_);
+  for (size_t i = 0; i < resampled_buffer_.size(); ++i) {
+    resampled_buffer_[i] = filtered_buffer_[2 * i];
+  }
 }
 
 }  // namespace webrtc
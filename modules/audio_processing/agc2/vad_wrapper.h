@@ -14,8 +14,10 @@
 #include <memory>
 #include <vector>
 
+#include "absl/types/optional.h"
 #include "api/array_view.h"
 #include "common_audio/resampler/include/push_resampler.h"
+#include "modules/audio_processing/agc2/biquad_filter.h"
 #include "modules/audio_processing/agc2/cpu_features.h"
 #include "modules/audio_processing/include/audio_frame_view.h"
 
@@ -24,7 +26,7 @@ namespace webrtc {
 // Wraps a single-channel Voice Activity Detector (VAD) which is used to analyze
 // the first channel of the input audio frames. Takes care of resampling the
 // input frames to match the sample rate of the wrapped VAD and periodically
-// resets the VAD.
+// resets the VAD. Optionally, the VAD only analyzes one frame out of a few.
 class VoiceActivityDetectorWrapper {
  public:
   // Single channel VAD interface.
@@ -38,6 +40,13 @@ class VoiceActivityDetectorWrapper {
     virtual void Reset() = 0;
     // Analyzes an audio frame and returns the speech probability.
     virtual float Analyze(rtc::ArrayView<const float> frame) = 0;
+    // Like `Analyze()`, but uses `pitch_period_48kHz`, estimated on the same
+    // signal by another module, instead of searching the pitch. Runs
+    // `Analyze()` if the VAD does not use the pitch.
+    virtual float AnalyzeWithPitchPeriod(rtc::ArrayView<const float> frame,
+                                         int pitch_period_48kHz) {
+      return Analyze(frame);
+    }
   };
 
   // Ctor. Uses `cpu_features` to instantiate the default VAD.
@@ -54,6 +63,23 @@ class VoiceActivityDetectorWrapper {
   VoiceActivityDetectorWrapper(int vad_reset_period_ms,
                                std::unique_ptr<MonoVad> vad,
                                int sample_rate_hz);
+  // Ctor. The VAD only analyzes one frame every `analysis_period_ms`, which
+  // must be a multiple of the frame duration, and the last speech probability
+  // is returned for the frames in between. If `decimate_48kHz` is true and the
+  // input frames are sampled at twice the VAD sample rate (i.e., 48 kHz for
+  // the default VAD), they are low-pass filtered and decimated by two instead
+  // of being resampled. Uses `cpu_features` to instantiate the default VAD.
+  VoiceActivityDetectorWrapper(int vad_reset_period_ms,
+                               int analysis_period_ms,
+                               bool decimate_48kHz,
+                               const AvailableCpuFeatures& cpu_features,
+                               int sample_rate_hz);
+  // Ctor. Like the ctor above, but uses a custom `vad`.
+  VoiceActivityDetectorWrapper(int vad_reset_period_ms,
+                               int analysis_period_ms,
+                               bool decimate_48kHz,
+                               std::unique_ptr<MonoVad> vad,
+                               int sample_rate_hz);
 
   VoiceActivityDetectorWrapper(const VoiceActivityDetectorWrapper&) = delete;
   VoiceActivityDetectorWrapper& operator=(const VoiceActivityDetectorWrapper&) =
@@ -67,14 +93,32 @@ class VoiceActivityDetectorWrapper {
   // `frame` must be a 10 ms frame with the sample rate specified in the last
   // `Initialize()` call.
   float Analyze(AudioFrameView<const float> frame);
+  // Like `Analyze()`, but if specified uses `pitch_period_48kHz`, the pitch
+  // period at 48 kHz estimated on the same signal by another module (e.g., the
+  // noise suppressor), instead of searching the pitch.
+  float Analyze(AudioFrameView<const float> frame,
+                absl::optional<int> pitch_period_48kHz);
 
  private:
+  // Writes the first channel of `frame` at the VAD sample rate into
+  // `resampled_buffer_`.
+  void Resample(AudioFrameView<const float> frame);
+
   const int vad_reset_period_frames_;
+  const int analysis_period_frames_;
+  const bool decimate_48kHz_;
   int frame_size_;
   int time_to_vad_reset_;
+  int time_to_analysis_;
+  float speech_probability_;
+  bool decimate_;
   PushResampler<float> resampler_;
+  // Anti-aliasing filter used when decimating, as two second-order sections.
+  BiQuadFilter anti_aliasing_filter_1_;
+  BiQuadFilter anti_aliasing_filter_2_;
   std::unique_ptr<MonoVad> vad_;
   std::vector<float> resampled_buffer_;
+  std::vector<float> filtered_buffer_;
 };
 
 }  // namespace webrtc
@@ -10,6 +10,7 @@
 
 #include "modules/audio_processing/agc2/vad_wrapper.h"
 
+#include <cmath>
 #include <limits>
 #include <memory>
 #include <tuple>
@@ -26,7 +27,9 @@
 namespace webrtc {
 namespace {
 
+using ::testing::_;
 using ::testing::AnyNumber;
+using ::testing::Invoke;
 using ::testing::Return;
 using ::testing::ReturnRoundRobin;
 using ::testing::Truly;
@@ -43,6 +46,10 @@ class MockVad : public VoiceActivityDetectorWrapper::MonoVad {
   MOCK_METHOD(int, SampleRateHz, (), (const, override));
   MOCK_METHOD(void, Reset, (), (override));
   MOCK_METHOD(float, Analyze, (rtc::ArrayView<const float> frame), (override));
+  MOCK_METHOD(float,
+              AnalyzeWithPitchPeriod,
+              (rtc::ArrayView<const float> frame, int pitch_period_48kHz),
+              (override));
 };
 
 // Checks that the ctor and `Initialize()` read the sample rate of the wrapped
@@ -107,6 +114,24 @@ TEST(GainController2VoiceActivityDetectorWrapper, CheckSpeechProbabilities) {
   }
 }
 
+// Checks that a given pitch period is passed to the wrapped VAD.
+TEST(GainController2VoiceActivityDetectorWrapper, ForwardsPitchPeriod) {
+  constexpr int kPitchPeriod48kHz = 240;
+  auto vad = std::make_unique<MockVad>();
+  EXPECT_CALL(*vad, SampleRateHz)
+      .Times(AnyNumber())
+      .WillRepeatedly(Return(kSampleRate8kHz));
+  EXPECT_CALL(*vad, Reset).Times(AnyNumber());
+  EXPECT_CALL(*vad, Analyze).WillOnce(Return(0.2f));
+  EXPECT_CALL(*vad, AnalyzeWithPitchPeriod(_, kPitchPeriod48kHz))
+      .WillOnce(Return(0.7f));
+  auto vad_wrapper = std::make_unique<VoiceActivityDetectorWrapper>(
+      kNoVadPeriodicReset, std::move(vad), kSampleRate8kHz);
+  FrameWithView frame(kSampleRate8kHz);
+  EXPECT_EQ(vad_wrapper->Analyze(frame.view, kPitchPeriod48kHz), 0.7f);
+  EXPECT_EQ(vad_wrapper->Analyze(frame.view, absl::nullopt), 0.2f);
+}
+
 // Checks that the VAD is not periodically reset.
 TEST(GainController2VoiceActivityDetectorWrapper, VadNoPeriodicReset) {
   constexpr int kNumFrames = 19;
@@ -177,5 +202,74 @@ INSTANTIATE_TEST_SUITE_P(
     ::testing::Combine(::testing::Values(8000, 16000, 44100, 48000),
                        ::testing::Values(6000, 8000, 12000, 16000, 24000)));
 
+// Checks that only one frame every analysis period is analyzed and that the
+// speech probability is held for the frames in between.
+TEST(GainController2VoiceActivityDetectorWrapper, SpeechProbabilityIsHeld) {
+  constexpr int kAnalysisPeriodFrames = 3;
+  constexpr int kNumFrames = 10;
+  const std::vector<float> speech_probabilities{0.1f, 0.9f, 0.4f, 0.7f};
+  auto vad = std::make_unique<MockVad>();
+  EXPECT_CALL(*vad, SampleRateHz)
+      .Times(AnyNumber())
+      .WillRepeatedly(Return(kSampleRate8kHz));
+  EXPECT_CALL(*vad, Reset).Times(AnyNumber());
+  EXPECT_CALL(*vad, Analyze)
+      .Times(speech_probabilities.size())
+      .WillRepeatedly(ReturnRoundRobin(speech_probabilities));
+  VoiceActivityDetectorWrapper vad_wrapper(
+      kNoVadPeriodicReset, kAnalysisPeriodFrames * kFrameDurationMs,
+      /*decimate_48kHz=*/false, std::move(vad), kSampleRate8kHz);
+  FrameWithView frame(kSampleRate8kHz);
+  for (int i = 0; i < kNumFrames; ++i) {
+    SCOPED_TRACE(i);
+    EXPECT_EQ(speech_probabilities[i / kAnalysisPeriodFrames],
+              vad_wrapper.Analyze(frame.view));
+  }
+}
+
+// Returns the power of the frames analyzed by a 24 kHz VAD for a 48 kHz input
+// tone at `frequency_hz` which is decimated by two.
+float ComputeDecimatedTonePower(float frequency_hz) {
+  constexpr int kSampleRate48kHz = 48000;
+  constexpr int kNumFrames = 10;
+  float power = 0.0f;
+  auto vad = std::make_unique<MockVad>();
+  EXPECT_CALL(*vad, SampleRateHz)
+      .Times(AnyNumber())
+      .WillRepeatedly(Return(kSampleRate48kHz / 2));
+  EXPECT_CALL(*vad, Reset).Times(AnyNumber());
+  EXPECT_CALL(*vad, Analyze)
+      .Times(kNumFrames)
+      .WillRepeatedly(Invoke([&](rtc::ArrayView<const float> frame) {
+        EXPECT_EQ(frame.size(), 240u);
+        power = 0.0f;
+        for (float x : frame) {
+          power += x * x;
+        }
+        power /= frame.size();
+        return 0.0f;
+      }));
+  VoiceActivityDetectorWrapper vad_wrapper(
+      kNoVadPeriodicReset, kFrameDurationMs, /*decimate_48kHz=*/true,
+      std::move(vad), kSampleRate48kHz);
+  FrameWithView frame(kSampleRate48kHz);
+  int t = 0;
+  for (int i = 0; i < kNumFrames; ++i) {
+    for (float& x : frame.samples) {
+      x = std::sin(2.0f * 3.14159265f * frequency_hz * t++ / kSampleRate48kHz);
+    }
+    vad_wrapper.Analyze(frame.view);
+  }
+  return power;
+}
+
+// Checks that the 48 kHz input is decimated with a low-pass filter, which
+// keeps the speech band and attenuates what would alias into it.
+TEST(GainController2VoiceActivityDetectorWrapper, DecimatesWithLowPassFilter) {
+  // The power of a unit amplitude tone is 0.5.
+  EXPECT_NEAR(ComputeDecimatedTonePower(/*frequency_hz=*/1000.0f), 0.5f, 0.05f);
+  EXPECT_LT(ComputeDecimatedTonePower(/*frequency_hz=*/20000.0f), 0.005f);
+}
+
 }  // namespace
 }  // namespace webrtc
@@ -37,6 +37,53 @@ size_t NumBandsFromFramesPerChannel(size_t num_frames) {
   return 1;
 }
 
+// Deinterleaves `interleaved` into `num_channels` channels in a single pass
+// over the input, which keeps the reads sequential.
+void DeinterleaveToFloat(const int16_t* interleaved,
+                         size_t samples_per_channel,
+                         size_t num_channels,
+                         float* const* deinterleaved) {
+  if (num_channels == 2) {
+    float* left = deinterleaved[0];
+    float* right = deinterleaved[1];
+    for (size_t j = 0; j < samples_per_channel; ++j) {
+      left[j] = interleaved[2 * j];
+      right[j] = interleaved[2 * j + 1];
+    }
+    return;
+  }
+  for (size_t j = 0, k = 0; j < samples_per_channel; ++j) {
+    for (size_t i = 0; i < num_channels; ++i, ++k) {
+      deinterleaved[i][j] = interleaved[k];
+    }
+  }
+}
+
+// Interleaves the `num_channels` channels of `deinterleaved` into the first
+// `num_channels` channels of the `num_interleaved_channels` channels of
+// `interleaved` in a single pass over the output.
+void InterleaveToS16(const float* const* deinterleaved,
+                     size_t samples_per_channel,
+                     size_t num_channels,
+                     size_t num_interleaved_channels,
+                     int16_t* interleaved) {
+  if (num_channels == 2 && num_interleaved_channels == 2) {
+    const float* left = deinterleaved[0];
+    const float* right = deinterleaved[1];
+    for (size_t j = 0; j < samples_per_channel; ++j) {
+      interleaved[2 * j] = FloatS16ToS16(left[j]);
+      interleaved[2 * j + 1] = FloatS16ToS16(right[j]);
+    }
+    return;
+  }
+  for (size_t j = 0, k = 0; j < samples_per_channel;
+       ++j, k += num_interleaved_channels) {
+    for (size_t i = 0; i < num_channels; ++i) {
+      interleaved[k + i] = FloatS16ToS16(deinterleaved[i][j]);
+    }
+  }
+}
+
 }  // namespace
 
 AudioBuffer::AudioBuffer(size_t input_rate,
@@ -283,10 +330,8 @@ void AudioBuffer::CopyFrom(const int16_t* const interleaved_data,
                                        buffer_num_frames_);
       }
     } else {
-      for (size_t i = 0; i < num_channels_; ++i) {
-        deinterleave_channel(i, num_channels_, input_num_frames_, interleaved,
-                             data_->channels()[i]);
-      }
+      DeinterleaveToFloat(interleaved, input_num_frames_, num_channels_,
+                          data_->channels());
     }
   }
 }
@@ -343,10 +388,8 @@ void AudioBuffer::CopyTo(const StreamConfig& stream_config,
                            float_buffer.data(), interleaved);
       }
     } else {
-      for (size_t i = 0; i < num_channels_; ++i) {
-        interleave_channel(i, config_num_channels, output_num_frames_,
-                           data_->channels()[i], interleaved);
-      }
+      InterleaveToS16(data_->channels(), output_num_frames_, num_channels_,
+                      config_num_channels, interleaved);
     }
 
     for (size_t i = num_channels_; i < config_num_channels; ++i) {
@@ -11,6 +11,8 @@
 #include "modules/audio_processing/audio_buffer.h"
 
 #include <cmath>
+#include <cstdint>
+#include <vector>
 
 #include "test/gtest.h"
 #include "test/testsupport/rtc_expect_death.h"
@@ -90,4 +92,27 @@ TEST(AudioBufferTest, CopyWithResampling) {
   // Verify that energies match.
   EXPECT_NEAR(energy_ab1, energy_ab2 * 32000.f / 48000.f, .01f * energy_ab1);
 }
+
+TEST(AudioBufferTest, InterleavedCopyPreservesChannelOrder) {
+  for (size_t num_channels : {2, 3, 4}) {
+    SCOPED_TRACE(num_channels);
+    AudioBuffer ab(kSampleRateHz, num_channels, kSampleRateHz, num_channels,
+                   kSampleRateHz, num_channels);
+    const StreamConfig stream_config(kSampleRateHz, num_channels);
+    std::vector<int16_t> input(stream_config.num_samples());
+    for (size_t i = 0; i < input.size(); ++i) {
+      input[i] = static_cast<int16_t>(i * 7 - 10000);
+    }
+    ab.CopyFrom(input.data(), stream_config);
+    for (size_t ch = 0; ch < num_channels; ++ch) {
+      for (size_t i = 0; i < ab.num_frames(); ++i) {
+        ASSERT_EQ(ab.channels()[ch][i], input[i * num_channels + ch]);
+      }
+    }
+
+    std::vector<int16_t> output(stream_config.num_samples());
+    ab.CopyTo(stream_config, output.data());
+    EXPECT_EQ(input, output);
+  }
+}
 }  // namespace webrtc
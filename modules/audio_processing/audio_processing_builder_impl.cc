@@ -27,7 +27,8 @@ rtc::scoped_refptr<AudioProcessing> AudioProcessingBuilder::Create() {
   return rtc::make_ref_counted<AudioProcessingImpl>(
       config_, std::move(capture_post_processing_),
       std::move(render_pre_processing_), std::move(echo_control_factory_),
-      std::move(echo_detector_), std::move(capture_analyzer_));
+      std::move(echo_detector_), std::move(capture_analyzer_),
+      rnnoise_model_path_, rnnoise_lite_model_path_, processing_thread_pool_);
 #endif
 }
 
@@ -26,6 +26,7 @@
 #include "common_audio/audio_converter.h"
 #include "common_audio/include/audio_util.h"
 #include "modules/audio_processing/aec_dump/aec_dump_factory.h"
+#include "modules/audio_processing/agc2/agc2_common.h"
 #include "modules/audio_processing/audio_buffer.h"
 #include "modules/audio_processing/include/audio_frame_view.h"
 #include "modules/audio_processing/logging/apm_data_dumper.h"
@@ -533,9 +534,22 @@ AudioProcessing::Config AudioProcessingImpl::AdjustConfig(
   return adjusted_config;
 }
 
+bool AudioProcessingImpl::UseNoiseSuppressorVad(
+    const AudioProcessing::Config& config) {
+  // RNNoise does not run at the lowest level with the level control.
+  return config.noise_suppression.enabled &&
+         config.noise_suppression.share_speech_probability &&
+         !(config.noise_suppression.rnnoise_level_control &&
+           config.noise_suppression.level ==
+               AudioProcessing::Config::NoiseSuppression::kLow);
+}
+
 bool AudioProcessingImpl::UseApmVadSubModule(
     const AudioProcessing::Config& config,
     const absl::optional<GainController2ExperimentParams>& experiment_params) {
+  if (UseNoiseSuppressorVad(config)) {
+    return false;
+  }
   // The VAD as an APM sub-module is needed only in one case, that is when TS
   // and AGC2 are both enabled and when the AGC2 experiment is running and its
   // parameters require to fully switch the gain control to AGC2.
@@ -650,7 +664,10 @@ AudioProcessingImpl::AudioProcessingImpl()
                           /*render_pre_processor=*/nullptr,
                           /*echo_control_factory=*/nullptr,
                           /*echo_detector=*/nullptr,
-                          /*capture_analyzer=*/nullptr) {}
+                          /*capture_analyzer=*/nullptr,
+                          /*rnnoise_model_path=*/"",
+                          /*rnnoise_lite_model_path=*/"",
+                          /*processing_thread_pool=*/nullptr) {}
 
 std::atomic<int> AudioProcessingImpl::instance_count_(0);
 
@@ -660,7 +677,10 @@ AudioProcessingImpl::AudioProcessingImpl(
     std::unique_ptr<CustomProcessing> render_pre_processor,
     std::unique_ptr<EchoControlFactory> echo_control_factory,
     rtc::scoped_refptr<EchoDetector> echo_detector,
-    std::unique_ptr<CustomAudioAnalyzer> capture_analyzer)
+    std::unique_ptr<CustomAudioAnalyzer> capture_analyzer,
+    absl::string_view rnnoise_model_path,
+    absl::string_view rnnoise_lite_model_path,
+    ProcessingThreadPool* processing_thread_pool)
     : data_dumper_(new ApmDataDumper(instance_count_.fetch_add(1) + 1)),
       use_setup_specific_default_aec3_config_(
           UseSetupSpecificDefaultAec3Congfig()),
@@ -670,6 +690,9 @@ AudioProcessingImpl::AudioProcessingImpl(
       render_runtime_settings_(RuntimeSettingQueueSize()),
       capture_runtime_settings_enqueuer_(&capture_runtime_settings_),
       render_runtime_settings_enqueuer_(&render_runtime_settings_),
+      rnnoise_model_path_(rnnoise_model_path),
+      rnnoise_lite_model_path_(rnnoise_lite_model_path),
+      processing_thread_pool_(processing_thread_pool),
       echo_control_factory_(std::move(echo_control_factory)),
       config_(AdjustConfig(config, gain_controller2_experiment_params_)),
       submodule_states_(!!capture_post_processor,
@@ -817,6 +840,7 @@ void AudioProcessingImpl::InitializeLocked() {
   InitializePostProcessor();
   InitializePreProcessor();
   InitializeCaptureLevelsAdjuster();
+  InitializeSubmoduleProfiler();
 
   if (aec_dump_) {
     aec_dump_->WriteInitMessage(formats_.api_format, rtc::TimeUTCMillis());
@@ -932,16 +956,37 @@ void AudioProcessingImpl::ApplyConfig(const AudioProcessing::Config& config) {
 
   const bool agc2_config_changed =
       config_.gain_controller2 != adjusted_config.gain_controller2;
+  const AudioProcessing::Config::GainController2::AdaptiveDigital
+      last_adaptive_digital_config = config_.gain_controller2.adaptive_digital;
 
   const bool ns_config_changed =
       config_.noise_suppression.enabled !=
           adjusted_config.noise_suppression.enabled ||
       config_.noise_suppression.level !=
-          adjusted_config.noise_suppression.level;
+          adjusted_config.noise_suppression.level ||
+      config_.noise_suppression.rnnoise_full_band !=
+          adjusted_config.noise_suppression.rnnoise_full_band ||
+      config_.noise_suppression.rnnoise_silence_gate_frames !=
+          adjusted_config.noise_suppression.rnnoise_silence_gate_frames ||
+      config_.noise_suppression.rnnoise_hybrid !=
+          adjusted_config.noise_suppression.rnnoise_hybrid ||
+      config_.noise_suppression.rnnoise_low_delay !=
+          adjusted_config.noise_suppression.rnnoise_low_delay ||
+      config_.noise_suppression.rnnoise_level_control !=
+          adjusted_config.noise_suppression.rnnoise_level_control ||
+      config_.noise_suppression.rnnoise_linked_channels !=
+          adjusted_config.noise_suppression.rnnoise_linked_channels ||
+      config_.noise_suppression.rnnoise_tier !=
+          adjusted_config.noise_suppression.rnnoise_tier ||
+      config_.noise_suppression.share_pitch_estimate !=
+          adjusted_config.noise_suppression.share_pitch_estimate;
 
   const bool ts_config_changed = config_.transient_suppression.enabled !=
                                  adjusted_config.transient_suppression.enabled;
 
+  const bool ns_vad_changed =
+      UseNoiseSuppressorVad(config_) != UseNoiseSuppressorVad(adjusted_config);
+
   const bool pre_amplifier_config_changed =
       config_.pre_amplifier.enabled != adjusted_config.pre_amplifier.enabled ||
       config_.pre_amplifier.fixed_gain_factor !=
@@ -957,11 +1002,14 @@ void AudioProcessingImpl::ApplyConfig(const AudioProcessing::Config& config) {
     InitializeEchoController();
   }
 
-  if (ns_config_changed) {
+  // The full-band RNNoise mode depends on whether echo cancellation is active,
+  // and the RNNoise bypass on whether its speech probability is used.
+  if (ns_config_changed || ns_vad_changed ||
+      (aec_config_changed && config_.noise_suppression.rnnoise_full_band)) {
     InitializeNoiseSuppressor();
   }
 
-  if (ts_config_changed) {
+  if (ts_config_changed || ns_vad_changed) {
     InitializeTransientSuppressor();
   }
 
@@ -978,10 +1026,19 @@ void AudioProcessingImpl::ApplyConfig(const AudioProcessing::Config& config) {
     config_.gain_controller2 = AudioProcessing::Config::GainController2();
   }
 
-  if (agc2_config_changed || ts_config_changed) {
-    // AGC2 also depends on TS because of the possible dependency on the APM VAD
-    // sub-module.
+  if (agc2_config_changed || ts_config_changed || ns_vad_changed) {
+    // AGC2 also depends on TS and NS because of the possible dependency on the
+    // APM VAD sub-module or on the noise suppressor VAD.
     InitializeGainController2();
+    const auto& adaptive_digital_config =
+        config_.gain_controller2.adaptive_digital;
+    if (adaptive_digital_config.vad_analysis_period_ms !=
+            last_adaptive_digital_config.vad_analysis_period_ms ||
+        adaptive_digital_config.vad_decimate_48kHz !=
+            last_adaptive_digital_config.vad_decimate_48kHz) {
+      // Recreate the VAD sub-module with the new analysis parameters.
+      submodules_.voice_activity_detector.reset();
+    }
     InitializeVoiceActivityDetector();
   }
 
@@ -989,6 +1046,10 @@ void AudioProcessingImpl::ApplyConfig(const AudioProcessing::Config& config) {
     InitializeCaptureLevelsAdjuster();
   }
 
+  if (config_.pipeline.profile_submodules != !!capture_.submodule_profiler) {
+    InitializeSubmoduleProfiler();
+  }
+
   // Reinitialization must happen after all submodule configuration to avoid
   // additional reinitializations on the next capture / render processing call.
   if (pipeline_config_changed) {
@@ -1086,6 +1147,25 @@ bool AudioProcessingImpl::PostRuntimeSetting(RuntimeSetting setting) {
     case RuntimeSetting::Type::kCaptureFixedPostGain:
     case RuntimeSetting::Type::kCaptureOutputUsed:
       return capture_runtime_settings_enqueuer_.Enqueue(setting);
+    case RuntimeSetting::Type::kCaptureRnnoiseModelReload: {
+      // Load the model on the calling thread, the capture thread only swaps
+      // it in.
+      if (rnnoise_model_path_.empty()) {
+        return true;
+      }
+      std::shared_ptr<const RnnoiseModel> model =
+          RnnoiseModel::Load(rnnoise_model_path_);
+      if (!model) {
+        RTC_LOG(LS_ERROR) << "Cannot load the RNNoise model "
+                          << rnnoise_model_path_;
+        return false;
+      }
+      {
+        MutexLock lock(&rnnoise_model_mutex_);
+        pending_rnnoise_model_ = std::move(model);
+      }
+      return capture_runtime_settings_enqueuer_.Enqueue(setting);
+    }
     case RuntimeSetting::Type::kPlayoutVolumeChange: {
       bool enqueueing_successful;
       enqueueing_successful =
@@ -1284,6 +1364,17 @@ void AudioProcessingImpl::HandleCaptureRuntimeSettings() {
         setting.GetBool(&value);
         HandleCaptureOutputUsedSetting(value);
         break;
+      case RuntimeSetting::Type::kCaptureRnnoiseModelReload: {
+        std::shared_ptr<const RnnoiseModel> model;
+        {
+          MutexLock lock(&rnnoise_model_mutex_);
+          model = std::move(pending_rnnoise_model_);
+        }
+        if (model && submodules_.noise_suppressor) {
+          submodules_.noise_suppressor->SetRnnoiseModel(std::move(model));
+        }
+        break;
+      }
     }
     ++num_settings_processed;
   }
@@ -1320,6 +1411,7 @@ void AudioProcessingImpl::HandleRenderRuntimeSettings() {
       case RuntimeSetting::Type::kCaptureCompressionGain:  // fall-through
       case RuntimeSetting::Type::kCaptureFixedPostGain:    // fall-through
       case RuntimeSetting::Type::kCaptureOutputUsed:       // fall-through
+      case RuntimeSetting::Type::kCaptureRnnoiseModelReload:  // fall-through
       case RuntimeSetting::Type::kNotSpecified:
         RTC_DCHECK_NOTREACHED();
         break;
@@ -1337,26 +1429,16 @@ void AudioProcessingImpl::QueueBandedRenderAudio(AudioBuffer* audio) {
     RTC_DCHECK(aecm_render_signal_queue_);
     // Insert the samples into the queue.
     if (!aecm_render_signal_queue_->Insert(&aecm_render_queue_buffer_)) {
-      // The data queue is full and needs to be emptied.
-      EmptyQueuedRenderAudio();
-
-      // Retry the insert (should always work).
-      bool result =
-          aecm_render_signal_queue_->Insert(&aecm_render_queue_buffer_);
-      RTC_DCHECK(result);
+      HandleRenderQueueOverflow();
     }
   }
 
   if (!submodules_.agc_manager && submodules_.gain_control) {
     GainControlImpl::PackRenderAudioBuffer(*audio, &agc_render_queue_buffer_);
+    RTC_DCHECK(agc_render_signal_queue_);
     // Insert the samples into the queue.
     if (!agc_render_signal_queue_->Insert(&agc_render_queue_buffer_)) {
-      // The data queue is full and needs to be emptied.
-      EmptyQueuedRenderAudio();
-
-      // Retry the insert (should always work).
-      bool result = agc_render_signal_queue_->Insert(&agc_render_queue_buffer_);
-      RTC_DCHECK(result);
+      HandleRenderQueueOverflow();
     }
   }
 }
@@ -1367,42 +1449,20 @@ void AudioProcessingImpl::QueueNonbandedRenderAudio(AudioBuffer* audio) {
     RTC_DCHECK(red_render_signal_queue_);
     // Insert the samples into the queue.
     if (!red_render_signal_queue_->Insert(&red_render_queue_buffer_)) {
-      // The data queue is full and needs to be emptied.
-      EmptyQueuedRenderAudio();
-
-      // Retry the insert (should always work).
-      bool result = red_render_signal_queue_->Insert(&red_render_queue_buffer_);
-      RTC_DCHECK(result);
+      HandleRenderQueueOverflow();
     }
   }
 }
 
 void AudioProcessingImpl::AllocateRenderQueue() {
-  const size_t new_agc_render_queue_element_max_size =
-      std::max(static_cast<size_t>(1), kMaxAllowedValuesOfSamplesPerBand);
-
   const size_t new_red_render_queue_element_max_size =
       std::max(static_cast<size_t>(1), kMaxAllowedValuesOfSamplesPerFrame);
 
   // Reallocate the queues if the queue item sizes are too small to fit the
-  // data to put in the queues.
-
-  if (agc_render_queue_element_max_size_ <
-      new_agc_render_queue_element_max_size) {
-    agc_render_queue_element_max_size_ = new_agc_render_queue_element_max_size;
-
-    std::vector<int16_t> template_queue_element(
-        agc_render_queue_element_max_size_);
-
-    agc_render_signal_queue_.reset(
-        new SwapQueue<std::vector<int16_t>, RenderQueueItemVerifier<int16_t>>(
-            kMaxNumFramesToBuffer, template_queue_element,
-            RenderQueueItemVerifier<int16_t>(
-                agc_render_queue_element_max_size_)));
+  // data to put in the queues. The AGC1 render queue is only allocated when
+  // AGC1 is enabled, by `InitializeGainController1()`.
 
-    agc_render_queue_buffer_.resize(agc_render_queue_element_max_size_);
-    agc_capture_queue_buffer_.resize(agc_render_queue_element_max_size_);
-  } else {
+  if (agc_render_signal_queue_) {
     agc_render_signal_queue_->Clear();
   }
 
@@ -1429,9 +1489,16 @@ void AudioProcessingImpl::AllocateRenderQueue() {
   }
 }
 
-void AudioProcessingImpl::EmptyQueuedRenderAudio() {
-  MutexLock lock_capture(&mutex_capture_);
-  EmptyQueuedRenderAudioLocked();
+void AudioProcessingImpl::HandleRenderQueueOverflow() {
+  // The queues are only drained by the capture side, so that the render side
+  // never waits for the capture lock. A full queue means that the capture side
+  // has not run for `kMaxNumFramesToBuffer` render frames, and the frame is
+  // dropped.
+  if (render_.num_dropped_render_frames++ % kMaxNumFramesToBuffer == 0) {
+    RTC_LOG(LS_WARNING) << "Render queue full, "
+                        << render_.num_dropped_render_frames
+                        << " render frames dropped.";
+  }
 }
 
 void AudioProcessingImpl::EmptyQueuedRenderAudioLocked() {
@@ -1444,6 +1511,7 @@ void AudioProcessingImpl::EmptyQueuedRenderAudioLocked() {
   }
 
   if (submodules_.gain_control) {
+    RTC_DCHECK(agc_render_signal_queue_);
     while (agc_render_signal_queue_->Remove(&agc_capture_queue_buffer_)) {
       submodules_.gain_control->ProcessRenderAudio(agc_capture_queue_buffer_);
     }
@@ -1511,9 +1579,15 @@ int AudioProcessingImpl::ProcessCaptureStreamLocked() {
   AudioBuffer* capture_buffer = capture_.capture_audio.get();  // For brevity.
   AudioBuffer* linear_aec_buffer = capture_.linear_aec_output.get();
 
+  using Submodule = CaptureSubmoduleProfiler::Submodule;
+  using ScopedTimer = CaptureSubmoduleProfiler::ScopedTimer;
+  CaptureSubmoduleProfiler* const profiler = capture_.submodule_profiler.get();
+  const int64_t capture_start_ns = profiler ? rtc::TimeNanos() : 0;
+
   if (submodules_.high_pass_filter &&
       config_.high_pass_filter.apply_in_full_band &&
       !constants_.enforce_split_band_hpf) {
+    ScopedTimer timer(profiler, Submodule::kHighPassFilter);
     submodules_.high_pass_filter->Process(capture_buffer,
                                           /*use_split_band_data=*/false);
   }
@@ -1526,6 +1600,7 @@ int AudioProcessingImpl::ProcessCaptureStreamLocked() {
       set_stream_analog_level_locked(
           submodules_.capture_levels_adjuster->GetAnalogMicGainLevel());
     }
+    ScopedTimer timer(profiler, Submodule::kCaptureLevelsAdjuster);
     submodules_.capture_levels_adjuster->ApplyPreLevelAdjustment(
         *capture_buffer);
   }
@@ -1571,10 +1646,12 @@ int AudioProcessingImpl::ProcessCaptureStreamLocked() {
          capture_.prev_playout_volume >= 0);
     capture_.prev_playout_volume = capture_.playout_volume;
 
+    ScopedTimer timer(profiler, Submodule::kEchoController);
     submodules_.echo_controller->AnalyzeCapture(capture_buffer);
   }
 
   if (submodules_.agc_manager) {
+    ScopedTimer timer(profiler, Submodule::kGainControl);
     submodules_.agc_manager->AnalyzePreProcess(*capture_buffer);
   }
 
@@ -1583,14 +1660,21 @@ int AudioProcessingImpl::ProcessCaptureStreamLocked() {
     // Expect the volume to be available if the input controller is enabled.
     RTC_DCHECK(capture_.applied_input_volume.has_value());
     if (capture_.applied_input_volume.has_value()) {
+      ScopedTimer timer(profiler, Submodule::kGainController2);
       submodules_.gain_controller2->Analyze(*capture_.applied_input_volume,
                                             *capture_buffer);
     }
   }
 
+  if (submodules_.noise_suppressor) {
+    ScopedTimer timer(profiler, Submodule::kNoiseSuppressor);
+    submodules_.noise_suppressor->ProcessFullBand(capture_buffer);
+  }
+
   if (submodule_states_.CaptureMultiBandSubModulesActive() &&
       SampleRateSupportsMultiBand(
           capture_nonlocked_.capture_processing_format.sample_rate_hz())) {
+    ScopedTimer timer(profiler, Submodule::kBandSplitting);
     capture_buffer->SplitIntoFrequencyBands();
   }
 
@@ -1607,11 +1691,13 @@ int AudioProcessingImpl::ProcessCaptureStreamLocked() {
   if (submodules_.high_pass_filter &&
       (!config_.high_pass_filter.apply_in_full_band ||
        constants_.enforce_split_band_hpf)) {
+    ScopedTimer timer(profiler, Submodule::kHighPassFilter);
     submodules_.high_pass_filter->Process(capture_buffer,
                                           /*use_split_band_data=*/true);
   }
 
   if (submodules_.gain_control) {
+    ScopedTimer timer(profiler, Submodule::kGainControl);
     RETURN_ON_ERR(
         submodules_.gain_control->AnalyzeCaptureAudio(*capture_buffer));
   }
@@ -1619,6 +1705,7 @@ int AudioProcessingImpl::ProcessCaptureStreamLocked() {
   if ((!config_.noise_suppression.analyze_linear_aec_output_when_available ||
        !linear_aec_buffer || submodules_.echo_control_mobile) &&
       submodules_.noise_suppressor) {
+    ScopedTimer timer(profiler, Submodule::kNoiseSuppressor);
     submodules_.noise_suppressor->Analyze(*capture_buffer);
   }
 
@@ -1630,9 +1717,11 @@ int AudioProcessingImpl::ProcessCaptureStreamLocked() {
     }
 
     if (submodules_.noise_suppressor) {
+      ScopedTimer timer(profiler, Submodule::kNoiseSuppressor);
       submodules_.noise_suppressor->Process(capture_buffer);
     }
 
+    ScopedTimer timer(profiler, Submodule::kEchoControlMobile);
     RETURN_ON_ERR(submodules_.echo_control_mobile->ProcessCaptureAudio(
         capture_buffer, stream_delay_ms()));
   } else {
@@ -1643,21 +1732,25 @@ int AudioProcessingImpl::ProcessCaptureStreamLocked() {
         submodules_.echo_controller->SetAudioBufferDelay(stream_delay_ms());
       }
 
+      ScopedTimer timer(profiler, Submodule::kEchoController);
       submodules_.echo_controller->ProcessCapture(
           capture_buffer, linear_aec_buffer, capture_.echo_path_gain_change);
     }
 
     if (config_.noise_suppression.analyze_linear_aec_output_when_available &&
         linear_aec_buffer && submodules_.noise_suppressor) {
+      ScopedTimer timer(profiler, Submodule::kNoiseSuppressor);
       submodules_.noise_suppressor->Analyze(*linear_aec_buffer);
     }
 
     if (submodules_.noise_suppressor) {
+      ScopedTimer timer(profiler, Submodule::kNoiseSuppressor);
       submodules_.noise_suppressor->Process(capture_buffer);
     }
   }
 
   if (submodules_.agc_manager) {
+    ScopedTimer timer(profiler, Submodule::kGainControl);
     submodules_.agc_manager->Process(*capture_buffer);
 
     absl::optional<int> new_digital_gain =
@@ -1669,6 +1762,7 @@ int AudioProcessingImpl::ProcessCaptureStreamLocked() {
 
   if (submodules_.gain_control) {
     // TODO(peah): Add reporting from AEC3 whether there is echo.
+    ScopedTimer timer(profiler, Submodule::kGainControl);
     RETURN_ON_ERR(submodules_.gain_control->ProcessCaptureAudio(
         capture_buffer, /*stream_has_echo*/ false));
   }
@@ -1676,6 +1770,7 @@ int AudioProcessingImpl::ProcessCaptureStreamLocked() {
   if (submodule_states_.CaptureMultiBandProcessingPresent() &&
       SampleRateSupportsMultiBand(
           capture_nonlocked_.capture_processing_format.sample_rate_hz())) {
+    ScopedTimer timer(profiler, Submodule::kBandSplitting);
     capture_buffer->MergeFrequencyBands();
   }
 
@@ -1692,17 +1787,30 @@ int AudioProcessingImpl::ProcessCaptureStreamLocked() {
     }
 
     if (submodules_.echo_detector) {
+      ScopedTimer timer(profiler, Submodule::kEchoDetector);
       submodules_.echo_detector->AnalyzeCaptureAudio(
           rtc::ArrayView<const float>(capture_buffer->channels()[0],
                                       capture_buffer->num_frames()));
     }
 
+    absl::optional<int> shared_pitch_period_48kHz;
+    if (config_.noise_suppression.share_pitch_estimate &&
+        submodules_.noise_suppressor) {
+      shared_pitch_period_48kHz =
+          submodules_.noise_suppressor->pitch_period_48kHz();
+    }
+
     absl::optional<float> voice_probability;
     if (!!submodules_.voice_activity_detector) {
+      ScopedTimer timer(profiler, Submodule::kVoiceActivityDetector);
       voice_probability = submodules_.voice_activity_detector->Analyze(
           AudioFrameView<const float>(capture_buffer->channels(),
                                       capture_buffer->num_channels(),
-                                      capture_buffer->num_frames()));
+                                      capture_buffer->num_frames()),
+          shared_pitch_period_48kHz);
+    } else if (UseNoiseSuppressorVad(config_)) {
+      RTC_DCHECK(submodules_.noise_suppressor);
+      voice_probability = submodules_.noise_suppressor->speech_probability();
     }
 
     if (submodules_.transient_suppressor) {
@@ -1722,6 +1830,7 @@ int AudioProcessingImpl::ProcessCaptureStreamLocked() {
           // The transient suppressor will ignore `voice_probability`.
           break;
       }
+      ScopedTimer timer(profiler, Submodule::kTransientSuppressor);
       float delayed_voice_probability =
           submodules_.transient_suppressor->Suppress(
               capture_buffer->channels()[0], capture_buffer->num_frames(),
@@ -1743,12 +1852,15 @@ int AudioProcessingImpl::ProcessCaptureStreamLocked() {
     if (submodules_.gain_controller2) {
       // TODO(bugs.webrtc.org/7494): Let AGC2 detect applied input volume
       // changes.
+      ScopedTimer timer(profiler, Submodule::kGainController2);
+      submodules_.gain_controller2->SetPitchPeriod(shared_pitch_period_48kHz);
       submodules_.gain_controller2->Process(
           voice_probability, capture_.applied_input_volume_changed,
           capture_buffer);
     }
 
     if (submodules_.capture_post_processor) {
+      ScopedTimer timer(profiler, Submodule::kCapturePostProcessor);
       submodules_.capture_post_processor->Process(capture_buffer);
     }
 
@@ -1773,6 +1885,19 @@ int AudioProcessingImpl::ProcessCaptureStreamLocked() {
     }
   }
 
+  if (submodules_.noise_suppressor) {
+    capture_.stats.speech_probability =
+        submodules_.noise_suppressor->rnnoise_enabled()
+            ? absl::optional<float>(
+                  submodules_.noise_suppressor->speech_probability())
+            : absl::nullopt;
+    capture_.stats.noise_suppression_delay_ms =
+        submodules_.noise_suppressor->algorithmic_delay_ms();
+  } else {
+    capture_.stats.speech_probability = absl::nullopt;
+    capture_.stats.noise_suppression_delay_ms = absl::nullopt;
+  }
+
   // Compute echo-controller stats.
   if (submodules_.echo_controller) {
     auto ec_metrics = submodules_.echo_controller->GetMetrics();
@@ -1782,6 +1907,14 @@ int AudioProcessingImpl::ProcessCaptureStreamLocked() {
     capture_.stats.delay_ms = ec_metrics.delay_ms;
   }
 
+  if (profiler) {
+    absl::optional<AudioProcessingStats::SubmoduleTimings> timings =
+        profiler->EndFrame(rtc::TimeNanos() - capture_start_ns);
+    if (timings.has_value()) {
+      capture_.stats.submodule_timings = timings;
+    }
+  }
+
   // Pass stats for reporting.
   stats_reporter_.UpdateStatistics(capture_.stats);
 
@@ -2153,7 +2286,8 @@ void AudioProcessingImpl::InitializeTransientSuppressor() {
   const TransientSuppressor::VadMode previous_vad_mode =
       transient_suppressor_vad_mode_;
   transient_suppressor_vad_mode_ = TransientSuppressor::VadMode::kDefault;
-  if (UseApmVadSubModule(config_, gain_controller2_experiment_params_)) {
+  if (UseApmVadSubModule(config_, gain_controller2_experiment_params_) ||
+      UseNoiseSuppressorVad(config_)) {
     transient_suppressor_vad_mode_ = TransientSuppressor::VadMode::kRnnVad;
   }
   const bool vad_mode_changed =
@@ -2300,6 +2434,10 @@ void AudioProcessingImpl::InitializeGainController1() {
   if (!config_.gain_controller1.enabled) {
     submodules_.agc_manager.reset();
     submodules_.gain_control.reset();
+    // Release the render queue and its buffers.
+    agc_render_signal_queue_.reset();
+    agc_render_queue_buffer_ = std::vector<int16_t>();
+    agc_capture_queue_buffer_ = std::vector<int16_t>();
     return;
   }
 
@@ -2311,6 +2449,18 @@ void AudioProcessingImpl::InitializeGainController1() {
     submodules_.gain_control.reset(new GainControlImpl());
   }
 
+  if (!agc_render_signal_queue_) {
+    const size_t max_element_size =
+        std::max(static_cast<size_t>(1), kMaxAllowedValuesOfSamplesPerBand);
+    std::vector<int16_t> template_queue_element(max_element_size);
+    agc_render_signal_queue_.reset(
+        new SwapQueue<std::vector<int16_t>, RenderQueueItemVerifier<int16_t>>(
+            kMaxNumFramesToBuffer, template_queue_element,
+            RenderQueueItemVerifier<int16_t>(max_element_size)));
+    agc_render_queue_buffer_.resize(max_element_size);
+    agc_capture_queue_buffer_.resize(max_element_size);
+  }
+
   submodules_.gain_control->Initialize(num_proc_channels(),
                                        proc_sample_rate_hz());
   if (!config_.gain_controller1.analog_gain_controller.enabled) {
@@ -2372,9 +2522,11 @@ void AudioProcessingImpl::InitializeGainController2() {
           ? gain_controller2_experiment_params_->agc2_config
                 ->input_volume_controller
           : InputVolumeController::Config{};
-  // If the APM VAD sub-module is not used, let AGC2 use its internal VAD.
+  // If neither the APM VAD sub-module nor the noise suppressor VAD is used, let
+  // AGC2 use its internal VAD.
   const bool use_internal_vad =
-      !UseApmVadSubModule(config_, gain_controller2_experiment_params_);
+      !UseApmVadSubModule(config_, gain_controller2_experiment_params_) &&
+      !UseNoiseSuppressorVad(config_);
   submodules_.gain_controller2 = std::make_unique<GainController2>(
       config_.gain_controller2, input_volume_controller_config,
       proc_fullband_sample_rate_hz(), num_proc_channels(), use_internal_vad);
@@ -2393,6 +2545,9 @@ void AudioProcessingImpl::InitializeVoiceActivityDetector() {
     // TODO(bugs.webrtc.org/13663): Cache CPU features in APM and use here.
     submodules_.voice_activity_detector =
         std::make_unique<VoiceActivityDetectorWrapper>(
+            kVadResetPeriodMs,
+            config_.gain_controller2.adaptive_digital.vad_analysis_period_ms,
+            config_.gain_controller2.adaptive_digital.vad_decimate_48kHz,
             submodules_.gain_controller2->GetCpuFeatures(),
             proc_fullband_sample_rate_hz());
   } else {
@@ -2421,11 +2576,48 @@ void AudioProcessingImpl::InitializeNoiseSuppressor() {
           }
           RTC_CHECK_NOTREACHED();
         };
+    auto map_tier =
+        [](AudioProcessing::Config::NoiseSuppression::RnnoiseTier tier) {
+          using NoiseSuppresionConfig =
+              AudioProcessing::Config::NoiseSuppression;
+          switch (tier) {
+            case NoiseSuppresionConfig::kRnnoiseFull:
+              return NsConfig::RnnoiseTier::kFull;
+            case NoiseSuppresionConfig::kRnnoiseLite:
+              return NsConfig::RnnoiseTier::kLite;
+            case NoiseSuppresionConfig::kRnnoiseAuto:
+              return NsConfig::RnnoiseTier::kAuto;
+          }
+          RTC_CHECK_NOTREACHED();
+        };
 
     NsConfig cfg;
     cfg.target_level = map_level(config_.noise_suppression.level);
+    // RNNoise is nonlinear and time-varying, so running it ahead of the echo
+    // cancellation would disturb the echo path estimation. With an active echo
+    // canceller, denoise the lowest band after the echo cancellation instead.
+    const bool echo_cancellation_active =
+        submodules_.echo_controller || submodules_.echo_control_mobile;
+    cfg.rnnoise_full_band = config_.noise_suppression.rnnoise_full_band &&
+                            !echo_cancellation_active;
+    cfg.rnnoise_model_path = rnnoise_model_path_;
+    cfg.rnnoise_lite_model_path = rnnoise_lite_model_path_;
+    cfg.rnnoise_tier = map_tier(config_.noise_suppression.rnnoise_tier);
+    cfg.rnnoise_silence_gate_frames =
+        config_.noise_suppression.rnnoise_silence_gate_frames;
+    cfg.rnnoise_hybrid = config_.noise_suppression.rnnoise_hybrid;
+    cfg.rnnoise_low_delay = config_.noise_suppression.rnnoise_low_delay;
+    cfg.rnnoise_level_control =
+        config_.noise_suppression.rnnoise_level_control;
+    cfg.rnnoise_linked_channels =
+        config_.noise_suppression.rnnoise_linked_channels;
+    cfg.rnnoise_analysis_used = UseNoiseSuppressorVad(config_) ||
+                                config_.noise_suppression.share_pitch_estimate;
     submodules_.noise_suppressor = std::make_unique<NoiseSuppressor>(
-        cfg, proc_sample_rate_hz(), num_proc_channels());
+        cfg, proc_sample_rate_hz(), num_proc_channels(),
+        processing_thread_pool_);
+    submodules_.noise_suppressor->SetCaptureOutputUsage(
+        capture_.capture_output_used);
   }
 }
 
@@ -2453,6 +2645,15 @@ void AudioProcessingImpl::InitializeCaptureLevelsAdjuster() {
   }
 }
 
+void AudioProcessingImpl::InitializeSubmoduleProfiler() {
+  if (config_.pipeline.profile_submodules) {
+    capture_.submodule_profiler = std::make_unique<CaptureSubmoduleProfiler>();
+  } else {
+    capture_.submodule_profiler.reset();
+    capture_.stats.submodule_timings = absl::nullopt;
+  }
+}
+
 void AudioProcessingImpl::InitializeResidualEchoDetector() {
   if (submodules_.echo_detector) {
     submodules_.echo_detector->Initialize(
@@ -28,6 +28,7 @@
 #include "modules/audio_processing/agc/gain_control.h"
 #include "modules/audio_processing/agc2/input_volume_stats_reporter.h"
 #include "modules/audio_processing/audio_buffer.h"
+#include "modules/audio_processing/capture_submodule_profiler.h"
 #include "modules/audio_processing/capture_levels_adjuster/capture_levels_adjuster.h"
 #include "modules/audio_processing/echo_control_mobile_impl.h"
 #include "modules/audio_processing/gain_control_impl.h"
@@ -38,6 +39,7 @@
 #include "modules/audio_processing/include/audio_processing.h"
 #include "modules/audio_processing/include/audio_processing_statistics.h"
 #include "modules/audio_processing/ns/noise_suppressor.h"
+#include "modules/audio_processing/ns/rnnoise_model.h"
 #include "modules/audio_processing/optionally_built_submodule_creators.h"
 #include "modules/audio_processing/render_queue_item_verifier.h"
 #include "modules/audio_processing/rms_level.h"
@@ -67,7 +69,10 @@ class AudioProcessingImpl : public AudioProcessing {
                       std::unique_ptr<CustomProcessing> render_pre_processor,
                       std::unique_ptr<EchoControlFactory> echo_control_factory,
                       rtc::scoped_refptr<EchoDetector> echo_detector,
-                      std::unique_ptr<CustomAudioAnalyzer> capture_analyzer);
+                      std::unique_ptr<CustomAudioAnalyzer> capture_analyzer,
+                      absl::string_view rnnoise_model_path,
+                      absl::string_view rnnoise_lite_model_path,
+                      ProcessingThreadPool* processing_thread_pool);
   ~AudioProcessingImpl() override;
   int Initialize() override;
   int Initialize(const ProcessingConfig& processing_config) override;
@@ -227,6 +232,9 @@ class AudioProcessingImpl : public AudioProcessing {
   static AudioProcessing::Config AdjustConfig(
       const AudioProcessing::Config& config,
       const absl::optional<GainController2ExperimentParams>& experiment_params);
+  // Returns true if the speech probability of the noise suppressor replaces
+  // the VADs of AGC2 and of the transient suppressor.
+  static bool UseNoiseSuppressorVad(const AudioProcessing::Config& config);
   // Returns true if the APM VAD sub-module should be used.
   static bool UseApmVadSubModule(
       const AudioProcessing::Config& config,
@@ -240,6 +248,20 @@ class AudioProcessingImpl : public AudioProcessing {
   RuntimeSettingEnqueuer capture_runtime_settings_enqueuer_;
   RuntimeSettingEnqueuer render_runtime_settings_enqueuer_;
 
+  // Path of the RNNoise model file, empty for the built-in model.
+  const std::string rnnoise_model_path_;
+  // Path of the RNNoise model file of the lite tier, empty if none.
+  const std::string rnnoise_lite_model_path_;
+  // Worker threads on which the noise suppressor processes the channels, if
+  // not null. Not owned.
+  ProcessingThreadPool* const processing_thread_pool_;
+  // RNNoise model loaded by PostRuntimeSetting() for the
+  // kCaptureRnnoiseModelReload setting, and applied when the setting is handled
+  // on the capture side.
+  Mutex rnnoise_model_mutex_;
+  std::shared_ptr<const RnnoiseModel> pending_rnnoise_model_
+      RTC_GUARDED_BY(rnnoise_model_mutex_);
+
   // EchoControl factory.
   const std::unique_ptr<EchoControlFactory> echo_control_factory_;
 
@@ -311,12 +333,15 @@ class AudioProcessingImpl : public AudioProcessing {
       RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_render_, mutex_capture_);
   void InitializeEchoController()
       RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_render_, mutex_capture_);
+  // Also allocates the AGC1 render queue when AGC1 is enabled, and releases
+  // it otherwise.
+  void InitializeGainController1()
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_render_, mutex_capture_);
 
   // Initializations of capture-only sub-modules, requiring the capture lock
   // already acquired.
   void InitializeHighPassFilter(bool forced_reset)
       RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_capture_);
-  void InitializeGainController1() RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_capture_);
   void InitializeTransientSuppressor()
       RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_capture_);
   // Initializes the `GainController2` sub-module. If the sub-module is enabled,
@@ -334,6 +359,9 @@ class AudioProcessingImpl : public AudioProcessing {
       RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_capture_);
   void InitializePostProcessor() RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_capture_);
   void InitializeAnalyzer() RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_capture_);
+  // Creates the per-submodule profiler if enabled in the pipeline config.
+  void InitializeSubmoduleProfiler()
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_capture_);
 
   // Initializations of render-only submodules, requiring the render lock
   // already acquired.
@@ -349,7 +377,8 @@ class AudioProcessingImpl : public AudioProcessing {
   void HandleRenderRuntimeSettings()
       RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_render_);
 
-  void EmptyQueuedRenderAudio() RTC_LOCKS_EXCLUDED(mutex_capture_);
+  // Called on the render side when a render queue is full.
+  void HandleRenderQueueOverflow() RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_render_);
   void EmptyQueuedRenderAudioLocked()
       RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_capture_);
   void AllocateRenderQueue()
@@ -522,6 +551,9 @@ class AudioProcessingImpl : public AudioProcessing {
     // that audio is acquired. Unspecified when no input volume can be
     // recommended.
     absl::optional<int> recommended_input_volume;
+    // Measures the time spent in the capture submodules. Null unless enabled
+    // in the pipeline config.
+    std::unique_ptr<CaptureSubmoduleProfiler> submodule_profiler;
   } capture_ RTC_GUARDED_BY(mutex_capture_);
 
   struct ApmCaptureNonLockedState {
@@ -543,6 +575,7 @@ class AudioProcessingImpl : public AudioProcessing {
     ~ApmRenderState();
     std::unique_ptr<AudioConverter> render_converter;
     std::unique_ptr<AudioBuffer> render_audio;
+    int num_dropped_render_frames = 0;
   } render_ RTC_GUARDED_BY(mutex_render_);
 
   // Class for statistics reporting. The class is thread-safe and no lock is
@@ -568,8 +601,6 @@ class AudioProcessingImpl : public AudioProcessing {
   std::vector<int16_t> aecm_capture_queue_buffer_
       RTC_GUARDED_BY(mutex_capture_);
 
-  size_t agc_render_queue_element_max_size_ RTC_GUARDED_BY(mutex_render_)
-      RTC_GUARDED_BY(mutex_capture_) = 0;
   std::vector<int16_t> agc_render_queue_buffer_ RTC_GUARDED_BY(mutex_render_);
   std::vector<int16_t> agc_capture_queue_buffer_ RTC_GUARDED_BY(mutex_capture_);
 
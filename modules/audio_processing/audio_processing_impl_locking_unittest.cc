@@ -9,7 +9,9 @@
  */
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "api/array_view.h"
@@ -991,8 +993,100 @@ void RenderProcessor::ApplyRuntimeSettingScheme() {
                frame_data_.input_number_of_channels);
 }
 
+// Capture post-processor which, once armed, blocks the capture call until
+// released, while the capture lock is held.
+class BlockingCapturePostProcessor : public CustomProcessing {
+ public:
+  BlockingCapturePostProcessor(rtc::Event* entered, rtc::Event* release)
+      : entered_(entered), release_(release) {}
+
+  void Arm() { armed_ = true; }
+
+  void Initialize(int sample_rate_hz, int num_channels) override {}
+  void Process(AudioBuffer* audio) override {
+    if (armed_.exchange(false)) {
+      entered_->Set();
+      release_->Wait(kTestTimeOutLimit);
+    }
+  }
+  std::string ToString() const override { return "BlockingCapture"; }
+
+ private:
+  rtc::Event* const entered_;
+  rtc::Event* const release_;
+  std::atomic<bool> armed_{false};
+};
+
 }  // namespace
 
+// Verifies that the render side keeps running while the capture side is
+// blocked with the capture lock held, also once the render queues are full.
+TEST(AudioProcessingImplRenderQueueTest, RenderDoesNotWaitForBlockedCapture) {
+  constexpr int kNumRenderFrames = 500;
+  rtc::Event capture_entered;
+  rtc::Event capture_release;
+  rtc::Event render_done;
+  auto post_processor = std::make_unique<BlockingCapturePostProcessor>(
+      &capture_entered, &capture_release);
+  BlockingCapturePostProcessor* post_processor_ptr = post_processor.get();
+  AudioProcessing::Config apm_config;
+  apm_config.echo_canceller.enabled = true;
+  apm_config.echo_canceller.mobile_mode = true;
+  apm_config.gain_controller1.enabled = true;
+  rtc::scoped_refptr<AudioProcessing> apm =
+      AudioProcessingBuilderForTesting()
+          .SetConfig(apm_config)
+          .SetCapturePostProcessing(std::move(post_processor))
+          .Create();
+
+  const StreamConfig stream_config(16000, 1);
+  std::vector<int16_t> capture_frame(stream_config.num_samples(), 100);
+  std::vector<int16_t> render_frame(stream_config.num_samples(), 100);
+  apm->set_stream_delay_ms(0);
+  apm->set_stream_analog_level(100);
+  ASSERT_EQ(apm->ProcessStream(capture_frame.data(), stream_config,
+                               stream_config, capture_frame.data()),
+            AudioProcessing::kNoError);
+  ASSERT_EQ(apm->ProcessReverseStream(render_frame.data(), stream_config,
+                                      stream_config, render_frame.data()),
+            AudioProcessing::kNoError);
+
+  post_processor_ptr->Arm();
+  auto capture_thread = rtc::PlatformThread::SpawnJoinable(
+      [&] {
+        apm->set_stream_delay_ms(0);
+        apm->set_stream_analog_level(100);
+        EXPECT_EQ(apm->ProcessStream(capture_frame.data(), stream_config,
+                                     stream_config, capture_frame.data()),
+                  AudioProcessing::kNoError);
+      },
+      "capture");
+  ASSERT_TRUE(capture_entered.Wait(kTestTimeOutLimit));
+  auto render_thread = rtc::PlatformThread::SpawnJoinable(
+      [&] {
+        for (int i = 0; i < kNumRenderFrames; ++i) {
+          EXPECT_EQ(apm->ProcessReverseStream(render_frame.data(),
+                                              stream_config, stream_config,
+                                              render_frame.data()),
+                    AudioProcessing::kNoError);
+        }
+        render_done.Set();
+      },
+      "render");
+  const bool render_finished = render_done.Wait(TimeDelta::Seconds(30));
+  capture_release.Set();
+  EXPECT_TRUE(render_finished);
+  capture_thread.Finalize();
+  render_thread.Finalize();
+
+  // The capture side drains the queues again once unblocked.
+  apm->set_stream_delay_ms(0);
+  apm->set_stream_analog_level(100);
+  EXPECT_EQ(apm->ProcessStream(capture_frame.data(), stream_config,
+                               stream_config, capture_frame.data()),
+            AudioProcessing::kNoError);
+}
+
 TEST_P(AudioProcessingImplLockTest, LockTest) {
   // Run test and verify that it did not time out.
   ASSERT_TRUE(RunTest());
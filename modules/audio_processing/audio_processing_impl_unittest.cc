@@ -18,6 +18,8 @@
 #include "absl/types/optional.h"
 #include "api/make_ref_counted.h"
 #include "api/scoped_refptr.h"
+#include "modules/audio_processing/audio_buffer.h"
+#include "modules/audio_processing/capture_submodule_profiler.h"
 #include "modules/audio_processing/include/audio_processing.h"
 #include "modules/audio_processing/optionally_built_submodule_creators.h"
 #include "modules/audio_processing/test/audio_processing_builder_for_testing.h"
@@ -520,6 +522,38 @@ TEST(AudioProcessingImplTest,
   apm->ProcessStream(frame.data(), stream_config, stream_config, frame.data());
 }
 
+// Tests that the AGC1 render queue, which is only allocated while AGC1 is
+// enabled, is available whenever AGC1 is toggled via `ApplyConfig()`.
+TEST(AudioProcessingImplTest, ProcessesRenderAudioWhenAgc1IsToggled) {
+  rtc::scoped_refptr<AudioProcessing> apm =
+      AudioProcessingBuilderForTesting().Create();
+  webrtc::AudioProcessing::Config apm_config;
+  apm_config.gain_controller1.mode =
+      AudioProcessing::Config::GainController1::kAdaptiveDigital;
+  apm_config.gain_controller1.analog_gain_controller.enabled = false;
+
+  constexpr int kSampleRateHz = 16000;
+  constexpr int kNumChannels = 1;
+  std::array<int16_t, kNumChannels * kSampleRateHz / 100> frame;
+  frame.fill(1000);
+  StreamConfig stream_config(kSampleRateHz, kNumChannels);
+
+  for (bool agc1_enabled : {false, true, false, true}) {
+    SCOPED_TRACE(agc1_enabled);
+    apm_config.gain_controller1.enabled = agc1_enabled;
+    apm->ApplyConfig(apm_config);
+    for (int i = 0; i < 10; ++i) {
+      EXPECT_EQ(apm->ProcessReverseStream(frame.data(), stream_config,
+                                          stream_config, frame.data()),
+                AudioProcessing::kNoError);
+      apm->set_stream_analog_level(100);
+      EXPECT_EQ(apm->ProcessStream(frame.data(), stream_config, stream_config,
+                                   frame.data()),
+                AudioProcessing::kNoError);
+    }
+  }
+}
+
 TEST(AudioProcessingImplTest,
      ProcessWithAgc2AndTransientSuppressorVadModeDefault) {
   webrtc::test::ScopedFieldTrials field_trials(
@@ -1560,4 +1594,283 @@ TEST(AudioProcessingImplTest,
   EXPECT_FALSE(apm->GetConfig().transient_suppression.enabled);
 }
 
+TEST(AudioProcessingImplTest, ReportsSpeechProbabilityWhenNsIsEnabled) {
+  AudioProcessing::Config config;
+  auto apm = AudioProcessingBuilder().SetConfig(config).Create();
+  constexpr int kSampleRateHz = 48000;
+  std::array<float, kSampleRateHz / 100> buffer;
+  float* channel_pointers[] = {buffer.data()};
+  StreamConfig stream_config(kSampleRateHz, /*num_channels=*/1);
+  Random random_generator(2341U);
+
+  RandomizeSampleVector(&random_generator, buffer);
+  ASSERT_EQ(apm->ProcessStream(channel_pointers, stream_config, stream_config,
+                               channel_pointers),
+            kNoErr);
+  EXPECT_FALSE(apm->GetStatistics().speech_probability.has_value());
+
+  config.noise_suppression.enabled = true;
+  apm->ApplyConfig(config);
+  for (int i = 0; i < 10; ++i) {
+    RandomizeSampleVector(&random_generator, buffer);
+    ASSERT_EQ(apm->ProcessStream(channel_pointers, stream_config, stream_config,
+                                 channel_pointers),
+              kNoErr);
+  }
+  const absl::optional<double> speech_probability =
+      apm->GetStatistics().speech_probability;
+  ASSERT_TRUE(speech_probability.has_value());
+  EXPECT_GE(*speech_probability, 0.0);
+  EXPECT_LE(*speech_probability, 1.0);
+}
+
+TEST(AudioProcessingImplTest, ReportsNoiseSuppressionDelayWhenNsIsEnabled) {
+  AudioProcessing::Config config;
+  auto apm = AudioProcessingBuilder().SetConfig(config).Create();
+  constexpr int kSampleRateHz = 48000;
+  std::array<float, kSampleRateHz / 100> buffer{};
+  float* channel_pointers[] = {buffer.data()};
+  StreamConfig stream_config(kSampleRateHz, /*num_channels=*/1);
+  ASSERT_EQ(apm->ProcessStream(channel_pointers, stream_config, stream_config,
+                               channel_pointers),
+            kNoErr);
+  EXPECT_FALSE(apm->GetStatistics().noise_suppression_delay_ms.has_value());
+
+  config.noise_suppression.enabled = true;
+  config.noise_suppression.rnnoise_hybrid = true;
+  apm->ApplyConfig(config);
+  ASSERT_EQ(apm->ProcessStream(channel_pointers, stream_config, stream_config,
+                               channel_pointers),
+            kNoErr);
+  // The hybrid mode only has the delay of the filter bank.
+  EXPECT_EQ(apm->GetStatistics().noise_suppression_delay_ms, 6);
+}
+
+TEST(AudioProcessingImplTest, ReportsSubmoduleTimingsWhenProfilingIsEnabled) {
+  AudioProcessing::Config config;
+  config.high_pass_filter.enabled = true;
+  auto apm = AudioProcessingBuilder().SetConfig(config).Create();
+  constexpr int kSampleRateHz = 48000;
+  std::array<float, kSampleRateHz / 100> buffer{};
+  float* channel_pointers[] = {buffer.data()};
+  StreamConfig stream_config(kSampleRateHz, /*num_channels=*/1);
+  // Pulls the statistics after each frame, so that the ones of the last frame
+  // are reported next.
+  auto process_reporting_period = [&] {
+    for (int i = 0; i < CaptureSubmoduleProfiler::kReportingPeriodFrames;
+         ++i) {
+      apm->GetStatistics();
+      ASSERT_EQ(apm->ProcessStream(channel_pointers, stream_config,
+                                   stream_config, channel_pointers),
+                kNoErr);
+    }
+  };
+
+  process_reporting_period();
+  EXPECT_FALSE(apm->GetStatistics().submodule_timings.has_value());
+
+  config.pipeline.profile_submodules = true;
+  apm->ApplyConfig(config);
+  process_reporting_period();
+  const absl::optional<AudioProcessingStats::SubmoduleTimings> timings =
+      apm->GetStatistics().submodule_timings;
+  ASSERT_TRUE(timings.has_value());
+  EXPECT_GE(timings->total_us, timings->high_pass_filter_us);
+  EXPECT_GE(timings->max_total_us, timings->total_us);
+  EXPECT_EQ(timings->echo_controller_us, 0.0);
+
+  config.pipeline.profile_submodules = false;
+  apm->ApplyConfig(config);
+  ASSERT_EQ(apm->ProcessStream(channel_pointers, stream_config, stream_config,
+                               channel_pointers),
+            kNoErr);
+  EXPECT_FALSE(apm->GetStatistics().submodule_timings.has_value());
+}
+
+// Verifies that AGC2 and TS can run on the speech probability of the noise
+// suppressor instead of on their own VADs.
+TEST(AudioProcessingImplTest, ProcessSucceedsWithSharedNsSpeechProbability) {
+  AudioProcessing::Config config;
+  config.noise_suppression.enabled = true;
+  config.noise_suppression.share_speech_probability = true;
+  config.transient_suppression.enabled = true;
+  config.gain_controller2.enabled = true;
+  config.gain_controller2.adaptive_digital.enabled = true;
+  auto apm = AudioProcessingBuilder().SetConfig(config).Create();
+
+  constexpr int kSampleRateHz = 48000;
+  std::array<float, kSampleRateHz / 100> buffer;
+  float* channel_pointers[] = {buffer.data()};
+  StreamConfig stream_config(kSampleRateHz, /*num_channels=*/1);
+  Random random_generator(2341U);
+  for (int i = 0; i < 10; ++i) {
+    SCOPED_TRACE(i);
+    RandomizeSampleVector(&random_generator, buffer);
+    ASSERT_EQ(apm->ProcessStream(channel_pointers, stream_config, stream_config,
+                                 channel_pointers),
+              kNoErr);
+  }
+
+  // Toggling the sharing reconfigures AGC2 and TS.
+  config.noise_suppression.share_speech_probability = false;
+  apm->ApplyConfig(config);
+  RandomizeSampleVector(&random_generator, buffer);
+  EXPECT_EQ(apm->ProcessStream(channel_pointers, stream_config, stream_config,
+                               channel_pointers),
+            kNoErr);
+}
+
+// Verifies that the VADs of AGC2 and TS can use the pitch estimated by the
+// noise suppressor, both at 48 kHz where RNNoise may run on the full band and
+// when it runs on the lowest band.
+TEST(AudioProcessingImplTest, ProcessSucceedsWithSharedNsPitchEstimate) {
+  for (bool rnnoise_full_band : {false, true}) {
+    SCOPED_TRACE(rnnoise_full_band);
+    AudioProcessing::Config config;
+    config.noise_suppression.enabled = true;
+    config.noise_suppression.share_pitch_estimate = true;
+    config.noise_suppression.rnnoise_full_band = rnnoise_full_band;
+    config.transient_suppression.enabled = true;
+    config.gain_controller2.enabled = true;
+    config.gain_controller2.adaptive_digital.enabled = true;
+    auto apm = AudioProcessingBuilder().SetConfig(config).Create();
+
+    constexpr int kSampleRateHz = 48000;
+    std::array<float, kSampleRateHz / 100> buffer;
+    float* channel_pointers[] = {buffer.data()};
+    StreamConfig stream_config(kSampleRateHz, /*num_channels=*/1);
+    Random random_generator(2341U);
+    for (int i = 0; i < 10; ++i) {
+      SCOPED_TRACE(i);
+      RandomizeSampleVector(&random_generator, buffer);
+      ASSERT_EQ(apm->ProcessStream(channel_pointers, stream_config,
+                                   stream_config, channel_pointers),
+                kNoErr);
+    }
+  }
+}
+
+// Verifies that the full-band RNNoise mode does not denoise the capture signal
+// ahead of the echo canceller, which must see the undenoised signal.
+TEST(AudioProcessingImplTest, RnnoiseFullBandDoesNotRunBeforeEchoControl) {
+  std::vector<float> echo_control_input[2];
+  for (bool rnnoise_full_band : {false, true}) {
+    SCOPED_TRACE(rnnoise_full_band);
+    auto echo_control_factory = std::make_unique<MockEchoControlFactory>();
+    MockEchoControl* echo_control_mock = echo_control_factory->GetNext();
+    std::vector<float>& input = echo_control_input[rnnoise_full_band];
+    EXPECT_CALL(*echo_control_mock,
+                ProcessCapture(NotNull(), ::testing::_, ::testing::_))
+        .WillRepeatedly([&input](AudioBuffer* capture, AudioBuffer*, bool) {
+          const float* band = capture->split_bands_const(0)[0];
+          input.insert(input.end(), band,
+                       band + capture->num_frames_per_band());
+        });
+
+    AudioProcessing::Config config;
+    config.noise_suppression.enabled = true;
+    config.noise_suppression.rnnoise_full_band = rnnoise_full_band;
+    rtc::scoped_refptr<AudioProcessing> apm =
+        AudioProcessingBuilderForTesting()
+            .SetConfig(config)
+            .SetEchoControlFactory(std::move(echo_control_factory))
+            .Create();
+
+    constexpr int kSampleRateHz = 48000;
+    std::array<float, kSampleRateHz / 100> buffer;
+    float* channel_pointers[] = {buffer.data()};
+    StreamConfig stream_config(kSampleRateHz, /*num_channels=*/1);
+    Random random_generator(2341U);
+    for (int i = 0; i < 10; ++i) {
+      RandomizeSampleVector(&random_generator, buffer);
+      apm->set_stream_delay_ms(0);
+      ASSERT_EQ(apm->ProcessStream(channel_pointers, stream_config,
+                                   stream_config, channel_pointers),
+                kNoErr);
+    }
+  }
+  ASSERT_FALSE(echo_control_input[0].empty());
+  EXPECT_EQ(echo_control_input[0], echo_control_input[1]);
+}
+
+TEST(AudioProcessingImplTest, RnnoiseLevelControlSkipsRnnoiseAtLowLevel) {
+  for (auto level : {AudioProcessing::Config::NoiseSuppression::kLow,
+                     AudioProcessing::Config::NoiseSuppression::kHigh}) {
+    SCOPED_TRACE(level);
+    AudioProcessing::Config config;
+    config.noise_suppression.enabled = true;
+    config.noise_suppression.level = level;
+    config.noise_suppression.rnnoise_level_control = true;
+    config.noise_suppression.share_speech_probability = true;
+    config.transient_suppression.enabled = true;
+    auto apm = AudioProcessingBuilder().SetConfig(config).Create();
+
+    constexpr int kSampleRateHz = 48000;
+    std::array<float, kSampleRateHz / 100> buffer;
+    float* channel_pointers[] = {buffer.data()};
+    StreamConfig stream_config(kSampleRateHz, /*num_channels=*/1);
+    Random random_generator(2341U);
+    for (int i = 0; i < 10; ++i) {
+      RandomizeSampleVector(&random_generator, buffer);
+      ASSERT_EQ(apm->ProcessStream(channel_pointers, stream_config,
+                                   stream_config, channel_pointers),
+                kNoErr);
+    }
+    // The speech probability is only reported when RNNoise runs.
+    EXPECT_EQ(apm->GetStatistics().speech_probability.has_value(),
+              level != AudioProcessing::Config::NoiseSuppression::kLow);
+  }
+}
+
+namespace {
+
+// Thread pool running the tasks in sequence on the calling thread.
+class SequentialThreadPool : public ProcessingThreadPool {
+ public:
+  void ParallelFor(int num_tasks, rtc::FunctionView<void(int)> task) override {
+    for (int i = 0; i < num_tasks; ++i) {
+      task(i);
+    }
+    num_tasks_ += num_tasks;
+  }
+
+  int num_tasks() const { return num_tasks_; }
+
+ private:
+  int num_tasks_ = 0;
+};
+
+}  // namespace
+
+TEST(AudioProcessingImplTest, NoiseSuppressionUsesInjectedThreadPool) {
+  AudioProcessing::Config config;
+  config.pipeline.multi_channel_capture = true;
+  config.noise_suppression.enabled = true;
+  SequentialThreadPool thread_pool;
+  auto apm = AudioProcessingBuilder()
+                 .SetConfig(config)
+                 .SetProcessingThreadPool(&thread_pool)
+                 .Create();
+
+  constexpr int kSampleRateHz = 48000;
+  constexpr size_t kNumChannels = 8;
+  std::array<std::array<float, kSampleRateHz / 100>, kNumChannels> buffers;
+  std::array<float*, kNumChannels> channel_pointers;
+  for (size_t ch = 0; ch < kNumChannels; ++ch) {
+    channel_pointers[ch] = buffers[ch].data();
+  }
+  StreamConfig stream_config(kSampleRateHz, kNumChannels);
+  Random random_generator(2341U);
+  for (int i = 0; i < 10; ++i) {
+    SCOPED_TRACE(i);
+    for (auto& buffer : buffers) {
+      RandomizeSampleVector(&random_generator, buffer);
+    }
+    ASSERT_EQ(apm->ProcessStream(channel_pointers.data(), stream_config,
+                                 stream_config, channel_pointers.data()),
+              kNoErr);
+  }
+  EXPECT_GT(thread_pool.num_tasks(), 0);
+}
+
 }  // namespace webrtc
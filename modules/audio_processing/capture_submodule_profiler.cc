@@ -0,0 +1,143 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_processing/capture_submodule_profiler.h"
+
+#include <algorithm>
+#include <string>
+
+#include "rtc_base/checks.h"
+#include "rtc_base/time_utils.h"
+#include "system_wrappers/include/metrics.h"
+
+namespace webrtc {
+namespace {
+
+using Submodule = CaptureSubmoduleProfiler::Submodule;
+
+constexpr int kNumSubmodules = static_cast<int>(Submodule::kNumSubmodules);
+
+// Names used in the UMA histograms, in the order of `Submodule`.
+constexpr std::array<const char*, kNumSubmodules> kSubmoduleNames = {
+    "BandSplitting",
+    "HighPassFilter",
+    "CaptureLevelsAdjuster",
+    "EchoController",
+    "EchoControlMobile",
+    "NoiseSuppressor",
+    "GainControl",
+    "GainController2",
+    "VoiceActivityDetector",
+    "TransientSuppressor",
+    "EchoDetector",
+    "CapturePostProcessor",
+};
+
+double* TimingForSubmodule(Submodule submodule,
+                           AudioProcessingStats::SubmoduleTimings& timings) {
+  switch (submodule) {
+    case Submodule::kBandSplitting:
+      return &timings.band_splitting_us;
+    case Submodule::kHighPassFilter:
+      return &timings.high_pass_filter_us;
+    case Submodule::kCaptureLevelsAdjuster:
+      return &timings.capture_levels_adjuster_us;
+    case Submodule::kEchoController:
+      return &timings.echo_controller_us;
+    case Submodule::kEchoControlMobile:
+      return &timings.echo_control_mobile_us;
+    case Submodule::kNoiseSuppressor:
+      return &timings.noise_suppressor_us;
+    case Submodule::kGainControl:
+      return &timings.gain_control_us;
+    case Submodule::kGainController2:
+      return &timings.gain_controller2_us;
+    case Submodule::kVoiceActivityDetector:
+      return &timings.voice_activity_detector_us;
+    case Submodule::kTransientSuppressor:
+      return &timings.transient_suppressor_us;
+    case Submodule::kEchoDetector:
+      return &timings.echo_detector_us;
+    case Submodule::kCapturePostProcessor:
+      return &timings.capture_post_processor_us;
+    case Submodule::kNumSubmodules:
+      break;
+  }
+  RTC_DCHECK_NOTREACHED();
+  return nullptr;
+}
+
+}  // namespace
+
+CaptureSubmoduleProfiler::ScopedTimer::ScopedTimer(
+    CaptureSubmoduleProfiler* profiler,
+    Submodule submodule)
+    : profiler_(profiler), submodule_(submodule) {
+  if (profiler_) {
+    start_ns_ = rtc::TimeNanos();
+  }
+}
+
+CaptureSubmoduleProfiler::ScopedTimer::~ScopedTimer() {
+  if (profiler_) {
+    profiler_->AddDuration(submodule_, rtc::TimeNanos() - start_ns_);
+  }
+}
+
+CaptureSubmoduleProfiler::CaptureSubmoduleProfiler() {
+  submodule_ns_.fill(0);
+}
+
+CaptureSubmoduleProfiler::~CaptureSubmoduleProfiler() = default;
+
+void CaptureSubmoduleProfiler::AddDuration(Submodule submodule,
+                                           int64_t duration_ns) {
+  RTC_DCHECK_LT(static_cast<int>(submodule), kNumSubmodules);
+  submodule_ns_[static_cast<int>(submodule)] += duration_ns;
+}
+
+absl::optional<AudioProcessingStats::SubmoduleTimings>
+CaptureSubmoduleProfiler::EndFrame(int64_t total_ns) {
+  total_ns_ += total_ns;
+  max_total_ns_ = std::max(max_total_ns_, total_ns);
+  if (++num_frames_ < kReportingPeriodFrames) {
+    return absl::nullopt;
+  }
+
+  constexpr double kNsPerUs = 1000.0;
+  const double ns_to_average_us = 1.0 / (kNsPerUs * num_frames_);
+  AudioProcessingStats::SubmoduleTimings timings;
+  for (int k = 0; k < kNumSubmodules; ++k) {
+    const double average_us = submodule_ns_[k] * ns_to_average_us;
+    *TimingForSubmodule(static_cast<Submodule>(k), timings) = average_us;
+    // Only the submodules that ran are logged, so that the histograms are not
+    // dominated by the configurations in which a submodule is disabled.
+    if (submodule_ns_[k] > 0) {
+      RTC_HISTOGRAM_COUNTS_SPARSE(
+          std::string("WebRTC.Audio.Apm.CaptureSubmoduleDurationUs.") +
+              kSubmoduleNames[k],
+          static_cast<int>(average_us), 1, 10000, 50);
+    }
+  }
+  timings.total_us = total_ns_ * ns_to_average_us;
+  timings.max_total_us = max_total_ns_ / kNsPerUs;
+  RTC_HISTOGRAM_COUNTS_10000("WebRTC.Audio.Apm.CaptureDurationUs",
+                             static_cast<int>(timings.total_us));
+  RTC_HISTOGRAM_COUNTS_100000("WebRTC.Audio.Apm.CaptureMaxDurationUs",
+                              static_cast<int>(timings.max_total_us));
+
+  submodule_ns_.fill(0);
+  total_ns_ = 0;
+  max_total_ns_ = 0;
+  num_frames_ = 0;
+  return timings;
+}
+
+}  // namespace webrtc
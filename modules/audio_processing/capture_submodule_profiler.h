@@ -0,0 +1,89 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_AUDIO_PROCESSING_CAPTURE_SUBMODULE_PROFILER_H_
+#define MODULES_AUDIO_PROCESSING_CAPTURE_SUBMODULE_PROFILER_H_
+
+#include <stdint.h>
+
+#include <array>
+
+#include "absl/types/optional.h"
+#include "modules/audio_processing/include/audio_processing_statistics.h"
+
+namespace webrtc {
+
+// Measures the time spent per capture frame in each capture submodule. The
+// durations are averaged over reporting periods of `kReportingPeriodFrames`
+// frames and, at the end of each period, logged to UMA histograms and made
+// available as `AudioProcessingStats::SubmoduleTimings`.
+class CaptureSubmoduleProfiler {
+ public:
+  enum class Submodule {
+    kBandSplitting,
+    kHighPassFilter,
+    kCaptureLevelsAdjuster,
+    kEchoController,
+    kEchoControlMobile,
+    kNoiseSuppressor,
+    kGainControl,
+    kGainController2,
+    kVoiceActivityDetector,
+    kTransientSuppressor,
+    kEchoDetector,
+    kCapturePostProcessor,
+    kNumSubmodules
+  };
+
+  // Number of 10 ms frames per reporting period.
+  static constexpr int kReportingPeriodFrames = 1000;
+
+  // Adds the time elapsed during its lifetime to the duration of `submodule`
+  // in the current frame. Does nothing if `profiler` is null.
+  class ScopedTimer {
+   public:
+    ScopedTimer(CaptureSubmoduleProfiler* profiler, Submodule submodule);
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+    ~ScopedTimer();
+
+   private:
+    CaptureSubmoduleProfiler* const profiler_;
+    const Submodule submodule_;
+    int64_t start_ns_ = 0;
+  };
+
+  CaptureSubmoduleProfiler();
+  CaptureSubmoduleProfiler(const CaptureSubmoduleProfiler&) = delete;
+  CaptureSubmoduleProfiler& operator=(const CaptureSubmoduleProfiler&) = delete;
+  ~CaptureSubmoduleProfiler();
+
+  // Adds `duration_ns` to the duration of `submodule` in the current frame.
+  void AddDuration(Submodule submodule, int64_t duration_ns);
+
+  // Ends the current frame, whose whole capture processing took `total_ns`.
+  // At the end of a reporting period, logs the averages to UMA histograms and
+  // returns them, otherwise returns nullopt.
+  absl::optional<AudioProcessingStats::SubmoduleTimings> EndFrame(
+      int64_t total_ns);
+
+ private:
+  static constexpr int kNumSubmodules =
+      static_cast<int>(Submodule::kNumSubmodules);
+
+  std::array<int64_t, kNumSubmodules> submodule_ns_;
+  int64_t total_ns_ = 0;
+  int64_t max_total_ns_ = 0;
+  int num_frames_ = 0;
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_AUDIO_PROCESSING_CAPTURE_SUBMODULE_PROFILER_H_
@@ -0,0 +1,83 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_processing/capture_submodule_profiler.h"
+
+#include "absl/types/optional.h"
+#include "api/units/time_delta.h"
+#include "rtc_base/fake_clock.h"
+#include "system_wrappers/include/metrics.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+using Submodule = CaptureSubmoduleProfiler::Submodule;
+using ScopedTimer = CaptureSubmoduleProfiler::ScopedTimer;
+
+constexpr int kFrames = CaptureSubmoduleProfiler::kReportingPeriodFrames;
+
+}  // namespace
+
+TEST(CaptureSubmoduleProfilerTest, ReportsOnlyAtTheEndOfAPeriod) {
+  CaptureSubmoduleProfiler profiler;
+  for (int k = 0; k < kFrames - 1; ++k) {
+    EXPECT_FALSE(profiler.EndFrame(/*total_ns=*/1000).has_value());
+  }
+  EXPECT_TRUE(profiler.EndFrame(/*total_ns=*/1000).has_value());
+  EXPECT_FALSE(profiler.EndFrame(/*total_ns=*/1000).has_value());
+}
+
+TEST(CaptureSubmoduleProfilerTest, AveragesTheTimedDurations) {
+  metrics::Reset();
+  rtc::ScopedFakeClock clock;
+  CaptureSubmoduleProfiler profiler;
+  absl::optional<AudioProcessingStats::SubmoduleTimings> timings;
+  for (int k = 0; k < kFrames; ++k) {
+    {
+      ScopedTimer timer(&profiler, Submodule::kEchoController);
+      clock.AdvanceTime(TimeDelta::Micros(300));
+    }
+    {
+      ScopedTimer timer(&profiler, Submodule::kNoiseSuppressor);
+      clock.AdvanceTime(TimeDelta::Micros(k % 2 == 0 ? 100 : 200));
+    }
+    timings = profiler.EndFrame(/*total_ns=*/k == 0 ? 2000000 : 500000);
+  }
+
+  ASSERT_TRUE(timings.has_value());
+  EXPECT_DOUBLE_EQ(timings->echo_controller_us, 300.0);
+  EXPECT_DOUBLE_EQ(timings->noise_suppressor_us, 150.0);
+  EXPECT_DOUBLE_EQ(timings->gain_controller2_us, 0.0);
+  EXPECT_DOUBLE_EQ(timings->total_us, 501.5);
+  EXPECT_DOUBLE_EQ(timings->max_total_us, 2000.0);
+
+  EXPECT_METRIC_EQ(
+      1, metrics::NumEvents(
+             "WebRTC.Audio.Apm.CaptureSubmoduleDurationUs.EchoController",
+             300));
+  EXPECT_METRIC_EQ(
+      1, metrics::NumEvents(
+             "WebRTC.Audio.Apm.CaptureSubmoduleDurationUs.NoiseSuppressor",
+             150));
+  EXPECT_METRIC_EQ(
+      0, metrics::NumSamples(
+             "WebRTC.Audio.Apm.CaptureSubmoduleDurationUs.GainController2"));
+  EXPECT_METRIC_EQ(
+      1, metrics::NumEvents("WebRTC.Audio.Apm.CaptureDurationUs", 501));
+  EXPECT_METRIC_EQ(
+      1, metrics::NumEvents("WebRTC.Audio.Apm.CaptureMaxDurationUs", 2000));
+}
+
+TEST(CaptureSubmoduleProfilerTest, NullProfilerIsIgnored) {
+  ScopedTimer timer(nullptr, Submodule::kEchoController);
+}
+
+}  // namespace webrtc
@@ -22,10 +22,15 @@ constexpr float kAlpha = 0.001f;
 
 }  // namespace
 
+MeanVarianceEstimator::MeanVarianceEstimator()
+    : MeanVarianceEstimator(kAlpha) {}
+
+MeanVarianceEstimator::MeanVarianceEstimator(float alpha) : alpha_(alpha) {}
+
 void MeanVarianceEstimator::Update(float value) {
-  mean_ = (1.f - kAlpha) * mean_ + kAlpha * value;
+  mean_ = (1.f - alpha_) * mean_ + alpha_ * value;
   variance_ =
-      (1.f - kAlpha) * variance_ + kAlpha * (value - mean_) * (value - mean_);
+      (1.f - alpha_) * variance_ + alpha_ * (value - mean_) * (value - mean_);
   RTC_DCHECK(isfinite(mean_));
   RTC_DCHECK(isfinite(variance_));
 }
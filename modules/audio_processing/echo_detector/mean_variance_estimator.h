@@ -16,12 +16,17 @@ namespace webrtc {
 // This class iteratively estimates the mean and variance of a signal.
 class MeanVarianceEstimator {
  public:
+  MeanVarianceEstimator();
+  // Ctor. `alpha` controls the adaptation speed.
+  explicit MeanVarianceEstimator(float alpha);
+
   void Update(float value);
   float std_deviation() const;
   float mean() const;
   void Clear();
 
  private:
+  const float alpha_;
   // Estimate of the expected value of the input values.
   float mean_ = 0.f;
   // Estimate of the variance of the input values.
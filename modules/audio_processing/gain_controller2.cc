@@ -106,7 +106,9 @@ GainController2::GainController2(
         &data_dumper_, config.adaptive_digital, kAdjacentSpeechFramesThreshold);
     if (use_internal_vad)
       vad_ = std::make_unique<VoiceActivityDetectorWrapper>(
-          kVadResetPeriodMs, cpu_features_, sample_rate_hz);
+          kVadResetPeriodMs, config.adaptive_digital.vad_analysis_period_ms,
+          config.adaptive_digital.vad_decimate_48kHz, cpu_features_,
+          sample_rate_hz);
   }
 
   if (config.input_volume_controller.enabled) {
@@ -164,6 +166,10 @@ void GainController2::Analyze(int applied_input_volume,
   }
 }
 
+void GainController2::SetPitchPeriod(absl::optional<int> pitch_period_48kHz) {
+  pitch_period_48kHz_ = pitch_period_48kHz;
+}
+
 void GainController2::Process(absl::optional<float> speech_probability,
                               bool input_volume_changed,
                               AudioBuffer* audio) {
@@ -187,7 +193,7 @@ void GainController2::Process(absl::optional<float> speech_probability,
     // because APM should not run the same VAD twice (as an APM sub-module and
     // internally in AGC2).
     RTC_DCHECK(!speech_probability.has_value());
-    speech_probability = vad_->Analyze(float_frame);
+    speech_probability = vad_->Analyze(float_frame, pitch_period_48kHz_);
   }
   if (speech_probability.has_value()) {
     RTC_DCHECK_GE(*speech_probability, 0.0f);
@@ -277,7 +283,10 @@ bool GainController2::Validate(
          adaptive.headroom_db >= 0.0f && adaptive.max_gain_db > 0.0f &&
          adaptive.initial_gain_db >= 0.0f &&
          adaptive.max_gain_change_db_per_second > 0.0f &&
-         adaptive.max_output_noise_level_dbfs <= 0.0f;
+         adaptive.max_output_noise_level_dbfs <= 0.0f &&
+         adaptive.vad_analysis_period_ms >= kFrameDurationMs &&
+         adaptive.vad_analysis_period_ms < kVadResetPeriodMs &&
+         adaptive.vad_analysis_period_ms % kFrameDurationMs == 0;
 }
 
 }  // namespace webrtc
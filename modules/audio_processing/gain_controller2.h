@@ -54,6 +54,11 @@ class GainController2 {
   // used or not.
   void SetCaptureOutputUsed(bool capture_output_used);
 
+  // Sets the pitch period at 48 kHz estimated on the capture signal by another
+  // sub-module, which the internal VAD then uses in `Process()` instead of
+  // searching the pitch. If unspecified, the internal VAD searches the pitch.
+  void SetPitchPeriod(absl::optional<int> pitch_period_48kHz);
+
   // Analyzes `audio_buffer` before `Process()` is called so that the analysis
   // can be performed before digital processing operations take place (e.g.,
   // echo cancellation). The analysis consists of input clipping detection and
@@ -88,6 +93,7 @@ class GainController2 {
   GainApplier fixed_gain_applier_;
   std::unique_ptr<NoiseLevelEstimator> noise_level_estimator_;
   std::unique_ptr<VoiceActivityDetectorWrapper> vad_;
+  absl::optional<int> pitch_period_48kHz_;
   std::unique_ptr<SpeechLevelEstimator> speech_level_estimator_;
   std::unique_ptr<InputVolumeController> input_volume_controller_;
   // TODO(bugs.webrtc.org/7494): Rename to `CrestFactorEstimator`.
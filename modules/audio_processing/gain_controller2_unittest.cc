@@ -162,6 +162,18 @@ TEST(GainController2, CheckAdaptiveDigitalMaxOutputNoiseLevelConfig) {
   EXPECT_TRUE(GainController2::Validate(config));
 }
 
+TEST(GainController2, CheckAdaptiveDigitalVadAnalysisPeriodConfig) {
+  Agc2Config config;
+  config.adaptive_digital.vad_analysis_period_ms = 0;
+  EXPECT_FALSE(GainController2::Validate(config));
+  config.adaptive_digital.vad_analysis_period_ms = 15;
+  EXPECT_FALSE(GainController2::Validate(config));
+  config.adaptive_digital.vad_analysis_period_ms = 20;
+  EXPECT_TRUE(GainController2::Validate(config));
+  config.adaptive_digital.vad_analysis_period_ms = 30;
+  EXPECT_TRUE(GainController2::Validate(config));
+}
+
 TEST(GainController2,
      CheckGetRecommendedInputVolumeWhenInputVolumeControllerNotEnabled) {
   constexpr float kHighInputLevel = 32767.0f;
@@ -38,6 +38,22 @@ int ProcessAudioFrame(AudioProcessing* ap, AudioFrame* frame) {
   return result;
 }
 
+int ProcessAudioFrames(rtc::ArrayView<AudioProcessing* const> aps,
+                       rtc::ArrayView<AudioFrame* const> frames) {
+  if (aps.size() != frames.size()) {
+    return AudioProcessing::Error::kBadParameterError;
+  }
+
+  int result = AudioProcessing::Error::kNoError;
+  for (size_t k = 0; k < aps.size(); ++k) {
+    const int stream_result = ProcessAudioFrame(aps[k], frames[k]);
+    if (result == AudioProcessing::Error::kNoError) {
+      result = stream_result;
+    }
+  }
+  return result;
+}
+
 int ProcessReverseAudioFrame(AudioProcessing* ap, AudioFrame* frame) {
   if (!frame || !ap) {
     return AudioProcessing::Error::kNullPointerError;
@@ -11,6 +11,8 @@
 #ifndef MODULES_AUDIO_PROCESSING_INCLUDE_AUDIO_FRAME_PROXIES_H_
 #define MODULES_AUDIO_PROCESSING_INCLUDE_AUDIO_FRAME_PROXIES_H_
 
+#include "api/array_view.h"
+
 namespace webrtc {
 
 class AudioFrame;
@@ -26,6 +28,14 @@ class AudioProcessing;
 // ProcessStream method.
 int ProcessAudioFrame(AudioProcessing* ap, AudioFrame* frame);
 
+// Processes a batch of independent primary streams, the frame `frames[k]`
+// being processed by `aps[k]` as in ProcessAudioFrame(). The AudioProcessing
+// objects must be distinct and `aps` and `frames` must have the same size. All
+// the frames are processed even if some of them fail: the function returns
+// the first error code, or `AudioProcessing::kNoError`.
+int ProcessAudioFrames(rtc::ArrayView<AudioProcessing* const> aps,
+                       rtc::ArrayView<AudioFrame* const> frames);
+
 // Processes a 10 ms `frame` of the reverse direction audio stream using the
 // provided AudioProcessing object. The frame may be modified. On the
 // client-side, this is the far-end (or to be rendered) audio. The
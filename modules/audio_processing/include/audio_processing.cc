@@ -34,6 +34,19 @@ std::string NoiseSuppressionLevelToString(
   RTC_CHECK_NOTREACHED();
 }
 
+std::string RnnoiseTierToString(
+    const AudioProcessing::Config::NoiseSuppression::RnnoiseTier& tier) {
+  switch (tier) {
+    case AudioProcessing::Config::NoiseSuppression::kRnnoiseFull:
+      return "Full";
+    case AudioProcessing::Config::NoiseSuppression::kRnnoiseLite:
+      return "Lite";
+    case AudioProcessing::Config::NoiseSuppression::kRnnoiseAuto:
+      return "Auto";
+  }
+  RTC_CHECK_NOTREACHED();
+}
+
 std::string GainController1ModeToString(const Agc1Config::Mode& mode) {
   switch (mode) {
     case Agc1Config::Mode::kAdaptiveAnalog:
@@ -91,7 +104,9 @@ bool Agc2Config::AdaptiveDigital::operator==(
          max_gain_db == rhs.max_gain_db &&
          initial_gain_db == rhs.initial_gain_db &&
          max_gain_change_db_per_second == rhs.max_gain_change_db_per_second &&
-         max_output_noise_level_dbfs == rhs.max_output_noise_level_dbfs;
+         max_output_noise_level_dbfs == rhs.max_output_noise_level_dbfs &&
+         vad_analysis_period_ms == rhs.vad_analysis_period_ms &&
+         vad_decimate_48kHz == rhs.vad_decimate_48kHz;
 }
 
 bool Agc2Config::InputVolumeController::operator==(
@@ -128,6 +143,7 @@ std::string AudioProcessing::Config::ToString() const {
           << pipeline.maximum_internal_processing_rate
           << ", multi_channel_render: " << pipeline.multi_channel_render
           << ", multi_channel_capture: " << pipeline.multi_channel_capture
+          << ", profile_submodules: " << pipeline.profile_submodules
           << " }, pre_amplifier: { enabled: " << pre_amplifier.enabled
           << ", fixed_gain_factor: " << pre_amplifier.fixed_gain_factor
           << " },capture_level_adjustment: { enabled: "
@@ -146,6 +162,22 @@ std::string AudioProcessing::Config::ToString() const {
           << " }, noise_suppression: { enabled: " << noise_suppression.enabled
           << ", level: "
           << NoiseSuppressionLevelToString(noise_suppression.level)
+          << ", analyze_linear_aec_output_when_available: "
+          << noise_suppression.analyze_linear_aec_output_when_available
+          << ", rnnoise_full_band: " << noise_suppression.rnnoise_full_band
+          << ", share_speech_probability: "
+          << noise_suppression.share_speech_probability
+          << ", share_pitch_estimate: "
+          << noise_suppression.share_pitch_estimate
+          << ", rnnoise_silence_gate_frames: "
+          << noise_suppression.rnnoise_silence_gate_frames
+          << ", rnnoise_hybrid: " << noise_suppression.rnnoise_hybrid
+          << ", rnnoise_low_delay: " << noise_suppression.rnnoise_low_delay
+          << ", rnnoise_level_control: "
+          << noise_suppression.rnnoise_level_control
+          << ", rnnoise_linked_channels: "
+          << noise_suppression.rnnoise_linked_channels << ", rnnoise_tier: "
+          << RnnoiseTierToString(noise_suppression.rnnoise_tier)
           << " }, transient_suppression: { enabled: "
           << transient_suppression.enabled
           << " }, gain_controller1: { enabled: " << gain_controller1.enabled
@@ -202,6 +234,10 @@ std::string AudioProcessing::Config::ToString() const {
           << gain_controller2.adaptive_digital.max_gain_change_db_per_second
           << ", max_output_noise_level_dbfs: "
           << gain_controller2.adaptive_digital.max_output_noise_level_dbfs
+          << ", vad_analysis_period_ms: "
+          << gain_controller2.adaptive_digital.vad_analysis_period_ms
+          << ", vad_decimate_48kHz: "
+          << gain_controller2.adaptive_digital.vad_decimate_48kHz
           << " }, input_volume_control : { enabled "
           << gain_controller2.input_volume_controller.enabled << "}}";
   return builder.str();
@@ -21,6 +21,7 @@
 #include <stdio.h>   // FILE
 #include <string.h>
 
+#include <string>
 #include <vector>
 
 #include "absl/strings/string_view.h"
@@ -30,6 +31,7 @@
 #include "api/audio/echo_control.h"
 #include "api/scoped_refptr.h"
 #include "modules/audio_processing/include/audio_processing_statistics.h"
+#include "modules/audio_processing/include/processing_thread_pool.h"
 #include "rtc_base/arraysize.h"
 #include "rtc_base/ref_count.h"
 #include "rtc_base/system/file_wrapper.h"
@@ -163,6 +165,9 @@ class RTC_EXPORT AudioProcessing : public rtc::RefCountInterface {
       // Indicates how to downmix multi-channel capture audio to mono (when
       // needed).
       DownmixMethod capture_downmix_method = DownmixMethod::kAverageChannels;
+      // Measures the time spent in each capture submodule and reports it via
+      // `AudioProcessingStats::submodule_timings` and UMA histograms.
+      bool profile_submodules = false;
     } pipeline;
 
     // Enabled the pre-amplifier. It amplifies the capture signal
@@ -218,6 +223,47 @@ class RTC_EXPORT AudioProcessing : public rtc::RefCountInterface {
       enum Level { kLow, kModerate, kHigh, kVeryHigh };
       Level level = kModerate;
       bool analyze_linear_aec_output_when_available = false;
+      // Runs the RNNoise denoising on the full-band signal ahead of the band
+      // splitting instead of on the lowest band. Only has an effect when the
+      // capture processing rate is 48 kHz and no echo canceller is active,
+      // since the echo cancellation must see the undenoised signal.
+      bool rnnoise_full_band = false;
+      // Uses the RNNoise speech probability as voice activity for AGC2 and
+      // the transient suppressor instead of running a separate VAD.
+      bool share_speech_probability = false;
+      // Lets the VAD of AGC2 and TS use the RNNoise pitch estimate instead of
+      // searching the pitch again, which saves a pitch search per frame. When
+      // RNNoise runs on the lowest band, the shared pitch period is estimated
+      // at 16 kHz and is hence coarser.
+      bool share_pitch_estimate = false;
+      // Number of consecutive quiet RNNoise frames after which RNNoise is
+      // bypassed and the signal is only attenuated, until the level rises
+      // again. Saves most of the denoising cost for muted or silent
+      // participants. 0 disables the gate.
+      int rnnoise_silence_gate_frames = 0;
+      // Fuses the RNNoise gains into the classic noise suppression filter, so
+      // that the signal goes through a single filter bank and RNNoise adds no
+      // delay. Overrides `rnnoise_full_band`.
+      bool rnnoise_hybrid = false;
+      // Uses a low-delay RNNoise synthesis window, which halves the RNNoise
+      // delay at the cost of a slightly higher spectral leakage.
+      bool rnnoise_low_delay = false;
+      // Limits the RNNoise attenuation to `level`: 12, 18 and 21 dB for
+      // kModerate, kHigh and kVeryHigh. At kLow, RNNoise is not run and the
+      // classic noise suppression, which is much cheaper, is applied alone;
+      // the speech probability and the pitch estimate are then not shared.
+      bool rnnoise_level_control = false;
+      // Computes the RNNoise gains once on the downmix of the capture channels
+      // and applies them to all channels, instead of running RNNoise for each
+      // channel. Saves most of the RNNoise cost for highly correlated
+      // multi-channel capture while keeping the spatial image.
+      bool rnnoise_linked_channels = false;
+      // Selects the complexity tier of the RNNoise model. kRnnoiseLite uses
+      // the model set via AudioProcessingBuilder::SetRnnoiseLiteModelPath(),
+      // which is cheaper to run on low-end devices, and kRnnoiseAuto selects
+      // it on weak CPUs only. The full model is used if no lite model is set.
+      enum RnnoiseTier { kRnnoiseFull, kRnnoiseLite, kRnnoiseAuto };
+      RnnoiseTier rnnoise_tier = kRnnoiseFull;
     } noise_suppression;
 
     // Enables transient suppression.
@@ -368,6 +414,13 @@ class RTC_EXPORT AudioProcessing : public rtc::RefCountInterface {
         float initial_gain_db = 8.0f;
         float max_gain_change_db_per_second = 3.0f;
         float max_output_noise_level_dbfs = -50.0f;
+        // Period in milliseconds at which the voice activity detector (VAD)
+        // analyzes the audio; must be a multiple of 10. The speech probability
+        // is held in between.
+        int vad_analysis_period_ms = 10;
+        // If true and the audio is sampled at 48 kHz, the VAD input is
+        // decimated by two with a low-pass filter instead of resampled.
+        bool vad_decimate_48kHz = false;
       } adaptive_digital;
 
       // Parameters for the fixed digital controller, which applies a fixed
@@ -396,7 +449,8 @@ class RTC_EXPORT AudioProcessing : public rtc::RefCountInterface {
       kCustomRenderProcessingRuntimeSetting,
       kPlayoutAudioDeviceChange,
       kCapturePostGain,
-      kCaptureOutputUsed
+      kCaptureOutputUsed,
+      kCaptureRnnoiseModelReload
     };
 
     // Play-out audio device properties.
@@ -454,6 +508,16 @@ class RTC_EXPORT AudioProcessing : public rtc::RefCountInterface {
       return {Type::kCaptureOutputUsed, capture_output_used};
     }
 
+    // Reloads the RNNoise model file set via
+    // AudioProcessingBuilder::SetRnnoiseModelPath(), e.g. after the file has
+    // been replaced, and switches the noise suppressor to the new
+    // model between two capture frames. The file is read by
+    // PostRuntimeSetting() so that the audio thread is not blocked. The
+    // current model is kept if the file does not hold a valid model.
+    static RuntimeSetting CreateCaptureRnnoiseModelReload() {
+      return {Type::kCaptureRnnoiseModelReload, 0.f};
+    }
+
     Type type() const { return type_; }
     // Getters do not return a value but instead modify the argument to protect
     // from implicit casting.
@@ -779,6 +843,36 @@ class RTC_EXPORT AudioProcessingBuilder {
     return *this;
   }
 
+  // Sets the path of the RNNoise model file used by the noise suppressor
+  // instead of the built-in model. The file is memory-mapped and shared by all
+  // the APM instances using it. The built-in model is used if the file does
+  // not hold a valid model. See
+  // AudioProcessing::RuntimeSetting::CreateCaptureRnnoiseModelReload().
+  AudioProcessingBuilder& SetRnnoiseModelPath(absl::string_view path) {
+    rnnoise_model_path_ = std::string(path);
+    return *this;
+  }
+
+  // Sets the path of a smaller RNNoise model, used instead of the model above
+  // when the lite tier is selected, see
+  // AudioProcessing::Config::NoiseSuppression::rnnoise_tier. The model is not
+  // affected by CreateCaptureRnnoiseModelReload().
+  AudioProcessingBuilder& SetRnnoiseLiteModelPath(absl::string_view path) {
+    rnnoise_lite_model_path_ = std::string(path);
+    return *this;
+  }
+
+  // Sets the pool of worker threads on which the noise suppressor processes
+  // groups of channels concurrently, which shortens the capture processing of
+  // signals with many channels. The output is identical to the one without a
+  // thread pool. The thread pool is not owned and must outlive the APM
+  // instances created by the builder.
+  AudioProcessingBuilder& SetProcessingThreadPool(
+      ProcessingThreadPool* thread_pool) {
+    processing_thread_pool_ = thread_pool;
+    return *this;
+  }
+
   // Creates an APM instance with the specified config or the default one if
   // unspecified. Injects the specified components transferring the ownership
   // to the newly created APM instance - i.e., except for the config, the
@@ -792,6 +886,9 @@ class RTC_EXPORT AudioProcessingBuilder {
   std::unique_ptr<CustomProcessing> render_pre_processing_;
   rtc::scoped_refptr<EchoDetector> echo_detector_;
   std::unique_ptr<CustomAudioAnalyzer> capture_analyzer_;
+  std::string rnnoise_model_path_;
+  std::string rnnoise_lite_model_path_;
+  ProcessingThreadPool* processing_thread_pool_ = nullptr;
 };
 
 class StreamConfig {
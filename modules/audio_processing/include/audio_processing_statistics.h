@@ -60,6 +60,42 @@ struct RTC_EXPORT AudioProcessingStats {
   // milliseconds and the value is the instantaneous value at the time of the
   // call to `GetStatistics()`.
   absl::optional<int32_t> delay_ms;
+
+  // Speech probability computed by the RNNoise network of the noise
+  // suppressor for the last capture frame. Only reported if noise suppression
+  // is enabled. It can be used for voice activity decisions, e.g. DTX, instead
+  // of running a separate VAD.
+  absl::optional<double> speech_probability;
+
+  // Algorithmic delay added to the capture signal by the noise suppressor,
+  // including the RNNoise framing and synthesis. Only reported if noise
+  // suppression is enabled. It is not included in the AEC delay estimates, as
+  // the noise suppression runs after the echo cancellation.
+  absl::optional<int32_t> noise_suppression_delay_ms;
+
+  // Average time in microseconds spent per 10 ms capture frame in each
+  // capture submodule, and in the whole capture processing, over the last
+  // reporting period of 10 seconds. Submodules that did not run are reported
+  // as zero. Only reported if
+  // `AudioProcessing::Config::Pipeline::profile_submodules` is set.
+  struct SubmoduleTimings {
+    double band_splitting_us = 0.0;
+    double high_pass_filter_us = 0.0;
+    double capture_levels_adjuster_us = 0.0;
+    double echo_controller_us = 0.0;
+    double echo_control_mobile_us = 0.0;
+    double noise_suppressor_us = 0.0;
+    double gain_control_us = 0.0;
+    double gain_controller2_us = 0.0;
+    double voice_activity_detector_us = 0.0;
+    double transient_suppressor_us = 0.0;
+    double echo_detector_us = 0.0;
+    double capture_post_processor_us = 0.0;
+    double total_us = 0.0;
+    // Maximum time spent in the whole capture processing of a single frame.
+    double max_total_us = 0.0;
+  };
+  absl::optional<SubmoduleTimings> submodule_timings;
 };
 
 }  // namespace webrtc
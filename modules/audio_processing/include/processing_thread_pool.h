@@ -0,0 +1,37 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_AUDIO_PROCESSING_INCLUDE_PROCESSING_THREAD_POOL_H_
+#define MODULES_AUDIO_PROCESSING_INCLUDE_PROCESSING_THREAD_POOL_H_
+
+#include "api/function_view.h"
+#include "rtc_base/system/rtc_export.h"
+
+namespace webrtc {
+
+// Interface of a pool of worker threads provided by the embedder, on which an
+// APM instance can fan out independent per-channel work. The tasks of one
+// call only touch disjoint data, and their results are combined by the caller
+// after the call returns, so the output does not depend on the scheduling.
+class RTC_EXPORT ProcessingThreadPool {
+ public:
+  virtual ~ProcessingThreadPool() = default;
+
+  // Runs `task(i)` for each `i` in [0, `num_tasks`) and returns once all the
+  // tasks have returned. The tasks may run in any order and concurrently,
+  // including on the calling thread. Called on the capture thread of the APM,
+  // hence the implementation should not block for longer than the tasks take.
+  virtual void ParallelFor(int num_tasks,
+                           rtc::FunctionView<void(int)> task) = 0;
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_AUDIO_PROCESSING_INCLUDE_PROCESSING_THREAD_POOL_H_
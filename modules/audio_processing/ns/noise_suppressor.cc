@@ -15,13 +15,13 @@
 #include <string.h>
 
 #include <algorithm>
+#include <utility>
 
+#include "modules/audio_processing/agc2/cpu_features.h"
 #include "modules/audio_processing/ns/fast_math.h"
 #include "rtc_base/checks.h"
-#include "rnnoise/include/rnnoise.h"
-
-#define FRAME_SIZE 1024
-#define SLIDING_WINDOW_SIZE 128
+#include "rtc_base/logging.h"
+#include "system_wrappers/include/cpu_info.h"
 
 namespace webrtc {
 
@@ -34,6 +34,91 @@ size_t NumBandsForRate(size_t sample_rate_hz) {
   return sample_rate_hz / 16000;
 }
 
+// Returns the RNNoise model stored at `path`, falling back to the built-in
+// model if `path` is empty or the model cannot be loaded.
+std::shared_ptr<const RnnoiseModel> LoadRnnoiseModel(absl::string_view path) {
+  if (!path.empty()) {
+    std::shared_ptr<const RnnoiseModel> model = RnnoiseModel::Load(path);
+    if (model) {
+      return model;
+    }
+    RTC_LOG(LS_WARNING) << "Failed to load the RNNoise model " << path
+                        << ", using the built-in model.";
+  }
+  return RnnoiseModel::BuiltIn();
+}
+
+// Returns whether the device is too weak to run the full RNNoise model on all
+// the audio streams it may process.
+bool IsLowEndCpu() {
+  const AvailableCpuFeatures cpu_features = GetAvailableCpuFeatures();
+  return !(cpu_features.sse2 || cpu_features.neon) ||
+         CpuInfo::DetectNumberOfCores() <= 2;
+}
+
+// Returns the RNNoise model of the tier selected by `config`.
+std::shared_ptr<const RnnoiseModel> LoadRnnoiseModelForTier(
+    const NsConfig& config) {
+  const bool use_lite_model =
+      config.rnnoise_tier == NsConfig::RnnoiseTier::kLite ||
+      (config.rnnoise_tier == NsConfig::RnnoiseTier::kAuto && IsLowEndCpu());
+  if (use_lite_model) {
+    std::shared_ptr<const RnnoiseModel> model =
+        config.rnnoise_lite_model_path.empty()
+            ? nullptr
+            : RnnoiseModel::Load(config.rnnoise_lite_model_path);
+    if (model) {
+      return model;
+    }
+    RTC_LOG(LS_WARNING) << "Failed to load the lite RNNoise model "
+                        << config.rnnoise_lite_model_path
+                        << ", using the full model.";
+  }
+  return LoadRnnoiseModel(config.rnnoise_model_path);
+}
+
+// Returns the spacing of the RNNoise states in the arena, which keeps each
+// state aligned to a cache line.
+size_t RnnoiseStateStride() {
+  const size_t size = static_cast<size_t>(rnnoise_get_size());
+  return (size + RNNOISE_STATE_ALIGNMENT - 1) / RNNOISE_STATE_ALIGNMENT *
+         RNNOISE_STATE_ALIGNMENT;
+}
+
+// Initializes an RNNoise state in the arena and configures it.
+void InitRnnoiseState(DenoiseState* state,
+                      RNNModel* model,
+                      bool low_delay,
+                      float gain_floor,
+                      int silence_gate_frames,
+                      float silence_gate_dbfs,
+                      float silence_gate_gain,
+                      bool analysis_only) {
+  RTC_DCHECK_EQ(rnnoise_get_frame_size(), kRnnoiseFrameSize);
+  RTC_CHECK_EQ(rnnoise_init(state, model), 0);
+  rnnoise_set_low_delay(state, low_delay);
+  const int floor_set = rnnoise_set_gain_floor(state, gain_floor);
+  RTC_DCHECK_EQ(floor_set, 0);
+  const int fft_set = rnnoise_set_fft(state, RNNOISE_FFT_PFFFT);
+  RTC_DCHECK_EQ(fft_set, 0);
+  const float gate_level = 32768.f * powf(10.f, silence_gate_dbfs / 20.f);
+  const int gate_set = rnnoise_set_silence_gate(
+      state, silence_gate_frames, gate_level * gate_level, silence_gate_gain);
+  RTC_DCHECK_EQ(gate_set, 0);
+  rnnoise_set_analysis_only(state, analysis_only);
+}
+
+// Minimum number of channels processed by a task of the thread pool, below
+// which the work of a task does not outweigh the cost of dispatching it.
+constexpr size_t kMinNumChannelsPerTask = 2;
+
+// Returns the number of channel groups to process as separate tasks.
+size_t NumChannelGroups(size_t num_channels, bool has_thread_pool) {
+  return has_thread_pool ? std::max<size_t>(
+                               num_channels / kMinNumChannelsPerTask, 1)
+                         : 1;
+}
+
 // Maximum number of channels for which the channel data is stored on
 // the stack. If the number of channels are larger than this, they are stored
 // using scratch memory that is pre-allocated on the heap. The reason for this
@@ -123,6 +208,18 @@ void DelaySignal(rtc::ArrayView<const float, kNsFrameSize> frame,
             delay_buffer.begin());
 }
 
+// Delays a band by the size of the circular buffer `delay_memory`, of which
+// `index` is the position of the oldest sample.
+void DelayBand(rtc::ArrayView<float> delay_memory,
+               size_t index,
+               rtc::ArrayView<float, kNsFrameSize> band) {
+  RTC_DCHECK_LT(index, delay_memory.size());
+  for (float& sample : band) {
+    std::swap(delay_memory[index], sample);
+    index = index < delay_memory.size() - 1 ? index + 1 : 0;
+  }
+}
+
 // Computes the energy of an extended frame.
 float ComputeEnergyOfExtendedFrame(rtc::ArrayView<const float, kFftSize> x) {
   float energy = 0.f;
@@ -244,10 +341,37 @@ float ComputeUpperBandsGain(
 
 NoiseSuppressor::ChannelState::ChannelState(
     const SuppressionParams& suppression_params,
-    size_t num_bands)
+    size_t num_bands,
+    bool rnnoise_full_band,
+    bool rnnoise_hybrid,
+    bool rnnoise_low_delay,
+    bool rnnoise_delays_upper_bands,
+    float rnnoise_gain_floor,
+    DenoiseState* rnnoise_state,
+    RNNModel* rnnoise_model,
+    int rnnoise_silence_gate_frames,
+    float rnnoise_silence_gate_dbfs)
     : wiener_filter(suppression_params),
       noise_estimator(suppression_params),
-      process_delay_memory(num_bands > 1 ? num_bands - 1 : 0) {
+      process_delay_memory(num_bands > 1 ? num_bands - 1 : 0),
+      rnnoise_framer(rnnoise_full_band ? num_bands * kNsFrameSize
+                                       : kNsFrameSize),
+      rnnoise_state(rnnoise_state) {
+  // The hybrid mode only uses the RNNoise gains.
+  InitRnnoiseState(rnnoise_state, rnnoise_model, rnnoise_low_delay,
+                   rnnoise_gain_floor, rnnoise_silence_gate_frames,
+                   rnnoise_silence_gate_dbfs,
+                   suppression_params.minimum_attenuating_gain,
+                   /*analysis_only=*/rnnoise_hybrid);
+  if (rnnoise_delays_upper_bands) {
+    rnnoise_delay_memory.assign(
+        num_bands - 1,
+        std::vector<float>(rnnoise_framer.delay_samples() +
+                               rnnoise_get_delay(rnnoise_state),
+                           0.f));
+  }
+  rnnoise_gains.fill(1.f);
+  hybrid_filter.fill(1.f);
   analyze_analysis_memory.fill(0.f);
   prev_analysis_signal_spectrum.fill(1.f);
   process_analysis_memory.fill(0.f);
@@ -260,29 +384,164 @@ NoiseSuppressor::ChannelState::ChannelState(
 NoiseSuppressor::NoiseSuppressor(const NsConfig& config,
                                  size_t sample_rate_hz,
                                  size_t num_channels)
+    : NoiseSuppressor(config,
+                      sample_rate_hz,
+                      num_channels,
+                      /*thread_pool=*/nullptr) {}
+
+NoiseSuppressor::NoiseSuppressor(const NsConfig& config,
+                                 size_t sample_rate_hz,
+                                 size_t num_channels,
+                                 ProcessingThreadPool* thread_pool)
     : num_bands_(NumBandsForRate(sample_rate_hz)),
       num_channels_(num_channels),
       suppression_params_(config.target_level),
+      rnnoise_enabled_(!config.rnnoise_level_control ||
+                       suppression_params_.rnnoise_minimum_gain > 0.f),
+      rnnoise_full_band_(rnnoise_enabled_ && config.rnnoise_full_band &&
+                         !config.rnnoise_hybrid && sample_rate_hz == 48000),
+      rnnoise_hybrid_(rnnoise_enabled_ && config.rnnoise_hybrid),
+      rnnoise_linked_(rnnoise_enabled_ && config.rnnoise_linked_channels &&
+                      num_channels > 1),
+      rnnoise_analysis_used_(config.rnnoise_analysis_used),
+      rnnoise_model_(LoadRnnoiseModelForTier(config)),
+      thread_pool_(thread_pool),
+      num_channel_groups_(NumChannelGroups(num_channels_, !!thread_pool_)),
+      ffts_(num_channel_groups_),
       filter_bank_states_heap_(NumChannelsOnHeap(num_channels_)),
       upper_band_gains_heap_(NumChannelsOnHeap(num_channels_)),
       energies_before_filtering_heap_(NumChannelsOnHeap(num_channels_)),
       gain_adjustments_heap_(NumChannelsOnHeap(num_channels_)),
-      channels_(num_channels_) {
+      rnnoise_arena_(static_cast<char*>(
+          AlignedMalloc((num_channels_ + (rnnoise_linked_ ? 1 : 0)) *
+                            RnnoiseStateStride(),
+                        RNNOISE_STATE_ALIGNMENT))),
+      channels_(num_channels_),
+      rnnoise_states_(num_channels_),
+      rnnoise_input_frames_(num_channels_),
+      rnnoise_output_frames_(num_channels_),
+      rnnoise_vad_probabilities_(num_channels_, 0.f) {
+  for (auto& fft : ffts_) {
+    fft = std::make_unique<NrFft>();
+  }
   for (size_t ch = 0; ch < num_channels_; ++ch) {
-    channels_[ch] =
-        std::make_unique<ChannelState>(suppression_params_, num_bands_);
+    channels_[ch] = std::make_unique<ChannelState>(
+        suppression_params_, num_bands_, rnnoise_full_band_, rnnoise_hybrid_,
+        config.rnnoise_low_delay,
+        /*rnnoise_delays_upper_bands=*/rnnoise_enabled_ && num_bands_ > 1 &&
+            !rnnoise_full_band_ && !rnnoise_hybrid_,
+        config.rnnoise_level_control ? suppression_params_.rnnoise_minimum_gain
+                                     : 0.f,
+        reinterpret_cast<DenoiseState*>(rnnoise_arena_.get() +
+                                        ch * RnnoiseStateStride()),
+        rnnoise_model_->get(),
+        config.rnnoise_silence_gate_frames, config.rnnoise_silence_gate_dbfs);
+    rnnoise_states_[ch] = channels_[ch]->rnnoise_state;
+    rnnoise_input_frames_[ch] =
+        channels_[ch]->rnnoise_framer.input_frame().data();
+    rnnoise_output_frames_[ch] =
+        channels_[ch]->rnnoise_framer.output_frame().data();
+  }
+  if (rnnoise_linked_) {
+    // The reference state follows the channel states in the arena. Its output
+    // is not used, only its gains.
+    rnnoise_reference_state_ = reinterpret_cast<DenoiseState*>(
+        rnnoise_arena_.get() + num_channels_ * RnnoiseStateStride());
+    InitRnnoiseState(
+        rnnoise_reference_state_, rnnoise_model_->get(),
+        config.rnnoise_low_delay,
+        config.rnnoise_level_control ? suppression_params_.rnnoise_minimum_gain
+                                     : 0.f,
+        config.rnnoise_silence_gate_frames, config.rnnoise_silence_gate_dbfs,
+        suppression_params_.minimum_attenuating_gain,
+        /*analysis_only=*/true);
+  }
+
+  // The delays are expressed in samples at 48 kHz, where they are all
+  // integer. The filter bank delays the 16 kHz bands by the size of its
+  // analysis memory.
+  size_t delay_samples_48khz = 3 * (kFftSize - kNsFrameSize);
+  if (rnnoise_enabled_ && !rnnoise_hybrid_) {
+    const ChannelState& channel = *channels_[0];
+    const size_t rnnoise_delay = channel.rnnoise_framer.delay_samples() +
+                                 rnnoise_get_delay(channel.rnnoise_state);
+    delay_samples_48khz +=
+        rnnoise_full_band_ ? rnnoise_delay : 3 * rnnoise_delay;
+  }
+  RTC_DCHECK_EQ(delay_samples_48khz % 48, 0);
+  algorithmic_delay_ms_ = static_cast<int>(delay_samples_48khz / 48);
+}
+
+void NoiseSuppressor::ForEachChannelGroup(
+    rtc::FunctionView<void(NrFft& fft, size_t begin, size_t end)> process) {
+  if (num_channel_groups_ == 1) {
+    process(*ffts_[0], 0, num_channels_);
+    return;
+  }
+  // The channels are spread evenly over the groups.
+  RTC_DCHECK(thread_pool_);
+  thread_pool_->ParallelFor(static_cast<int>(num_channel_groups_),
+                            [&](int group) {
+                              const size_t g = static_cast<size_t>(group);
+                              process(*ffts_[g],
+                                      g * num_channels_ / num_channel_groups_,
+                                      (g + 1) * num_channels_ /
+                                          num_channel_groups_);
+                            });
+}
+
+void NoiseSuppressor::SetCaptureOutputUsage(bool capture_output_used) {
+  capture_output_used_ = capture_output_used;
+  // Unless its speech probability or pitch period is used, RNNoise only needs
+  // to run while the output is used.
+  const bool rnnoise_bypass = !capture_output_used && !rnnoise_analysis_used_;
+  for (DenoiseState* state : rnnoise_states_) {
+    rnnoise_set_analysis_only(state, rnnoise_hybrid_ || !capture_output_used);
+    rnnoise_set_bypass(state, rnnoise_bypass);
+  }
+  if (rnnoise_reference_state_) {
+    rnnoise_set_bypass(rnnoise_reference_state_, rnnoise_bypass);
   }
 }
 
+void NoiseSuppressor::SetRnnoiseModel(
+    std::shared_ptr<const RnnoiseModel> model) {
+  RTC_DCHECK(model);
+  for (size_t ch = 0; ch < num_channels_; ++ch) {
+    // Only fails if the recurrent state cannot be allocated.
+    RTC_CHECK_EQ(rnnoise_set_model(rnnoise_states_[ch], model->get()), 0);
+  }
+  if (rnnoise_reference_state_) {
+    RTC_CHECK_EQ(rnnoise_set_model(rnnoise_reference_state_, model->get()), 0);
+  }
+  rnnoise_model_ = std::move(model);
+}
+
+void NoiseSuppressor::SetRnnoiseStageCallback(rnnoise_stage_callback callback,
+                                              void* user_data) {
+  for (DenoiseState* state : rnnoise_states_) {
+    rnnoise_set_stage_callback(state, callback, user_data);
+  }
+  if (rnnoise_reference_state_) {
+    rnnoise_set_stage_callback(rnnoise_reference_state_, callback, user_data);
+  }
+}
+
+rtc::ArrayView<const float, kFftSizeBy2Plus1> NoiseSuppressor::ChannelFilter(
+    size_t ch) const {
+  if (rnnoise_hybrid_) {
+    return channels_[ch]->hybrid_filter;
+  }
+  return channels_[ch]->wiener_filter.get_filter();
+}
+
 void NoiseSuppressor::AggregateWienerFilters(
     rtc::ArrayView<float, kFftSizeBy2Plus1> filter) const {
-  rtc::ArrayView<const float, kFftSizeBy2Plus1> filter0 =
-      channels_[0]->wiener_filter.get_filter();
+  rtc::ArrayView<const float, kFftSizeBy2Plus1> filter0 = ChannelFilter(0);
   std::copy(filter0.begin(), filter0.end(), filter.begin());
 
   for (size_t ch = 1; ch < num_channels_; ++ch) {
-    rtc::ArrayView<const float, kFftSizeBy2Plus1> filter_ch =
-        channels_[ch]->wiener_filter.get_filter();
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> filter_ch = ChannelFilter(ch);
 
     for (size_t k = 0; k < kFftSizeBy2Plus1; ++k) {
       filter[k] = std::min(filter[k], filter_ch[k]);
@@ -327,109 +586,212 @@ void NoiseSuppressor::Analyze(const AudioBuffer& audio) {
   }
 
   // Analyze all channels.
-  for (size_t ch = 0; ch < num_channels_; ++ch) {
-    std::unique_ptr<ChannelState>& ch_p = channels_[ch];
-    rtc::ArrayView<const float, kNsFrameSize> y_band0(
-        &audio.split_bands_const(ch)[0][0], kNsFrameSize);
+  ForEachChannelGroup([&](NrFft& fft, size_t begin, size_t end) {
+    for (size_t ch = begin; ch < end; ++ch) {
+      std::unique_ptr<ChannelState>& ch_p = channels_[ch];
+      rtc::ArrayView<const float, kNsFrameSize> y_band0(
+          &audio.split_bands_const(ch)[0][0], kNsFrameSize);
+
+      // Form an extended frame and apply analysis filter bank windowing.
+      std::array<float, kFftSize> extended_frame;
+      FormExtendedFrame(y_band0, ch_p->analyze_analysis_memory, extended_frame);
+      ApplyFilterBankWindow(extended_frame);
+
+      // Compute the magnitude spectrum.
+      std::array<float, kFftSize> real;
+      std::array<float, kFftSize> imag;
+      fft.Fft(extended_frame, real, imag);
+
+      std::array<float, kFftSizeBy2Plus1> signal_spectrum;
+      ComputeMagnitudeSpectrum(real, imag, signal_spectrum);
+
+      // Compute energies.
+      float signal_energy = 0.f;
+      for (size_t i = 0; i < kFftSizeBy2Plus1; ++i) {
+        signal_energy += real[i] * real[i] + imag[i] * imag[i];
+      }
+      signal_energy /= kFftSizeBy2Plus1;
 
-    // Form an extended frame and apply analysis filter bank windowing.
-    std::array<float, kFftSize> extended_frame;
-    FormExtendedFrame(y_band0, ch_p->analyze_analysis_memory, extended_frame);
-    ApplyFilterBankWindow(extended_frame);
+      float signal_spectral_sum = 0.f;
+      for (size_t i = 0; i < kFftSizeBy2Plus1; ++i) {
+        signal_spectral_sum += signal_spectrum[i];
+      }
 
-    // Compute the magnitude spectrum.
-    std::array<float, kFftSize> real;
-    std::array<float, kFftSize> imag;
-    fft_.Fft(extended_frame, real, imag);
+      // Estimate the noise spectra and the probability estimates of speech
+      // presence.
+      ch_p->noise_estimator.PreUpdate(num_analyzed_frames_, signal_spectrum,
+                                      signal_spectral_sum);
+
+      std::array<float, kFftSizeBy2Plus1> post_snr;
+      std::array<float, kFftSizeBy2Plus1> prior_snr;
+      ComputeSnr(ch_p->wiener_filter.get_filter(),
+                 ch_p->prev_analysis_signal_spectrum, signal_spectrum,
+                 ch_p->noise_estimator.get_prev_noise_spectrum(),
+                 ch_p->noise_estimator.get_noise_spectrum(), prior_snr,
+                 post_snr);
+
+      ch_p->speech_probability_estimator.Update(
+          num_analyzed_frames_, prior_snr, post_snr,
+          ch_p->noise_estimator.get_conservative_noise_spectrum(),
+          signal_spectrum, signal_spectral_sum, signal_energy);
+
+      ch_p->noise_estimator.PostUpdate(
+          ch_p->speech_probability_estimator.get_probability(),
+          signal_spectrum);
+
+      // Store the magnitude spectrum to make it avalilable for the process
+      // method.
+      std::copy(signal_spectrum.begin(), signal_spectrum.end(),
+                ch_p->prev_analysis_signal_spectrum.begin());
+    }
+  });
+}
 
-    std::array<float, kFftSizeBy2Plus1> signal_spectrum;
-    ComputeMagnitudeSpectrum(real, imag, signal_spectrum);
+absl::optional<int> NoiseSuppressor::pitch_period_48kHz() const {
+  if (pitch_period_48kHz_ == 0) {
+    return absl::nullopt;
+  }
+  return pitch_period_48kHz_;
+}
 
-    // Compute energies.
-    float signal_energy = 0.f;
-    for (size_t i = 0; i < kFftSizeBy2Plus1; ++i) {
-      signal_energy += real[i] * real[i] + imag[i] * imag[i];
+void NoiseSuppressor::ProcessLinkedRnnoiseFrames() {
+  RTC_DCHECK(rnnoise_reference_state_);
+  // The reference state analyzes the downmix of all channels.
+  const float scale = 1.f / num_channels_;
+  for (size_t i = 0; i < kRnnoiseFrameSize; ++i) {
+    float sum = 0.f;
+    for (size_t ch = 0; ch < num_channels_; ++ch) {
+      sum += rnnoise_input_frames_[ch][i];
     }
-    signal_energy /= kFftSizeBy2Plus1;
-
-    float signal_spectral_sum = 0.f;
-    for (size_t i = 0; i < kFftSizeBy2Plus1; ++i) {
-      signal_spectral_sum += signal_spectrum[i];
+    rnnoise_downmix_[i] = sum * scale;
+  }
+  speech_probability_ =
+      rnnoise_process_frame(rnnoise_reference_state_,
+                            rnnoise_reference_output_.data(),
+                            rnnoise_downmix_.data());
+  pitch_period_48kHz_ = rnnoise_get_pitch_period(rnnoise_reference_state_) *
+                        (rnnoise_full_band_ ? 1 : 3);
+  // Only the reference gains are used in the hybrid mode.
+  if (rnnoise_hybrid_) {
+    return;
+  }
+  ForEachChannelGroup([&](NrFft& /*fft*/, size_t begin, size_t end) {
+    for (size_t ch = begin; ch < end; ++ch) {
+      rnnoise_process_frame_linked(rnnoise_states_[ch],
+                                   rnnoise_output_frames_[ch],
+                                   rnnoise_input_frames_[ch],
+                                   rnnoise_reference_state_);
     }
+  });
+}
 
-    // Estimate the noise spectra and the probability estimates of speech
-    // presence.
-    ch_p->noise_estimator.PreUpdate(num_analyzed_frames_, signal_spectrum,
-                                    signal_spectral_sum);
-
-    std::array<float, kFftSizeBy2Plus1> post_snr;
-    std::array<float, kFftSizeBy2Plus1> prior_snr;
-    ComputeSnr(ch_p->wiener_filter.get_filter(),
-               ch_p->prev_analysis_signal_spectrum, signal_spectrum,
-               ch_p->noise_estimator.get_prev_noise_spectrum(),
-               ch_p->noise_estimator.get_noise_spectrum(), prior_snr, post_snr);
-
-    ch_p->speech_probability_estimator.Update(
-        num_analyzed_frames_, prior_snr, post_snr,
-        ch_p->noise_estimator.get_conservative_noise_spectrum(),
-        signal_spectrum, signal_spectral_sum, signal_energy);
-
-    ch_p->noise_estimator.PostUpdate(
-        ch_p->speech_probability_estimator.get_probability(), signal_spectrum);
+void NoiseSuppressor::ProcessRnnoiseFrames() {
+  if (rnnoise_linked_) {
+    ProcessLinkedRnnoiseFrames();
+    return;
+  }
+  // The RNN of each group of channels is evaluated jointly.
+  ForEachChannelGroup([&](NrFft& /*fft*/, size_t begin, size_t end) {
+    rnnoise_process_frames(
+        &rnnoise_states_[begin], static_cast<int>(end - begin),
+        &rnnoise_output_frames_[begin], &rnnoise_input_frames_[begin],
+        &rnnoise_vad_probabilities_[begin]);
+  });
+  speech_probability_ = *std::max_element(rnnoise_vad_probabilities_.begin(),
+                                          rnnoise_vad_probabilities_.end());
+  // The lowest band is sampled at 16 kHz, the full band only at 48 kHz.
+  pitch_period_48kHz_ = rnnoise_get_pitch_period(rnnoise_states_[0]) *
+                        (rnnoise_full_band_ ? 1 : 3);
+}
 
-    // Store the magnitude spectrum to make it avalilable for the process
-    // method.
-    std::copy(signal_spectrum.begin(), signal_spectrum.end(),
-              ch_p->prev_analysis_signal_spectrum.begin());
+void NoiseSuppressor::ApplyRnnoise(AudioBuffer* audio) {
+  auto signal = [&](size_t ch) {
+    return rnnoise_full_band_
+               ? rtc::ArrayView<float>(audio->channels()[ch],
+                                       audio->num_frames())
+               : rtc::ArrayView<float>(&audio->split_bands(ch)[0][0],
+                                       kNsFrameSize);
+  };
+
+  // The framers of all channels are fed in lockstep and hence complete their
+  // frames at the same time, which allows the frames to be denoised jointly.
+  bool frame_complete = false;
+  for (size_t ch = 0; ch < num_channels_; ++ch) {
+    frame_complete = channels_[ch]->rnnoise_framer.Insert(signal(ch));
+  }
+  if (frame_complete) {
+    ProcessRnnoiseFrames();
+  }
+  for (size_t ch = 0; ch < num_channels_; ++ch) {
+    channels_[ch]->rnnoise_framer.Extract(signal(ch));
   }
 }
 
-void NoiseSuppressor::Process(AudioBuffer* audio) {
-  // Create RNNoise state
-  DenoiseState *st;
-  st = rnnoise_create(NULL);
+void NoiseSuppressor::AnalyzeRnnoise(const AudioBuffer& audio) {
+  bool frame_complete = false;
+  for (size_t ch = 0; ch < num_channels_; ++ch) {
+    frame_complete = channels_[ch]->rnnoise_framer.Insert(
+        rtc::ArrayView<const float>(&audio.split_bands_const(ch)[0][0],
+                                    kNsFrameSize));
+  }
+  if (!frame_complete) {
+    return;
+  }
 
-  // Process each channel in the audio buffer
+  // The output of the analysis-only mode is not used.
+  ProcessRnnoiseFrames();
+  // The RNNoise frame covers the lowest band of the last frames, up to half
+  // its sample rate like the Wiener filter. The gains are applied until the
+  // next RNNoise frame is complete, and are kept at 1 until RNNoise has
+  // analyzed a non-silent frame.
+  if (rnnoise_linked_) {
+    rnnoise_get_gains(rnnoise_reference_state_,
+                      channels_[0]->rnnoise_gains.data(),
+                      static_cast<int>(kFftSizeBy2Plus1));
+    for (size_t ch = 1; ch < num_channels_; ++ch) {
+      channels_[ch]->rnnoise_gains = channels_[0]->rnnoise_gains;
+    }
+    return;
+  }
   for (size_t ch = 0; ch < num_channels_; ++ch) {
-    // Create a temporary buffer to hold the current frame
-    float x[FRAME_SIZE];
-    float y[FRAME_SIZE];
-
-    size_t num_frames = audio->num_frames();
-
-    // Process each sliding window
-    for (size_t window_start = 0; window_start < num_frames * FRAME_SIZE;
-         window_start += SLIDING_WINDOW_SIZE) {
-      // size_t window_end = std::min(window_start + FRAME_SIZE, num_frames * FRAME_SIZE);
-      size_t frame_idx = window_start / FRAME_SIZE;
-
-      // Copy the current frame to the input buffer for RNNoise
-      for (size_t i = 0; i < FRAME_SIZE; ++i) {
-        size_t sample_idx = frame_idx * FRAME_SIZE + i;
-        if (sample_idx < num_frames * FRAME_SIZE) {
-          x[i] = audio->split_bands(ch)[0][sample_idx];
-        } else {
-          // Zero-pad if we reach the end of the audio buffer
-          x[i] = 0.0f;
-        }
-      }
+    rnnoise_get_gains(rnnoise_states_[ch], channels_[ch]->rnnoise_gains.data(),
+                      static_cast<int>(kFftSizeBy2Plus1));
+  }
+}
+
+void NoiseSuppressor::ProcessFullBand(AudioBuffer* audio) {
+  if (!rnnoise_full_band_) {
+    return;
+  }
 
-      // Process the frame with RNNoise
-      rnnoise_process_frame(st, x, y);
+  RTC_DCHECK_EQ(audio->num_frames(), num_bands_ * kNsFrameSize);
+  ApplyRnnoise(audio);
+}
 
-      // Copy the denoised frame back to the audio buffer
-      for (size_t i = 0; i < FRAME_SIZE; ++i) {
-        size_t sample_idx = frame_idx * FRAME_SIZE + i;
-        if (sample_idx < num_frames * FRAME_SIZE) {
-          audio->split_bands(ch)[0][sample_idx] = y[i];
-        }
+void NoiseSuppressor::Process(AudioBuffer* audio) {
+  // Denoise the lowest band using RNNoise, unless the full-band signal has
+  // already been denoised, the RNNoise gains are fused into the Wiener filter
+  // or RNNoise does not run.
+  if (rnnoise_hybrid_) {
+    AnalyzeRnnoise(*audio);
+  } else if (rnnoise_enabled_ && !rnnoise_full_band_) {
+    ApplyRnnoise(audio);
+
+    // Delay the upper bands to match the delay of the RNNoise processing.
+    for (size_t ch = 0; ch < num_channels_ && num_bands_ > 1; ++ch) {
+      ChannelState& channel = *channels_[ch];
+      for (size_t b = 1; b < num_bands_; ++b) {
+        rtc::ArrayView<float, kNsFrameSize> y_band(
+            &audio->split_bands(ch)[b][0], kNsFrameSize);
+        DelayBand(channel.rnnoise_delay_memory[b - 1],
+                  channel.rnnoise_delay_index, y_band);
       }
+      channel.rnnoise_delay_index =
+          (channel.rnnoise_delay_index + kNsFrameSize) %
+          channel.rnnoise_delay_memory[0].size();
     }
   }
 
-  // Clean up RNNoise state
-  rnnoise_destroy(st);
-
   // Select the space for storing data during the processing.
   std::array<FilterBankState, kMaxNumChannelsOnStack> filter_bank_states_stack;
   rtc::ArrayView<FilterBankState> filter_bank_states(
@@ -457,46 +819,59 @@ void NoiseSuppressor::Process(AudioBuffer* audio) {
   }
 
   // Compute the suppression filters for all channels.
-  for (size_t ch = 0; ch < num_channels_; ++ch) {
-    // Form an extended frame and apply analysis filter bank windowing.
-    rtc::ArrayView<float, kNsFrameSize> y_band0(&audio->split_bands(ch)[0][0],
-                                                kNsFrameSize);
-
-    FormExtendedFrame(y_band0, channels_[ch]->process_analysis_memory,
-                      filter_bank_states[ch].extended_frame);
-
-    ApplyFilterBankWindow(filter_bank_states[ch].extended_frame);
-
-    energies_before_filtering[ch] =
-        ComputeEnergyOfExtendedFrame(filter_bank_states[ch].extended_frame);
-
-    // Perform filter bank analysis and compute the magnitude spectrum.
-    fft_.Fft(filter_bank_states[ch].extended_frame, filter_bank_states[ch].real,
-             filter_bank_states[ch].imag);
-
-    std::array<float, kFftSizeBy2Plus1> signal_spectrum;
-    ComputeMagnitudeSpectrum(filter_bank_states[ch].real,
-                             filter_bank_states[ch].imag, signal_spectrum);
-
-    // Compute the frequency domain gain filter for noise attenuation.
-    channels_[ch]->wiener_filter.Update(
-        num_analyzed_frames_,
-        channels_[ch]->noise_estimator.get_noise_spectrum(),
-        channels_[ch]->noise_estimator.get_prev_noise_spectrum(),
-        channels_[ch]->noise_estimator.get_parametric_noise_spectrum(),
-        signal_spectrum);
-
-    if (num_bands_ > 1) {
-      // Compute the time-domain gain for attenuating the noise in the upper
-      // bands.
-
-      upper_band_gains[ch] = ComputeUpperBandsGain(
-          suppression_params_.minimum_attenuating_gain,
-          channels_[ch]->wiener_filter.get_filter(),
-          channels_[ch]->speech_probability_estimator.get_probability(),
-          channels_[ch]->prev_analysis_signal_spectrum, signal_spectrum);
+  ForEachChannelGroup([&](NrFft& fft, size_t begin, size_t end) {
+    for (size_t ch = begin; ch < end; ++ch) {
+      // Form an extended frame and apply analysis filter bank windowing.
+      rtc::ArrayView<float, kNsFrameSize> y_band0(
+          &audio->split_bands(ch)[0][0], kNsFrameSize);
+
+      FormExtendedFrame(y_band0, channels_[ch]->process_analysis_memory,
+                        filter_bank_states[ch].extended_frame);
+
+      ApplyFilterBankWindow(filter_bank_states[ch].extended_frame);
+
+      energies_before_filtering[ch] =
+          ComputeEnergyOfExtendedFrame(filter_bank_states[ch].extended_frame);
+
+      // Perform filter bank analysis and compute the magnitude spectrum.
+      fft.Fft(filter_bank_states[ch].extended_frame,
+              filter_bank_states[ch].real, filter_bank_states[ch].imag);
+
+      std::array<float, kFftSizeBy2Plus1> signal_spectrum;
+      ComputeMagnitudeSpectrum(filter_bank_states[ch].real,
+                               filter_bank_states[ch].imag, signal_spectrum);
+
+      // Compute the frequency domain gain filter for noise attenuation.
+      channels_[ch]->wiener_filter.Update(
+          num_analyzed_frames_,
+          channels_[ch]->noise_estimator.get_noise_spectrum(),
+          channels_[ch]->noise_estimator.get_prev_noise_spectrum(),
+          channels_[ch]->noise_estimator.get_parametric_noise_spectrum(),
+          signal_spectrum);
+
+      if (rnnoise_hybrid_) {
+        // Fuse the RNNoise gains into the Wiener filter.
+        ChannelState& channel = *channels_[ch];
+        rtc::ArrayView<const float, kFftSizeBy2Plus1> wiener_filter =
+            channel.wiener_filter.get_filter();
+        for (size_t i = 0; i < kFftSizeBy2Plus1; ++i) {
+          channel.hybrid_filter[i] =
+              wiener_filter[i] * channel.rnnoise_gains[i];
+        }
+      }
+
+      if (num_bands_ > 1 && !rnnoise_full_band_) {
+        // Compute the time-domain gain for attenuating the noise in the upper
+        // bands.
+
+        upper_band_gains[ch] = ComputeUpperBandsGain(
+            suppression_params_.minimum_attenuating_gain,
+            channels_[ch]->wiener_filter.get_filter(),
+            channels_[ch]->speech_probability_estimator.get_probability(),
+            channels_[ch]->prev_analysis_signal_spectrum, signal_spectrum);
+      }
     }
-  }
+  });
 
   // Only do the below processing if the output of the audio processing module
   // is used.
@@ -508,71 +883,72 @@ void NoiseSuppressor::Process(AudioBuffer* audio) {
   std::array<float, kFftSizeBy2Plus1> filter_data;
   rtc::ArrayView<const float, kFftSizeBy2Plus1> filter = filter_data;
   if (num_channels_ == 1) {
-    filter = channels_[0]->wiener_filter.get_filter();
+    filter = ChannelFilter(0);
   } else {
     AggregateWienerFilters(filter_data);
   }
 
-  for (size_t ch = 0; ch < num_channels_; ++ch) {
-    // Apply the filter to the lower band.
-    for (size_t i = 0; i < kFftSizeBy2Plus1; ++i) {
-      filter_bank_states[ch].real[i] *= filter[i];
-      filter_bank_states[ch].imag[i] *= filter[i];
-    }
-  }
+  ForEachChannelGroup([&](NrFft& fft, size_t begin, size_t end) {
+    for (size_t ch = begin; ch < end; ++ch) {
+      // Apply the filter to the lower band.
+      for (size_t i = 0; i < kFftSizeBy2Plus1; ++i) {
+        filter_bank_states[ch].real[i] *= filter[i];
+        filter_bank_states[ch].imag[i] *= filter[i];
+      }
 
-  // Perform filter bank synthesis
-  for (size_t ch = 0; ch < num_channels_; ++ch) {
-    fft_.Ifft(filter_bank_states[ch].real, filter_bank_states[ch].imag,
-              filter_bank_states[ch].extended_frame);
-  }
+      // Perform filter bank synthesis
+      fft.Ifft(filter_bank_states[ch].real, filter_bank_states[ch].imag,
+               filter_bank_states[ch].extended_frame);
 
-  for (size_t ch = 0; ch < num_channels_; ++ch) {
-    const float energy_after_filtering =
-        ComputeEnergyOfExtendedFrame(filter_bank_states[ch].extended_frame);
+      const float energy_after_filtering =
+          ComputeEnergyOfExtendedFrame(filter_bank_states[ch].extended_frame);
 
-    // Apply synthesis window.
-    ApplyFilterBankWindow(filter_bank_states[ch].extended_frame);
+      // Apply synthesis window.
+      ApplyFilterBankWindow(filter_bank_states[ch].extended_frame);
 
-    // Compute the adjustment of the noise attenuation filter based on the
-    // effect of the attenuation.
-    gain_adjustments[ch] =
-        channels_[ch]->wiener_filter.ComputeOverallScalingFactor(
-            num_analyzed_frames_,
-            channels_[ch]->speech_probability_estimator.get_prior_probability(),
-            energies_before_filtering[ch], energy_after_filtering);
-  }
+      // Compute the adjustment of the noise attenuation filter based on the
+      // effect of the attenuation.
+      gain_adjustments[ch] =
+          channels_[ch]->wiener_filter.ComputeOverallScalingFactor(
+              num_analyzed_frames_,
+              channels_[ch]
+                  ->speech_probability_estimator.get_prior_probability(),
+              energies_before_filtering[ch], energy_after_filtering);
+    }
+  });
 
-  // Select and apply adjustment of the noise attenuation filter based on the
-  // effect of the attenuation.
+  // Select the adjustment of the noise attenuation filter based on the effect
+  // of the attenuation.
   float gain_adjustment = gain_adjustments[0];
   for (size_t ch = 1; ch < num_channels_; ++ch) {
     gain_adjustment = std::min(gain_adjustment, gain_adjustments[ch]);
   }
-  for (size_t ch = 0; ch < num_channels_; ++ch) {
-    for (size_t i = 0; i < kFftSize; ++i) {
-      filter_bank_states[ch].extended_frame[i] =
-          gain_adjustment * filter_bank_states[ch].extended_frame[i];
-    }
-  }
 
-  // Use overlap-and-add to form the output frame of the lowest band.
-  for (size_t ch = 0; ch < num_channels_; ++ch) {
-    rtc::ArrayView<float, kNsFrameSize> y_band0(&audio->split_bands(ch)[0][0],
-                                                kNsFrameSize);
-    OverlapAndAdd(filter_bank_states[ch].extended_frame,
-                  channels_[ch]->process_synthesis_memory, y_band0);
-  }
-
-  if (num_bands_ > 1) {
-    // Select the noise attenuating gain to apply to the upper band.
-    float upper_band_gain = upper_band_gains[0];
+  // Select the noise attenuating gain to apply to the upper band. When RNNoise
+  // has denoised the full-band signal the upper bands are only delayed.
+  float upper_band_gain = 1.f;
+  if (num_bands_ > 1 && !rnnoise_full_band_) {
+    upper_band_gain = upper_band_gains[0];
     for (size_t ch = 1; ch < num_channels_; ++ch) {
       upper_band_gain = std::min(upper_band_gain, upper_band_gains[ch]);
     }
+  }
 
-    // Process the upper bands.
-    for (size_t ch = 0; ch < num_channels_; ++ch) {
+  ForEachChannelGroup([&](NrFft& /*fft*/, size_t begin, size_t end) {
+    for (size_t ch = begin; ch < end; ++ch) {
+      // Apply the adjustment of the noise attenuation filter.
+      for (size_t i = 0; i < kFftSize; ++i) {
+        filter_bank_states[ch].extended_frame[i] =
+            gain_adjustment * filter_bank_states[ch].extended_frame[i];
+      }
+
+      // Use overlap-and-add to form the output frame of the lowest band.
+      rtc::ArrayView<float, kNsFrameSize> y_band0(
+          &audio->split_bands(ch)[0][0], kNsFrameSize);
+      OverlapAndAdd(filter_bank_states[ch].extended_frame,
+                    channels_[ch]->process_synthesis_memory, y_band0);
+
+      // Process the upper bands.
       for (size_t b = 1; b < num_bands_; ++b) {
         // Delay the upper bands to match the delay of the filterbank applied to
         // the lowest band.
@@ -587,19 +963,17 @@ void NoiseSuppressor::Process(AudioBuffer* audio) {
           y_band[j] = upper_band_gain * delayed_frame[j];
         }
       }
-    }
-  }
 
-  // Limit the output the allowed range.
-  for (size_t ch = 0; ch < num_channels_; ++ch) {
-    for (size_t b = 0; b < num_bands_; ++b) {
-      rtc::ArrayView<float, kNsFrameSize> y_band(&audio->split_bands(ch)[b][0],
-                                                 kNsFrameSize);
-      for (size_t j = 0; j < kNsFrameSize; j++) {
-        y_band[j] = std::min(std::max(y_band[j], -32768.f), 32767.f);
+      // Limit the output the allowed range.
+      for (size_t b = 0; b < num_bands_; ++b) {
+        rtc::ArrayView<float, kNsFrameSize> y_band(
+            &audio->split_bands(ch)[b][0], kNsFrameSize);
+        for (size_t j = 0; j < kNsFrameSize; j++) {
+          y_band[j] = std::min(std::max(y_band[j], -32768.f), 32767.f);
+        }
       }
     }
-  }
+  });
 }
 
 }  // namespace webrtc
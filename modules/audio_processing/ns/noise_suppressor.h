@@ -11,17 +11,25 @@
 #ifndef MODULES_AUDIO_PROCESSING_NS_NOISE_SUPPRESSOR_H_
 #define MODULES_AUDIO_PROCESSING_NS_NOISE_SUPPRESSOR_H_
 
+#include <array>
 #include <memory>
 #include <vector>
 
+#include "absl/types/optional.h"
 #include "api/array_view.h"
+#include "api/function_view.h"
 #include "modules/audio_processing/audio_buffer.h"
+#include "modules/audio_processing/include/processing_thread_pool.h"
 #include "modules/audio_processing/ns/noise_estimator.h"
 #include "modules/audio_processing/ns/ns_common.h"
 #include "modules/audio_processing/ns/ns_config.h"
 #include "modules/audio_processing/ns/ns_fft.h"
+#include "modules/audio_processing/ns/rnnoise/include/rnnoise.h"
+#include "modules/audio_processing/ns/rnnoise_framer.h"
+#include "modules/audio_processing/ns/rnnoise_model.h"
 #include "modules/audio_processing/ns/speech_probability_estimator.h"
 #include "modules/audio_processing/ns/wiener_filter.h"
+#include "rtc_base/memory/aligned_malloc.h"
 
 namespace webrtc {
 
@@ -31,6 +39,14 @@ class NoiseSuppressor {
   NoiseSuppressor(const NsConfig& config,
                   size_t sample_rate_hz,
                   size_t num_channels);
+  // Fans the per-channel processing out to `thread_pool`, if not null, when
+  // there are enough channels to share between several tasks. The output is
+  // identical to the one without a thread pool. `thread_pool` must outlive
+  // the noise suppressor.
+  NoiseSuppressor(const NsConfig& config,
+                  size_t sample_rate_hz,
+                  size_t num_channels,
+                  ProcessingThreadPool* thread_pool);
   NoiseSuppressor(const NoiseSuppressor&) = delete;
   NoiseSuppressor& operator=(const NoiseSuppressor&) = delete;
 
@@ -38,27 +54,84 @@ class NoiseSuppressor {
   // any comfort noise signal).
   void Analyze(const AudioBuffer& audio);
 
+  // Applies RNNoise to the full-band signal. Only has an effect when RNNoise
+  // is configured to run on the full band, in which case it must be called
+  // before the signal is split into frequency bands.
+  void ProcessFullBand(AudioBuffer* audio);
+
   // Applies noise suppression.
   void Process(AudioBuffer* audio);
 
   // Specifies whether the capture output will be used. The purpose of this is
   // to allow the noise suppressor to deactivate some of the processing when the
   // resulting output is anyway not used, for instance when the endpoint is
-  // muted.
-  void SetCaptureOutputUsage(bool capture_output_used) {
-    capture_output_used_ = capture_output_used;
-  }
+  // muted. While the output is not used, RNNoise only analyzes the signal to
+  // keep its recurrent state current, such that the denoising resumes without
+  // converging again, or is bypassed entirely unless
+  // `NsConfig::rnnoise_analysis_used` is set.
+  void SetCaptureOutputUsage(bool capture_output_used);
+
+  // Returns the RNNoise speech probability of the last denoised frame, in the
+  // [0, 1] range. For multiple channels, the highest probability is returned.
+  float speech_probability() const { return speech_probability_; }
+
+  // Returns whether RNNoise runs, which is not the case at the lowest
+  // suppression level with the RNNoise level control.
+  bool rnnoise_enabled() const { return rnnoise_enabled_; }
+
+  // Returns the pitch period at 48 kHz which RNNoise estimated on the first
+  // channel for the last frame, so that other sub-modules analyzing the same
+  // signal need not search the pitch again. When RNNoise runs on the lowest
+  // band, the period is estimated at 16 kHz and is hence a multiple of 3.
+  // Returns nullopt before the first RNNoise frame.
+  absl::optional<int> pitch_period_48kHz() const;
+
+  // Switches RNNoise to `model` from the next frame on. The recurrent state
+  // of the network is reset.
+  void SetRnnoiseModel(std::shared_ptr<const RnnoiseModel> model);
+
+  // Sets the callback reporting the stages of the RNNoise processing of all
+  // channels, e.g. to profile them. See rnnoise_set_stage_callback(). With a
+  // thread pool, the callback is called concurrently for different channels.
+  void SetRnnoiseStageCallback(rnnoise_stage_callback callback,
+                               void* user_data);
+
+  // Returns the algorithmic delay added to the signal by the noise
+  // suppression, including the RNNoise framing and synthesis.
+  int algorithmic_delay_ms() const { return algorithmic_delay_ms_; }
 
  private:
   const size_t num_bands_;
   const size_t num_channels_;
   const SuppressionParams suppression_params_;
+  const bool rnnoise_enabled_;
+  const bool rnnoise_full_band_;
+  const bool rnnoise_hybrid_;
+  const bool rnnoise_linked_;
+  const bool rnnoise_analysis_used_;
+  // Model used by the RNNoise states of all channels.
+  std::shared_ptr<const RnnoiseModel> rnnoise_model_;
   int32_t num_analyzed_frames_ = -1;
-  NrFft fft_;
+  ProcessingThreadPool* const thread_pool_;
+  const size_t num_channel_groups_;
+  // One FFT per channel group, since the FFT updates its work tables and can
+  // hence not be shared by concurrent tasks.
+  std::vector<std::unique_ptr<NrFft>> ffts_;
   bool capture_output_used_ = true;
+  int algorithmic_delay_ms_ = 0;
 
   struct ChannelState {
-    ChannelState(const SuppressionParams& suppression_params, size_t num_bands);
+    ChannelState(const SuppressionParams& suppression_params,
+                 size_t num_bands,
+                 bool rnnoise_full_band,
+                 bool rnnoise_hybrid,
+                 bool rnnoise_low_delay,
+                 bool rnnoise_delays_upper_bands,
+                 float rnnoise_gain_floor,
+                 DenoiseState* rnnoise_state,
+                 RNNModel* rnnoise_model,
+                 int rnnoise_silence_gate_frames,
+                 float rnnoise_silence_gate_dbfs);
 
     SpeechProbabilityEstimator speech_probability_estimator;
     WienerFilter wiener_filter;
@@ -68,6 +141,19 @@ class NoiseSuppressor {
     std::array<float, kOverlapSize> process_analysis_memory;
     std::array<float, kOverlapSize> process_synthesis_memory;
     std::vector<std::array<float, kOverlapSize>> process_delay_memory;
+    // Buffers the lowest band into RNNoise frames.
+    RnnoiseFramer rnnoise_framer;
+    // Delay lines aligning the upper bands with the RNNoise output.
+    std::vector<std::vector<float>> rnnoise_delay_memory;
+    size_t rnnoise_delay_index = 0;
+    // In the hybrid mode, the gains of the last RNNoise frame on the grid of
+    // the Wiener filter, and their product with the Wiener filter.
+    std::array<float, kFftSizeBy2Plus1> rnnoise_gains;
+    std::array<float, kFftSizeBy2Plus1> hybrid_filter;
+    // RNNoise state, in the arena of the noise suppressor, so that the
+    // recurrent state is kept across calls and no allocations are done in the
+    // audio processing loop.
+    DenoiseState* const rnnoise_state;
   };
 
   struct FilterBankState {
@@ -80,9 +166,51 @@ class NoiseSuppressor {
   std::vector<float> upper_band_gains_heap_;
   std::vector<float> energies_before_filtering_heap_;
   std::vector<float> gain_adjustments_heap_;
+  // Cache-line-aligned block holding the RNNoise states of all channels,
+  // including their recurrent states, one after the other.
+  std::unique_ptr<char, AlignedFreeDeleter> rnnoise_arena_;
   std::vector<std::unique_ptr<ChannelState>> channels_;
-
-  // Aggregates the Wiener filters into a single filter to use.
+  // Per-channel RNNoise states and frames, arranged for joint processing.
+  std::vector<DenoiseState*> rnnoise_states_;
+  std::vector<const float*> rnnoise_input_frames_;
+  std::vector<float*> rnnoise_output_frames_;
+  std::vector<float> rnnoise_vad_probabilities_;
+  // With linked channels, the state analyzing the downmix of all channels,
+  // whose gains are applied to every channel, and its frames.
+  DenoiseState* rnnoise_reference_state_ = nullptr;
+  std::array<float, kRnnoiseFrameSize> rnnoise_downmix_;
+  std::array<float, kRnnoiseFrameSize> rnnoise_reference_output_;
+  float speech_probability_ = 0.f;
+  int pitch_period_48kHz_ = 0;
+
+  // Calls `process` for consecutive groups of channels, given as the range
+  // [`begin`, `end`), with the FFT to use for the group. The groups run
+  // concurrently on the thread pool if there are several, and have all been
+  // processed when the call returns.
+  void ForEachChannelGroup(
+      rtc::FunctionView<void(NrFft& fft, size_t begin, size_t end)> process);
+
+  // Denoises all channels using RNNoise, either on the full-band signal or on
+  // the lowest band.
+  void ApplyRnnoise(AudioBuffer* audio);
+
+  // Jointly runs RNNoise on the completed frames of all channels and updates
+  // the speech probability and the pitch period.
+  void ProcessRnnoiseFrames();
+
+  // Runs RNNoise on the downmix of the completed frames and applies its gains
+  // to all channels, unless in the hybrid mode.
+  void ProcessLinkedRnnoiseFrames();
+
+  // Analyzes the lowest band of all channels using RNNoise and updates the
+  // RNNoise gains of the hybrid mode.
+  void AnalyzeRnnoise(const AudioBuffer& audio);
+
+  // Returns the suppression filter computed for a channel: the Wiener filter,
+  // fused with the RNNoise gains in the hybrid mode.
+  rtc::ArrayView<const float, kFftSizeBy2Plus1> ChannelFilter(size_t ch) const;
+
+  // Aggregates the filters of all channels into a single filter to use.
   void AggregateWienerFilters(
       rtc::ArrayView<float, kFftSizeBy2Plus1> filter) const;
 };
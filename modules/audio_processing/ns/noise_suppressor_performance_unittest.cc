@@ -0,0 +1,143 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <math.h>
+#include <stdint.h>
+
+#include <array>
+#include <string>
+
+#include "absl/strings/string_view.h"
+#include "api/test/metrics/global_metrics_logger_and_exporter.h"
+#include "api/test/metrics/metric.h"
+#include "modules/audio_processing/audio_buffer.h"
+#include "modules/audio_processing/ns/noise_suppressor.h"
+#include "modules/audio_processing/ns/ns_config.h"
+#include "modules/audio_processing/ns/rnnoise/include/rnnoise.h"
+#include "rtc_base/random.h"
+#include "rtc_base/strings/string_builder.h"
+#include "rtc_base/time_utils.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+using ::webrtc::test::GetGlobalMetricsLogger;
+using ::webrtc::test::ImprovementDirection;
+using ::webrtc::test::Unit;
+
+constexpr int kNumWarmupFrames = 100;
+constexpr int kNumMeasuredFrames = 1000;
+
+// Names of the RNNoise stages, indexed by the RNNOISE_STAGE_* values.
+constexpr std::array<absl::string_view, RNNOISE_NUM_STAGES>
+    kRnnoiseStageNames = {"biquad",   "fft", "pitch",
+                          "features", "rnn", "synthesis"};
+
+// Accumulates the durations of the RNNoise stages reported by the stage
+// callback.
+class RnnoiseStageTimer {
+ public:
+  static void OnStage(void* user_data, int stage, int end) {
+    RnnoiseStageTimer* timer = static_cast<RnnoiseStageTimer*>(user_data);
+    const int64_t now_ns = rtc::TimeNanos();
+    if (end) {
+      timer->total_ns_[stage] += now_ns - timer->begin_ns_[stage];
+    } else {
+      timer->begin_ns_[stage] = now_ns;
+    }
+  }
+
+  void Reset() { total_ns_.fill(0); }
+  int64_t total_ns(int stage) const { return total_ns_[stage]; }
+
+ private:
+  std::array<int64_t, RNNOISE_NUM_STAGES> begin_ns_ = {};
+  std::array<int64_t, RNNOISE_NUM_STAGES> total_ns_ = {};
+};
+
+// Fills the bands of all channels with a harmonic signal in white noise.
+void PopulateInputFrame(size_t num_bands,
+                        int frame_index,
+                        Random& random_generator,
+                        AudioBuffer& audio) {
+  for (size_t ch = 0; ch < audio.num_channels(); ++ch) {
+    for (size_t b = 0; b < num_bands; ++b) {
+      for (size_t i = 0; i < kNsFrameSize; ++i) {
+        const float t = static_cast<float>(frame_index * kNsFrameSize + i);
+        audio.split_bands(ch)[b][i] =
+            (b == 0 ? 3000.f * sinf(0.08f * t) + 1000.f * sinf(0.24f * t)
+                    : 0.f) +
+            static_cast<float>(random_generator.Gaussian(0.0, 300.0));
+      }
+    }
+  }
+}
+
+void LogDuration(absl::string_view stage,
+                 absl::string_view test_case,
+                 int64_t total_ns) {
+  GetGlobalMetricsLogger()->LogSingleValueMetric(
+      "ns_" + std::string(stage) + "_ns_per_frame", test_case,
+      static_cast<double>(total_ns) / kNumMeasuredFrames, Unit::kUnitless,
+      ImprovementDirection::kSmallerIsBetter);
+}
+
+}  // namespace
+
+// Measures the time in nanoseconds per 10 ms frame spent in the analysis and
+// the processing of the noise suppressor, and in the stages of RNNoise.
+TEST(NoiseSuppressorPerformanceTest, StageDurations) {
+  for (int sample_rate_hz : {16000, 32000, 48000}) {
+    for (size_t num_channels : {1, 2, 8}) {
+      rtc::StringBuilder test_case;
+      test_case << sample_rate_hz << "Hz_" << num_channels << "ch";
+      SCOPED_TRACE(test_case.str());
+      const size_t num_bands = sample_rate_hz / 16000;
+      AudioBuffer audio(sample_rate_hz, num_channels, sample_rate_hz,
+                        num_channels, sample_rate_hz, num_channels);
+      NoiseSuppressor ns(NsConfig(), sample_rate_hz, num_channels);
+      RnnoiseStageTimer stage_timer;
+      ns.SetRnnoiseStageCallback(&RnnoiseStageTimer::OnStage, &stage_timer);
+      Random random_generator(42U);
+
+      int64_t analyze_ns = 0;
+      int64_t process_ns = 0;
+      for (int frame_index = 0;
+           frame_index < kNumWarmupFrames + kNumMeasuredFrames;
+           ++frame_index) {
+        if (frame_index == kNumWarmupFrames) {
+          analyze_ns = 0;
+          process_ns = 0;
+          stage_timer.Reset();
+        }
+        PopulateInputFrame(num_bands, frame_index, random_generator, audio);
+        const int64_t start_ns = rtc::TimeNanos();
+        ns.Analyze(audio);
+        const int64_t analyzed_ns = rtc::TimeNanos();
+        ns.Process(&audio);
+        const int64_t processed_ns = rtc::TimeNanos();
+        analyze_ns += analyzed_ns - start_ns;
+        process_ns += processed_ns - analyzed_ns;
+      }
+
+      LogDuration("analyze", test_case.str(), analyze_ns);
+      LogDuration("process", test_case.str(), process_ns);
+      for (int stage = 0; stage < RNNOISE_NUM_STAGES; ++stage) {
+        LogDuration("rnnoise_" + std::string(kRnnoiseStageNames[stage]),
+                    test_case.str(), stage_timer.total_ns(stage));
+      }
+      // The processing includes the RNNoise stages.
+      EXPECT_GT(process_ns, stage_timer.total_ns(RNNOISE_STAGE_RNN));
+    }
+  }
+}
+
+}  // namespace webrtc
@@ -10,12 +10,16 @@
 
 #include "modules/audio_processing/ns/noise_suppressor.h"
 
+#include <cmath>
 #include <deque>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "api/function_view.h"
+#include "modules/audio_processing/include/processing_thread_pool.h"
+#include "rtc_base/platform_thread.h"
 #include "rtc_base/strings/string_builder.h"
 #include "test/gmock.h"
 #include "test/gtest.h"
@@ -61,6 +65,25 @@ void VerifyIdenticalChannels(size_t num_channels,
   }
 }
 
+// Thread pool running each task on a thread of its own.
+class SpawningThreadPool : public ProcessingThreadPool {
+ public:
+  void ParallelFor(int num_tasks, rtc::FunctionView<void(int)> task) override {
+    ++num_calls_;
+    std::vector<rtc::PlatformThread> threads;
+    for (int i = 0; i < num_tasks; ++i) {
+      threads.push_back(rtc::PlatformThread::SpawnJoinable(
+          [&task, i] { task(i); }, "ns_task"));
+    }
+    // The threads are joined when destroyed.
+  }
+
+  int num_calls() const { return num_calls_; }
+
+ private:
+  int num_calls_ = 0;
+};
+
 }  // namespace
 
 // Verifies that the same noise reduction effect is applied to all channels.
@@ -99,4 +122,351 @@ TEST(NoiseSuppressor, IdenticalChannelEffects) {
   }
 }
 
+// Verifies that the same noise reduction effect is applied to all channels when
+// RNNoise runs on the full-band signal.
+TEST(NoiseSuppressor, IdenticalChannelEffectsWithFullBandRnnoise) {
+  constexpr int kSampleRateHz = 48000;
+  constexpr size_t kNumBands = 3;
+  for (auto num_channels : {1, 4}) {
+    SCOPED_TRACE(ProduceDebugText(kSampleRateHz, num_channels,
+                                  NsConfig::SuppressionLevel::k12dB));
+    AudioBuffer audio(kSampleRateHz, num_channels, kSampleRateHz, num_channels,
+                      kSampleRateHz, num_channels);
+    NsConfig cfg;
+    cfg.rnnoise_full_band = true;
+    NoiseSuppressor ns(cfg, kSampleRateHz, num_channels);
+    for (size_t frame_index = 0; frame_index < 200; ++frame_index) {
+      for (size_t ch = 0; ch < audio.num_channels(); ++ch) {
+        for (size_t i = 0; i < audio.num_frames(); ++i) {
+          audio.channels()[ch][i] =
+              1000.f * std::sin(0.01f * (frame_index * audio.num_frames() + i));
+        }
+      }
+
+      ns.ProcessFullBand(&audio);
+      audio.SplitIntoFrequencyBands();
+      ns.Analyze(audio);
+      ns.Process(&audio);
+      if (num_channels > 1) {
+        VerifyIdenticalChannels(num_channels, kNumBands, frame_index, audio);
+      }
+    }
+  }
+}
+
+// Verifies that the same noise reduction effect is applied to all channels when
+// the RNNoise gains are fused into the Wiener filter.
+TEST(NoiseSuppressor, IdenticalChannelEffectsInHybridMode) {
+  for (auto rate : {16000, 32000, 48000}) {
+    for (auto num_channels : {1, 4}) {
+      SCOPED_TRACE(ProduceDebugText(rate, num_channels,
+                                    NsConfig::SuppressionLevel::k12dB));
+      const size_t num_bands = rate / 16000;
+      AudioBuffer audio(rate, num_channels, rate, num_channels, rate,
+                        num_channels);
+      NsConfig cfg;
+      cfg.rnnoise_hybrid = true;
+      NoiseSuppressor ns(cfg, rate, num_channels);
+      for (size_t frame_index = 0; frame_index < 200; ++frame_index) {
+        PopulateInputFrameWithIdenticalChannels(num_channels, num_bands,
+                                                frame_index, &audio);
+        ns.Analyze(audio);
+        ns.Process(&audio);
+        if (num_channels > 1) {
+          VerifyIdenticalChannels(num_channels, num_bands, frame_index, audio);
+        }
+      }
+    }
+  }
+}
+
+// Verifies that the hybrid mode only has the delay of the Wiener filter bank,
+// by checking when the onset of a tone after digital silence is output. The
+// filtering leaks a small pre-echo ahead of the onset.
+TEST(NoiseSuppressor, HybridModeAddsNoRnnoiseDelay) {
+  constexpr int kSampleRateHz = 16000;
+  constexpr size_t kOnsetFrame = 50;
+  for (bool hybrid : {false, true}) {
+    SCOPED_TRACE(hybrid ? "Hybrid" : "Cascade");
+    AudioBuffer audio(kSampleRateHz, 1, kSampleRateHz, 1, kSampleRateHz, 1);
+    NsConfig cfg;
+    cfg.rnnoise_hybrid = hybrid;
+    NoiseSuppressor ns(cfg, kSampleRateHz, 1);
+    bool onset_output = false;
+    for (size_t frame_index = 0; frame_index <= kOnsetFrame + 1;
+         ++frame_index) {
+      for (size_t i = 0; i < 160; ++i) {
+        audio.split_bands(0)[0][i] =
+            frame_index < kOnsetFrame
+                ? 0.f
+                : 3000.f * std::sin(0.3f * (frame_index * 160 + i));
+      }
+      ns.Analyze(audio);
+      ns.Process(&audio);
+      for (size_t i = 0; i < 160; ++i) {
+        onset_output =
+            onset_output || std::fabs(audio.split_bands(0)[0][i]) > 100.f;
+      }
+    }
+    // The Wiener filter bank delays the signal by 96 samples and RNNoise by
+    // another 320 samples.
+    EXPECT_EQ(onset_output, hybrid);
+  }
+}
+
+// Verifies the algorithmic delay reported for the RNNoise configurations: the
+// filter bank adds 6 ms, RNNoise on the lowest band 20 ms of framing and 30 ms,
+// or 15 ms with the low-delay synthesis, and RNNoise on the full band 10 ms, or
+// 5 ms.
+TEST(NoiseSuppressor, ReportsAlgorithmicDelay) {
+  struct TestCase {
+    int sample_rate_hz;
+    bool full_band;
+    bool hybrid;
+    bool low_delay;
+    int expected_delay_ms;
+  };
+  for (const TestCase& test_case : std::vector<TestCase>{
+           {16000, false, false, false, 56},
+           {16000, false, false, true, 41},
+           {16000, false, true, false, 6},
+           {48000, false, false, false, 56},
+           {48000, true, false, false, 16},
+           {48000, true, false, true, 11},
+           {48000, true, true, false, 6},
+       }) {
+    NsConfig cfg;
+    cfg.rnnoise_full_band = test_case.full_band;
+    cfg.rnnoise_hybrid = test_case.hybrid;
+    cfg.rnnoise_low_delay = test_case.low_delay;
+    NoiseSuppressor ns(cfg, test_case.sample_rate_hz, /*num_channels=*/1);
+    EXPECT_EQ(ns.algorithmic_delay_ms(), test_case.expected_delay_ms);
+  }
+}
+
+// Verifies that with the RNNoise level control, RNNoise is not run at the
+// lowest level, and that it attenuates the noise less at lower levels.
+TEST(NoiseSuppressor, RnnoiseLevelControl) {
+  constexpr int kSampleRateHz = 16000;
+  float previous_energy = 0.f;
+  for (auto level :
+       {NsConfig::SuppressionLevel::k21dB, NsConfig::SuppressionLevel::k12dB,
+        NsConfig::SuppressionLevel::k6dB}) {
+    SCOPED_TRACE(static_cast<int>(level));
+    NsConfig cfg;
+    cfg.target_level = level;
+    cfg.rnnoise_level_control = true;
+    NoiseSuppressor ns(cfg, kSampleRateHz, /*num_channels=*/1);
+    const bool rnnoise_expected = level != NsConfig::SuppressionLevel::k6dB;
+    EXPECT_EQ(ns.rnnoise_enabled(), rnnoise_expected);
+    // Only the filter bank delays the signal when RNNoise does not run.
+    EXPECT_EQ(ns.algorithmic_delay_ms() == 6, !rnnoise_expected);
+
+    AudioBuffer audio(kSampleRateHz, 1, kSampleRateHz, 1, kSampleRateHz, 1);
+    unsigned int seed = 1u;
+    float energy = 0.f;
+    for (size_t frame_index = 0; frame_index < 300; ++frame_index) {
+      for (size_t i = 0; i < 160; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        audio.split_bands(0)[0][i] =
+            1000.f * (((seed >> 16) & 0x7fff) / 32768.f - 0.5f);
+      }
+      ns.Analyze(audio);
+      ns.Process(&audio);
+      for (size_t i = 0; i < 160 && frame_index >= 200; ++i) {
+        energy += audio.split_bands(0)[0][i] * audio.split_bands(0)[0][i];
+      }
+    }
+    EXPECT_EQ(ns.speech_probability() > 0.f, rnnoise_expected);
+    EXPECT_GT(energy, previous_energy);
+    previous_energy = energy;
+  }
+}
+
+// Verifies that the lite tier falls back to the full model when no lite model
+// can be loaded, in which case the output matches the one of the full tier.
+TEST(NoiseSuppressor, LiteRnnoiseTierFallsBackToFullModel) {
+  constexpr int kSampleRateHz = 16000;
+  NsConfig full_cfg;
+  for (const char* lite_model_path : {"", "/nonexistent/lite_model.bin"}) {
+    SCOPED_TRACE(lite_model_path);
+    for (auto tier : {NsConfig::RnnoiseTier::kLite,
+                      NsConfig::RnnoiseTier::kAuto}) {
+      NsConfig lite_cfg;
+      lite_cfg.rnnoise_tier = tier;
+      lite_cfg.rnnoise_lite_model_path = lite_model_path;
+      NoiseSuppressor reference_ns(full_cfg, kSampleRateHz, 1);
+      NoiseSuppressor lite_ns(lite_cfg, kSampleRateHz, 1);
+      AudioBuffer reference_audio(kSampleRateHz, 1, kSampleRateHz, 1,
+                                  kSampleRateHz, 1);
+      AudioBuffer lite_audio(kSampleRateHz, 1, kSampleRateHz, 1,
+                             kSampleRateHz, 1);
+      for (size_t frame_index = 0; frame_index < 100; ++frame_index) {
+        PopulateInputFrameWithIdenticalChannels(1, 1, frame_index,
+                                                &reference_audio);
+        PopulateInputFrameWithIdenticalChannels(1, 1, frame_index,
+                                                &lite_audio);
+        reference_ns.Analyze(reference_audio);
+        reference_ns.Process(&reference_audio);
+        lite_ns.Analyze(lite_audio);
+        lite_ns.Process(&lite_audio);
+        for (size_t i = 0; i < 160; ++i) {
+          ASSERT_EQ(reference_audio.split_bands_const(0)[0][i],
+                    lite_audio.split_bands_const(0)[0][i]);
+        }
+      }
+    }
+  }
+}
+
+// Verifies that the upper bands stay aligned with the lowest band when RNNoise
+// uses the low-delay synthesis.
+TEST(NoiseSuppressor, IdenticalChannelEffectsWithLowDelayRnnoise) {
+  constexpr int kSampleRateHz = 48000;
+  constexpr size_t kNumBands = 3;
+  constexpr size_t kNumChannels = 2;
+  AudioBuffer audio(kSampleRateHz, kNumChannels, kSampleRateHz, kNumChannels,
+                    kSampleRateHz, kNumChannels);
+  NsConfig cfg;
+  cfg.rnnoise_low_delay = true;
+  NoiseSuppressor ns(cfg, kSampleRateHz, kNumChannels);
+  for (size_t frame_index = 0; frame_index < 100; ++frame_index) {
+    PopulateInputFrameWithIdenticalChannels(kNumChannels, kNumBands,
+                                            frame_index, &audio);
+    ns.Analyze(audio);
+    ns.Process(&audio);
+    VerifyIdenticalChannels(kNumChannels, kNumBands, frame_index, audio);
+  }
+}
+
+// Verifies that the speech probability is a probability and that it does not
+// depend on the number of identical channels.
+TEST(NoiseSuppressor, SpeechProbabilityIsIndependentOfIdenticalChannels) {
+  constexpr int kSampleRateHz = 16000;
+  AudioBuffer mono_audio(kSampleRateHz, 1, kSampleRateHz, 1, kSampleRateHz, 1);
+  AudioBuffer stereo_audio(kSampleRateHz, 2, kSampleRateHz, 2, kSampleRateHz,
+                           2);
+  NsConfig cfg;
+  NoiseSuppressor mono_ns(cfg, kSampleRateHz, 1);
+  NoiseSuppressor stereo_ns(cfg, kSampleRateHz, 2);
+  EXPECT_EQ(mono_ns.speech_probability(), 0.f);
+  for (size_t frame_index = 0; frame_index < 300; ++frame_index) {
+    PopulateInputFrameWithIdenticalChannels(1, 1, frame_index, &mono_audio);
+    PopulateInputFrameWithIdenticalChannels(2, 1, frame_index, &stereo_audio);
+    mono_ns.Analyze(mono_audio);
+    mono_ns.Process(&mono_audio);
+    stereo_ns.Analyze(stereo_audio);
+    stereo_ns.Process(&stereo_audio);
+    ASSERT_GE(mono_ns.speech_probability(), 0.f);
+    ASSERT_LE(mono_ns.speech_probability(), 1.f);
+    ASSERT_EQ(mono_ns.speech_probability(), stereo_ns.speech_probability());
+  }
+}
+
+// Verifies that linked channels get the same effect, and that the gains are
+// computed on the downmix, which for identical channels is the mono signal.
+TEST(NoiseSuppressor, LinkedChannelsMatchMonoSpeechProbability) {
+  constexpr int kSampleRateHz = 16000;
+  for (bool hybrid : {false, true}) {
+    SCOPED_TRACE(hybrid);
+    AudioBuffer mono_audio(kSampleRateHz, 1, kSampleRateHz, 1, kSampleRateHz,
+                           1);
+    AudioBuffer stereo_audio(kSampleRateHz, 2, kSampleRateHz, 2,
+                             kSampleRateHz, 2);
+    NsConfig cfg;
+    cfg.rnnoise_hybrid = hybrid;
+    NoiseSuppressor mono_ns(cfg, kSampleRateHz, 1);
+    cfg.rnnoise_linked_channels = true;
+    NoiseSuppressor stereo_ns(cfg, kSampleRateHz, 2);
+    EXPECT_EQ(mono_ns.algorithmic_delay_ms(), stereo_ns.algorithmic_delay_ms());
+    for (size_t frame_index = 0; frame_index < 300; ++frame_index) {
+      PopulateInputFrameWithIdenticalChannels(1, 1, frame_index, &mono_audio);
+      PopulateInputFrameWithIdenticalChannels(2, 1, frame_index,
+                                              &stereo_audio);
+      mono_ns.Analyze(mono_audio);
+      mono_ns.Process(&mono_audio);
+      stereo_ns.Analyze(stereo_audio);
+      stereo_ns.Process(&stereo_audio);
+      ASSERT_EQ(mono_ns.speech_probability(), stereo_ns.speech_probability());
+      VerifyIdenticalChannels(2, 1, frame_index, stereo_audio);
+    }
+  }
+}
+
+// Verifies that the pitch period estimated by RNNoise on the lowest band is
+// reported at 48 kHz, for a harmonic signal with a 200 Hz fundamental.
+TEST(NoiseSuppressor, ReportsRnnoisePitchPeriodAt48kHz) {
+  constexpr int kSampleRateHz = 16000;
+  constexpr float kPitchHz = 200.f;
+  AudioBuffer audio(kSampleRateHz, 1, kSampleRateHz, 1, kSampleRateHz, 1);
+  NsConfig cfg;
+  NoiseSuppressor ns(cfg, kSampleRateHz, 1);
+  EXPECT_FALSE(ns.pitch_period_48kHz().has_value());
+  for (size_t frame_index = 0; frame_index < 100; ++frame_index) {
+    for (size_t i = 0; i < 160; ++i) {
+      const float t =
+          (frame_index * 160 + i) / static_cast<float>(kSampleRateHz);
+      float value = 0.f;
+      for (int harmonic = 1; harmonic <= 5; ++harmonic) {
+        value += 1000.f * std::sin(2.f * M_PI * harmonic * kPitchHz * t);
+      }
+      audio.split_bands(0)[0][i] = value;
+    }
+    ns.Analyze(audio);
+    ns.Process(&audio);
+  }
+  ASSERT_TRUE(ns.pitch_period_48kHz().has_value());
+  EXPECT_EQ(*ns.pitch_period_48kHz(), 48000 / kPitchHz);
+}
+
+// Verifies that fanning the channels out to a thread pool does not change the
+// output, also for channels with different signals.
+TEST(NoiseSuppressor, ThreadPoolIsBitExact) {
+  constexpr size_t kNumChannels = 7;
+  for (int rate : {16000, 48000}) {
+    for (bool hybrid : {false, true}) {
+      SCOPED_TRACE(ProduceDebugText(rate, kNumChannels,
+                                    NsConfig::SuppressionLevel::k12dB));
+      const size_t num_bands = rate / 16000;
+      AudioBuffer audio(rate, kNumChannels, rate, kNumChannels, rate,
+                        kNumChannels);
+      AudioBuffer pooled_audio(rate, kNumChannels, rate, kNumChannels, rate,
+                               kNumChannels);
+      NsConfig cfg;
+      cfg.rnnoise_hybrid = hybrid;
+      SpawningThreadPool thread_pool;
+      NoiseSuppressor ns(cfg, rate, kNumChannels);
+      NoiseSuppressor pooled_ns(cfg, rate, kNumChannels, &thread_pool);
+      for (size_t frame_index = 0; frame_index < 100; ++frame_index) {
+        for (size_t ch = 0; ch < kNumChannels; ++ch) {
+          for (size_t b = 0; b < num_bands; ++b) {
+            for (size_t i = 0; i < 160; ++i) {
+              const float value =
+                  1000.f * (ch + 1) *
+                  std::sin(0.01f * (ch + 1) * (frame_index * 160 + i)) +
+                  500.f * b;
+              audio.split_bands(ch)[b][i] = value;
+              pooled_audio.split_bands(ch)[b][i] = value;
+            }
+          }
+        }
+        ns.Analyze(audio);
+        ns.Process(&audio);
+        pooled_ns.Analyze(pooled_audio);
+        pooled_ns.Process(&pooled_audio);
+        for (size_t ch = 0; ch < kNumChannels; ++ch) {
+          for (size_t b = 0; b < num_bands; ++b) {
+            for (size_t i = 0; i < 160; ++i) {
+              ASSERT_EQ(pooled_audio.split_bands_const(ch)[b][i],
+                        audio.split_bands_const(ch)[b][i]);
+            }
+          }
+        }
+        ASSERT_EQ(pooled_ns.speech_probability(), ns.speech_probability());
+      }
+      EXPECT_GT(thread_pool.num_calls(), 0);
+    }
+  }
+}
+
 }  // namespace webrtc
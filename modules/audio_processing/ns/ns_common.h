@@ -19,6 +19,7 @@ constexpr size_t kFftSize = 256;
 constexpr size_t kFftSizeBy2Plus1 = kFftSize / 2 + 1;
 constexpr size_t kNsFrameSize = 160;
 constexpr size_t kOverlapSize = kFftSize - kNsFrameSize;
+constexpr size_t kRnnoiseFrameSize = 480;
 
 constexpr int kShortStartupPhaseBlocks = 50;
 constexpr int kLongStartupPhaseBlocks = 200;
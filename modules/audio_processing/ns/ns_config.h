@@ -11,12 +11,57 @@
 #ifndef MODULES_AUDIO_PROCESSING_NS_NS_CONFIG_H_
 #define MODULES_AUDIO_PROCESSING_NS_NS_CONFIG_H_
 
+#include <string>
+
 namespace webrtc {
 
 // Config struct for the noise suppressor
 struct NsConfig {
   enum class SuppressionLevel { k6dB, k12dB, k18dB, k21dB };
+  // Complexity tiers of the RNNoise model, see `rnnoise_tier`.
+  enum class RnnoiseTier { kFull, kLite, kAuto };
   SuppressionLevel target_level = SuppressionLevel::k12dB;
+  // Runs RNNoise on the full-band signal, before the band splitting, instead
+  // of on the lowest band. Only supported at 48 kHz, which is the rate the
+  // RNNoise model is trained for.
+  bool rnnoise_full_band = false;
+  // Path of an RNNoise model written by rnnoise_model_write(). The built-in
+  // model is used if empty or if the file does not hold a valid model.
+  std::string rnnoise_model_path;
+  // Selects the RNNoise model. kFull uses the model of `rnnoise_model_path`
+  // and kLite the one of `rnnoise_lite_model_path`, a smaller model, e.g. with
+  // half-width GRUs, for low-end devices. kAuto selects kLite on CPUs without
+  // SIMD support or with at most two cores. The full model is used if the
+  // lite model cannot be loaded.
+  RnnoiseTier rnnoise_tier = RnnoiseTier::kFull;
+  std::string rnnoise_lite_model_path;
+  // Number of consecutive RNNoise frames below `rnnoise_silence_gate_dbfs`
+  // after which RNNoise is bypassed and the signal is only attenuated, until
+  // the level rises again. 0 disables the gate.
+  int rnnoise_silence_gate_frames = 0;
+  float rnnoise_silence_gate_dbfs = -60.f;
+  // Fuses the RNNoise gains into the Wiener filter instead of denoising the
+  // lowest band with RNNoise ahead of it, so that the signal goes through a
+  // single analysis and synthesis filter bank and the RNNoise delay is not
+  // added. RNNoise then only analyzes the lowest band. Overrides
+  // `rnnoise_full_band`.
+  bool rnnoise_hybrid = false;
+  // Uses the low-delay RNNoise synthesis, which halves the RNNoise delay.
+  bool rnnoise_low_delay = false;
+  // Limits the attenuation of RNNoise to `target_level`, and only runs the
+  // Wiener filter at k6dB, where it suffices at a fraction of the cost of
+  // RNNoise.
+  bool rnnoise_level_control = false;
+  // Runs the RNNoise features, pitch search and network once, on the downmix
+  // of all channels, and applies the resulting gains to every channel, which
+  // then only need their own FFTs. Intended for highly
+  // correlated channels, e.g. stereo or array capture, whose image is kept
+  // since all channels get the same gains.
+  bool rnnoise_linked_channels = false;
+  // Set if the RNNoise speech probability or pitch period is used by other
+  // components. Otherwise RNNoise is bypassed while the capture output is not
+  // used, skipping its analysis and network.
+  bool rnnoise_analysis_used = false;
 };
 
 }  // namespace webrtc
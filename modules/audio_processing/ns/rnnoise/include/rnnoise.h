@@ -53,9 +53,18 @@ typedef struct RNNModel RNNModel;
 
 /**
  * Return the size of DenoiseState
+ *
+ * A DenoiseState is a single block of memory holding all the state of the
+ * denoising, including the recurrent state of the network, so that states can
+ * be placed in caller-provided memory with rnnoise_init() and reused without
+ * any heap allocation. Such memory should be aligned to
+ * RNNOISE_STATE_ALIGNMENT bytes.
  */
 RNNOISE_EXPORT int rnnoise_get_size(void);
 
+/* Cache line alignment recommended for the memory of a DenoiseState */
+#define RNNOISE_STATE_ALIGNMENT 64
+
 /**
  * Return the number of samples processed by rnnoise_process_frame at a time
  */
@@ -64,7 +73,11 @@ RNNOISE_EXPORT int rnnoise_get_frame_size(void);
 /**
  * Initializes a pre-allocated DenoiseState
  *
- * If model is NULL the default model is used.
+ * If model is NULL the default model is used. The memory of st must hold
+ * rnnoise_get_size() bytes; the state owns no other memory, so that st can be
+ * released without rnnoise_destroy() and initialized again to be reused.
+ * Returns 0 on success and -1 if the recurrent layers of the model are too
+ * large.
  *
  * See: rnnoise_create() and rnnoise_model_from_file()
  */
@@ -75,7 +88,8 @@ RNNOISE_EXPORT int rnnoise_init(DenoiseState *st, RNNModel *model);
  *
  * If model is NULL the default model is used.
  *
- * The returned pointer MUST be freed with rnnoise_destroy().
+ * The returned pointer MUST be freed with rnnoise_destroy(). Returns NULL
+ * on failure.
  */
 RNNOISE_EXPORT DenoiseState *rnnoise_create(RNNModel *model);
 
@@ -86,6 +100,137 @@ RNNOISE_EXPORT DenoiseState *rnnoise_create(RNNModel *model);
  */
 RNNOISE_EXPORT void rnnoise_destroy(DenoiseState *st);
 
+/**
+ * Switch a state to another model between frames
+ *
+ * The recurrent state is reset, the other analysis buffers are kept. If
+ * model is NULL the default model is used. The previous model may be freed
+ * once no other state refers to it. Returns 0 on success, -1 if the
+ * recurrent layers of the model are too large, in which case the state keeps
+ * its model.
+ */
+RNNOISE_EXPORT int rnnoise_set_model(DenoiseState *st, RNNModel *model);
+
+/**
+ * Enable the silence gate of a state
+ *
+ * Once the mean square of hangover consecutive frames is below threshold, the
+ * frames are only attenuated by gain, skipping the feature extraction, the
+ * pitch search, the RNN and the synthesis. The denoising resumes with the
+ * recurrent state of the last denoised frame as soon as a frame exceeds the
+ * threshold, without discontinuity. The input is high-pass filtered before
+ * the energy is measured. A hangover of 0, the default, disables the gate.
+ * Returns 0 on success and -1 for invalid parameters.
+ */
+RNNOISE_EXPORT int rnnoise_set_silence_gate(DenoiseState *st, int hangover, float threshold, float gain);
+
+/**
+ * Limit the attenuation of the denoising of a state
+ *
+ * The band gains of the network are raised to at least floor, in the [0, 1]
+ * range, before they are applied, so that the noise is attenuated by at most
+ * -20 log10(floor) dB. The gains returned by rnnoise_get_gains() are limited
+ * alike, while the smoothing of the gains across frames is not affected. 0,
+ * the default, does not limit the attenuation. Returns 0 on success and -1 for
+ * an invalid floor.
+ */
+RNNOISE_EXPORT int rnnoise_set_gain_floor(DenoiseState *st, float floor);
+
+/**
+ * Switch a state to the analysis-only mode, or back to denoising
+ *
+ * In analysis-only mode, e.g. while the output is not used, the features are
+ * extracted and the RNN is evaluated to keep the state in sync with the input,
+ * but the output is the unprocessed, high-pass filtered and delayed input and
+ * its synthesis is skipped. The denoising resumes without discontinuity.
+ */
+RNNOISE_EXPORT void rnnoise_set_analysis_only(DenoiseState *st, int analysis_only);
+
+/**
+ * Switch a state to the bypass mode, or back to denoising
+ *
+ * In bypass mode, e.g. while neither the output nor the analysis is used, the
+ * frames are output as in analysis-only mode, but the feature extraction, the
+ * pitch search and the RNN are skipped, as for frames below the silence gate.
+ * The VAD probability is 0 and the gains and pitch period are not updated. The
+ * denoising resumes with the recurrent state of the last analyzed frame,
+ * without discontinuity. Takes precedence over the analysis-only mode.
+ */
+RNNOISE_EXPORT void rnnoise_set_bypass(DenoiseState *st, int bypass);
+
+/**
+ * Get the gains of the last denoised frame on a linear frequency grid
+ *
+ * Writes the smoothed band gains applied to the last non-silent frame,
+ * interpolated as in the synthesis onto n >= 2 evenly spaced bins from 0 to
+ * half the sample rate, e.g. to apply them to the spectrum of another filter
+ * bank. The gain of the last band is kept up to half the sample rate. The
+ * gains are also computed in analysis-only mode. Returns 0 on success and -1,
+ * leaving gains unchanged, before the first non-silent frame.
+ */
+RNNOISE_EXPORT int rnnoise_get_gains(const DenoiseState *st, float *gains, int n);
+
+/**
+ * Switch a state to the low-delay synthesis, or back to the default one
+ *
+ * The default overlap-add synthesis delays the output by one frame. The
+ * low-delay synthesis keeps the analysis and hence the features, but uses an
+ * asymmetric synthesis window overlapping the next frame by only half a frame,
+ * which halves the delay. The spectral leakage in the output is somewhat
+ * higher. It should be selected before the first frame.
+ */
+RNNOISE_EXPORT void rnnoise_set_low_delay(DenoiseState *st, int low_delay);
+
+/**
+ * Return the delay of the output of a state in samples
+ */
+RNNOISE_EXPORT int rnnoise_get_delay(const DenoiseState *st);
+
+/**
+ * Return the pitch period in samples estimated on the last analyzed frame
+ *
+ * The period is in the range [60, 768] at the sample rate of the input, e.g.
+ * to share the pitch search with another analysis of the same signal. Returns
+ * 0 before the first frame.
+ */
+RNNOISE_EXPORT int rnnoise_get_pitch_period(const DenoiseState *st);
+
+/* FFT backends for rnnoise_set_fft() */
+#define RNNOISE_FFT_KISS 0
+#define RNNOISE_FFT_PFFFT 1
+
+/**
+ * Select the FFT used for the analysis and the synthesis of a state
+ *
+ * RNNOISE_FFT_KISS, the default, runs a complex FFT over the real signal.
+ * RNNOISE_FFT_PFFFT runs a SIMD real FFT, which is about twice as fast and
+ * matches it up to rounding. The backend can be changed between frames.
+ * Returns 0 on success and -1 for an unknown backend.
+ */
+RNNOISE_EXPORT int rnnoise_set_fft(DenoiseState *st, int backend);
+
+/* Stages of the denoising of a frame, for rnnoise_set_stage_callback() */
+#define RNNOISE_STAGE_BIQUAD 0    /* High-pass filter of the input */
+#define RNNOISE_STAGE_FFT 1       /* Analysis window, FFT and band energies */
+#define RNNOISE_STAGE_PITCH 2     /* Pitch search */
+#define RNNOISE_STAGE_FEATURES 3  /* Pitch correlation and cepstral features */
+#define RNNOISE_STAGE_RNN 4       /* Evaluation of the network */
+#define RNNOISE_STAGE_SYNTHESIS 5 /* Gains, pitch filter and inverse FFT */
+#define RNNOISE_NUM_STAGES 6
+
+typedef void (*rnnoise_stage_callback)(void *user_data, int stage, int end);
+
+/**
+ * Set a callback reporting the stages of the denoising, e.g. to profile them
+ *
+ * callback is called with end = 0 when a stage of a frame of the state begins
+ * and with end = 1 when it ends. Stages which are skipped, e.g. for silent
+ * frames, are not reported. The network is evaluated jointly by
+ * rnnoise_process_frames(), and its stage is only reported to the first state
+ * of each batch. A NULL callback, the default, disables the reporting.
+ */
+RNNOISE_EXPORT void rnnoise_set_stage_callback(DenoiseState *st, rnnoise_stage_callback callback, void *user_data);
+
 /**
  * Denoise a frame of samples
  *
@@ -93,6 +238,32 @@ RNNOISE_EXPORT void rnnoise_destroy(DenoiseState *st);
  */
 RNNOISE_EXPORT float rnnoise_process_frame(DenoiseState *st, float *out, const float *in);
 
+/**
+ * Denoise one frame of samples for each of n states
+ *
+ * The RNN is evaluated jointly for states using the same model, so that the
+ * weights are loaded once per frame rather than once per state. The output is
+ * identical to calling rnnoise_process_frame() for each state. in[i] and
+ * out[i] must be at least rnnoise_get_frame_size() large. If vad_probs is not
+ * NULL it receives the n VAD probabilities.
+ */
+RNNOISE_EXPORT void rnnoise_process_frames(DenoiseState **st, int n, float **out, const float **in, float *vad_probs);
+
+/**
+ * Denoise a frame of samples with the gains of another state
+ *
+ * ref must have processed the frame of another, correlated signal covering the
+ * same time, typically a downmix of the channels of st and others, with
+ * rnnoise_process_frame() or rnnoise_process_frames(). Only the analysis FFT
+ * and the synthesis run for st: the pitch search, the features, the RNN and
+ * the pitch filter are skipped, and the smoothed band gains of ref are applied
+ * instead, limited by the gain floor of st. The states must use the same
+ * delay. The silence gate and the analysis-only mode of st apply as usual.
+ * Frames of st must not alternate between this and the other process
+ * functions.
+ */
+RNNOISE_EXPORT void rnnoise_process_frame_linked(DenoiseState *st, float *out, const float *in, const DenoiseState *ref);
+
 /**
  * Load a model from a file
  *
@@ -100,6 +271,56 @@ RNNOISE_EXPORT float rnnoise_process_frame(DenoiseState *st, float *out, const f
  */
 RNNOISE_EXPORT RNNModel *rnnoise_model_from_file(FILE *f);
 
+/**
+ * Create a model referring to the weights in a buffer in the binary format
+ *
+ * The buffer, e.g. a read-only memory mapping of a file written by
+ * rnnoise_model_write(), is not copied and must outlive the model and all the
+ * DenoiseStates using it, so that it can be shared by any number of states.
+ * flags are the rnnoise_model_pack() flags used to evaluate the model.
+ * Returns NULL if the buffer does not hold a valid model.
+ *
+ * It must be deallocated with rnnoise_model_free()
+ */
+RNNOISE_EXPORT RNNModel *rnnoise_model_from_buffer(const void *data, size_t size, int flags);
+
+/**
+ * Write a model in the binary format read by rnnoise_model_from_buffer()
+ *
+ * If model is NULL the default model is written. Returns 0 on success and -1
+ * on error.
+ */
+RNNOISE_EXPORT int rnnoise_model_write(const RNNModel *model, FILE *f);
+
+/* CPU feature flags for rnnoise_model_pack() */
+#define RNNOISE_CPU_SSE2 1
+#define RNNOISE_CPU_AVX2 2
+#define RNNOISE_CPU_NEON 4
+
+/* Use branch-free rational tanh and sigmoid approximations instead of the
+   lookup table. Their absolute error is below 1e-4 for tanh and 5e-5 for the
+   sigmoid. */
+#define RNNOISE_RATIONAL_ACTIVATIONS 8
+
+/* Evaluate the layers in the integer domain: the inputs of each layer are
+   quantized to 16 bits with a per-vector scale and multiplied with the 8-bit
+   weights with 32-bit accumulation. The relative quantization error is below
+   2e-5 of the largest input of each layer. */
+#define RNNOISE_INT16_INFERENCE 16
+
+/**
+ * Create a copy of a model with the weights rearranged for SIMD evaluation
+ *
+ * The weights of each neuron are stored contiguously and the model is
+ * evaluated with the kernels for the RNNOISE_CPU_* flags, falling back to
+ * plain C when none of them is available. RNNOISE_RATIONAL_ACTIVATIONS and
+ * RNNOISE_INT16_INFERENCE may be or-ed into flags. If model is NULL the
+ * default model is packed.
+ *
+ * It must be deallocated with rnnoise_model_free()
+ */
+RNNOISE_EXPORT RNNModel *rnnoise_model_pack(const RNNModel *model, int flags);
+
 /**
  * Free a custom model
  *
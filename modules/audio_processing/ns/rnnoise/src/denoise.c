@@ -41,12 +41,21 @@
 #include "pitch.h"
 #include "rnn.h"
 #include "rnn_data.h"
+#include "rnn_fft.h"
+#include "denoise_tables.h"
 
 #define FRAME_SIZE_SHIFT 2
 #define FRAME_SIZE (120 << FRAME_SIZE_SHIFT)
 #define WINDOW_SIZE (2 * FRAME_SIZE)
 #define FREQ_SIZE (FRAME_SIZE + 1)
 
+/* Overlap of the synthesis in low-delay mode, which is also its delay. */
+#define LOW_DELAY_OVERLAP (FRAME_SIZE / 2)
+
+#if WINDOW_SIZE != RNN_FFT_SIZE
+#error "The FFT backends must use the window size."
+#endif
+
 #define PITCH_MIN_PERIOD 60
 #define PITCH_MAX_PERIOD 768
 #define PITCH_FRAME_SIZE 960
@@ -75,12 +84,36 @@ static const opus_int16 eband5ms[] = {
     14, 16, 20, 24, 28, 34, 40, 48, 60, 78, 100};
 
 typedef struct {
-  int init;
-  kiss_fft_state* kfft;
-  float half_window[FRAME_SIZE];
-  float dct_table[NB_BANDS * NB_BANDS];
+  const kiss_fft_state* kfft;
+  const float* half_window;
+  const float* dct_table;
 } CommonState;
 
+/* Per-frame analysis results kept between the feature extraction and the
+   synthesis so that the RNN can be evaluated for several states at once. */
+typedef struct {
+  kiss_fft_cpx X[FREQ_SIZE];
+  kiss_fft_cpx P[FREQ_SIZE];
+  float Ex[NB_BANDS];
+  float Ep[NB_BANDS];
+  float Exp[NB_BANDS];
+  float features[NB_FEATURES];
+  float g[NB_BANDS];
+  int silence;
+  /* Non-zero if the output is already written and the synthesis skipped. */
+  int bypassed;
+} FrameAnalysis;
+
+/* Bypasses the denoising of long stretches of quiet input, see
+   rnnoise_set_silence_gate(). */
+typedef struct {
+  int hangover;
+  float threshold;
+  float gain;
+  /* Number of consecutive frames below the threshold. */
+  int quiet_frames;
+} SilenceGate;
+
 struct DenoiseState {
   float analysis_mem[FRAME_SIZE];
   float cepstral_mem[CEPS_MEM][NB_BANDS];
@@ -92,9 +125,31 @@ struct DenoiseState {
   int last_period;
   float mem_hp_x[2];
   float lastg[NB_BANDS];
+  /* Non-zero once lastg holds the gains of a non-silent frame. */
+  int has_gains;
   RNNState rnn;
+  const RnnFft* fft;
+  SilenceGate gate;
+  /* See rnnoise_set_analysis_only(). */
+  int analysis_only;
+  /* See rnnoise_set_bypass(). */
+  int bypass;
+  /* See rnnoise_set_low_delay(). */
+  int low_delay;
+  /* See rnnoise_set_gain_floor(). */
+  float gain_floor;
+  FrameAnalysis frame;
+  /* See rnnoise_set_stage_callback(). */
+  rnnoise_stage_callback stage_callback;
+  void* stage_user_data;
 };
 
+/* Reports the beginning (end = 0) or the end (end = 1) of a stage. */
+static void report_stage(const DenoiseState* st, int stage, int end) {
+  if (st->stage_callback)
+    st->stage_callback(st->stage_user_data, stage, end);
+}
+
 void compute_band_energy(float* bandE, const kiss_fft_cpx* X) {
   int i;
   float sum[NB_BANDS] = {0};
@@ -160,31 +215,12 @@ void interp_band_gain(float* g, const float* bandE) {
   }
 }
 
-CommonState common;
-
-static void check_init(void) {
-  int i;
-  if (common.init)
-    return;
-  common.kfft = opus_fft_alloc_twiddles(2 * FRAME_SIZE, NULL, NULL, NULL, 0);
-  for (i = 0; i < FRAME_SIZE; i++)
-    common.half_window[i] =
-        sin(.5 * M_PI * sin(.5 * M_PI * (i + .5) / FRAME_SIZE) *
-            sin(.5 * M_PI * (i + .5) / FRAME_SIZE));
-  for (i = 0; i < NB_BANDS; i++) {
-    int j;
-    for (j = 0; j < NB_BANDS; j++) {
-      common.dct_table[i * NB_BANDS + j] = cos((i + .5) * j * M_PI / NB_BANDS);
-      if (j == 0)
-        common.dct_table[i * NB_BANDS + j] *= sqrt(.5);
-    }
-  }
-  common.init = 1;
-}
+/* Data shared by all the states. It is built at compile time rather than on
+   first use, so that states can be created and run concurrently. */
+static const CommonState common = {&fft_state, half_window, dct_table};
 
 static void dct(float* out, const float* in) {
   int i;
-  check_init();
   for (i = 0; i < NB_BANDS; i++) {
     int j;
     float sum = 0;
@@ -198,7 +234,6 @@ static void dct(float* out, const float* in) {
 #if 0
 static void idct(float *out, const float *in) {
   int i;
-  check_init(void);
   for (i=0;i<NB_BANDS;i++) {
     int j;
     float sum = 0;
@@ -210,11 +245,10 @@ static void idct(float *out, const float *in) {
 }
 #endif
 
-static void forward_transform(kiss_fft_cpx* out, const float* in) {
+static void kiss_forward_transform(kiss_fft_cpx* out, const float* in) {
   int i;
   kiss_fft_cpx x[WINDOW_SIZE];
   kiss_fft_cpx y[WINDOW_SIZE];
-  check_init();
   for (i = 0; i < WINDOW_SIZE; i++) {
     x[i].r = in[i];
     x[i].i = 0;
@@ -225,11 +259,10 @@ static void forward_transform(kiss_fft_cpx* out, const float* in) {
   }
 }
 
-static void inverse_transform(float* out, const kiss_fft_cpx* in) {
+static void kiss_inverse_transform(float* out, const kiss_fft_cpx* in) {
   int i;
   kiss_fft_cpx x[WINDOW_SIZE];
   kiss_fft_cpx y[WINDOW_SIZE];
-  check_init();
   for (i = 0; i < FREQ_SIZE; i++) {
     x[i] = in[i];
   }
@@ -245,15 +278,54 @@ static void inverse_transform(float* out, const kiss_fft_cpx* in) {
   }
 }
 
+/* Complex kiss_fft over zero-imaginary inputs, kept as the reference. */
+static const RnnFft kiss_fft = {kiss_forward_transform, kiss_inverse_transform};
+
+static void forward_transform(const DenoiseState* st,
+                              kiss_fft_cpx* out,
+                              const float* in) {
+  st->fft->forward(out, in);
+}
+
+static void inverse_transform(const DenoiseState* st,
+                              float* out,
+                              const kiss_fft_cpx* in) {
+  st->fft->inverse(out, in);
+}
+
 static void apply_window(float* x) {
   int i;
-  check_init();
   for (i = 0; i < FRAME_SIZE; i++) {
     x[i] *= common.half_window[i];
     x[WINDOW_SIZE - 1 - i] *= common.half_window[i];
   }
 }
 
+/* Cross-fade of the low-delay synthesis, rising from 0 to 1 over
+   LOW_DELAY_OVERLAP samples. */
+static float low_delay_ramp(int i) {
+  return SQUARE(common.half_window[2 * i]);
+}
+
+/* Applies the synthesis window of the low-delay mode to the last
+   WINDOW_SIZE - LOW_DELAY_OVERLAP samples of x. Combined with the analysis
+   window, it cross-fades over the first and the last LOW_DELAY_OVERLAP of them
+   and is flat in between, so that consecutive frames add up to the input
+   without waiting for the next frame. The first LOW_DELAY_OVERLAP samples are
+   not used. */
+static void apply_low_delay_window(float* x) {
+  int i;
+  for (i = 0; i < LOW_DELAY_OVERLAP; i++) {
+    const int rise = LOW_DELAY_OVERLAP + i;
+    const int fall = WINDOW_SIZE - LOW_DELAY_OVERLAP + i;
+    x[rise] *= low_delay_ramp(i) / common.half_window[rise];
+    x[fall] *=
+        (1 - low_delay_ramp(i)) / common.half_window[WINDOW_SIZE - 1 - fall];
+  }
+  for (i = FRAME_SIZE; i < WINDOW_SIZE - LOW_DELAY_OVERLAP; i++)
+    x[i] /= common.half_window[WINDOW_SIZE - 1 - i];
+}
+
 int rnnoise_get_size(void) {
   return sizeof(DenoiseState);
 }
@@ -262,31 +334,129 @@ int rnnoise_get_frame_size(void) {
   return FRAME_SIZE;
 }
 
+/* Returns non-zero if the GRU states of model fit in an RNNState. */
+static int model_fits_state(const RNNModel* model) {
+  return model->vad_gru_size <= MAX_NEURONS &&
+         model->noise_gru_size <= MAX_NEURONS &&
+         model->denoise_gru_size <= MAX_NEURONS;
+}
+
 int rnnoise_init(DenoiseState* st, RNNModel* model) {
   memset(st, 0, sizeof(*st));
   if (model)
     st->rnn.model = model;
   else
     st->rnn.model = &rnnoise_model_orig;
-  st->rnn.vad_gru_state = calloc(sizeof(float), st->rnn.model->vad_gru_size);
-  st->rnn.noise_gru_state =
-      calloc(sizeof(float), st->rnn.model->noise_gru_size);
-  st->rnn.denoise_gru_state =
-      calloc(sizeof(float), st->rnn.model->denoise_gru_size);
-  return 0;
+  st->fft = &kiss_fft;
+  return model_fits_state(st->rnn.model) ? 0 : -1;
 }
 
 DenoiseState* rnnoise_create(RNNModel* model) {
   DenoiseState* st;
   st = malloc(rnnoise_get_size());
-  rnnoise_init(st, model);
+  if (st && rnnoise_init(st, model) != 0) {
+    free(st);
+    return NULL;
+  }
   return st;
 }
 
+int rnnoise_set_model(DenoiseState* st, RNNModel* model) {
+  const RNNModel* new_model = model ? model : &rnnoise_model_orig;
+  if (!model_fits_state(new_model))
+    return -1;
+  st->rnn.model = new_model;
+  RNN_CLEAR(st->rnn.vad_gru_state, MAX_NEURONS);
+  RNN_CLEAR(st->rnn.noise_gru_state, MAX_NEURONS);
+  RNN_CLEAR(st->rnn.denoise_gru_state, MAX_NEURONS);
+  return 0;
+}
+
+int rnnoise_set_silence_gate(DenoiseState* st,
+                             int hangover,
+                             float threshold,
+                             float gain) {
+  if (hangover < 0 || threshold < 0 || gain < 0 || gain > 1)
+    return -1;
+  st->gate.hangover = hangover;
+  st->gate.threshold = threshold * FRAME_SIZE;
+  st->gate.gain = gain;
+  st->gate.quiet_frames = 0;
+  return 0;
+}
+
+int rnnoise_set_gain_floor(DenoiseState* st, float floor) {
+  if (!(floor >= 0 && floor <= 1))
+    return -1;
+  st->gain_floor = floor;
+  return 0;
+}
+
+void rnnoise_set_analysis_only(DenoiseState* st, int analysis_only) {
+  st->analysis_only = analysis_only;
+}
+
+void rnnoise_set_bypass(DenoiseState* st, int bypass) {
+  st->bypass = bypass;
+}
+
+void rnnoise_set_low_delay(DenoiseState* st, int low_delay) {
+  st->low_delay = low_delay;
+}
+
+int rnnoise_get_delay(const DenoiseState* st) {
+  return st->low_delay ? LOW_DELAY_OVERLAP : FRAME_SIZE;
+}
+
+int rnnoise_get_pitch_period(const DenoiseState* st) {
+  return st->last_period;
+}
+
+int rnnoise_get_gains(const DenoiseState* st, float* gains, int n) {
+  int i;
+  int band = 0;
+  if (!st->has_gains)
+    return -1;
+  for (i = 0; i < n; i++) {
+    /* Position of the bin on the frequency grid of the frame. */
+    const float bin = (float)i * (FREQ_SIZE - 1) / (n - 1);
+    float start, end;
+    while (band < NB_BANDS - 2 &&
+           bin >= (eband5ms[band + 1] << FRAME_SIZE_SHIFT))
+      band++;
+    start = eband5ms[band] << FRAME_SIZE_SHIFT;
+    end = eband5ms[band + 1] << FRAME_SIZE_SHIFT;
+    /* Interpolated between the band centers as in interp_band_gain(), and
+       constant above the center of the last band. */
+    if (bin >= end) {
+      gains[i] = st->lastg[NB_BANDS - 1];
+    } else {
+      const float frac = (bin - start) / (end - start);
+      gains[i] = (1 - frac) * st->lastg[band] + frac * st->lastg[band + 1];
+    }
+    gains[i] = MAX16(gains[i], st->gain_floor);
+  }
+  return 0;
+}
+
+int rnnoise_set_fft(DenoiseState* st, int backend) {
+  if (backend == RNNOISE_FFT_KISS)
+    st->fft = &kiss_fft;
+  else if (backend == RNNOISE_FFT_PFFFT)
+    st->fft = rnn_fft_pffft();
+  else
+    return -1;
+  return 0;
+}
+
+void rnnoise_set_stage_callback(DenoiseState* st,
+                                rnnoise_stage_callback callback,
+                                void* user_data) {
+  st->stage_callback = callback;
+  st->stage_user_data = user_data;
+}
+
 void rnnoise_destroy(DenoiseState* st) {
-  free(st->rnn.vad_gru_state);
-  free(st->rnn.noise_gru_state);
-  free(st->rnn.denoise_gru_state);
   free(st);
 }
 
@@ -306,7 +476,7 @@ static void frame_analysis(DenoiseState* st,
     x[FRAME_SIZE + i] = in[i];
   RNN_COPY(st->analysis_mem, in, FRAME_SIZE);
   apply_window(x);
-  forward_transform(X, x);
+  forward_transform(st, X, x);
 #if TRAINING
   for (i = lowpass; i < FREQ_SIZE; i++)
     X[i].r = X[i].i = 0;
@@ -334,7 +504,10 @@ static int compute_frame_features(DenoiseState* st,
   float*(pre[1]);
   float tmp[NB_BANDS];
   float follow, logMax;
+  report_stage(st, RNNOISE_STAGE_FFT, 0);
   frame_analysis(st, X, Ex, in);
+  report_stage(st, RNNOISE_STAGE_FFT, 1);
+  report_stage(st, RNNOISE_STAGE_PITCH, 0);
   RNN_MOVE(st->pitch_buf, &st->pitch_buf[FRAME_SIZE],
            PITCH_BUF_SIZE - FRAME_SIZE);
   RNN_COPY(&st->pitch_buf[PITCH_BUF_SIZE - FRAME_SIZE], in, FRAME_SIZE);
@@ -342,7 +515,8 @@ static int compute_frame_features(DenoiseState* st,
   rnnoise_pitch_downsample(pre, pitch_buf, PITCH_BUF_SIZE, 1);
   rnnoise_pitch_search(pitch_buf + (PITCH_MAX_PERIOD >> 1), pitch_buf,
                        PITCH_FRAME_SIZE,
-                       PITCH_MAX_PERIOD - 3 * PITCH_MIN_PERIOD, &pitch_index);
+                       PITCH_MAX_PERIOD - 3 * PITCH_MIN_PERIOD, &pitch_index,
+                       rnnoise_select_pitch_xcorr(st->rnn.model->packed_flags));
   pitch_index = PITCH_MAX_PERIOD - pitch_index;
 
   gain = rnnoise_remove_doubling(pitch_buf, PITCH_MAX_PERIOD, PITCH_MIN_PERIOD,
@@ -350,10 +524,12 @@ static int compute_frame_features(DenoiseState* st,
                                  st->last_period, st->last_gain);
   st->last_period = pitch_index;
   st->last_gain = gain;
+  report_stage(st, RNNOISE_STAGE_PITCH, 1);
+  report_stage(st, RNNOISE_STAGE_FEATURES, 0);
   for (i = 0; i < WINDOW_SIZE; i++)
     p[i] = st->pitch_buf[PITCH_BUF_SIZE - WINDOW_SIZE - pitch_index + i];
   apply_window(p);
-  forward_transform(P, p);
+  forward_transform(st, P, p);
   compute_band_energy(Ep, P);
   compute_band_corr(Exp, X, P);
   for (i = 0; i < NB_BANDS; i++)
@@ -376,6 +552,7 @@ static int compute_frame_features(DenoiseState* st,
   if (!TRAINING && E < 0.04) {
     /* If there's no audio, avoid messing up the state. */
     RNN_CLEAR(features, NB_FEATURES);
+    report_stage(st, RNNOISE_STAGE_FEATURES, 1);
     return 1;
   }
   dct(features, Ly);
@@ -416,6 +593,7 @@ static int compute_frame_features(DenoiseState* st,
   }
   features[NB_BANDS + 3 * NB_DELTA_CEPS + 1] =
       spec_variability / CEPS_MEM - 2.1;
+  report_stage(st, RNNOISE_STAGE_FEATURES, 1);
   return TRAINING && E < 0.1;
 }
 
@@ -424,7 +602,17 @@ static void frame_synthesis(DenoiseState* st,
                             const kiss_fft_cpx* y) {
   float x[WINDOW_SIZE];
   int i;
-  inverse_transform(x, y);
+  inverse_transform(st, x, y);
+  if (st->low_delay) {
+    apply_low_delay_window(x);
+    for (i = 0; i < FRAME_SIZE; i++) {
+      out[i] = x[LOW_DELAY_OVERLAP + i] +
+               (i < LOW_DELAY_OVERLAP ? st->synthesis_mem[i] : 0);
+    }
+    RNN_COPY(st->synthesis_mem, &x[WINDOW_SIZE - LOW_DELAY_OVERLAP],
+             LOW_DELAY_OVERLAP);
+    return;
+  }
   apply_window(x);
   for (i = 0; i < FRAME_SIZE; i++)
     out[i] = x[i] + st->synthesis_mem[i];
@@ -491,44 +679,245 @@ void pitch_filter(kiss_fft_cpx* X,
   }
 }
 
-float rnnoise_process_frame(DenoiseState* st, float* out, const float* in) {
+/* Returns non-zero once the input has been below the silence gate threshold
+   for the hangover duration. */
+static int update_silence_gate(SilenceGate* gate, const float* x) {
   int i;
-  kiss_fft_cpx X[FREQ_SIZE];
-  kiss_fft_cpx P[WINDOW_SIZE];
+  float energy = 0;
+  if (gate->hangover == 0)
+    return 0;
+  for (i = 0; i < FRAME_SIZE; i++)
+    energy += x[i] * x[i];
+  if (energy >= gate->threshold) {
+    gate->quiet_frames = 0;
+    return 0;
+  }
+  if (gate->quiet_frames < gate->hangover)
+    gate->quiet_frames++;
+  return gate->quiet_frames == gate->hangover;
+}
+
+/* Outputs the previous frame scaled by gain instead of synthesizing it. The
+   overlap-add of the windowed signal is kept so that switching between the
+   bypass and the synthesis is seamless. Must be called before analysis_mem is
+   updated with x. */
+static void bypass_synthesis(DenoiseState* st,
+                             float* out,
+                             const float* x,
+                             float gain) {
+  int i;
+  if (st->low_delay) {
+    for (i = 0; i < LOW_DELAY_OVERLAP; i++) {
+      const float ramp = low_delay_ramp(i);
+      out[i] = st->synthesis_mem[i] +
+               gain * ramp * st->analysis_mem[LOW_DELAY_OVERLAP + i];
+      out[LOW_DELAY_OVERLAP + i] = gain * x[i];
+      st->synthesis_mem[i] = gain * (1 - ramp) * x[LOW_DELAY_OVERLAP + i];
+    }
+    return;
+  }
+  for (i = 0; i < FRAME_SIZE; i++) {
+    const float w = common.half_window[i];
+    const float w_tail = common.half_window[FRAME_SIZE - 1 - i];
+    out[i] = st->synthesis_mem[i] + gain * w * w * st->analysis_mem[i];
+    st->synthesis_mem[i] = gain * w_tail * w_tail * x[i];
+  }
+}
+
+/* Outputs a gated or bypassed frame scaled by gain. The analysis and pitch
+   buffers are updated so that the denoising resumes with the recent input. The
+   recurrent and cepstral states are kept, as for silent frames. */
+static void gate_frame(DenoiseState* st,
+                       float* out,
+                       const float* x,
+                       float gain) {
+  bypass_synthesis(st, out, x, gain);
+  RNN_COPY(st->analysis_mem, x, FRAME_SIZE);
+  RNN_MOVE(st->pitch_buf, &st->pitch_buf[FRAME_SIZE],
+           PITCH_BUF_SIZE - FRAME_SIZE);
+  RNN_COPY(&st->pitch_buf[PITCH_BUF_SIZE - FRAME_SIZE], x, FRAME_SIZE);
+}
+
+static void analyze_frame(DenoiseState* st, float* out, const float* in) {
+  FrameAnalysis* fa = &st->frame;
   float x[FRAME_SIZE];
-  float Ex[NB_BANDS], Ep[NB_BANDS];
-  float Exp[NB_BANDS];
-  float features[NB_FEATURES];
-  float g[NB_BANDS];
-  float gf[FREQ_SIZE] = {1};
-  float vad_prob = 0;
-  int silence;
   static const float a_hp[2] = {-1.99599, 0.99600};
   static const float b_hp[2] = {-2, 1};
+  report_stage(st, RNNOISE_STAGE_BIQUAD, 0);
   biquad(x, st->mem_hp_x, in, b_hp, a_hp, FRAME_SIZE);
-  silence = compute_frame_features(st, X, P, Ex, Ep, Exp, features, x);
+  report_stage(st, RNNOISE_STAGE_BIQUAD, 1);
+  if (st->bypass) {
+    fa->bypassed = 1;
+    fa->silence = 1;
+    gate_frame(st, out, x, 1.f);
+    return;
+  }
+  if (update_silence_gate(&st->gate, x)) {
+    fa->bypassed = 1;
+    fa->silence = 1;
+    gate_frame(st, out, x, st->gate.gain);
+    return;
+  }
+  /* In analysis-only mode the output is the unprocessed input, while the
+     features and the RNN keep the state in sync with the input. */
+  fa->bypassed = st->analysis_only;
+  if (fa->bypassed)
+    bypass_synthesis(st, out, x, 1.f);
+  fa->silence = compute_frame_features(st, fa->X, fa->P, fa->Ex, fa->Ep,
+                                       fa->Exp, fa->features, x);
+}
 
-  if (!silence) {
-    compute_rnn(&st->rnn, g, &vad_prob, features);
-    pitch_filter(X, P, Ex, Ep, Exp, g);
+/* Updates the gain smoothing of a frame which is not synthesized, so that it
+   is current when the synthesis resumes. */
+static void update_gain_memory(DenoiseState* st) {
+  FrameAnalysis* fa = &st->frame;
+  int i;
+  if (fa->silence)
+    return;
+  for (i = 0; i < NB_BANDS; i++)
+    st->lastg[i] = MAX16(fa->g[i], .6f * st->lastg[i]);
+  st->has_gains = 1;
+}
+
+static void synthesize_frame(DenoiseState* st, float* out) {
+  FrameAnalysis* fa = &st->frame;
+  int i;
+  float gf[FREQ_SIZE] = {1};
+  report_stage(st, RNNOISE_STAGE_SYNTHESIS, 0);
+  if (!fa->silence) {
+    pitch_filter(fa->X, fa->P, fa->Ex, fa->Ep, fa->Exp, fa->g);
     for (i = 0; i < NB_BANDS; i++) {
       float alpha = .6f;
-      g[i] = MAX16(g[i], alpha * st->lastg[i]);
-      st->lastg[i] = g[i];
+      fa->g[i] = MAX16(fa->g[i], alpha * st->lastg[i]);
+      st->lastg[i] = fa->g[i];
+      fa->g[i] = MAX16(fa->g[i], st->gain_floor);
     }
-    interp_band_gain(gf, g);
+    st->has_gains = 1;
+    interp_band_gain(gf, fa->g);
 #if 1
     for (i = 0; i < FREQ_SIZE; i++) {
-      X[i].r *= gf[i];
-      X[i].i *= gf[i];
+      fa->X[i].r *= gf[i];
+      fa->X[i].i *= gf[i];
     }
 #endif
   }
 
-  frame_synthesis(st, out, X);
+  frame_synthesis(st, out, fa->X);
+  report_stage(st, RNNOISE_STAGE_SYNTHESIS, 1);
+}
+
+float rnnoise_process_frame(DenoiseState* st, float* out, const float* in) {
+  float vad_prob;
+  rnnoise_process_frames(&st, 1, &out, &in, &vad_prob);
   return vad_prob;
 }
 
+void rnnoise_process_frames(DenoiseState** st,
+                            int n,
+                            float** out,
+                            const float** in,
+                            float* vad_probs) {
+  int i;
+  for (i = 0; i < n; i++) {
+    analyze_frame(st[i], out[i], in[i]);
+    if (vad_probs)
+      vad_probs[i] = 0;
+  }
+
+  /* Evaluate the RNN jointly for the non-silent frames that share a model. */
+  for (i = 0; i < n;) {
+    RNNState* rnn[RNN_MAX_BATCH];
+    float* gains[RNN_MAX_BATCH];
+    float* vad[RNN_MAX_BATCH];
+    const float* features[RNN_MAX_BATCH];
+    float vad_batch[RNN_MAX_BATCH];
+    int index[RNN_MAX_BATCH];
+    int batch_size = 0;
+    int k;
+    for (; i < n && batch_size < RNN_MAX_BATCH; i++) {
+      if (st[i]->frame.silence)
+        continue;
+      if (batch_size > 0 && st[i]->rnn.model != rnn[0]->model)
+        break;
+      rnn[batch_size] = &st[i]->rnn;
+      gains[batch_size] = st[i]->frame.g;
+      vad[batch_size] = &vad_batch[batch_size];
+      features[batch_size] = st[i]->frame.features;
+      index[batch_size] = i;
+      batch_size++;
+    }
+    if (batch_size == 0)
+      continue;
+    report_stage(st[index[0]], RNNOISE_STAGE_RNN, 0);
+    compute_rnn_batch(rnn, batch_size, gains, vad, features);
+    report_stage(st[index[0]], RNNOISE_STAGE_RNN, 1);
+    if (vad_probs) {
+      for (k = 0; k < batch_size; k++)
+        vad_probs[index[k]] = vad_batch[k];
+    }
+  }
+
+  for (i = 0; i < n; i++) {
+    if (!st[i]->frame.bypassed)
+      synthesize_frame(st[i], out[i]);
+    else
+      update_gain_memory(st[i]);
+  }
+}
+
+void rnnoise_process_frame_linked(DenoiseState* st,
+                                  float* out,
+                                  const float* in,
+                                  const DenoiseState* ref) {
+  FrameAnalysis* fa = &st->frame;
+  float x[FRAME_SIZE];
+  float gf[FREQ_SIZE] = {1};
+  int i;
+  static const float a_hp[2] = {-1.99599, 0.99600};
+  static const float b_hp[2] = {-2, 1};
+  report_stage(st, RNNOISE_STAGE_BIQUAD, 0);
+  biquad(x, st->mem_hp_x, in, b_hp, a_hp, FRAME_SIZE);
+  report_stage(st, RNNOISE_STAGE_BIQUAD, 1);
+  /* The gains are those of the reference, limited by the floor of st. */
+  RNN_COPY(st->lastg, ref->lastg, NB_BANDS);
+  st->has_gains = ref->has_gains;
+  st->last_period = ref->last_period;
+  fa->silence = ref->frame.silence;
+  if (st->bypass) {
+    fa->bypassed = 1;
+    fa->silence = 1;
+    gate_frame(st, out, x, 1.f);
+    return;
+  }
+  if (update_silence_gate(&st->gate, x)) {
+    fa->bypassed = 1;
+    fa->silence = 1;
+    gate_frame(st, out, x, st->gate.gain);
+    return;
+  }
+  fa->bypassed = st->analysis_only;
+  if (fa->bypassed) {
+    bypass_synthesis(st, out, x, 1.f);
+    RNN_COPY(st->analysis_mem, x, FRAME_SIZE);
+    return;
+  }
+  report_stage(st, RNNOISE_STAGE_FFT, 0);
+  frame_analysis(st, fa->X, fa->Ex, x);
+  report_stage(st, RNNOISE_STAGE_FFT, 1);
+  report_stage(st, RNNOISE_STAGE_SYNTHESIS, 0);
+  if (!fa->silence) {
+    for (i = 0; i < NB_BANDS; i++)
+      fa->g[i] = MAX16(st->lastg[i], st->gain_floor);
+    interp_band_gain(gf, fa->g);
+    for (i = 0; i < FREQ_SIZE; i++) {
+      fa->X[i].r *= gf[i];
+      fa->X[i].i *= gf[i];
+    }
+  }
+  frame_synthesis(st, out, fa->X);
+  report_stage(st, RNNOISE_STAGE_SYNTHESIS, 1);
+}
+
 #if TRAINING
 
 static float uni_rand() {
@@ -0,0 +1,1305 @@
+/* This file is auto-generated. fft_state is the state returned by
+   opus_fft_alloc_twiddles(960, NULL, NULL, NULL, 0). */
+
+static const kiss_twiddle_cpx fft_twiddles[960] = {
+    {1.000000000e+00f, -0.000000000e+00f},
+    {9.999786019e-01f, -6.544937845e-03f},
+    {9.999143481e-01f, -1.308959536e-02f},
+    {9.998072386e-01f, -1.963369176e-02f},
+    {9.996573329e-01f, -2.617694810e-02f},
+    {9.994645715e-01f, -3.271908313e-02f},
+    {9.992290139e-01f, -3.925981745e-02f},
+    {9.989506602e-01f, -4.579886794e-02f},
+    {9.986295104e-01f, -5.233595520e-02f},
+    {9.982656240e-01f, -5.887080356e-02f},
+    {9.978589416e-01f, -6.540312618e-02f},
+    {9.974094629e-01f, -7.193265110e-02f},
+    {9.969173074e-01f, -7.845909894e-02f},
+    {9.963824749e-01f, -8.498217911e-02f},
+    {9.958049059e-01f, -9.150161594e-02f},
+    {9.951847196e-01f, -9.801714122e-02f},
+    {9.945219159e-01f, -1.045284644e-01f},
+    {9.938164353e-01f, -1.110353097e-01f},
+    {9.930684566e-01f, -1.175373942e-01f},
+    {9.922779202e-01f, -1.240344495e-01f},
+    {9.914448857e-01f, -1.305261850e-01f},
+    {9.905693531e-01f, -1.370123476e-01f},
+    {9.896513820e-01f, -1.434926242e-01f},
+    {9.886910319e-01f, -1.499667615e-01f},
+    {9.876883626e-01f, -1.564344615e-01f},
+    {9.866433144e-01f, -1.628954709e-01f},
+    {9.855560660e-01f, -1.693495065e-01f},
+    {9.844265580e-01f, -1.757962853e-01f},
+    {9.832549095e-01f, -1.822355241e-01f},
+    {9.820411205e-01f, -1.886669695e-01f},
+    {9.807852507e-01f, -1.950903237e-01f},
+    {9.794874191e-01f, -2.015053183e-01f},
+    {9.781476259e-01f, -2.079116851e-01f},
+    {9.767658710e-01f, -2.143091559e-01f},
+    {9.753423333e-01f, -2.206974328e-01f},
+    {9.738769531e-01f, -2.270762622e-01f},
+    {9.723699093e-01f, -2.334453613e-01f},
+    {9.708212018e-01f, -2.398044616e-01f},
+    {9.692308903e-01f, -2.461532950e-01f},
+    {9.675990939e-01f, -2.524915636e-01f},
+    {9.659258127e-01f, -2.588190436e-01f},
+    {9.642111659e-01f, -2.651354373e-01f},
+    {9.624552131e-01f, -2.714404464e-01f},
+    {9.606580734e-01f, -2.777338326e-01f},
+    {9.588197470e-01f, -2.840153575e-01f},
+    {9.569403529e-01f, -2.902846634e-01f},
+    {9.550199509e-01f, -2.965415716e-01f},
+    {9.530586600e-01f, -3.027857840e-01f},
+    {9.510565400e-01f, -3.090170026e-01f},
+    {9.490136504e-01f, -3.152349889e-01f},
+    {9.469301105e-01f, -3.214394748e-01f},
+    {9.448060393e-01f, -3.276301920e-01f},
+    {9.426414967e-01f, -3.338068724e-01f},
+    {9.404365420e-01f, -3.399692476e-01f},
+    {9.381913543e-01f, -3.461170495e-01f},
+    {9.359059334e-01f, -3.522500396e-01f},
+    {9.335803986e-01f, -3.583679497e-01f},
+    {9.312149286e-01f, -3.644705117e-01f},
+    {9.288095236e-01f, -3.705574274e-01f},
+    {9.263643622e-01f, -3.766284883e-01f},
+    {9.238795042e-01f, -3.826834261e-01f},
+    {9.213551283e-01f, -3.887219727e-01f},
+    {9.187912345e-01f, -3.947438598e-01f},
+    {9.161879420e-01f, -4.007488191e-01f},
+    {9.135454297e-01f, -4.067366421e-01f},
+    {9.108638167e-01f, -4.127070308e-01f},
+    {9.081431627e-01f, -4.186597466e-01f},
+    {9.053836465e-01f, -4.245945215e-01f},
+    {9.025852680e-01f, -4.305110872e-01f},
+    {8.997482657e-01f, -4.364092350e-01f},
+    {8.968727589e-01f, -4.422886968e-01f},
+    {8.939588070e-01f, -4.481492043e-01f},
+    {8.910065293e-01f, -4.539904892e-01f},
+    {8.880161047e-01f, -4.598123729e-01f},
+    {8.849876523e-01f, -4.656145275e-01f},
+    {8.819212914e-01f, -4.713967443e-01f},
+    {8.788171411e-01f, -4.771587551e-01f},
+    {8.756753206e-01f, -4.829003513e-01f},
+    {8.724960089e-01f, -4.886212349e-01f},
+    {8.692793250e-01f, -4.943211973e-01f},
+    {8.660253882e-01f, -5.000000000e-01f},
+    {8.627343774e-01f, -5.056573749e-01f},
+    {8.594064116e-01f, -5.112931132e-01f},
+    {8.560416102e-01f, -5.169069171e-01f},
+    {8.526401520e-01f, -5.224985480e-01f},
+    {8.492021561e-01f, -5.280678272e-01f},
+    {8.457278013e-01f, -5.336145163e-01f},
+    {8.422172070e-01f, -5.391383171e-01f},
+    {8.386705518e-01f, -5.446390510e-01f},
+    {8.350879550e-01f, -5.501164198e-01f},
+    {8.314695954e-01f, -5.555702448e-01f},
+    {8.278156519e-01f, -5.610002279e-01f},
+    {8.241261840e-01f, -5.664062500e-01f},
+    {8.204014301e-01f, -5.717879534e-01f},
+    {8.166415691e-01f, -5.771452188e-01f},
+    {8.128466606e-01f, -5.824776888e-01f},
+    {8.090170026e-01f, -5.877852440e-01f},
+    {8.051526546e-01f, -5.930676460e-01f},
+    {8.012537956e-01f, -5.983245969e-01f},
+    {7.973206639e-01f, -6.035559177e-01f},
+    {7.933533192e-01f, -6.087614298e-01f},
+    {7.893520594e-01f, -6.139408350e-01f},
+    {7.853169441e-01f, -6.190939546e-01f},
+    {7.812481523e-01f, -6.242205501e-01f},
+    {7.771459818e-01f, -6.293203831e-01f},
+    {7.730104327e-01f, -6.343932748e-01f},
+    {7.688418031e-01f, -6.394389868e-01f},
+    {7.646402717e-01f, -6.444573402e-01f},
+    {7.604059577e-01f, -6.494480371e-01f},
+    {7.561390996e-01f, -6.544109583e-01f},
+    {7.518398166e-01f, -6.593458056e-01f},
+    {7.475083470e-01f, -6.642524600e-01f},
+    {7.431448102e-01f, -6.691306233e-01f},
+    {7.387495041e-01f, -6.739801168e-01f},
+    {7.343224883e-01f, -6.788007617e-01f},
+    {7.298640609e-01f, -6.835923195e-01f},
+    {7.253744006e-01f, -6.883545518e-01f},
+    {7.208535671e-01f, -6.930873394e-01f},
+    {7.163019180e-01f, -6.977904439e-01f},
+    {7.117196321e-01f, -7.024636865e-01f},
+    {7.071067691e-01f, -7.071067691e-01f},
+    {7.024636865e-01f, -7.117196321e-01f},
+    {6.977904439e-01f, -7.163019180e-01f},
+    {6.930873394e-01f, -7.208535671e-01f},
+    {6.883545518e-01f, -7.253744006e-01f},
+    {6.835923195e-01f, -7.298640609e-01f},
+    {6.788007617e-01f, -7.343224883e-01f},
+    {6.739801168e-01f, -7.387495041e-01f},
+    {6.691306233e-01f, -7.431448102e-01f},
+    {6.642524600e-01f, -7.475083470e-01f},
+    {6.593458056e-01f, -7.518398166e-01f},
+    {6.544109583e-01f, -7.561390996e-01f},
+    {6.494480371e-01f, -7.604059577e-01f},
+    {6.444573402e-01f, -7.646402717e-01f},
+    {6.394389868e-01f, -7.688418031e-01f},
+    {6.343932748e-01f, -7.730104327e-01f},
+    {6.293203831e-01f, -7.771459818e-01f},
+    {6.242205501e-01f, -7.812481523e-01f},
+    {6.190939546e-01f, -7.853169441e-01f},
+    {6.139408350e-01f, -7.893520594e-01f},
+    {6.087614298e-01f, -7.933533192e-01f},
+    {6.035559177e-01f, -7.973206639e-01f},
+    {5.983245969e-01f, -8.012537956e-01f},
+    {5.930676460e-01f, -8.051526546e-01f},
+    {5.877852440e-01f, -8.090170026e-01f},
+    {5.824776888e-01f, -8.128466606e-01f},
+    {5.771452188e-01f, -8.166415691e-01f},
+    {5.717879534e-01f, -8.204014301e-01f},
+    {5.664062500e-01f, -8.241261840e-01f},
+    {5.610002279e-01f, -8.278156519e-01f},
+    {5.555702448e-01f, -8.314695954e-01f},
+    {5.501164198e-01f, -8.350879550e-01f},
+    {5.446390510e-01f, -8.386705518e-01f},
+    {5.391383171e-01f, -8.422172070e-01f},
+    {5.336145163e-01f, -8.457278013e-01f},
+    {5.280678272e-01f, -8.492021561e-01f},
+    {5.224985480e-01f, -8.526401520e-01f},
+    {5.169069171e-01f, -8.560416102e-01f},
+    {5.112931132e-01f, -8.594064116e-01f},
+    {5.056573749e-01f, -8.627343774e-01f},
+    {5.000000000e-01f, -8.660253882e-01f},
+    {4.943211973e-01f, -8.692793250e-01f},
+    {4.886212349e-01f, -8.724960089e-01f},
+    {4.829003513e-01f, -8.756753206e-01f},
+    {4.771587551e-01f, -8.788171411e-01f},
+    {4.713967443e-01f, -8.819212914e-01f},
+    {4.656145275e-01f, -8.849876523e-01f},
+    {4.598123729e-01f, -8.880161047e-01f},
+    {4.539904892e-01f, -8.910065293e-01f},
+    {4.481492043e-01f, -8.939588070e-01f},
+    {4.422886968e-01f, -8.968727589e-01f},
+    {4.364092350e-01f, -8.997482657e-01f},
+    {4.305110872e-01f, -9.025852680e-01f},
+    {4.245945215e-01f, -9.053836465e-01f},
+    {4.186597466e-01f, -9.081431627e-01f},
+    {4.127070308e-01f, -9.108638167e-01f},
+    {4.067366421e-01f, -9.135454297e-01f},
+    {4.007488191e-01f, -9.161879420e-01f},
+    {3.947438598e-01f, -9.187912345e-01f},
+    {3.887219727e-01f, -9.213551283e-01f},
+    {3.826834261e-01f, -9.238795042e-01f},
+    {3.766284883e-01f, -9.263643622e-01f},
+    {3.705574274e-01f, -9.288095236e-01f},
+    {3.644705117e-01f, -9.312149286e-01f},
+    {3.583679497e-01f, -9.335803986e-01f},
+    {3.522500396e-01f, -9.359059334e-01f},
+    {3.461170495e-01f, -9.381913543e-01f},
+    {3.399692476e-01f, -9.404365420e-01f},
+    {3.338068724e-01f, -9.426414967e-01f},
+    {3.276301920e-01f, -9.448060393e-01f},
+    {3.214394748e-01f, -9.469301105e-01f},
+    {3.152349889e-01f, -9.490136504e-01f},
+    {3.090170026e-01f, -9.510565400e-01f},
+    {3.027857840e-01f, -9.530586600e-01f},
+    {2.965415716e-01f, -9.550199509e-01f},
+    {2.902846634e-01f, -9.569403529e-01f},
+    {2.840153575e-01f, -9.588197470e-01f},
+    {2.777338326e-01f, -9.606580734e-01f},
+    {2.714404464e-01f, -9.624552131e-01f},
+    {2.651354373e-01f, -9.642111659e-01f},
+    {2.588190436e-01f, -9.659258127e-01f},
+    {2.524915636e-01f, -9.675990939e-01f},
+    {2.461532950e-01f, -9.692308903e-01f},
+    {2.398044616e-01f, -9.708212018e-01f},
+    {2.334453613e-01f, -9.723699093e-01f},
+    {2.270762622e-01f, -9.738769531e-01f},
+    {2.206974328e-01f, -9.753423333e-01f},
+    {2.143091559e-01f, -9.767658710e-01f},
+    {2.079116851e-01f, -9.781476259e-01f},
+    {2.015053183e-01f, -9.794874191e-01f},
+    {1.950903237e-01f, -9.807852507e-01f},
+    {1.886669695e-01f, -9.820411205e-01f},
+    {1.822355241e-01f, -9.832549095e-01f},
+    {1.757962853e-01f, -9.844265580e-01f},
+    {1.693495065e-01f, -9.855560660e-01f},
+    {1.628954709e-01f, -9.866433144e-01f},
+    {1.564344615e-01f, -9.876883626e-01f},
+    {1.499667615e-01f, -9.886910319e-01f},
+    {1.434926242e-01f, -9.896513820e-01f},
+    {1.370123476e-01f, -9.905693531e-01f},
+    {1.305261850e-01f, -9.914448857e-01f},
+    {1.240344495e-01f, -9.922779202e-01f},
+    {1.175373942e-01f, -9.930684566e-01f},
+    {1.110353097e-01f, -9.938164353e-01f},
+    {1.045284644e-01f, -9.945219159e-01f},
+    {9.801714122e-02f, -9.951847196e-01f},
+    {9.150161594e-02f, -9.958049059e-01f},
+    {8.498217911e-02f, -9.963824749e-01f},
+    {7.845909894e-02f, -9.969173074e-01f},
+    {7.193265110e-02f, -9.974094629e-01f},
+    {6.540312618e-02f, -9.978589416e-01f},
+    {5.887080356e-02f, -9.982656240e-01f},
+    {5.233595520e-02f, -9.986295104e-01f},
+    {4.579886794e-02f, -9.989506602e-01f},
+    {3.925981745e-02f, -9.992290139e-01f},
+    {3.271908313e-02f, -9.994645715e-01f},
+    {2.617694810e-02f, -9.996573329e-01f},
+    {1.963369176e-02f, -9.998072386e-01f},
+    {1.308959536e-02f, -9.999143481e-01f},
+    {6.544937845e-03f, -9.999786019e-01f},
+    {6.123234263e-17f, -1.000000000e+00f},
+    {-6.544937845e-03f, -9.999786019e-01f},
+    {-1.308959536e-02f, -9.999143481e-01f},
+    {-1.963369176e-02f, -9.998072386e-01f},
+    {-2.617694810e-02f, -9.996573329e-01f},
+    {-3.271908313e-02f, -9.994645715e-01f},
+    {-3.925981745e-02f, -9.992290139e-01f},
+    {-4.579886794e-02f, -9.989506602e-01f},
+    {-5.233595520e-02f, -9.986295104e-01f},
+    {-5.887080356e-02f, -9.982656240e-01f},
+    {-6.540312618e-02f, -9.978589416e-01f},
+    {-7.193265110e-02f, -9.974094629e-01f},
+    {-7.845909894e-02f, -9.969173074e-01f},
+    {-8.498217911e-02f, -9.963824749e-01f},
+    {-9.150161594e-02f, -9.958049059e-01f},
+    {-9.801714122e-02f, -9.951847196e-01f},
+    {-1.045284644e-01f, -9.945219159e-01f},
+    {-1.110353097e-01f, -9.938164353e-01f},
+    {-1.175373942e-01f, -9.930684566e-01f},
+    {-1.240344495e-01f, -9.922779202e-01f},
+    {-1.305261850e-01f, -9.914448857e-01f},
+    {-1.370123476e-01f, -9.905693531e-01f},
+    {-1.434926242e-01f, -9.896513820e-01f},
+    {-1.499667615e-01f, -9.886910319e-01f},
+    {-1.564344615e-01f, -9.876883626e-01f},
+    {-1.628954709e-01f, -9.866433144e-01f},
+    {-1.693495065e-01f, -9.855560660e-01f},
+    {-1.757962853e-01f, -9.844265580e-01f},
+    {-1.822355241e-01f, -9.832549095e-01f},
+    {-1.886669695e-01f, -9.820411205e-01f},
+    {-1.950903237e-01f, -9.807852507e-01f},
+    {-2.015053183e-01f, -9.794874191e-01f},
+    {-2.079116851e-01f, -9.781476259e-01f},
+    {-2.143091559e-01f, -9.767658710e-01f},
+    {-2.206974328e-01f, -9.753423333e-01f},
+    {-2.270762622e-01f, -9.738769531e-01f},
+    {-2.334453613e-01f, -9.723699093e-01f},
+    {-2.398044616e-01f, -9.708212018e-01f},
+    {-2.461532950e-01f, -9.692308903e-01f},
+    {-2.524915636e-01f, -9.675990939e-01f},
+    {-2.588190436e-01f, -9.659258127e-01f},
+    {-2.651354373e-01f, -9.642111659e-01f},
+    {-2.714404464e-01f, -9.624552131e-01f},
+    {-2.777338326e-01f, -9.606580734e-01f},
+    {-2.840153575e-01f, -9.588197470e-01f},
+    {-2.902846634e-01f, -9.569403529e-01f},
+    {-2.965415716e-01f, -9.550199509e-01f},
+    {-3.027857840e-01f, -9.530586600e-01f},
+    {-3.090170026e-01f, -9.510565400e-01f},
+    {-3.152349889e-01f, -9.490136504e-01f},
+    {-3.214394748e-01f, -9.469301105e-01f},
+    {-3.276301920e-01f, -9.448060393e-01f},
+    {-3.338068724e-01f, -9.426414967e-01f},
+    {-3.399692476e-01f, -9.404365420e-01f},
+    {-3.461170495e-01f, -9.381913543e-01f},
+    {-3.522500396e-01f, -9.359059334e-01f},
+    {-3.583679497e-01f, -9.335803986e-01f},
+    {-3.644705117e-01f, -9.312149286e-01f},
+    {-3.705574274e-01f, -9.288095236e-01f},
+    {-3.766284883e-01f, -9.263643622e-01f},
+    {-3.826834261e-01f, -9.238795042e-01f},
+    {-3.887219727e-01f, -9.213551283e-01f},
+    {-3.947438598e-01f, -9.187912345e-01f},
+    {-4.007488191e-01f, -9.161879420e-01f},
+    {-4.067366421e-01f, -9.135454297e-01f},
+    {-4.127070308e-01f, -9.108638167e-01f},
+    {-4.186597466e-01f, -9.081431627e-01f},
+    {-4.245945215e-01f, -9.053836465e-01f},
+    {-4.305110872e-01f, -9.025852680e-01f},
+    {-4.364092350e-01f, -8.997482657e-01f},
+    {-4.422886968e-01f, -8.968727589e-01f},
+    {-4.481492043e-01f, -8.939588070e-01f},
+    {-4.539904892e-01f, -8.910065293e-01f},
+    {-4.598123729e-01f, -8.880161047e-01f},
+    {-4.656145275e-01f, -8.849876523e-01f},
+    {-4.713967443e-01f, -8.819212914e-01f},
+    {-4.771587551e-01f, -8.788171411e-01f},
+    {-4.829003513e-01f, -8.756753206e-01f},
+    {-4.886212349e-01f, -8.724960089e-01f},
+    {-4.943211973e-01f, -8.692793250e-01f},
+    {-5.000000000e-01f, -8.660253882e-01f},
+    {-5.056573749e-01f, -8.627343774e-01f},
+    {-5.112931132e-01f, -8.594064116e-01f},
+    {-5.169069171e-01f, -8.560416102e-01f},
+    {-5.224985480e-01f, -8.526401520e-01f},
+    {-5.280678272e-01f, -8.492021561e-01f},
+    {-5.336145163e-01f, -8.457278013e-01f},
+    {-5.391383171e-01f, -8.422172070e-01f},
+    {-5.446390510e-01f, -8.386705518e-01f},
+    {-5.501164198e-01f, -8.350879550e-01f},
+    {-5.555702448e-01f, -8.314695954e-01f},
+    {-5.610002279e-01f, -8.278156519e-01f},
+    {-5.664062500e-01f, -8.241261840e-01f},
+    {-5.717879534e-01f, -8.204014301e-01f},
+    {-5.771452188e-01f, -8.166415691e-01f},
+    {-5.824776888e-01f, -8.128466606e-01f},
+    {-5.877852440e-01f, -8.090170026e-01f},
+    {-5.930676460e-01f, -8.051526546e-01f},
+    {-5.983245969e-01f, -8.012537956e-01f},
+    {-6.035559177e-01f, -7.973206639e-01f},
+    {-6.087614298e-01f, -7.933533192e-01f},
+    {-6.139408350e-01f, -7.893520594e-01f},
+    {-6.190939546e-01f, -7.853169441e-01f},
+    {-6.242205501e-01f, -7.812481523e-01f},
+    {-6.293203831e-01f, -7.771459818e-01f},
+    {-6.343932748e-01f, -7.730104327e-01f},
+    {-6.394389868e-01f, -7.688418031e-01f},
+    {-6.444573402e-01f, -7.646402717e-01f},
+    {-6.494480371e-01f, -7.604059577e-01f},
+    {-6.544109583e-01f, -7.561390996e-01f},
+    {-6.593458056e-01f, -7.518398166e-01f},
+    {-6.642524600e-01f, -7.475083470e-01f},
+    {-6.691306233e-01f, -7.431448102e-01f},
+    {-6.739801168e-01f, -7.387495041e-01f},
+    {-6.788007617e-01f, -7.343224883e-01f},
+    {-6.835923195e-01f, -7.298640609e-01f},
+    {-6.883545518e-01f, -7.253744006e-01f},
+    {-6.930873394e-01f, -7.208535671e-01f},
+    {-6.977904439e-01f, -7.163019180e-01f},
+    {-7.024636865e-01f, -7.117196321e-01f},
+    {-7.071067691e-01f, -7.071067691e-01f},
+    {-7.117196321e-01f, -7.024636865e-01f},
+    {-7.163019180e-01f, -6.977904439e-01f},
+    {-7.208535671e-01f, -6.930873394e-01f},
+    {-7.253744006e-01f, -6.883545518e-01f},
+    {-7.298640609e-01f, -6.835923195e-01f},
+    {-7.343224883e-01f, -6.788007617e-01f},
+    {-7.387495041e-01f, -6.739801168e-01f},
+    {-7.431448102e-01f, -6.691306233e-01f},
+    {-7.475083470e-01f, -6.642524600e-01f},
+    {-7.518398166e-01f, -6.593458056e-01f},
+    {-7.561390996e-01f, -6.544109583e-01f},
+    {-7.604059577e-01f, -6.494480371e-01f},
+    {-7.646402717e-01f, -6.444573402e-01f},
+    {-7.688418031e-01f, -6.394389868e-01f},
+    {-7.730104327e-01f, -6.343932748e-01f},
+    {-7.771459818e-01f, -6.293203831e-01f},
+    {-7.812481523e-01f, -6.242205501e-01f},
+    {-7.853169441e-01f, -6.190939546e-01f},
+    {-7.893520594e-01f, -6.139408350e-01f},
+    {-7.933533192e-01f, -6.087614298e-01f},
+    {-7.973206639e-01f, -6.035559177e-01f},
+    {-8.012537956e-01f, -5.983245969e-01f},
+    {-8.051526546e-01f, -5.930676460e-01f},
+    {-8.090170026e-01f, -5.877852440e-01f},
+    {-8.128466606e-01f, -5.824776888e-01f},
+    {-8.166415691e-01f, -5.771452188e-01f},
+    {-8.204014301e-01f, -5.717879534e-01f},
+    {-8.241261840e-01f, -5.664062500e-01f},
+    {-8.278156519e-01f, -5.610002279e-01f},
+    {-8.314695954e-01f, -5.555702448e-01f},
+    {-8.350879550e-01f, -5.501164198e-01f},
+    {-8.386705518e-01f, -5.446390510e-01f},
+    {-8.422172070e-01f, -5.391383171e-01f},
+    {-8.457278013e-01f, -5.336145163e-01f},
+    {-8.492021561e-01f, -5.280678272e-01f},
+    {-8.526401520e-01f, -5.224985480e-01f},
+    {-8.560416102e-01f, -5.169069171e-01f},
+    {-8.594064116e-01f, -5.112931132e-01f},
+    {-8.627343774e-01f, -5.056573749e-01f},
+    {-8.660253882e-01f, -5.000000000e-01f},
+    {-8.692793250e-01f, -4.943211973e-01f},
+    {-8.724960089e-01f, -4.886212349e-01f},
+    {-8.756753206e-01f, -4.829003513e-01f},
+    {-8.788171411e-01f, -4.771587551e-01f},
+    {-8.819212914e-01f, -4.713967443e-01f},
+    {-8.849876523e-01f, -4.656145275e-01f},
+    {-8.880161047e-01f, -4.598123729e-01f},
+    {-8.910065293e-01f, -4.539904892e-01f},
+    {-8.939588070e-01f, -4.481492043e-01f},
+    {-8.968727589e-01f, -4.422886968e-01f},
+    {-8.997482657e-01f, -4.364092350e-01f},
+    {-9.025852680e-01f, -4.305110872e-01f},
+    {-9.053836465e-01f, -4.245945215e-01f},
+    {-9.081431627e-01f, -4.186597466e-01f},
+    {-9.108638167e-01f, -4.127070308e-01f},
+    {-9.135454297e-01f, -4.067366421e-01f},
+    {-9.161879420e-01f, -4.007488191e-01f},
+    {-9.187912345e-01f, -3.947438598e-01f},
+    {-9.213551283e-01f, -3.887219727e-01f},
+    {-9.238795042e-01f, -3.826834261e-01f},
+    {-9.263643622e-01f, -3.766284883e-01f},
+    {-9.288095236e-01f, -3.705574274e-01f},
+    {-9.312149286e-01f, -3.644705117e-01f},
+    {-9.335803986e-01f, -3.583679497e-01f},
+    {-9.359059334e-01f, -3.522500396e-01f},
+    {-9.381913543e-01f, -3.461170495e-01f},
+    {-9.404365420e-01f, -3.399692476e-01f},
+    {-9.426414967e-01f, -3.338068724e-01f},
+    {-9.448060393e-01f, -3.276301920e-01f},
+    {-9.469301105e-01f, -3.214394748e-01f},
+    {-9.490136504e-01f, -3.152349889e-01f},
+    {-9.510565400e-01f, -3.090170026e-01f},
+    {-9.530586600e-01f, -3.027857840e-01f},
+    {-9.550199509e-01f, -2.965415716e-01f},
+    {-9.569403529e-01f, -2.902846634e-01f},
+    {-9.588197470e-01f, -2.840153575e-01f},
+    {-9.606580734e-01f, -2.777338326e-01f},
+    {-9.624552131e-01f, -2.714404464e-01f},
+    {-9.642111659e-01f, -2.651354373e-01f},
+    {-9.659258127e-01f, -2.588190436e-01f},
+    {-9.675990939e-01f, -2.524915636e-01f},
+    {-9.692308903e-01f, -2.461532950e-01f},
+    {-9.708212018e-01f, -2.398044616e-01f},
+    {-9.723699093e-01f, -2.334453613e-01f},
+    {-9.738769531e-01f, -2.270762622e-01f},
+    {-9.753423333e-01f, -2.206974328e-01f},
+    {-9.767658710e-01f, -2.143091559e-01f},
+    {-9.781476259e-01f, -2.079116851e-01f},
+    {-9.794874191e-01f, -2.015053183e-01f},
+    {-9.807852507e-01f, -1.950903237e-01f},
+    {-9.820411205e-01f, -1.886669695e-01f},
+    {-9.832549095e-01f, -1.822355241e-01f},
+    {-9.844265580e-01f, -1.757962853e-01f},
+    {-9.855560660e-01f, -1.693495065e-01f},
+    {-9.866433144e-01f, -1.628954709e-01f},
+    {-9.876883626e-01f, -1.564344615e-01f},
+    {-9.886910319e-01f, -1.499667615e-01f},
+    {-9.896513820e-01f, -1.434926242e-01f},
+    {-9.905693531e-01f, -1.370123476e-01f},
+    {-9.914448857e-01f, -1.305261850e-01f},
+    {-9.922779202e-01f, -1.240344495e-01f},
+    {-9.930684566e-01f, -1.175373942e-01f},
+    {-9.938164353e-01f, -1.110353097e-01f},
+    {-9.945219159e-01f, -1.045284644e-01f},
+    {-9.951847196e-01f, -9.801714122e-02f},
+    {-9.958049059e-01f, -9.150161594e-02f},
+    {-9.963824749e-01f, -8.498217911e-02f},
+    {-9.969173074e-01f, -7.845909894e-02f},
+    {-9.974094629e-01f, -7.193265110e-02f},
+    {-9.978589416e-01f, -6.540312618e-02f},
+    {-9.982656240e-01f, -5.887080356e-02f},
+    {-9.986295104e-01f, -5.233595520e-02f},
+    {-9.989506602e-01f, -4.579886794e-02f},
+    {-9.992290139e-01f, -3.925981745e-02f},
+    {-9.994645715e-01f, -3.271908313e-02f},
+    {-9.996573329e-01f, -2.617694810e-02f},
+    {-9.998072386e-01f, -1.963369176e-02f},
+    {-9.999143481e-01f, -1.308959536e-02f},
+    {-9.999786019e-01f, -6.544937845e-03f},
+    {-1.000000000e+00f, -1.224646853e-16f},
+    {-9.999786019e-01f, 6.544937845e-03f},
+    {-9.999143481e-01f, 1.308959536e-02f},
+    {-9.998072386e-01f, 1.963369176e-02f},
+    {-9.996573329e-01f, 2.617694810e-02f},
+    {-9.994645715e-01f, 3.271908313e-02f},
+    {-9.992290139e-01f, 3.925981745e-02f},
+    {-9.989506602e-01f, 4.579886794e-02f},
+    {-9.986295104e-01f, 5.233595520e-02f},
+    {-9.982656240e-01f, 5.887080356e-02f},
+    {-9.978589416e-01f, 6.540312618e-02f},
+    {-9.974094629e-01f, 7.193265110e-02f},
+    {-9.969173074e-01f, 7.845909894e-02f},
+    {-9.963824749e-01f, 8.498217911e-02f},
+    {-9.958049059e-01f, 9.150161594e-02f},
+    {-9.951847196e-01f, 9.801714122e-02f},
+    {-9.945219159e-01f, 1.045284644e-01f},
+    {-9.938164353e-01f, 1.110353097e-01f},
+    {-9.930684566e-01f, 1.175373942e-01f},
+    {-9.922779202e-01f, 1.240344495e-01f},
+    {-9.914448857e-01f, 1.305261850e-01f},
+    {-9.905693531e-01f, 1.370123476e-01f},
+    {-9.896513820e-01f, 1.434926242e-01f},
+    {-9.886910319e-01f, 1.499667615e-01f},
+    {-9.876883626e-01f, 1.564344615e-01f},
+    {-9.866433144e-01f, 1.628954709e-01f},
+    {-9.855560660e-01f, 1.693495065e-01f},
+    {-9.844265580e-01f, 1.757962853e-01f},
+    {-9.832549095e-01f, 1.822355241e-01f},
+    {-9.820411205e-01f, 1.886669695e-01f},
+    {-9.807852507e-01f, 1.950903237e-01f},
+    {-9.794874191e-01f, 2.015053183e-01f},
+    {-9.781476259e-01f, 2.079116851e-01f},
+    {-9.767658710e-01f, 2.143091559e-01f},
+    {-9.753423333e-01f, 2.206974328e-01f},
+    {-9.738769531e-01f, 2.270762622e-01f},
+    {-9.723699093e-01f, 2.334453613e-01f},
+    {-9.708212018e-01f, 2.398044616e-01f},
+    {-9.692308903e-01f, 2.461532950e-01f},
+    {-9.675990939e-01f, 2.524915636e-01f},
+    {-9.659258127e-01f, 2.588190436e-01f},
+    {-9.642111659e-01f, 2.651354373e-01f},
+    {-9.624552131e-01f, 2.714404464e-01f},
+    {-9.606580734e-01f, 2.777338326e-01f},
+    {-9.588197470e-01f, 2.840153575e-01f},
+    {-9.569403529e-01f, 2.902846634e-01f},
+    {-9.550199509e-01f, 2.965415716e-01f},
+    {-9.530586600e-01f, 3.027857840e-01f},
+    {-9.510565400e-01f, 3.090170026e-01f},
+    {-9.490136504e-01f, 3.152349889e-01f},
+    {-9.469301105e-01f, 3.214394748e-01f},
+    {-9.448060393e-01f, 3.276301920e-01f},
+    {-9.426414967e-01f, 3.338068724e-01f},
+    {-9.404365420e-01f, 3.399692476e-01f},
+    {-9.381913543e-01f, 3.461170495e-01f},
+    {-9.359059334e-01f, 3.522500396e-01f},
+    {-9.335803986e-01f, 3.583679497e-01f},
+    {-9.312149286e-01f, 3.644705117e-01f},
+    {-9.288095236e-01f, 3.705574274e-01f},
+    {-9.263643622e-01f, 3.766284883e-01f},
+    {-9.238795042e-01f, 3.826834261e-01f},
+    {-9.213551283e-01f, 3.887219727e-01f},
+    {-9.187912345e-01f, 3.947438598e-01f},
+    {-9.161879420e-01f, 4.007488191e-01f},
+    {-9.135454297e-01f, 4.067366421e-01f},
+    {-9.108638167e-01f, 4.127070308e-01f},
+    {-9.081431627e-01f, 4.186597466e-01f},
+    {-9.053836465e-01f, 4.245945215e-01f},
+    {-9.025852680e-01f, 4.305110872e-01f},
+    {-8.997482657e-01f, 4.364092350e-01f},
+    {-8.968727589e-01f, 4.422886968e-01f},
+    {-8.939588070e-01f, 4.481492043e-01f},
+    {-8.910065293e-01f, 4.539904892e-01f},
+    {-8.880161047e-01f, 4.598123729e-01f},
+    {-8.849876523e-01f, 4.656145275e-01f},
+    {-8.819212914e-01f, 4.713967443e-01f},
+    {-8.788171411e-01f, 4.771587551e-01f},
+    {-8.756753206e-01f, 4.829003513e-01f},
+    {-8.724960089e-01f, 4.886212349e-01f},
+    {-8.692793250e-01f, 4.943211973e-01f},
+    {-8.660253882e-01f, 5.000000000e-01f},
+    {-8.627343774e-01f, 5.056573749e-01f},
+    {-8.594064116e-01f, 5.112931132e-01f},
+    {-8.560416102e-01f, 5.169069171e-01f},
+    {-8.526401520e-01f, 5.224985480e-01f},
+    {-8.492021561e-01f, 5.280678272e-01f},
+    {-8.457278013e-01f, 5.336145163e-01f},
+    {-8.422172070e-01f, 5.391383171e-01f},
+    {-8.386705518e-01f, 5.446390510e-01f},
+    {-8.350879550e-01f, 5.501164198e-01f},
+    {-8.314695954e-01f, 5.555702448e-01f},
+    {-8.278156519e-01f, 5.610002279e-01f},
+    {-8.241261840e-01f, 5.664062500e-01f},
+    {-8.204014301e-01f, 5.717879534e-01f},
+    {-8.166415691e-01f, 5.771452188e-01f},
+    {-8.128466606e-01f, 5.824776888e-01f},
+    {-8.090170026e-01f, 5.877852440e-01f},
+    {-8.051526546e-01f, 5.930676460e-01f},
+    {-8.012537956e-01f, 5.983245969e-01f},
+    {-7.973206639e-01f, 6.035559177e-01f},
+    {-7.933533192e-01f, 6.087614298e-01f},
+    {-7.893520594e-01f, 6.139408350e-01f},
+    {-7.853169441e-01f, 6.190939546e-01f},
+    {-7.812481523e-01f, 6.242205501e-01f},
+    {-7.771459818e-01f, 6.293203831e-01f},
+    {-7.730104327e-01f, 6.343932748e-01f},
+    {-7.688418031e-01f, 6.394389868e-01f},
+    {-7.646402717e-01f, 6.444573402e-01f},
+    {-7.604059577e-01f, 6.494480371e-01f},
+    {-7.561390996e-01f, 6.544109583e-01f},
+    {-7.518398166e-01f, 6.593458056e-01f},
+    {-7.475083470e-01f, 6.642524600e-01f},
+    {-7.431448102e-01f, 6.691306233e-01f},
+    {-7.387495041e-01f, 6.739801168e-01f},
+    {-7.343224883e-01f, 6.788007617e-01f},
+    {-7.298640609e-01f, 6.835923195e-01f},
+    {-7.253744006e-01f, 6.883545518e-01f},
+    {-7.208535671e-01f, 6.930873394e-01f},
+    {-7.163019180e-01f, 6.977904439e-01f},
+    {-7.117196321e-01f, 7.024636865e-01f},
+    {-7.071067691e-01f, 7.071067691e-01f},
+    {-7.024636865e-01f, 7.117196321e-01f},
+    {-6.977904439e-01f, 7.163019180e-01f},
+    {-6.930873394e-01f, 7.208535671e-01f},
+    {-6.883545518e-01f, 7.253744006e-01f},
+    {-6.835923195e-01f, 7.298640609e-01f},
+    {-6.788007617e-01f, 7.343224883e-01f},
+    {-6.739801168e-01f, 7.387495041e-01f},
+    {-6.691306233e-01f, 7.431448102e-01f},
+    {-6.642524600e-01f, 7.475083470e-01f},
+    {-6.593458056e-01f, 7.518398166e-01f},
+    {-6.544109583e-01f, 7.561390996e-01f},
+    {-6.494480371e-01f, 7.604059577e-01f},
+    {-6.444573402e-01f, 7.646402717e-01f},
+    {-6.394389868e-01f, 7.688418031e-01f},
+    {-6.343932748e-01f, 7.730104327e-01f},
+    {-6.293203831e-01f, 7.771459818e-01f},
+    {-6.242205501e-01f, 7.812481523e-01f},
+    {-6.190939546e-01f, 7.853169441e-01f},
+    {-6.139408350e-01f, 7.893520594e-01f},
+    {-6.087614298e-01f, 7.933533192e-01f},
+    {-6.035559177e-01f, 7.973206639e-01f},
+    {-5.983245969e-01f, 8.012537956e-01f},
+    {-5.930676460e-01f, 8.051526546e-01f},
+    {-5.877852440e-01f, 8.090170026e-01f},
+    {-5.824776888e-01f, 8.128466606e-01f},
+    {-5.771452188e-01f, 8.166415691e-01f},
+    {-5.717879534e-01f, 8.204014301e-01f},
+    {-5.664062500e-01f, 8.241261840e-01f},
+    {-5.610002279e-01f, 8.278156519e-01f},
+    {-5.555702448e-01f, 8.314695954e-01f},
+    {-5.501164198e-01f, 8.350879550e-01f},
+    {-5.446390510e-01f, 8.386705518e-01f},
+    {-5.391383171e-01f, 8.422172070e-01f},
+    {-5.336145163e-01f, 8.457278013e-01f},
+    {-5.280678272e-01f, 8.492021561e-01f},
+    {-5.224985480e-01f, 8.526401520e-01f},
+    {-5.169069171e-01f, 8.560416102e-01f},
+    {-5.112931132e-01f, 8.594064116e-01f},
+    {-5.056573749e-01f, 8.627343774e-01f},
+    {-5.000000000e-01f, 8.660253882e-01f},
+    {-4.943211973e-01f, 8.692793250e-01f},
+    {-4.886212349e-01f, 8.724960089e-01f},
+    {-4.829003513e-01f, 8.756753206e-01f},
+    {-4.771587551e-01f, 8.788171411e-01f},
+    {-4.713967443e-01f, 8.819212914e-01f},
+    {-4.656145275e-01f, 8.849876523e-01f},
+    {-4.598123729e-01f, 8.880161047e-01f},
+    {-4.539904892e-01f, 8.910065293e-01f},
+    {-4.481492043e-01f, 8.939588070e-01f},
+    {-4.422886968e-01f, 8.968727589e-01f},
+    {-4.364092350e-01f, 8.997482657e-01f},
+    {-4.305110872e-01f, 9.025852680e-01f},
+    {-4.245945215e-01f, 9.053836465e-01f},
+    {-4.186597466e-01f, 9.081431627e-01f},
+    {-4.127070308e-01f, 9.108638167e-01f},
+    {-4.067366421e-01f, 9.135454297e-01f},
+    {-4.007488191e-01f, 9.161879420e-01f},
+    {-3.947438598e-01f, 9.187912345e-01f},
+    {-3.887219727e-01f, 9.213551283e-01f},
+    {-3.826834261e-01f, 9.238795042e-01f},
+    {-3.766284883e-01f, 9.263643622e-01f},
+    {-3.705574274e-01f, 9.288095236e-01f},
+    {-3.644705117e-01f, 9.312149286e-01f},
+    {-3.583679497e-01f, 9.335803986e-01f},
+    {-3.522500396e-01f, 9.359059334e-01f},
+    {-3.461170495e-01f, 9.381913543e-01f},
+    {-3.399692476e-01f, 9.404365420e-01f},
+    {-3.338068724e-01f, 9.426414967e-01f},
+    {-3.276301920e-01f, 9.448060393e-01f},
+    {-3.214394748e-01f, 9.469301105e-01f},
+    {-3.152349889e-01f, 9.490136504e-01f},
+    {-3.090170026e-01f, 9.510565400e-01f},
+    {-3.027857840e-01f, 9.530586600e-01f},
+    {-2.965415716e-01f, 9.550199509e-01f},
+    {-2.902846634e-01f, 9.569403529e-01f},
+    {-2.840153575e-01f, 9.588197470e-01f},
+    {-2.777338326e-01f, 9.606580734e-01f},
+    {-2.714404464e-01f, 9.624552131e-01f},
+    {-2.651354373e-01f, 9.642111659e-01f},
+    {-2.588190436e-01f, 9.659258127e-01f},
+    {-2.524915636e-01f, 9.675990939e-01f},
+    {-2.461532950e-01f, 9.692308903e-01f},
+    {-2.398044616e-01f, 9.708212018e-01f},
+    {-2.334453613e-01f, 9.723699093e-01f},
+    {-2.270762622e-01f, 9.738769531e-01f},
+    {-2.206974328e-01f, 9.753423333e-01f},
+    {-2.143091559e-01f, 9.767658710e-01f},
+    {-2.079116851e-01f, 9.781476259e-01f},
+    {-2.015053183e-01f, 9.794874191e-01f},
+    {-1.950903237e-01f, 9.807852507e-01f},
+    {-1.886669695e-01f, 9.820411205e-01f},
+    {-1.822355241e-01f, 9.832549095e-01f},
+    {-1.757962853e-01f, 9.844265580e-01f},
+    {-1.693495065e-01f, 9.855560660e-01f},
+    {-1.628954709e-01f, 9.866433144e-01f},
+    {-1.564344615e-01f, 9.876883626e-01f},
+    {-1.499667615e-01f, 9.886910319e-01f},
+    {-1.434926242e-01f, 9.896513820e-01f},
+    {-1.370123476e-01f, 9.905693531e-01f},
+    {-1.305261850e-01f, 9.914448857e-01f},
+    {-1.240344495e-01f, 9.922779202e-01f},
+    {-1.175373942e-01f, 9.930684566e-01f},
+    {-1.110353097e-01f, 9.938164353e-01f},
+    {-1.045284644e-01f, 9.945219159e-01f},
+    {-9.801714122e-02f, 9.951847196e-01f},
+    {-9.150161594e-02f, 9.958049059e-01f},
+    {-8.498217911e-02f, 9.963824749e-01f},
+    {-7.845909894e-02f, 9.969173074e-01f},
+    {-7.193265110e-02f, 9.974094629e-01f},
+    {-6.540312618e-02f, 9.978589416e-01f},
+    {-5.887080356e-02f, 9.982656240e-01f},
+    {-5.233595520e-02f, 9.986295104e-01f},
+    {-4.579886794e-02f, 9.989506602e-01f},
+    {-3.925981745e-02f, 9.992290139e-01f},
+    {-3.271908313e-02f, 9.994645715e-01f},
+    {-2.617694810e-02f, 9.996573329e-01f},
+    {-1.963369176e-02f, 9.998072386e-01f},
+    {-1.308959536e-02f, 9.999143481e-01f},
+    {-6.544937845e-03f, 9.999786019e-01f},
+    {-1.836970147e-16f, 1.000000000e+00f},
+    {6.544937845e-03f, 9.999786019e-01f},
+    {1.308959536e-02f, 9.999143481e-01f},
+    {1.963369176e-02f, 9.998072386e-01f},
+    {2.617694810e-02f, 9.996573329e-01f},
+    {3.271908313e-02f, 9.994645715e-01f},
+    {3.925981745e-02f, 9.992290139e-01f},
+    {4.579886794e-02f, 9.989506602e-01f},
+    {5.233595520e-02f, 9.986295104e-01f},
+    {5.887080356e-02f, 9.982656240e-01f},
+    {6.540312618e-02f, 9.978589416e-01f},
+    {7.193265110e-02f, 9.974094629e-01f},
+    {7.845909894e-02f, 9.969173074e-01f},
+    {8.498217911e-02f, 9.963824749e-01f},
+    {9.150161594e-02f, 9.958049059e-01f},
+    {9.801714122e-02f, 9.951847196e-01f},
+    {1.045284644e-01f, 9.945219159e-01f},
+    {1.110353097e-01f, 9.938164353e-01f},
+    {1.175373942e-01f, 9.930684566e-01f},
+    {1.240344495e-01f, 9.922779202e-01f},
+    {1.305261850e-01f, 9.914448857e-01f},
+    {1.370123476e-01f, 9.905693531e-01f},
+    {1.434926242e-01f, 9.896513820e-01f},
+    {1.499667615e-01f, 9.886910319e-01f},
+    {1.564344615e-01f, 9.876883626e-01f},
+    {1.628954709e-01f, 9.866433144e-01f},
+    {1.693495065e-01f, 9.855560660e-01f},
+    {1.757962853e-01f, 9.844265580e-01f},
+    {1.822355241e-01f, 9.832549095e-01f},
+    {1.886669695e-01f, 9.820411205e-01f},
+    {1.950903237e-01f, 9.807852507e-01f},
+    {2.015053183e-01f, 9.794874191e-01f},
+    {2.079116851e-01f, 9.781476259e-01f},
+    {2.143091559e-01f, 9.767658710e-01f},
+    {2.206974328e-01f, 9.753423333e-01f},
+    {2.270762622e-01f, 9.738769531e-01f},
+    {2.334453613e-01f, 9.723699093e-01f},
+    {2.398044616e-01f, 9.708212018e-01f},
+    {2.461532950e-01f, 9.692308903e-01f},
+    {2.524915636e-01f, 9.675990939e-01f},
+    {2.588190436e-01f, 9.659258127e-01f},
+    {2.651354373e-01f, 9.642111659e-01f},
+    {2.714404464e-01f, 9.624552131e-01f},
+    {2.777338326e-01f, 9.606580734e-01f},
+    {2.840153575e-01f, 9.588197470e-01f},
+    {2.902846634e-01f, 9.569403529e-01f},
+    {2.965415716e-01f, 9.550199509e-01f},
+    {3.027857840e-01f, 9.530586600e-01f},
+    {3.090170026e-01f, 9.510565400e-01f},
+    {3.152349889e-01f, 9.490136504e-01f},
+    {3.214394748e-01f, 9.469301105e-01f},
+    {3.276301920e-01f, 9.448060393e-01f},
+    {3.338068724e-01f, 9.426414967e-01f},
+    {3.399692476e-01f, 9.404365420e-01f},
+    {3.461170495e-01f, 9.381913543e-01f},
+    {3.522500396e-01f, 9.359059334e-01f},
+    {3.583679497e-01f, 9.335803986e-01f},
+    {3.644705117e-01f, 9.312149286e-01f},
+    {3.705574274e-01f, 9.288095236e-01f},
+    {3.766284883e-01f, 9.263643622e-01f},
+    {3.826834261e-01f, 9.238795042e-01f},
+    {3.887219727e-01f, 9.213551283e-01f},
+    {3.947438598e-01f, 9.187912345e-01f},
+    {4.007488191e-01f, 9.161879420e-01f},
+    {4.067366421e-01f, 9.135454297e-01f},
+    {4.127070308e-01f, 9.108638167e-01f},
+    {4.186597466e-01f, 9.081431627e-01f},
+    {4.245945215e-01f, 9.053836465e-01f},
+    {4.305110872e-01f, 9.025852680e-01f},
+    {4.364092350e-01f, 8.997482657e-01f},
+    {4.422886968e-01f, 8.968727589e-01f},
+    {4.481492043e-01f, 8.939588070e-01f},
+    {4.539904892e-01f, 8.910065293e-01f},
+    {4.598123729e-01f, 8.880161047e-01f},
+    {4.656145275e-01f, 8.849876523e-01f},
+    {4.713967443e-01f, 8.819212914e-01f},
+    {4.771587551e-01f, 8.788171411e-01f},
+    {4.829003513e-01f, 8.756753206e-01f},
+    {4.886212349e-01f, 8.724960089e-01f},
+    {4.943211973e-01f, 8.692793250e-01f},
+    {5.000000000e-01f, 8.660253882e-01f},
+    {5.056573749e-01f, 8.627343774e-01f},
+    {5.112931132e-01f, 8.594064116e-01f},
+    {5.169069171e-01f, 8.560416102e-01f},
+    {5.224985480e-01f, 8.526401520e-01f},
+    {5.280678272e-01f, 8.492021561e-01f},
+    {5.336145163e-01f, 8.457278013e-01f},
+    {5.391383171e-01f, 8.422172070e-01f},
+    {5.446390510e-01f, 8.386705518e-01f},
+    {5.501164198e-01f, 8.350879550e-01f},
+    {5.555702448e-01f, 8.314695954e-01f},
+    {5.610002279e-01f, 8.278156519e-01f},
+    {5.664062500e-01f, 8.241261840e-01f},
+    {5.717879534e-01f, 8.204014301e-01f},
+    {5.771452188e-01f, 8.166415691e-01f},
+    {5.824776888e-01f, 8.128466606e-01f},
+    {5.877852440e-01f, 8.090170026e-01f},
+    {5.930676460e-01f, 8.051526546e-01f},
+    {5.983245969e-01f, 8.012537956e-01f},
+    {6.035559177e-01f, 7.973206639e-01f},
+    {6.087614298e-01f, 7.933533192e-01f},
+    {6.139408350e-01f, 7.893520594e-01f},
+    {6.190939546e-01f, 7.853169441e-01f},
+    {6.242205501e-01f, 7.812481523e-01f},
+    {6.293203831e-01f, 7.771459818e-01f},
+    {6.343932748e-01f, 7.730104327e-01f},
+    {6.394389868e-01f, 7.688418031e-01f},
+    {6.444573402e-01f, 7.646402717e-01f},
+    {6.494480371e-01f, 7.604059577e-01f},
+    {6.544109583e-01f, 7.561390996e-01f},
+    {6.593458056e-01f, 7.518398166e-01f},
+    {6.642524600e-01f, 7.475083470e-01f},
+    {6.691306233e-01f, 7.431448102e-01f},
+    {6.739801168e-01f, 7.387495041e-01f},
+    {6.788007617e-01f, 7.343224883e-01f},
+    {6.835923195e-01f, 7.298640609e-01f},
+    {6.883545518e-01f, 7.253744006e-01f},
+    {6.930873394e-01f, 7.208535671e-01f},
+    {6.977904439e-01f, 7.163019180e-01f},
+    {7.024636865e-01f, 7.117196321e-01f},
+    {7.071067691e-01f, 7.071067691e-01f},
+    {7.117196321e-01f, 7.024636865e-01f},
+    {7.163019180e-01f, 6.977904439e-01f},
+    {7.208535671e-01f, 6.930873394e-01f},
+    {7.253744006e-01f, 6.883545518e-01f},
+    {7.298640609e-01f, 6.835923195e-01f},
+    {7.343224883e-01f, 6.788007617e-01f},
+    {7.387495041e-01f, 6.739801168e-01f},
+    {7.431448102e-01f, 6.691306233e-01f},
+    {7.475083470e-01f, 6.642524600e-01f},
+    {7.518398166e-01f, 6.593458056e-01f},
+    {7.561390996e-01f, 6.544109583e-01f},
+    {7.604059577e-01f, 6.494480371e-01f},
+    {7.646402717e-01f, 6.444573402e-01f},
+    {7.688418031e-01f, 6.394389868e-01f},
+    {7.730104327e-01f, 6.343932748e-01f},
+    {7.771459818e-01f, 6.293203831e-01f},
+    {7.812481523e-01f, 6.242205501e-01f},
+    {7.853169441e-01f, 6.190939546e-01f},
+    {7.893520594e-01f, 6.139408350e-01f},
+    {7.933533192e-01f, 6.087614298e-01f},
+    {7.973206639e-01f, 6.035559177e-01f},
+    {8.012537956e-01f, 5.983245969e-01f},
+    {8.051526546e-01f, 5.930676460e-01f},
+    {8.090170026e-01f, 5.877852440e-01f},
+    {8.128466606e-01f, 5.824776888e-01f},
+    {8.166415691e-01f, 5.771452188e-01f},
+    {8.204014301e-01f, 5.717879534e-01f},
+    {8.241261840e-01f, 5.664062500e-01f},
+    {8.278156519e-01f, 5.610002279e-01f},
+    {8.314695954e-01f, 5.555702448e-01f},
+    {8.350879550e-01f, 5.501164198e-01f},
+    {8.386705518e-01f, 5.446390510e-01f},
+    {8.422172070e-01f, 5.391383171e-01f},
+    {8.457278013e-01f, 5.336145163e-01f},
+    {8.492021561e-01f, 5.280678272e-01f},
+    {8.526401520e-01f, 5.224985480e-01f},
+    {8.560416102e-01f, 5.169069171e-01f},
+    {8.594064116e-01f, 5.112931132e-01f},
+    {8.627343774e-01f, 5.056573749e-01f},
+    {8.660253882e-01f, 5.000000000e-01f},
+    {8.692793250e-01f, 4.943211973e-01f},
+    {8.724960089e-01f, 4.886212349e-01f},
+    {8.756753206e-01f, 4.829003513e-01f},
+    {8.788171411e-01f, 4.771587551e-01f},
+    {8.819212914e-01f, 4.713967443e-01f},
+    {8.849876523e-01f, 4.656145275e-01f},
+    {8.880161047e-01f, 4.598123729e-01f},
+    {8.910065293e-01f, 4.539904892e-01f},
+    {8.939588070e-01f, 4.481492043e-01f},
+    {8.968727589e-01f, 4.422886968e-01f},
+    {8.997482657e-01f, 4.364092350e-01f},
+    {9.025852680e-01f, 4.305110872e-01f},
+    {9.053836465e-01f, 4.245945215e-01f},
+    {9.081431627e-01f, 4.186597466e-01f},
+    {9.108638167e-01f, 4.127070308e-01f},
+    {9.135454297e-01f, 4.067366421e-01f},
+    {9.161879420e-01f, 4.007488191e-01f},
+    {9.187912345e-01f, 3.947438598e-01f},
+    {9.213551283e-01f, 3.887219727e-01f},
+    {9.238795042e-01f, 3.826834261e-01f},
+    {9.263643622e-01f, 3.766284883e-01f},
+    {9.288095236e-01f, 3.705574274e-01f},
+    {9.312149286e-01f, 3.644705117e-01f},
+    {9.335803986e-01f, 3.583679497e-01f},
+    {9.359059334e-01f, 3.522500396e-01f},
+    {9.381913543e-01f, 3.461170495e-01f},
+    {9.404365420e-01f, 3.399692476e-01f},
+    {9.426414967e-01f, 3.338068724e-01f},
+    {9.448060393e-01f, 3.276301920e-01f},
+    {9.469301105e-01f, 3.214394748e-01f},
+    {9.490136504e-01f, 3.152349889e-01f},
+    {9.510565400e-01f, 3.090170026e-01f},
+    {9.530586600e-01f, 3.027857840e-01f},
+    {9.550199509e-01f, 2.965415716e-01f},
+    {9.569403529e-01f, 2.902846634e-01f},
+    {9.588197470e-01f, 2.840153575e-01f},
+    {9.606580734e-01f, 2.777338326e-01f},
+    {9.624552131e-01f, 2.714404464e-01f},
+    {9.642111659e-01f, 2.651354373e-01f},
+    {9.659258127e-01f, 2.588190436e-01f},
+    {9.675990939e-01f, 2.524915636e-01f},
+    {9.692308903e-01f, 2.461532950e-01f},
+    {9.708212018e-01f, 2.398044616e-01f},
+    {9.723699093e-01f, 2.334453613e-01f},
+    {9.738769531e-01f, 2.270762622e-01f},
+    {9.753423333e-01f, 2.206974328e-01f},
+    {9.767658710e-01f, 2.143091559e-01f},
+    {9.781476259e-01f, 2.079116851e-01f},
+    {9.794874191e-01f, 2.015053183e-01f},
+    {9.807852507e-01f, 1.950903237e-01f},
+    {9.820411205e-01f, 1.886669695e-01f},
+    {9.832549095e-01f, 1.822355241e-01f},
+    {9.844265580e-01f, 1.757962853e-01f},
+    {9.855560660e-01f, 1.693495065e-01f},
+    {9.866433144e-01f, 1.628954709e-01f},
+    {9.876883626e-01f, 1.564344615e-01f},
+    {9.886910319e-01f, 1.499667615e-01f},
+    {9.896513820e-01f, 1.434926242e-01f},
+    {9.905693531e-01f, 1.370123476e-01f},
+    {9.914448857e-01f, 1.305261850e-01f},
+    {9.922779202e-01f, 1.240344495e-01f},
+    {9.930684566e-01f, 1.175373942e-01f},
+    {9.938164353e-01f, 1.110353097e-01f},
+    {9.945219159e-01f, 1.045284644e-01f},
+    {9.951847196e-01f, 9.801714122e-02f},
+    {9.958049059e-01f, 9.150161594e-02f},
+    {9.963824749e-01f, 8.498217911e-02f},
+    {9.969173074e-01f, 7.845909894e-02f},
+    {9.974094629e-01f, 7.193265110e-02f},
+    {9.978589416e-01f, 6.540312618e-02f},
+    {9.982656240e-01f, 5.887080356e-02f},
+    {9.986295104e-01f, 5.233595520e-02f},
+    {9.989506602e-01f, 4.579886794e-02f},
+    {9.992290139e-01f, 3.925981745e-02f},
+    {9.994645715e-01f, 3.271908313e-02f},
+    {9.996573329e-01f, 2.617694810e-02f},
+    {9.998072386e-01f, 1.963369176e-02f},
+    {9.999143481e-01f, 1.308959536e-02f},
+    {9.999786019e-01f, 6.544937845e-03f},
+};
+
+static const opus_int16 fft_bitrev[960] = {
+    0, 192, 384, 576, 768, 64, 256, 448, 640, 832, 128, 320,
+    512, 704, 896, 16, 208, 400, 592, 784, 80, 272, 464, 656,
+    848, 144, 336, 528, 720, 912, 32, 224, 416, 608, 800, 96,
+    288, 480, 672, 864, 160, 352, 544, 736, 928, 48, 240, 432,
+    624, 816, 112, 304, 496, 688, 880, 176, 368, 560, 752, 944,
+    4, 196, 388, 580, 772, 68, 260, 452, 644, 836, 132, 324,
+    516, 708, 900, 20, 212, 404, 596, 788, 84, 276, 468, 660,
+    852, 148, 340, 532, 724, 916, 36, 228, 420, 612, 804, 100,
+    292, 484, 676, 868, 164, 356, 548, 740, 932, 52, 244, 436,
+    628, 820, 116, 308, 500, 692, 884, 180, 372, 564, 756, 948,
+    8, 200, 392, 584, 776, 72, 264, 456, 648, 840, 136, 328,
+    520, 712, 904, 24, 216, 408, 600, 792, 88, 280, 472, 664,
+    856, 152, 344, 536, 728, 920, 40, 232, 424, 616, 808, 104,
+    296, 488, 680, 872, 168, 360, 552, 744, 936, 56, 248, 440,
+    632, 824, 120, 312, 504, 696, 888, 184, 376, 568, 760, 952,
+    12, 204, 396, 588, 780, 76, 268, 460, 652, 844, 140, 332,
+    524, 716, 908, 28, 220, 412, 604, 796, 92, 284, 476, 668,
+    860, 156, 348, 540, 732, 924, 44, 236, 428, 620, 812, 108,
+    300, 492, 684, 876, 172, 364, 556, 748, 940, 60, 252, 444,
+    636, 828, 124, 316, 508, 700, 892, 188, 380, 572, 764, 956,
+    1, 193, 385, 577, 769, 65, 257, 449, 641, 833, 129, 321,
+    513, 705, 897, 17, 209, 401, 593, 785, 81, 273, 465, 657,
+    849, 145, 337, 529, 721, 913, 33, 225, 417, 609, 801, 97,
+    289, 481, 673, 865, 161, 353, 545, 737, 929, 49, 241, 433,
+    625, 817, 113, 305, 497, 689, 881, 177, 369, 561, 753, 945,
+    5, 197, 389, 581, 773, 69, 261, 453, 645, 837, 133, 325,
+    517, 709, 901, 21, 213, 405, 597, 789, 85, 277, 469, 661,
+    853, 149, 341, 533, 725, 917, 37, 229, 421, 613, 805, 101,
+    293, 485, 677, 869, 165, 357, 549, 741, 933, 53, 245, 437,
+    629, 821, 117, 309, 501, 693, 885, 181, 373, 565, 757, 949,
+    9, 201, 393, 585, 777, 73, 265, 457, 649, 841, 137, 329,
+    521, 713, 905, 25, 217, 409, 601, 793, 89, 281, 473, 665,
+    857, 153, 345, 537, 729, 921, 41, 233, 425, 617, 809, 105,
+    297, 489, 681, 873, 169, 361, 553, 745, 937, 57, 249, 441,
+    633, 825, 121, 313, 505, 697, 889, 185, 377, 569, 761, 953,
+    13, 205, 397, 589, 781, 77, 269, 461, 653, 845, 141, 333,
+    525, 717, 909, 29, 221, 413, 605, 797, 93, 285, 477, 669,
+    861, 157, 349, 541, 733, 925, 45, 237, 429, 621, 813, 109,
+    301, 493, 685, 877, 173, 365, 557, 749, 941, 61, 253, 445,
+    637, 829, 125, 317, 509, 701, 893, 189, 381, 573, 765, 957,
+    2, 194, 386, 578, 770, 66, 258, 450, 642, 834, 130, 322,
+    514, 706, 898, 18, 210, 402, 594, 786, 82, 274, 466, 658,
+    850, 146, 338, 530, 722, 914, 34, 226, 418, 610, 802, 98,
+    290, 482, 674, 866, 162, 354, 546, 738, 930, 50, 242, 434,
+    626, 818, 114, 306, 498, 690, 882, 178, 370, 562, 754, 946,
+    6, 198, 390, 582, 774, 70, 262, 454, 646, 838, 134, 326,
+    518, 710, 902, 22, 214, 406, 598, 790, 86, 278, 470, 662,
+    854, 150, 342, 534, 726, 918, 38, 230, 422, 614, 806, 102,
+    294, 486, 678, 870, 166, 358, 550, 742, 934, 54, 246, 438,
+    630, 822, 118, 310, 502, 694, 886, 182, 374, 566, 758, 950,
+    10, 202, 394, 586, 778, 74, 266, 458, 650, 842, 138, 330,
+    522, 714, 906, 26, 218, 410, 602, 794, 90, 282, 474, 666,
+    858, 154, 346, 538, 730, 922, 42, 234, 426, 618, 810, 106,
+    298, 490, 682, 874, 170, 362, 554, 746, 938, 58, 250, 442,
+    634, 826, 122, 314, 506, 698, 890, 186, 378, 570, 762, 954,
+    14, 206, 398, 590, 782, 78, 270, 462, 654, 846, 142, 334,
+    526, 718, 910, 30, 222, 414, 606, 798, 94, 286, 478, 670,
+    862, 158, 350, 542, 734, 926, 46, 238, 430, 622, 814, 110,
+    302, 494, 686, 878, 174, 366, 558, 750, 942, 62, 254, 446,
+    638, 830, 126, 318, 510, 702, 894, 190, 382, 574, 766, 958,
+    3, 195, 387, 579, 771, 67, 259, 451, 643, 835, 131, 323,
+    515, 707, 899, 19, 211, 403, 595, 787, 83, 275, 467, 659,
+    851, 147, 339, 531, 723, 915, 35, 227, 419, 611, 803, 99,
+    291, 483, 675, 867, 163, 355, 547, 739, 931, 51, 243, 435,
+    627, 819, 115, 307, 499, 691, 883, 179, 371, 563, 755, 947,
+    7, 199, 391, 583, 775, 71, 263, 455, 647, 839, 135, 327,
+    519, 711, 903, 23, 215, 407, 599, 791, 87, 279, 471, 663,
+    855, 151, 343, 535, 727, 919, 39, 231, 423, 615, 807, 103,
+    295, 487, 679, 871, 167, 359, 551, 743, 935, 55, 247, 439,
+    631, 823, 119, 311, 503, 695, 887, 183, 375, 567, 759, 951,
+    11, 203, 395, 587, 779, 75, 267, 459, 651, 843, 139, 331,
+    523, 715, 907, 27, 219, 411, 603, 795, 91, 283, 475, 667,
+    859, 155, 347, 539, 731, 923, 43, 235, 427, 619, 811, 107,
+    299, 491, 683, 875, 171, 363, 555, 747, 939, 59, 251, 443,
+    635, 827, 123, 315, 507, 699, 891, 187, 379, 571, 763, 955,
+    15, 207, 399, 591, 783, 79, 271, 463, 655, 847, 143, 335,
+    527, 719, 911, 31, 223, 415, 607, 799, 95, 287, 479, 671,
+    863, 159, 351, 543, 735, 927, 47, 239, 431, 623, 815, 111,
+    303, 495, 687, 879, 175, 367, 559, 751, 943, 63, 255, 447,
+    639, 831, 127, 319, 511, 703, 895, 191, 383, 575, 767, 959,
+};
+
+static const kiss_fft_state fft_state = {
+    .nfft = 960,
+    .scale = 1.041666721e-03f,
+    .shift = -1,
+    .factors = {5, 192, 3, 64, 4, 16, 4, 4, 4, 1, 0, 0, 0, 0, 0, 0},
+    .bitrev = fft_bitrev,
+    .twiddles = fft_twiddles,
+    .arch_fft = NULL,
+};
+
+static const float half_window[480] = {
+    4.205491678e-06f, 3.784915316e-05f, 1.051350409e-04f, 2.060602565e-04f,
+    3.406204924e-04f, 5.088099861e-04f, 7.106214762e-04f, 9.460463189e-04f,
+    1.215074444e-03f, 1.517694211e-03f, 1.853892580e-03f, 2.223655116e-03f,
+    2.626965987e-03f, 3.063807264e-03f, 3.534160554e-03f, 4.038005136e-03f,
+    4.575319588e-03f, 5.146079697e-03f, 5.750261247e-03f, 6.387837231e-03f,
+    7.058780175e-03f, 7.763060275e-03f, 8.500646800e-03f, 9.271507151e-03f,
+    1.007560641e-02f, 1.091291010e-02f, 1.178338006e-02f, 1.268697716e-02f,
+    1.362366136e-02f, 1.459338982e-02f, 1.559611969e-02f, 1.663180441e-02f,
+    1.770039834e-02f, 1.880185306e-02f, 1.993611455e-02f, 2.110313438e-02f,
+    2.230285667e-02f, 2.353522554e-02f, 2.480018511e-02f, 2.609767392e-02f,
+    2.742763422e-02f, 2.878999896e-02f, 3.018470854e-02f, 3.161169216e-02f,
+    3.307088464e-02f, 3.456221148e-02f, 3.608560562e-02f, 3.764098883e-02f,
+    3.922829032e-02f, 4.084742814e-02f, 4.249832407e-02f, 4.418089241e-02f,
+    4.589505494e-02f, 4.764072597e-02f, 4.941781238e-02f, 5.122622848e-02f,
+    5.306587741e-02f, 5.493667349e-02f, 5.683851242e-02f, 5.877130106e-02f,
+    6.073493510e-02f, 6.272931397e-02f, 6.475432962e-02f, 6.680988520e-02f,
+    6.889585406e-02f, 7.101213932e-02f, 7.315862924e-02f, 7.533518970e-02f,
+    7.754171640e-02f, 7.977809012e-02f, 8.204418421e-02f, 8.433986455e-02f,
+    8.666501194e-02f, 8.901949972e-02f, 9.140319377e-02f, 9.381595254e-02f,
+    9.625764191e-02f, 9.872812033e-02f, 1.012272462e-01f, 1.037548780e-01f,
+    1.063108668e-01f, 1.088950634e-01f, 1.115073115e-01f, 1.141474545e-01f,
+    1.168153435e-01f, 1.195108071e-01f, 1.222336888e-01f, 1.249838322e-01f,
+    1.277610511e-01f, 1.305651814e-01f, 1.333960593e-01f, 1.362535059e-01f,
+    1.391373277e-01f, 1.420473605e-01f, 1.449834108e-01f, 1.479452848e-01f,
+    1.509328187e-01f, 1.539458036e-01f, 1.569840312e-01f, 1.600473374e-01f,
+    1.631354839e-01f, 1.662483066e-01f, 1.693855673e-01f, 1.725470722e-01f,
+    1.757325977e-01f, 1.789419502e-01f, 1.821749061e-01f, 1.854312420e-01f,
+    1.887107342e-01f, 1.920131594e-01f, 1.953382939e-01f, 1.986858994e-01f,
+    2.020557523e-01f, 2.054475993e-01f, 2.088612318e-01f, 2.122963816e-01f,
+    2.157528102e-01f, 2.192302793e-01f, 2.227285206e-01f, 2.262473106e-01f,
+    2.297863811e-01f, 2.333454639e-01f, 2.369243056e-01f, 2.405226529e-01f,
+    2.441402376e-01f, 2.477767766e-01f, 2.514320314e-01f, 2.551056743e-01f,
+    2.587974668e-01f, 2.625071406e-01f, 2.662343979e-01f, 2.699789703e-01f,
+    2.737405598e-01f, 2.775188684e-01f, 2.813135982e-01f, 2.851244807e-01f,
+    2.889512181e-01f, 2.927935123e-01f, 2.966510653e-01f, 3.005235493e-01f,
+    3.044106960e-01f, 3.083121777e-01f, 3.122276664e-01f, 3.161568940e-01f,
+    3.200995028e-01f, 3.240552247e-01f, 3.280237019e-01f, 3.320046365e-01f,
+    3.359977007e-01f, 3.400025666e-01f, 3.440189064e-01f, 3.480463922e-01f,
+    3.520847261e-01f, 3.561335206e-01f, 3.601925075e-01f, 3.642612994e-01f,
+    3.683395982e-01f, 3.724270165e-01f, 3.765232861e-01f, 3.806279898e-01f,
+    3.847408593e-01f, 3.888614774e-01f, 3.929895759e-01f, 3.971247375e-01f,
+    4.012666643e-01f, 4.054149687e-01f, 4.095693231e-01f, 4.137293994e-01f,
+    4.178947806e-01f, 4.220651984e-01f, 4.262402356e-01f, 4.304195344e-01f,
+    4.346027672e-01f, 4.387896061e-01f, 4.429796040e-01f, 4.471724927e-01f,
+    4.513678849e-01f, 4.555653930e-01f, 4.597646892e-01f, 4.639654160e-01f,
+    4.681671858e-01f, 4.723696709e-01f, 4.765724838e-01f, 4.807752669e-01f,
+    4.849776626e-01f, 4.891793430e-01f, 4.933798909e-01f, 4.975790083e-01f,
+    5.017762780e-01f, 5.059713721e-01f, 5.101639032e-01f, 5.143535733e-01f,
+    5.185399055e-01f, 5.227227211e-01f, 5.269014835e-01f, 5.310759544e-01f,
+    5.352457166e-01f, 5.394104123e-01f, 5.435697436e-01f, 5.477232933e-01f,
+    5.518707633e-01f, 5.560117364e-01f, 5.601459742e-01f, 5.642729998e-01f,
+    5.683925152e-01f, 5.725042224e-01f, 5.766077042e-01f, 5.807026625e-01f,
+    5.847887397e-01f, 5.888656378e-01f, 5.929329395e-01f, 5.969903469e-01f,
+    6.010375023e-01f, 6.050741673e-01f, 6.090999246e-01f, 6.131144166e-01f,
+    6.171174049e-01f, 6.211085320e-01f, 6.250874400e-01f, 6.290538311e-01f,
+    6.330074072e-01f, 6.369478703e-01f, 6.408748627e-01f, 6.447880864e-01f,
+    6.486872435e-01f, 6.525720358e-01f, 6.564421654e-01f, 6.602973342e-01f,
+    6.641371846e-01f, 6.679615378e-01f, 6.717699766e-01f, 6.755623221e-01f,
+    6.793382764e-01f, 6.830974817e-01f, 6.868397593e-01f, 6.905647516e-01f,
+    6.942722797e-01f, 6.979619861e-01f, 7.016336918e-01f, 7.052870393e-01f,
+    7.089218497e-01f, 7.125378847e-01f, 7.161347866e-01f, 7.197124362e-01f,
+    7.232705355e-01f, 7.268089056e-01f, 7.303271890e-01f, 7.338252664e-01f,
+    7.373028994e-01f, 7.407597899e-01f, 7.441958189e-01f, 7.476106882e-01f,
+    7.510042787e-01f, 7.543763518e-01f, 7.577266693e-01f, 7.610551119e-01f,
+    7.643613815e-01f, 7.676453590e-01f, 7.709068656e-01f, 7.741457224e-01f,
+    7.773617506e-01f, 7.805547714e-01f, 7.837246060e-01f, 7.868710756e-01f,
+    7.899941206e-01f, 7.930935025e-01f, 7.961691022e-01f, 7.992208004e-01f,
+    8.022484183e-01f, 8.052518368e-01f, 8.082309365e-01f, 8.111855984e-01f,
+    8.141157031e-01f, 8.170211315e-01f, 8.199017644e-01f, 8.227575421e-01f,
+    8.255882859e-01f, 8.283939362e-01f, 8.311744332e-01f, 8.339296579e-01f,
+    8.366595507e-01f, 8.393639922e-01f, 8.420429826e-01f, 8.446964025e-01f,
+    8.473242521e-01f, 8.499263525e-01f, 8.525027633e-01f, 8.550534248e-01f,
+    8.575782180e-01f, 8.600772023e-01f, 8.625502586e-01f, 8.649974465e-01f,
+    8.674186468e-01f, 8.698139191e-01f, 8.721832037e-01f, 8.745265603e-01f,
+    8.768438697e-01f, 8.791351914e-01f, 8.814005256e-01f, 8.836399317e-01f,
+    8.858532906e-01f, 8.880407810e-01f, 8.902023435e-01f, 8.923379779e-01f,
+    8.944477439e-01f, 8.965317011e-01f, 8.985898495e-01f, 9.006222486e-01f,
+    9.026289582e-01f, 9.046100378e-01f, 9.065654874e-01f, 9.084954262e-01f,
+    9.103999138e-01f, 9.122790098e-01f, 9.141327739e-01f, 9.159612656e-01f,
+    9.177646637e-01f, 9.195429087e-01f, 9.212962389e-01f, 9.230246544e-01f,
+    9.247282147e-01f, 9.264071584e-01f, 9.280614853e-01f, 9.296913147e-01f,
+    9.312967658e-01f, 9.328780174e-01f, 9.344350696e-01f, 9.359681606e-01f,
+    9.374772906e-01f, 9.389626980e-01f, 9.404245019e-01f, 9.418628216e-01f,
+    9.432777762e-01f, 9.446694851e-01f, 9.460381866e-01f, 9.473839402e-01f,
+    9.487069249e-01f, 9.500073195e-01f, 9.512852430e-01f, 9.525408745e-01f,
+    9.537743926e-01f, 9.549859166e-01f, 9.561756849e-01f, 9.573438168e-01f,
+    9.584904909e-01f, 9.596158862e-01f, 9.607201815e-01f, 9.618035555e-01f,
+    9.628662467e-01f, 9.639083147e-01f, 9.649300575e-01f, 9.659315944e-01f,
+    9.669131637e-01f, 9.678749442e-01f, 9.688171744e-01f, 9.697399139e-01f,
+    9.706435204e-01f, 9.715281129e-01f, 9.723938704e-01f, 9.732410908e-01f,
+    9.740698934e-01f, 9.748805165e-01f, 9.756731391e-01f, 9.764479995e-01f,
+    9.772053361e-01f, 9.779452682e-01f, 9.786680937e-01f, 9.793740511e-01f,
+    9.800632000e-01f, 9.807358980e-01f, 9.813923240e-01f, 9.820327163e-01f,
+    9.826572537e-01f, 9.832661152e-01f, 9.838596582e-01f, 9.844379425e-01f,
+    9.850012660e-01f, 9.855498672e-01f, 9.860839248e-01f, 9.866036773e-01f,
+    9.871093631e-01f, 9.876011610e-01f, 9.880793095e-01f, 9.885440469e-01f,
+    9.889955521e-01f, 9.894340634e-01f, 9.898598790e-01f, 9.902731180e-01f,
+    9.906740189e-01f, 9.910628200e-01f, 9.914397001e-01f, 9.918049574e-01f,
+    9.921587706e-01f, 9.925013185e-01f, 9.928328991e-01f, 9.931536317e-01f,
+    9.934638143e-01f, 9.937636256e-01f, 9.940532446e-01f, 9.943329692e-01f,
+    9.946029186e-01f, 9.948633313e-01f, 9.951144457e-01f, 9.953564405e-01f,
+    9.955895543e-01f, 9.958139658e-01f, 9.960298538e-01f, 9.962375164e-01f,
+    9.964370728e-01f, 9.966287017e-01f, 9.968126416e-01f, 9.969891310e-01f,
+    9.971582890e-01f, 9.973202944e-01f, 9.974754453e-01f, 9.976238608e-01f,
+    9.977657199e-01f, 9.979012609e-01f, 9.980306029e-01f, 9.981539249e-01f,
+    9.982714653e-01f, 9.983834028e-01f, 9.984898567e-01f, 9.985910058e-01f,
+    9.986870885e-01f, 9.987781644e-01f, 9.988645315e-01f, 9.989462495e-01f,
+    9.990235567e-01f, 9.990965128e-01f, 9.991654158e-01f, 9.992302656e-01f,
+    9.992913008e-01f, 9.993487000e-01f, 9.994025230e-01f, 9.994530082e-01f,
+    9.995002151e-01f, 9.995443225e-01f, 9.995855093e-01f, 9.996237755e-01f,
+    9.996594191e-01f, 9.996924400e-01f, 9.997230172e-01f, 9.997512698e-01f,
+    9.997773170e-01f, 9.998012781e-01f, 9.998232126e-01f, 9.998433590e-01f,
+    9.998616576e-01f, 9.998783469e-01f, 9.998934865e-01f, 9.999071956e-01f,
+    9.999195337e-01f, 9.999305606e-01f, 9.999404550e-01f, 9.999492168e-01f,
+    9.999570251e-01f, 9.999638796e-01f, 9.999698400e-01f, 9.999750853e-01f,
+    9.999796152e-01f, 9.999834895e-01f, 9.999867678e-01f, 9.999895096e-01f,
+    9.999918342e-01f, 9.999937415e-01f, 9.999952912e-01f, 9.999965429e-01f,
+    9.999975562e-01f, 9.999982715e-01f, 9.999988675e-01f, 9.999992847e-01f,
+    9.999995232e-01f, 9.999997616e-01f, 9.999998808e-01f, 9.999999404e-01f,
+    1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+};
+
+static const float dct_table[484] = {
+    7.071067691e-01f, 9.974521399e-01f, 9.898214340e-01f, 9.771468639e-01f,
+    9.594929814e-01f, 9.369497299e-01f, 9.096319675e-01f, 8.776789904e-01f,
+    8.412535191e-01f, 8.005412221e-01f, 7.557495832e-01f, 7.071067691e-01f,
+    6.548607349e-01f, 5.992776752e-01f, 5.406408310e-01f, 4.792490005e-01f,
+    4.154150188e-01f, 3.494641781e-01f, 2.817325592e-01f, 2.125652879e-01f,
+    1.423148364e-01f, 7.133918256e-02f, 7.071067691e-01f, 9.771468639e-01f,
+    9.096319675e-01f, 8.005412221e-01f, 6.548607349e-01f, 4.792490005e-01f,
+    2.817325592e-01f, 7.133918256e-02f, -1.423148364e-01f, -3.494641781e-01f,
+    -5.406408310e-01f, -7.071067691e-01f, -8.412535191e-01f, -9.369497299e-01f,
+    -9.898214340e-01f, -9.974521399e-01f, -9.594929814e-01f, -8.776789904e-01f,
+    -7.557495832e-01f, -5.992776752e-01f, -4.154150188e-01f, -2.125652879e-01f,
+    7.071067691e-01f, 9.369497299e-01f, 7.557495832e-01f, 4.792490005e-01f,
+    1.423148364e-01f, -2.125652879e-01f, -5.406408310e-01f, -8.005412221e-01f,
+    -9.594929814e-01f, -9.974521399e-01f, -9.096319675e-01f, -7.071067691e-01f,
+    -4.154150188e-01f, -7.133918256e-02f, 2.817325592e-01f, 5.992776752e-01f,
+    8.412535191e-01f, 9.771468639e-01f, 9.898214340e-01f, 8.776789904e-01f,
+    6.548607349e-01f, 3.494641781e-01f, 7.071067691e-01f, 8.776789904e-01f,
+    5.406408310e-01f, 7.133918256e-02f, -4.154150188e-01f, -8.005412221e-01f,
+    -9.898214340e-01f, -9.369497299e-01f, -6.548607349e-01f, -2.125652879e-01f,
+    2.817325592e-01f, 7.071067691e-01f, 9.594929814e-01f, 9.771468639e-01f,
+    7.557495832e-01f, 3.494641781e-01f, -1.423148364e-01f, -5.992776752e-01f,
+    -9.096319675e-01f, -9.974521399e-01f, -8.412535191e-01f, -4.792490005e-01f,
+    7.071067691e-01f, 8.005412221e-01f, 2.817325592e-01f, -3.494641781e-01f,
+    -8.412535191e-01f, -9.974521399e-01f, -7.557495832e-01f, -2.125652879e-01f,
+    4.154150188e-01f, 8.776789904e-01f, 9.898214340e-01f, 7.071067691e-01f,
+    1.423148364e-01f, -4.792490005e-01f, -9.096319675e-01f, -9.771468639e-01f,
+    -6.548607349e-01f, -7.133918256e-02f, 5.406408310e-01f, 9.369497299e-01f,
+    9.594929814e-01f, 5.992776752e-01f, 7.071067691e-01f, 7.071067691e-01f,
+    2.832769343e-16f, -7.071067691e-01f, -1.000000000e+00f, -7.071067691e-01f,
+    -1.836970147e-16f, 7.071067691e-01f, 1.000000000e+00f, 7.071067691e-01f,
+    -5.820167198e-16f, -7.071067691e-01f, -1.000000000e+00f, -7.071067691e-01f,
+    -4.286263852e-16f, 7.071067691e-01f, 1.000000000e+00f, 7.071067691e-01f,
+    -1.225265769e-15f, -7.071067691e-01f, -1.000000000e+00f, -7.071067691e-01f,
+    7.071067691e-01f, 5.992776752e-01f, -2.817325592e-01f, -9.369497299e-01f,
+    -8.412535191e-01f, -7.133918256e-02f, 7.557495832e-01f, 9.771468639e-01f,
+    4.154150188e-01f, -4.792490005e-01f, -9.898214340e-01f, -7.071067691e-01f,
+    1.423148364e-01f, 8.776789904e-01f, 9.096319675e-01f, 2.125652879e-01f,
+    -6.548607349e-01f, -9.974521399e-01f, -5.406408310e-01f, 3.494641781e-01f,
+    9.594929814e-01f, 8.005412221e-01f, 7.071067691e-01f, 4.792490005e-01f,
+    -5.406408310e-01f, -9.974521399e-01f, -4.154150188e-01f, 5.992776752e-01f,
+    9.898214340e-01f, 3.494641781e-01f, -6.548607349e-01f, -9.771468639e-01f,
+    -2.817325592e-01f, 7.071067691e-01f, 9.594929814e-01f, 2.125652879e-01f,
+    -7.557495832e-01f, -9.369497299e-01f, -1.423148364e-01f, 8.005412221e-01f,
+    9.096319675e-01f, 7.133918256e-02f, -8.412535191e-01f, -8.776789904e-01f,
+    7.071067691e-01f, 3.494641781e-01f, -7.557495832e-01f, -8.776789904e-01f,
+    1.423148364e-01f, 9.771468639e-01f, 5.406408310e-01f, -5.992776752e-01f,
+    -9.594929814e-01f, -7.133918256e-02f, 9.096319675e-01f, 7.071067691e-01f,
+    -4.154150188e-01f, -9.974521399e-01f, -2.817325592e-01f, 8.005412221e-01f,
+    8.412535191e-01f, -2.125652879e-01f, -9.898214340e-01f, -4.792490005e-01f,
+    6.548607349e-01f, 9.369497299e-01f, 7.071067691e-01f, 2.125652879e-01f,
+    -9.096319675e-01f, -5.992776752e-01f, 6.548607349e-01f, 8.776789904e-01f,
+    -2.817325592e-01f, -9.974521399e-01f, -1.423148364e-01f, 9.369497299e-01f,
+    5.406408310e-01f, -7.071067691e-01f, -8.412535191e-01f, 3.494641781e-01f,
+    9.898214340e-01f, 7.133918256e-02f, -9.594929814e-01f, -4.792490005e-01f,
+    7.557495832e-01f, 8.005412221e-01f, -4.154150188e-01f, -9.771468639e-01f,
+    7.071067691e-01f, 7.133918256e-02f, -9.898214340e-01f, -2.125652879e-01f,
+    9.594929814e-01f, 3.494641781e-01f, -9.096319675e-01f, -4.792490005e-01f,
+    8.412535191e-01f, 5.992776752e-01f, -7.557495832e-01f, -7.071067691e-01f,
+    6.548607349e-01f, 8.005412221e-01f, -5.406408310e-01f, -8.776789904e-01f,
+    4.154150188e-01f, 9.369497299e-01f, -2.817325592e-01f, -9.771468639e-01f,
+    1.423148364e-01f, 9.974521399e-01f, 7.071067691e-01f, -7.133918256e-02f,
+    -9.898214340e-01f, 2.125652879e-01f, 9.594929814e-01f, -3.494641781e-01f,
+    -9.096319675e-01f, 4.792490005e-01f, 8.412535191e-01f, -5.992776752e-01f,
+    -7.557495832e-01f, 7.071067691e-01f, 6.548607349e-01f, -8.005412221e-01f,
+    -5.406408310e-01f, 8.776789904e-01f, 4.154150188e-01f, -9.369497299e-01f,
+    -2.817325592e-01f, 9.771468639e-01f, 1.423148364e-01f, -9.974521399e-01f,
+    7.071067691e-01f, -2.125652879e-01f, -9.096319675e-01f, 5.992776752e-01f,
+    6.548607349e-01f, -8.776789904e-01f, -2.817325592e-01f, 9.974521399e-01f,
+    -1.423148364e-01f, -9.369497299e-01f, 5.406408310e-01f, 7.071067691e-01f,
+    -8.412535191e-01f, -3.494641781e-01f, 9.898214340e-01f, -7.133918256e-02f,
+    -9.594929814e-01f, 4.792490005e-01f, 7.557495832e-01f, -8.005412221e-01f,
+    -4.154150188e-01f, 9.771468639e-01f, 7.071067691e-01f, -3.494641781e-01f,
+    -7.557495832e-01f, 8.776789904e-01f, 1.423148364e-01f, -9.771468639e-01f,
+    5.406408310e-01f, 5.992776752e-01f, -9.594929814e-01f, 7.133918256e-02f,
+    9.096319675e-01f, -7.071067691e-01f, -4.154150188e-01f, 9.974521399e-01f,
+    -2.817325592e-01f, -8.005412221e-01f, 8.412535191e-01f, 2.125652879e-01f,
+    -9.898214340e-01f, 4.792490005e-01f, 6.548607349e-01f, -9.369497299e-01f,
+    7.071067691e-01f, -4.792490005e-01f, -5.406408310e-01f, 9.974521399e-01f,
+    -4.154150188e-01f, -5.992776752e-01f, 9.898214340e-01f, -3.494641781e-01f,
+    -6.548607349e-01f, 9.771468639e-01f, -2.817325592e-01f, -7.071067691e-01f,
+    9.594929814e-01f, -2.125652879e-01f, -7.557495832e-01f, 9.369497299e-01f,
+    -1.423148364e-01f, -8.005412221e-01f, 9.096319675e-01f, -7.133918256e-02f,
+    -8.412535191e-01f, 8.776789904e-01f, 7.071067691e-01f, -5.992776752e-01f,
+    -2.817325592e-01f, 9.369497299e-01f, -8.412535191e-01f, 7.133918256e-02f,
+    7.557495832e-01f, -9.771468639e-01f, 4.154150188e-01f, 4.792490005e-01f,
+    -9.898214340e-01f, 7.071067691e-01f, 1.423148364e-01f, -8.776789904e-01f,
+    9.096319675e-01f, -2.125652879e-01f, -6.548607349e-01f, 9.974521399e-01f,
+    -5.406408310e-01f, -3.494641781e-01f, 9.594929814e-01f, -8.005412221e-01f,
+    7.071067691e-01f, -7.071067691e-01f, -1.836970147e-16f, 7.071067691e-01f,
+    -1.000000000e+00f, 7.071067691e-01f, -1.225265769e-15f, -7.071067691e-01f,
+    1.000000000e+00f, -7.071067691e-01f, -2.694841886e-15f, 7.071067691e-01f,
+    -1.000000000e+00f, 7.071067691e-01f, -4.904777104e-16f, -7.071067691e-01f,
+    1.000000000e+00f, -7.071067691e-01f, -3.429630051e-15f, 7.071067691e-01f,
+    -1.000000000e+00f, 7.071067691e-01f, 7.071067691e-01f, -8.005412221e-01f,
+    2.817325592e-01f, 3.494641781e-01f, -8.412535191e-01f, 9.974521399e-01f,
+    -7.557495832e-01f, 2.125652879e-01f, 4.154150188e-01f, -8.776789904e-01f,
+    9.898214340e-01f, -7.071067691e-01f, 1.423148364e-01f, 4.792490005e-01f,
+    -9.096319675e-01f, 9.771468639e-01f, -6.548607349e-01f, 7.133918256e-02f,
+    5.406408310e-01f, -9.369497299e-01f, 9.594929814e-01f, -5.992776752e-01f,
+    7.071067691e-01f, -8.776789904e-01f, 5.406408310e-01f, -7.133918256e-02f,
+    -4.154150188e-01f, 8.005412221e-01f, -9.898214340e-01f, 9.369497299e-01f,
+    -6.548607349e-01f, 2.125652879e-01f, 2.817325592e-01f, -7.071067691e-01f,
+    9.594929814e-01f, -9.771468639e-01f, 7.557495832e-01f, -3.494641781e-01f,
+    -1.423148364e-01f, 5.992776752e-01f, -9.096319675e-01f, 9.974521399e-01f,
+    -8.412535191e-01f, 4.792490005e-01f, 7.071067691e-01f, -9.369497299e-01f,
+    7.557495832e-01f, -4.792490005e-01f, 1.423148364e-01f, 2.125652879e-01f,
+    -5.406408310e-01f, 8.005412221e-01f, -9.594929814e-01f, 9.974521399e-01f,
+    -9.096319675e-01f, 7.071067691e-01f, -4.154150188e-01f, 7.133918256e-02f,
+    2.817325592e-01f, -5.992776752e-01f, 8.412535191e-01f, -9.771468639e-01f,
+    9.898214340e-01f, -8.776789904e-01f, 6.548607349e-01f, -3.494641781e-01f,
+    7.071067691e-01f, -9.771468639e-01f, 9.096319675e-01f, -8.005412221e-01f,
+    6.548607349e-01f, -4.792490005e-01f, 2.817325592e-01f, -7.133918256e-02f,
+    -1.423148364e-01f, 3.494641781e-01f, -5.406408310e-01f, 7.071067691e-01f,
+    -8.412535191e-01f, 9.369497299e-01f, -9.898214340e-01f, 9.974521399e-01f,
+    -9.594929814e-01f, 8.776789904e-01f, -7.557495832e-01f, 5.992776752e-01f,
+    -4.154150188e-01f, 2.125652879e-01f, 7.071067691e-01f, -9.974521399e-01f,
+    9.898214340e-01f, -9.771468639e-01f, 9.594929814e-01f, -9.369497299e-01f,
+    9.096319675e-01f, -8.776789904e-01f, 8.412535191e-01f, -8.005412221e-01f,
+    7.557495832e-01f, -7.071067691e-01f, 6.548607349e-01f, -5.992776752e-01f,
+    5.406408310e-01f, -4.792490005e-01f, 4.154150188e-01f, -3.494641781e-01f,
+    2.817325592e-01f, -2.125652879e-01f, 1.423148364e-01f, -7.133918256e-02f,
+};
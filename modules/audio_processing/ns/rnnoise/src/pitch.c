@@ -35,6 +35,17 @@
 #include "config.h"
 #endif
 
+/* Defines WEBRTC_ARCH_X86_FAMILY, used below. */
+#include "rtc_base/system/arch.h"
+
+#if defined(WEBRTC_HAS_NEON)
+#include <arm_neon.h>
+#endif
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+#include <emmintrin.h>
+#endif
+
+#include "../include/rnnoise.h"
 #include "common.h"
 #include "pitch.h"
 // #include "modes.h"
@@ -275,11 +286,85 @@ void celt_pitch_xcorr(const opus_val16* _x,
 #endif
 }
 
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+/* Evaluates the lags in the SIMD lanes, so that every correlation accumulates
+   its products in the same order as celt_pitch_xcorr(). */
+static void celt_pitch_xcorr_sse2(const opus_val16* x,
+                                  const opus_val16* y,
+                                  opus_val32* xcorr,
+                                  int len,
+                                  int max_pitch) {
+  int i, j;
+  for (i = 0; i + 8 <= max_pitch; i += 8) {
+    __m128 sum0 = _mm_setzero_ps();
+    __m128 sum1 = _mm_setzero_ps();
+    for (j = 0; j < len; j++) {
+      const __m128 x_j = _mm_set1_ps(x[j]);
+      sum0 = _mm_add_ps(sum0, _mm_mul_ps(x_j, _mm_loadu_ps(&y[i + j])));
+      sum1 = _mm_add_ps(sum1, _mm_mul_ps(x_j, _mm_loadu_ps(&y[i + j + 4])));
+    }
+    _mm_storeu_ps(&xcorr[i], sum0);
+    _mm_storeu_ps(&xcorr[i + 4], sum1);
+  }
+  for (; i + 4 <= max_pitch; i += 4) {
+    __m128 sum = _mm_setzero_ps();
+    for (j = 0; j < len; j++)
+      sum = _mm_add_ps(sum,
+                       _mm_mul_ps(_mm_set1_ps(x[j]), _mm_loadu_ps(&y[i + j])));
+    _mm_storeu_ps(&xcorr[i], sum);
+  }
+  for (; i < max_pitch; i++)
+    xcorr[i] = celt_inner_prod(x, y + i, len);
+}
+#endif
+
+#if defined(WEBRTC_HAS_NEON)
+static void celt_pitch_xcorr_neon(const opus_val16* x,
+                                  const opus_val16* y,
+                                  opus_val32* xcorr,
+                                  int len,
+                                  int max_pitch) {
+  int i, j;
+  for (i = 0; i + 8 <= max_pitch; i += 8) {
+    float32x4_t sum0 = vdupq_n_f32(0.f);
+    float32x4_t sum1 = vdupq_n_f32(0.f);
+    for (j = 0; j < len; j++) {
+      sum0 = vmlaq_n_f32(sum0, vld1q_f32(&y[i + j]), x[j]);
+      sum1 = vmlaq_n_f32(sum1, vld1q_f32(&y[i + j + 4]), x[j]);
+    }
+    vst1q_f32(&xcorr[i], sum0);
+    vst1q_f32(&xcorr[i + 4], sum1);
+  }
+  for (; i + 4 <= max_pitch; i += 4) {
+    float32x4_t sum = vdupq_n_f32(0.f);
+    for (j = 0; j < len; j++)
+      sum = vmlaq_n_f32(sum, vld1q_f32(&y[i + j]), x[j]);
+    vst1q_f32(&xcorr[i], sum);
+  }
+  for (; i < max_pitch; i++)
+    xcorr[i] = celt_inner_prod(x, y + i, len);
+}
+#endif
+
+pitch_xcorr_fn rnnoise_select_pitch_xcorr(int cpu_features) {
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  if (cpu_features & RNNOISE_CPU_AVX2)
+    return celt_pitch_xcorr_avx2;
+  if (cpu_features & RNNOISE_CPU_SSE2)
+    return celt_pitch_xcorr_sse2;
+#elif defined(WEBRTC_HAS_NEON)
+  if (cpu_features & RNNOISE_CPU_NEON)
+    return celt_pitch_xcorr_neon;
+#endif
+  return celt_pitch_xcorr;
+}
+
 void rnnoise_pitch_search(const opus_val16* x_lp,
                           opus_val16* y,
                           int len,
                           int max_pitch,
-                          int* pitch) {
+                          int* pitch,
+                          pitch_xcorr_fn xcorr_fn) {
   int i, j;
   int lag;
   int best_pitch[2] = {0, 0};
@@ -325,7 +410,7 @@ void rnnoise_pitch_search(const opus_val16* x_lp,
 #ifdef FIXED_POINT
   maxcorr =
 #endif
-      celt_pitch_xcorr(x_lp4, y_lp4, xcorr, len >> 2, max_pitch >> 2);
+      xcorr_fn(x_lp4, y_lp4, xcorr, len >> 2, max_pitch >> 2);
 
   find_best_pitch(xcorr, y_lp4, len >> 2, max_pitch >> 2, best_pitch
 #ifdef FIXED_POINT
@@ -37,6 +37,15 @@
 // #include "modes.h"
 // #include "cpu_support.h"
 #include "arch.h"
+#include "rtc_base/system/arch.h"
+
+/* Computes the max_pitch cross-correlations xcorr[i] between the len samples of
+   x and y + i. */
+typedef void (*pitch_xcorr_fn)(const opus_val16* x,
+                               const opus_val16* y,
+                               opus_val32* xcorr,
+                               int len,
+                               int max_pitch);
 
 void rnnoise_pitch_downsample(celt_sig* x[], opus_val16* x_lp, int len, int C);
 
@@ -44,7 +53,8 @@ void rnnoise_pitch_search(const opus_val16* x_lp,
                           opus_val16* y,
                           int len,
                           int max_pitch,
-                          int* pitch);
+                          int* pitch,
+                          pitch_xcorr_fn xcorr_fn);
 
 opus_val16 rnnoise_remove_doubling(opus_val16* x,
                                    int maxperiod,
@@ -154,5 +164,18 @@ void celt_pitch_xcorr(const opus_val16* _x,
                       opus_val32* xcorr,
                       int len,
                       int max_pitch);
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+/* Implemented in rnn_avx2.c, which is built with AVX2 enabled. Not bit-exact
+   with celt_pitch_xcorr(), since it uses fused multiply-adds. */
+void celt_pitch_xcorr_avx2(const opus_val16* x,
+                           const opus_val16* y,
+                           opus_val32* xcorr,
+                           int len,
+                           int max_pitch);
+#endif
+
+/* Returns the fastest cross-correlation kernel for the RNNOISE_CPU_* flags. The
+   SSE2 kernel is bit-exact with celt_pitch_xcorr(). */
+pitch_xcorr_fn rnnoise_select_pitch_xcorr(int cpu_features);
 
 #endif
@@ -32,8 +32,19 @@
 #include <math.h>
 #include <stdio.h>
 
+/* Defines WEBRTC_ARCH_X86_FAMILY, used below. */
+#include "rtc_base/system/arch.h"
+
+#if defined(WEBRTC_HAS_NEON)
+#include <arm_neon.h>
+#endif
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+#include <emmintrin.h>
+#endif
+
 #include "arch.h"
 #include "common.h"
+#include "modules/audio_processing/utility/rational_activations.h"
 #include "opus_types.h"
 #include "rnn.h"
 #include "rnn_data.h"
@@ -154,6 +165,511 @@ void rnnoise_compute_gru(const GRULayer* gru,
     state[i] = h[i];
 }
 
+static OPUS_INLINE float activate(int activation, float x) {
+  if (activation == ACTIVATION_SIGMOID)
+    return sigmoid_approx(x);
+  else if (activation == ACTIVATION_TANH)
+    return tansig_approx(x);
+  else if (activation == ACTIVATION_RELU)
+    return relu(x);
+  return x;
+}
+
+/* The batched layers load each weight once and apply it to all the inputs in
+   the batch. The accumulation order for each input is the same as in the
+   single-input layers, so the results are identical. */
+void rnnoise_compute_dense_batch(const DenseLayer* layer,
+                                 int n,
+                                 float** output,
+                                 const float** input) {
+  int i, j, k;
+  int N, M;
+  int stride;
+  M = layer->nb_inputs;
+  N = layer->nb_neurons;
+  stride = N;
+  for (i = 0; i < N; i++) {
+    float sum[RNN_MAX_BATCH];
+    for (k = 0; k < n; k++)
+      sum[k] = layer->bias[i];
+    for (j = 0; j < M; j++) {
+      const float w = layer->input_weights[j * stride + i];
+      for (k = 0; k < n; k++)
+        sum[k] += w * input[k][j];
+    }
+    for (k = 0; k < n; k++)
+      output[k][i] = activate(layer->activation, WEIGHTS_SCALE * sum[k]);
+  }
+}
+
+void rnnoise_compute_gru_batch(const GRULayer* gru,
+                               int n,
+                               float** state,
+                               const float** input) {
+  int i, j, k;
+  int N, M;
+  int stride;
+  float z[RNN_MAX_BATCH][MAX_NEURONS];
+  float r[RNN_MAX_BATCH][MAX_NEURONS];
+  float h[RNN_MAX_BATCH][MAX_NEURONS];
+  M = gru->nb_inputs;
+  N = gru->nb_neurons;
+  stride = 3 * N;
+  for (i = 0; i < N; i++) {
+    /* Compute update and reset gates. */
+    float sum_z[RNN_MAX_BATCH];
+    float sum_r[RNN_MAX_BATCH];
+    for (k = 0; k < n; k++) {
+      sum_z[k] = gru->bias[i];
+      sum_r[k] = gru->bias[N + i];
+    }
+    for (j = 0; j < M; j++) {
+      const float wz = gru->input_weights[j * stride + i];
+      const float wr = gru->input_weights[N + j * stride + i];
+      for (k = 0; k < n; k++) {
+        sum_z[k] += wz * input[k][j];
+        sum_r[k] += wr * input[k][j];
+      }
+    }
+    for (j = 0; j < N; j++) {
+      const float wz = gru->recurrent_weights[j * stride + i];
+      const float wr = gru->recurrent_weights[N + j * stride + i];
+      for (k = 0; k < n; k++) {
+        sum_z[k] += wz * state[k][j];
+        sum_r[k] += wr * state[k][j];
+      }
+    }
+    for (k = 0; k < n; k++) {
+      z[k][i] = sigmoid_approx(WEIGHTS_SCALE * sum_z[k]);
+      r[k][i] = sigmoid_approx(WEIGHTS_SCALE * sum_r[k]);
+    }
+  }
+  for (i = 0; i < N; i++) {
+    /* Compute output. */
+    float sum[RNN_MAX_BATCH];
+    for (k = 0; k < n; k++)
+      sum[k] = gru->bias[2 * N + i];
+    for (j = 0; j < M; j++) {
+      const float w = gru->input_weights[2 * N + j * stride + i];
+      for (k = 0; k < n; k++)
+        sum[k] += w * input[k][j];
+    }
+    for (j = 0; j < N; j++) {
+      const float w = gru->recurrent_weights[2 * N + j * stride + i];
+      for (k = 0; k < n; k++)
+        sum[k] += w * state[k][j] * r[k][j];
+    }
+    for (k = 0; k < n; k++) {
+      const float out = activate(gru->activation, WEIGHTS_SCALE * sum[k]);
+      h[k][i] = z[k][i] * state[k][i] + (1 - z[k][i]) * out;
+    }
+  }
+  for (k = 0; k < n; k++) {
+    for (i = 0; i < N; i++)
+      state[k][i] = h[k][i];
+  }
+}
+
+float rnn_dot_c(const rnn_weight* w, const float* x, int n) {
+  int j;
+  float sum = 0;
+  for (j = 0; j < n; j++)
+    sum += w[j] * x[j];
+  return sum;
+}
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+static float rnn_dot_sse2(const rnn_weight* w, const float* x, int n) {
+  int j;
+  float sum;
+  __m128 acc = _mm_setzero_ps();
+  for (j = 0; j + 8 <= n; j += 8) {
+    /* Sign-extend 8 weights to 32 bits. */
+    __m128i w8 = _mm_loadl_epi64((const __m128i*)&w[j]);
+    __m128i w16 = _mm_srai_epi16(_mm_unpacklo_epi8(w8, w8), 8);
+    __m128i w_lo = _mm_srai_epi32(_mm_unpacklo_epi16(w16, w16), 16);
+    __m128i w_hi = _mm_srai_epi32(_mm_unpackhi_epi16(w16, w16), 16);
+    acc = _mm_add_ps(acc, _mm_mul_ps(_mm_cvtepi32_ps(w_lo), _mm_loadu_ps(&x[j])));
+    acc = _mm_add_ps(acc,
+                     _mm_mul_ps(_mm_cvtepi32_ps(w_hi), _mm_loadu_ps(&x[j + 4])));
+  }
+  acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+  acc = _mm_add_ss(acc, _mm_shuffle_ps(acc, acc, 1));
+  sum = _mm_cvtss_f32(acc);
+  for (; j < n; j++)
+    sum += w[j] * x[j];
+  return sum;
+}
+#endif
+
+#if defined(WEBRTC_HAS_NEON)
+static float rnn_dot_neon(const rnn_weight* w, const float* x, int n) {
+  int j;
+  float sum;
+  float32x4_t acc = vdupq_n_f32(0.f);
+  for (j = 0; j + 8 <= n; j += 8) {
+    int16x8_t w16 = vmovl_s8(vld1_s8(&w[j]));
+    float32x4_t w_lo = vcvtq_f32_s32(vmovl_s16(vget_low_s16(w16)));
+    float32x4_t w_hi = vcvtq_f32_s32(vmovl_s16(vget_high_s16(w16)));
+    acc = vmlaq_f32(acc, w_lo, vld1q_f32(&x[j]));
+    acc = vmlaq_f32(acc, w_hi, vld1q_f32(&x[j + 4]));
+  }
+  {
+    float32x2_t tmp = vadd_f32(vget_low_f32(acc), vget_high_f32(acc));
+    sum = vget_lane_f32(vpadd_f32(tmp, tmp), 0);
+  }
+  for (; j < n; j++)
+    sum += w[j] * x[j];
+  return sum;
+}
+#endif
+
+rnn_dot_fn rnn_select_dot(int cpu_features) {
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  if (cpu_features & RNNOISE_CPU_AVX2)
+    return rnn_dot_avx2;
+  if (cpu_features & RNNOISE_CPU_SSE2)
+    return rnn_dot_sse2;
+#elif defined(WEBRTC_HAS_NEON)
+  if (cpu_features & RNNOISE_CPU_NEON)
+    return rnn_dot_neon;
+#endif
+  return rnn_dot_c;
+}
+
+opus_int32 rnn_dot_i16_c(const rnn_weight* w, const opus_int16* x, int n) {
+  int j;
+  opus_int32 sum = 0;
+  for (j = 0; j < n; j++)
+    sum += w[j] * x[j];
+  return sum;
+}
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+static opus_int32 rnn_dot_i16_sse2(const rnn_weight* w,
+                                   const opus_int16* x,
+                                   int n) {
+  int j;
+  opus_int32 sum;
+  __m128i acc = _mm_setzero_si128();
+  for (j = 0; j + 8 <= n; j += 8) {
+    /* Sign-extend 8 weights to 16 bits and multiply-add adjacent pairs. */
+    __m128i w8 = _mm_loadl_epi64((const __m128i*)&w[j]);
+    __m128i w16 = _mm_srai_epi16(_mm_unpacklo_epi8(w8, w8), 8);
+    acc = _mm_add_epi32(
+        acc, _mm_madd_epi16(w16, _mm_loadu_si128((const __m128i*)&x[j])));
+  }
+  acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1, 0, 3, 2)));
+  acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(2, 3, 0, 1)));
+  sum = _mm_cvtsi128_si32(acc);
+  for (; j < n; j++)
+    sum += w[j] * x[j];
+  return sum;
+}
+#endif
+
+#if defined(WEBRTC_HAS_NEON)
+static opus_int32 rnn_dot_i16_neon(const rnn_weight* w,
+                                   const opus_int16* x,
+                                   int n) {
+  int j;
+  opus_int32 sum;
+  int32x4_t acc = vdupq_n_s32(0);
+  for (j = 0; j + 8 <= n; j += 8) {
+    int16x8_t w16 = vmovl_s8(vld1_s8(&w[j]));
+    int16x8_t x16 = vld1q_s16(&x[j]);
+    acc = vmlal_s16(acc, vget_low_s16(w16), vget_low_s16(x16));
+    acc = vmlal_s16(acc, vget_high_s16(w16), vget_high_s16(x16));
+  }
+  {
+    int32x2_t tmp = vadd_s32(vget_low_s32(acc), vget_high_s32(acc));
+    sum = vget_lane_s32(vpadd_s32(tmp, tmp), 0);
+  }
+  for (; j < n; j++)
+    sum += w[j] * x[j];
+  return sum;
+}
+#endif
+
+rnn_dot_i16_fn rnn_select_dot_i16(int cpu_features) {
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  if (cpu_features & RNNOISE_CPU_AVX2)
+    return rnn_dot_i16_avx2;
+  if (cpu_features & RNNOISE_CPU_SSE2)
+    return rnn_dot_i16_sse2;
+#elif defined(WEBRTC_HAS_NEON)
+  if (cpu_features & RNNOISE_CPU_NEON)
+    return rnn_dot_i16_neon;
+#endif
+  return rnn_dot_i16_c;
+}
+
+void rnn_tanh_c(float* x, int n) {
+  WebRtcApm_RationalTanhInPlace(x, n);
+}
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+/* Same operations as WebRtcApm_RationalTanh(), hence bit-exact with it. */
+static void rnn_tanh_sse2(float* x, int n) {
+  int i;
+  const __m128 max_input = _mm_set1_ps(WEBRTC_RATIONAL_TANH_MAX_INPUT);
+  const __m128 min_input = _mm_set1_ps(-WEBRTC_RATIONAL_TANH_MAX_INPUT);
+  const __m128 one = _mm_set1_ps(1.f);
+  const __m128 minus_one = _mm_set1_ps(-1.f);
+  for (i = 0; i + 4 <= n; i += 4) {
+    __m128 v = _mm_loadu_ps(&x[i]);
+    __m128 v2, num, den;
+    /* The operand order maps NaN to the maximum input, as in the C code. */
+    v = _mm_max_ps(_mm_min_ps(v, max_input), min_input);
+    v2 = _mm_mul_ps(v, v);
+    num = _mm_add_ps(
+        _mm_mul_ps(_mm_set1_ps(WEBRTC_RATIONAL_TANH_N2), v2),
+        _mm_set1_ps(WEBRTC_RATIONAL_TANH_N1));
+    num = _mm_add_ps(_mm_mul_ps(num, v2), _mm_set1_ps(WEBRTC_RATIONAL_TANH_N0));
+    num = _mm_mul_ps(num, v);
+    den = _mm_add_ps(
+        _mm_mul_ps(_mm_set1_ps(WEBRTC_RATIONAL_TANH_D2), v2),
+        _mm_set1_ps(WEBRTC_RATIONAL_TANH_D1));
+    den = _mm_add_ps(_mm_mul_ps(den, v2), _mm_set1_ps(WEBRTC_RATIONAL_TANH_D0));
+    v = _mm_max_ps(_mm_min_ps(_mm_div_ps(num, den), one), minus_one);
+    _mm_storeu_ps(&x[i], v);
+  }
+  WebRtcApm_RationalTanhInPlace(&x[i], n - i);
+}
+#endif
+
+#if defined(WEBRTC_HAS_NEON)
+static void rnn_tanh_neon(float* x, int n) {
+  int i;
+  const float32x4_t max_input = vdupq_n_f32(WEBRTC_RATIONAL_TANH_MAX_INPUT);
+  const float32x4_t min_input = vdupq_n_f32(-WEBRTC_RATIONAL_TANH_MAX_INPUT);
+  const float32x4_t one = vdupq_n_f32(1.f);
+  const float32x4_t minus_one = vdupq_n_f32(-1.f);
+  for (i = 0; i + 4 <= n; i += 4) {
+    float32x4_t v = vld1q_f32(&x[i]);
+    float32x4_t v2, num, den, y;
+    /* Selects rather than vminq/vmaxq so that NaN maps to the maximum input. */
+    v = vbslq_f32(vcltq_f32(v, max_input), v, max_input);
+    v = vbslq_f32(vcgtq_f32(v, min_input), v, min_input);
+    v2 = vmulq_f32(v, v);
+    num = vmlaq_f32(vdupq_n_f32(WEBRTC_RATIONAL_TANH_N1),
+                    vdupq_n_f32(WEBRTC_RATIONAL_TANH_N2), v2);
+    num = vmulq_f32(vmlaq_f32(vdupq_n_f32(WEBRTC_RATIONAL_TANH_N0), num, v2),
+                    v);
+    den = vmlaq_f32(vdupq_n_f32(WEBRTC_RATIONAL_TANH_D1),
+                    vdupq_n_f32(WEBRTC_RATIONAL_TANH_D2), v2);
+    den = vmlaq_f32(vdupq_n_f32(WEBRTC_RATIONAL_TANH_D0), den, v2);
+#if defined(WEBRTC_ARCH_ARM64)
+    y = vdivq_f32(num, den);
+#else
+    {
+      /* Reciprocal estimate refined by two Newton-Raphson steps. */
+      float32x4_t inv = vrecpeq_f32(den);
+      inv = vmulq_f32(vrecpsq_f32(den, inv), inv);
+      inv = vmulq_f32(vrecpsq_f32(den, inv), inv);
+      y = vmulq_f32(num, inv);
+    }
+#endif
+    y = vmaxq_f32(vminq_f32(y, one), minus_one);
+    vst1q_f32(&x[i], y);
+  }
+  WebRtcApm_RationalTanhInPlace(&x[i], n - i);
+}
+#endif
+
+rnn_tanh_fn rnn_select_tanh(int cpu_features) {
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  if (cpu_features & RNNOISE_CPU_AVX2)
+    return rnn_tanh_avx2;
+  if (cpu_features & RNNOISE_CPU_SSE2)
+    return rnn_tanh_sse2;
+#elif defined(WEBRTC_HAS_NEON)
+  if (cpu_features & RNNOISE_CPU_NEON)
+    return rnn_tanh_neon;
+#endif
+  return rnn_tanh_c;
+}
+
+/* Kernels used to evaluate a packed model. */
+typedef struct {
+  rnn_dot_fn dot;
+  /* NULL when the model uses the table based activations. */
+  rnn_tanh_fn tanh;
+  /* NULL unless the model is evaluated in the integer domain. */
+  rnn_dot_i16_fn dot_i16;
+} PackedKernels;
+
+/* Layer input quantized for the integer kernels: x[i] ~= scale * q[i]. */
+typedef struct {
+  opus_int16 q[MAX_NEURONS * 3];
+  float scale;
+} QuantizedInput;
+
+/* Quantizes n values so that the largest magnitude maps to 32767. */
+static void quantize_input(const float* x, int n, QuantizedInput* out) {
+  int i;
+  float max_abs = 0;
+  float inv_scale;
+  for (i = 0; i < n; i++)
+    max_abs = MAX16(max_abs, ABS16(x[i]));
+  if (!(max_abs > 0)) {
+    for (i = 0; i < n; i++)
+      out->q[i] = 0;
+    out->scale = 0;
+    return;
+  }
+  inv_scale = 32767.f / max_abs;
+  for (i = 0; i < n; i++)
+    out->q[i] = (opus_int16)floor(.5f + inv_scale * x[i]);
+  out->scale = max_abs / 32767.f;
+}
+
+/* Computes the dot product between n weights and the inputs x, or their
+   quantized version q in the integer domain. */
+static OPUS_INLINE float dot_packed(const PackedKernels* kernels,
+                                    const rnn_weight* w,
+                                    const float* x,
+                                    const QuantizedInput* q,
+                                    int n) {
+  if (kernels->dot_i16)
+    return q->scale * (float)kernels->dot_i16(w, q->q, n);
+  return kernels->dot(w, x, n);
+}
+
+/* Applies an activation function to the n values in x. */
+static void activate_packed(const PackedKernels* kernels,
+                            int activation,
+                            float* x,
+                            int n) {
+  int i;
+  if (kernels->tanh && activation == ACTIVATION_TANH) {
+    kernels->tanh(x, n);
+  } else if (kernels->tanh && activation == ACTIVATION_SIGMOID) {
+    /* sigmoid(x) = .5 + .5 * tanh(.5 * x) */
+    for (i = 0; i < n; i++)
+      x[i] *= .5f;
+    kernels->tanh(x, n);
+    for (i = 0; i < n; i++)
+      x[i] = .5f + .5f * x[i];
+  } else {
+    for (i = 0; i < n; i++)
+      x[i] = activate(activation, x[i]);
+  }
+}
+
+/* Layers of a packed model store the weights of each neuron contiguously:
+   dense weights as [neuron][input] and GRU weights as [gate][neuron][input]. */
+static void compute_dense_packed(const DenseLayer* layer,
+                                 const PackedKernels* kernels,
+                                 int n,
+                                 float** output,
+                                 const float** input) {
+  int i, k;
+  const int M = layer->nb_inputs;
+  const int N = layer->nb_neurons;
+  QuantizedInput q_input[RNN_MAX_BATCH];
+  if (kernels->dot_i16) {
+    for (k = 0; k < n; k++)
+      quantize_input(input[k], M, &q_input[k]);
+  }
+  for (i = 0; i < N; i++) {
+    const rnn_weight* w = &layer->input_weights[i * M];
+    for (k = 0; k < n; k++)
+      output[k][i] =
+          WEIGHTS_SCALE *
+          (layer->bias[i] + dot_packed(kernels, w, input[k], &q_input[k], M));
+  }
+  for (k = 0; k < n; k++)
+    activate_packed(kernels, layer->activation, output[k], N);
+}
+
+static void compute_gru_packed(const GRULayer* gru,
+                               const PackedKernels* kernels,
+                               int n,
+                               float** state,
+                               const float** input) {
+  int i, j, k;
+  const int M = gru->nb_inputs;
+  const int N = gru->nb_neurons;
+  float z[RNN_MAX_BATCH][MAX_NEURONS];
+  float r[RNN_MAX_BATCH][MAX_NEURONS];
+  float h[RNN_MAX_BATCH][MAX_NEURONS];
+  QuantizedInput q_input[RNN_MAX_BATCH];
+  QuantizedInput q_state[RNN_MAX_BATCH];
+  if (kernels->dot_i16) {
+    for (k = 0; k < n; k++) {
+      quantize_input(input[k], M, &q_input[k]);
+      quantize_input(state[k], N, &q_state[k]);
+    }
+  }
+  for (i = 0; i < N; i++) {
+    /* Compute update and reset gates. */
+    const rnn_weight* wz = &gru->input_weights[i * M];
+    const rnn_weight* wr = &gru->input_weights[(N + i) * M];
+    const rnn_weight* uz = &gru->recurrent_weights[i * N];
+    const rnn_weight* ur = &gru->recurrent_weights[(N + i) * N];
+    for (k = 0; k < n; k++) {
+      z[k][i] = WEIGHTS_SCALE *
+                (gru->bias[i] +
+                 dot_packed(kernels, wz, input[k], &q_input[k], M) +
+                 dot_packed(kernels, uz, state[k], &q_state[k], N));
+      r[k][i] = WEIGHTS_SCALE *
+                (gru->bias[N + i] +
+                 dot_packed(kernels, wr, input[k], &q_input[k], M) +
+                 dot_packed(kernels, ur, state[k], &q_state[k], N));
+    }
+  }
+  for (k = 0; k < n; k++) {
+    activate_packed(kernels, ACTIVATION_SIGMOID, z[k], N);
+    activate_packed(kernels, ACTIVATION_SIGMOID, r[k], N);
+    /* The reset gate is applied to the state before the recurrent product. */
+    for (j = 0; j < N; j++)
+      r[k][j] *= state[k][j];
+    /* The reset state replaces the state as the recurrent input. */
+    if (kernels->dot_i16)
+      quantize_input(r[k], N, &q_state[k]);
+  }
+  for (i = 0; i < N; i++) {
+    /* Compute output. */
+    const rnn_weight* wh = &gru->input_weights[(2 * N + i) * M];
+    const rnn_weight* uh = &gru->recurrent_weights[(2 * N + i) * N];
+    for (k = 0; k < n; k++)
+      h[k][i] = WEIGHTS_SCALE *
+                (gru->bias[2 * N + i] +
+                 dot_packed(kernels, wh, input[k], &q_input[k], M) +
+                 dot_packed(kernels, uh, r[k], &q_state[k], N));
+  }
+  for (k = 0; k < n; k++) {
+    activate_packed(kernels, gru->activation, h[k], N);
+    for (i = 0; i < N; i++)
+      state[k][i] = z[k][i] * state[k][i] + (1 - z[k][i]) * h[k][i];
+  }
+}
+
+static void compute_dense_any(const RNNModel* model,
+                              const PackedKernels* kernels,
+                              const DenseLayer* layer,
+                              int n,
+                              float** output,
+                              const float** input) {
+  if (model->packed)
+    compute_dense_packed(layer, kernels, n, output, input);
+  else
+    rnnoise_compute_dense_batch(layer, n, output, input);
+}
+
+static void compute_gru_any(const RNNModel* model,
+                            const PackedKernels* kernels,
+                            const GRULayer* gru,
+                            int n,
+                            float** state,
+                            const float** input) {
+  if (model->packed)
+    compute_gru_packed(gru, kernels, n, state, input);
+  else
+    rnnoise_compute_gru_batch(gru, n, state, input);
+}
+
 #define INPUT_SIZE 42
 
 void compute_rnn(RNNState* rnn, float* gains, float* vad, const float* input) {
@@ -185,3 +701,67 @@ void compute_rnn(RNNState* rnn, float* gains, float* vad, const float* input) {
   rnnoise_compute_dense(rnn->model->denoise_output, gains,
                         rnn->denoise_gru_state);
 }
+
+void compute_rnn_batch(RNNState** rnn,
+                       int n,
+                       float** gains,
+                       float** vad,
+                       const float** input) {
+  int i, k;
+  const RNNModel* model = rnn[0]->model;
+  PackedKernels kernels;
+  float dense_out[RNN_MAX_BATCH][MAX_NEURONS];
+  float noise_input[RNN_MAX_BATCH][MAX_NEURONS * 3];
+  float denoise_input[RNN_MAX_BATCH][MAX_NEURONS * 3];
+  float* dense_out_ptr[RNN_MAX_BATCH];
+  const float* layer_input[RNN_MAX_BATCH];
+  float* layer_state[RNN_MAX_BATCH];
+  kernels.dot = rnn_select_dot(model->packed_flags);
+  kernels.tanh = (model->packed_flags & RNNOISE_RATIONAL_ACTIVATIONS)
+                     ? rnn_select_tanh(model->packed_flags)
+                     : NULL;
+  kernels.dot_i16 = (model->packed_flags & RNNOISE_INT16_INFERENCE)
+                        ? rnn_select_dot_i16(model->packed_flags)
+                        : NULL;
+  for (k = 0; k < n; k++)
+    dense_out_ptr[k] = dense_out[k];
+  compute_dense_any(model, &kernels, model->input_dense, n, dense_out_ptr, input);
+
+  for (k = 0; k < n; k++) {
+    layer_input[k] = dense_out[k];
+    layer_state[k] = rnn[k]->vad_gru_state;
+  }
+  compute_gru_any(model, &kernels, model->vad_gru, n, layer_state, layer_input);
+  for (k = 0; k < n; k++)
+    layer_input[k] = rnn[k]->vad_gru_state;
+  compute_dense_any(model, &kernels, model->vad_output, n, vad, layer_input);
+
+  for (k = 0; k < n; k++) {
+    for (i = 0; i < model->input_dense_size; i++)
+      noise_input[k][i] = dense_out[k][i];
+    for (i = 0; i < model->vad_gru_size; i++)
+      noise_input[k][i + model->input_dense_size] = rnn[k]->vad_gru_state[i];
+    for (i = 0; i < INPUT_SIZE; i++)
+      noise_input[k][i + model->input_dense_size + model->vad_gru_size] =
+          input[k][i];
+    layer_input[k] = noise_input[k];
+    layer_state[k] = rnn[k]->noise_gru_state;
+  }
+  compute_gru_any(model, &kernels, model->noise_gru, n, layer_state, layer_input);
+
+  for (k = 0; k < n; k++) {
+    for (i = 0; i < model->vad_gru_size; i++)
+      denoise_input[k][i] = rnn[k]->vad_gru_state[i];
+    for (i = 0; i < model->noise_gru_size; i++)
+      denoise_input[k][i + model->vad_gru_size] = rnn[k]->noise_gru_state[i];
+    for (i = 0; i < INPUT_SIZE; i++)
+      denoise_input[k][i + model->vad_gru_size + model->noise_gru_size] =
+          input[k][i];
+    layer_input[k] = denoise_input[k];
+    layer_state[k] = rnn[k]->denoise_gru_state;
+  }
+  compute_gru_any(model, &kernels, model->denoise_gru, n, layer_state, layer_input);
+  for (k = 0; k < n; k++)
+    layer_input[k] = rnn[k]->denoise_gru_state;
+  compute_dense_any(model, &kernels, model->denoise_output, n, gains, layer_input);
+}
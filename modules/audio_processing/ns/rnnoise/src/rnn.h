@@ -29,11 +29,15 @@
 
 #include "../include/rnnoise.h"
 #include "opus_types.h"
+#include "rtc_base/system/arch.h"
 
 #define WEIGHTS_SCALE (1.f / 256)
 
 #define MAX_NEURONS 128
 
+/* Maximum number of inputs evaluated jointly by the batched layers. */
+#define RNN_MAX_BATCH 8
+
 #define ACTIVATION_TANH 0
 #define ACTIVATION_SIGMOID 1
 #define ACTIVATION_RELU 2
@@ -59,6 +63,44 @@ typedef struct {
 
 typedef struct RNNState RNNState;
 
+/* Computes the dot product between n weights and n inputs. */
+typedef float (*rnn_dot_fn)(const rnn_weight* w, const float* x, int n);
+
+float rnn_dot_c(const rnn_weight* w, const float* x, int n);
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+/* Implemented in rnn_avx2.c, which is built with AVX2 enabled. */
+float rnn_dot_avx2(const rnn_weight* w, const float* x, int n);
+#endif
+
+/* Returns the fastest dot product kernel for the RNNOISE_CPU_* flags. */
+rnn_dot_fn rnn_select_dot(int cpu_features);
+
+/* Computes the dot product between n weights and n 16-bit inputs with 32-bit
+   accumulation. n must not exceed 3 * MAX_NEURONS, so that the sum of the
+   products cannot overflow. */
+typedef opus_int32 (*rnn_dot_i16_fn)(const rnn_weight* w,
+                                     const opus_int16* x,
+                                     int n);
+
+opus_int32 rnn_dot_i16_c(const rnn_weight* w, const opus_int16* x, int n);
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+opus_int32 rnn_dot_i16_avx2(const rnn_weight* w, const opus_int16* x, int n);
+#endif
+
+/* Returns the fastest 16-bit dot product kernel for the RNNOISE_CPU_* flags. */
+rnn_dot_i16_fn rnn_select_dot_i16(int cpu_features);
+
+/* Replaces the n values in x with their rational tanh approximation. */
+typedef void (*rnn_tanh_fn)(float* x, int n);
+
+void rnn_tanh_c(float* x, int n);
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+void rnn_tanh_avx2(float* x, int n);
+#endif
+
+/* Returns the fastest rational tanh kernel for the RNNOISE_CPU_* flags. */
+rnn_tanh_fn rnn_select_tanh(int cpu_features);
+
 void rnnoise_compute_dense(const DenseLayer* layer,
                            float* output,
                            const float* input);
@@ -67,4 +109,21 @@ void rnnoise_compute_gru(const GRULayer* gru, float* state, const float* input);
 
 void compute_rnn(RNNState* rnn, float* gains, float* vad, const float* input);
 
+void rnnoise_compute_dense_batch(const DenseLayer* layer,
+                                 int n,
+                                 float** output,
+                                 const float** input);
+
+void rnnoise_compute_gru_batch(const GRULayer* gru,
+                               int n,
+                               float** state,
+                               const float** input);
+
+/* Evaluates the RNN for n <= RNN_MAX_BATCH states sharing the same model. */
+void compute_rnn_batch(RNNState** rnn,
+                       int n,
+                       float** gains,
+                       float** vad,
+                       const float** input);
+
 #endif /* RNN_H_ */
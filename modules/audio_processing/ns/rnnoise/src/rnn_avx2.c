@@ -0,0 +1,119 @@
+/* Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <immintrin.h>
+
+#include "modules/audio_processing/utility/rational_activations.h"
+#include "pitch.h"
+#include "rnn.h"
+
+float rnn_dot_avx2(const rnn_weight* w, const float* x, int n) {
+  int j;
+  float sum;
+  __m256 acc = _mm256_setzero_ps();
+  __m128 high;
+  __m128 low;
+  for (j = 0; j + 8 <= n; j += 8) {
+    const __m256i w32 =
+        _mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i*)&w[j]));
+    acc = _mm256_fmadd_ps(_mm256_cvtepi32_ps(w32), _mm256_loadu_ps(&x[j]), acc);
+  }
+  /* Reduce the accumulator by addition. */
+  high = _mm256_extractf128_ps(acc, 1);
+  low = _mm256_extractf128_ps(acc, 0);
+  low = _mm_add_ps(high, low);
+  high = _mm_movehl_ps(high, low);
+  low = _mm_add_ps(high, low);
+  high = _mm_shuffle_ps(low, low, 1);
+  low = _mm_add_ss(high, low);
+  sum = _mm_cvtss_f32(low);
+  for (; j < n; j++)
+    sum += w[j] * x[j];
+  return sum;
+}
+
+opus_int32 rnn_dot_i16_avx2(const rnn_weight* w, const opus_int16* x, int n) {
+  int j;
+  opus_int32 sum;
+  __m256i acc = _mm256_setzero_si256();
+  __m128i acc128;
+  for (j = 0; j + 16 <= n; j += 16) {
+    /* Sign-extend 16 weights to 16 bits and multiply-add adjacent pairs. */
+    const __m256i w16 =
+        _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*)&w[j]));
+    acc = _mm256_add_epi32(
+        acc,
+        _mm256_madd_epi16(w16, _mm256_loadu_si256((const __m256i*)&x[j])));
+  }
+  /* Reduce the accumulator by addition. */
+  acc128 = _mm_add_epi32(_mm256_extracti128_si256(acc, 1),
+                         _mm256_castsi256_si128(acc));
+  acc128 = _mm_add_epi32(acc128,
+                         _mm_shuffle_epi32(acc128, _MM_SHUFFLE(1, 0, 3, 2)));
+  acc128 = _mm_add_epi32(acc128,
+                         _mm_shuffle_epi32(acc128, _MM_SHUFFLE(2, 3, 0, 1)));
+  sum = _mm_cvtsi128_si32(acc128);
+  for (; j < n; j++)
+    sum += w[j] * x[j];
+  return sum;
+}
+
+void rnn_tanh_avx2(float* x, int n) {
+  int i;
+  const __m256 max_input = _mm256_set1_ps(WEBRTC_RATIONAL_TANH_MAX_INPUT);
+  const __m256 min_input = _mm256_set1_ps(-WEBRTC_RATIONAL_TANH_MAX_INPUT);
+  const __m256 one = _mm256_set1_ps(1.f);
+  const __m256 minus_one = _mm256_set1_ps(-1.f);
+  for (i = 0; i + 8 <= n; i += 8) {
+    __m256 v = _mm256_loadu_ps(&x[i]);
+    __m256 v2, num, den;
+    /* The operand order maps NaN to the maximum input, as in the C code. */
+    v = _mm256_max_ps(_mm256_min_ps(v, max_input), min_input);
+    v2 = _mm256_mul_ps(v, v);
+    num = _mm256_fmadd_ps(_mm256_set1_ps(WEBRTC_RATIONAL_TANH_N2), v2,
+                          _mm256_set1_ps(WEBRTC_RATIONAL_TANH_N1));
+    num = _mm256_fmadd_ps(num, v2, _mm256_set1_ps(WEBRTC_RATIONAL_TANH_N0));
+    num = _mm256_mul_ps(num, v);
+    den = _mm256_fmadd_ps(_mm256_set1_ps(WEBRTC_RATIONAL_TANH_D2), v2,
+                          _mm256_set1_ps(WEBRTC_RATIONAL_TANH_D1));
+    den = _mm256_fmadd_ps(den, v2, _mm256_set1_ps(WEBRTC_RATIONAL_TANH_D0));
+    v = _mm256_max_ps(_mm256_min_ps(_mm256_div_ps(num, den), one), minus_one);
+    _mm256_storeu_ps(&x[i], v);
+  }
+  WebRtcApm_RationalTanhInPlace(&x[i], n - i);
+}
+
+void celt_pitch_xcorr_avx2(const opus_val16* x,
+                           const opus_val16* y,
+                           opus_val32* xcorr,
+                           int len,
+                           int max_pitch) {
+  int i, j;
+  /* Two independent accumulators hide the latency of the multiply-adds. */
+  for (i = 0; i + 16 <= max_pitch; i += 16) {
+    __m256 sum0 = _mm256_setzero_ps();
+    __m256 sum1 = _mm256_setzero_ps();
+    for (j = 0; j < len; j++) {
+      const __m256 x_j = _mm256_set1_ps(x[j]);
+      sum0 = _mm256_fmadd_ps(x_j, _mm256_loadu_ps(&y[i + j]), sum0);
+      sum1 = _mm256_fmadd_ps(x_j, _mm256_loadu_ps(&y[i + j + 8]), sum1);
+    }
+    _mm256_storeu_ps(&xcorr[i], sum0);
+    _mm256_storeu_ps(&xcorr[i + 8], sum1);
+  }
+  for (; i + 8 <= max_pitch; i += 8) {
+    __m256 sum = _mm256_setzero_ps();
+    for (j = 0; j < len; j++)
+      sum = _mm256_fmadd_ps(_mm256_set1_ps(x[j]), _mm256_loadu_ps(&y[i + j]),
+                            sum);
+    _mm256_storeu_ps(&xcorr[i], sum);
+  }
+  for (; i < max_pitch; i++)
+    xcorr[i] = celt_inner_prod(x, y + i, len);
+}
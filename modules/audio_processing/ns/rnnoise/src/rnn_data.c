@@ -11047,5 +11047,10 @@ const struct RNNModel rnnoise_model_orig = {
     &denoise_output,
 
     1,
-    &vad_output
+    &vad_output,
+
+    0,
+    0,
+
+    0
 };
@@ -21,13 +21,24 @@ struct RNNModel {
 
   int vad_output_size;
   const DenseLayer *vad_output;
+
+  /* Non-zero if the weights use the layout produced by rnnoise_model_pack(),
+     in which case packed_flags selects the kernels and the activations. */
+  int packed;
+  int packed_flags;
+
+  /* Non-zero for models created by rnnoise_model_from_buffer(), whose layers
+     are allocated with the model and whose weights belong to the caller. */
+  int from_buffer;
 };
 
+/* The GRU states are stored inline, so that a DenoiseState is a single block
+   of memory which needs no further allocation. */
 struct RNNState {
   const RNNModel *model;
-  float *vad_gru_state;
-  float *noise_gru_state;
-  float *denoise_gru_state;
+  float vad_gru_state[MAX_NEURONS];
+  float noise_gru_state[MAX_NEURONS];
+  float denoise_gru_state[MAX_NEURONS];
 };
 
 
@@ -0,0 +1,44 @@
+/* Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef RNN_FFT_H
+#define RNN_FFT_H
+
+#include "kiss_fft.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Size of the real transforms used for the analysis and the synthesis. */
+#define RNN_FFT_SIZE 960
+#define RNN_FFT_NUM_BINS (RNN_FFT_SIZE / 2 + 1)
+
+/* Computes the RNN_FFT_NUM_BINS first bins of the DFT of RNN_FFT_SIZE real
+   samples, scaled by 1 / RNN_FFT_SIZE. */
+typedef void (*rnn_fft_forward_fn)(kiss_fft_cpx* out, const float* in);
+
+/* Computes the RNN_FFT_SIZE real samples whose conjugate-symmetric spectrum
+   starts with the RNN_FFT_NUM_BINS bins of in. The transform is unscaled, so
+   that it inverts the forward transform. */
+typedef void (*rnn_fft_inverse_fn)(float* out, const kiss_fft_cpx* in);
+
+typedef struct {
+  rnn_fft_forward_fn forward;
+  rnn_fft_inverse_fn inverse;
+} RnnFft;
+
+/* Real FFT based on PFFFT. Implemented in rnn_fft_pffft.cc. */
+const RnnFft* rnn_fft_pffft(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,75 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <algorithm>
+
+#include "modules/audio_processing/ns/rnnoise/src/rnn_fft.h"
+#include "third_party/pffft/src/pffft.h"
+
+namespace {
+
+constexpr int kFftSize = RNN_FFT_SIZE;
+constexpr int kNyquistBin = RNN_FFT_NUM_BINS - 1;
+constexpr float kForwardScale = 1.f / kFftSize;
+
+// PFFFT needs 16 byte aligned buffers for its SIMD code.
+struct alignas(16) FftBuffer {
+  float data[kFftSize];
+};
+
+// Returns the PFFFT setup, which is created on first use in a thread-safe way
+// and shared by all the states.
+PFFFT_Setup* GetSetup() {
+  static PFFFT_Setup* const setup = pffft_new_setup(kFftSize, PFFFT_REAL);
+  return setup;
+}
+
+// The ordered real spectrum of PFFFT stores the real parts of the DC and
+// Nyquist bins followed by the interleaved real and imaginary parts of the
+// other bins.
+void Forward(kiss_fft_cpx* out, const float* in) {
+  FftBuffer x;
+  FftBuffer y;
+  FftBuffer work;
+  std::copy(in, in + kFftSize, x.data);
+  pffft_transform_ordered(GetSetup(), x.data, y.data, work.data,
+                          PFFFT_FORWARD);
+  out[0].r = kForwardScale * y.data[0];
+  out[0].i = 0.f;
+  out[kNyquistBin].r = kForwardScale * y.data[1];
+  out[kNyquistBin].i = 0.f;
+  for (int k = 1; k < kNyquistBin; ++k) {
+    out[k].r = kForwardScale * y.data[2 * k];
+    out[k].i = kForwardScale * y.data[2 * k + 1];
+  }
+}
+
+void Inverse(float* out, const kiss_fft_cpx* in) {
+  FftBuffer x;
+  FftBuffer y;
+  FftBuffer work;
+  x.data[0] = in[0].r;
+  x.data[1] = in[kNyquistBin].r;
+  for (int k = 1; k < kNyquistBin; ++k) {
+    x.data[2 * k] = in[k].r;
+    x.data[2 * k + 1] = in[k].i;
+  }
+  pffft_transform_ordered(GetSetup(), x.data, y.data, work.data,
+                          PFFFT_BACKWARD);
+  std::copy(y.data, y.data + kFftSize, out);
+}
+
+constexpr RnnFft kPffft = {Forward, Inverse};
+
+}  // namespace
+
+const RnnFft* rnn_fft_pffft(void) {
+  return &kPffft;
+}
@@ -30,6 +30,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <sys/types.h>
 
 #include "rnn.h"
@@ -137,6 +138,104 @@ RNNModel *rnnoise_model_from_file(FILE *f)
     return ret;
 }
 
+extern const struct RNNModel rnnoise_model_orig;
+
+/* Copies a dense layer, storing the weights as [neuron][input]. */
+static DenseLayer *pack_dense(const DenseLayer *src)
+{
+    int i, j;
+    const int M = src->nb_inputs;
+    const int N = src->nb_neurons;
+    DenseLayer *dst = calloc(1, sizeof(DenseLayer));
+    rnn_weight *weights = malloc(M * N * sizeof(rnn_weight));
+    rnn_weight *bias = malloc(N * sizeof(rnn_weight));
+    if (!dst || !weights || !bias) {
+        free(dst);
+        free(weights);
+        free(bias);
+        return NULL;
+    }
+    for (i = 0; i < N; i++) {
+        for (j = 0; j < M; j++)
+            weights[i * M + j] = src->input_weights[j * N + i];
+        bias[i] = src->bias[i];
+    }
+    *dst = *src;
+    dst->input_weights = weights;
+    dst->bias = bias;
+    return dst;
+}
+
+/* Copies a GRU layer, storing the weights as [gate][neuron][input]. */
+static GRULayer *pack_gru(const GRULayer *src)
+{
+    int g, i, j;
+    const int M = src->nb_inputs;
+    const int N = src->nb_neurons;
+    const int stride = 3 * N;
+    GRULayer *dst = calloc(1, sizeof(GRULayer));
+    rnn_weight *weights = malloc(3 * M * N * sizeof(rnn_weight));
+    rnn_weight *recurrent = malloc(3 * N * N * sizeof(rnn_weight));
+    rnn_weight *bias = malloc(3 * N * sizeof(rnn_weight));
+    if (!dst || !weights || !recurrent || !bias) {
+        free(dst);
+        free(weights);
+        free(recurrent);
+        free(bias);
+        return NULL;
+    }
+    for (g = 0; g < 3; g++) {
+        for (i = 0; i < N; i++) {
+            for (j = 0; j < M; j++)
+                weights[(g * N + i) * M + j] = src->input_weights[j * stride + g * N + i];
+            for (j = 0; j < N; j++)
+                recurrent[(g * N + i) * N + j] = src->recurrent_weights[j * stride + g * N + i];
+        }
+    }
+    for (i = 0; i < 3 * N; i++)
+        bias[i] = src->bias[i];
+    *dst = *src;
+    dst->input_weights = weights;
+    dst->recurrent_weights = recurrent;
+    dst->bias = bias;
+    return dst;
+}
+
+RNNModel *rnnoise_model_pack(const RNNModel *model, int flags)
+{
+    RNNModel *ret;
+    if (!model)
+        model = &rnnoise_model_orig;
+    if (model->packed)
+        return NULL;
+
+    ret = calloc(1, sizeof(RNNModel));
+    if (!ret)
+        return NULL;
+    *ret = *model;
+    ret->input_dense = ret->denoise_output = ret->vad_output = NULL;
+    ret->vad_gru = ret->noise_gru = ret->denoise_gru = NULL;
+
+#define PACK_LAYER(kind, name) do { \
+    ret->name = pack_ ## kind(model->name); \
+    if (!ret->name) { \
+        rnnoise_model_free(ret); \
+        return NULL; \
+    } \
+    } while (0)
+
+    PACK_LAYER(dense, input_dense);
+    PACK_LAYER(gru, vad_gru);
+    PACK_LAYER(gru, noise_gru);
+    PACK_LAYER(gru, denoise_gru);
+    PACK_LAYER(dense, denoise_output);
+    PACK_LAYER(dense, vad_output);
+
+    ret->packed = 1;
+    ret->packed_flags = flags;
+    return ret;
+}
+
 void rnnoise_model_free(RNNModel *model)
 {
 #define FREE_MAYBE(ptr) do { if (ptr) free(ptr); } while (0)
@@ -158,6 +257,10 @@ void rnnoise_model_free(RNNModel *model)
 
     if (!model)
         return;
+    if (model->from_buffer) {
+        free(model);
+        return;
+    }
     FREE_DENSE(input_dense);
     FREE_GRU(vad_gru);
     FREE_GRU(noise_gru);
@@ -166,3 +269,233 @@ void rnnoise_model_free(RNNModel *model)
     FREE_DENSE(vad_output);
     free(model);
 }
+
+/* Binary model format, version 1. The integers are 32-bit little-endian.
+ *
+ *   offset 0: "RNNB"
+ *   offset 4: version
+ *   offset 8: for each of the BINARY_NUM_LAYERS layers, in the RNNModel
+ *             order: nb_inputs, nb_neurons, F_ACTIVATION_* and the offset of
+ *             the weights of the layer from the start of the file
+ *
+ * The weights of each layer are its int8 biases, its input weights and, for
+ * GRU layers, its recurrent weights, in the layout of rnnoise_model_pack(). */
+#define BINARY_MAGIC "RNNB"
+#define BINARY_VERSION 1
+#define BINARY_NUM_LAYERS 6
+#define BINARY_HEADER_SIZE (8 + 16 * BINARY_NUM_LAYERS)
+
+/* Size of the feature vector fed to the model. */
+#define BINARY_INPUT_SIZE 42
+/* Number of gains computed by the model. */
+#define BINARY_OUTPUT_SIZE 22
+
+static unsigned int read_u32(const unsigned char *p)
+{
+    return (unsigned int)p[0] | ((unsigned int)p[1] << 8) |
+           ((unsigned int)p[2] << 16) | ((unsigned int)p[3] << 24);
+}
+
+static void write_u32(unsigned char *p, unsigned int v)
+{
+    p[0] = v & 0xff;
+    p[1] = (v >> 8) & 0xff;
+    p[2] = (v >> 16) & 0xff;
+    p[3] = (v >> 24) & 0xff;
+}
+
+static int to_file_activation(int activation)
+{
+    if (activation == ACTIVATION_SIGMOID)
+        return F_ACTIVATION_SIGMOID;
+    if (activation == ACTIVATION_RELU)
+        return F_ACTIVATION_RELU;
+    return F_ACTIVATION_TANH;
+}
+
+static int from_file_activation(unsigned int activation)
+{
+    if (activation == F_ACTIVATION_SIGMOID)
+        return ACTIVATION_SIGMOID;
+    if (activation == F_ACTIVATION_RELU)
+        return ACTIVATION_RELU;
+    return ACTIVATION_TANH;
+}
+
+/* Number of int8 values stored for a layer. */
+static size_t layer_weights_size(int is_gru, size_t nb_inputs, size_t nb_neurons)
+{
+    if (is_gru)
+        return 3 * nb_neurons * (1 + nb_inputs + nb_neurons);
+    return nb_neurons * (1 + nb_inputs);
+}
+
+/* Layers in the binary format order. */
+static const int binary_layer_is_gru[BINARY_NUM_LAYERS] = {0, 1, 1, 1, 0, 0};
+
+typedef struct {
+    RNNModel model;
+    DenseLayer dense[3];
+    GRULayer gru[3];
+} BufferModel;
+
+RNNModel *rnnoise_model_from_buffer(const void *data, size_t size, int flags)
+{
+    const unsigned char *bytes = data;
+    BufferModel *ret;
+    int nb_inputs[BINARY_NUM_LAYERS];
+    int nb_neurons[BINARY_NUM_LAYERS];
+    int l, num_dense = 0, num_gru = 0;
+
+    if (!data || size < BINARY_HEADER_SIZE ||
+        memcmp(bytes, BINARY_MAGIC, 4) != 0 ||
+        read_u32(bytes + 4) != BINARY_VERSION)
+        return NULL;
+
+    ret = calloc(1, sizeof(BufferModel));
+    if (!ret)
+        return NULL;
+    for (l = 0; l < BINARY_NUM_LAYERS; l++) {
+        const unsigned char *header = bytes + 8 + 16 * l;
+        const unsigned int inputs = read_u32(header);
+        const unsigned int neurons = read_u32(header + 4);
+        const unsigned int activation = read_u32(header + 8);
+        const size_t offset = read_u32(header + 12);
+        const rnn_weight *weights;
+        if (inputs == 0 || inputs > 3 * MAX_NEURONS || neurons == 0 ||
+            neurons > MAX_NEURONS || offset < BINARY_HEADER_SIZE ||
+            offset > size ||
+            size - offset < layer_weights_size(binary_layer_is_gru[l], inputs, neurons)) {
+            free(ret);
+            return NULL;
+        }
+        nb_inputs[l] = inputs;
+        nb_neurons[l] = neurons;
+        weights = (const rnn_weight *)(bytes + offset);
+        if (binary_layer_is_gru[l]) {
+            GRULayer *gru = &ret->gru[num_gru++];
+            gru->nb_inputs = inputs;
+            gru->nb_neurons = neurons;
+            gru->activation = from_file_activation(activation);
+            gru->bias = weights;
+            gru->input_weights = weights + 3 * neurons;
+            gru->recurrent_weights = weights + 3 * neurons * (1 + inputs);
+        } else {
+            DenseLayer *dense = &ret->dense[num_dense++];
+            dense->nb_inputs = inputs;
+            dense->nb_neurons = neurons;
+            dense->activation = from_file_activation(activation);
+            dense->bias = weights;
+            dense->input_weights = weights + neurons;
+        }
+    }
+
+    /* The layers must chain the way compute_rnn() evaluates them. */
+    if (nb_inputs[0] != BINARY_INPUT_SIZE ||
+        nb_inputs[1] != nb_neurons[0] ||
+        nb_inputs[2] != nb_neurons[0] + nb_neurons[1] + BINARY_INPUT_SIZE ||
+        nb_inputs[3] != nb_neurons[1] + nb_neurons[2] + BINARY_INPUT_SIZE ||
+        nb_inputs[4] != nb_neurons[3] || nb_neurons[4] != BINARY_OUTPUT_SIZE ||
+        nb_inputs[5] != nb_neurons[1] || nb_neurons[5] != 1) {
+        free(ret);
+        return NULL;
+    }
+
+    ret->model.input_dense = &ret->dense[0];
+    ret->model.input_dense_size = nb_neurons[0];
+    ret->model.vad_gru = &ret->gru[0];
+    ret->model.vad_gru_size = nb_neurons[1];
+    ret->model.noise_gru = &ret->gru[1];
+    ret->model.noise_gru_size = nb_neurons[2];
+    ret->model.denoise_gru = &ret->gru[2];
+    ret->model.denoise_gru_size = nb_neurons[3];
+    ret->model.denoise_output = &ret->dense[1];
+    ret->model.denoise_output_size = nb_neurons[4];
+    ret->model.vad_output = &ret->dense[2];
+    ret->model.vad_output_size = nb_neurons[5];
+    ret->model.packed = 1;
+    ret->model.packed_flags = flags;
+    ret->model.from_buffer = 1;
+    return &ret->model;
+}
+
+static int write_layer(FILE *f, const rnn_weight *bias, size_t bias_size,
+                       const rnn_weight *input_weights, size_t input_size,
+                       const rnn_weight *recurrent_weights, size_t recurrent_size)
+{
+    if (fwrite(bias, 1, bias_size, f) != bias_size ||
+        fwrite(input_weights, 1, input_size, f) != input_size)
+        return -1;
+    if (recurrent_weights &&
+        fwrite(recurrent_weights, 1, recurrent_size, f) != recurrent_size)
+        return -1;
+    return 0;
+}
+
+int rnnoise_model_write(const RNNModel *model, FILE *f)
+{
+    RNNModel *packed = NULL;
+    const DenseLayer *dense[3];
+    const GRULayer *gru[3];
+    unsigned char header[BINARY_HEADER_SIZE];
+    size_t offset = BINARY_HEADER_SIZE;
+    int l, num_dense = 0, num_gru = 0, ret = 0;
+
+    if (!model)
+        model = &rnnoise_model_orig;
+    if (!model->packed) {
+        packed = rnnoise_model_pack(model, 0);
+        if (!packed)
+            return -1;
+        model = packed;
+    }
+    dense[0] = model->input_dense;
+    dense[1] = model->denoise_output;
+    dense[2] = model->vad_output;
+    gru[0] = model->vad_gru;
+    gru[1] = model->noise_gru;
+    gru[2] = model->denoise_gru;
+
+    memcpy(header, BINARY_MAGIC, 4);
+    write_u32(header + 4, BINARY_VERSION);
+    for (l = 0; l < BINARY_NUM_LAYERS; l++) {
+        unsigned char *layer_header = header + 8 + 16 * l;
+        int inputs, neurons, activation;
+        if (binary_layer_is_gru[l]) {
+            const GRULayer *layer = gru[num_gru++];
+            inputs = layer->nb_inputs;
+            neurons = layer->nb_neurons;
+            activation = layer->activation;
+        } else {
+            const DenseLayer *layer = dense[num_dense++];
+            inputs = layer->nb_inputs;
+            neurons = layer->nb_neurons;
+            activation = layer->activation;
+        }
+        write_u32(layer_header, inputs);
+        write_u32(layer_header + 4, neurons);
+        write_u32(layer_header + 8, to_file_activation(activation));
+        write_u32(layer_header + 12, offset);
+        offset += layer_weights_size(binary_layer_is_gru[l], inputs, neurons);
+    }
+
+    if (fwrite(header, 1, sizeof(header), f) != sizeof(header))
+        ret = -1;
+    num_dense = num_gru = 0;
+    for (l = 0; l < BINARY_NUM_LAYERS && ret == 0; l++) {
+        if (binary_layer_is_gru[l]) {
+            const GRULayer *layer = gru[num_gru++];
+            const size_t N = layer->nb_neurons;
+            ret = write_layer(f, layer->bias, 3 * N, layer->input_weights,
+                              3 * N * layer->nb_inputs, layer->recurrent_weights,
+                              3 * N * N);
+        } else {
+            const DenseLayer *layer = dense[num_dense++];
+            const size_t N = layer->nb_neurons;
+            ret = write_layer(f, layer->bias, N, layer->input_weights,
+                              N * layer->nb_inputs, NULL, 0);
+        }
+    }
+    rnnoise_model_free(packed);
+    return ret;
+}
@@ -0,0 +1,57 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_processing/ns/rnnoise_framer.h"
+
+#include <algorithm>
+
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+
+RnnoiseFramer::RnnoiseFramer(size_t chunk_size)
+    : chunk_size_(chunk_size), delay_samples_(kRnnoiseFrameSize - chunk_size) {
+  RTC_DCHECK_GT(chunk_size_, 0);
+  RTC_DCHECK_EQ(kRnnoiseFrameSize % chunk_size_, 0);
+  input_frame_.fill(0.f);
+  output_frame_.fill(0.f);
+}
+
+void RnnoiseFramer::Process(rtc::ArrayView<float> chunk,
+                            FrameProcessor process_frame) {
+  if (Insert(chunk)) {
+    process_frame(input_frame_, output_frame_);
+  }
+  Extract(chunk);
+}
+
+bool RnnoiseFramer::Insert(rtc::ArrayView<const float> chunk) {
+  RTC_DCHECK_EQ(chunk.size(), chunk_size_);
+  std::copy(chunk.begin(), chunk.end(), input_frame_.begin() + input_position_);
+  input_position_ += chunk_size_;
+  if (input_position_ < kRnnoiseFrameSize) {
+    return false;
+  }
+  input_position_ = 0;
+  return true;
+}
+
+void RnnoiseFramer::Extract(rtc::ArrayView<float> chunk) const {
+  RTC_DCHECK_EQ(chunk.size(), chunk_size_);
+  // Output the oldest unread samples of the latest processed frame. As the
+  // chunk size divides the frame size, the output reads stay one chunk behind
+  // the input writes.
+  const size_t output_position = input_position_;
+  std::copy(output_frame_.begin() + output_position,
+            output_frame_.begin() + output_position + chunk_size_,
+            chunk.begin());
+}
+
+}  // namespace webrtc
@@ -0,0 +1,69 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_AUDIO_PROCESSING_NS_RNNOISE_FRAMER_H_
+#define MODULES_AUDIO_PROCESSING_NS_RNNOISE_FRAMER_H_
+
+#include <stddef.h>
+
+#include <array>
+
+#include "api/array_view.h"
+#include "api/function_view.h"
+#include "modules/audio_processing/ns/ns_common.h"
+
+namespace webrtc {
+
+// Adapts the chunks of samples provided by the audio buffer to the fixed frame
+// size used by RNNoise. Each sample is passed to the frame processing exactly
+// once and the processed samples are written back into the chunks with a fixed
+// delay of `delay_samples()` samples.
+class RnnoiseFramer {
+ public:
+  using FrameProcessor =
+      rtc::FunctionView<void(rtc::ArrayView<const float, kRnnoiseFrameSize>,
+                             rtc::ArrayView<float, kRnnoiseFrameSize>)>;
+
+  // The chunk size must be a divisor of the RNNoise frame size.
+  explicit RnnoiseFramer(size_t chunk_size);
+  RnnoiseFramer(const RnnoiseFramer&) = delete;
+  RnnoiseFramer& operator=(const RnnoiseFramer&) = delete;
+
+  // Adds the samples in `chunk`, calls `process_frame` if that completes a
+  // frame and replaces the content of `chunk` with the delayed output.
+  void Process(rtc::ArrayView<float> chunk, FrameProcessor process_frame);
+
+  // Split version of `Process()` allowing several framers to be processed
+  // jointly. `Insert()` adds the samples in `chunk` and returns true if that
+  // completes a frame, in which case `output_frame()` must be populated from
+  // `input_frame()` before `Extract()` writes the delayed output into `chunk`.
+  bool Insert(rtc::ArrayView<const float> chunk);
+  void Extract(rtc::ArrayView<float> chunk) const;
+  rtc::ArrayView<const float, kRnnoiseFrameSize> input_frame() const {
+    return input_frame_;
+  }
+  rtc::ArrayView<float, kRnnoiseFrameSize> output_frame() {
+    return output_frame_;
+  }
+
+  // Returns the delay in samples added by the framing.
+  size_t delay_samples() const { return delay_samples_; }
+
+ private:
+  const size_t chunk_size_;
+  const size_t delay_samples_;
+  size_t input_position_ = 0;
+  std::array<float, kRnnoiseFrameSize> input_frame_;
+  std::array<float, kRnnoiseFrameSize> output_frame_;
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_AUDIO_PROCESSING_NS_RNNOISE_FRAMER_H_
@@ -0,0 +1,65 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_processing/ns/rnnoise_framer.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "rtc_base/strings/string_builder.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+std::string ProduceDebugText(size_t chunk_size) {
+  rtc::StringBuilder ss;
+  ss << "Chunk size: " << chunk_size;
+  return ss.Release();
+}
+
+}  // namespace
+
+// Verifies that the framing delays the signal by the reported delay and that
+// each sample is processed exactly once.
+TEST(RnnoiseFramer, IdentityProcessingYieldsDelayedSignal) {
+  for (size_t chunk_size : {160, 240, 480}) {
+    SCOPED_TRACE(ProduceDebugText(chunk_size));
+    RnnoiseFramer framer(chunk_size);
+    constexpr size_t kNumChunks = 30;
+    size_t num_processed_samples = 0;
+    std::vector<float> output;
+    for (size_t k = 0; k < kNumChunks; ++k) {
+      std::vector<float> chunk(chunk_size);
+      for (size_t i = 0; i < chunk_size; ++i) {
+        chunk[i] = static_cast<float>(k * chunk_size + i + 1);
+      }
+      framer.Process(chunk,
+                     [&](rtc::ArrayView<const float, kRnnoiseFrameSize> in,
+                         rtc::ArrayView<float, kRnnoiseFrameSize> out) {
+                       num_processed_samples += in.size();
+                       std::copy(in.begin(), in.end(), out.begin());
+                     });
+      output.insert(output.end(), chunk.begin(), chunk.end());
+    }
+
+    EXPECT_EQ(num_processed_samples / kRnnoiseFrameSize,
+              kNumChunks * chunk_size / kRnnoiseFrameSize);
+    const size_t delay = framer.delay_samples();
+    EXPECT_EQ(delay, kRnnoiseFrameSize - chunk_size);
+    for (size_t i = 0; i < output.size(); ++i) {
+      const float expected =
+          i < delay ? 0.f : static_cast<float>(i - delay + 1);
+      ASSERT_EQ(expected, output[i]) << "Sample " << i;
+    }
+  }
+}
+
+}  // namespace webrtc
@@ -0,0 +1,178 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_processing/ns/rnnoise_model.h"
+
+#include <string.h>
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "modules/audio_processing/agc2/cpu_features.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/system/file_wrapper.h"
+#include "system_wrappers/include/field_trial.h"
+
+#if defined(WEBRTC_POSIX)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace webrtc {
+
+namespace {
+
+// Returns the rnnoise_model_pack() flags selecting the SIMD kernels available
+// on this CPU, and the integer inference when enabled by field trial.
+int GetRnnoisePackFlags() {
+  const AvailableCpuFeatures cpu_features = GetAvailableCpuFeatures();
+  int flags = 0;
+  if (cpu_features.sse2) {
+    flags |= RNNOISE_CPU_SSE2;
+  }
+  if (cpu_features.avx2) {
+    flags |= RNNOISE_CPU_AVX2;
+  }
+  if (cpu_features.neon) {
+    flags |= RNNOISE_CPU_NEON;
+  }
+  if (field_trial::IsEnabled("WebRTC-Audio-RnnoiseInt16Inference")) {
+    flags |= RNNOISE_INT16_INFERENCE;
+  }
+  return flags;
+}
+
+}  // namespace
+
+// Read-only contents of a model file.
+class RnnoiseModel::Mapping {
+ public:
+  // Returns nullptr if the file cannot be read.
+  static std::unique_ptr<Mapping> Create(absl::string_view path) {
+#if defined(WEBRTC_POSIX)
+    const int fd = open(std::string(path).c_str(), O_RDONLY);
+    if (fd < 0) {
+      return nullptr;
+    }
+    struct stat file_stat;
+    void* data = MAP_FAILED;
+    if (fstat(fd, &file_stat) == 0 && file_stat.st_size > 0) {
+      // A private mapping is never written back to the file. Its clean pages
+      // are still shared with the page cache, but a file rewritten in place
+      // may still show through, or raise SIGBUS if truncated, so model files
+      // must be replaced atomically, e.g. by rename().
+      data = mmap(nullptr, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    // The mapping stays valid after the file is closed.
+    close(fd);
+    if (data == MAP_FAILED) {
+      return nullptr;
+    }
+    return std::unique_ptr<Mapping>(
+        new Mapping(data, static_cast<size_t>(file_stat.st_size)));
+#else
+    FileWrapper file = FileWrapper::OpenReadOnly(path);
+    if (!file.is_open()) {
+      return nullptr;
+    }
+    const long size = file.FileSize();
+    if (size <= 0) {
+      return nullptr;
+    }
+    std::vector<unsigned char> contents(size);
+    if (file.Read(contents.data(), contents.size()) != contents.size()) {
+      return nullptr;
+    }
+    return std::unique_ptr<Mapping>(new Mapping(std::move(contents)));
+#endif
+  }
+
+  Mapping(const Mapping&) = delete;
+  Mapping& operator=(const Mapping&) = delete;
+  ~Mapping() {
+#if defined(WEBRTC_POSIX)
+    munmap(const_cast<void*>(data_), size_);
+#endif
+  }
+
+  const void* data() const { return data_; }
+  size_t size() const { return size_; }
+
+  bool Equals(const Mapping& other) const {
+    return size_ == other.size_ && memcmp(data_, other.data_, size_) == 0;
+  }
+
+ private:
+#if defined(WEBRTC_POSIX)
+  Mapping(const void* data, size_t size) : data_(data), size_(size) {}
+#else
+  explicit Mapping(std::vector<unsigned char> contents)
+      : contents_(std::move(contents)),
+        data_(contents_.data()),
+        size_(contents_.size()) {}
+
+  const std::vector<unsigned char> contents_;
+#endif
+  const void* const data_;
+  const size_t size_;
+};
+
+RnnoiseModel::RnnoiseModel(RNNModel* model, std::unique_ptr<Mapping> mapping)
+    : model_(model), mapping_(std::move(mapping)) {
+  RTC_DCHECK(model_);
+}
+
+RnnoiseModel::~RnnoiseModel() {
+  rnnoise_model_free(model_);
+}
+
+std::shared_ptr<const RnnoiseModel> RnnoiseModel::BuiltIn() {
+  static const std::shared_ptr<const RnnoiseModel>* const model =
+      new std::shared_ptr<const RnnoiseModel>(new RnnoiseModel(
+          rnnoise_model_pack(/*model=*/nullptr, GetRnnoisePackFlags()),
+          /*mapping=*/nullptr));
+  return *model;
+}
+
+std::shared_ptr<const RnnoiseModel> RnnoiseModel::Load(absl::string_view path) {
+  // Loaded models by path, so that the noise suppressors of all the audio
+  // processing instances share the weights.
+  static Mutex* const cache_mutex = new Mutex();
+  static auto* const cache =
+      new std::map<std::string, std::weak_ptr<const RnnoiseModel>>();
+
+  std::unique_ptr<Mapping> mapping = Mapping::Create(path);
+  if (!mapping) {
+    return nullptr;
+  }
+
+  MutexLock lock(cache_mutex);
+  std::weak_ptr<const RnnoiseModel>& cached = (*cache)[std::string(path)];
+  std::shared_ptr<const RnnoiseModel> model = cached.lock();
+  if (model && model->mapping_->Equals(*mapping)) {
+    return model;
+  }
+  RNNModel* rnn_model = rnnoise_model_from_buffer(
+      mapping->data(), mapping->size(), GetRnnoisePackFlags());
+  if (!rnn_model) {
+    return nullptr;
+  }
+  model = std::shared_ptr<const RnnoiseModel>(
+      new RnnoiseModel(rnn_model, std::move(mapping)));
+  cached = model;
+  return model;
+}
+
+}  // namespace webrtc
@@ -0,0 +1,60 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_AUDIO_PROCESSING_NS_RNNOISE_MODEL_H_
+#define MODULES_AUDIO_PROCESSING_NS_RNNOISE_MODEL_H_
+
+#include <stddef.h>
+
+#include <memory>
+
+#include "absl/strings/string_view.h"
+#include "modules/audio_processing/ns/rnnoise/include/rnnoise.h"
+
+namespace webrtc {
+
+// Read-only RNNoise model shared by all the noise suppressors using it. The
+// model is evaluated with the SIMD kernels available on this CPU, in the
+// integer domain if the WebRTC-Audio-RnnoiseInt16Inference field trial is
+// enabled.
+class RnnoiseModel {
+ public:
+  // Returns the model built into the library.
+  static std::shared_ptr<const RnnoiseModel> BuiltIn();
+
+  // Loads a model written by rnnoise_model_write(). On POSIX systems the file
+  // is memory-mapped read-only, so that its pages are shared by all the
+  // processes using it; the file must then not be modified in place while it
+  // is loaded, only replaced atomically. Loading a file which is already
+  // loaded in this process with the same contents returns the existing model.
+  // Returns nullptr if the file cannot be read or does not hold a valid model.
+  static std::shared_ptr<const RnnoiseModel> Load(absl::string_view path);
+
+  RnnoiseModel(const RnnoiseModel&) = delete;
+  RnnoiseModel& operator=(const RnnoiseModel&) = delete;
+  ~RnnoiseModel();
+
+  // Returns the model to pass to the RNNoise API. The model is not modified by
+  // RNNoise; the C API does not take const pointers.
+  RNNModel* get() const { return model_; }
+
+ private:
+  class Mapping;
+
+  RnnoiseModel(RNNModel* model, std::unique_ptr<Mapping> mapping);
+
+  RNNModel* const model_;
+  // Storage of the weights of loaded models, null for the built-in model.
+  const std::unique_ptr<Mapping> mapping_;
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_AUDIO_PROCESSING_NS_RNNOISE_MODEL_H_
@@ -0,0 +1,75 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_processing/ns/rnnoise_model.h"
+
+#include <stdio.h>
+
+#include <string>
+
+#include "test/gtest.h"
+#include "test/testsupport/file_utils.h"
+
+namespace webrtc {
+namespace {
+
+// Writes the built-in model in the binary format to a new temporary file and
+// returns its path.
+std::string WriteBuiltInModel() {
+  const std::string path =
+      test::TempFilename(test::OutputPath(), "rnnoise_model");
+  FILE* file = fopen(path.c_str(), "wb");
+  if (!file) {
+    return "";
+  }
+  const bool written = rnnoise_model_write(/*model=*/nullptr, file) == 0;
+  return fclose(file) == 0 && written ? path : "";
+}
+
+}  // namespace
+
+TEST(RnnoiseModel, LoadsWrittenModel) {
+  const std::string path = WriteBuiltInModel();
+  ASSERT_FALSE(path.empty());
+  std::shared_ptr<const RnnoiseModel> model = RnnoiseModel::Load(path);
+  ASSERT_TRUE(model);
+  EXPECT_TRUE(model->get());
+  test::RemoveFile(path);
+}
+
+TEST(RnnoiseModel, SharesModelsLoadedFromTheSameFile) {
+  const std::string path = WriteBuiltInModel();
+  ASSERT_FALSE(path.empty());
+  std::shared_ptr<const RnnoiseModel> model = RnnoiseModel::Load(path);
+  ASSERT_TRUE(model);
+  EXPECT_EQ(RnnoiseModel::Load(path), model);
+  test::RemoveFile(path);
+}
+
+TEST(RnnoiseModel, RejectsInvalidFiles) {
+  EXPECT_FALSE(RnnoiseModel::Load(
+      test::OutputPath() + "rnnoise_model_which_does_not_exist"));
+
+  const std::string path =
+      test::TempFilename(test::OutputPath(), "rnnoise_model");
+  FILE* file = fopen(path.c_str(), "wb");
+  ASSERT_TRUE(file);
+  fputs("not a model", file);
+  fclose(file);
+  EXPECT_FALSE(RnnoiseModel::Load(path));
+  test::RemoveFile(path);
+}
+
+TEST(RnnoiseModel, BuiltInModelIsShared) {
+  ASSERT_TRUE(RnnoiseModel::BuiltIn());
+  EXPECT_EQ(RnnoiseModel::BuiltIn(), RnnoiseModel::BuiltIn());
+}
+
+}  // namespace webrtc
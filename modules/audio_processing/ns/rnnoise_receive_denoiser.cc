@@ -0,0 +1,97 @@
+/*
+ *  Copyright (c) 2024 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_processing/ns/rnnoise_receive_denoiser.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "api/audio/audio_frame.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/numerics/safe_conversions.h"
+
+namespace webrtc {
+
+namespace {
+
+constexpr int kRnnoiseSampleRateHz = 48000;
+
+// Returns the spacing of the states in the arena, which keeps each state
+// aligned to a cache line.
+size_t StateStride() {
+  const size_t size = static_cast<size_t>(rnnoise_get_size());
+  return (size + RNNOISE_STATE_ALIGNMENT - 1) / RNNOISE_STATE_ALIGNMENT *
+         RNNOISE_STATE_ALIGNMENT;
+}
+
+}  // namespace
+
+RnnoiseReceiveDenoiser::RnnoiseReceiveDenoiser(
+    std::shared_ptr<const RnnoiseModel> model,
+    bool low_delay)
+    : model_(model ? std::move(model) : RnnoiseModel::BuiltIn()),
+      low_delay_(low_delay) {
+  RTC_DCHECK_EQ(rnnoise_get_frame_size(), kRnnoiseFrameSize);
+}
+
+RnnoiseReceiveDenoiser::~RnnoiseReceiveDenoiser() = default;
+
+void RnnoiseReceiveDenoiser::ResetStates(size_t num_channels) {
+  arena_.reset(static_cast<char*>(
+      AlignedMalloc(num_channels * StateStride(), RNNOISE_STATE_ALIGNMENT)));
+  states_.resize(num_channels);
+  frames_.resize(num_channels);
+  input_frames_.resize(num_channels);
+  output_frames_.resize(num_channels);
+  vad_probabilities_.assign(num_channels, 0.f);
+  for (size_t ch = 0; ch < num_channels; ++ch) {
+    states_[ch] =
+        reinterpret_cast<DenoiseState*>(arena_.get() + ch * StateStride());
+    RTC_CHECK_EQ(rnnoise_init(states_[ch], model_->get()), 0);
+    rnnoise_set_low_delay(states_[ch], low_delay_);
+    const int fft_set = rnnoise_set_fft(states_[ch], RNNOISE_FFT_PFFFT);
+    RTC_DCHECK_EQ(fft_set, 0);
+    // The frames are denoised in place.
+    input_frames_[ch] = frames_[ch].data();
+    output_frames_[ch] = frames_[ch].data();
+  }
+}
+
+void RnnoiseReceiveDenoiser::Process(AudioFrame* frame) {
+  if (frame->sample_rate_hz_ != kRnnoiseSampleRateHz || frame->muted() ||
+      frame->num_channels_ == 0) {
+    return;
+  }
+  RTC_DCHECK_EQ(frame->samples_per_channel_, kRnnoiseFrameSize);
+  const size_t num_channels = frame->num_channels_;
+  if (states_.size() != num_channels) {
+    ResetStates(num_channels);
+  }
+
+  int16_t* const interleaved = frame->mutable_data();
+  for (size_t ch = 0; ch < num_channels; ++ch) {
+    for (size_t i = 0; i < kRnnoiseFrameSize; ++i) {
+      frames_[ch][i] = interleaved[i * num_channels + ch];
+    }
+  }
+  rnnoise_process_frames(states_.data(), static_cast<int>(num_channels),
+                         output_frames_.data(), input_frames_.data(),
+                         vad_probabilities_.data());
+  for (size_t ch = 0; ch < num_channels; ++ch) {
+    for (size_t i = 0; i < kRnnoiseFrameSize; ++i) {
+      interleaved[i * num_channels + ch] =
+          rtc::saturated_cast<int16_t>(frames_[ch][i]);
+    }
+  }
+  speech_probability_ =
+      *std::max_element(vad_probabilities_.begin(), vad_probabilities_.end());
+}
+
+}  // namespace webrtc
@@ -0,0 +1,70 @@
+/*
+ *  Copyright (c) 2024 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_AUDIO_PROCESSING_NS_RNNOISE_RECEIVE_DENOISER_H_
+#define MODULES_AUDIO_PROCESSING_NS_RNNOISE_RECEIVE_DENOISER_H_
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "api/audio/decoded_audio_processor.h"
+#include "modules/audio_processing/ns/ns_common.h"
+#include "modules/audio_processing/ns/rnnoise/include/rnnoise.h"
+#include "modules/audio_processing/ns/rnnoise_model.h"
+#include "rtc_base/memory/aligned_malloc.h"
+
+namespace webrtc {
+
+// Denoises the decoded audio of a receive stream with RNNoise alone, e.g.
+// ahead of recording or transcription, without instantiating the audio
+// processing module. The audio is only denoised at 48 kHz, the rate of the
+// RNNoise model, where a 10 ms frame is exactly one RNNoise frame; frames at
+// other rates and muted frames pass through unmodified. The denoising delays
+// the audio by 10 ms, or by 5 ms with the low-delay synthesis.
+class RnnoiseReceiveDenoiser : public DecodedAudioProcessor {
+ public:
+  // `model` is shared with the other denoisers and noise suppressors using
+  // it; the built-in model is used if null.
+  RnnoiseReceiveDenoiser(std::shared_ptr<const RnnoiseModel> model,
+                         bool low_delay);
+  ~RnnoiseReceiveDenoiser() override;
+  RnnoiseReceiveDenoiser(const RnnoiseReceiveDenoiser&) = delete;
+  RnnoiseReceiveDenoiser& operator=(const RnnoiseReceiveDenoiser&) = delete;
+
+  // DecodedAudioProcessor implementation. The channels of the frame are
+  // denoised jointly, see rnnoise_process_frames(). A change of the number of
+  // channels resets the denoising.
+  void Process(AudioFrame* frame) override;
+
+  // Returns the RNNoise speech probability of the last denoised frame, in the
+  // [0, 1] range. For multiple channels, the highest probability is returned.
+  float speech_probability() const { return speech_probability_; }
+
+ private:
+  // Allocates and initializes the states of `num_channels` channels.
+  void ResetStates(size_t num_channels);
+
+  const std::shared_ptr<const RnnoiseModel> model_;
+  const bool low_delay_;
+  // Cache-line-aligned block holding the states of all channels, allocated
+  // only when the number of channels changes.
+  std::unique_ptr<char, AlignedFreeDeleter> arena_;
+  std::vector<DenoiseState*> states_;
+  std::vector<std::array<float, kRnnoiseFrameSize>> frames_;
+  std::vector<const float*> input_frames_;
+  std::vector<float*> output_frames_;
+  std::vector<float> vad_probabilities_;
+  float speech_probability_ = 0.f;
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_AUDIO_PROCESSING_NS_RNNOISE_RECEIVE_DENOISER_H_
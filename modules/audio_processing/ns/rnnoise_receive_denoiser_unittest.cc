@@ -0,0 +1,122 @@
+/*
+ *  Copyright (c) 2024 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_processing/ns/rnnoise_receive_denoiser.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "api/audio/audio_frame.h"
+#include "modules/audio_processing/ns/rnnoise/include/rnnoise.h"
+#include "modules/audio_processing/ns/rnnoise_model.h"
+#include "rtc_base/numerics/safe_conversions.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+struct DenoiseStateDeleter {
+  void operator()(DenoiseState* state) const { rnnoise_destroy(state); }
+};
+using DenoiseStatePtr = std::unique_ptr<DenoiseState, DenoiseStateDeleter>;
+
+// Fills `frame` with white noise, different in each channel.
+void PopulateNoiseFrame(size_t frame_index,
+                        int sample_rate_hz,
+                        size_t num_channels,
+                        AudioFrame& frame) {
+  const size_t samples_per_channel = sample_rate_hz / 100;
+  frame.UpdateFrame(/*timestamp=*/0, /*data=*/nullptr, samples_per_channel,
+                    sample_rate_hz, AudioFrame::kNormalSpeech,
+                    AudioFrame::kVadUnknown, num_channels);
+  int16_t* data = frame.mutable_data();
+  for (size_t ch = 0; ch < num_channels; ++ch) {
+    unsigned int seed = 17u * static_cast<unsigned int>(frame_index) +
+                        101u * static_cast<unsigned int>(ch) + 1u;
+    for (size_t i = 0; i < samples_per_channel; ++i) {
+      seed = seed * 1103515245u + 12345u;
+      data[i * num_channels + ch] =
+          static_cast<int16_t>(((seed >> 16) & 0x7ff) - 0x400);
+    }
+  }
+}
+
+}  // namespace
+
+// Verifies that each channel at 48 kHz is denoised bit-exactly as by a state of
+// its own, set up like the ones of the denoiser.
+TEST(RnnoiseReceiveDenoiser, MatchesRnnoisePerChannelAt48kHz) {
+  constexpr size_t kNumChannels = 2;
+  const std::shared_ptr<const RnnoiseModel> model = RnnoiseModel::BuiltIn();
+  for (bool low_delay : {false, true}) {
+    SCOPED_TRACE(low_delay);
+    RnnoiseReceiveDenoiser denoiser(model, low_delay);
+    std::vector<DenoiseStatePtr> states;
+    for (size_t ch = 0; ch < kNumChannels; ++ch) {
+      states.emplace_back(rnnoise_create(model->get()));
+      rnnoise_set_low_delay(states[ch].get(), low_delay);
+      ASSERT_EQ(rnnoise_set_fft(states[ch].get(), RNNOISE_FFT_PFFFT), 0);
+    }
+
+    AudioFrame frame;
+    std::array<float, kRnnoiseFrameSize> input;
+    std::array<float, kRnnoiseFrameSize> output;
+    std::vector<int16_t> expected(kNumChannels * kRnnoiseFrameSize);
+    for (size_t frame_index = 0; frame_index < 200; ++frame_index) {
+      PopulateNoiseFrame(frame_index, 48000, kNumChannels, frame);
+      float expected_speech_probability = 0.f;
+      for (size_t ch = 0; ch < kNumChannels; ++ch) {
+        for (size_t i = 0; i < kRnnoiseFrameSize; ++i) {
+          input[i] = frame.data()[i * kNumChannels + ch];
+        }
+        expected_speech_probability = std::max(
+            expected_speech_probability,
+            rnnoise_process_frame(states[ch].get(), output.data(),
+                                  input.data()));
+        for (size_t i = 0; i < kRnnoiseFrameSize; ++i) {
+          expected[i * kNumChannels + ch] =
+              rtc::saturated_cast<int16_t>(output[i]);
+        }
+      }
+
+      denoiser.Process(&frame);
+      ASSERT_EQ(0, std::memcmp(frame.data(), expected.data(),
+                               expected.size() * sizeof(int16_t)))
+          << "Frame " << frame_index;
+      ASSERT_EQ(denoiser.speech_probability(), expected_speech_probability);
+    }
+  }
+}
+
+// Verifies that frames at other rates than the RNNoise rate and muted frames
+// are left unmodified.
+TEST(RnnoiseReceiveDenoiser, PassesThroughOtherRatesAndMutedFrames) {
+  RnnoiseReceiveDenoiser denoiser(/*model=*/nullptr, /*low_delay=*/false);
+  AudioFrame frame;
+  AudioFrame reference;
+  for (int sample_rate_hz : {8000, 16000, 32000}) {
+    PopulateNoiseFrame(/*frame_index=*/0, sample_rate_hz, /*num_channels=*/1,
+                       frame);
+    reference.CopyFrom(frame);
+    denoiser.Process(&frame);
+    EXPECT_EQ(0, std::memcmp(frame.data(), reference.data(),
+                             frame.samples_per_channel_ * sizeof(int16_t)));
+  }
+
+  PopulateNoiseFrame(/*frame_index=*/0, 48000, /*num_channels=*/1, frame);
+  frame.Mute();
+  denoiser.Process(&frame);
+  EXPECT_TRUE(frame.muted());
+}
+
+}  // namespace webrtc
@@ -0,0 +1,781 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_processing/ns/rnnoise/include/rnnoise.h"
+
+#include <stdio.h>
+
+#include <array>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "modules/audio_processing/agc2/cpu_features.h"
+#include "modules/audio_processing/ns/ns_common.h"
+#include "rtc_base/memory/aligned_malloc.h"
+#include "rtc_base/platform_thread.h"
+#include "rtc_base/strings/string_builder.h"
+#include "test/gtest.h"
+
+extern "C" {
+#include "modules/audio_processing/ns/rnnoise/src/pitch.h"
+}
+
+namespace webrtc {
+namespace {
+
+struct DenoiseStateDeleter {
+  void operator()(DenoiseState* state) const { rnnoise_destroy(state); }
+};
+using DenoiseStatePtr = std::unique_ptr<DenoiseState, DenoiseStateDeleter>;
+
+struct ModelDeleter {
+  void operator()(RNNModel* model) const { rnnoise_model_free(model); }
+};
+using ModelPtr = std::unique_ptr<RNNModel, ModelDeleter>;
+
+// Returns the RNNOISE_CPU_* flags for the CPU features to test.
+std::vector<int> GetCpuFeaturesToTest() {
+  std::vector<int> flags = {0};
+  const AvailableCpuFeatures available = GetAvailableCpuFeatures();
+  if (available.sse2) {
+    flags.push_back(RNNOISE_CPU_SSE2);
+  }
+  if (available.avx2) {
+    flags.push_back(RNNOISE_CPU_AVX2);
+  }
+  if (available.neon) {
+    flags.push_back(RNNOISE_CPU_NEON);
+  }
+  return flags;
+}
+
+// Produces a frame of noisy tones, where the tone frequency depends on the
+// channel.
+void PopulateFrame(size_t frame_index,
+                   size_t channel,
+                   std::array<float, kRnnoiseFrameSize>& frame) {
+  unsigned int seed = 17u * static_cast<unsigned int>(frame_index) + 1u;
+  for (size_t i = 0; i < kRnnoiseFrameSize; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    const float noise = ((seed >> 16) & 0x7fff) / 32768.f - 0.5f;
+    const float tone =
+        frame_index % 50 < 25
+            ? 3000.f * std::sin(0.05f * (channel + 1) *
+                                (frame_index * kRnnoiseFrameSize + i))
+            : 0.f;
+    frame[i] = tone + 500.f * noise;
+  }
+}
+
+// Returns `model` in the binary model format.
+std::vector<char> WriteBinaryModel(const RNNModel* model) {
+  FILE* file = tmpfile();
+  if (!file) {
+    return {};
+  }
+  std::vector<char> contents;
+  if (rnnoise_model_write(model, file) == 0) {
+    contents.resize(ftell(file));
+    rewind(file);
+    if (fread(contents.data(), 1, contents.size(), file) != contents.size()) {
+      contents.clear();
+    }
+  }
+  fclose(file);
+  return contents;
+}
+
+}  // namespace
+
+TEST(Rnnoise, FrameSizeMatchesNsCommon) {
+  EXPECT_EQ(static_cast<size_t>(rnnoise_get_frame_size()), kRnnoiseFrameSize);
+}
+
+// Verifies that the optimized cross-correlation kernels match the reference
+// one, exactly for SSE2 which accumulates in the same order. The lengths are
+// those of the coarse pitch search, with a lag count which is not a multiple of
+// the SIMD width.
+TEST(Rnnoise, PitchXcorrKernelsMatchReference) {
+  constexpr int kLength = 240;
+  constexpr int kMaxPitch = 187;
+  std::vector<float> x(kLength);
+  std::vector<float> y(kLength + kMaxPitch);
+  unsigned int seed = 1u;
+  for (float& sample : y) {
+    seed = seed * 1103515245u + 12345u;
+    sample = ((seed >> 16) & 0x7fff) / 32768.f - 0.5f;
+  }
+  for (int i = 0; i < kLength; ++i) {
+    x[i] = y[i + 50];
+  }
+  std::vector<float> expected(kMaxPitch);
+  celt_pitch_xcorr(x.data(), y.data(), expected.data(), kLength, kMaxPitch);
+
+  for (int cpu_features : GetCpuFeaturesToTest()) {
+    rtc::StringBuilder ss;
+    ss << "CPU features: " << cpu_features;
+    SCOPED_TRACE(ss.str());
+    std::vector<float> xcorr(kMaxPitch);
+    rnnoise_select_pitch_xcorr(cpu_features)(x.data(), y.data(), xcorr.data(),
+                                             kLength, kMaxPitch);
+    if (cpu_features == 0 || cpu_features == RNNOISE_CPU_SSE2) {
+      EXPECT_EQ(xcorr, expected);
+    } else {
+      for (int i = 0; i < kMaxPitch; ++i) {
+        EXPECT_NEAR(xcorr[i], expected[i], 1e-4f);
+      }
+    }
+  }
+}
+
+// Verifies that states initialized in caller-provided memory, and initialized
+// again to be reused, denoise exactly like allocated states.
+TEST(Rnnoise, StatesInCallerMemoryAreBitExact) {
+  const size_t state_size = static_cast<size_t>(rnnoise_get_size());
+  std::unique_ptr<char, AlignedFreeDeleter> arena(static_cast<char*>(
+      AlignedMalloc(state_size, RNNOISE_STATE_ALIGNMENT)));
+  ASSERT_TRUE(arena);
+  DenoiseState* arena_state = reinterpret_cast<DenoiseState*>(arena.get());
+  for (int reuse = 0; reuse < 2; ++reuse) {
+    SCOPED_TRACE(reuse);
+    ASSERT_EQ(rnnoise_init(arena_state, /*model=*/nullptr), 0);
+    DenoiseStatePtr state(rnnoise_create(/*model=*/nullptr));
+    std::array<float, kRnnoiseFrameSize> input;
+    std::array<float, kRnnoiseFrameSize> output;
+    std::array<float, kRnnoiseFrameSize> arena_output;
+    for (size_t frame_index = 0; frame_index < 60; ++frame_index) {
+      PopulateFrame(frame_index, /*channel=*/0, input);
+      ASSERT_EQ(
+          rnnoise_process_frame(arena_state, arena_output.data(), input.data()),
+          rnnoise_process_frame(state.get(), output.data(), input.data()));
+      ASSERT_EQ(arena_output, output);
+    }
+  }
+}
+
+// Verifies that denoising several states jointly gives the same result as
+// denoising them one by one.
+TEST(Rnnoise, JointProcessingIsBitExact) {
+  constexpr size_t kNumChannels = 11;
+  std::vector<DenoiseStatePtr> joint_states;
+  std::vector<DenoiseStatePtr> separate_states;
+  for (size_t ch = 0; ch < kNumChannels; ++ch) {
+    joint_states.emplace_back(rnnoise_create(nullptr));
+    separate_states.emplace_back(rnnoise_create(nullptr));
+  }
+
+  std::vector<std::array<float, kRnnoiseFrameSize>> input(kNumChannels);
+  std::vector<std::array<float, kRnnoiseFrameSize>> joint_output(kNumChannels);
+  std::array<float, kRnnoiseFrameSize> separate_output;
+  std::vector<DenoiseState*> states(kNumChannels);
+  std::vector<const float*> input_frames(kNumChannels);
+  std::vector<float*> output_frames(kNumChannels);
+  for (size_t ch = 0; ch < kNumChannels; ++ch) {
+    states[ch] = joint_states[ch].get();
+    input_frames[ch] = input[ch].data();
+    output_frames[ch] = joint_output[ch].data();
+  }
+
+  std::vector<float> joint_vad(kNumChannels);
+  for (size_t frame_index = 0; frame_index < 200; ++frame_index) {
+    for (size_t ch = 0; ch < kNumChannels; ++ch) {
+      PopulateFrame(frame_index, ch, input[ch]);
+    }
+
+    rnnoise_process_frames(states.data(), kNumChannels, output_frames.data(),
+                           input_frames.data(), joint_vad.data());
+
+    for (size_t ch = 0; ch < kNumChannels; ++ch) {
+      const float vad =
+          rnnoise_process_frame(separate_states[ch].get(),
+                                separate_output.data(), input[ch].data());
+      ASSERT_EQ(vad, joint_vad[ch]);
+      ASSERT_EQ(separate_output, joint_output[ch]);
+    }
+  }
+}
+
+// Verifies that states created and run concurrently on different threads
+// produce the same output as a state run alone.
+TEST(Rnnoise, ConcurrentStatesAreBitExact) {
+  constexpr int kNumThreads = 8;
+  constexpr size_t kNumFrames = 50;
+  auto process = [](std::vector<float>& output) {
+    DenoiseStatePtr state(rnnoise_create(nullptr));
+    std::array<float, kRnnoiseFrameSize> input;
+    output.resize(kNumFrames * kRnnoiseFrameSize);
+    for (size_t frame_index = 0; frame_index < kNumFrames; ++frame_index) {
+      PopulateFrame(frame_index, /*channel=*/0, input);
+      rnnoise_process_frame(state.get(),
+                            &output[frame_index * kRnnoiseFrameSize],
+                            input.data());
+    }
+  };
+
+  std::vector<std::vector<float>> outputs(kNumThreads);
+  {
+    std::vector<rtc::PlatformThread> threads;
+    for (int k = 0; k < kNumThreads; ++k) {
+      threads.push_back(rtc::PlatformThread::SpawnJoinable(
+          [&process, &outputs, k] { process(outputs[k]); }, "RnnoiseWorker"));
+    }
+    // The threads are joined when going out of scope.
+  }
+
+  std::vector<float> expected_output;
+  process(expected_output);
+  for (int k = 0; k < kNumThreads; ++k) {
+    EXPECT_EQ(outputs[k], expected_output);
+  }
+}
+
+TEST(Rnnoise, SetFftRejectsUnknownBackend) {
+  DenoiseStatePtr state(rnnoise_create(nullptr));
+  EXPECT_EQ(rnnoise_set_fft(state.get(), RNNOISE_FFT_KISS), 0);
+  EXPECT_EQ(rnnoise_set_fft(state.get(), RNNOISE_FFT_PFFFT), 0);
+  EXPECT_EQ(rnnoise_set_fft(state.get(), -1), -1);
+}
+
+// Verifies that the real FFT backend matches the complex kiss_fft backend up
+// to rounding.
+TEST(Rnnoise, PffftBackendMatchesKiss) {
+  DenoiseStatePtr kiss_state(rnnoise_create(nullptr));
+  DenoiseStatePtr pffft_state(rnnoise_create(nullptr));
+  ASSERT_EQ(rnnoise_set_fft(pffft_state.get(), RNNOISE_FFT_PFFFT), 0);
+
+  std::array<float, kRnnoiseFrameSize> input;
+  std::array<float, kRnnoiseFrameSize> kiss_output;
+  std::array<float, kRnnoiseFrameSize> pffft_output;
+  for (size_t frame_index = 0; frame_index < 200; ++frame_index) {
+    PopulateFrame(frame_index, /*channel=*/0, input);
+    const float kiss_vad = rnnoise_process_frame(
+        kiss_state.get(), kiss_output.data(), input.data());
+    const float pffft_vad = rnnoise_process_frame(
+        pffft_state.get(), pffft_output.data(), input.data());
+    ASSERT_NEAR(kiss_vad, pffft_vad, 1e-4f);
+    for (size_t i = 0; i < kRnnoiseFrameSize; ++i) {
+      ASSERT_NEAR(kiss_output[i], pffft_output[i], 0.1f);
+    }
+  }
+}
+
+// Checks that a model packed with `flags` behaves like the reference model.
+void ExpectPackedModelMatchesReference(int flags,
+                                       float vad_tolerance,
+                                       float output_tolerance) {
+  ModelPtr packed_model(rnnoise_model_pack(nullptr, flags));
+  ASSERT_TRUE(packed_model);
+  DenoiseStatePtr reference_state(rnnoise_create(nullptr));
+  DenoiseStatePtr packed_state(rnnoise_create(packed_model.get()));
+
+  std::array<float, kRnnoiseFrameSize> input;
+  std::array<float, kRnnoiseFrameSize> reference_output;
+  std::array<float, kRnnoiseFrameSize> packed_output;
+  for (size_t frame_index = 0; frame_index < 200; ++frame_index) {
+    PopulateFrame(frame_index, /*channel=*/0, input);
+    const float reference_vad = rnnoise_process_frame(
+        reference_state.get(), reference_output.data(), input.data());
+    const float packed_vad = rnnoise_process_frame(
+        packed_state.get(), packed_output.data(), input.data());
+    ASSERT_NEAR(reference_vad, packed_vad, vad_tolerance);
+    for (size_t i = 0; i < kRnnoiseFrameSize; ++i) {
+      ASSERT_NEAR(reference_output[i], packed_output[i], output_tolerance);
+    }
+  }
+}
+
+// Verifies that the packed model, evaluated with the optimized kernels, closely
+// matches the reference model.
+TEST(Rnnoise, PackedModelMatchesReference) {
+  for (int cpu_features : GetCpuFeaturesToTest()) {
+    rtc::StringBuilder ss;
+    ss << "CPU features: " << cpu_features;
+    SCOPED_TRACE(ss.str());
+    ExpectPackedModelMatchesReference(cpu_features, /*vad_tolerance=*/1e-4f,
+                                      /*output_tolerance=*/0.1f);
+  }
+}
+
+// The small activation errors are amplified by the recurrent layers, but the
+// output stays within 0.1% of the 16-bit sample range.
+TEST(Rnnoise, RationalActivationsMatchReference) {
+  for (int cpu_features : GetCpuFeaturesToTest()) {
+    rtc::StringBuilder ss;
+    ss << "CPU features: " << cpu_features;
+    SCOPED_TRACE(ss.str());
+    ExpectPackedModelMatchesReference(
+        cpu_features | RNNOISE_RATIONAL_ACTIVATIONS,
+        /*vad_tolerance=*/1e-3f, /*output_tolerance=*/32.f);
+  }
+}
+
+// The 16-bit quantization of the layer inputs is exact to about 1e-5 of their
+// largest value, so the output stays within one step of the 16-bit range.
+TEST(Rnnoise, Int16InferenceMatchesReference) {
+  for (int cpu_features : GetCpuFeaturesToTest()) {
+    rtc::StringBuilder ss;
+    ss << "CPU features: " << cpu_features;
+    SCOPED_TRACE(ss.str());
+    ExpectPackedModelMatchesReference(cpu_features | RNNOISE_INT16_INFERENCE,
+                                      /*vad_tolerance=*/1e-3f,
+                                      /*output_tolerance=*/1.f);
+  }
+}
+
+// Verifies that the integer kernels for all the CPU features give the same
+// result, since they accumulate exactly.
+TEST(Rnnoise, Int16InferenceIsBitExactAcrossCpuFeatures) {
+  ModelPtr c_model(rnnoise_model_pack(nullptr, RNNOISE_INT16_INFERENCE));
+  for (int cpu_features : GetCpuFeaturesToTest()) {
+    rtc::StringBuilder ss;
+    ss << "CPU features: " << cpu_features;
+    SCOPED_TRACE(ss.str());
+    ModelPtr simd_model(
+        rnnoise_model_pack(nullptr, cpu_features | RNNOISE_INT16_INFERENCE));
+    DenoiseStatePtr c_state(rnnoise_create(c_model.get()));
+    DenoiseStatePtr simd_state(rnnoise_create(simd_model.get()));
+
+    std::array<float, kRnnoiseFrameSize> input;
+    std::array<float, kRnnoiseFrameSize> c_output;
+    std::array<float, kRnnoiseFrameSize> simd_output;
+    for (size_t frame_index = 0; frame_index < 100; ++frame_index) {
+      PopulateFrame(frame_index, /*channel=*/0, input);
+      const float c_vad =
+          rnnoise_process_frame(c_state.get(), c_output.data(), input.data());
+      const float simd_vad = rnnoise_process_frame(
+          simd_state.get(), simd_output.data(), input.data());
+      ASSERT_EQ(c_vad, simd_vad);
+      ASSERT_EQ(c_output, simd_output);
+    }
+  }
+}
+
+// Verifies that a model read back from the binary format is evaluated exactly
+// like the packed model it was written from.
+TEST(Rnnoise, BinaryModelIsBitExact) {
+  const std::vector<char> contents = WriteBinaryModel(nullptr);
+  ASSERT_FALSE(contents.empty());
+  for (int cpu_features : GetCpuFeaturesToTest()) {
+    rtc::StringBuilder ss;
+    ss << "CPU features: " << cpu_features;
+    SCOPED_TRACE(ss.str());
+    ModelPtr packed_model(rnnoise_model_pack(nullptr, cpu_features));
+    ModelPtr binary_model(rnnoise_model_from_buffer(
+        contents.data(), contents.size(), cpu_features));
+    ASSERT_TRUE(binary_model);
+    DenoiseStatePtr packed_state(rnnoise_create(packed_model.get()));
+    DenoiseStatePtr binary_state(rnnoise_create(binary_model.get()));
+
+    std::array<float, kRnnoiseFrameSize> input;
+    std::array<float, kRnnoiseFrameSize> packed_output;
+    std::array<float, kRnnoiseFrameSize> binary_output;
+    for (size_t frame_index = 0; frame_index < 100; ++frame_index) {
+      PopulateFrame(frame_index, /*channel=*/0, input);
+      const float packed_vad = rnnoise_process_frame(
+          packed_state.get(), packed_output.data(), input.data());
+      const float binary_vad = rnnoise_process_frame(
+          binary_state.get(), binary_output.data(), input.data());
+      ASSERT_EQ(packed_vad, binary_vad);
+      ASSERT_EQ(packed_output, binary_output);
+    }
+  }
+}
+
+TEST(Rnnoise, InvalidBinaryModelsAreRejected) {
+  std::vector<char> contents = WriteBinaryModel(nullptr);
+  ASSERT_FALSE(contents.empty());
+  EXPECT_FALSE(rnnoise_model_from_buffer(nullptr, 0, /*flags=*/0));
+  // Truncated weights.
+  EXPECT_FALSE(rnnoise_model_from_buffer(contents.data(), contents.size() - 1,
+                                         /*flags=*/0));
+  // Truncated header.
+  EXPECT_FALSE(rnnoise_model_from_buffer(contents.data(), 16, /*flags=*/0));
+  // Unknown version.
+  contents[4] = 2;
+  EXPECT_FALSE(rnnoise_model_from_buffer(contents.data(), contents.size(),
+                                         /*flags=*/0));
+  contents[4] = 1;
+  // Layers which do not chain: the number of neurons of the first layer is
+  // stored at offset 12.
+  ++contents[12];
+  EXPECT_FALSE(rnnoise_model_from_buffer(contents.data(), contents.size(),
+                                         /*flags=*/0));
+}
+
+// Verifies that a state switched to another model behaves like a state
+// created with that model.
+TEST(Rnnoise, SetModelSwitchesModel) {
+  ModelPtr packed_model(rnnoise_model_pack(nullptr, /*flags=*/0));
+  DenoiseStatePtr switched_state(rnnoise_create(nullptr));
+  DenoiseStatePtr packed_state(rnnoise_create(packed_model.get()));
+  ASSERT_EQ(rnnoise_set_model(switched_state.get(), packed_model.get()), 0);
+
+  std::array<float, kRnnoiseFrameSize> input;
+  std::array<float, kRnnoiseFrameSize> switched_output;
+  std::array<float, kRnnoiseFrameSize> packed_output;
+  for (size_t frame_index = 0; frame_index < 100; ++frame_index) {
+    PopulateFrame(frame_index, /*channel=*/0, input);
+    const float switched_vad = rnnoise_process_frame(
+        switched_state.get(), switched_output.data(), input.data());
+    const float packed_vad = rnnoise_process_frame(
+        packed_state.get(), packed_output.data(), input.data());
+    ASSERT_EQ(switched_vad, packed_vad);
+    ASSERT_EQ(switched_output, packed_output);
+  }
+}
+
+TEST(Rnnoise, SetSilenceGateRejectsInvalidParameters) {
+  DenoiseStatePtr state(rnnoise_create(nullptr));
+  EXPECT_EQ(rnnoise_set_silence_gate(state.get(), 10, 1.f, 0.5f), 0);
+  EXPECT_EQ(rnnoise_set_silence_gate(state.get(), 0, 0.f, 0.f), 0);
+  EXPECT_EQ(rnnoise_set_silence_gate(state.get(), -1, 1.f, 0.5f), -1);
+  EXPECT_EQ(rnnoise_set_silence_gate(state.get(), 10, -1.f, 0.5f), -1);
+  EXPECT_EQ(rnnoise_set_silence_gate(state.get(), 10, 1.f, 1.5f), -1);
+}
+
+TEST(Rnnoise, SetGainFloorRejectsInvalidFloors) {
+  DenoiseStatePtr state(rnnoise_create(nullptr));
+  EXPECT_EQ(rnnoise_set_gain_floor(state.get(), 0.f), 0);
+  EXPECT_EQ(rnnoise_set_gain_floor(state.get(), 0.25f), 0);
+  EXPECT_EQ(rnnoise_set_gain_floor(state.get(), 1.f), 0);
+  EXPECT_EQ(rnnoise_set_gain_floor(state.get(), -0.1f), -1);
+  EXPECT_EQ(rnnoise_set_gain_floor(state.get(), 1.1f), -1);
+  EXPECT_EQ(rnnoise_set_gain_floor(state.get(), NAN), -1);
+}
+
+// Verifies that the gain floor limits the gains, that it attenuates the output
+// less, and that a zero floor does not change the output.
+TEST(Rnnoise, GainFloorLimitsAttenuation) {
+  constexpr int kNumBins = 129;
+  constexpr float kFloor = 0.25f;
+  DenoiseStatePtr reference_state(rnnoise_create(nullptr));
+  DenoiseStatePtr zero_floor_state(rnnoise_create(nullptr));
+  DenoiseStatePtr state(rnnoise_create(nullptr));
+  ASSERT_EQ(rnnoise_set_gain_floor(zero_floor_state.get(), 0.f), 0);
+  ASSERT_EQ(rnnoise_set_gain_floor(state.get(), kFloor), 0);
+
+  std::array<float, kRnnoiseFrameSize> input;
+  std::array<float, kRnnoiseFrameSize> reference_output;
+  std::array<float, kRnnoiseFrameSize> zero_floor_output;
+  std::array<float, kRnnoiseFrameSize> output;
+  std::array<float, kNumBins> reference_gains;
+  std::array<float, kNumBins> gains;
+  float reference_energy = 0.f;
+  float energy = 0.f;
+  bool attenuated_below_floor = false;
+  for (size_t frame_index = 0; frame_index < 100; ++frame_index) {
+    PopulateFrame(frame_index, /*channel=*/0, input);
+    rnnoise_process_frame(reference_state.get(), reference_output.data(),
+                          input.data());
+    rnnoise_process_frame(zero_floor_state.get(), zero_floor_output.data(),
+                          input.data());
+    rnnoise_process_frame(state.get(), output.data(), input.data());
+    ASSERT_EQ(zero_floor_output, reference_output);
+    for (size_t i = 0; i < kRnnoiseFrameSize; ++i) {
+      reference_energy += reference_output[i] * reference_output[i];
+      energy += output[i] * output[i];
+    }
+
+    ASSERT_EQ(rnnoise_get_gains(reference_state.get(), reference_gains.data(),
+                                kNumBins),
+              0);
+    ASSERT_EQ(rnnoise_get_gains(state.get(), gains.data(), kNumBins), 0);
+    for (int i = 0; i < kNumBins; ++i) {
+      ASSERT_GE(gains[i], kFloor);
+      attenuated_below_floor |= reference_gains[i] < kFloor;
+    }
+  }
+  EXPECT_TRUE(attenuated_below_floor);
+  EXPECT_GT(energy, reference_energy);
+}
+
+// Verifies that the silence gate only changes the output of quiet stretches
+// and that the denoising resumes when the level rises.
+TEST(Rnnoise, SilenceGateBypassesQuietFrames) {
+  constexpr int kHangover = 20;
+  constexpr float kGain = 0.25f;
+  DenoiseStatePtr reference_state(rnnoise_create(nullptr));
+  DenoiseStatePtr gated_state(rnnoise_create(nullptr));
+  ASSERT_EQ(rnnoise_set_silence_gate(gated_state.get(), kHangover,
+                                     /*threshold=*/100.f, kGain),
+            0);
+
+  std::array<float, kRnnoiseFrameSize> input;
+  std::array<float, kRnnoiseFrameSize> reference_output;
+  std::array<float, kRnnoiseFrameSize> gated_output;
+  float vad_difference = 0.f;
+  for (size_t frame_index = 0; frame_index < 300; ++frame_index) {
+    PopulateFrame(frame_index, /*channel=*/0, input);
+    // Quiet stretch.
+    const bool quiet = frame_index >= 50 && frame_index < 150;
+    if (quiet) {
+      for (float& x : input) {
+        x *= 1e-3f;
+      }
+    }
+    const float reference_vad = rnnoise_process_frame(
+        reference_state.get(), reference_output.data(), input.data());
+    const float gated_vad = rnnoise_process_frame(
+        gated_state.get(), gated_output.data(), input.data());
+    if (frame_index < 50 + kHangover - 1) {
+      // The gate is not closed yet.
+      ASSERT_EQ(reference_vad, gated_vad);
+      ASSERT_EQ(reference_output, gated_output);
+    } else if (quiet && frame_index > 50 + kHangover) {
+      // The input, whose peak is below 3.5, is only attenuated.
+      EXPECT_EQ(gated_vad, 0.f);
+      for (size_t i = 0; i < kRnnoiseFrameSize; ++i) {
+        ASSERT_LE(std::fabs(gated_output[i]), kGain * 3.5f);
+      }
+    } else if (frame_index >= 150) {
+      // The recurrent state differs as the reference state kept running the
+      // RNN on the quiet frames.
+      vad_difference += std::fabs(reference_vad - gated_vad);
+    }
+  }
+  // The denoising has resumed.
+  EXPECT_LT(vad_difference / 150, 0.03f);
+}
+
+// Verifies that the analysis-only mode keeps the state in sync with the input,
+// such that the denoising resumes as if it had never stopped.
+TEST(Rnnoise, AnalysisOnlyModeKeepsStateInSync) {
+  DenoiseStatePtr reference_state(rnnoise_create(nullptr));
+  DenoiseStatePtr state(rnnoise_create(nullptr));
+
+  std::array<float, kRnnoiseFrameSize> input;
+  std::array<float, kRnnoiseFrameSize> reference_output;
+  std::array<float, kRnnoiseFrameSize> output;
+  for (size_t frame_index = 0; frame_index < 200; ++frame_index) {
+    rnnoise_set_analysis_only(state.get(),
+                              frame_index >= 50 && frame_index < 100);
+    PopulateFrame(frame_index, /*channel=*/0, input);
+    const float reference_vad = rnnoise_process_frame(
+        reference_state.get(), reference_output.data(), input.data());
+    const float vad =
+        rnnoise_process_frame(state.get(), output.data(), input.data());
+    ASSERT_EQ(reference_vad, vad);
+    // The first denoised frame cross-fades from the unprocessed input.
+    if (frame_index < 50 || frame_index > 100) {
+      ASSERT_EQ(reference_output, output);
+    }
+  }
+}
+
+// Verifies that the bypass mode outputs the same unprocessed input as the
+// analysis-only mode without running the RNN.
+TEST(Rnnoise, BypassModeSkipsRnn) {
+  DenoiseStatePtr analysis_only_state(rnnoise_create(nullptr));
+  DenoiseStatePtr state(rnnoise_create(nullptr));
+  rnnoise_set_analysis_only(analysis_only_state.get(), 1);
+  rnnoise_set_bypass(state.get(), 1);
+  int num_rnn_stages = 0;
+  rnnoise_set_stage_callback(
+      state.get(),
+      [](void* user_data, int stage, int end) {
+        if (stage == RNNOISE_STAGE_RNN && !end) {
+          ++*static_cast<int*>(user_data);
+        }
+      },
+      &num_rnn_stages);
+
+  std::array<float, kRnnoiseFrameSize> input;
+  std::array<float, kRnnoiseFrameSize> analysis_only_output;
+  std::array<float, kRnnoiseFrameSize> output;
+  for (size_t frame_index = 0; frame_index < 100; ++frame_index) {
+    PopulateFrame(frame_index, /*channel=*/0, input);
+    rnnoise_process_frame(analysis_only_state.get(),
+                          analysis_only_output.data(), input.data());
+    const float vad =
+        rnnoise_process_frame(state.get(), output.data(), input.data());
+    ASSERT_EQ(vad, 0.f);
+    ASSERT_EQ(analysis_only_output, output);
+  }
+  EXPECT_EQ(num_rnn_stages, 0);
+
+  // The RNN runs again once the bypass ends.
+  rnnoise_set_bypass(state.get(), 0);
+  rnnoise_process_frame(state.get(), output.data(), input.data());
+  EXPECT_EQ(num_rnn_stages, 1);
+}
+
+// Verifies that the gains are only available once a non-silent frame is
+// denoised, that they are in [0, 1] and that they are also computed in
+// analysis-only mode.
+TEST(Rnnoise, GetGainsMatchesInAnalysisOnlyMode) {
+  constexpr int kNumBins = 129;
+  DenoiseStatePtr reference_state(rnnoise_create(nullptr));
+  DenoiseStatePtr state(rnnoise_create(nullptr));
+  rnnoise_set_analysis_only(state.get(), 1);
+
+  std::array<float, kNumBins> reference_gains;
+  std::array<float, kNumBins> gains;
+  gains.fill(2.f);
+  EXPECT_EQ(rnnoise_get_gains(state.get(), gains.data(), kNumBins), -1);
+  EXPECT_EQ(gains[0], 2.f);
+
+  std::array<float, kRnnoiseFrameSize> input;
+  std::array<float, kRnnoiseFrameSize> output;
+  for (size_t frame_index = 0; frame_index < 100; ++frame_index) {
+    PopulateFrame(frame_index, /*channel=*/0, input);
+    rnnoise_process_frame(reference_state.get(), output.data(), input.data());
+    rnnoise_process_frame(state.get(), output.data(), input.data());
+    ASSERT_EQ(rnnoise_get_gains(reference_state.get(), reference_gains.data(),
+                                kNumBins),
+              0);
+    ASSERT_EQ(rnnoise_get_gains(state.get(), gains.data(), kNumBins), 0);
+    ASSERT_EQ(reference_gains, gains);
+    for (float gain : gains) {
+      ASSERT_GE(gain, 0.f);
+      ASSERT_LE(gain, 1.f);
+    }
+  }
+}
+
+// Verifies that a state denoising with the gains of a reference state fed the
+// same signal closely matches the output of the reference, which only differs
+// by the pitch filter that is skipped for linked states.
+TEST(Rnnoise, LinkedProcessingAppliesReferenceGains) {
+  DenoiseStatePtr reference_state(rnnoise_create(nullptr));
+  DenoiseStatePtr state(rnnoise_create(nullptr));
+
+  std::array<float, kRnnoiseFrameSize> input;
+  std::array<float, kRnnoiseFrameSize> reference_output;
+  std::array<float, kRnnoiseFrameSize> output;
+  double reference_energy = 0.0;
+  double error_energy = 0.0;
+  for (size_t frame_index = 0; frame_index < 300; ++frame_index) {
+    PopulateFrame(frame_index, /*channel=*/0, input);
+    rnnoise_process_frame(reference_state.get(), reference_output.data(),
+                          input.data());
+    rnnoise_process_frame_linked(state.get(), output.data(), input.data(),
+                                 reference_state.get());
+    EXPECT_EQ(rnnoise_get_pitch_period(state.get()),
+              rnnoise_get_pitch_period(reference_state.get()));
+    if (frame_index < 50) {
+      continue;
+    }
+    for (size_t i = 0; i < kRnnoiseFrameSize; ++i) {
+      reference_energy += reference_output[i] * reference_output[i];
+      const float error = output[i] - reference_output[i];
+      error_energy += error * error;
+    }
+  }
+  EXPECT_GT(reference_energy, 0.0);
+  EXPECT_LT(error_energy, 0.01 * reference_energy);
+}
+
+TEST(Rnnoise, GetDelayReportsSynthesisDelay) {
+  DenoiseStatePtr state(rnnoise_create(nullptr));
+  EXPECT_EQ(rnnoise_get_delay(state.get()),
+            static_cast<int>(kRnnoiseFrameSize));
+  rnnoise_set_low_delay(state.get(), 1);
+  EXPECT_EQ(rnnoise_get_delay(state.get()),
+            static_cast<int>(kRnnoiseFrameSize / 2));
+}
+
+// Verifies that the low-delay synthesis keeps the features, and that its output
+// matches the default output with half the delay.
+TEST(Rnnoise, LowDelaySynthesisHalvesTheDelay) {
+  constexpr size_t kNumFrames = 100;
+  constexpr size_t kDelayDifference = kRnnoiseFrameSize / 2;
+  for (int analysis_only : {0, 1}) {
+    SCOPED_TRACE(analysis_only);
+    DenoiseStatePtr state(rnnoise_create(nullptr));
+    DenoiseStatePtr low_delay_state(rnnoise_create(nullptr));
+    rnnoise_set_low_delay(low_delay_state.get(), 1);
+    rnnoise_set_analysis_only(state.get(), analysis_only);
+    rnnoise_set_analysis_only(low_delay_state.get(), analysis_only);
+
+    std::array<float, kRnnoiseFrameSize> input;
+    std::vector<float> output(kNumFrames * kRnnoiseFrameSize);
+    std::vector<float> low_delay_output(kNumFrames * kRnnoiseFrameSize);
+    for (size_t frame_index = 0; frame_index < kNumFrames; ++frame_index) {
+      PopulateFrame(frame_index, /*channel=*/0, input);
+      const float vad = rnnoise_process_frame(
+          state.get(), &output[frame_index * kRnnoiseFrameSize], input.data());
+      const float low_delay_vad = rnnoise_process_frame(
+          low_delay_state.get(),
+          &low_delay_output[frame_index * kRnnoiseFrameSize], input.data());
+      ASSERT_EQ(vad, low_delay_vad);
+    }
+    // The denoised outputs only differ by the leakage of the synthesis
+    // windows, the unprocessed ones by rounding.
+    double energy = 0.0;
+    double error_energy = 0.0;
+    for (size_t i = kDelayDifference; i < output.size(); ++i) {
+      const float error = output[i] - low_delay_output[i - kDelayDifference];
+      energy += output[i] * output[i];
+      error_energy += error * error;
+    }
+    EXPECT_LT(error_energy, 1e-3 * energy);
+    if (analysis_only) {
+      for (size_t i = kDelayDifference; i < output.size(); ++i) {
+        ASSERT_NEAR(output[i], low_delay_output[i - kDelayDifference], 0.05f);
+      }
+    }
+  }
+}
+
+// Verifies that the stage callback reports balanced and ordered stages, which
+// do not change the output.
+TEST(Rnnoise, StageCallbackReportsAllStages) {
+  struct StageLog {
+    std::array<int, RNNOISE_NUM_STAGES> num_begins = {};
+    std::array<int, RNNOISE_NUM_STAGES> num_ends = {};
+    int current_stage = -1;
+    bool nested = false;
+  };
+  auto on_stage = [](void* user_data, int stage, int end) {
+    StageLog* log = static_cast<StageLog*>(user_data);
+    ASSERT_GE(stage, 0);
+    ASSERT_LT(stage, RNNOISE_NUM_STAGES);
+    if (end) {
+      log->nested |= log->current_stage != stage;
+      ++log->num_ends[stage];
+      log->current_stage = -1;
+    } else {
+      log->nested |= log->current_stage != -1;
+      ++log->num_begins[stage];
+      log->current_stage = stage;
+    }
+  };
+
+  DenoiseStatePtr state(rnnoise_create(nullptr));
+  DenoiseStatePtr reference_state(rnnoise_create(nullptr));
+  StageLog log;
+  rnnoise_set_stage_callback(state.get(), on_stage, &log);
+  constexpr int kNumFrames = 100;
+  std::array<float, kRnnoiseFrameSize> input;
+  std::array<float, kRnnoiseFrameSize> output;
+  std::array<float, kRnnoiseFrameSize> reference_output;
+  for (int frame_index = 0; frame_index < kNumFrames; ++frame_index) {
+    PopulateFrame(frame_index, /*channel=*/0, input);
+    rnnoise_process_frame(state.get(), output.data(), input.data());
+    rnnoise_process_frame(reference_state.get(), reference_output.data(),
+                          input.data());
+    ASSERT_EQ(output, reference_output);
+  }
+
+  EXPECT_FALSE(log.nested);
+  EXPECT_EQ(log.num_begins, log.num_ends);
+  // The input is never silent, hence all the stages run for every frame.
+  for (int stage = 0; stage < RNNOISE_NUM_STAGES; ++stage) {
+    EXPECT_EQ(log.num_begins[stage], kNumFrames);
+  }
+
+  // No more stages are reported once the callback is reset.
+  rnnoise_set_stage_callback(state.get(), nullptr, nullptr);
+  rnnoise_process_frame(state.get(), output.data(), input.data());
+  EXPECT_EQ(log.num_begins[RNNOISE_STAGE_BIQUAD], kNumFrames);
+}
+
+}  // namespace webrtc
@@ -22,24 +22,32 @@ SuppressionParams::SuppressionParams(
       // 15 dB attenuation.
       minimum_attenuating_gain = 0.18f;
       use_attenuation_adjustment = true;
+      // The Wiener filter alone suffices.
+      rnnoise_minimum_gain = 0.f;
       break;
     case NsConfig::SuppressionLevel::k12dB:
       over_subtraction_factor = 1.f;
       // 15 dB attenuation.
       minimum_attenuating_gain = 0.18f;
       use_attenuation_adjustment = true;
+      // 12 dB attenuation.
+      rnnoise_minimum_gain = 0.25f;
       break;
     case NsConfig::SuppressionLevel::k18dB:
       over_subtraction_factor = 1.1f;
       // 18 dB attenuation.
       minimum_attenuating_gain = 0.125f;
       use_attenuation_adjustment = true;
+      // 18 dB attenuation.
+      rnnoise_minimum_gain = 0.125f;
       break;
     case NsConfig::SuppressionLevel::k21dB:
       over_subtraction_factor = 1.25f;
       // 20.9 dB attenuation.
       minimum_attenuating_gain = 0.09f;
       use_attenuation_adjustment = true;
+      // 20.9 dB attenuation.
+      rnnoise_minimum_gain = 0.09f;
       break;
     default:
       RTC_DCHECK_NOTREACHED();
@@ -23,6 +23,9 @@ struct SuppressionParams {
   float over_subtraction_factor;
   float minimum_attenuating_gain;
   bool use_attenuation_adjustment;
+  // Lowest RNNoise gain with the RNNoise level control, 0 if RNNoise is not
+  // run at this level.
+  float rnnoise_minimum_gain;
 };
 
 }  // namespace webrtc
@@ -11,7 +11,8 @@
 #include "modules/audio_processing/residual_echo_detector.h"
 
 #include <algorithm>
-#include <numeric>
+#include <cmath>
+#include <iterator>
 
 #include "absl/types/optional.h"
 #include "modules/audio_processing/logging/apm_data_dumper.h"
@@ -21,12 +22,17 @@
 
 namespace {
 
-float Power(rtc::ArrayView<const float> input) {
+// Computes the power of `input` decimated by `decimation_factor`.
+float Power(rtc::ArrayView<const float> input, size_t decimation_factor) {
   if (input.empty()) {
     return 0.f;
   }
-  return std::inner_product(input.begin(), input.end(), input.begin(), 0.f) /
-         input.size();
+  float energy = 0.f;
+  for (size_t i = 0; i < input.size(); i += decimation_factor) {
+    energy += input[i] * input[i];
+  }
+  return energy /
+         ((input.size() + decimation_factor - 1) / decimation_factor);
 }
 
 constexpr size_t kLookbackFrames = 650;
@@ -43,13 +49,26 @@ namespace webrtc {
 std::atomic<int> ResidualEchoDetector::instance_count_(0);
 
 ResidualEchoDetector::ResidualEchoDetector()
-    : data_dumper_(new ApmDataDumper(instance_count_.fetch_add(1) + 1)),
+    : ResidualEchoDetector(Config()) {}
+
+ResidualEchoDetector::ResidualEchoDetector(const Config& config)
+    : frames_per_update_(config.frames_per_update),
+      power_decimation_factor_(config.power_decimation_factor),
+      num_delays_(kLookbackFrames / frames_per_update_),
+      update_alpha_(frames_per_update_ * kAlpha),
+      data_dumper_(new ApmDataDumper(instance_count_.fetch_add(1) + 1)),
       render_buffer_(kRenderBufferSize),
-      render_power_(kLookbackFrames),
-      render_power_mean_(kLookbackFrames),
-      render_power_std_dev_(kLookbackFrames),
-      covariances_(kLookbackFrames),
-      recent_likelihood_max_(kAggregationBufferSize) {}
+      render_power_(2 * num_delays_),
+      render_power_mean_(2 * num_delays_),
+      render_power_std_dev_(2 * num_delays_),
+      covariances_(num_delays_),
+      normalized_cross_correlations_(num_delays_),
+      render_statistics_(update_alpha_),
+      capture_statistics_(update_alpha_),
+      recent_likelihood_max_(kAggregationBufferSize / frames_per_update_) {
+  RTC_DCHECK_GT(frames_per_update_, 0);
+  RTC_DCHECK_GT(power_decimation_factor_, 0);
+}
 
 ResidualEchoDetector::~ResidualEchoDetector() = default;
 
@@ -70,7 +89,7 @@ void ResidualEchoDetector::AnalyzeRenderAudio(
     frames_since_zero_buffer_size_ = 0;
   }
   ++frames_since_zero_buffer_size_;
-  float power = Power(render_audio);
+  float power = Power(render_audio, power_decimation_factor_);
   render_buffer_.Push(power);
 }
 
@@ -96,55 +115,74 @@ void ResidualEchoDetector::AnalyzeCaptureAudio(
     // TODO(ivoc): Include how often this happens in APM stats.
     return;
   }
+  // Average the render and capture powers over `frames_per_update_` frames.
+  render_power_sum_ += *buffered_render_power;
+  capture_power_sum_ += Power(capture_audio, power_decimation_factor_);
+  if (++num_accumulated_frames_ < frames_per_update_) {
+    return;
+  }
+  const float render_power = render_power_sum_ / frames_per_update_;
+  const float capture_power = capture_power_sum_ / frames_per_update_;
+  render_power_sum_ = 0.f;
+  capture_power_sum_ = 0.f;
+  num_accumulated_frames_ = 0;
+
   // Update the render statistics, and store the statistics in circular buffers.
-  render_statistics_.Update(*buffered_render_power);
-  RTC_DCHECK_LT(next_insertion_index_, kLookbackFrames);
-  render_power_[next_insertion_index_] = *buffered_render_power;
-  render_power_mean_[next_insertion_index_] = render_statistics_.mean();
-  render_power_std_dev_[next_insertion_index_] =
-      render_statistics_.std_deviation();
-
-  // Get the next capture value, update capture statistics and add the relevant
-  // values to the buffers.
-  const float capture_power = Power(capture_audio);
+  // Each value is written twice, so that the values for increasing delays are
+  // contiguous starting from `next_insertion_index_`.
+  render_statistics_.Update(render_power);
+  RTC_DCHECK_LT(next_insertion_index_, num_delays_);
+  for (size_t index : {next_insertion_index_,
+                       next_insertion_index_ + num_delays_}) {
+    render_power_[index] = render_power;
+    render_power_mean_[index] = render_statistics_.mean();
+    render_power_std_dev_[index] = render_statistics_.std_deviation();
+  }
+
+  // Update the capture statistics.
   capture_statistics_.Update(capture_power);
   const float capture_mean = capture_statistics_.mean();
   const float capture_std_deviation = capture_statistics_.std_deviation();
 
-  // Update the covariance values and determine the new echo likelihood.
-  echo_likelihood_ = 0.f;
-  size_t read_index = next_insertion_index_;
-
-  int best_delay = -1;
-  for (size_t delay = 0; delay < covariances_.size(); ++delay) {
-    RTC_DCHECK_LT(read_index, render_power_.size());
-    covariances_[delay].Update(capture_power, capture_mean,
-                               capture_std_deviation, render_power_[read_index],
-                               render_power_mean_[read_index],
-                               render_power_std_dev_[read_index]);
-    read_index = read_index > 0 ? read_index - 1 : kLookbackFrames - 1;
-
-    if (covariances_[delay].normalized_cross_correlation() > echo_likelihood_) {
-      echo_likelihood_ = covariances_[delay].normalized_cross_correlation();
-      best_delay = static_cast<int>(delay);
-    }
+  // Update the covariance values and determine the new echo likelihood. The
+  // loop has no dependencies across delays and is vectorized.
+  const float* delayed_power = &render_power_[next_insertion_index_];
+  const float* delayed_mean = &render_power_mean_[next_insertion_index_];
+  const float* delayed_std_dev = &render_power_std_dev_[next_insertion_index_];
+  const float capture_deviation =
+      update_alpha_ * (capture_power - capture_mean);
+  for (size_t delay = 0; delay < num_delays_; ++delay) {
+    covariances_[delay] =
+        (1.f - update_alpha_) * covariances_[delay] +
+        capture_deviation * (delayed_power[delay] - delayed_mean[delay]);
+    normalized_cross_correlations_[delay] =
+        covariances_[delay] /
+        (capture_std_deviation * delayed_std_dev[delay] + .0001f);
   }
+  const auto max_correlation =
+      std::max_element(normalized_cross_correlations_.begin(),
+                       normalized_cross_correlations_.end());
+  RTC_DCHECK(std::isfinite(*max_correlation));
+  echo_likelihood_ = std::max(*max_correlation, 0.f);
+  const int best_delay =
+      echo_likelihood_ > 0.f
+          ? static_cast<int>(std::distance(
+                normalized_cross_correlations_.begin(), max_correlation))
+          : -1;
+
   // This is a temporary log message to help find the underlying cause for echo
   // likelihoods > 1.0.
   // TODO(ivoc): Remove once the issue is resolved.
   if (echo_likelihood_ > 1.1f) {
     // Make sure we don't spam the log.
     if (log_counter_ < 5 && best_delay != -1) {
-      size_t read_index = kLookbackFrames + next_insertion_index_ - best_delay;
-      if (read_index >= kLookbackFrames) {
-        read_index -= kLookbackFrames;
-      }
+      const size_t read_index = next_insertion_index_ + best_delay;
       RTC_DCHECK_LT(read_index, render_power_.size());
       RTC_LOG_F(LS_ERROR) << "Echo detector internal state: {"
                              "Echo likelihood: "
-                          << echo_likelihood_ << ", Best Delay: " << best_delay
-                          << ", Covariance: "
-                          << covariances_[best_delay].covariance()
+                          << echo_likelihood_ << ", Best Delay: "
+                          << best_delay * frames_per_update_
+                          << ", Covariance: " << covariances_[best_delay]
                           << ", Last capture power: " << capture_power
                           << ", Capture mean: " << capture_mean
                           << ", Capture_standard deviation: "
@@ -159,7 +197,7 @@ void ResidualEchoDetector::AnalyzeCaptureAudio(
   }
   RTC_DCHECK_LT(echo_likelihood_, 1.1f);
 
-  reliability_ = (1.0f - kAlpha) * reliability_ + kAlpha * 1.0f;
+  reliability_ = (1.0f - update_alpha_) * reliability_ + update_alpha_ * 1.0f;
   echo_likelihood_ *= reliability_;
   // This is a temporary fix to prevent echo likelihood values > 1.0.
   // TODO(ivoc): Find the root cause of this issue and fix it.
@@ -171,10 +209,10 @@ void ResidualEchoDetector::AnalyzeCaptureAudio(
   // Update the buffer of recent likelihood values.
   recent_likelihood_max_.Update(echo_likelihood_);
 
-  // Update the next insertion index.
-  next_insertion_index_ = next_insertion_index_ < (kLookbackFrames - 1)
-                              ? next_insertion_index_ + 1
-                              : 0;
+  // Update the next insertion index, moving backwards so that older values are
+  // found at increasing indexes.
+  next_insertion_index_ =
+      next_insertion_index_ > 0 ? next_insertion_index_ - 1 : num_delays_ - 1;
 }
 
 void ResidualEchoDetector::Initialize(int /*capture_sample_rate_hz*/,
@@ -188,9 +226,12 @@ void ResidualEchoDetector::Initialize(int /*capture_sample_rate_hz*/,
   render_statistics_.Clear();
   capture_statistics_.Clear();
   recent_likelihood_max_.Clear();
-  for (auto& cov : covariances_) {
-    cov.Clear();
-  }
+  std::fill(covariances_.begin(), covariances_.end(), 0.f);
+  std::fill(normalized_cross_correlations_.begin(),
+            normalized_cross_correlations_.end(), 0.f);
+  render_power_sum_ = 0.f;
+  capture_power_sum_ = 0.f;
+  num_accumulated_frames_ = 0;
   echo_likelihood_ = 0.f;
   next_insertion_index_ = 0;
   reliability_ = 0.f;
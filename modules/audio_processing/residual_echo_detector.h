@@ -18,7 +18,6 @@
 #include "modules/audio_processing/echo_detector/circular_buffer.h"
 #include "modules/audio_processing/echo_detector/mean_variance_estimator.h"
 #include "modules/audio_processing/echo_detector/moving_max.h"
-#include "modules/audio_processing/echo_detector/normalized_covariance_estimator.h"
 #include "modules/audio_processing/include/audio_processing.h"
 
 namespace webrtc {
@@ -28,7 +27,16 @@ class AudioBuffer;
 
 class ResidualEchoDetector : public EchoDetector {
  public:
+  struct Config {
+    // Number of frames whose powers are averaged before each update of the
+    // covariances. The delays are estimated with the same resolution.
+    int frames_per_update = 1;
+    // Decimation factor of the audio when computing the frame powers.
+    int power_decimation_factor = 1;
+  };
+
   ResidualEchoDetector();
+  explicit ResidualEchoDetector(const Config& config);
   ~ResidualEchoDetector() override;
 
   // This function should be called while holding the render lock.
@@ -50,6 +58,11 @@ class ResidualEchoDetector : public EchoDetector {
   EchoDetector::Metrics GetMetrics() const override;
 
  private:
+  const size_t frames_per_update_;
+  const size_t power_decimation_factor_;
+  const size_t num_delays_;
+  // Adaptation speed per update.
+  const float update_alpha_;
   static std::atomic<int> instance_count_;
   std::unique_ptr<ApmDataDumper> data_dumper_;
   // Keep track if the `Process` function has been previously called.
@@ -64,13 +77,21 @@ class ResidualEchoDetector : public EchoDetector {
   // situation.
   size_t frames_since_zero_buffer_size_ = 0;
 
+  // Render and capture powers accumulated since the last covariance update.
+  float render_power_sum_ = 0.f;
+  float capture_power_sum_ = 0.f;
+  size_t num_accumulated_frames_ = 0;
+
   // Circular buffers containing delayed versions of the power, mean and
-  // standard deviation, for calculating the delayed covariance values.
+  // standard deviation, for calculating the delayed covariance values. Their
+  // content is duplicated so that all the delays can be read contiguously.
   std::vector<float> render_power_;
   std::vector<float> render_power_mean_;
   std::vector<float> render_power_std_dev_;
-  // Covariance estimates for different delay values.
-  std::vector<NormalizedCovarianceEstimator> covariances_;
+  // Covariance and normalized cross-correlation estimates for different delay
+  // values.
+  std::vector<float> covariances_;
+  std::vector<float> normalized_cross_correlations_;
   // Index where next element should be inserted in all of the above circular
   // buffers.
   size_t next_insertion_index_ = 0;
@@ -135,4 +135,33 @@ TEST(ResidualEchoDetectorTests, EchoWithCaptureClockDrift) {
   EXPECT_NEAR(1.f, ed_metrics.echo_likelihood.value(), 0.01f);
 }
 
+TEST(ResidualEchoDetectorTests, EchoWithReducedComplexity) {
+  ResidualEchoDetector::Config config;
+  config.frames_per_update = 2;
+  config.power_decimation_factor = 4;
+  auto echo_detector = rtc::make_ref_counted<ResidualEchoDetector>(config);
+  echo_detector->SetReliabilityForTest(1.0f);
+  std::vector<float> ones(160, 1.f);
+  std::vector<float> zeros(160, 0.f);
+
+  // Same as the Echo test, with a detector which updates its estimates every
+  // other frame.
+  for (int i = 0; i < 1000; i++) {
+    if (i % 20 == 0) {
+      echo_detector->AnalyzeRenderAudio(ones);
+      echo_detector->AnalyzeCaptureAudio(zeros);
+    } else if (i % 20 == 10) {
+      echo_detector->AnalyzeRenderAudio(zeros);
+      echo_detector->AnalyzeCaptureAudio(ones);
+    } else {
+      echo_detector->AnalyzeRenderAudio(zeros);
+      echo_detector->AnalyzeCaptureAudio(zeros);
+    }
+  }
+  // We expect to detect echo with near certain likelihood.
+  auto ed_metrics = echo_detector->GetMetrics();
+  ASSERT_TRUE(ed_metrics.echo_likelihood);
+  EXPECT_NEAR(1.f, ed_metrics.echo_likelihood.value(), 0.02f);
+}
+
 }  // namespace webrtc
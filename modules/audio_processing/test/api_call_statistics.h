@@ -26,6 +26,15 @@ class ApiCallStatistics {
   // Adds a new datapoint.
   void Add(int64_t duration_nanos, CallType call_type);
 
+  // Adds all the datapoints of `other`.
+  void Add(const ApiCallStatistics& other);
+
+  // Returns the number of calls of type `call_type`.
+  size_t NumCalls(CallType call_type) const;
+
+  // Returns the summed duration of all calls.
+  int64_t TotalDurationNanos() const;
+
   // Prints out a report of the statistics.
   void PrintReport() const;
 
@@ -26,7 +26,9 @@ rtc::scoped_refptr<AudioProcessing> AudioProcessingBuilderForTesting::Create() {
   return rtc::make_ref_counted<AudioProcessingImpl>(
       config_, std::move(capture_post_processing_),
       std::move(render_pre_processing_), std::move(echo_control_factory_),
-      std::move(echo_detector_), std::move(capture_analyzer_));
+      std::move(echo_detector_), std::move(capture_analyzer_),
+      /*rnnoise_model_path=*/"", /*rnnoise_lite_model_path=*/"",
+      /*processing_thread_pool=*/nullptr);
 }
 
 #else
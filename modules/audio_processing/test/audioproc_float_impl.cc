@@ -12,6 +12,9 @@
 
 #include <string.h>
 
+#include <algorithm>
+#include <atomic>
+#include <fstream>
 #include <iostream>
 #include <memory>
 #include <string>
@@ -20,13 +23,19 @@
 
 #include "absl/flags/flag.h"
 #include "absl/flags/parse.h"
+#include "absl/strings/match.h"
+#include "absl/strings/str_split.h"
 #include "absl/strings/string_view.h"
 #include "modules/audio_processing/include/audio_processing.h"
 #include "modules/audio_processing/test/aec_dump_based_simulator.h"
 #include "modules/audio_processing/test/audio_processing_simulator.h"
+#include "modules/audio_processing/test/performance_timer.h"
 #include "modules/audio_processing/test/wav_based_simulator.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/platform_thread.h"
 #include "rtc_base/strings/string_builder.h"
+#include "rtc_base/time_utils.h"
+#include "system_wrappers/include/cpu_info.h"
 #include "system_wrappers/include/field_trial.h"
 
 constexpr int kParameterNotSpecifiedValue = -10000;
@@ -238,6 +247,18 @@ ABSL_FLAG(std::string,
           performance_report_output_file,
           "",
           "Generate a CSV file with the API call durations");
+ABSL_FLAG(std::string,
+          batch_file,
+          "",
+          "File listing the inputs to simulate concurrently, one per line. "
+          "A line is either an aec dump filename, or a forward stream input "
+          "wav filename optionally followed by a reverse stream input wav "
+          "filename");
+ABSL_FLAG(int,
+          batch_threads,
+          0,
+          "Number of simulations to run concurrently in batch mode (0 means "
+          "one per core)");
 ABSL_FLAG(bool, verbose, false, "Produce verbose output");
 ABSL_FLAG(bool,
           quiet,
@@ -329,6 +350,8 @@ const char kUsageDescription[] =
     "Usage: audioproc_f [options] -i <input.wav>\n"
     "                   or\n"
     "       audioproc_f [options] -dump_input <aec_dump>\n"
+    "                   or\n"
+    "       audioproc_f [options] -batch_file <input_list>\n"
     "\n\n"
     "Command-line tool to simulate a call using the audio "
     "processing module, either based on wav files or "
@@ -740,6 +763,170 @@ void PerformBasicParameterSanityChecks(
   }
 }
 
+// Result of one simulation in batch mode.
+struct BatchResult {
+  std::string input;
+  ApiCallStatistics api_call_statistics;
+  int64_t duration_nanos = 0;
+};
+
+std::vector<SimulationSettings> CreateBatchSettings(
+    const SimulationSettings& settings,
+    absl::string_view batch_filename) {
+  ReportConditionalErrorAndExit(
+      settings.input_filename || settings.reverse_input_filename ||
+          settings.aec_dump_input_filename,
+      "Error: No input files can be specified together with --batch_file!\n");
+  ReportConditionalErrorAndExit(
+      settings.output_filename || settings.reverse_output_filename ||
+          settings.linear_aec_output_filename ||
+          settings.aec_dump_output_filename ||
+          settings.ed_graph_output_filename ||
+          settings.call_order_output_filename || settings.dump_internal_data,
+      "Error: No output files can be written in batch mode!\n");
+
+  std::ifstream batch_file{std::string(batch_filename)};
+  ReportConditionalErrorAndExit(!batch_file.is_open(),
+                                "Error: Could not open the batch file!\n");
+  std::vector<SimulationSettings> batch_settings;
+  std::string line;
+  while (std::getline(batch_file, line)) {
+    std::vector<absl::string_view> inputs =
+        absl::StrSplit(line, ' ', absl::SkipWhitespace());
+    if (inputs.empty()) {
+      continue;
+    }
+    ReportConditionalErrorAndExit(
+        inputs.size() > 2, "Error: A batch file line has too many inputs!\n");
+
+    SimulationSettings input_settings = settings;
+    input_settings.use_quiet_output = true;
+    if (absl::EndsWithIgnoreCase(inputs[0], ".wav")) {
+      input_settings.input_filename = std::string(inputs[0]);
+      if (inputs.size() == 2) {
+        input_settings.reverse_input_filename = std::string(inputs[1]);
+      }
+    } else {
+      ReportConditionalErrorAndExit(
+          inputs.size() == 2,
+          "Error: A reverse input wav file cannot be specified for an aec "
+          "dump in the batch file!\n");
+      input_settings.aec_dump_input_filename = std::string(inputs[0]);
+    }
+    PerformBasicParameterSanityChecks(
+        input_settings, /*pre_constructed_ap_provided=*/false,
+        /*pre_constructed_ap_builder_provided=*/false);
+    batch_settings.push_back(std::move(input_settings));
+  }
+  ReportConditionalErrorAndExit(batch_settings.empty(),
+                                "Error: The batch file lists no inputs!\n");
+  return batch_settings;
+}
+
+BatchResult RunBatchSimulation(const SimulationSettings& settings) {
+  std::unique_ptr<AudioProcessingSimulator> processor;
+  if (settings.aec_dump_input_filename) {
+    processor.reset(new AecDumpBasedSimulator(settings, nullptr, nullptr));
+  } else {
+    processor.reset(new WavBasedSimulator(settings, nullptr, nullptr));
+  }
+
+  BatchResult result;
+  result.input = settings.aec_dump_input_filename
+                     ? *settings.aec_dump_input_filename
+                     : *settings.input_filename;
+  const int64_t start_time_nanos = rtc::TimeNanos();
+  if (settings.analysis_only) {
+    processor->Analyze();
+  } else {
+    processor->Process();
+  }
+  result.duration_nanos = rtc::TimeNanos() - start_time_nanos;
+  result.api_call_statistics = processor->GetApiCallStatistics();
+  return result;
+}
+
+// Runs the simulations listed in the batch file concurrently and reports the
+// realtime factors and the API call durations over all of them.
+int RunBatch(const SimulationSettings& settings,
+             absl::string_view batch_filename,
+             int num_threads) {
+  const std::vector<SimulationSettings> batch_settings =
+      CreateBatchSettings(settings, batch_filename);
+  if (num_threads <= 0) {
+    num_threads = CpuInfo::DetectNumberOfCores();
+  }
+  num_threads = std::min(num_threads, static_cast<int>(batch_settings.size()));
+
+  std::vector<BatchResult> results(batch_settings.size());
+  std::atomic<size_t> next_simulation(0);
+  auto run_simulations = [&] {
+    for (size_t i = next_simulation++; i < batch_settings.size();
+         i = next_simulation++) {
+      results[i] = RunBatchSimulation(batch_settings[i]);
+    }
+  };
+
+  PerformanceTimer timer(/*num_frames_to_process=*/1);
+  timer.StartTimer();
+  {
+    std::vector<rtc::PlatformThread> threads;
+    for (int i = 0; i < num_threads; ++i) {
+      threads.push_back(
+          rtc::PlatformThread::SpawnJoinable(run_simulations, "audioproc_f"));
+    }
+  }
+  timer.StopTimer();
+
+  // Each capture API call processes 10 ms of audio.
+  constexpr double kSecondsPerCaptureCall = 0.01;
+  auto realtime_factor = [](double audio_seconds, double duration_seconds) {
+    return duration_seconds > 0 ? audio_seconds / duration_seconds : 0;
+  };
+
+  ApiCallStatistics api_call_statistics;
+  double audio_seconds = 0;
+  double simulation_seconds = 0;
+  for (const BatchResult& result : results) {
+    const double result_audio_seconds =
+        kSecondsPerCaptureCall * result.api_call_statistics.NumCalls(
+                                     ApiCallStatistics::CallType::kCapture);
+    const double result_seconds =
+        result.duration_nanos / static_cast<double>(rtc::kNumNanosecsPerSec);
+    if (!settings.use_quiet_output) {
+      std::cout << result.input << ": " << result_audio_seconds
+                << " s of audio in " << result_seconds
+                << " s, realtime factor "
+                << realtime_factor(result_audio_seconds, result_seconds)
+                << std::endl;
+    }
+    api_call_statistics.Add(result.api_call_statistics);
+    audio_seconds += result_audio_seconds;
+    simulation_seconds += result_seconds;
+  }
+
+  const double wall_seconds =
+      timer.GetDurationAverage() / rtc::kNumMicrosecsPerSec;
+  std::cout << std::endl
+            << "Simulated " << results.size() << " inputs on " << num_threads
+            << " threads" << std::endl
+            << " Audio: " << audio_seconds << " s" << std::endl
+            << " Wall time: " << wall_seconds << " s" << std::endl
+            << " Realtime factor per thread: "
+            << realtime_factor(audio_seconds, simulation_seconds) << std::endl
+            << " Aggregate realtime factor: "
+            << realtime_factor(audio_seconds, wall_seconds) << std::endl;
+
+  if (settings.report_performance) {
+    api_call_statistics.PrintReport();
+  }
+  if (settings.performance_report_output_filename) {
+    api_call_statistics.WriteReportToFile(
+        *settings.performance_report_output_filename);
+  }
+  return 0;
+}
+
 int RunSimulation(rtc::scoped_refptr<AudioProcessing> audio_processing,
                   std::unique_ptr<AudioProcessingBuilder> ap_builder,
                   int argc,
@@ -757,6 +944,15 @@ int RunSimulation(rtc::scoped_refptr<AudioProcessing> audio_processing,
   webrtc::field_trial::InitFieldTrialsFromString(field_trials.c_str());
 
   SimulationSettings settings = CreateSettings();
+  const std::string batch_filename = absl::GetFlag(FLAGS_batch_file);
+  if (!batch_filename.empty()) {
+    ReportConditionalErrorAndExit(
+        audio_processing || ap_builder || !input_aecdump.empty(),
+        "Error: --batch_file cannot be used with a pre-constructed audio "
+        "processing object or builder.\n");
+    return RunBatch(settings, batch_filename,
+                    absl::GetFlag(FLAGS_batch_threads));
+  }
   if (!input_aecdump.empty()) {
     settings.aec_dump_input_string = input_aecdump;
     settings.processed_capture_samples = processed_capture_samples;
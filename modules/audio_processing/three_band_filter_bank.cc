@@ -35,6 +35,17 @@
 #include <array>
 
 #include "rtc_base/checks.h"
+#include "rtc_base/system/arch.h"
+#include "system_wrappers/include/cpu_features_wrapper.h"
+
+#if defined(WEBRTC_HAS_NEON)
+#include <arm_neon.h>
+#endif
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+#include <emmintrin.h>
+
+#include "modules/audio_processing/three_band_filter_bank_avx2.h"
+#endif
 
 namespace webrtc {
 namespace {
@@ -100,9 +111,95 @@ const float kDctModulation[ThreeBandFilterBank::kNumNonZeroFilters][kDctSize] =
      {1.f, -2.f, 1.f},
      {1.73205077f, 0.f, -1.73205077f}};
 
+// Number of leading outputs of the filtering that depend on the state.
+constexpr int kNumStateDependentOutputs = kFilterSize * kStride;
+constexpr int kNumSteadyStateOutputs =
+    ThreeBandFilterBank::kSplitBandSize - kNumStateDependentOutputs;
+static_assert(kNumSteadyStateOutputs % 8 == 0,
+              "The steady-state outputs must fill whole SIMD vectors");
+static_assert(kFilterSize == 4 && kStride == 4,
+              "The SIMD filtering assumes 4 taps with a stride of 4");
+
+ThreeBandFilterBank::Optimization DetectOptimization() {
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  if (GetCPUInfo(kAVX2) != 0) {
+    return ThreeBandFilterBank::Optimization::kAvx2;
+  }
+  if (GetCPUInfo(kSSE2) != 0) {
+    return ThreeBandFilterBank::Optimization::kSse2;
+  }
+#elif defined(WEBRTC_HAS_NEON)
+  return ThreeBandFilterBank::Optimization::kNeon;
+#endif
+  return ThreeBandFilterBank::Optimization::kNone;
+}
+
+// Computes the outputs of the filtering that only depend on the current input.
+// See three_band_filter_bank_avx2.h for the details.
+void FilterSteadyState(rtc::ArrayView<const float, kFilterSize> filter,
+                       const float* in,
+                       float* out,
+                       int num_outputs) {
+  for (int k = 0; k < num_outputs; ++k) {
+    float sum = 0.f;
+    for (int i = 0, j = k; i < kFilterSize; ++i, j -= kStride) {
+      sum += in[j] * filter[i];
+    }
+    out[k] = sum;
+  }
+}
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+// SSE2 version of FilterSteadyState.
+void FilterSteadyState_SSE2(rtc::ArrayView<const float, kFilterSize> filter,
+                            const float* in,
+                            float* out,
+                            int num_outputs) {
+  RTC_DCHECK_EQ(num_outputs % 4, 0);
+  const __m128 filter_0 = _mm_set1_ps(filter[0]);
+  const __m128 filter_1 = _mm_set1_ps(filter[1]);
+  const __m128 filter_2 = _mm_set1_ps(filter[2]);
+  const __m128 filter_3 = _mm_set1_ps(filter[3]);
+  for (int k = 0; k < num_outputs; k += 4) {
+    __m128 sum = _mm_setzero_ps();
+    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(&in[k]), filter_0));
+    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(&in[k - kStride]), filter_1));
+    sum = _mm_add_ps(sum,
+                     _mm_mul_ps(_mm_loadu_ps(&in[k - 2 * kStride]), filter_2));
+    sum = _mm_add_ps(sum,
+                     _mm_mul_ps(_mm_loadu_ps(&in[k - 3 * kStride]), filter_3));
+    _mm_storeu_ps(&out[k], sum);
+  }
+}
+#endif
+
+#if defined(WEBRTC_HAS_NEON)
+// NEON version of FilterSteadyState. The products and sums are computed
+// separately, rather than fused, to stay bit-exact.
+void FilterSteadyState_NEON(rtc::ArrayView<const float, kFilterSize> filter,
+                            const float* in,
+                            float* out,
+                            int num_outputs) {
+  RTC_DCHECK_EQ(num_outputs % 4, 0);
+  const float32x4_t filter_0 = vdupq_n_f32(filter[0]);
+  const float32x4_t filter_1 = vdupq_n_f32(filter[1]);
+  const float32x4_t filter_2 = vdupq_n_f32(filter[2]);
+  const float32x4_t filter_3 = vdupq_n_f32(filter[3]);
+  for (int k = 0; k < num_outputs; k += 4) {
+    float32x4_t sum = vdupq_n_f32(0.f);
+    sum = vaddq_f32(sum, vmulq_f32(vld1q_f32(&in[k]), filter_0));
+    sum = vaddq_f32(sum, vmulq_f32(vld1q_f32(&in[k - kStride]), filter_1));
+    sum = vaddq_f32(sum, vmulq_f32(vld1q_f32(&in[k - 2 * kStride]), filter_2));
+    sum = vaddq_f32(sum, vmulq_f32(vld1q_f32(&in[k - 3 * kStride]), filter_3));
+    vst1q_f32(&out[k], sum);
+  }
+}
+#endif
+
 // Filters the input signal `in` with the filter `filter` using a shift by
 // `in_shift`, taking into account the previous state.
 void FilterCore(
+    ThreeBandFilterBank::Optimization optimization,
     rtc::ArrayView<const float, kFilterSize> filter,
     rtc::ArrayView<const float, ThreeBandFilterBank::kSplitBandSize> in,
     const int in_shift,
@@ -132,11 +229,28 @@ void FilterCore(
     }
   }
 
-  for (int k = kFilterSize * kStride, shift = kFilterSize * kStride - in_shift;
-       k < ThreeBandFilterBank::kSplitBandSize; ++k, ++shift) {
-    for (int i = 0, j = shift; i < kFilterSize; ++i, j -= kStride) {
-      out[k] += in[j] * filter[i];
-    }
+  const float* in_steady_state = &in[kNumStateDependentOutputs - in_shift];
+  float* out_steady_state = &out[kNumStateDependentOutputs];
+  switch (optimization) {
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+    case ThreeBandFilterBank::Optimization::kAvx2:
+      three_band_filter_bank::FilterSteadyState_AVX2(
+          filter, in_steady_state, out_steady_state, kNumSteadyStateOutputs);
+      break;
+    case ThreeBandFilterBank::Optimization::kSse2:
+      FilterSteadyState_SSE2(filter, in_steady_state, out_steady_state,
+                             kNumSteadyStateOutputs);
+      break;
+#endif
+#if defined(WEBRTC_HAS_NEON)
+    case ThreeBandFilterBank::Optimization::kNeon:
+      FilterSteadyState_NEON(filter, in_steady_state, out_steady_state,
+                             kNumSteadyStateOutputs);
+      break;
+#endif
+    default:
+      FilterSteadyState(filter, in_steady_state, out_steady_state,
+                        kNumSteadyStateOutputs);
   }
 
   // Update current state.
@@ -149,7 +263,11 @@ void FilterCore(
 // Because the low-pass filter prototype has half bandwidth it is possible to
 // use a DCT to shift it in both directions at the same time, to the center
 // frequencies [1 / 12, 3 / 12, 5 / 12].
-ThreeBandFilterBank::ThreeBandFilterBank() {
+ThreeBandFilterBank::ThreeBandFilterBank()
+    : ThreeBandFilterBank(DetectOptimization()) {}
+
+ThreeBandFilterBank::ThreeBandFilterBank(Optimization optimization)
+    : optimization_(optimization) {
   RTC_DCHECK_EQ(state_analysis_.size(), kNumNonZeroFilters);
   RTC_DCHECK_EQ(state_synthesis_.size(), kNumNonZeroFilters);
   for (int k = 0; k < kNumNonZeroFilters; ++k) {
@@ -207,7 +325,8 @@ void ThreeBandFilterBank::Analysis(
 
       // Filter.
       std::array<float, kSplitBandSize> out_subsampled;
-      FilterCore(filter, in_subsampled, in_shift, out_subsampled, state);
+      FilterCore(optimization_, filter, in_subsampled, in_shift, out_subsampled,
+                 state);
 
       // Band and modulate the output.
       for (int band = 0; band < ThreeBandFilterBank::kNumBands; ++band) {
@@ -263,7 +382,8 @@ void ThreeBandFilterBank::Synthesis(
 
       // Filter.
       std::array<float, kSplitBandSize> out_subsampled;
-      FilterCore(filter, in_subsampled, in_shift, out_subsampled, state);
+      FilterCore(optimization_, filter, in_subsampled, in_shift, out_subsampled,
+                 state);
 
       // Upsample.
       constexpr float kUpsamplingScaling = kSubSampling;
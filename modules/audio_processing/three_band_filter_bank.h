@@ -52,7 +52,12 @@ class ThreeBandFilterBank final {
   static const int kNumNonZeroFilters =
       kSparsity * ThreeBandFilterBank::kNumBands - kNumZeroFilters;
 
+  enum class Optimization { kNone, kSse2, kAvx2, kNeon };
+
+  // Uses the fastest implementation supported by the CPU.
   ThreeBandFilterBank();
+  // Uses `optimization`, which must be supported by the CPU.
+  explicit ThreeBandFilterBank(Optimization optimization);
   ~ThreeBandFilterBank();
 
   // Splits `in` of size kFullBandSize into 3 downsampled frequency bands in
@@ -66,6 +71,7 @@ class ThreeBandFilterBank final {
                  rtc::ArrayView<float, kFullBandSize> out);
 
  private:
+  Optimization optimization_;
   std::array<std::array<float, kMemorySize>, kNumNonZeroFilters>
       state_analysis_;
   std::array<std::array<float, kMemorySize>, kNumNonZeroFilters>
@@ -0,0 +1,44 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <immintrin.h>
+
+#include "modules/audio_processing/three_band_filter_bank_avx2.h"
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+namespace three_band_filter_bank {
+
+// The products and sums are computed separately, rather than fused, to stay
+// bit-exact with the scalar filtering.
+void FilterSteadyState_AVX2(rtc::ArrayView<const float, 4> filter,
+                            const float* in,
+                            float* out,
+                            int num_outputs) {
+  RTC_DCHECK_EQ(num_outputs % 8, 0);
+  const __m256 filter_0 = _mm256_set1_ps(filter[0]);
+  const __m256 filter_1 = _mm256_set1_ps(filter[1]);
+  const __m256 filter_2 = _mm256_set1_ps(filter[2]);
+  const __m256 filter_3 = _mm256_set1_ps(filter[3]);
+  for (int k = 0; k < num_outputs; k += 8) {
+    __m256 sum = _mm256_setzero_ps();
+    sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_loadu_ps(&in[k]), filter_0));
+    sum = _mm256_add_ps(
+        sum, _mm256_mul_ps(_mm256_loadu_ps(&in[k - 4]), filter_1));
+    sum = _mm256_add_ps(
+        sum, _mm256_mul_ps(_mm256_loadu_ps(&in[k - 8]), filter_2));
+    sum = _mm256_add_ps(
+        sum, _mm256_mul_ps(_mm256_loadu_ps(&in[k - 12]), filter_3));
+    _mm256_storeu_ps(&out[k], sum);
+  }
+}
+
+}  // namespace three_band_filter_bank
+}  // namespace webrtc
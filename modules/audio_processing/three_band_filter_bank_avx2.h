@@ -0,0 +1,31 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_AUDIO_PROCESSING_THREE_BAND_FILTER_BANK_AVX2_H_
+#define MODULES_AUDIO_PROCESSING_THREE_BAND_FILTER_BANK_AVX2_H_
+
+#include "api/array_view.h"
+
+namespace webrtc {
+namespace three_band_filter_bank {
+
+// Computes `out[k]` as the sum over `i` of `in[k - 4 * i] * filter[i]` for `k`
+// in [0, `num_outputs`), accumulating the taps in increasing order of `i` so
+// that the result is bit-exact with the scalar filtering. `num_outputs` must
+// be a multiple of 8 and `in` must be readable from `in - 12`.
+void FilterSteadyState_AVX2(rtc::ArrayView<const float, 4> filter,
+                            const float* in,
+                            float* out,
+                            int num_outputs);
+
+}  // namespace three_band_filter_bank
+}  // namespace webrtc
+
+#endif  // MODULES_AUDIO_PROCESSING_THREE_BAND_FILTER_BANK_AVX2_H_
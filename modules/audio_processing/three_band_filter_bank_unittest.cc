@@ -0,0 +1,104 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_processing/three_band_filter_bank.h"
+
+#include <array>
+#include <vector>
+
+#include "api/array_view.h"
+#include "rtc_base/random.h"
+#include "rtc_base/system/arch.h"
+#include "system_wrappers/include/cpu_features_wrapper.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kNumBands = ThreeBandFilterBank::kNumBands;
+constexpr int kFullBandSize = ThreeBandFilterBank::kFullBandSize;
+constexpr int kSplitBandSize = ThreeBandFilterBank::kSplitBandSize;
+
+using Bands = std::array<std::array<float, kSplitBandSize>, kNumBands>;
+
+// Returns the optimizations supported by the CPU, excluding the generic one.
+std::vector<ThreeBandFilterBank::Optimization> AvailableOptimizations() {
+  std::vector<ThreeBandFilterBank::Optimization> optimizations;
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  if (GetCPUInfo(kSSE2) != 0) {
+    optimizations.push_back(ThreeBandFilterBank::Optimization::kSse2);
+  }
+  if (GetCPUInfo(kAVX2) != 0) {
+    optimizations.push_back(ThreeBandFilterBank::Optimization::kAvx2);
+  }
+#endif
+#if defined(WEBRTC_HAS_NEON)
+  optimizations.push_back(ThreeBandFilterBank::Optimization::kNeon);
+#endif
+  return optimizations;
+}
+
+void Analyze(ThreeBandFilterBank& filter_bank,
+             rtc::ArrayView<const float, kFullBandSize> in,
+             Bands& bands) {
+  std::array<rtc::ArrayView<float>, kNumBands> bands_view;
+  for (int band = 0; band < kNumBands; ++band) {
+    bands_view[band] = bands[band];
+  }
+  filter_bank.Analysis(
+      in, rtc::ArrayView<const rtc::ArrayView<float>, kNumBands>(bands_view));
+}
+
+void Synthesize(ThreeBandFilterBank& filter_bank,
+                Bands& bands,
+                rtc::ArrayView<float, kFullBandSize> out) {
+  std::array<rtc::ArrayView<float>, kNumBands> bands_view;
+  for (int band = 0; band < kNumBands; ++band) {
+    bands_view[band] = bands[band];
+  }
+  filter_bank.Synthesis(
+      rtc::ArrayView<const rtc::ArrayView<float>, kNumBands>(bands_view), out);
+}
+
+}  // namespace
+
+// Verifies that the optimized analysis and synthesis are bit-exact with the
+// generic implementation.
+TEST(ThreeBandFilterBankTest, OptimizationsAreBitExact) {
+  constexpr int kNumFrames = 20;
+  for (ThreeBandFilterBank::Optimization optimization :
+       AvailableOptimizations()) {
+    SCOPED_TRACE(static_cast<int>(optimization));
+    ThreeBandFilterBank filter_bank_ref(
+        ThreeBandFilterBank::Optimization::kNone);
+    ThreeBandFilterBank filter_bank(optimization);
+    Random random_generator(42U);
+    std::array<float, kFullBandSize> in;
+    Bands bands_ref;
+    Bands bands;
+    std::array<float, kFullBandSize> out_ref;
+    std::array<float, kFullBandSize> out;
+    for (int frame = 0; frame < kNumFrames; ++frame) {
+      for (float& x : in) {
+        x = (random_generator.Rand<float>() - 0.5f) * 65536.f;
+      }
+      Analyze(filter_bank_ref, in, bands_ref);
+      Analyze(filter_bank, in, bands);
+      for (int band = 0; band < kNumBands; ++band) {
+        ASSERT_EQ(bands_ref[band], bands[band]);
+      }
+      Synthesize(filter_bank_ref, bands_ref, out_ref);
+      Synthesize(filter_bank, bands, out);
+      ASSERT_EQ(out_ref, out);
+    }
+  }
+}
+
+}  // namespace webrtc
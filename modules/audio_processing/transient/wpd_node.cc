@@ -13,9 +13,8 @@
 #include <math.h>
 #include <string.h>
 
-#include "common_audio/fir_filter.h"
-#include "common_audio/fir_filter_factory.h"
-#include "modules/audio_processing/transient/dyadic_decimator.h"
+#include <algorithm>
+
 #include "rtc_base/checks.h"
 
 namespace webrtc {
@@ -23,16 +22,16 @@ namespace webrtc {
 WPDNode::WPDNode(size_t length,
                  const float* coefficients,
                  size_t coefficients_length)
-    :  // The data buffer has parent data length to be able to contain and
-       // filter it.
-      data_(new float[2 * length + 1]),
+    : data_(length, 0.f),
       length_(length),
-      filter_(
-          CreateFirFilter(coefficients, coefficients_length, 2 * length + 1)) {
+      coefficients_(coefficients, coefficients + coefficients_length),
+      // The buffer has room for the filter state and for the parent data,
+      // whose length is at most `2 * length + 1`.
+      filter_buffer_(coefficients_length + 2 * length, 0.f) {
   RTC_DCHECK_GT(length, 0);
   RTC_DCHECK(coefficients);
   RTC_DCHECK_GT(coefficients_length, 0);
-  memset(data_.get(), 0.f, (2 * length + 1) * sizeof(data_[0]));
+  std::reverse(coefficients_.begin(), coefficients_.end());
 }
 
 WPDNode::~WPDNode() {}
@@ -42,16 +41,24 @@ int WPDNode::Update(const float* parent_data, size_t parent_data_length) {
     return -1;
   }
 
-  // Filter data.
-  filter_->Filter(parent_data, parent_data_length, data_.get());
-
-  // Decimate data.
-  const bool kOddSequence = true;
-  size_t output_samples = DyadicDecimate(data_.get(), parent_data_length,
-                                         kOddSequence, data_.get(), length_);
-  if (output_samples != length_) {
-    return -1;
+  // Filters the data and decimates it by keeping the odd samples. Only the
+  // samples kept by the decimation are computed. The loops run over the
+  // outputs for each coefficient, so that they can be vectorized, and
+  // accumulate the products in the same order as `FIRFilterC`.
+  const size_t state_length = coefficients_.size() - 1;
+  std::copy(parent_data, parent_data + parent_data_length,
+            filter_buffer_.begin() + state_length);
+  std::fill(data_.begin(), data_.end(), 0.f);
+  for (size_t k = 0; k < coefficients_.size(); ++k) {
+    const float coefficient = coefficients_[k];
+    const float* x = &filter_buffer_[k + 1];
+    for (size_t i = 0; i < length_; ++i) {
+      data_[i] += coefficient * x[2 * i];
+    }
   }
+  std::copy(filter_buffer_.begin() + parent_data_length,
+            filter_buffer_.begin() + parent_data_length + state_length,
+            filter_buffer_.begin());
 
   // Get abs to all values.
   for (size_t i = 0; i < length_; ++i) {
@@ -65,7 +72,7 @@ int WPDNode::set_data(const float* new_data, size_t length) {
   if (!new_data || length != length_) {
     return -1;
   }
-  memcpy(data_.get(), new_data, length * sizeof(data_[0]));
+  memcpy(data_.data(), new_data, length * sizeof(data_[0]));
   return 0;
 }
 
@@ -12,33 +12,37 @@
 #define MODULES_AUDIO_PROCESSING_TRANSIENT_WPD_NODE_H_
 
 #include <cstddef>
-#include <memory>
+#include <vector>
 
 namespace webrtc {
 
-class FIRFilter;
-
 // A single node of a Wavelet Packet Decomposition (WPD) tree.
 class WPDNode {
  public:
   // Creates a WPDNode. The data vector will contain zeros. The filter will have
   // the coefficients provided.
   WPDNode(size_t length, const float* coefficients, size_t coefficients_length);
+  WPDNode(WPDNode&&) = default;
+  WPDNode& operator=(WPDNode&&) = default;
   ~WPDNode();
 
   // Updates the node data. `parent_data` / 2 must be equals to `length_`.
   // Returns 0 if correct, and -1 otherwise.
   int Update(const float* parent_data, size_t parent_data_length);
 
-  const float* data() const { return data_.get(); }
+  const float* data() const { return data_.data(); }
   // Returns 0 if correct, and -1 otherwise.
   int set_data(const float* new_data, size_t length);
   size_t length() const { return length_; }
 
  private:
-  std::unique_ptr<float[]> data_;
+  std::vector<float> data_;
   size_t length_;
-  std::unique_ptr<FIRFilter> filter_;
+  // Filter coefficients in reverse order.
+  std::vector<float> coefficients_;
+  // The last `coefficients_.size() - 1` samples of the previous parent data
+  // followed by the current parent data.
+  std::vector<float> filter_buffer_;
 };
 
 }  // namespace webrtc
@@ -10,6 +10,7 @@
 
 #include "modules/audio_processing/transient/wpd_node.h"
 
+#include <math.h>
 #include <string.h>
 
 #include "test/gtest.h"
@@ -53,6 +54,25 @@ TEST(WPDNodeTest, UpdateWithArbitraryDataAndArbitraryFilter) {
   EXPECT_NEAR(0.94f, node.data()[4], kTolerance);
 }
 
+// Checks that the filter state is carried over to the next update by comparing
+// two consecutive updates with the decimated convolution of the whole data.
+TEST(WPDNodeTest, ConsecutiveUpdatesMatchTheDecimatedConvolution) {
+  WPDNode node(kDataLength, kCoefficients, kCoefficientsLength);
+  for (int update = 0; update < 2; ++update) {
+    SCOPED_TRACE(update);
+    EXPECT_EQ(0, node.Update(kParentData, kParentDataLength));
+    for (size_t i = 0; i < kDataLength; ++i) {
+      const size_t n = update * kParentDataLength + 2 * i + 1;
+      float expected = 0.f;
+      for (size_t j = 0; j < kCoefficientsLength && j <= n; ++j) {
+        expected +=
+            kCoefficients[j] * kParentData[(n - j) % kParentDataLength];
+      }
+      EXPECT_NEAR(fabs(expected), node.data()[i], kTolerance);
+    }
+  }
+}
+
 TEST(WPDNodeTest, ExpectedErrorReturnValue) {
   WPDNode node(kDataLength, kCoefficients, kCoefficientsLength);
   EXPECT_EQ(-1, node.Update(kParentData, kParentDataLength - 1));
@@ -29,37 +29,27 @@ WPDTree::WPDTree(size_t data_length,
   RTC_DCHECK(high_pass_coefficients);
   RTC_DCHECK(low_pass_coefficients);
   RTC_DCHECK_GT(levels, 0);
-  // Size is 1 more, so we can use the array as 1-based. nodes_[0] is never
-  // allocated.
-  nodes_.reset(new std::unique_ptr<WPDNode>[num_nodes_ + 1]);
+  nodes_.reserve(num_nodes_);
 
   // Create the first node
   const float kRootCoefficient = 1.f;  // Identity Coefficient.
-  nodes_[1].reset(new WPDNode(data_length, &kRootCoefficient, 1));
-  // Variables used to create the rest of the nodes.
-  size_t index = 1;
-  size_t index_left_child = 0;
-  size_t index_right_child = 0;
+  nodes_.emplace_back(data_length, &kRootCoefficient, 1);
 
-  int num_nodes_at_curr_level = 0;
-
-  // Branching each node in each level to create its children. The last level is
-  // not branched (all the nodes of that level are leaves).
+  // Creating the nodes level by level, and each level from left to right,
+  // stores them in the order of their indexes. The last level is not branched
+  // (all the nodes of that level are leaves).
   for (int current_level = 0; current_level < levels; ++current_level) {
-    num_nodes_at_curr_level = 1 << current_level;
+    const int num_nodes_at_curr_level = 1 << current_level;
     for (int i = 0; i < num_nodes_at_curr_level; ++i) {
-      index = (1 << current_level) + i;
-      // Obtain the index of the current node children.
-      index_left_child = index * 2;
-      index_right_child = index_left_child + 1;
-      nodes_[index_left_child].reset(new WPDNode(nodes_[index]->length() / 2,
-                                                 low_pass_coefficients,
-                                                 coefficients_length));
-      nodes_[index_right_child].reset(new WPDNode(nodes_[index]->length() / 2,
-                                                  high_pass_coefficients,
-                                                  coefficients_length));
+      const size_t child_length =
+          nodes_[(1 << current_level) + i - 1].length() / 2;
+      nodes_.emplace_back(child_length, low_pass_coefficients,
+                          coefficients_length);
+      nodes_.emplace_back(child_length, high_pass_coefficients,
+                          coefficients_length);
     }
   }
+  RTC_DCHECK_EQ(nodes_.size(), static_cast<size_t>(num_nodes_));
 }
 
 WPDTree::~WPDTree() {}
@@ -69,7 +59,7 @@ WPDNode* WPDTree::NodeAt(int level, int index) {
     return NULL;
   }
 
-  return nodes_[(1 << level) + index].get();
+  return &nodes_[(1 << level) + index - 1];
 }
 
 int WPDTree::Update(const float* data, size_t data_length) {
@@ -78,37 +68,19 @@ int WPDTree::Update(const float* data, size_t data_length) {
   }
 
   // Update the root node.
-  int update_result = nodes_[1]->set_data(data, data_length);
+  int update_result = nodes_[0].set_data(data, data_length);
   if (update_result != 0) {
     return -1;
   }
 
-  // Variables used to update the rest of the nodes.
-  size_t index = 1;
-  size_t index_left_child = 0;
-  size_t index_right_child = 0;
-
-  int num_nodes_at_curr_level = 0;
-
-  for (int current_level = 0; current_level < levels_; ++current_level) {
-    num_nodes_at_curr_level = 1 << current_level;
-    for (int i = 0; i < num_nodes_at_curr_level; ++i) {
-      index = (1 << current_level) + i;
-      // Obtain the index of the current node children.
-      index_left_child = index * 2;
-      index_right_child = index_left_child + 1;
-
-      update_result = nodes_[index_left_child]->Update(nodes_[index]->data(),
-                                                       nodes_[index]->length());
-      if (update_result != 0) {
-        return -1;
-      }
-
-      update_result = nodes_[index_right_child]->Update(
-          nodes_[index]->data(), nodes_[index]->length());
-      if (update_result != 0) {
-        return -1;
-      }
+  // Each node with (1-based) index `n` is computed from its parent, whose
+  // index is `n / 2`. Since the parents precede their children in `nodes_`,
+  // the nodes are updated in a single pass over the array.
+  for (size_t n = 2; n <= nodes_.size(); ++n) {
+    const WPDNode& parent = nodes_[n / 2 - 1];
+    update_result = nodes_[n - 1].Update(parent.data(), parent.length());
+    if (update_result != 0) {
+      return -1;
     }
   }
 
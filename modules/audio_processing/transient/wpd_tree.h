@@ -13,7 +13,7 @@
 
 #include <stddef.h>
 
-#include <memory>
+#include <vector>
 
 #include "modules/audio_processing/transient/wpd_node.h"
 
@@ -29,9 +29,10 @@ namespace webrtc {
 // The number of nodes in the tree will be 2 ^ levels - 1.
 //
 // Implementation details: Since the tree always will be a complete binary tree,
-// it is implemented using a single linear array instead of managing the
-// relationships in each node. For convience is better to use a array that
-// starts in 1 (instead of 0). Taking that into account, the following formulas
+// it is implemented using a single contiguous array of nodes instead of
+// managing the relationships in each node. For convience the formulas below
+// use indexes that start in 1 (instead of 0), the node with index `n` being
+// stored at `nodes_[n - 1]`. Taking that into account, the following formulas
 // apply:
 // Root node index: 1.
 // Node(Level, Index in that level): 2 ^ Level + (Index in that level).
@@ -84,7 +85,7 @@ class WPDTree {
   size_t data_length_;
   int levels_;
   int num_nodes_;
-  std::unique_ptr<std::unique_ptr<WPDNode>[]> nodes_;
+  std::vector<WPDNode> nodes_;
 };
 
 }  // namespace webrtc
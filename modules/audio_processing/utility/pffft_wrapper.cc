@@ -10,7 +10,11 @@
 
 #include "modules/audio_processing/utility/pffft_wrapper.h"
 
+#include <map>
+#include <utility>
+
 #include "rtc_base/checks.h"
+#include "rtc_base/synchronization/mutex.h"
 #include "third_party/pffft/src/pffft.h"
 
 namespace webrtc {
@@ -24,6 +28,33 @@ float* AllocatePffftBuffer(size_t size) {
   return static_cast<float*>(pffft_aligned_malloc(size * sizeof(float)));
 }
 
+// Returns the setup for `fft_size` and `fft_type`. The setups only hold the
+// twiddle factors, which are not modified by the transforms, so a setup is
+// shared by all the instances with the same FFT size and type, e.g. those of
+// the RNN VADs of all the audio processing instances.
+std::shared_ptr<PFFFT_Setup> GetSharedSetup(size_t fft_size,
+                                            Pffft::FftType fft_type) {
+  static Mutex* const cache_mutex = new Mutex();
+  static auto* const cache =
+      new std::map<std::pair<size_t, Pffft::FftType>,
+                   std::weak_ptr<PFFFT_Setup>>();
+
+  MutexLock lock(cache_mutex);
+  std::weak_ptr<PFFFT_Setup>& cached = (*cache)[{fft_size, fft_type}];
+  std::shared_ptr<PFFFT_Setup> setup = cached.lock();
+  if (!setup) {
+    PFFFT_Setup* new_setup = pffft_new_setup(
+        fft_size,
+        fft_type == Pffft::FftType::kReal ? PFFFT_REAL : PFFFT_COMPLEX);
+    if (!new_setup) {
+      return nullptr;
+    }
+    setup = std::shared_ptr<PFFFT_Setup>(new_setup, pffft_destroy_setup);
+    cached = setup;
+  }
+  return setup;
+}
+
 }  // namespace
 
 Pffft::FloatBuffer::FloatBuffer(size_t fft_size, FftType fft_type)
@@ -45,9 +76,7 @@ rtc::ArrayView<float> Pffft::FloatBuffer::GetView() {
 Pffft::Pffft(size_t fft_size, FftType fft_type)
     : fft_size_(fft_size),
       fft_type_(fft_type),
-      pffft_status_(pffft_new_setup(
-          fft_size_,
-          fft_type == Pffft::FftType::kReal ? PFFFT_REAL : PFFFT_COMPLEX)),
+      pffft_status_(GetSharedSetup(fft_size_, fft_type_)),
       scratch_buffer_(
           AllocatePffftBuffer(GetBufferSize(fft_size_, fft_type_))) {
   RTC_DCHECK(pffft_status_);
@@ -55,7 +84,6 @@ Pffft::Pffft(size_t fft_size, FftType fft_type)
 }
 
 Pffft::~Pffft() {
-  pffft_destroy_setup(pffft_status_);
   pffft_aligned_free(scratch_buffer_);
 }
 
@@ -98,10 +126,10 @@ void Pffft::ForwardTransform(const FloatBuffer& in,
   RTC_DCHECK_EQ(in.size(), out->size());
   RTC_DCHECK(scratch_buffer_);
   if (ordered) {
-    pffft_transform_ordered(pffft_status_, in.const_data(), out->data(),
+    pffft_transform_ordered(pffft_status_.get(), in.const_data(), out->data(),
                             scratch_buffer_, PFFFT_FORWARD);
   } else {
-    pffft_transform(pffft_status_, in.const_data(), out->data(),
+    pffft_transform(pffft_status_.get(), in.const_data(), out->data(),
                     scratch_buffer_, PFFFT_FORWARD);
   }
 }
@@ -113,10 +141,10 @@ void Pffft::BackwardTransform(const FloatBuffer& in,
   RTC_DCHECK_EQ(in.size(), out->size());
   RTC_DCHECK(scratch_buffer_);
   if (ordered) {
-    pffft_transform_ordered(pffft_status_, in.const_data(), out->data(),
+    pffft_transform_ordered(pffft_status_.get(), in.const_data(), out->data(),
                             scratch_buffer_, PFFFT_BACKWARD);
   } else {
-    pffft_transform(pffft_status_, in.const_data(), out->data(),
+    pffft_transform(pffft_status_.get(), in.const_data(), out->data(),
                     scratch_buffer_, PFFFT_BACKWARD);
   }
 }
@@ -128,7 +156,7 @@ void Pffft::FrequencyDomainConvolve(const FloatBuffer& fft_x,
   RTC_DCHECK_EQ(fft_x.size(), GetBufferSize(fft_size_, fft_type_));
   RTC_DCHECK_EQ(fft_x.size(), fft_y.size());
   RTC_DCHECK_EQ(fft_x.size(), out->size());
-  pffft_zconvolve_accumulate(pffft_status_, fft_x.const_data(),
+  pffft_zconvolve_accumulate(pffft_status_.get(), fft_x.const_data(),
                              fft_y.const_data(), out->data(), scaling);
 }
 
@@ -21,7 +21,8 @@ struct PFFFT_Setup;
 namespace webrtc {
 
 // Pretty-Fast Fast Fourier Transform (PFFFT) wrapper class.
-// Not thread safe.
+// Not thread safe. The read-only PFFFT setup is shared by all the instances
+// with the same FFT size and type; each instance only owns its scratch buffer.
 class Pffft {
  public:
   enum class FftType { kReal, kComplex };
@@ -85,7 +86,7 @@ class Pffft {
  private:
   const size_t fft_size_;
   const FftType fft_type_;
-  PFFFT_Setup* pffft_status_;
+  const std::shared_ptr<PFFFT_Setup> pffft_status_;
   float* const scratch_buffer_;
 };
 
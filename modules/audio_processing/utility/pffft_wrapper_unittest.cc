@@ -178,5 +178,25 @@ TEST(PffftTest, FftBitExactness) {
   }
 }
 
+// Checks that the instances sharing a setup keep working when the other
+// instances are destroyed.
+TEST(PffftTest, InstancesWithTheSameSizeShareTheSetup) {
+  constexpr size_t kFftSize = 128;
+  std::srand(0);
+  auto pffft1 = std::make_unique<Pffft>(kFftSize, Pffft::FftType::kReal);
+  Pffft pffft2(kFftSize, Pffft::FftType::kReal);
+  auto in = pffft2.CreateBuffer();
+  auto out1 = pffft2.CreateBuffer();
+  auto out2 = pffft2.CreateBuffer();
+  rtc::ArrayView<float> in_view = in->GetView();
+  for (float& x : in_view) {
+    x = frand() * 2.0 - 1.0;
+  }
+  pffft1->ForwardTransform(*in, out1.get(), /*ordered=*/true);
+  pffft1.reset();
+  pffft2.ForwardTransform(*in, out2.get(), /*ordered=*/true);
+  ExpectArrayViewsEquality(out1->GetConstView(), out2->GetConstView());
+}
+
 }  // namespace test
 }  // namespace webrtc
@@ -0,0 +1,70 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+// Branch-free approximations of the activation functions used by the RNNoise
+// based networks. Unlike the table based approximations, they only use
+// arithmetic and comparisons, so that loops applying them vectorize and they
+// map one to one onto SIMD instructions. This header is shared by C and C++
+// code.
+
+#ifndef MODULES_AUDIO_PROCESSING_UTILITY_RATIONAL_ACTIVATIONS_H_
+#define MODULES_AUDIO_PROCESSING_UTILITY_RATIONAL_ACTIVATIONS_H_
+
+// Coefficients of the [5/4] rational approximation of tanh(x).
+#define WEBRTC_RATIONAL_TANH_N0 952.52801514f
+#define WEBRTC_RATIONAL_TANH_N1 96.39235687f
+#define WEBRTC_RATIONAL_TANH_N2 0.60863042f
+#define WEBRTC_RATIONAL_TANH_D0 952.72399902f
+#define WEBRTC_RATIONAL_TANH_D1 413.36801147f
+#define WEBRTC_RATIONAL_TANH_D2 11.88600922f
+// The input is clamped to avoid overflowing the polynomials.
+#define WEBRTC_RATIONAL_TANH_MAX_INPUT 10.f
+
+// Maximum absolute errors with respect to tanh(x) and 1 / (1 + exp(-x)).
+#define WEBRTC_RATIONAL_TANH_MAX_ERROR 1e-4f
+#define WEBRTC_RATIONAL_SIGMOID_MAX_ERROR 5e-5f
+
+// Approximates tanh(x). NaN is mapped to 1, like the table approximation.
+static inline float WebRtcApm_RationalTanh(float x) {
+  float x2, num, den, y;
+  x = x < WEBRTC_RATIONAL_TANH_MAX_INPUT ? x : WEBRTC_RATIONAL_TANH_MAX_INPUT;
+  x = x > -WEBRTC_RATIONAL_TANH_MAX_INPUT ? x : -WEBRTC_RATIONAL_TANH_MAX_INPUT;
+  x2 = x * x;
+  num = ((WEBRTC_RATIONAL_TANH_N2 * x2 + WEBRTC_RATIONAL_TANH_N1) * x2 +
+         WEBRTC_RATIONAL_TANH_N0) *
+        x;
+  den = (WEBRTC_RATIONAL_TANH_D2 * x2 + WEBRTC_RATIONAL_TANH_D1) * x2 +
+        WEBRTC_RATIONAL_TANH_D0;
+  y = num / den;
+  y = y < 1.f ? y : 1.f;
+  return y > -1.f ? y : -1.f;
+}
+
+// Approximates the logistic sigmoid 1 / (1 + exp(-x)).
+static inline float WebRtcApm_RationalSigmoid(float x) {
+  return 0.5f + 0.5f * WebRtcApm_RationalTanh(0.5f * x);
+}
+
+// In-place versions of the functions above for `n` values.
+static inline void WebRtcApm_RationalTanhInPlace(float* x, int n) {
+  int i;
+  for (i = 0; i < n; ++i) {
+    x[i] = WebRtcApm_RationalTanh(x[i]);
+  }
+}
+
+static inline void WebRtcApm_RationalSigmoidInPlace(float* x, int n) {
+  int i;
+  for (i = 0; i < n; ++i) {
+    x[i] = WebRtcApm_RationalSigmoid(x[i]);
+  }
+}
+
+#endif  // MODULES_AUDIO_PROCESSING_UTILITY_RATIONAL_ACTIVATIONS_H_
@@ -0,0 +1,75 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_processing/utility/rational_activations.h"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+// Returns values evenly spread over an interval larger than the input clamping
+// range.
+std::vector<float> GetTestInputs() {
+  std::vector<float> x;
+  for (float v = -12.f; v < 12.f; v += 1e-3f) {
+    x.push_back(v);
+  }
+  return x;
+}
+
+TEST(RationalActivations, TanhWithinErrorBound) {
+  for (float x : GetTestInputs()) {
+    SCOPED_TRACE(x);
+    ASSERT_NEAR(WebRtcApm_RationalTanh(x), std::tanh(x),
+                WEBRTC_RATIONAL_TANH_MAX_ERROR);
+  }
+}
+
+TEST(RationalActivations, SigmoidWithinErrorBound) {
+  for (float x : GetTestInputs()) {
+    SCOPED_TRACE(x);
+    ASSERT_NEAR(WebRtcApm_RationalSigmoid(x), 1.f / (1.f + std::exp(-x)),
+                WEBRTC_RATIONAL_SIGMOID_MAX_ERROR);
+  }
+}
+
+TEST(RationalActivations, TanhSaturates) {
+  EXPECT_EQ(WebRtcApm_RationalTanh(1e30f), 1.f);
+  EXPECT_EQ(WebRtcApm_RationalTanh(-1e30f), -1.f);
+  EXPECT_EQ(WebRtcApm_RationalTanh(std::numeric_limits<float>::infinity()),
+            1.f);
+  EXPECT_EQ(WebRtcApm_RationalTanh(-std::numeric_limits<float>::infinity()),
+            -1.f);
+  EXPECT_NEAR(
+      WebRtcApm_RationalTanh(std::numeric_limits<float>::quiet_NaN()), 1.f,
+      WEBRTC_RATIONAL_TANH_MAX_ERROR);
+}
+
+TEST(RationalActivations, InPlaceMatchesScalar) {
+  std::vector<float> tanh_values = GetTestInputs();
+  std::vector<float> sigmoid_values = GetTestInputs();
+  WebRtcApm_RationalTanhInPlace(tanh_values.data(),
+                                static_cast<int>(tanh_values.size()));
+  WebRtcApm_RationalSigmoidInPlace(sigmoid_values.data(),
+                                   static_cast<int>(sigmoid_values.size()));
+  const std::vector<float> x = GetTestInputs();
+  for (size_t i = 0; i < x.size(); ++i) {
+    EXPECT_FLOAT_EQ(tanh_values[i], WebRtcApm_RationalTanh(x[i]));
+    EXPECT_FLOAT_EQ(sigmoid_values[i], WebRtcApm_RationalSigmoid(x[i]));
+  }
+}
+
+}  // namespace
+}  // namespace webrtc
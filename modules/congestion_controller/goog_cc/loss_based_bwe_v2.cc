@@ -714,25 +714,7 @@ bool LossBasedBweV2::IsConfigValid() const {
 }
 
 double LossBasedBweV2::GetAverageReportedLossRatio() const {
-  if (num_observations_ <= 0) {
-    return 0.0;
-  }
-
-  double num_packets = 0;
-  double num_lost_packets = 0;
-  for (const Observation& observation : observations_) {
-    if (!observation.IsInitialized()) {
-      continue;
-    }
-
-    double instant_temporal_weight =
-        instant_upper_bound_temporal_weights_[(num_observations_ - 1) -
-                                              observation.id];
-    num_packets += instant_temporal_weight * observation.num_packets;
-    num_lost_packets += instant_temporal_weight * observation.num_lost_packets;
-  }
-
-  return num_lost_packets / num_packets;
+  return cached_average_reported_loss_ratio_;
 }
 
 DataRate LossBasedBweV2::GetCandidateBandwidthUpperBound() const {
@@ -920,9 +902,8 @@ double LossBasedBweV2::GetObjective(
         temporal_weight *
         ((observation.num_lost_packets * std::log(loss_probability)) +
          (observation.num_received_packets * std::log(1.0 - loss_probability)));
-    objective +=
-        temporal_weight * high_bandwidth_bias * observation.num_packets;
   }
+  objective += high_bandwidth_bias * cached_weighted_num_packets_;
 
   return objective;
 }
@@ -984,6 +965,31 @@ void LossBasedBweV2::CalculateTemporalWeights() {
   }
 }
 
+void LossBasedBweV2::CalculateObservationTerms() {
+  cached_average_reported_loss_ratio_ = 0.0;
+  cached_weighted_num_packets_ = 0.0;
+  if (num_observations_ <= 0) {
+    return;
+  }
+
+  double num_packets = 0;
+  double num_lost_packets = 0;
+  for (const Observation& observation : observations_) {
+    if (!observation.IsInitialized()) {
+      continue;
+    }
+
+    const int age = (num_observations_ - 1) - observation.id;
+    double instant_temporal_weight = instant_upper_bound_temporal_weights_[age];
+    num_packets += instant_temporal_weight * observation.num_packets;
+    num_lost_packets += instant_temporal_weight * observation.num_lost_packets;
+    cached_weighted_num_packets_ +=
+        temporal_weights_[age] * observation.num_packets;
+  }
+
+  cached_average_reported_loss_ratio_ = num_lost_packets / num_packets;
+}
+
 void LossBasedBweV2::NewtonsMethodUpdate(
     ChannelParameters& channel_parameters) const {
   if (num_observations_ <= 0) {
@@ -1084,6 +1090,7 @@ bool LossBasedBweV2::PushBackObservation(
 
   partial_observation_ = PartialObservation();
 
+  CalculateObservationTerms();
   CalculateInstantUpperBound();
   return true;
 }
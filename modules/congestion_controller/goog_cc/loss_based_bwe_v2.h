@@ -160,6 +160,9 @@ class LossBasedBweV2 {
   void CalculateInstantUpperBound();
 
   void CalculateTemporalWeights();
+  // Updates the terms of the objective that only depend on the observations,
+  // so that they are not recomputed for each candidate.
+  void CalculateObservationTerms();
   void NewtonsMethodUpdate(ChannelParameters& channel_parameters) const;
 
   // Returns false if there exists a kBwOverusing or kBwUnderusing in the
@@ -191,6 +194,10 @@ class LossBasedBweV2 {
   Timestamp last_send_time_most_recent_observation_ = Timestamp::PlusInfinity();
   Timestamp last_time_estimate_reduced_ = Timestamp::MinusInfinity();
   absl::optional<DataRate> cached_instant_upper_bound_;
+  double cached_average_reported_loss_ratio_ = 0.0;
+  // Sum of the number of packets of the observations, weighted by
+  // `temporal_weights_`.
+  double cached_weighted_num_packets_ = 0.0;
   std::vector<double> instant_upper_bound_temporal_weights_;
   std::vector<double> temporal_weights_;
   std::deque<BandwidthUsage> delay_detector_states_;
@@ -50,32 +50,6 @@ size_t ReadTrendlineFilterWindowSize(const FieldTrialsView* key_value_config) {
   return TrendlineEstimatorSettings::kDefaultTrendlineWindowSize;
 }
 
-absl::optional<double> LinearFitSlope(
-    const std::deque<TrendlineEstimator::PacketTiming>& packets) {
-  RTC_DCHECK(packets.size() >= 2);
-  // Compute the "center of mass".
-  double sum_x = 0;
-  double sum_y = 0;
-  for (const auto& packet : packets) {
-    sum_x += packet.arrival_time_ms;
-    sum_y += packet.smoothed_delay_ms;
-  }
-  double x_avg = sum_x / packets.size();
-  double y_avg = sum_y / packets.size();
-  // Compute the slope k = \sum (x_i-x_avg)(y_i-y_avg) / \sum (x_i-x_avg)^2
-  double numerator = 0;
-  double denominator = 0;
-  for (const auto& packet : packets) {
-    double x = packet.arrival_time_ms;
-    double y = packet.smoothed_delay_ms;
-    numerator += (x - x_avg) * (y - y_avg);
-    denominator += (x - x_avg) * (x - x_avg);
-  }
-  if (denominator == 0)
-    return absl::nullopt;
-  return numerator / denominator;
-}
-
 absl::optional<double> ComputeSlopeCap(
     const std::deque<TrendlineEstimator::PacketTiming>& packets,
     const TrendlineEstimatorSettings& settings) {
@@ -214,6 +188,9 @@ void TrendlineEstimator::UpdateTrendline(double recv_delta_ms,
   delay_hist_.emplace_back(
       static_cast<double>(arrival_time_ms - first_arrival_time_ms_),
       smoothed_delay_, accumulated_delay_);
+  // The sums don't depend on the order of the packets, so they are updated
+  // before sorting.
+  UpdateRegressionSums(delay_hist_.back(), 1.0);
   if (settings_.enable_sort) {
     for (size_t i = delay_hist_.size() - 1;
          i > 0 &&
@@ -222,8 +199,12 @@ void TrendlineEstimator::UpdateTrendline(double recv_delta_ms,
       std::swap(delay_hist_[i], delay_hist_[i - 1]);
     }
   }
-  if (delay_hist_.size() > settings_.window_size)
+  if (delay_hist_.size() > settings_.window_size) {
+    UpdateRegressionSums(delay_hist_.front(), -1.0);
     delay_hist_.pop_front();
+  }
+  if (++packets_since_regression_reset_ >= settings_.window_size)
+    ResetRegressionSums();
 
   // Simple linear regression.
   double trend = prev_trend_;
@@ -233,7 +214,7 @@ void TrendlineEstimator::UpdateTrendline(double recv_delta_ms,
     // 0 < trend < 1   ->  the delay increases, queues are filling up
     //   trend == 0    ->  the delay does not change
     //   trend < 0     ->  the delay decreases, queues are being emptied
-    trend = LinearFitSlope(delay_hist_).value_or(trend);
+    trend = LinearFitSlope().value_or(trend);
     if (settings_.enable_cap) {
       absl::optional<double> cap = ComputeSlopeCap(delay_hist_, settings_);
       // We only use the cap to filter out overuse detections, not
@@ -248,6 +229,40 @@ void TrendlineEstimator::UpdateTrendline(double recv_delta_ms,
   Detect(trend, send_delta_ms, arrival_time_ms);
 }
 
+void TrendlineEstimator::UpdateRegressionSums(const PacketTiming& packet,
+                                              double sign) {
+  double x = packet.arrival_time_ms - regression_origin_x_;
+  double y = packet.smoothed_delay_ms - regression_origin_y_;
+  sum_x_ += sign * x;
+  sum_y_ += sign * y;
+  sum_xx_ += sign * x * x;
+  sum_xy_ += sign * x * y;
+}
+
+void TrendlineEstimator::ResetRegressionSums() {
+  packets_since_regression_reset_ = 0;
+  sum_x_ = sum_y_ = sum_xx_ = sum_xy_ = 0;
+  if (delay_hist_.empty())
+    return;
+  regression_origin_x_ = delay_hist_.front().arrival_time_ms;
+  regression_origin_y_ = delay_hist_.front().smoothed_delay_ms;
+  for (const PacketTiming& packet : delay_hist_) {
+    UpdateRegressionSums(packet, 1.0);
+  }
+}
+
+absl::optional<double> TrendlineEstimator::LinearFitSlope() const {
+  RTC_DCHECK(delay_hist_.size() >= 2);
+  // The slope k = \sum (x_i-x_avg)(y_i-y_avg) / \sum (x_i-x_avg)^2, expanded
+  // in terms of the running sums.
+  double n = delay_hist_.size();
+  double numerator = sum_xy_ - sum_x_ * sum_y_ / n;
+  double denominator = sum_xx_ - sum_x_ * sum_x_ / n;
+  if (denominator <= 0)
+    return absl::nullopt;
+  return numerator / denominator;
+}
+
 void TrendlineEstimator::Update(double recv_delta_ms,
                                 double send_delta_ms,
                                 int64_t send_time_ms,
@@ -17,6 +17,7 @@
 #include <memory>
 #include <utility>
 
+#include "absl/types/optional.h"
 #include "api/field_trials_view.h"
 #include "api/network_state_predictor.h"
 #include "modules/congestion_controller/goog_cc/delay_increase_detector_interface.h"
@@ -93,6 +94,13 @@ class TrendlineEstimator : public DelayIncreaseDetectorInterface {
 
   void UpdateThreshold(double modified_offset, int64_t now_ms);
 
+  // Adds `sign` times the coordinates of `packet` to the regression sums.
+  void UpdateRegressionSums(const PacketTiming& packet, double sign);
+  // Recomputes the regression sums from `delay_hist_`, relative to its oldest
+  // packet.
+  void ResetRegressionSums();
+  absl::optional<double> LinearFitSlope() const;
+
   // Parameters.
   TrendlineEstimatorSettings settings_;
   const double smoothing_coef_;
@@ -106,6 +114,18 @@ class TrendlineEstimator : public DelayIncreaseDetectorInterface {
   double smoothed_delay_;
   // Linear least squares regression.
   std::deque<PacketTiming> delay_hist_;
+  // Running sums over `delay_hist_`, so that the slope is updated in constant
+  // time per packet. The coordinates are relative to an origin which is moved
+  // to the oldest packet each time the sums are recomputed from the window,
+  // once per `settings_.window_size` packets. That keeps the sums small and
+  // stops the rounding errors of the updates from accumulating.
+  double regression_origin_x_ = 0;
+  double regression_origin_y_ = 0;
+  double sum_x_ = 0;
+  double sum_y_ = 0;
+  double sum_xx_ = 0;
+  double sum_xy_ = 0;
+  size_t packets_since_regression_reset_ = 0;
 
   const double k_up_;
   const double k_down_;
@@ -16,6 +16,7 @@
 
 #include "api/transport/field_trial_based_config.h"
 #include "rtc_base/random.h"
+#include "test/explicit_key_value_config.h"
 #include "test/gtest.h"
 
 namespace webrtc {
@@ -148,4 +149,28 @@ TEST_F(TrendlineEstimatorTest, IncludesSmallPacketsByDefault) {
   EXPECT_EQ(count, kPacketCount);  // All packets processed
 }
 
+TEST(TrendlineEstimatorLongRunTest, StaysNormalOverManyWindows) {
+  // Runs through many windows, so that the running regression sums are both
+  // updated and recomputed, with arrival times far from the first packet.
+  test::ExplicitKeyValueConfig config(
+      "WebRTC-Bwe-TrendlineEstimatorSettings/sort:true,window_size:25/");
+  TrendlineEstimator estimator(&config, nullptr);
+  int64_t send_time_ms = 123456789;
+  int64_t recv_time_ms = 987654321;
+  for (int i = 0; i < 100000; ++i) {
+    send_time_ms += 20;
+    recv_time_ms += 20;
+    estimator.Update(20, 20, send_time_ms, recv_time_ms, 1200, true);
+    ASSERT_EQ(estimator.State(), BandwidthUsage::kBwNormal) << i;
+  }
+
+  // An overuse is still detected after that.
+  for (int i = 0; i < 25; ++i) {
+    send_time_ms += 20;
+    recv_time_ms += 22;
+    estimator.Update(22, 20, send_time_ms, recv_time_ms, 1200, true);
+  }
+  EXPECT_EQ(estimator.State(), BandwidthUsage::kBwOverusing);
+}
+
 }  // namespace webrtc
@@ -0,0 +1,81 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#include "modules/congestion_controller/rtp/transport_feedback_bandwidth_estimator.h"
+
+#include <utility>
+
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+
+TransportFeedbackBandwidthEstimator::TransportFeedbackBandwidthEstimator(
+    std::unique_ptr<NetworkControllerInterface> controller)
+    : controller_(std::move(controller)) {
+  RTC_DCHECK(controller_);
+  sequence_checker_.Detach();
+}
+
+TransportFeedbackBandwidthEstimator::~TransportFeedbackBandwidthEstimator() =
+    default;
+
+void TransportFeedbackBandwidthEstimator::OnAddPacket(
+    const RtpPacketSendInfo& packet_info,
+    size_t overhead_bytes,
+    Timestamp now) {
+  RTC_DCHECK_RUN_ON(&sequence_checker_);
+  transport_feedback_adapter_.AddPacket(packet_info, overhead_bytes, now);
+}
+
+void TransportFeedbackBandwidthEstimator::OnSentPacket(
+    const rtc::SentPacket& sent_packet) {
+  RTC_DCHECK_RUN_ON(&sequence_checker_);
+  absl::optional<SentPacket> packet_msg =
+      transport_feedback_adapter_.ProcessSentPacket(sent_packet);
+  if (packet_msg)
+    ApplyUpdate(controller_->OnSentPacket(*packet_msg));
+}
+
+void TransportFeedbackBandwidthEstimator::OnTransportFeedback(
+    const rtcp::TransportFeedback& feedback,
+    Timestamp receive_time) {
+  RTC_DCHECK_RUN_ON(&sequence_checker_);
+  absl::optional<TransportPacketsFeedback> feedback_msg =
+      transport_feedback_adapter_.ProcessTransportFeedback(feedback,
+                                                           receive_time);
+  if (feedback_msg)
+    ApplyUpdate(controller_->OnTransportPacketsFeedback(*feedback_msg));
+}
+
+void TransportFeedbackBandwidthEstimator::OnTargetRateConstraints(
+    const TargetRateConstraints& constraints) {
+  RTC_DCHECK_RUN_ON(&sequence_checker_);
+  ApplyUpdate(controller_->OnTargetRateConstraints(constraints));
+}
+
+void TransportFeedbackBandwidthEstimator::OnProcessInterval(Timestamp now) {
+  RTC_DCHECK_RUN_ON(&sequence_checker_);
+  ProcessInterval msg;
+  msg.at_time = now;
+  ApplyUpdate(controller_->OnProcessInterval(msg));
+}
+
+absl::optional<TargetTransferRate>
+TransportFeedbackBandwidthEstimator::target_rate() const {
+  RTC_DCHECK_RUN_ON(&sequence_checker_);
+  return target_rate_;
+}
+
+void TransportFeedbackBandwidthEstimator::ApplyUpdate(
+    const NetworkControlUpdate& update) {
+  if (update.target_rate)
+    target_rate_ = update.target_rate;
+}
+
+}  // namespace webrtc
@@ -0,0 +1,83 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#ifndef MODULES_CONGESTION_CONTROLLER_RTP_TRANSPORT_FEEDBACK_BANDWIDTH_ESTIMATOR_H_
+#define MODULES_CONGESTION_CONTROLLER_RTP_TRANSPORT_FEEDBACK_BANDWIDTH_ESTIMATOR_H_
+
+#include <stddef.h>
+
+#include <memory>
+
+#include "absl/types/optional.h"
+#include "api/sequence_checker.h"
+#include "api/transport/network_control.h"
+#include "api/transport/network_types.h"
+#include "api/units/timestamp.h"
+#include "modules/congestion_controller/rtp/transport_feedback_adapter.h"
+#include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/transport_feedback.h"
+#include "rtc_base/network/sent_packet.h"
+#include "rtc_base/system/no_unique_address.h"
+#include "rtc_base/thread_annotations.h"
+
+namespace webrtc {
+
+// Estimates the bandwidth towards one receiver from its transport-wide
+// congestion control feedback. It runs a network controller, e.g. one created
+// by GoogCcNetworkControllerFactory, but without the pacer, task queue and
+// clock that RtpTransportControllerSend owns. This suits servers that estimate
+// the bandwidth of many receivers, such as an SFU: the estimators are cheap,
+// and any number of them can be driven from one task queue, which calls
+// OnProcessInterval() on all of them at the process interval of the factory.
+//
+// Only the target rate of the controller is kept. Pacing, probing and
+// congestion window updates are dropped, as there is no pacer to apply them.
+//
+// All methods must be called on the same sequence.
+class TransportFeedbackBandwidthEstimator {
+ public:
+  explicit TransportFeedbackBandwidthEstimator(
+      std::unique_ptr<NetworkControllerInterface> controller);
+  ~TransportFeedbackBandwidthEstimator();
+
+  TransportFeedbackBandwidthEstimator(
+      const TransportFeedbackBandwidthEstimator&) = delete;
+  TransportFeedbackBandwidthEstimator& operator=(
+      const TransportFeedbackBandwidthEstimator&) = delete;
+
+  // Called for each packet with a transport sequence number that is about to
+  // be sent, followed by OnSentPacket() once it has been sent.
+  void OnAddPacket(const RtpPacketSendInfo& packet_info,
+                   size_t overhead_bytes,
+                   Timestamp now);
+  void OnSentPacket(const rtc::SentPacket& sent_packet);
+  void OnTransportFeedback(const rtcp::TransportFeedback& feedback,
+                           Timestamp receive_time);
+  void OnTargetRateConstraints(const TargetRateConstraints& constraints);
+  void OnProcessInterval(Timestamp now);
+
+  // Latest target rate of the controller, if it has produced one.
+  absl::optional<TargetTransferRate> target_rate() const;
+
+ private:
+  void ApplyUpdate(const NetworkControlUpdate& update)
+      RTC_RUN_ON(sequence_checker_);
+
+  RTC_NO_UNIQUE_ADDRESS SequenceChecker sequence_checker_;
+  const std::unique_ptr<NetworkControllerInterface> controller_
+      RTC_GUARDED_BY(sequence_checker_);
+  TransportFeedbackAdapter transport_feedback_adapter_
+      RTC_GUARDED_BY(sequence_checker_);
+  absl::optional<TargetTransferRate> target_rate_
+      RTC_GUARDED_BY(sequence_checker_);
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_CONGESTION_CONTROLLER_RTP_TRANSPORT_FEEDBACK_BANDWIDTH_ESTIMATOR_H_
@@ -0,0 +1,109 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#include "modules/congestion_controller/rtp/transport_feedback_bandwidth_estimator.h"
+
+#include <memory>
+#include <utility>
+
+#include "api/transport/test/mock_network_control.h"
+#include "api/units/data_rate.h"
+#include "api/units/data_size.h"
+#include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/transport_feedback.h"
+#include "rtc_base/network/sent_packet.h"
+#include "test/gmock.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+using ::testing::_;
+using ::testing::Field;
+using ::testing::Return;
+using ::testing::SizeIs;
+
+constexpr uint32_t kSsrc = 8492;
+
+NetworkControlUpdate TargetRateUpdate(DataRate target_rate) {
+  NetworkControlUpdate update;
+  update.target_rate = TargetTransferRate();
+  update.target_rate->target_rate = target_rate;
+  return update;
+}
+
+class TransportFeedbackBandwidthEstimatorTest : public ::testing::Test {
+ protected:
+  TransportFeedbackBandwidthEstimatorTest() {
+    auto controller = std::make_unique<MockNetworkControllerInterface>();
+    controller_ = controller.get();
+    estimator_ = std::make_unique<TransportFeedbackBandwidthEstimator>(
+        std::move(controller));
+  }
+
+  void SendPacket(uint16_t sequence_number, Timestamp send_time) {
+    RtpPacketSendInfo packet_info;
+    packet_info.media_ssrc = kSsrc;
+    packet_info.transport_sequence_number = sequence_number;
+    packet_info.length = 1200;
+    packet_info.packet_type = RtpPacketMediaType::kVideo;
+    estimator_->OnAddPacket(packet_info, /*overhead_bytes=*/0, send_time);
+    estimator_->OnSentPacket(rtc::SentPacket(sequence_number, send_time.ms()));
+  }
+
+  MockNetworkControllerInterface* controller_;
+  std::unique_ptr<TransportFeedbackBandwidthEstimator> estimator_;
+};
+
+TEST_F(TransportFeedbackBandwidthEstimatorTest, HasNoTargetRateInitially) {
+  EXPECT_FALSE(estimator_->target_rate());
+}
+
+TEST_F(TransportFeedbackBandwidthEstimatorTest,
+       DrivesControllerWithAdaptedFeedback) {
+  EXPECT_CALL(*controller_, OnSentPacket(Field(&SentPacket::size,
+                                               DataSize::Bytes(1200))))
+      .Times(2);
+  SendPacket(1, Timestamp::Millis(100));
+  SendPacket(2, Timestamp::Millis(110));
+
+  rtcp::TransportFeedback feedback;
+  feedback.SetBase(1, Timestamp::Millis(200));
+  EXPECT_TRUE(feedback.AddReceivedPacket(1, Timestamp::Millis(200)));
+  EXPECT_TRUE(feedback.AddReceivedPacket(2, Timestamp::Millis(210)));
+  feedback.Build();
+
+  EXPECT_CALL(*controller_,
+              OnTransportPacketsFeedback(Field(
+                  &TransportPacketsFeedback::packet_feedbacks, SizeIs(2))))
+      .WillOnce(Return(TargetRateUpdate(DataRate::KilobitsPerSec(300))));
+  estimator_->OnTransportFeedback(feedback, Timestamp::Millis(220));
+  ASSERT_TRUE(estimator_->target_rate());
+  EXPECT_EQ(estimator_->target_rate()->target_rate,
+            DataRate::KilobitsPerSec(300));
+}
+
+TEST_F(TransportFeedbackBandwidthEstimatorTest,
+       KeepsTargetRateUntilControllerUpdatesIt) {
+  EXPECT_CALL(*controller_,
+              OnProcessInterval(Field(&ProcessInterval::at_time,
+                                      Timestamp::Millis(25))))
+      .WillOnce(Return(TargetRateUpdate(DataRate::KilobitsPerSec(300))));
+  estimator_->OnProcessInterval(Timestamp::Millis(25));
+
+  EXPECT_CALL(*controller_, OnProcessInterval(_))
+      .WillOnce(Return(NetworkControlUpdate()));
+  estimator_->OnProcessInterval(Timestamp::Millis(50));
+  ASSERT_TRUE(estimator_->target_rate());
+  EXPECT_EQ(estimator_->target_rate()->target_rate,
+            DataRate::KilobitsPerSec(300));
+}
+
+}  // namespace
+}  // namespace webrtc
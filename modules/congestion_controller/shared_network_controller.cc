@@ -0,0 +1,160 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#include "modules/congestion_controller/shared_network_controller.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "absl/types/optional.h"
+#include "api/transport/network_types.h"
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+
+class SharedNetworkControllerFactory::Controller
+    : public NetworkControllerInterface {
+ public:
+  Controller(SharedNetworkControllerFactory* factory,
+             std::unique_ptr<NetworkControllerInterface> controller)
+      : factory_(factory), controller_(std::move(controller)) {}
+  ~Controller() override { factory_->RemoveController(this); }
+
+  NetworkControlUpdate OnNetworkAvailability(NetworkAvailability msg) override {
+    return Coordinate(controller_->OnNetworkAvailability(msg));
+  }
+  NetworkControlUpdate OnNetworkRouteChange(NetworkRouteChange msg) override {
+    return Coordinate(controller_->OnNetworkRouteChange(msg));
+  }
+  NetworkControlUpdate OnProcessInterval(ProcessInterval msg) override {
+    return Coordinate(controller_->OnProcessInterval(msg));
+  }
+  NetworkControlUpdate OnRemoteBitrateReport(RemoteBitrateReport msg) override {
+    return Coordinate(controller_->OnRemoteBitrateReport(msg));
+  }
+  NetworkControlUpdate OnRoundTripTimeUpdate(RoundTripTimeUpdate msg) override {
+    return Coordinate(controller_->OnRoundTripTimeUpdate(msg));
+  }
+  NetworkControlUpdate OnSentPacket(SentPacket msg) override {
+    return Coordinate(controller_->OnSentPacket(msg));
+  }
+  NetworkControlUpdate OnReceivedPacket(ReceivedPacket msg) override {
+    return Coordinate(controller_->OnReceivedPacket(msg));
+  }
+  NetworkControlUpdate OnStreamsConfig(StreamsConfig msg) override {
+    return Coordinate(controller_->OnStreamsConfig(msg));
+  }
+  NetworkControlUpdate OnTargetRateConstraints(
+      TargetRateConstraints msg) override {
+    return Coordinate(controller_->OnTargetRateConstraints(msg));
+  }
+  NetworkControlUpdate OnTransportLossReport(TransportLossReport msg) override {
+    return Coordinate(controller_->OnTransportLossReport(msg));
+  }
+  NetworkControlUpdate OnTransportPacketsFeedback(
+      TransportPacketsFeedback msg) override {
+    return Coordinate(controller_->OnTransportPacketsFeedback(msg));
+  }
+  NetworkControlUpdate OnNetworkStateEstimate(
+      NetworkStateEstimate msg) override {
+    return Coordinate(controller_->OnNetworkStateEstimate(msg));
+  }
+
+ private:
+  NetworkControlUpdate Coordinate(NetworkControlUpdate update) {
+    if (!update.probe_cluster_configs.empty() && !factory_->MayProbe(this)) {
+      update.probe_cluster_configs.clear();
+    }
+    if (update.target_rate) {
+      target_rate_ = update.target_rate;
+    }
+    if (!target_rate_) {
+      return update;
+    }
+    // The scale also changes with the target rates of the other controllers,
+    // so it is checked on every update, including the periodic ones.
+    double scale = factory_->UpdateTargetRate(this, target_rate_->target_rate);
+    if (update.target_rate || scale != applied_scale_) {
+      TargetTransferRate target_rate = *target_rate_;
+      target_rate.target_rate = target_rate.target_rate * scale;
+      target_rate.stable_target_rate =
+          std::min(target_rate.stable_target_rate, target_rate.target_rate);
+      update.target_rate = target_rate;
+      applied_scale_ = scale;
+    }
+    return update;
+  }
+
+  SharedNetworkControllerFactory* const factory_;
+  const std::unique_ptr<NetworkControllerInterface> controller_;
+  // Latest target rate of `controller_`, before scaling.
+  absl::optional<TargetTransferRate> target_rate_;
+  double applied_scale_ = 1.0;
+};
+
+SharedNetworkControllerFactory::SharedNetworkControllerFactory(
+    std::unique_ptr<NetworkControllerFactoryInterface> factory)
+    : factory_(std::move(factory)) {
+  RTC_DCHECK(factory_);
+}
+
+SharedNetworkControllerFactory::~SharedNetworkControllerFactory() {
+  RTC_DCHECK(target_rates_.empty());
+}
+
+std::unique_ptr<NetworkControllerInterface>
+SharedNetworkControllerFactory::Create(NetworkControllerConfig config) {
+  auto controller =
+      std::make_unique<Controller>(this, factory_->Create(std::move(config)));
+  MutexLock lock(&mutex_);
+  target_rates_.emplace(controller.get(), DataRate::Zero());
+  if (prober_ == nullptr) {
+    prober_ = controller.get();
+  }
+  return controller;
+}
+
+TimeDelta SharedNetworkControllerFactory::GetProcessInterval() const {
+  return factory_->GetProcessInterval();
+}
+
+void SharedNetworkControllerFactory::RemoveController(
+    const Controller* controller) {
+  MutexLock lock(&mutex_);
+  target_rates_.erase(controller);
+  if (prober_ == controller) {
+    prober_ = target_rates_.empty() ? nullptr : target_rates_.begin()->first;
+  }
+}
+
+double SharedNetworkControllerFactory::UpdateTargetRate(
+    const Controller* controller,
+    DataRate target_rate) {
+  MutexLock lock(&mutex_);
+  auto it = target_rates_.find(controller);
+  RTC_DCHECK(it != target_rates_.end());
+  it->second = target_rate;
+  DataRate max_target_rate = DataRate::Zero();
+  DataRate sum_target_rate = DataRate::Zero();
+  for (const auto& [unused, rate] : target_rates_) {
+    max_target_rate = std::max(max_target_rate, rate);
+    sum_target_rate += rate;
+  }
+  if (sum_target_rate <= max_target_rate) {
+    return 1.0;
+  }
+  return max_target_rate / sum_target_rate;
+}
+
+bool SharedNetworkControllerFactory::MayProbe(const Controller* controller) {
+  MutexLock lock(&mutex_);
+  return prober_ == controller;
+}
+
+}  // namespace webrtc
@@ -0,0 +1,67 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#ifndef MODULES_CONGESTION_CONTROLLER_SHARED_NETWORK_CONTROLLER_H_
+#define MODULES_CONGESTION_CONTROLLER_SHARED_NETWORK_CONTROLLER_H_
+
+#include <memory>
+
+#include "api/transport/network_control.h"
+#include "api/units/data_rate.h"
+#include "api/units/time_delta.h"
+#include "rtc_base/containers/flat_map.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/thread_annotations.h"
+
+namespace webrtc {
+
+// Creates network controllers that share the bandwidth of one network path,
+// e.g. the controllers of several PeerConnections to the same remote host.
+// Use one factory per remote endpoint, and inject it as the network
+// controller factory of the connections to that endpoint.
+//
+// Each created controller runs a controller created by the wrapped factory,
+// but the controllers coordinate so that they do not compete for the path:
+// - The sum of their target rates does not exceed the highest target rate
+//   among them. When it would, each target rate is scaled down in proportion,
+//   which keeps the ratios the wrapped controllers arrived at.
+// - Only one of them at a time sends probes.
+//
+// The controllers may be used on different task queues. The factory must
+// outlive them.
+class SharedNetworkControllerFactory
+    : public NetworkControllerFactoryInterface {
+ public:
+  explicit SharedNetworkControllerFactory(
+      std::unique_ptr<NetworkControllerFactoryInterface> factory);
+  ~SharedNetworkControllerFactory() override;
+
+  std::unique_ptr<NetworkControllerInterface> Create(
+      NetworkControllerConfig config) override;
+  TimeDelta GetProcessInterval() const override;
+
+ private:
+  class Controller;
+
+  void RemoveController(const Controller* controller);
+  // Records the target rate of `controller` before scaling, and returns the
+  // factor to scale it by.
+  double UpdateTargetRate(const Controller* controller, DataRate target_rate);
+  bool MayProbe(const Controller* controller);
+
+  const std::unique_ptr<NetworkControllerFactoryInterface> factory_;
+
+  Mutex mutex_;
+  flat_map<const Controller*, DataRate> target_rates_ RTC_GUARDED_BY(mutex_);
+  const Controller* prober_ RTC_GUARDED_BY(mutex_) = nullptr;
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_CONGESTION_CONTROLLER_SHARED_NETWORK_CONTROLLER_H_
@@ -0,0 +1,135 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#include "modules/congestion_controller/shared_network_controller.h"
+
+#include <memory>
+#include <vector>
+
+#include "api/transport/network_types.h"
+#include "api/transport/test/mock_network_control.h"
+#include "api/units/data_rate.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "test/gmock.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+using ::testing::NiceMock;
+using ::testing::Return;
+
+class FakeNetworkControllerFactory : public NetworkControllerFactoryInterface {
+ public:
+  explicit FakeNetworkControllerFactory(
+      std::vector<MockNetworkControllerInterface*>* controllers)
+      : controllers_(controllers) {}
+
+  std::unique_ptr<NetworkControllerInterface> Create(
+      NetworkControllerConfig config) override {
+    auto controller =
+        std::make_unique<NiceMock<MockNetworkControllerInterface>>();
+    controllers_->push_back(controller.get());
+    return controller;
+  }
+  TimeDelta GetProcessInterval() const override {
+    return TimeDelta::Millis(25);
+  }
+
+ private:
+  std::vector<MockNetworkControllerInterface*>* const controllers_;
+};
+
+NetworkControlUpdate TargetRateUpdate(DataRate target_rate) {
+  NetworkControlUpdate update;
+  update.target_rate = TargetTransferRate();
+  update.target_rate->at_time = Timestamp::Zero();
+  update.target_rate->target_rate = target_rate;
+  update.target_rate->stable_target_rate = target_rate;
+  return update;
+}
+
+NetworkControlUpdate ProbeUpdate() {
+  NetworkControlUpdate update;
+  update.probe_cluster_configs.emplace_back();
+  return update;
+}
+
+class SharedNetworkControllerTest : public ::testing::Test {
+ protected:
+  SharedNetworkControllerTest()
+      : factory_(std::make_unique<FakeNetworkControllerFactory>(&mocks_)) {}
+
+  std::vector<MockNetworkControllerInterface*> mocks_;
+  SharedNetworkControllerFactory factory_;
+};
+
+TEST_F(SharedNetworkControllerTest, SingleControllerIsNotScaled) {
+  auto controller = factory_.Create(NetworkControllerConfig());
+  EXPECT_CALL(*mocks_[0], OnProcessInterval)
+      .WillOnce(Return(TargetRateUpdate(DataRate::KilobitsPerSec(500))));
+  NetworkControlUpdate update = controller->OnProcessInterval({});
+  ASSERT_TRUE(update.target_rate);
+  EXPECT_EQ(update.target_rate->target_rate, DataRate::KilobitsPerSec(500));
+  EXPECT_EQ(factory_.GetProcessInterval(), TimeDelta::Millis(25));
+}
+
+TEST_F(SharedNetworkControllerTest, ScalesTargetRatesToHighestTargetRate) {
+  auto first = factory_.Create(NetworkControllerConfig());
+  auto second = factory_.Create(NetworkControllerConfig());
+  ASSERT_EQ(mocks_.size(), 2u);
+
+  EXPECT_CALL(*mocks_[0], OnTransportPacketsFeedback)
+      .WillOnce(Return(TargetRateUpdate(DataRate::KilobitsPerSec(600))));
+  NetworkControlUpdate update = first->OnTransportPacketsFeedback({});
+  ASSERT_TRUE(update.target_rate);
+  EXPECT_EQ(update.target_rate->target_rate, DataRate::KilobitsPerSec(600));
+
+  EXPECT_CALL(*mocks_[1], OnTransportPacketsFeedback)
+      .WillOnce(Return(TargetRateUpdate(DataRate::KilobitsPerSec(300))));
+  update = second->OnTransportPacketsFeedback({});
+  ASSERT_TRUE(update.target_rate);
+  EXPECT_EQ(update.target_rate->target_rate, DataRate::KilobitsPerSec(200));
+  EXPECT_EQ(update.target_rate->stable_target_rate,
+            DataRate::KilobitsPerSec(200));
+
+  // The first controller picks up the new share on its next update, even if
+  // its own target rate did not change.
+  update = first->OnProcessInterval({});
+  ASSERT_TRUE(update.target_rate);
+  EXPECT_EQ(update.target_rate->target_rate, DataRate::KilobitsPerSec(400));
+  update = first->OnProcessInterval({});
+  EXPECT_FALSE(update.target_rate);
+
+  // The whole bandwidth is given back when the second controller goes away.
+  second.reset();
+  update = first->OnProcessInterval({});
+  ASSERT_TRUE(update.target_rate);
+  EXPECT_EQ(update.target_rate->target_rate, DataRate::KilobitsPerSec(600));
+}
+
+TEST_F(SharedNetworkControllerTest, OnlyOneControllerProbes) {
+  auto first = factory_.Create(NetworkControllerConfig());
+  auto second = factory_.Create(NetworkControllerConfig());
+  ON_CALL(*mocks_[0], OnNetworkAvailability)
+      .WillByDefault(Return(ProbeUpdate()));
+  ON_CALL(*mocks_[1], OnNetworkAvailability)
+      .WillByDefault(Return(ProbeUpdate()));
+
+  EXPECT_EQ(first->OnNetworkAvailability({}).probe_cluster_configs.size(), 1u);
+  EXPECT_TRUE(second->OnNetworkAvailability({}).probe_cluster_configs.empty());
+
+  first.reset();
+  EXPECT_EQ(second->OnNetworkAvailability({}).probe_cluster_configs.size(),
+            1u);
+}
+
+}  // namespace
+}  // namespace webrtc
@@ -142,6 +142,18 @@ class RTC_EXPORT DesktopCaptureOptions {
     allow_directx_capturer_ = enabled;
   }
 
+  // Flag that may be set together with detect_updated_region() to use the
+  // updated region reported by the directx based capturer as is, instead of
+  // refining it by comparing frame contents. The dirty rectangles reported by
+  // Windows may be larger than the actually changed area, but trusting them
+  // saves comparing large screens on the CPU.
+  bool trust_directx_updated_region() const {
+    return trust_directx_updated_region_;
+  }
+  void set_trust_directx_updated_region(bool enabled) {
+    trust_directx_updated_region_ = enabled;
+  }
+
   // Flag that may be set to allow use of the cropping window capturer (which
   // captures the screen & crops that to the window region in some cases). An
   // advantage of using this is significantly higher capture frame rates than
@@ -242,6 +254,7 @@ class RTC_EXPORT DesktopCaptureOptions {
 #if defined(WEBRTC_WIN)
   bool enumerate_current_process_windows_ = true;
   bool allow_directx_capturer_ = false;
+  bool trust_directx_updated_region_ = false;
   bool allow_cropping_window_capturer_ = false;
 #if defined(RTC_ENABLE_WIN_WGC)
   bool allow_wgc_screen_capturer_ = false;
@@ -101,7 +101,12 @@ std::unique_ptr<DesktopCapturer> DesktopCapturer::CreateScreenCapturer(
 
   std::unique_ptr<DesktopCapturer> capturer = CreateRawScreenCapturer(options);
   if (capturer && options.detect_updated_region()) {
+#if defined(WEBRTC_WIN)
+    capturer.reset(new DesktopCapturerDifferWrapper(
+        std::move(capturer), options.trust_directx_updated_region()));
+#else
     capturer.reset(new DesktopCapturerDifferWrapper(std::move(capturer)));
+#endif  // defined(WEBRTC_WIN)
   }
 
   return capturer;
@@ -15,6 +15,7 @@
 
 #include <utility>
 
+#include "modules/desktop_capture/desktop_capture_types.h"
 #include "modules/desktop_capture/desktop_geometry.h"
 #include "modules/desktop_capture/desktop_region.h"
 #include "modules/desktop_capture/differ_block.h"
@@ -146,7 +147,14 @@ void CompareFrames(const DesktopFrame& old_frame,
 
 DesktopCapturerDifferWrapper::DesktopCapturerDifferWrapper(
     std::unique_ptr<DesktopCapturer> base_capturer)
-    : base_capturer_(std::move(base_capturer)) {
+    : DesktopCapturerDifferWrapper(std::move(base_capturer),
+                                   /*trust_directx_updated_region=*/false) {}
+
+DesktopCapturerDifferWrapper::DesktopCapturerDifferWrapper(
+    std::unique_ptr<DesktopCapturer> base_capturer,
+    bool trust_directx_updated_region)
+    : base_capturer_(std::move(base_capturer)),
+      trust_directx_updated_region_(trust_directx_updated_region) {
   RTC_DCHECK(base_capturer_);
 }
 
@@ -210,14 +218,18 @@ void DesktopCapturerDifferWrapper::OnCaptureResult(
     last_frame_.reset();
   }
 
-  if (last_frame_) {
+  // The updated region of DXGI frames is kept as is if it's trusted.
+  const bool compare_frames =
+      !trust_directx_updated_region_ ||
+      frame->capturer_id() != DesktopCapturerId::kScreenCapturerWinDirectx;
+  if (last_frame_ && compare_frames) {
     DesktopRegion hints;
     hints.Swap(frame->mutable_updated_region());
     for (DesktopRegion::Iterator it(hints); !it.IsAtEnd(); it.Advance()) {
       CompareFrames(*last_frame_, *frame, it.rect(),
                     frame->mutable_updated_region());
     }
-  } else {
+  } else if (!last_frame_) {
     frame->mutable_updated_region()->SetRect(
         DesktopRect::MakeSize(frame->size()));
   }
@@ -33,6 +33,12 @@ namespace webrtc {
 //
 // This class marks entire frame as updated if the frame size or frame stride
 // has been changed.
+//
+// If `trust_directx_updated_region` is set, frames of the DirectX screen
+// capturer are passed through without comparing their contents: their
+// updated_region() comes from the dirty and move rectangles reported by the
+// DXGI output duplication, which is precise enough for most consumers and
+// saves the CPU diff of large screens.
 class RTC_EXPORT DesktopCapturerDifferWrapper
     : public DesktopCapturer,
       public DesktopCapturer::Callback {
@@ -41,6 +47,8 @@ class RTC_EXPORT DesktopCapturerDifferWrapper
   // implementation, and takes its ownership.
   explicit DesktopCapturerDifferWrapper(
       std::unique_ptr<DesktopCapturer> base_capturer);
+  DesktopCapturerDifferWrapper(std::unique_ptr<DesktopCapturer> base_capturer,
+                               bool trust_directx_updated_region);
 
   ~DesktopCapturerDifferWrapper() override;
 
@@ -63,6 +71,7 @@ class RTC_EXPORT DesktopCapturerDifferWrapper
                        std::unique_ptr<DesktopFrame> frame) override;
 
   const std::unique_ptr<DesktopCapturer> base_capturer_;
+  const bool trust_directx_updated_region_;
   DesktopCapturer::Callback* callback_;
   std::unique_ptr<SharedDesktopFrame> last_frame_;
 };
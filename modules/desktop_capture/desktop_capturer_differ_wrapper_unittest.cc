@@ -10,11 +10,16 @@
 
 #include "modules/desktop_capture/desktop_capturer_differ_wrapper.h"
 
+#include <string.h>
+
 #include <initializer_list>
 #include <memory>
 #include <utility>
 #include <vector>
 
+#include "modules/desktop_capture/desktop_capture_types.h"
+#include "modules/desktop_capture/desktop_frame.h"
+#include "modules/desktop_capture/desktop_frame_generator.h"
 #include "modules/desktop_capture/desktop_geometry.h"
 #include "modules/desktop_capture/desktop_region.h"
 #include "modules/desktop_capture/differ_block.h"
@@ -222,8 +227,66 @@ void ExecuteDifferWrapperTest(bool with_hints,
   }
 }
 
+// Generates black frames of the given capturer, with a fixed updated region.
+class UnchangedFrameGenerator : public DesktopFrameGenerator {
+ public:
+  explicit UnchangedFrameGenerator(uint32_t capturer_id)
+      : capturer_id_(capturer_id) {}
+
+  std::unique_ptr<DesktopFrame> GetNextFrame(
+      SharedMemoryFactory* factory) override {
+    auto frame = std::make_unique<BasicDesktopFrame>(DesktopSize(64, 64));
+    memset(frame->data(), 0, frame->stride() * frame->size().height());
+    frame->set_capturer_id(capturer_id_);
+    frame->mutable_updated_region()->SetRect(
+        DesktopRect::MakeLTRB(0, 0, 10, 10));
+    return frame;
+  }
+
+ private:
+  const uint32_t capturer_id_;
+};
+
+// Captures two frames, and returns the updated region of the second one.
+DesktopRegion CaptureUnchangedFrames(uint32_t capturer_id,
+                                     bool trust_directx_updated_region) {
+  UnchangedFrameGenerator frame_generator(capturer_id);
+  auto fake = std::make_unique<FakeDesktopCapturer>();
+  fake->set_frame_generator(&frame_generator);
+  DesktopCapturerDifferWrapper capturer(std::move(fake),
+                                        trust_directx_updated_region);
+  MockDesktopCapturerCallback callback;
+  capturer.Start(&callback);
+  ExecuteCapturer(&capturer, &callback);
+
+  DesktopRegion updated_region;
+  EXPECT_CALL(callback, OnCaptureResultPtr(DesktopCapturer::Result::SUCCESS,
+                                           ::testing::_))
+      .WillOnce(::testing::Invoke(
+          [&](DesktopCapturer::Result, std::unique_ptr<DesktopFrame>* frame) {
+            updated_region = (*frame)->updated_region();
+          }));
+  capturer.CaptureFrame();
+  return updated_region;
+}
+
 }  // namespace
 
+TEST(DesktopCapturerDifferWrapperTest, KeepsTrustedDirectxUpdatedRegion) {
+  DesktopRegion expected(DesktopRect::MakeLTRB(0, 0, 10, 10));
+  EXPECT_TRUE(
+      CaptureUnchangedFrames(DesktopCapturerId::kScreenCapturerWinDirectx,
+                             /*trust_directx_updated_region=*/true)
+          .Equals(expected));
+  EXPECT_TRUE(
+      CaptureUnchangedFrames(DesktopCapturerId::kScreenCapturerWinDirectx,
+                             /*trust_directx_updated_region=*/false)
+          .is_empty());
+  EXPECT_TRUE(CaptureUnchangedFrames(DesktopCapturerId::kScreenCapturerWinGdi,
+                                     /*trust_directx_updated_region=*/true)
+                  .is_empty());
+}
+
 TEST(DesktopCapturerDifferWrapperTest, CaptureWithoutHints) {
   ExecuteDifferWrapperTest(false, false, false, true);
 }
@@ -18,8 +18,12 @@
 // This needs to be after rtc_base/system/arch.h which defines
 // architecture macros.
 #if defined(WEBRTC_ARCH_X86_FAMILY)
+#include "modules/desktop_capture/differ_vector_avx2.h"
 #include "modules/desktop_capture/differ_vector_sse2.h"
 #endif
+#if defined(WEBRTC_HAS_NEON)
+#include <arm_neon.h>
+#endif
 
 namespace webrtc {
 
@@ -29,6 +33,25 @@ bool VectorDifference_C(const uint8_t* image1, const uint8_t* image2) {
   return memcmp(image1, image2, kBlockSize * kBytesPerPixel) != 0;
 }
 
+#if defined(WEBRTC_HAS_NEON)
+bool VectorDifference_NEON(const uint8_t* image1, const uint8_t* image2) {
+  static_assert(kBlockSize * kBytesPerPixel % 64 == 0,
+                "Vectors are compared 64 bytes at a time.");
+  uint8x16_t acc = vdupq_n_u8(0);
+  for (int i = 0; i < kBlockSize * kBytesPerPixel; i += 64) {
+    acc = vorrq_u8(acc, veorq_u8(vld1q_u8(image1 + i), vld1q_u8(image2 + i)));
+    acc = vorrq_u8(acc, veorq_u8(vld1q_u8(image1 + i + 16),
+                                 vld1q_u8(image2 + i + 16)));
+    acc = vorrq_u8(acc, veorq_u8(vld1q_u8(image1 + i + 32),
+                                 vld1q_u8(image2 + i + 32)));
+    acc = vorrq_u8(acc, veorq_u8(vld1q_u8(image1 + i + 48),
+                                 vld1q_u8(image2 + i + 48)));
+  }
+  const uint64x2_t acc64 = vreinterpretq_u64_u8(acc);
+  return (vgetq_lane_u64(acc64, 0) | vgetq_lane_u64(acc64, 1)) != 0;
+}
+#endif
+
 }  // namespace
 
 bool VectorDifference(const uint8_t* image1, const uint8_t* image2) {
@@ -36,18 +59,24 @@ bool VectorDifference(const uint8_t* image1, const uint8_t* image2) {
 
   if (!diff_proc) {
 #if defined(WEBRTC_ARCH_X86_FAMILY)
+    bool have_avx2 = GetCPUInfo(kAVX2) != 0;
     bool have_sse2 = GetCPUInfo(kSSE2) != 0;
-    // For x86 processors, check if SSE2 is supported.
-    if (have_sse2 && kBlockSize == 32) {
+    // For x86 processors, check if AVX2 or SSE2 is supported.
+    if (have_avx2 && kBlockSize == 32) {
+      diff_proc = &VectorDifference_AVX2_W32;
+    } else if (have_avx2 && kBlockSize == 16) {
+      diff_proc = &VectorDifference_AVX2_W16;
+    } else if (have_sse2 && kBlockSize == 32) {
       diff_proc = &VectorDifference_SSE2_W32;
     } else if (have_sse2 && kBlockSize == 16) {
       diff_proc = &VectorDifference_SSE2_W16;
     } else {
       diff_proc = &VectorDifference_C;
     }
+#elif defined(WEBRTC_HAS_NEON)
+    diff_proc = &VectorDifference_NEON;
 #else
     // For other processors, always use C version.
-    // TODO(hclam): Implement a NEON version.
     diff_proc = &VectorDifference_C;
 #endif
   }
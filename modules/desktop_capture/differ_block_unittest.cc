@@ -86,4 +86,17 @@ TEST(BlockDifferenceTestFirst, BlockDifference) {
   }
 }
 
+TEST(VectorDifferenceTest, DetectsChangeOfEachByte) {
+  uint8_t* block1;
+  uint8_t* block2;
+  PrepareBuffers(block1, block2);
+  EXPECT_FALSE(VectorDifference(block1, block2));
+
+  for (int i = 0; i < kBlockSize * kBytesPerPixel; ++i) {
+    block2[i] += 1;
+    EXPECT_TRUE(VectorDifference(block1, block2)) << "byte " << i;
+    block2[i] -= 1;
+  }
+}
+
 }  // namespace webrtc
@@ -634,24 +634,11 @@ bool EglDmaBuf::ImageFromDmaBuf(const DesktopSize& size,
     return false;
   }
 
-  GLenum gl_format = GL_BGRA;
-  switch (format) {
-    case SPA_VIDEO_FORMAT_RGBx:
-      gl_format = GL_RGBA;
-      break;
-    case SPA_VIDEO_FORMAT_RGBA:
-      gl_format = GL_RGBA;
-      break;
-    case SPA_VIDEO_FORMAT_BGRx:
-      gl_format = GL_BGRA;
-      break;
-    default:
-      gl_format = GL_BGRA;
-      break;
-  }
-
+  // Always read back in BGRA order. The texture sampled from RGB ordered
+  // formats is swizzled by the GPU during the readback, which saves a CPU pass
+  // over the whole frame to convert it to the BGRx layout WebRTC expects.
   GlReadPixels(offset.x(), offset.y(), buffer_size.width(),
-               buffer_size.height(), gl_format, GL_UNSIGNED_BYTE, data);
+               buffer_size.height(), GL_BGRA, GL_UNSIGNED_BYTE, data);
 
   const GLenum error = GlGetError();
   if (error) {
@@ -42,7 +42,8 @@ class EglDmaBuf {
   ~EglDmaBuf();
 
   // Returns whether the image was successfully imported from
-  // given DmaBuf and its parameters
+  // given DmaBuf and its parameters. The pixels are always written to `data`
+  // in BGRx order, regardless of `format`.
   bool ImageFromDmaBuf(const DesktopSize& size,
                        uint32_t format,
                        const std::vector<PlaneData>& plane_datas,
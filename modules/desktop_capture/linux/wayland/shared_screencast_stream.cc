@@ -847,8 +847,10 @@ void SharedScreenCastStreamPrivate::ProcessBuffer(pw_buffer* buffer) {
     return;
   }
 
-  if (spa_video_format_.format == SPA_VIDEO_FORMAT_RGBx ||
-      spa_video_format_.format == SPA_VIDEO_FORMAT_RGBA) {
+  // DMA-BUF frames are already swizzled to BGRx during the GPU readback.
+  if (spa_buffer->datas[0].type == SPA_DATA_MemFd &&
+      (spa_video_format_.format == SPA_VIDEO_FORMAT_RGBx ||
+       spa_video_format_.format == SPA_VIDEO_FORMAT_RGBA)) {
     uint8_t* tmp_src = queue_.current_frame()->data();
     for (int i = 0; i < frame_size_.height(); ++i) {
       // If both sides decided to go with the RGBx format we need to convert
@@ -20,6 +20,8 @@
 #include "test/gtest.h"
 
 #if defined(WEBRTC_WIN)
+#include "modules/desktop_capture/win/dxgi_duplicator_controller.h"
+#include "modules/desktop_capture/win/dxgi_texture_frame.h"
 #include "modules/desktop_capture/win/screen_capturer_win_directx.h"
 #endif  // defined(WEBRTC_WIN)
 
@@ -215,6 +217,34 @@ TEST_F(ScreenCapturerTest, UseDirectxCapturerWithSharedBuffers) {
   EXPECT_EQ(frame->capturer_id(), DesktopCapturerId::kScreenCapturerWinDirectx);
 }
 
+TEST_F(ScreenCapturerTest, DuplicateMonitorTexture) {
+  if (!ScreenCapturerWinDirectx::IsSupported()) {
+    RTC_LOG(LS_WARNING) << "Directx capturer is not supported";
+    return;
+  }
+
+  auto controller = DxgiDuplicatorController::Instance();
+  DxgiTextureFrame frame;
+  ASSERT_EQ(controller->DuplicateMonitorTexture(&frame, 0),
+            DxgiDuplicatorController::Result::SUCCEEDED);
+  if (!frame.texture()) {
+    // Nothing has been presented since the duplication started.
+    return;
+  }
+  D3D11_TEXTURE2D_DESC desc = {0};
+  frame.texture()->GetDesc(&desc);
+  EXPECT_EQ(desc.Format, DXGI_FORMAT_B8G8R8A8_UNORM);
+  EXPECT_EQ(desc.CPUAccessFlags, 0u);
+  // The first frame updates the entire texture.
+  EXPECT_TRUE(frame.updated_region().Equals(DesktopRegion(
+      DesktopRect::MakeWH(static_cast<int>(desc.Width),
+                          static_cast<int>(desc.Height)))));
+
+  EXPECT_EQ(controller->DuplicateMonitorTexture(
+                &frame, controller->ScreenCount()),
+            DxgiDuplicatorController::Result::INVALID_MONITOR_ID);
+}
+
 #endif  // defined(WEBRTC_WIN)
 
 }  // namespace webrtc
@@ -148,6 +148,20 @@ bool DxgiAdapterDuplicator::DuplicateMonitor(Context* context,
                                             DesktopVector(), target);
 }
 
+bool DxgiAdapterDuplicator::DuplicateMonitorTexture(
+    Context* context,
+    int monitor_id,
+    Microsoft::WRL::ComPtr<ID3D11Texture2D>* target,
+    DesktopRegion* updated_region,
+    Rotation* rotation) {
+  RTC_DCHECK_GE(monitor_id, 0);
+  RTC_DCHECK_LT(monitor_id, duplicators_.size());
+  RTC_DCHECK_EQ(context->contexts.size(), duplicators_.size());
+  *rotation = duplicators_[monitor_id].rotation();
+  return duplicators_[monitor_id].DuplicateTexture(
+      &context->contexts[monitor_id], target, updated_region);
+}
+
 DesktopRect DxgiAdapterDuplicator::ScreenRect(int id) const {
   RTC_DCHECK_GE(id, 0);
   RTC_DCHECK_LT(id, duplicators_.size());
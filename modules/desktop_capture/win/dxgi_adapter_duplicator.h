@@ -52,6 +52,15 @@ class DxgiAdapterDuplicator {
                         int monitor_id,
                         SharedDesktopFrame* target);
 
+  // Captures one monitor into a GPU texture, see
+  // DxgiOutputDuplicator::DuplicateTexture(). `monitor_id` should be between
+  // [0, screen_count()).
+  bool DuplicateMonitorTexture(Context* context,
+                               int monitor_id,
+                               Microsoft::WRL::ComPtr<ID3D11Texture2D>* target,
+                               DesktopRegion* updated_region,
+                               Rotation* rotation);
+
   // Returns desktop rect covered by this DxgiAdapterDuplicator.
   DesktopRect desktop_rect() const { return desktop_rect_; }
 
@@ -161,6 +161,62 @@ DxgiDuplicatorController::Result DxgiDuplicatorController::DoDuplicate(
   RTC_DCHECK(frame);
   MutexLock lock(&mutex_);
 
+  Result result = PrepareDuplication(frame->source_id_);
+  if (result != Result::SUCCEEDED) {
+    return result;
+  }
+
+  if (!frame->Prepare(SelectedDesktopSize(monitor_id), monitor_id)) {
+    return Result::FRAME_PREPARE_FAILED;
+  }
+
+  frame->frame()->mutable_updated_region()->Clear();
+
+  if (DoDuplicateUnlocked(frame->context(), monitor_id, frame->frame())) {
+    succeeded_duplications_++;
+    return Result::SUCCEEDED;
+  }
+  if (monitor_id >= ScreenCountUnlocked()) {
+    // It's a user error to provide a `monitor_id` larger than screen count. We
+    // do not need to deinitialize.
+    return Result::INVALID_MONITOR_ID;
+  }
+
+  // If the `monitor_id` is valid, but DoDuplicateUnlocked() failed, something
+  // must be wrong from capturer APIs. We should Deinitialize().
+  Deinitialize();
+  return Result::DUPLICATION_FAILED;
+}
+
+DxgiDuplicatorController::Result
+DxgiDuplicatorController::DuplicateMonitorTexture(DxgiTextureFrame* frame,
+                                                  int monitor_id) {
+  RTC_DCHECK(frame);
+  RTC_DCHECK_GE(monitor_id, 0);
+  MutexLock lock(&mutex_);
+
+  Result result = PrepareDuplication(monitor_id);
+  if (result != Result::SUCCEEDED) {
+    return result;
+  }
+  if (monitor_id >= ScreenCountUnlocked()) {
+    return Result::INVALID_MONITOR_ID;
+  }
+
+  frame->Prepare(monitor_id);
+  if (DoDuplicateTexture(frame, monitor_id)) {
+    succeeded_duplications_++;
+    return Result::SUCCEEDED;
+  }
+
+  // Same as DoDuplicate(), a failure of a valid `monitor_id` comes from the
+  // capturer APIs.
+  Deinitialize();
+  return Result::DUPLICATION_FAILED;
+}
+
+DxgiDuplicatorController::Result DxgiDuplicatorController::PrepareDuplication(
+    DesktopCapturer::SourceId source_id) {
   // The dxgi components and APIs do not update the screen resolution without
   // a reinitialization. So we use the GetDC() function to retrieve the screen
   // resolution to decide whether dxgi components need to be reinitialized.
@@ -174,7 +230,7 @@ DxgiDuplicatorController::Result DxgiDuplicatorController::DoDuplicate(
   // TODO(zijiehe): Confirm whether IDXGIOutput::GetDesc() and
   // IDXGIOutputDuplication::GetDesc() can detect the resolution change without
   // reinitialization.
-  if (display_configuration_monitor_.IsChanged(frame->source_id_)) {
+  if (display_configuration_monitor_.IsChanged(source_id)) {
     Deinitialize();
   }
 
@@ -188,27 +244,7 @@ DxgiDuplicatorController::Result DxgiDuplicatorController::DoDuplicate(
     // Cannot initialize COM components now, display mode may be changing.
     return Result::INITIALIZATION_FAILED;
   }
-
-  if (!frame->Prepare(SelectedDesktopSize(monitor_id), monitor_id)) {
-    return Result::FRAME_PREPARE_FAILED;
-  }
-
-  frame->frame()->mutable_updated_region()->Clear();
-
-  if (DoDuplicateUnlocked(frame->context(), monitor_id, frame->frame())) {
-    succeeded_duplications_++;
-    return Result::SUCCEEDED;
-  }
-  if (monitor_id >= ScreenCountUnlocked()) {
-    // It's a user error to provide a `monitor_id` larger than screen count. We
-    // do not need to deinitialize.
-    return Result::INVALID_MONITOR_ID;
-  }
-
-  // If the `monitor_id` is valid, but DoDuplicateUnlocked() failed, something
-  // must be wrong from capturer APIs. We should Deinitialize().
-  Deinitialize();
-  return Result::DUPLICATION_FAILED;
+  return Result::SUCCEEDED;
 }
 
 void DxgiDuplicatorController::Unload() {
@@ -381,6 +417,22 @@ bool DxgiDuplicatorController::DoDuplicateOne(Context* context,
   return false;
 }
 
+bool DxgiDuplicatorController::DoDuplicateTexture(DxgiTextureFrame* frame,
+                                                  int monitor_id) {
+  RTC_DCHECK(monitor_id >= 0);
+  Setup(&frame->context_);
+  for (size_t i = 0; i < duplicators_.size(); i++) {
+    if (monitor_id >= duplicators_[i].screen_count()) {
+      monitor_id -= duplicators_[i].screen_count();
+    } else {
+      return duplicators_[i].DuplicateMonitorTexture(
+          &frame->context_.contexts[i], monitor_id, &frame->texture_,
+          &frame->updated_region_, &frame->rotation_);
+    }
+  }
+  return false;
+}
+
 int64_t DxgiDuplicatorController::GetNumFramesCaptured() const {
   int64_t min = INT64_MAX;
   for (const auto& duplicator : duplicators_) {
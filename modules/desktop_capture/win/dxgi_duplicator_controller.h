@@ -25,6 +25,7 @@
 #include "modules/desktop_capture/win/dxgi_adapter_duplicator.h"
 #include "modules/desktop_capture/win/dxgi_context.h"
 #include "modules/desktop_capture/win/dxgi_frame.h"
+#include "modules/desktop_capture/win/dxgi_texture_frame.h"
 #include "rtc_base/synchronization/mutex.h"
 #include "rtc_base/system/rtc_export.h"
 
@@ -111,6 +112,13 @@ class RTC_EXPORT DxgiDuplicatorController {
   // |SharedDesktopFrame|.
   Result DuplicateMonitor(DxgiFrame* frame, int monitor_id);
 
+  // Captures one monitor into the GPU texture of `frame`, without copying it
+  // into CPU memory, see DxgiTextureFrame. `monitor_id` must be >= 0. Unlike
+  // DuplicateMonitor(), the first frames captured after initialization are not
+  // retried when they are black. May retain a reference to the texture of
+  // `frame`.
+  Result DuplicateMonitorTexture(DxgiTextureFrame* frame, int monitor_id);
+
   // Returns dpi of current system. Returns an empty DesktopVector if system
   // does not support DXGI based capturer.
   DesktopVector system_dpi();
@@ -152,6 +160,12 @@ class RTC_EXPORT DxgiDuplicatorController {
   // reinitialized next time.
   Result DoDuplicate(DxgiFrame* frame, int monitor_id);
 
+  // Reinitializes the DXGI components if the configuration of `source_id`
+  // changed, and initializes them if needed. Returns Result::SUCCEEDED if they
+  // are ready to duplicate.
+  Result PrepareDuplication(DesktopCapturer::SourceId source_id)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
   // Unload all the DXGI components and releases the resources. This function
   // wraps Deinitialize() with `mutex_`.
   void Unload();
@@ -198,6 +212,10 @@ class RTC_EXPORT DxgiDuplicatorController {
                       SharedDesktopFrame* target)
       RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
 
+  // Captures one monitor into `frame`.
+  bool DoDuplicateTexture(DxgiTextureFrame* frame, int monitor_id)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
   // The minimum GetNumFramesCaptured() returned by `duplicators_`.
   int64_t GetNumFramesCaptured() const RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
 
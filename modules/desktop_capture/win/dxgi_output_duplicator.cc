@@ -17,6 +17,7 @@
 #include <windows.h>
 
 #include <algorithm>
+#include <iterator>
 
 #include "modules/desktop_capture/win/desktop_capture_utils.h"
 #include "modules/desktop_capture/win/dxgi_texture_mapping.h"
@@ -269,6 +270,108 @@ bool DxgiOutputDuplicator::Duplicate(Context* context,
   return error.Error() == DXGI_ERROR_WAIT_TIMEOUT || ReleaseFrame();
 }
 
+bool DxgiOutputDuplicator::DuplicateTexture(
+    Context* context,
+    ComPtr<ID3D11Texture2D>* target,
+    DesktopRegion* updated_region) {
+  RTC_DCHECK(duplication_);
+  RTC_DCHECK(target);
+  RTC_DCHECK(updated_region);
+
+  DXGI_OUTDUPL_FRAME_INFO frame_info;
+  memset(&frame_info, 0, sizeof(frame_info));
+  ComPtr<IDXGIResource> resource;
+  _com_error error = duplication_->AcquireNextFrame(
+      kAcquireTimeoutMs, &frame_info, resource.GetAddressOf());
+  if (error.Error() != S_OK && error.Error() != DXGI_ERROR_WAIT_TIMEOUT) {
+    RTC_LOG(LS_ERROR) << "Failed to capture frame: "
+                      << desktop_capture::utils::ComErrorToString(error);
+    return false;
+  }
+
+  // Same as Duplicate(), the updated region of `context` is merged, but only
+  // the updated region of the current frame is spread.
+  DesktopRegion context_updated_region;
+  context_updated_region.Swap(&context->updated_region);
+  if (error.Error() == S_OK && frame_info.AccumulatedFrames > 0 && resource) {
+    DetectUpdatedRegion(frame_info, &context->updated_region);
+    SpreadContextChange(context);
+    context_updated_region.AddRegion(context->updated_region);
+
+    ComPtr<ID3D11Texture2D> texture;
+    error = resource.As(&texture);
+    if (error.Error() != S_OK || !texture) {
+      RTC_LOG(LS_ERROR) << "Failed to convert IDXGIResource to "
+                           "ID3D11Texture2D: "
+                        << desktop_capture::utils::ComErrorToString(error);
+      ReleaseFrame();
+      return false;
+    }
+    // The frames are copied on the GPU only. As the texture may be used by
+    // other devices, the copy is flushed right away.
+    const size_t index = last_gpu_texture_ == 0 ? 1 : 0;
+    if (!InitializeGpuTexture(index, texture.Get())) {
+      ReleaseFrame();
+      return false;
+    }
+    device_.context()->CopyResource(gpu_textures_[index].Get(), texture.Get());
+    device_.context()->Flush();
+    last_gpu_texture_ = index;
+    if (!ReleaseFrame()) {
+      return false;
+    }
+  } else if (last_gpu_texture_ < 0) {
+    // Same as Duplicate(), if nothing has been captured yet, the updated
+    // region of `context` is kept for next attempt.
+    context->updated_region.Swap(&context_updated_region);
+    return error.Error() == DXGI_ERROR_WAIT_TIMEOUT || ReleaseFrame();
+  } else if (error.Error() != DXGI_ERROR_WAIT_TIMEOUT && !ReleaseFrame()) {
+    return false;
+  }
+
+  // The updated region returned by Windows is rotated, but the texture is not.
+  for (DesktopRegion::Iterator it(context_updated_region); !it.IsAtEnd();
+       it.Advance()) {
+    updated_region->AddRect(
+        RotateRect(it.rect(), desktop_size(), ReverseRotation(rotation_)));
+  }
+  *target = gpu_textures_[last_gpu_texture_];
+  return true;
+}
+
+bool DxgiOutputDuplicator::InitializeGpuTexture(size_t index,
+                                                ID3D11Texture2D* texture) {
+  RTC_DCHECK_LT(index, std::size(gpu_textures_));
+  D3D11_TEXTURE2D_DESC desc = {0};
+  texture->GetDesc(&desc);
+  desc.ArraySize = 1;
+  desc.BindFlags = D3D11_BIND_SHADER_RESOURCE | D3D11_BIND_RENDER_TARGET;
+  desc.CPUAccessFlags = 0;
+  desc.MipLevels = 1;
+  desc.MiscFlags = D3D11_RESOURCE_MISC_SHARED;
+  desc.SampleDesc.Count = 1;
+  desc.SampleDesc.Quality = 0;
+  desc.Usage = D3D11_USAGE_DEFAULT;
+  ComPtr<ID3D11Texture2D>& gpu_texture = gpu_textures_[index];
+  if (gpu_texture) {
+    D3D11_TEXTURE2D_DESC current_desc;
+    gpu_texture->GetDesc(&current_desc);
+    if (memcmp(&desc, &current_desc, sizeof(D3D11_TEXTURE2D_DESC)) == 0) {
+      return true;
+    }
+    gpu_texture.Reset();
+  }
+
+  _com_error error = device_.d3d_device()->CreateTexture2D(
+      &desc, nullptr, gpu_texture.GetAddressOf());
+  if (error.Error() != S_OK || !gpu_texture) {
+    RTC_LOG(LS_ERROR) << "Failed to create a new ID3D11Texture2D: "
+                      << desktop_capture::utils::ComErrorToString(error);
+    return false;
+  }
+  return true;
+}
+
 DesktopRect DxgiOutputDuplicator::GetTranslatedDesktopRect(
     DesktopVector offset) const {
   DesktopRect result(DesktopRect::MakeSize(desktop_size()));
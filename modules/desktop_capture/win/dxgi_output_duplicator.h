@@ -12,6 +12,7 @@
 #define MODULES_DESKTOP_CAPTURE_WIN_DXGI_OUTPUT_DUPLICATOR_H_
 
 #include <comdef.h>
+#include <d3d11.h>
 #include <dxgi.h>
 #include <dxgi1_2.h>
 #include <wrl/client.h>
@@ -70,6 +71,21 @@ class DxgiOutputDuplicator {
                  DesktopVector offset,
                  SharedDesktopFrame* target);
 
+  // Copies the content of current IDXGIOutput into a GPU texture, without
+  // mapping it into CPU memory, and outputs it into `target`. The regions
+  // updated since the last call with `context` are added to `updated_region`,
+  // in the coordinates of the texture, which is in the native orientation of
+  // the output, see rotation(). `target` is kept unchanged if no frame has been
+  // captured yet. Returns false in case of a failure.
+  // The textures are used in turns, so a texture output by one call is not
+  // written by the next one.
+  bool DuplicateTexture(Context* context,
+                        Microsoft::WRL::ComPtr<ID3D11Texture2D>* target,
+                        DesktopRegion* updated_region);
+
+  // Returns the rotation of the output compared to its native orientation.
+  Rotation rotation() const { return rotation_; }
+
   // Returns the desktop rect covered by this DxgiOutputDuplicator.
   DesktopRect desktop_rect() const { return desktop_rect_; }
 
@@ -116,6 +132,10 @@ class DxgiOutputDuplicator {
   // (0, 0).
   DesktopRect GetUntranslatedDesktopRect() const;
 
+  // Makes sure gpu_textures_[`index`] is a GPU texture matching `texture`.
+  // Returns false in case of a failure.
+  bool InitializeGpuTexture(size_t index, ID3D11Texture2D* texture);
+
   // Spreads changes from `context` to other registered Context(s) in
   // contexts_.
   void SpreadContextChange(const Context* const context);
@@ -147,6 +167,12 @@ class DxgiOutputDuplicator {
   DesktopVector last_frame_offset_;
 
   int64_t num_frames_captured_ = 0;
+
+  // Textures output by DuplicateTexture(). Two of them are used in turns, the
+  // same way ScreenCaptureFrameQueue double buffers DesktopFrames.
+  Microsoft::WRL::ComPtr<ID3D11Texture2D> gpu_textures_[2];
+  // The index of the texture DuplicateTexture() last copied a frame to, or -1.
+  int last_gpu_texture_ = -1;
 };
 
 }  // namespace webrtc
@@ -0,0 +1,31 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/desktop_capture/win/dxgi_texture_frame.h"
+
+#include "modules/desktop_capture/win/dxgi_duplicator_controller.h"
+
+namespace webrtc {
+
+DxgiTextureFrame::DxgiTextureFrame() = default;
+
+DxgiTextureFrame::~DxgiTextureFrame() = default;
+
+void DxgiTextureFrame::Prepare(int monitor_id) {
+  if (monitor_id != monitor_id_) {
+    // Once the monitor has been changed, the entire texture is updated.
+    monitor_id_ = monitor_id;
+    context_.Reset();
+    texture_.Reset();
+  }
+  updated_region_.Clear();
+}
+
+}  // namespace webrtc
@@ -0,0 +1,68 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_DESKTOP_CAPTURE_WIN_DXGI_TEXTURE_FRAME_H_
+#define MODULES_DESKTOP_CAPTURE_WIN_DXGI_TEXTURE_FRAME_H_
+
+#include <d3d11.h>
+#include <wrl/client.h>
+
+#include "modules/desktop_capture/desktop_frame_rotation.h"
+#include "modules/desktop_capture/desktop_region.h"
+#include "modules/desktop_capture/win/dxgi_context.h"
+
+namespace webrtc {
+
+class DxgiDuplicatorController;
+
+// A GPU texture of one monitor and a DxgiDuplicatorController::Context for the
+// client of DxgiDuplicatorController::DuplicateMonitorTexture(). Unlike
+// DxgiFrame, the captured content is never copied into CPU memory, so the
+// texture can be handed to hardware encoders directly.
+class DxgiTextureFrame final {
+ public:
+  using Context = DxgiFrameContext;
+
+  DxgiTextureFrame();
+  ~DxgiTextureFrame();
+
+  // The captured BGRA texture, on the D3D11 device of the adapter the monitor
+  // is attached to. It's created with D3D11_RESOURCE_MISC_SHARED, so that other
+  // devices can open it through IDXGIResource::GetSharedHandle(). Null until a
+  // frame has been captured.
+  // The texture is reused by the next but one duplication of the same monitor,
+  // so consumers should finish reading it before then.
+  ID3D11Texture2D* texture() const { return texture_.Get(); }
+
+  // The region of texture() updated since the previous duplication into this
+  // instance, in texture coordinates.
+  const DesktopRegion& updated_region() const { return updated_region_; }
+
+  // Textures are in the native orientation of the monitor, so the content
+  // needs to be rotated by `rotation()` to be displayed.
+  Rotation rotation() const { return rotation_; }
+
+ private:
+  // Allows DxgiDuplicatorController to access Prepare() and the members.
+  friend class DxgiDuplicatorController;
+
+  // Prepares current instance to capture `monitor_id`.
+  void Prepare(int monitor_id);
+
+  int monitor_id_ = -1;
+  Microsoft::WRL::ComPtr<ID3D11Texture2D> texture_;
+  DesktopRegion updated_region_;
+  Rotation rotation_ = Rotation::CLOCK_WISE_0;
+  Context context_;
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_DESKTOP_CAPTURE_WIN_DXGI_TEXTURE_FRAME_H_
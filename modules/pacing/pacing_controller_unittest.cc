@@ -1222,6 +1222,44 @@ TEST_F(PacingControllerTest, ProbingWithInsertedPackets) {
               kSecondClusterRate.bps(), kProbingErrorMargin.bps());
 }
 
+TEST_F(PacingControllerTest, ProbesWithQueuedPacketsOfAnyTypeBeforePadding) {
+  const size_t kPacketSize = 1200;
+  uint32_t ssrc = 12346;
+  uint16_t sequence_number = 1234;
+
+  PacingControllerProbing packet_sender;
+  auto pacer =
+      std::make_unique<PacingController>(&clock_, &packet_sender, trials_);
+  pacer->CreateProbeClusters(std::vector<ProbeClusterConfig>(
+      {{.at_time = clock_.CurrentTime(),
+        .target_data_rate = kFirstClusterRate,
+        .target_duration = TimeDelta::Millis(15),
+        .target_probe_count = 5,
+        .id = 0}}));
+  pacer->SetPacingRates(kTargetRate * kPaceMultiplier, DataRate::Zero());
+
+  // Retransmissions and FEC are as useful for probing as media, so none of
+  // the probe should be padding while they are queued.
+  for (RtpPacketMediaType type :
+       {RtpPacketMediaType::kVideo, RtpPacketMediaType::kRetransmission,
+        RtpPacketMediaType::kForwardErrorCorrection}) {
+    for (int i = 0; i < 2; ++i) {
+      pacer->EnqueuePacket(BuildPacket(type, ssrc, sequence_number++,
+                                       clock_.TimeInMilliseconds(),
+                                       kPacketSize));
+    }
+  }
+
+  while (packet_sender.packets_sent() < 5) {
+    AdvanceTimeUntil(pacer->NextSendTime());
+    pacer->ProcessPackets();
+  }
+  EXPECT_EQ(packet_sender.last_pacing_info().probe_cluster_id, 0);
+  // Only the small padding packet that starts the cluster.
+  EXPECT_EQ(packet_sender.padding_packets_sent(), 1);
+  EXPECT_EQ(packet_sender.padding_sent(), 1);
+}
+
 TEST_F(PacingControllerTest, SkipsProbesWhenProcessIntervalTooLarge) {
   const size_t kPacketSize = 1200;
   const int kInitialBitrateBps = 300000;
@@ -10,6 +10,7 @@
 
 #include "modules/pacing/prioritized_packet_queue.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
@@ -118,7 +119,8 @@ PrioritizedPacketQueue::PrioritizedPacketQueue(Timestamp creation_time)
       last_update_time_(creation_time),
       paused_(false),
       last_culling_time_(creation_time),
-      top_active_prio_level_(-1) {}
+      top_active_prio_level_(-1),
+      enqueue_times_begin_index_(0) {}
 
 void PrioritizedPacketQueue::Push(Timestamp enqueue_time,
                                   std::unique_ptr<RtpPacketToSend> packet) {
@@ -129,8 +131,11 @@ void PrioritizedPacketQueue::Push(Timestamp enqueue_time,
   }
   stream_queue = it->second.get();
 
-  auto enqueue_time_iterator =
-      enqueue_times_.insert(enqueue_times_.end(), enqueue_time);
+  RTC_DCHECK(enqueue_times_.empty() ||
+             enqueue_times_.back().time <= enqueue_time);
+  int64_t enqueue_time_index =
+      enqueue_times_begin_index_ + static_cast<int64_t>(enqueue_times_.size());
+  enqueue_times_.push_back({.time = enqueue_time, .dequeued = false});
   RTC_DCHECK(packet->packet_type().has_value());
   RtpPacketMediaType packet_type = packet->packet_type().value();
   int prio_level = GetPriorityForType(packet_type);
@@ -138,7 +143,7 @@ void PrioritizedPacketQueue::Push(Timestamp enqueue_time,
   RTC_DCHECK_LT(prio_level, kNumPriorityLevels);
   QueuedPacket queued_packed = {.packet = std::move(packet),
                                 .enqueue_time = enqueue_time,
-                                .enqueue_time_iterator = enqueue_time_iterator};
+                                .enqueue_time_index = enqueue_time_index};
   // In order to figure out how much time a packet has spent in the queue
   // while not in a paused state, we subtract the total amount of time the
   // queue has been paused so far, and when the packet is popped we subtract
@@ -224,7 +229,7 @@ Timestamp PrioritizedPacketQueue::LeadingPacketEnqueueTime(
 
 Timestamp PrioritizedPacketQueue::OldestEnqueueTime() const {
   return enqueue_times_.empty() ? Timestamp::MinusInfinity()
-                                : enqueue_times_.front();
+                                : enqueue_times_.front().time;
 }
 
 TimeDelta PrioritizedPacketQueue::AverageQueueTime() const {
@@ -288,13 +293,10 @@ void PrioritizedPacketQueue::RemovePacketsForSsrc(uint32_t ssrc) {
         }
       } else {
         // More than stream had packets at this prio level, filter this one out.
-        std::deque<StreamQueue*> filtered_queue;
-        for (StreamQueue* queue_ptr : streams_by_prio_[i]) {
-          if (queue_ptr != &queue) {
-            filtered_queue.push_back(queue_ptr);
-          }
-        }
-        streams_by_prio_[i].swap(filtered_queue);
+        streams_by_prio_[i].erase(std::remove(streams_by_prio_[i].begin(),
+                                              streams_by_prio_[i].end(),
+                                              &queue),
+                                  streams_by_prio_[i].end());
       }
     }
   }
@@ -335,8 +337,17 @@ void PrioritizedPacketQueue::DequeuePacketInternal(QueuedPacket& packet) {
 
   RTC_DCHECK(size_packets_ > 0 || queue_time_sum_ == TimeDelta::Zero());
 
-  RTC_CHECK(packet.enqueue_time_iterator != enqueue_times_.end());
-  enqueue_times_.erase(packet.enqueue_time_iterator);
+  RTC_CHECK_GE(packet.enqueue_time_index, enqueue_times_begin_index_);
+  RTC_CHECK_LT(packet.enqueue_time_index - enqueue_times_begin_index_,
+               enqueue_times_.size());
+  EnqueueTime& enqueue_time =
+      enqueue_times_[packet.enqueue_time_index - enqueue_times_begin_index_];
+  RTC_DCHECK(!enqueue_time.dequeued);
+  enqueue_time.dequeued = true;
+  while (!enqueue_times_.empty() && enqueue_times_.front().dequeued) {
+    enqueue_times_.pop_front();
+    ++enqueue_times_begin_index_;
+  }
 }
 
 void PrioritizedPacketQueue::MaybeUpdateTopPrioLevel() {
@@ -15,7 +15,6 @@
 
 #include <array>
 #include <deque>
-#include <list>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -98,7 +97,9 @@ class PrioritizedPacketQueue {
 
     std::unique_ptr<RtpPacketToSend> packet;
     Timestamp enqueue_time;
-    std::list<Timestamp>::iterator enqueue_time_iterator;
+    // Position of the packet in `enqueue_times_`, counted from the first
+    // packet ever pushed.
+    int64_t enqueue_time_index;
   };
 
   // Class containing packets for an RTP stream.
@@ -166,10 +167,19 @@ class PrioritizedPacketQueue {
   // The first index into `stream_by_prio_` that is non-empty.
   int top_active_prio_level_;
 
-  // Ordered list of enqueue times. Additions are always increasing and added to
-  // the end. QueuedPacket instances have a iterators into this list for fast
-  // removal.
-  std::list<Timestamp> enqueue_times_;
+  struct EnqueueTime {
+    Timestamp time;
+    bool dequeued;
+  };
+  // Enqueue times of all packets, in the order they were pushed, which is also
+  // increasing time order. Dequeued packets are only marked as such, and
+  // removed once they reach the front, so that the front always holds the
+  // oldest packet in the queue. Unlike a linked list this allocates no node
+  // per packet.
+  std::deque<EnqueueTime> enqueue_times_;
+  // Index of the front of `enqueue_times_`, counted like
+  // `QueuedPacket::enqueue_time_index`.
+  int64_t enqueue_times_begin_index_;
 };
 
 }  // namespace webrtc
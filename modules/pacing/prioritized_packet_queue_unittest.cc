@@ -164,6 +164,29 @@ TEST(PrioritizedPacketQueue, ReportsOldestEnqueueTime) {
   EXPECT_EQ(queue.OldestEnqueueTime(), Timestamp::MinusInfinity());
 }
 
+TEST(PrioritizedPacketQueue, ReportsOldestEnqueueTimeAfterRemovingStream) {
+  PrioritizedPacketQueue queue(/*creation_time=*/Timestamp::Zero());
+  queue.Push(Timestamp::Millis(10),
+             CreatePacket(RtpPacketMediaType::kVideo, /*seq=*/1, /*ssrc=*/1));
+  queue.Push(Timestamp::Millis(20),
+             CreatePacket(RtpPacketMediaType::kVideo, /*seq=*/2, /*ssrc=*/2));
+  queue.Push(Timestamp::Millis(30),
+             CreatePacket(RtpPacketMediaType::kVideo, /*seq=*/3, /*ssrc=*/3));
+  queue.Push(Timestamp::Millis(40),
+             CreatePacket(RtpPacketMediaType::kVideo, /*seq=*/4, /*ssrc=*/1));
+  EXPECT_EQ(queue.OldestEnqueueTime(), Timestamp::Millis(10));
+
+  queue.RemovePacketsForSsrc(1);
+  EXPECT_EQ(queue.SizeInPackets(), 2);
+  EXPECT_EQ(queue.OldestEnqueueTime(), Timestamp::Millis(20));
+
+  // The remaining streams keep their round-robin order.
+  EXPECT_EQ(queue.Pop()->Ssrc(), 2u);
+  EXPECT_EQ(queue.OldestEnqueueTime(), Timestamp::Millis(30));
+  EXPECT_EQ(queue.Pop()->Ssrc(), 3u);
+  EXPECT_EQ(queue.OldestEnqueueTime(), Timestamp::MinusInfinity());
+}
+
 TEST(PrioritizedPacketQueue, ReportsAverageQueueTime) {
   PrioritizedPacketQueue queue(/*creation_time=*/Timestamp::Zero());
   EXPECT_EQ(queue.AverageQueueTime(), TimeDelta::Zero());
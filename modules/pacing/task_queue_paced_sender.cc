@@ -43,13 +43,16 @@ TaskQueuePacedSender::TaskQueuePacedSender(
     const FieldTrialsView& field_trials,
     TimeDelta max_hold_back_window,
     int max_hold_back_window_in_packets,
-    absl::optional<TimeDelta> burst_interval)
+    absl::optional<TimeDelta> burst_interval,
+    Metronome* metronome)
     : clock_(clock),
       bursty_pacer_flags_(field_trials),
       max_hold_back_window_(max_hold_back_window),
       max_hold_back_window_in_packets_(max_hold_back_window_in_packets),
       pacing_controller_(clock, packet_sender, field_trials),
       next_process_time_(Timestamp::MinusInfinity()),
+      metronome_(metronome),
+      metronome_tick_requested_(false),
       is_started_(false),
       is_shutdown_(false),
       packet_size_(/*alpha=*/0.95),
@@ -64,6 +67,11 @@ TaskQueuePacedSender::TaskQueuePacedSender(
   if (!burst.has_value()) {
     burst = burst_interval;
   }
+  // Packets are sent once per tick, so the burst must cover a tick period.
+  if (metronome_ != nullptr) {
+    burst = std::max(burst.value_or(TimeDelta::Zero()),
+                     metronome_->TickPeriod());
+  }
   if (burst.has_value()) {
     pacing_controller_.SetSendBurstInterval(burst.value());
   }
@@ -256,6 +264,22 @@ void TaskQueuePacedSender::MaybeProcessPackets(
     next_process_time_ = Timestamp::MinusInfinity();
   }
 
+  // Wait for the next metronome tick rather than scheduling a wakeup of our
+  // own. Probes need precise timing, and wakeups further away than a tick are
+  // rare, so both still use a delayed task.
+  if (metronome_ != nullptr && !pacing_controller_.IsProbing() &&
+      next_send_time - now <= metronome_->TickPeriod()) {
+    if (!metronome_tick_requested_) {
+      metronome_tick_requested_ = true;
+      metronome_->RequestCallOnNextTick(SafeTask(safety_.flag(), [this] {
+        RTC_DCHECK_RUN_ON(task_queue_);
+        metronome_tick_requested_ = false;
+        MaybeProcessPackets(Timestamp::MinusInfinity());
+      }));
+    }
+    return;
+  }
+
   // Do not hold back in probing.
   TimeDelta hold_back_window = TimeDelta::Zero();
   if (!pacing_controller_.IsProbing()) {
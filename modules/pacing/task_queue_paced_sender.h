@@ -19,6 +19,7 @@
 
 #include "absl/types/optional.h"
 #include "api/field_trials_view.h"
+#include "api/metronome/metronome.h"
 #include "api/sequence_checker.h"
 #include "api/task_queue/pending_task_safety_flag.h"
 #include "api/units/data_size.h"
@@ -50,6 +51,13 @@ class TaskQueuePacedSender : public RtpPacketPacer, public RtpPacketSender {
   // specified interval. This greatly reduced wake ups by not pacing packets
   // within the allowed burst budget.
   //
+  // If `metronome` is set, packets that are due within one tick period are
+  // sent on the next tick of the metronome instead of from a delayed task of
+  // their own, and the burst interval is raised to at least the tick period so
+  // that each tick can send its whole budget. This lets many pacers share one
+  // wakeup per tick. Probes are still sent at their scheduled time. The
+  // metronome must outlive the pacer, and be usable on its task queue.
+  //
   // The taskqueue used when constructing a TaskQueuePacedSender will also be
   // used for pacing.
   TaskQueuePacedSender(
@@ -58,7 +66,8 @@ class TaskQueuePacedSender : public RtpPacketPacer, public RtpPacketSender {
       const FieldTrialsView& field_trials,
       TimeDelta max_hold_back_window,
       int max_hold_back_window_in_packets,
-      absl::optional<TimeDelta> burst_interval = absl::nullopt);
+      absl::optional<TimeDelta> burst_interval = absl::nullopt,
+      Metronome* metronome = nullptr);
 
   ~TaskQueuePacedSender() override;
 
@@ -169,6 +178,11 @@ class TaskQueuePacedSender : public RtpPacketPacer, public RtpPacketSender {
   // Timestamp::MinusInfinity() indicates no valid pending task.
   Timestamp next_process_time_ RTC_GUARDED_BY(task_queue_);
 
+  Metronome* const metronome_;
+  // Indicates that a call on the next tick of `metronome_` is pending, so that
+  // at most one is requested at a time.
+  bool metronome_tick_requested_ RTC_GUARDED_BY(task_queue_);
+
   // Indicates if this task queue is started. If not, don't allow
   // posting delayed tasks yet.
   bool is_started_ RTC_GUARDED_BY(task_queue_);
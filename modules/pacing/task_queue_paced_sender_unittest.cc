@@ -18,6 +18,7 @@
 #include <utility>
 #include <vector>
 
+#include "api/metronome/test/fake_metronome.h"
 #include "api/task_queue/task_queue_base.h"
 #include "api/task_queue/task_queue_factory.h"
 #include "api/transport/network_types.h"
@@ -206,6 +207,51 @@ TEST(TaskQueuePacedSenderTest, PacesPacketsWithBurst) {
   EXPECT_NEAR((end_time - start_time).ms<double>(), 500.0, 50.0);
 }
 
+TEST(TaskQueuePacedSenderTest, SendsOnMetronomeTicks) {
+  const TimeDelta kTickPeriod = TimeDelta::Millis(10);
+  GlobalSimulatedTimeController time_controller(Timestamp::Millis(1234));
+  MockPacketRouter packet_router;
+  ScopedKeyValueConfig trials;
+  ForcedTickMetronome metronome(kTickPeriod);
+  TaskQueuePacedSender pacer(time_controller.GetClock(), &packet_router, trials,
+                             PacingController::kMinSleepTime,
+                             TaskQueuePacedSender::kNoPacketHoldback,
+                             /*burst_interval=*/absl::nullopt, &metronome);
+
+  // One packet every 5ms.
+  const DataRate kPacingRate =
+      DataRate::BitsPerSec(kDefaultPacketSize * 8 * 200);
+  pacer.SetPacingRates(kPacingRate, DataRate::Zero());
+  pacer.EnsureStarted();
+
+  size_t packets_sent = 0;
+  EXPECT_CALL(packet_router, SendPacket).WillRepeatedly([&] {
+    ++packets_sent;
+  });
+  pacer.EnqueuePackets(GeneratePackets(RtpPacketMediaType::kVideo, 20));
+  time_controller.AdvanceTime(TimeDelta::Zero());
+  const size_t packets_sent_on_enqueue = packets_sent;
+  EXPECT_GT(packets_sent_on_enqueue, 0u);
+
+  // Without a tick, nothing more is sent, and only a single tick is waited
+  // for.
+  time_controller.AdvanceTime(2 * kTickPeriod);
+  EXPECT_EQ(packets_sent, packets_sent_on_enqueue);
+  EXPECT_EQ(metronome.NumListeners(), 1u);
+
+  // A tick sends what the elapsed time allows, at once.
+  metronome.Tick();
+  EXPECT_GE(packets_sent, packets_sent_on_enqueue + 4);
+  EXPECT_EQ(metronome.NumListeners(), 1u);
+
+  // All packets are eventually sent on ticks.
+  for (int i = 0; i < 20; ++i) {
+    time_controller.AdvanceTime(kTickPeriod);
+    metronome.Tick();
+  }
+  EXPECT_EQ(packets_sent, 20u);
+}
+
 TEST(TaskQueuePacedSenderTest, ReschedulesProcessOnRateChange) {
   GlobalSimulatedTimeController time_controller(Timestamp::Millis(1234));
   MockPacketRouter packet_router;
@@ -303,6 +303,9 @@ RemoteEstimatorProxy::MaybeBuildFeedbackPacket(
       feedback_packet =
           std::make_unique<rtcp::TransportFeedback>(include_timestamps);
       feedback_packet->SetMediaSsrc(media_ssrc_);
+      // The sequence numbers left in the range bound the packets that will be
+      // added, so reserve for them up front rather than growing per packet.
+      feedback_packet->ReservePackets(end_seq - seq);
 
       // It should be possible to add `seq` to this new `feedback_packet`,
       // If difference between `seq` and `begin_sequence_number_inclusive`,
@@ -33,6 +33,22 @@ namespace {
 constexpr size_t kTransportOverhead = 28;
 
 constexpr uint16_t kOldSequenceThreshold = 0x3fff;
+
+// XORs `length` bytes from `src` into `dst`, a word at a time.
+void XorBytes(const uint8_t* src, size_t length, uint8_t* dst) {
+  size_t i = 0;
+  for (; i + sizeof(uint64_t) <= length; i += sizeof(uint64_t)) {
+    uint64_t src_word;
+    uint64_t dst_word;
+    memcpy(&src_word, src + i, sizeof(src_word));
+    memcpy(&dst_word, dst + i, sizeof(dst_word));
+    dst_word ^= src_word;
+    memcpy(dst + i, &dst_word, sizeof(dst_word));
+  }
+  for (; i < length; ++i) {
+    dst[i] ^= src[i];
+  }
+}
 }  // namespace
 
 ForwardErrorCorrection::Packet::Packet() : data(0), ref_count_(0) {}
@@ -161,12 +177,20 @@ int ForwardErrorCorrection::EncodeFec(const PacketList& media_packets,
     fec_packets->push_back(&generated_fec_packets_[i]);
   }
 
-  internal::PacketMaskTable mask_table(fec_mask_type, num_media_packets);
   packet_mask_size_ = internal::PacketMaskSize(num_media_packets);
-  memset(packet_masks_, 0, num_fec_packets * packet_mask_size_);
-  internal::GeneratePacketMasks(num_media_packets, num_fec_packets,
-                                num_important_packets, use_unequal_protection,
-                                &mask_table, packet_masks_);
+  const size_t packet_masks_size = num_fec_packets * packet_mask_size_;
+  const PacketMaskKey packet_mask_key = {
+      static_cast<int>(num_media_packets), num_fec_packets,
+      num_important_packets, use_unequal_protection, fec_mask_type};
+  if (cached_packet_mask_key_ != packet_mask_key) {
+    internal::PacketMaskTable mask_table(fec_mask_type, num_media_packets);
+    memset(cached_packet_masks_, 0, packet_masks_size);
+    internal::GeneratePacketMasks(num_media_packets, num_fec_packets,
+                                  num_important_packets, use_unequal_protection,
+                                  &mask_table, cached_packet_masks_);
+    cached_packet_mask_key_ = packet_mask_key;
+  }
+  memcpy(packet_masks_, cached_packet_masks_, packet_masks_size);
 
   // Adapt packet masks to missing media packets.
   int num_mask_bits = InsertZerosInPacketMasks(media_packets, num_fec_packets);
@@ -635,11 +659,8 @@ void ForwardErrorCorrection::XorPayloads(const Packet& src,
     dst->data.SetSize(new_size);
     memset(dst->data.MutableData() + old_size, 0, new_size - old_size);
   }
-  uint8_t* dst_data = dst->data.MutableData();
-  const uint8_t* src_data = src.data.cdata();
-  for (size_t i = 0; i < payload_length; ++i) {
-    dst_data[dst_offset + i] ^= src_data[kRtpHeaderSize + i];
-  }
+  XorBytes(src.data.cdata() + kRtpHeaderSize, payload_length,
+           dst->data.MutableData() + dst_offset);
 }
 
 bool ForwardErrorCorrection::RecoverPacket(const ReceivedFecPacket& fec_packet,
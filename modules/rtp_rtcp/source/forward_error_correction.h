@@ -19,6 +19,7 @@
 #include <vector>
 
 #include "absl/container/inlined_vector.h"
+#include "absl/types/optional.h"
 #include "api/scoped_refptr.h"
 #include "api/units/timestamp.h"
 #include "modules/include/module_fec_types.h"
@@ -362,6 +363,32 @@ class ForwardErrorCorrection {
   uint8_t packet_masks_[kUlpfecMaxMediaPackets * kUlpfecMaxPacketMaskSize];
   uint8_t tmp_packet_masks_[kUlpfecMaxMediaPackets * kUlpfecMaxPacketMaskSize];
   size_t packet_mask_size_;
+
+  // The arguments of the last internal::GeneratePacketMasks() call, whose
+  // result is kept in `cached_packet_masks_`. Consecutive frames are usually
+  // protected with the same parameters, and generating the masks for more than
+  // 12 media packets is costly.
+  struct PacketMaskKey {
+    bool operator==(const PacketMaskKey& other) const {
+      return num_media_packets == other.num_media_packets &&
+             num_fec_packets == other.num_fec_packets &&
+             num_important_packets == other.num_important_packets &&
+             use_unequal_protection == other.use_unequal_protection &&
+             fec_mask_type == other.fec_mask_type;
+    }
+    bool operator!=(const PacketMaskKey& other) const {
+      return !(*this == other);
+    }
+
+    int num_media_packets;
+    int num_fec_packets;
+    int num_important_packets;
+    bool use_unequal_protection;
+    FecMaskType fec_mask_type;
+  };
+  absl::optional<PacketMaskKey> cached_packet_mask_key_;
+  uint8_t
+      cached_packet_masks_[kUlpfecMaxMediaPackets * kUlpfecMaxPacketMaskSize];
 };
 
 // Classes derived from FecHeader{Reader,Writer} encapsulate the
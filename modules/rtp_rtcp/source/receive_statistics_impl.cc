@@ -37,122 +37,207 @@ TimeDelta UnixEpochDelta(Clock& clock) {
                            rtc::kNtpJan1970Millisecs);
 }
 
+RtpReceiveStats GetReceiveStats(const StreamReceiveState& state,
+                                TimeDelta delta_internal_unix_epoch) {
+  RtpReceiveStats stats;
+  stats.packets_lost = state.cumulative_loss;
+  // Note: internal jitter value is in Q4 and needs to be scaled by 1/16.
+  stats.jitter = state.jitter_q4 >> 4;
+  if (state.last_payload_type_frequency > 0) {
+    // Divide value in fractional seconds by frequency to get jitter in
+    // fractional seconds.
+    stats.interarrival_jitter =
+        TimeDelta::Seconds(stats.jitter) / state.last_payload_type_frequency;
+  }
+  if (state.last_receive_time.has_value()) {
+    stats.last_packet_received =
+        *state.last_receive_time + delta_internal_unix_epoch;
+  }
+  stats.packet_counter = state.counters.transmitted;
+  return stats;
+}
+
+absl::optional<int> FractionLostInPercent(const StreamReceiveState& state) {
+  if (!state.last_receive_time.has_value()) {
+    return absl::nullopt;
+  }
+  int64_t expected_packets =
+      1 + state.received_seq_max - state.received_seq_first;
+  if (expected_packets <= 0) {
+    return absl::nullopt;
+  }
+  if (state.cumulative_loss <= 0) {
+    return 0;
+  }
+  return 100 * static_cast<int64_t>(state.cumulative_loss) / expected_packets;
+}
+
+void MaybeAppendReportBlock(uint32_t ssrc,
+                            const StreamReceiveState& state,
+                            Timestamp now,
+                            StreamReportState& report,
+                            std::vector<rtcp::ReportBlock>& report_blocks) {
+  if (!state.last_receive_time.has_value()) {
+    return;
+  }
+  if (now - *state.last_receive_time >= kStatisticsTimeout) {
+    // Not active.
+    return;
+  }
+  if (report.report_start_updates != state.report_start_updates) {
+    report.report_start_updates = state.report_start_updates;
+    report.last_report_seq_max = state.report_start_seq_max;
+  }
+
+  report_blocks.emplace_back();
+  rtcp::ReportBlock& stats = report_blocks.back();
+  stats.SetMediaSsrc(ssrc);
+  // Calculate fraction lost.
+  int64_t exp_since_last = state.received_seq_max - report.last_report_seq_max;
+  RTC_DCHECK_GE(exp_since_last, 0);
+
+  int32_t lost_since_last =
+      state.cumulative_loss - report.last_report_cumulative_loss;
+  if (exp_since_last > 0 && lost_since_last > 0) {
+    // Scale 0 to 255, where 255 is 100% loss.
+    stats.SetFractionLost(255 * lost_since_last / exp_since_last);
+  }
+
+  int packets_lost = state.cumulative_loss + report.cumulative_loss_rtcp_offset;
+  if (packets_lost < 0) {
+    // Clamp to zero. Work around to accommodate for senders that misbehave with
+    // negative cumulative loss.
+    packets_lost = 0;
+    report.cumulative_loss_rtcp_offset = -state.cumulative_loss;
+  }
+  if (packets_lost > 0x7fffff) {
+    // Packets lost is a 24 bit signed field, and thus should be clamped, as
+    // described in https://datatracker.ietf.org/doc/html/rfc3550#appendix-A.3
+    if (!report.cumulative_loss_is_capped) {
+      report.cumulative_loss_is_capped = true;
+      RTC_LOG(LS_WARNING) << "Cumulative loss reached maximum value for ssrc "
+                          << ssrc;
+    }
+    packets_lost = 0x7fffff;
+  }
+  stats.SetCumulativeLost(packets_lost);
+  stats.SetExtHighestSeqNum(state.received_seq_max);
+  // Note: internal jitter value is in Q4 and needs to be scaled by 1/16.
+  stats.SetJitter(state.jitter_q4 >> 4);
+
+  // Only for report blocks in RTCP SR and RR.
+  report.last_report_cumulative_loss = state.cumulative_loss;
+  report.last_report_seq_max = state.received_seq_max;
+  BWE_TEST_LOGGING_PLOT_WITH_SSRC(1, "cumulative_loss_pkts", now.ms(),
+                                  state.cumulative_loss, ssrc);
+  BWE_TEST_LOGGING_PLOT_WITH_SSRC(
+      1, "received_seq_max_pkts", now.ms(),
+      (state.received_seq_max - state.received_seq_first), ssrc);
+}
+
 }  // namespace
 
 StreamStatistician::~StreamStatistician() {}
 
-StreamStatisticianImpl::StreamStatisticianImpl(uint32_t ssrc,
-                                               Clock* clock,
-                                               int max_reordering_threshold)
-    : ssrc_(ssrc),
-      clock_(clock),
-      delta_internal_unix_epoch_(UnixEpochDelta(*clock_)),
-      incoming_bitrate_(/*max_window_size=*/kStatisticsProcessInterval),
-      max_reordering_threshold_(max_reordering_threshold),
+StreamReceiveStateTracker::StreamReceiveStateTracker(
+    int max_reordering_threshold)
+    : max_reordering_threshold_(max_reordering_threshold),
       enable_retransmit_detection_(false),
-      cumulative_loss_is_capped_(false),
-      jitter_q4_(0),
-      cumulative_loss_(0),
-      cumulative_loss_rtcp_offset_(0),
-      last_received_timestamp_(0),
-      received_seq_first_(-1),
-      received_seq_max_(-1),
-      last_report_cumulative_loss_(0),
-      last_report_seq_max_(-1),
-      last_payload_type_frequency_(0) {}
+      last_received_timestamp_(0) {}
 
-StreamStatisticianImpl::~StreamStatisticianImpl() = default;
+StreamReceiveStateTracker::~StreamReceiveStateTracker() = default;
 
-bool StreamStatisticianImpl::UpdateOutOfOrder(const RtpPacketReceived& packet,
-                                              int64_t sequence_number,
-                                              Timestamp now) {
+bool StreamReceiveStateTracker::UpdateOutOfOrder(
+    const RtpPacketReceived& packet,
+    int64_t sequence_number,
+    Timestamp now) {
   // Check if `packet` is second packet of a stream restart.
   if (received_seq_out_of_order_) {
     // Count the previous packet as a received; it was postponed below.
-    --cumulative_loss_;
+    --state_.cumulative_loss;
 
     uint16_t expected_sequence_number = *received_seq_out_of_order_ + 1;
     received_seq_out_of_order_ = absl::nullopt;
     if (packet.SequenceNumber() == expected_sequence_number) {
       // Ignore sequence number gap caused by stream restart for packet loss
-      // calculation, by setting received_seq_max_ to the sequence number just
+      // calculation, by setting received_seq_max to the sequence number just
       // before the out-of-order seqno. This gives a net zero change of
-      // `cumulative_loss_`, for the two packets interpreted as a stream reset.
+      // `cumulative_loss`, for the two packets interpreted as a stream reset.
       //
       // Fraction loss for the next report may get a bit off, since we don't
-      // update last_report_seq_max_ and last_report_cumulative_loss_ in a
+      // update the report start and last_report_cumulative_loss in a
       // consistent way.
-      last_report_seq_max_ = sequence_number - 2;
-      received_seq_max_ = sequence_number - 2;
+      state_.report_start_seq_max = sequence_number - 2;
+      ++state_.report_start_updates;
+      state_.received_seq_max = sequence_number - 2;
       return false;
     }
   }
 
-  if (std::abs(sequence_number - received_seq_max_) >
-      max_reordering_threshold_) {
+  if (std::abs(sequence_number - state_.received_seq_max) >
+      max_reordering_threshold_.load(std::memory_order_relaxed)) {
     // Sequence number gap looks too large, wait until next packet to check
     // for a stream restart.
     received_seq_out_of_order_ = packet.SequenceNumber();
     // Postpone counting this as a received packet until we know how to update
-    // `received_seq_max_`, otherwise we temporarily decrement
-    // `cumulative_loss_`. The
+    // `received_seq_max`, otherwise we temporarily decrement
+    // `cumulative_loss`. The
     // ReceiveStatisticsTest.StreamRestartDoesntCountAsLoss test expects
-    // `cumulative_loss_` to be unchanged by the reception of the first packet
+    // `cumulative_loss` to be unchanged by the reception of the first packet
     // after stream reset.
-    ++cumulative_loss_;
+    ++state_.cumulative_loss;
     return true;
   }
 
-  if (sequence_number > received_seq_max_)
+  if (sequence_number > state_.received_seq_max)
     return false;
 
   // Old out of order packet, may be retransmit.
-  if (enable_retransmit_detection_ && IsRetransmitOfOldPacket(packet, now))
-    receive_counters_.retransmitted.AddPacket(packet);
+  if (enable_retransmit_detection_.load(std::memory_order_relaxed) &&
+      IsRetransmitOfOldPacket(packet, now))
+    state_.counters.retransmitted.AddPacket(packet);
   return true;
 }
 
-void StreamStatisticianImpl::UpdateCounters(const RtpPacketReceived& packet) {
-  RTC_DCHECK_EQ(ssrc_, packet.Ssrc());
-  Timestamp now = clock_->CurrentTime();
-
-  incoming_bitrate_.Update(packet.size(), now);
-  receive_counters_.transmitted.AddPacket(packet);
-  --cumulative_loss_;
+void StreamReceiveStateTracker::UpdateCounters(const RtpPacketReceived& packet,
+                                               Timestamp now) {
+  state_.counters.transmitted.AddPacket(packet);
+  --state_.cumulative_loss;
 
   // Use PeekUnwrap and later update the state to avoid updating the state for
   // out of order packets.
   int64_t sequence_number = seq_unwrapper_.PeekUnwrap(packet.SequenceNumber());
 
   if (!ReceivedRtpPacket()) {
-    received_seq_first_ = sequence_number;
-    last_report_seq_max_ = sequence_number - 1;
-    received_seq_max_ = sequence_number - 1;
-    receive_counters_.first_packet_time = now;
+    state_.received_seq_first = sequence_number;
+    state_.report_start_seq_max = sequence_number - 1;
+    ++state_.report_start_updates;
+    state_.received_seq_max = sequence_number - 1;
+    state_.counters.first_packet_time = now;
   } else if (UpdateOutOfOrder(packet, sequence_number, now)) {
     return;
   }
   // In order packet.
-  cumulative_loss_ += sequence_number - received_seq_max_;
-  received_seq_max_ = sequence_number;
+  state_.cumulative_loss += sequence_number - state_.received_seq_max;
+  state_.received_seq_max = sequence_number;
   // Update the internal state of `seq_unwrapper_`.
   seq_unwrapper_.Unwrap(packet.SequenceNumber());
 
   // If new time stamp and more than one in-order packet received, calculate
   // new jitter statistics.
   if (packet.Timestamp() != last_received_timestamp_ &&
-      (receive_counters_.transmitted.packets -
-       receive_counters_.retransmitted.packets) > 1) {
+      (state_.counters.transmitted.packets -
+       state_.counters.retransmitted.packets) > 1) {
     UpdateJitter(packet, now);
   }
   last_received_timestamp_ = packet.Timestamp();
-  last_receive_time_ = now;
+  state_.last_receive_time = now;
 }
 
-void StreamStatisticianImpl::UpdateJitter(const RtpPacketReceived& packet,
-                                          Timestamp receive_time) {
-  RTC_DCHECK(last_receive_time_.has_value());
-  TimeDelta receive_diff = receive_time - *last_receive_time_;
+void StreamReceiveStateTracker::UpdateJitter(const RtpPacketReceived& packet,
+                                             Timestamp receive_time) {
+  RTC_DCHECK(state_.last_receive_time.has_value());
+  TimeDelta receive_diff = receive_time - *state_.last_receive_time;
   RTC_DCHECK_GE(receive_diff, TimeDelta::Zero());
   uint32_t receive_diff_rtp =
       (receive_diff * packet.payload_type_frequency()).seconds<uint32_t>();
@@ -168,144 +253,121 @@ void StreamStatisticianImpl::UpdateJitter(const RtpPacketReceived& packet,
   // as the threshold.
   if (time_diff_samples < 450000) {
     // Note we calculate in Q4 to avoid using float.
-    int32_t jitter_diff_q4 = (time_diff_samples << 4) - jitter_q4_;
-    jitter_q4_ += ((jitter_diff_q4 + 8) >> 4);
+    int32_t jitter_diff_q4 = (time_diff_samples << 4) - state_.jitter_q4;
+    state_.jitter_q4 += ((jitter_diff_q4 + 8) >> 4);
   }
 }
 
-void StreamStatisticianImpl::ReviseFrequencyAndJitter(
+void StreamReceiveStateTracker::ReviseFrequencyAndJitter(
     int payload_type_frequency) {
-  if (payload_type_frequency == last_payload_type_frequency_) {
+  if (payload_type_frequency == state_.last_payload_type_frequency) {
     return;
   }
 
   if (payload_type_frequency != 0) {
-    if (last_payload_type_frequency_ != 0) {
-      // Value in "jitter_q4_" variable is a number of samples.
+    if (state_.last_payload_type_frequency != 0) {
+      // Value in "jitter_q4" variable is a number of samples.
       // I.e. jitter = timestamp (s) * frequency (Hz).
       // Since the frequency has changed we have to update the number of samples
       // accordingly. The new value should rely on a new frequency.
 
       // If we don't do such procedure we end up with the number of samples that
       // cannot be converted into TimeDelta correctly
-      // (i.e. jitter = jitter_q4_ >> 4 / payload_type_frequency).
+      // (i.e. jitter = jitter_q4 >> 4 / payload_type_frequency).
       // In such case, the number of samples has a "mix".
 
       // Doing so we pretend that everything prior and including the current
       // packet were computed on packet's frequency.
-      jitter_q4_ = static_cast<int>(static_cast<uint64_t>(jitter_q4_) *
-                                    payload_type_frequency /
-                                    last_payload_type_frequency_);
+      state_.jitter_q4 = static_cast<int>(
+          static_cast<uint64_t>(state_.jitter_q4) * payload_type_frequency /
+          state_.last_payload_type_frequency);
     }
-    // If last_payload_type_frequency_ is not present, the jitter_q4_
+    // If last_payload_type_frequency is not present, the jitter_q4
     // variable has its initial value.
 
-    // Keep last_payload_type_frequency_ up to date and non-zero (set).
-    last_payload_type_frequency_ = payload_type_frequency;
+    // Keep last_payload_type_frequency up to date and non-zero (set).
+    state_.last_payload_type_frequency = payload_type_frequency;
   }
 }
 
-void StreamStatisticianImpl::SetMaxReorderingThreshold(
+void StreamReceiveStateTracker::SetMaxReorderingThreshold(
     int max_reordering_threshold) {
-  max_reordering_threshold_ = max_reordering_threshold;
+  max_reordering_threshold_.store(max_reordering_threshold,
+                                  std::memory_order_relaxed);
 }
 
-void StreamStatisticianImpl::EnableRetransmitDetection(bool enable) {
-  enable_retransmit_detection_ = enable;
+void StreamReceiveStateTracker::EnableRetransmitDetection(bool enable) {
+  enable_retransmit_detection_.store(enable, std::memory_order_relaxed);
 }
 
-RtpReceiveStats StreamStatisticianImpl::GetStats() const {
-  RtpReceiveStats stats;
-  stats.packets_lost = cumulative_loss_;
-  // Note: internal jitter value is in Q4 and needs to be scaled by 1/16.
-  stats.jitter = jitter_q4_ >> 4;
-  if (last_payload_type_frequency_ > 0) {
-    // Divide value in fractional seconds by frequency to get jitter in
-    // fractional seconds.
-    stats.interarrival_jitter =
-        TimeDelta::Seconds(stats.jitter) / last_payload_type_frequency_;
-  }
-  if (last_receive_time_.has_value()) {
-    stats.last_packet_received =
-        *last_receive_time_ + delta_internal_unix_epoch_;
-  }
-  stats.packet_counter = receive_counters_.transmitted;
-  return stats;
+bool StreamReceiveStateTracker::IsRetransmitOfOldPacket(
+    const RtpPacketReceived& packet,
+    Timestamp now) const {
+  int frequency_hz = packet.payload_type_frequency();
+  RTC_DCHECK(state_.last_receive_time.has_value());
+  RTC_CHECK_GT(frequency_hz, 0);
+  TimeDelta time_diff = now - *state_.last_receive_time;
+
+  // Diff in time stamp since last received in order.
+  uint32_t timestamp_diff = packet.Timestamp() - last_received_timestamp_;
+  TimeDelta rtp_time_stamp_diff =
+      TimeDelta::Seconds(timestamp_diff) / frequency_hz;
+
+  // Jitter standard deviation in samples.
+  float jitter_std = std::sqrt(static_cast<float>(state_.jitter_q4 >> 4));
+
+  // 2 times the standard deviation => 95% confidence.
+  // Min max_delay is 1ms.
+  TimeDelta max_delay = std::max(
+      TimeDelta::Seconds(2 * jitter_std / frequency_hz), TimeDelta::Millis(1));
+
+  return time_diff > rtp_time_stamp_diff + max_delay;
 }
 
-void StreamStatisticianImpl::MaybeAppendReportBlockAndReset(
-    std::vector<rtcp::ReportBlock>& report_blocks) {
-  if (!ReceivedRtpPacket()) {
-    return;
-  }
+StreamStatisticianImpl::StreamStatisticianImpl(uint32_t ssrc,
+                                               Clock* clock,
+                                               int max_reordering_threshold)
+    : ssrc_(ssrc),
+      clock_(clock),
+      delta_internal_unix_epoch_(UnixEpochDelta(*clock_)),
+      incoming_bitrate_(/*max_window_size=*/kStatisticsProcessInterval),
+      receive_state_(max_reordering_threshold) {}
+
+StreamStatisticianImpl::~StreamStatisticianImpl() = default;
+
+void StreamStatisticianImpl::UpdateCounters(const RtpPacketReceived& packet) {
+  RTC_DCHECK_EQ(ssrc_, packet.Ssrc());
   Timestamp now = clock_->CurrentTime();
-  if (now - *last_receive_time_ >= kStatisticsTimeout) {
-    // Not active.
-    return;
-  }
+  incoming_bitrate_.Update(packet.size(), now);
+  receive_state_.UpdateCounters(packet, now);
+}
 
-  report_blocks.emplace_back();
-  rtcp::ReportBlock& stats = report_blocks.back();
-  stats.SetMediaSsrc(ssrc_);
-  // Calculate fraction lost.
-  int64_t exp_since_last = received_seq_max_ - last_report_seq_max_;
-  RTC_DCHECK_GE(exp_since_last, 0);
+void StreamStatisticianImpl::SetMaxReorderingThreshold(
+    int max_reordering_threshold) {
+  receive_state_.SetMaxReorderingThreshold(max_reordering_threshold);
+}
 
-  int32_t lost_since_last = cumulative_loss_ - last_report_cumulative_loss_;
-  if (exp_since_last > 0 && lost_since_last > 0) {
-    // Scale 0 to 255, where 255 is 100% loss.
-    stats.SetFractionLost(255 * lost_since_last / exp_since_last);
-  }
+void StreamStatisticianImpl::EnableRetransmitDetection(bool enable) {
+  receive_state_.EnableRetransmitDetection(enable);
+}
 
-  int packets_lost = cumulative_loss_ + cumulative_loss_rtcp_offset_;
-  if (packets_lost < 0) {
-    // Clamp to zero. Work around to accommodate for senders that misbehave with
-    // negative cumulative loss.
-    packets_lost = 0;
-    cumulative_loss_rtcp_offset_ = -cumulative_loss_;
-  }
-  if (packets_lost > 0x7fffff) {
-    // Packets lost is a 24 bit signed field, and thus should be clamped, as
-    // described in https://datatracker.ietf.org/doc/html/rfc3550#appendix-A.3
-    if (!cumulative_loss_is_capped_) {
-      cumulative_loss_is_capped_ = true;
-      RTC_LOG(LS_WARNING) << "Cumulative loss reached maximum value for ssrc "
-                          << ssrc_;
-    }
-    packets_lost = 0x7fffff;
-  }
-  stats.SetCumulativeLost(packets_lost);
-  stats.SetExtHighestSeqNum(received_seq_max_);
-  // Note: internal jitter value is in Q4 and needs to be scaled by 1/16.
-  stats.SetJitter(jitter_q4_ >> 4);
+RtpReceiveStats StreamStatisticianImpl::GetStats() const {
+  return GetReceiveStats(receive_state_.state(), delta_internal_unix_epoch_);
+}
 
-  // Only for report blocks in RTCP SR and RR.
-  last_report_cumulative_loss_ = cumulative_loss_;
-  last_report_seq_max_ = received_seq_max_;
-  BWE_TEST_LOGGING_PLOT_WITH_SSRC(1, "cumulative_loss_pkts", now.ms(),
-                                  cumulative_loss_, ssrc_);
-  BWE_TEST_LOGGING_PLOT_WITH_SSRC(1, "received_seq_max_pkts", now.ms(),
-                                  (received_seq_max_ - received_seq_first_),
-                                  ssrc_);
+void StreamStatisticianImpl::MaybeAppendReportBlockAndReset(
+    std::vector<rtcp::ReportBlock>& report_blocks) {
+  MaybeAppendReportBlock(ssrc_, receive_state_.state(), clock_->CurrentTime(),
+                         report_state_, report_blocks);
 }
 
 absl::optional<int> StreamStatisticianImpl::GetFractionLostInPercent() const {
-  if (!ReceivedRtpPacket()) {
-    return absl::nullopt;
-  }
-  int64_t expected_packets = 1 + received_seq_max_ - received_seq_first_;
-  if (expected_packets <= 0) {
-    return absl::nullopt;
-  }
-  if (cumulative_loss_ <= 0) {
-    return 0;
-  }
-  return 100 * static_cast<int64_t>(cumulative_loss_) / expected_packets;
+  return FractionLostInPercent(receive_state_.state());
 }
 
 StreamDataCounters StreamStatisticianImpl::GetReceiveStreamDataCounters()
     const {
-  return receive_counters_;
+  return receive_state_.state().counters;
 }
 
 uint32_t StreamStatisticianImpl::BitrateReceived() const {
@@ -314,34 +376,74 @@ uint32_t StreamStatisticianImpl::BitrateReceived() const {
       .bps<uint32_t>();
 }
 
-bool StreamStatisticianImpl::IsRetransmitOfOldPacket(
-    const RtpPacketReceived& packet,
-    Timestamp now) const {
-  int frequency_hz = packet.payload_type_frequency();
-  RTC_DCHECK(last_receive_time_.has_value());
-  RTC_CHECK_GT(frequency_hz, 0);
-  TimeDelta time_diff = now - *last_receive_time_;
+StreamStatisticianSeqLock::StreamStatisticianSeqLock(
+    uint32_t ssrc,
+    Clock* clock,
+    int max_reordering_threshold)
+    : ssrc_(ssrc),
+      clock_(clock),
+      delta_internal_unix_epoch_(UnixEpochDelta(*clock_)),
+      receive_state_(max_reordering_threshold),
+      incoming_bitrate_(/*max_window_size=*/kStatisticsProcessInterval) {}
 
-  // Diff in time stamp since last received in order.
-  uint32_t timestamp_diff = packet.Timestamp() - last_received_timestamp_;
-  TimeDelta rtp_time_stamp_diff =
-      TimeDelta::Seconds(timestamp_diff) / frequency_hz;
+StreamStatisticianSeqLock::~StreamStatisticianSeqLock() = default;
 
-  // Jitter standard deviation in samples.
-  float jitter_std = std::sqrt(static_cast<float>(jitter_q4_ >> 4));
+void StreamStatisticianSeqLock::UpdateCounters(
+    const RtpPacketReceived& packet) {
+  RTC_DCHECK_RUN_ON(&packet_sequence_checker_);
+  RTC_DCHECK_EQ(ssrc_, packet.Ssrc());
+  Timestamp now = clock_->CurrentTime();
+  {
+    MutexLock lock(&bitrate_lock_);
+    incoming_bitrate_.Update(packet.size(), now);
+  }
+  receive_state_.UpdateCounters(packet, now);
+  published_state_.Store(receive_state_.state());
+}
 
-  // 2 times the standard deviation => 95% confidence.
-  // Min max_delay is 1ms.
-  TimeDelta max_delay = std::max(
-      TimeDelta::Seconds(2 * jitter_std / frequency_hz), TimeDelta::Millis(1));
+void StreamStatisticianSeqLock::SetMaxReorderingThreshold(
+    int max_reordering_threshold) {
+  receive_state_.SetMaxReorderingThreshold(max_reordering_threshold);
+}
 
-  return time_diff > rtp_time_stamp_diff + max_delay;
+void StreamStatisticianSeqLock::EnableRetransmitDetection(bool enable) {
+  receive_state_.EnableRetransmitDetection(enable);
+}
+
+RtpReceiveStats StreamStatisticianSeqLock::GetStats() const {
+  return GetReceiveStats(published_state_.Load(), delta_internal_unix_epoch_);
+}
+
+void StreamStatisticianSeqLock::MaybeAppendReportBlockAndReset(
+    std::vector<rtcp::ReportBlock>& report_blocks) {
+  const StreamReceiveState state = published_state_.Load();
+  MutexLock lock(&report_lock_);
+  MaybeAppendReportBlock(ssrc_, state, clock_->CurrentTime(), report_state_,
+                         report_blocks);
+}
+
+absl::optional<int> StreamStatisticianSeqLock::GetFractionLostInPercent()
+    const {
+  return FractionLostInPercent(published_state_.Load());
+}
+
+StreamDataCounters StreamStatisticianSeqLock::GetReceiveStreamDataCounters()
+    const {
+  return published_state_.Load().counters;
+}
+
+uint32_t StreamStatisticianSeqLock::BitrateReceived() const {
+  Timestamp now = clock_->CurrentTime();
+  MutexLock lock(&bitrate_lock_);
+  return incoming_bitrate_.Rate(now)
+      .value_or(DataRate::Zero())
+      .bps<uint32_t>();
 }
 
 std::unique_ptr<ReceiveStatistics> ReceiveStatistics::Create(Clock* clock) {
   return std::make_unique<ReceiveStatisticsLocked>(
       clock, [](uint32_t ssrc, Clock* clock, int max_reordering_threshold) {
-        return std::make_unique<StreamStatisticianLocked>(
+        return std::make_unique<StreamStatisticianSeqLock>(
             ssrc, clock, max_reordering_threshold);
       });
 }
@@ -430,4 +532,15 @@ std::vector<rtcp::ReportBlock> ReceiveStatisticsImpl::RtcpReportBlocks(
   return result;
 }
 
+void ReceiveStatisticsLocked::OnRtpPacket(const RtpPacketReceived& packet) {
+  RTC_DCHECK_RUN_ON(&packet_sequence_checker_);
+  StreamStatisticianImplInterface*& statistician =
+      packet_statisticians_[packet.Ssrc()];
+  if (statistician == nullptr) {
+    MutexLock lock(&receive_statistics_lock_);
+    statistician = impl_.GetOrCreateStatistician(packet.Ssrc());
+  }
+  statistician->UpdateCounters(packet);
+}
+
 }  // namespace webrtc
@@ -12,12 +12,14 @@
 #define MODULES_RTP_RTCP_SOURCE_RECEIVE_STATISTICS_IMPL_H_
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <utility>
 #include <vector>
 
 #include "absl/types/optional.h"
+#include "api/sequence_checker.h"
 #include "api/units/time_delta.h"
 #include "api/units/timestamp.h"
 #include "modules/rtp_rtcp/include/receive_statistics.h"
@@ -26,6 +28,8 @@
 #include "rtc_base/containers/flat_map.h"
 #include "rtc_base/numerics/sequence_number_unwrapper.h"
 #include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/synchronization/seq_lock.h"
+#include "rtc_base/system/no_unique_address.h"
 #include "rtc_base/thread_annotations.h"
 
 namespace webrtc {
@@ -41,6 +45,81 @@ class StreamStatisticianImplInterface : public StreamStatistician {
   virtual void UpdateCounters(const RtpPacketReceived& packet) = 0;
 };
 
+// State of a received stream as of its latest packet, from which statistics
+// and report blocks are computed. Trivially copyable, so that it can be
+// published to other threads through a SeqLock.
+struct StreamReceiveState {
+  // Cumulative loss according to RFC 3550, which may be negative (and often is,
+  // if packets are reordered and there are non-RTX retransmissions).
+  int32_t cumulative_loss = 0;
+  uint32_t jitter_q4 = 0;
+  // The sample frequency of the last received packet.
+  int last_payload_type_frequency = 0;
+  absl::optional<Timestamp> last_receive_time;
+  int64_t received_seq_first = -1;
+  int64_t received_seq_max = -1;
+  // Highest sequence number the next report block should count the expected
+  // packets from, set by the first packet and by stream restarts. Each time it
+  // is set, `report_start_updates` is incremented.
+  int64_t report_start_seq_max = -1;
+  uint32_t report_start_updates = 0;
+  // Current counter values.
+  StreamDataCounters counters;
+};
+
+// State of the report blocks sent for a stream.
+struct StreamReportState {
+  // Counter values when we sent the last report.
+  int32_t last_report_cumulative_loss = 0;
+  int64_t last_report_seq_max = -1;
+  uint32_t report_start_updates = 0;
+  // Offset added to outgoing rtcp reports, to make ensure that the reported
+  // cumulative loss is non-negative. Reports with negative values confuse some
+  // senders, in particular, our own loss-based bandwidth estimator.
+  int32_t cumulative_loss_rtcp_offset = 0;
+  bool cumulative_loss_is_capped = false;
+};
+
+// Updates the StreamReceiveState of a stream for its incoming packets.
+// Thread-compatible, except that the setters may be called on any thread.
+class StreamReceiveStateTracker {
+ public:
+  explicit StreamReceiveStateTracker(int max_reordering_threshold);
+  ~StreamReceiveStateTracker();
+
+  const StreamReceiveState& state() const { return state_; }
+
+  void SetMaxReorderingThreshold(int max_reordering_threshold);
+  void EnableRetransmitDetection(bool enable);
+  void UpdateCounters(const RtpPacketReceived& packet, Timestamp now);
+
+ private:
+  bool IsRetransmitOfOldPacket(const RtpPacketReceived& packet,
+                               Timestamp now) const;
+  void UpdateJitter(const RtpPacketReceived& packet, Timestamp receive_time);
+  void ReviseFrequencyAndJitter(int payload_type_frequency);
+  // Updates StreamStatistician for out of order packets.
+  // Returns true if packet considered to be out of order.
+  bool UpdateOutOfOrder(const RtpPacketReceived& packet,
+                        int64_t sequence_number,
+                        Timestamp now);
+  // Checks if this StreamStatistician received any rtp packets.
+  bool ReceivedRtpPacket() const {
+    return state_.last_receive_time.has_value();
+  }
+
+  // In number of packets or sequence numbers.
+  std::atomic<int> max_reordering_threshold_;
+  std::atomic<bool> enable_retransmit_detection_;
+
+  StreamReceiveState state_;
+  uint32_t last_received_timestamp_;
+  RtpSequenceNumberUnwrapper seq_unwrapper_;
+  // Assume that the other side restarted when there are two sequential packets
+  // with large jump from received_seq_max.
+  absl::optional<uint16_t> received_seq_out_of_order_;
+};
+
 // Thread-compatible implementation of StreamStatisticianImplInterface.
 class StreamStatisticianImpl : public StreamStatisticianImplInterface {
  public:
@@ -64,104 +143,49 @@ class StreamStatisticianImpl : public StreamStatisticianImplInterface {
   void UpdateCounters(const RtpPacketReceived& packet) override;
 
  private:
-  bool IsRetransmitOfOldPacket(const RtpPacketReceived& packet,
-                               Timestamp now) const;
-  void UpdateJitter(const RtpPacketReceived& packet, Timestamp receive_time);
-  void ReviseFrequencyAndJitter(int payload_type_frequency);
-  // Updates StreamStatistician for out of order packets.
-  // Returns true if packet considered to be out of order.
-  bool UpdateOutOfOrder(const RtpPacketReceived& packet,
-                        int64_t sequence_number,
-                        Timestamp now);
-  // Checks if this StreamStatistician received any rtp packets.
-  bool ReceivedRtpPacket() const { return last_receive_time_.has_value(); }
-
   const uint32_t ssrc_;
   Clock* const clock_;
   // Delta used to map internal timestamps to Unix epoch ones.
   const TimeDelta delta_internal_unix_epoch_;
   BitrateTracker incoming_bitrate_;
-  // In number of packets or sequence numbers.
-  int max_reordering_threshold_;
-  bool enable_retransmit_detection_;
-  bool cumulative_loss_is_capped_;
-
-  // Stats on received RTP packets.
-  uint32_t jitter_q4_;
-  // Cumulative loss according to RFC 3550, which may be negative (and often is,
-  // if packets are reordered and there are non-RTX retransmissions).
-  int32_t cumulative_loss_;
-  // Offset added to outgoing rtcp reports, to make ensure that the reported
-  // cumulative loss is non-negative. Reports with negative values confuse some
-  // senders, in particular, our own loss-based bandwidth estimator.
-  int32_t cumulative_loss_rtcp_offset_;
-
-  absl::optional<Timestamp> last_receive_time_;
-  uint32_t last_received_timestamp_;
-  RtpSequenceNumberUnwrapper seq_unwrapper_;
-  int64_t received_seq_first_;
-  int64_t received_seq_max_;
-  // Assume that the other side restarted when there are two sequential packets
-  // with large jump from received_seq_max_.
-  absl::optional<uint16_t> received_seq_out_of_order_;
-
-  // Current counter values.
-  StreamDataCounters receive_counters_;
-
-  // Counter values when we sent the last report.
-  int32_t last_report_cumulative_loss_;
-  int64_t last_report_seq_max_;
-
-  // The sample frequency of the last received packet.
-  int last_payload_type_frequency_;
+  StreamReceiveStateTracker receive_state_;
+  StreamReportState report_state_;
 };
 
-// Thread-safe implementation of StreamStatisticianImplInterface.
-class StreamStatisticianLocked : public StreamStatisticianImplInterface {
+// Thread-safe implementation of StreamStatisticianImplInterface, for a single
+// writer: UpdateCounters() must be called on one sequence, but takes no lock
+// other than the one of the bitrate tracker, which only BitrateReceived()
+// contends for. The other getters and report block generation read a snapshot
+// of the stream state published after every packet.
+class StreamStatisticianSeqLock : public StreamStatisticianImplInterface {
  public:
-  StreamStatisticianLocked(uint32_t ssrc,
-                           Clock* clock,
-                           int max_reordering_threshold)
-      : impl_(ssrc, clock, max_reordering_threshold) {}
-  ~StreamStatisticianLocked() override = default;
-
-  RtpReceiveStats GetStats() const override {
-    MutexLock lock(&stream_lock_);
-    return impl_.GetStats();
-  }
-  absl::optional<int> GetFractionLostInPercent() const override {
-    MutexLock lock(&stream_lock_);
-    return impl_.GetFractionLostInPercent();
-  }
-  StreamDataCounters GetReceiveStreamDataCounters() const override {
-    MutexLock lock(&stream_lock_);
-    return impl_.GetReceiveStreamDataCounters();
-  }
-  uint32_t BitrateReceived() const override {
-    MutexLock lock(&stream_lock_);
-    return impl_.BitrateReceived();
-  }
+  StreamStatisticianSeqLock(uint32_t ssrc,
+                            Clock* clock,
+                            int max_reordering_threshold);
+  ~StreamStatisticianSeqLock() override;
+
+  RtpReceiveStats GetStats() const override;
+  absl::optional<int> GetFractionLostInPercent() const override;
+  StreamDataCounters GetReceiveStreamDataCounters() const override;
+  uint32_t BitrateReceived() const override;
   void MaybeAppendReportBlockAndReset(
-      std::vector<rtcp::ReportBlock>& report_blocks) override {
-    MutexLock lock(&stream_lock_);
-    impl_.MaybeAppendReportBlockAndReset(report_blocks);
-  }
-  void SetMaxReorderingThreshold(int max_reordering_threshold) override {
-    MutexLock lock(&stream_lock_);
-    return impl_.SetMaxReorderingThreshold(max_reordering_threshold);
-  }
-  void EnableRetransmitDetection(bool enable) override {
-    MutexLock lock(&stream_lock_);
-    return impl_.EnableRetransmitDetection(enable);
-  }
-  void UpdateCounters(const RtpPacketReceived& packet) override {
-    MutexLock lock(&stream_lock_);
-    return impl_.UpdateCounters(packet);
-  }
+      std::vector<rtcp::ReportBlock>& report_blocks) override;
+  void SetMaxReorderingThreshold(int max_reordering_threshold) override;
+  void EnableRetransmitDetection(bool enable) override;
+  void UpdateCounters(const RtpPacketReceived& packet) override;
 
  private:
-  mutable Mutex stream_lock_;
-  StreamStatisticianImpl impl_ RTC_GUARDED_BY(&stream_lock_);
+  const uint32_t ssrc_;
+  Clock* const clock_;
+  const TimeDelta delta_internal_unix_epoch_;
+  RTC_NO_UNIQUE_ADDRESS SequenceChecker packet_sequence_checker_{
+      SequenceChecker::kDetached};
+  StreamReceiveStateTracker receive_state_;
+  SeqLock<StreamReceiveState> published_state_;
+  mutable Mutex bitrate_lock_;
+  BitrateTracker incoming_bitrate_ RTC_GUARDED_BY(bitrate_lock_);
+  Mutex report_lock_;
+  StreamReportState report_state_ RTC_GUARDED_BY(report_lock_);
 };
 
 // Thread-compatible implementation.
@@ -188,9 +212,10 @@ class ReceiveStatisticsImpl : public ReceiveStatistics {
                                  int max_reordering_threshold) override;
   void EnableRetransmitDetection(uint32_t ssrc, bool enable) override;
 
- private:
+  // Statisticians are only destroyed together with this object.
   StreamStatisticianImplInterface* GetOrCreateStatistician(uint32_t ssrc);
 
+ private:
   Clock* const clock_;
   std::function<std::unique_ptr<StreamStatisticianImplInterface>(
       uint32_t ssrc,
@@ -206,7 +231,8 @@ class ReceiveStatisticsImpl : public ReceiveStatistics {
 };
 
 // Thread-safe implementation wrapping access to ReceiveStatisticsImpl with a
-// mutex.
+// mutex. OnRtpPacket() must be called on one sequence, and only takes the
+// mutex the first time it sees an SSRC.
 class ReceiveStatisticsLocked : public ReceiveStatistics {
  public:
   explicit ReceiveStatisticsLocked(
@@ -221,10 +247,7 @@ class ReceiveStatisticsLocked : public ReceiveStatistics {
     MutexLock lock(&receive_statistics_lock_);
     return impl_.RtcpReportBlocks(max_blocks);
   }
-  void OnRtpPacket(const RtpPacketReceived& packet) override {
-    MutexLock lock(&receive_statistics_lock_);
-    return impl_.OnRtpPacket(packet);
-  }
+  void OnRtpPacket(const RtpPacketReceived& packet) override;
   StreamStatistician* GetStatistician(uint32_t ssrc) const override {
     MutexLock lock(&receive_statistics_lock_);
     return impl_.GetStatistician(ssrc);
@@ -244,6 +267,11 @@ class ReceiveStatisticsLocked : public ReceiveStatistics {
   }
 
  private:
+  RTC_NO_UNIQUE_ADDRESS SequenceChecker packet_sequence_checker_{
+      SequenceChecker::kDetached};
+  // Statisticians of `impl_` seen by OnRtpPacket().
+  flat_map<uint32_t /*ssrc*/, StreamStatisticianImplInterface*>
+      packet_statisticians_ RTC_GUARDED_BY(packet_sequence_checker_);
   mutable Mutex receive_statistics_lock_;
   ReceiveStatisticsImpl impl_ RTC_GUARDED_BY(&receive_statistics_lock_);
 };
@@ -10,12 +10,14 @@
 
 #include "modules/rtp_rtcp/include/receive_statistics.h"
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <vector>
 
 #include "api/units/time_delta.h"
 #include "modules/rtp_rtcp/source/rtp_packet_received.h"
+#include "rtc_base/platform_thread.h"
 #include "rtc_base/random.h"
 #include "system_wrappers/include/clock.h"
 #include "test/gmock.h"
@@ -898,5 +900,41 @@ TEST(ReviseJitterTest,
   EXPECT_EQ(GetJitter(*statistics), 172U);
 }
 
+TEST(ReceiveStatisticsThreadingTest, ReportsWhilePacketsArriveOnAnotherThread) {
+  constexpr int kNumPackets = 20000;
+  SimulatedClock clock(0);
+  std::unique_ptr<ReceiveStatistics> statistics =
+      ReceiveStatistics::Create(&clock);
+  std::atomic<bool> done(false);
+  auto network_thread = rtc::PlatformThread::SpawnJoinable(
+      [&] {
+        RtpPacketReceived packet = CreateRtpPacket(kSsrc1, kPacketSize1);
+        for (int i = 0; i < kNumPackets; ++i) {
+          statistics->OnRtpPacket(packet);
+          IncrementSequenceNumber(&packet);
+        }
+        done.store(true);
+      },
+      "network");
+
+  uint32_t last_highest_sequence_number = 0;
+  while (!done.load()) {
+    for (const rtcp::ReportBlock& block : statistics->RtcpReportBlocks(1)) {
+      EXPECT_EQ(block.cumulative_lost(), 0);
+      EXPECT_GE(block.extended_high_seq_num(), last_highest_sequence_number);
+      last_highest_sequence_number = block.extended_high_seq_num();
+    }
+    StreamStatistician* statistician = statistics->GetStatistician(kSsrc1);
+    if (statistician != nullptr) {
+      EXPECT_EQ(statistician->GetStats().packets_lost, 0);
+    }
+  }
+  network_thread.Finalize();
+  EXPECT_EQ(statistics->GetStatistician(kSsrc1)
+                ->GetReceiveStreamDataCounters()
+                .transmitted.packets,
+            static_cast<uint32_t>(kNumPackets));
+}
+
 }  // namespace
 }  // namespace webrtc
@@ -0,0 +1,235 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/rtp_rtcp/source/reed_solomon_erasure_code.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+namespace {
+
+// Log and exponent tables of GF(2^8) built on the polynomial x^8 + x^4 + x^3 +
+// x^2 + 1, for which 2 generates the multiplicative group.
+struct GaloisTables {
+  GaloisTables() {
+    int x = 1;
+    for (int i = 0; i < 255; ++i) {
+      exp[i] = static_cast<uint8_t>(x);
+      exp[i + 255] = static_cast<uint8_t>(x);
+      log[x] = static_cast<uint8_t>(i);
+      x <<= 1;
+      if (x & 0x100) {
+        x ^= 0x11d;
+      }
+    }
+    log[0] = 0;  // Not used, 0 has no logarithm.
+  }
+
+  // Twice the group order, so that the sum of two logarithms can be looked up
+  // without a modulo.
+  uint8_t exp[2 * 255];
+  uint8_t log[256];
+};
+
+const GaloisTables& Tables() {
+  static const GaloisTables* const tables = new GaloisTables();
+  return *tables;
+}
+
+uint8_t Multiply(uint8_t a, uint8_t b) {
+  if (a == 0 || b == 0) {
+    return 0;
+  }
+  const GaloisTables& tables = Tables();
+  return tables.exp[tables.log[a] + tables.log[b]];
+}
+
+uint8_t Inverse(uint8_t a) {
+  RTC_DCHECK_NE(a, 0);
+  const GaloisTables& tables = Tables();
+  return tables.exp[255 - tables.log[a]];
+}
+
+// Adds `coefficient` times `src` to `dst`, both `length` bytes long.
+// The product of each byte is looked up separately for its low and high
+// nibble, from two 16 entry tables, the same decomposition as is used by
+// table lookup instructions such as PSHUFB or TBL.
+void MultiplyAdd(uint8_t coefficient,
+                 const uint8_t* src,
+                 size_t length,
+                 uint8_t* dst) {
+  if (coefficient == 0) {
+    return;
+  }
+  if (coefficient == 1) {
+    for (size_t i = 0; i < length; ++i) {
+      dst[i] ^= src[i];
+    }
+    return;
+  }
+  uint8_t low[16];
+  uint8_t high[16];
+  for (int v = 0; v < 16; ++v) {
+    low[v] = Multiply(coefficient, static_cast<uint8_t>(v));
+    high[v] = Multiply(coefficient, static_cast<uint8_t>(v << 4));
+  }
+  for (size_t i = 0; i < length; ++i) {
+    dst[i] ^= low[src[i] & 0x0f] ^ high[src[i] >> 4];
+  }
+}
+
+// Inverts the row-major `size` x `size` `matrix` by Gauss-Jordan elimination.
+// Returns false if it is singular. `matrix` is destroyed in the process.
+bool Invert(std::vector<uint8_t>& matrix,
+            int size,
+            std::vector<uint8_t>& inverse) {
+  inverse.assign(size * size, 0);
+  for (int i = 0; i < size; ++i) {
+    inverse[i * size + i] = 1;
+  }
+  for (int col = 0; col < size; ++col) {
+    int pivot = col;
+    while (pivot < size && matrix[pivot * size + col] == 0) {
+      ++pivot;
+    }
+    if (pivot == size) {
+      return false;
+    }
+    if (pivot != col) {
+      std::swap_ranges(&matrix[pivot * size], &matrix[(pivot + 1) * size],
+                       &matrix[col * size]);
+      std::swap_ranges(&inverse[pivot * size], &inverse[(pivot + 1) * size],
+                       &inverse[col * size]);
+    }
+    const uint8_t scale = Inverse(matrix[col * size + col]);
+    for (int k = 0; k < size; ++k) {
+      matrix[col * size + k] = Multiply(matrix[col * size + k], scale);
+      inverse[col * size + k] = Multiply(inverse[col * size + k], scale);
+    }
+    for (int row = 0; row < size; ++row) {
+      const uint8_t factor = matrix[row * size + col];
+      if (row == col || factor == 0) {
+        continue;
+      }
+      MultiplyAdd(factor, &matrix[col * size], size, &matrix[row * size]);
+      MultiplyAdd(factor, &inverse[col * size], size, &inverse[row * size]);
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+ReedSolomonErasureCode::ReedSolomonErasureCode(int num_media_packets,
+                                               int num_fec_packets)
+    : num_media_packets_(num_media_packets),
+      num_fec_packets_(num_fec_packets),
+      cauchy_matrix_(num_fec_packets * num_media_packets) {
+  RTC_DCHECK_GT(num_media_packets_, 0);
+  RTC_DCHECK_GE(num_fec_packets_, 0);
+  RTC_DCHECK_LE(num_media_packets_ + num_fec_packets_, kMaxPackets);
+  // Element (i, j) is 1 / (x_i + y_j), with x_i = num_media_packets + i for
+  // the FEC packets and y_j = j for the media packets. The elements are
+  // distinct, so the sum is never zero, and every square submatrix is
+  // invertible.
+  for (int i = 0; i < num_fec_packets_; ++i) {
+    for (int j = 0; j < num_media_packets_; ++j) {
+      cauchy_matrix_[i * num_media_packets_ + j] =
+          Inverse(static_cast<uint8_t>((num_media_packets_ + i) ^ j));
+    }
+  }
+}
+
+ReedSolomonErasureCode::~ReedSolomonErasureCode() = default;
+
+void ReedSolomonErasureCode::Encode(rtc::ArrayView<const uint8_t* const> media,
+                                    size_t length,
+                                    rtc::ArrayView<uint8_t* const> fec) const {
+  RTC_DCHECK_EQ(media.size(), num_media_packets_);
+  RTC_DCHECK_EQ(fec.size(), num_fec_packets_);
+  for (int i = 0; i < num_fec_packets_; ++i) {
+    memset(fec[i], 0, length);
+    for (int j = 0; j < num_media_packets_; ++j) {
+      MultiplyAdd(cauchy_matrix_[i * num_media_packets_ + j], media[j], length,
+                  fec[i]);
+    }
+  }
+}
+
+bool ReedSolomonErasureCode::Decode(
+    rtc::ArrayView<const uint8_t* const> packets,
+    size_t length,
+    rtc::ArrayView<uint8_t* const> recovered) const {
+  RTC_DCHECK_EQ(packets.size(), num_media_packets_ + num_fec_packets_);
+  RTC_DCHECK_EQ(recovered.size(), num_media_packets_);
+
+  std::vector<int> lost_media;
+  for (int j = 0; j < num_media_packets_; ++j) {
+    if (packets[j] == nullptr) {
+      lost_media.push_back(j);
+    }
+  }
+  if (lost_media.empty()) {
+    return true;
+  }
+  // One FEC packet is needed per lost media packet.
+  std::vector<int> fec_rows;
+  for (int i = 0; i < num_fec_packets_ && fec_rows.size() < lost_media.size();
+       ++i) {
+    if (packets[num_media_packets_ + i] != nullptr) {
+      fec_rows.push_back(i);
+    }
+  }
+  if (fec_rows.size() < lost_media.size()) {
+    return false;
+  }
+  const int num_lost = static_cast<int>(lost_media.size());
+
+  // Remove the contribution of the received media packets from the FEC
+  // packets, which leaves the lost media packets multiplied by the square
+  // submatrix of the selected FEC rows and the lost media columns.
+  std::vector<uint8_t> syndromes(num_lost * length);
+  std::vector<uint8_t> submatrix(num_lost * num_lost);
+  for (int r = 0; r < num_lost; ++r) {
+    const uint8_t* row = &cauchy_matrix_[fec_rows[r] * num_media_packets_];
+    uint8_t* syndrome = &syndromes[r * length];
+    memcpy(syndrome, packets[num_media_packets_ + fec_rows[r]], length);
+    for (int j = 0; j < num_media_packets_; ++j) {
+      if (packets[j] != nullptr) {
+        MultiplyAdd(row[j], packets[j], length, syndrome);
+      }
+    }
+    for (int c = 0; c < num_lost; ++c) {
+      submatrix[r * num_lost + c] = row[lost_media[c]];
+    }
+  }
+
+  std::vector<uint8_t> inverse;
+  if (!Invert(submatrix, num_lost, inverse)) {
+    RTC_DCHECK_NOTREACHED() << "Cauchy submatrices are invertible.";
+    return false;
+  }
+  for (int k = 0; k < num_lost; ++k) {
+    uint8_t* media = recovered[lost_media[k]];
+    memset(media, 0, length);
+    for (int r = 0; r < num_lost; ++r) {
+      MultiplyAdd(inverse[k * num_lost + r], &syndromes[r * length], length,
+                  media);
+    }
+  }
+  return true;
+}
+
+}  // namespace webrtc
@@ -0,0 +1,70 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_RTP_RTCP_SOURCE_REED_SOLOMON_ERASURE_CODE_H_
+#define MODULES_RTP_RTCP_SOURCE_REED_SOLOMON_ERASURE_CODE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "api/array_view.h"
+
+namespace webrtc {
+
+// Systematic Cauchy Reed-Solomon erasure code over GF(2^8).
+//
+// `num_media_packets` media packets are protected by `num_fec_packets` FEC
+// packets, and any `num_media_packets` out of the `num_media_packets +
+// num_fec_packets` packets suffice to recover all media packets. Unlike the
+// XOR parity of ULPFEC and FlexFEC, this holds for every loss pattern,
+// including bursts.
+//
+// All payloads of a block have the same length; shorter media payloads are
+// expected to be zero padded by the caller.
+class ReedSolomonErasureCode {
+ public:
+  // The Cauchy matrix needs distinct field elements for all packets.
+  static constexpr int kMaxPackets = 256;
+
+  ReedSolomonErasureCode(int num_media_packets, int num_fec_packets);
+  ~ReedSolomonErasureCode();
+
+  int num_media_packets() const { return num_media_packets_; }
+  int num_fec_packets() const { return num_fec_packets_; }
+
+  // Computes the FEC payloads of `length` bytes from the media payloads.
+  // `media` has `num_media_packets()` entries and `fec` `num_fec_packets()`.
+  void Encode(rtc::ArrayView<const uint8_t* const> media,
+              size_t length,
+              rtc::ArrayView<uint8_t* const> fec) const;
+
+  // Recovers the lost media payloads. `packets` has `num_media_packets() +
+  // num_fec_packets()` entries, the media payloads followed by the FEC
+  // payloads, with nullptr for the ones that were lost. The lost media
+  // payloads are written to the corresponding entries of `recovered`, which
+  // has `num_media_packets()` entries; the other entries are not used and may
+  // be nullptr. Returns false, and recovers nothing, if fewer than
+  // `num_media_packets()` payloads were received.
+  bool Decode(rtc::ArrayView<const uint8_t* const> packets,
+              size_t length,
+              rtc::ArrayView<uint8_t* const> recovered) const;
+
+ private:
+  const int num_media_packets_;
+  const int num_fec_packets_;
+  // Row-major `num_fec_packets_` x `num_media_packets_` encoding matrix.
+  std::vector<uint8_t> cauchy_matrix_;
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_RTP_RTCP_SOURCE_REED_SOLOMON_ERASURE_CODE_H_
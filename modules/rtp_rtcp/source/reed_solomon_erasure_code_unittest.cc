@@ -0,0 +1,144 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/rtp_rtcp/source/reed_solomon_erasure_code.h"
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "rtc_base/random.h"
+#include "test/gmock.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+using ::testing::ElementsAreArray;
+
+constexpr size_t kPayloadLength = 100;
+
+class ReedSolomonErasureCodeTest : public ::testing::Test {
+ protected:
+  ReedSolomonErasureCodeTest() : random_(0xfec133700742) {}
+
+  // Generates random media payloads and encodes them with `code`.
+  void GeneratePackets(const ReedSolomonErasureCode& code) {
+    const int num_packets = code.num_media_packets() + code.num_fec_packets();
+    payloads_.assign(num_packets, std::vector<uint8_t>(kPayloadLength));
+    for (int i = 0; i < code.num_media_packets(); ++i) {
+      for (uint8_t& byte : payloads_[i]) {
+        byte = random_.Rand<uint8_t>();
+      }
+    }
+    std::vector<const uint8_t*> media;
+    std::vector<uint8_t*> fec;
+    for (int i = 0; i < num_packets; ++i) {
+      if (i < code.num_media_packets()) {
+        media.push_back(payloads_[i].data());
+      } else {
+        fec.push_back(payloads_[i].data());
+      }
+    }
+    code.Encode(media, kPayloadLength, fec);
+  }
+
+  // Decodes with the packets in `lost` missing. Returns whether decoding
+  // succeeded, and if so, expects the lost media payloads to be recovered.
+  bool DecodeWithLosses(const ReedSolomonErasureCode& code,
+                        const std::vector<bool>& lost) {
+    std::vector<const uint8_t*> packets;
+    for (size_t i = 0; i < payloads_.size(); ++i) {
+      packets.push_back(lost[i] ? nullptr : payloads_[i].data());
+    }
+    std::vector<std::vector<uint8_t>> recovered(
+        code.num_media_packets(), std::vector<uint8_t>(kPayloadLength));
+    std::vector<uint8_t*> recovered_pointers;
+    for (std::vector<uint8_t>& payload : recovered) {
+      recovered_pointers.push_back(payload.data());
+    }
+    if (!code.Decode(packets, kPayloadLength, recovered_pointers)) {
+      return false;
+    }
+    for (int i = 0; i < code.num_media_packets(); ++i) {
+      if (lost[i]) {
+        EXPECT_THAT(recovered[i], ElementsAreArray(payloads_[i]))
+            << "Media packet " << i;
+      }
+    }
+    return true;
+  }
+
+  Random random_;
+  std::vector<std::vector<uint8_t>> payloads_;
+};
+
+TEST_F(ReedSolomonErasureCodeTest, SingleMediaPacketSingleFecPacket) {
+  ReedSolomonErasureCode code(1, 1);
+  GeneratePackets(code);
+  EXPECT_TRUE(DecodeWithLosses(code, {true, false}));
+  EXPECT_TRUE(DecodeWithLosses(code, {false, true}));
+  EXPECT_FALSE(DecodeWithLosses(code, {true, true}));
+}
+
+TEST_F(ReedSolomonErasureCodeTest, NoLossNeedsNoFec) {
+  ReedSolomonErasureCode code(4, 2);
+  GeneratePackets(code);
+  EXPECT_TRUE(DecodeWithLosses(code, {false, false, false, false, true, true}));
+}
+
+TEST_F(ReedSolomonErasureCodeTest, RecoversFromEveryMaximalLossPattern) {
+  constexpr int kNumMedia = 5;
+  constexpr int kNumFec = 3;
+  constexpr int kNumPackets = kNumMedia + kNumFec;
+  ReedSolomonErasureCode code(kNumMedia, kNumFec);
+  GeneratePackets(code);
+  for (int pattern = 0; pattern < (1 << kNumPackets); ++pattern) {
+    std::vector<bool> lost(kNumPackets);
+    int num_lost = 0;
+    for (int i = 0; i < kNumPackets; ++i) {
+      lost[i] = (pattern >> i) & 1;
+      num_lost += lost[i];
+    }
+    EXPECT_EQ(DecodeWithLosses(code, lost), num_lost <= kNumFec)
+        << "Loss pattern " << pattern;
+  }
+}
+
+TEST_F(ReedSolomonErasureCodeTest, RecoversBurstLoss) {
+  constexpr int kNumMedia = 48;
+  constexpr int kNumFec = 12;
+  ReedSolomonErasureCode code(kNumMedia, kNumFec);
+  GeneratePackets(code);
+  for (int first_lost = 0; first_lost + kNumFec <= kNumMedia; ++first_lost) {
+    std::vector<bool> lost(kNumMedia + kNumFec);
+    for (int i = first_lost; i < first_lost + kNumFec; ++i) {
+      lost[i] = true;
+    }
+    EXPECT_TRUE(DecodeWithLosses(code, lost));
+    lost[kNumMedia] = true;
+    EXPECT_FALSE(DecodeWithLosses(code, lost));
+  }
+}
+
+TEST_F(ReedSolomonErasureCodeTest, RecoversWithMaxPackets) {
+  constexpr int kNumMedia = ReedSolomonErasureCode::kMaxPackets - 16;
+  constexpr int kNumFec = 16;
+  ReedSolomonErasureCode code(kNumMedia, kNumFec);
+  GeneratePackets(code);
+  std::vector<bool> lost(kNumMedia + kNumFec);
+  for (int i = 0; i < kNumFec; ++i) {
+    lost[random_.Rand(kNumMedia - 1)] = true;
+  }
+  EXPECT_TRUE(DecodeWithLosses(code, lost));
+}
+
+}  // namespace
+}  // namespace webrtc
@@ -0,0 +1,259 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/rtp_rtcp/source/reed_solomon_fec_receiver.h"
+
+#include <string.h>
+
+#include <utility>
+
+#include "api/array_view.h"
+#include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
+#include "modules/rtp_rtcp/source/byte_io.h"
+#include "modules/rtp_rtcp/source/reed_solomon_erasure_code.h"
+#include "modules/rtp_rtcp/source/reed_solomon_fec_sender.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/logging.h"
+
+namespace webrtc {
+
+namespace {
+
+constexpr size_t kHeaderSize = ReedSolomonFecSender::kReedSolomonFecHeaderSize;
+
+// Size of the length prefix of the media symbols.
+constexpr size_t kMediaLengthSize = 2;
+
+// Media packets and FEC blocks older than this, in sequence numbers behind the
+// newest media packet, can no longer help recovery and are dropped.
+constexpr int64_t kMaxSequenceNumberAge = 512;
+
+}  // namespace
+
+ReedSolomonFecReceiver::ReedSolomonFecReceiver(
+    uint32_t ssrc,
+    uint32_t protected_media_ssrc,
+    RecoveredPacketReceiver* recovered_packet_receiver)
+    : ssrc_(ssrc),
+      protected_media_ssrc_(protected_media_ssrc),
+      recovered_packet_receiver_(recovered_packet_receiver) {
+  // It's OK to create this object on a different thread/task queue than
+  // the one used during main operation.
+  sequence_checker_.Detach();
+}
+
+ReedSolomonFecReceiver::~ReedSolomonFecReceiver() = default;
+
+void ReedSolomonFecReceiver::OnRtpPacket(const RtpPacketReceived& packet) {
+  RTC_DCHECK_RUN_ON(&sequence_checker_);
+
+  // Recovered packets are already stored by the recovery, see FlexfecReceiver
+  // for why they may be looped back here.
+  if (packet.recovered())
+    return;
+
+  if (packet.Ssrc() == ssrc_) {
+    ++packet_counter_.num_fec_packets;
+    OnFecPacket(packet);
+  } else if (packet.Ssrc() == protected_media_ssrc_) {
+    extensions_ = packet.extension_manager();
+    // Zero the mutable extensions, like the sender did, so that the media
+    // symbol matches the protected one.
+    RtpPacketReceived packet_copy(packet);
+    packet_copy.ZeroMutableExtensions();
+    InsertMediaPacket(media_seq_num_unwrapper_.Unwrap(packet.SequenceNumber()),
+                      packet_copy.Buffer());
+  } else {
+    return;
+  }
+  ++packet_counter_.num_packets;
+  packet_counter_.num_bytes += packet.size();
+  if (packet_counter_.first_packet_time.IsInfinite()) {
+    packet_counter_.first_packet_time = packet.arrival_time();
+  }
+  DropOldState();
+}
+
+FecPacketCounter ReedSolomonFecReceiver::GetPacketCounter() const {
+  RTC_DCHECK_RUN_ON(&sequence_checker_);
+  return packet_counter_;
+}
+
+void ReedSolomonFecReceiver::OnFecPacket(const RtpPacketReceived& packet) {
+  rtc::ArrayView<const uint8_t> payload = packet.payload();
+  if (payload.size() < kHeaderSize + kMediaLengthSize) {
+    RTC_LOG(LS_WARNING) << "Truncated Reed-Solomon FEC packet, discarding.";
+    return;
+  }
+  const uint16_t base_sequence_number =
+      ByteReader<uint16_t>::ReadBigEndian(&payload[0]);
+  const int num_media_packets = payload[2];
+  const int num_fec_packets = payload[3];
+  const int fec_index = payload[4];
+  const size_t symbol_length = ByteReader<uint16_t>::ReadBigEndian(&payload[6]);
+  if (num_media_packets == 0 || fec_index >= num_fec_packets ||
+      num_media_packets + num_fec_packets >
+          ReedSolomonErasureCode::kMaxPackets ||
+      symbol_length != payload.size() - kHeaderSize) {
+    RTC_LOG(LS_WARNING) << "Malformed Reed-Solomon FEC packet, discarding.";
+    return;
+  }
+
+  const int64_t base = media_seq_num_unwrapper_.Unwrap(base_sequence_number);
+  auto it = fec_blocks_.find(base);
+  if (it == fec_blocks_.end()) {
+    if (!media_packets_.empty() &&
+        base + num_media_packets <
+            media_packets_.rbegin()->first - kMaxSequenceNumberAge) {
+      // The block is too old to recover anything in time.
+      return;
+    }
+    it = fec_blocks_.emplace(base, FecBlock()).first;
+    it->second.num_media_packets = num_media_packets;
+    it->second.symbol_length = symbol_length;
+    it->second.fec_symbols.resize(num_fec_packets);
+  }
+  FecBlock& block = it->second;
+  if (block.num_media_packets != num_media_packets ||
+      block.symbol_length != symbol_length ||
+      block.fec_symbols.size() != static_cast<size_t>(num_fec_packets)) {
+    RTC_LOG(LS_WARNING) << "Reed-Solomon FEC packet does not match its block, "
+                           "discarding.";
+    return;
+  }
+  if (block.fec_symbols[fec_index].size() > 0) {
+    // Duplicate.
+    return;
+  }
+  block.fec_symbols[fec_index].SetData(&payload[kHeaderSize], symbol_length);
+  ++block.num_received_fec_packets;
+
+  if (TryRecover(base, block)) {
+    fec_blocks_.erase(it);
+  }
+}
+
+void ReedSolomonFecReceiver::InsertMediaPacket(int64_t sequence_number,
+                                               rtc::CopyOnWriteBuffer packet) {
+  if (!media_packets_.emplace(sequence_number, std::move(packet)).second) {
+    // Duplicate.
+    return;
+  }
+  // Blocks are ordered by their first sequence number, so only the ones
+  // starting at or before this packet may protect it.
+  for (auto it = fec_blocks_.begin();
+       it != fec_blocks_.end() && it->first <= sequence_number;) {
+    if (sequence_number < it->first + it->second.num_media_packets &&
+        TryRecover(it->first, it->second)) {
+      it = fec_blocks_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+bool ReedSolomonFecReceiver::TryRecover(int64_t base_sequence_number,
+                                        const FecBlock& block) {
+  const int num_media_packets = block.num_media_packets;
+  const int num_fec_packets = static_cast<int>(block.fec_symbols.size());
+  const size_t symbol_length = block.symbol_length;
+
+  std::vector<const rtc::CopyOnWriteBuffer*> media(num_media_packets, nullptr);
+  int num_received_media_packets = 0;
+  for (int i = 0; i < num_media_packets; ++i) {
+    auto it = media_packets_.find(base_sequence_number + i);
+    if (it != media_packets_.end()) {
+      media[i] = &it->second;
+      ++num_received_media_packets;
+    }
+  }
+  if (num_received_media_packets == num_media_packets) {
+    // Nothing was lost.
+    return true;
+  }
+  if (num_received_media_packets + block.num_received_fec_packets <
+      num_media_packets) {
+    return false;
+  }
+
+  // Rebuild the media symbols of the received packets.
+  std::vector<uint8_t> symbols(num_media_packets * symbol_length, 0);
+  std::vector<const uint8_t*> packets(num_media_packets + num_fec_packets,
+                                      nullptr);
+  std::vector<uint8_t*> recovered(num_media_packets, nullptr);
+  for (int i = 0; i < num_media_packets; ++i) {
+    uint8_t* symbol = &symbols[i * symbol_length];
+    if (!media[i]) {
+      recovered[i] = symbol;
+      continue;
+    }
+    if (kMediaLengthSize + media[i]->size() > symbol_length) {
+      RTC_LOG(LS_WARNING) << "Media packet does not fit its Reed-Solomon FEC "
+                             "block, dropping the block.";
+      return true;
+    }
+    ByteWriter<uint16_t>::WriteBigEndian(
+        symbol, static_cast<uint16_t>(media[i]->size()));
+    memcpy(symbol + kMediaLengthSize, media[i]->cdata(), media[i]->size());
+    packets[i] = symbol;
+  }
+  for (int i = 0; i < num_fec_packets; ++i) {
+    if (block.fec_symbols[i].size() > 0) {
+      packets[num_media_packets + i] = block.fec_symbols[i].cdata();
+    }
+  }
+  if (!ReedSolomonErasureCode(num_media_packets, num_fec_packets)
+           .Decode(packets, symbol_length, recovered)) {
+    return false;
+  }
+
+  for (int i = 0; i < num_media_packets; ++i) {
+    if (media[i]) {
+      continue;
+    }
+    const uint8_t* symbol = recovered[i];
+    const size_t length = ByteReader<uint16_t>::ReadBigEndian(symbol);
+    RtpPacketReceived parsed_packet(&extensions_);
+    if (length < kRtpHeaderSize || kMediaLengthSize + length > symbol_length ||
+        !parsed_packet.Parse(symbol + kMediaLengthSize, length) ||
+        parsed_packet.Ssrc() != protected_media_ssrc_ ||
+        parsed_packet.SequenceNumber() !=
+            static_cast<uint16_t>(base_sequence_number + i)) {
+      RTC_LOG(LS_WARNING) << "Failed to recover a media packet from the "
+                             "Reed-Solomon FEC stream with SSRC: "
+                          << ssrc_;
+      continue;
+    }
+    parsed_packet.set_recovered(true);
+    parsed_packet.set_payload_type_frequency(kVideoPayloadTypeFrequency);
+    ++packet_counter_.num_recovered_packets;
+    media_packets_.emplace(base_sequence_number + i, parsed_packet.Buffer());
+    recovered_packet_receiver_->OnRecoveredPacket(parsed_packet);
+  }
+  return true;
+}
+
+void ReedSolomonFecReceiver::DropOldState() {
+  if (media_packets_.empty()) {
+    return;
+  }
+  const int64_t oldest = media_packets_.rbegin()->first - kMaxSequenceNumberAge;
+  while (!media_packets_.empty() && media_packets_.begin()->first < oldest) {
+    media_packets_.erase(media_packets_.begin());
+  }
+  while (!fec_blocks_.empty() &&
+         fec_blocks_.begin()->first + fec_blocks_.begin()->second
+                                          .num_media_packets <
+             oldest) {
+    fec_blocks_.erase(fec_blocks_.begin());
+  }
+}
+
+}  // namespace webrtc
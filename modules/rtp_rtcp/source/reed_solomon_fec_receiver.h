@@ -0,0 +1,90 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_RTP_RTCP_SOURCE_REED_SOLOMON_FEC_RECEIVER_H_
+#define MODULES_RTP_RTCP_SOURCE_REED_SOLOMON_FEC_RECEIVER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <map>
+#include <vector>
+
+#include "api/sequence_checker.h"
+#include "modules/rtp_rtcp/include/recovered_packet_receiver.h"
+#include "modules/rtp_rtcp/include/rtp_header_extension_map.h"
+#include "modules/rtp_rtcp/source/rtp_packet_received.h"
+#include "modules/rtp_rtcp/source/ulpfec_receiver.h"
+#include "rtc_base/copy_on_write_buffer.h"
+#include "rtc_base/numerics/sequence_number_unwrapper.h"
+#include "rtc_base/system/no_unique_address.h"
+#include "rtc_base/thread_annotations.h"
+
+namespace webrtc {
+
+// Recovers the media packets protected by a ReedSolomonFecSender. See
+// reed_solomon_fec_sender.h for the packet format.
+class ReedSolomonFecReceiver {
+ public:
+  ReedSolomonFecReceiver(uint32_t ssrc,
+                         uint32_t protected_media_ssrc,
+                         RecoveredPacketReceiver* recovered_packet_receiver);
+  ~ReedSolomonFecReceiver();
+
+  // Inserts a received packet, which can be either media or FEC. All newly
+  // recovered packets are sent back through the callback.
+  void OnRtpPacket(const RtpPacketReceived& packet);
+
+  // Returns a counter describing the added and recovered packets.
+  FecPacketCounter GetPacketCounter() const;
+
+ private:
+  struct FecBlock {
+    int num_media_packets = 0;
+    size_t symbol_length = 0;
+    // FEC symbols by FEC index, of zero size if not received.
+    std::vector<rtc::CopyOnWriteBuffer> fec_symbols;
+    int num_received_fec_packets = 0;
+  };
+
+  void OnFecPacket(const RtpPacketReceived& packet)
+      RTC_RUN_ON(sequence_checker_);
+  void InsertMediaPacket(int64_t sequence_number,
+                         rtc::CopyOnWriteBuffer packet)
+      RTC_RUN_ON(sequence_checker_);
+  // Recovers the lost media packets of the block if enough packets have been
+  // received. Returns true if the block is complete and can be dropped.
+  bool TryRecover(int64_t base_sequence_number, const FecBlock& block)
+      RTC_RUN_ON(sequence_checker_);
+  void DropOldState() RTC_RUN_ON(sequence_checker_);
+
+  // Config.
+  const uint32_t ssrc_;
+  const uint32_t protected_media_ssrc_;
+  RecoveredPacketReceiver* const recovered_packet_receiver_;
+
+  // Media packets of the protected stream and pending FEC blocks, by unwrapped
+  // sequence number of the media packet and of the block's first media packet.
+  SeqNumUnwrapper<uint16_t> media_seq_num_unwrapper_
+      RTC_GUARDED_BY(sequence_checker_);
+  std::map<int64_t, rtc::CopyOnWriteBuffer> media_packets_
+      RTC_GUARDED_BY(sequence_checker_);
+  std::map<int64_t, FecBlock> fec_blocks_ RTC_GUARDED_BY(sequence_checker_);
+  // Extensions of the last media packet, used to parse recovered packets.
+  RtpHeaderExtensionMap extensions_ RTC_GUARDED_BY(sequence_checker_);
+
+  FecPacketCounter packet_counter_ RTC_GUARDED_BY(sequence_checker_);
+
+  RTC_NO_UNIQUE_ADDRESS SequenceChecker sequence_checker_;
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_RTP_RTCP_SOURCE_REED_SOLOMON_FEC_RECEIVER_H_
@@ -0,0 +1,282 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/rtp_rtcp/source/reed_solomon_fec_sender.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "absl/strings/string_view.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "modules/rtp_rtcp/source/byte_io.h"
+#include "modules/rtp_rtcp/source/reed_solomon_erasure_code.h"
+#include "modules/rtp_rtcp/source/rtp_header_extensions.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/logging.h"
+#include "system_wrappers/include/clock.h"
+
+namespace webrtc {
+
+namespace {
+
+// Let first sequence number be in the first half of the interval.
+constexpr uint16_t kMaxInitRtpSeqNumber = 0x7fff;
+
+// Size of the length prefix of the media symbols.
+constexpr size_t kMediaLengthSize = 2;
+
+// Same clock as the protected video stream, see FlexfecSender.
+constexpr int kMsToRtpTimestamp = kVideoPayloadTypeFrequency / 1000;
+
+// How often to log the generated FEC packets to the text log.
+constexpr TimeDelta kPacketLogInterval = TimeDelta::Seconds(10);
+
+RtpHeaderExtensionMap RegisterSupportedExtensions(
+    const std::vector<RtpExtension>& rtp_header_extensions) {
+  RtpHeaderExtensionMap map;
+  for (const auto& extension : rtp_header_extensions) {
+    if (extension.uri == TransportSequenceNumber::Uri()) {
+      map.Register<TransportSequenceNumber>(extension.id);
+    } else if (extension.uri == AbsoluteSendTime::Uri()) {
+      map.Register<AbsoluteSendTime>(extension.id);
+    } else if (extension.uri == TransmissionOffset::Uri()) {
+      map.Register<TransmissionOffset>(extension.id);
+    } else if (extension.uri == RtpMid::Uri()) {
+      map.Register<RtpMid>(extension.id);
+    } else {
+      RTC_LOG(LS_INFO)
+          << "ReedSolomonFecSender only supports RTP header extensions for "
+             "BWE and MID, so the extension "
+          << extension.ToString() << " will not be used.";
+    }
+  }
+  return map;
+}
+
+}  // namespace
+
+ReedSolomonFecSender::ReedSolomonFecSender(
+    int payload_type,
+    uint32_t ssrc,
+    uint32_t protected_media_ssrc,
+    absl::string_view mid,
+    const std::vector<RtpExtension>& rtp_header_extensions,
+    rtc::ArrayView<const RtpExtensionSize> extension_sizes,
+    const RtpState* rtp_state,
+    Clock* clock)
+    : clock_(clock),
+      random_(clock_->TimeInMicroseconds()),
+      payload_type_(payload_type),
+      timestamp_offset_(rtp_state ? rtp_state->start_timestamp
+                                  : random_.Rand<uint32_t>()),
+      ssrc_(ssrc),
+      protected_media_ssrc_(protected_media_ssrc),
+      mid_(mid),
+      seq_num_(rtp_state ? rtp_state->sequence_number
+                         : random_.Rand(1, kMaxInitRtpSeqNumber)),
+      rtp_header_extension_map_(
+          RegisterSupportedExtensions(rtp_header_extensions)),
+      header_extensions_size_(
+          RtpHeaderExtensionSize(extension_sizes, rtp_header_extension_map_)),
+      fec_bitrate_(/*max_window_size=*/TimeDelta::Seconds(1)) {
+  RTC_DCHECK_GE(payload_type, 0);
+  RTC_DCHECK_LE(payload_type, 127);
+}
+
+ReedSolomonFecSender::~ReedSolomonFecSender() = default;
+
+void ReedSolomonFecSender::SetProtectionParameters(
+    const FecProtectionParams& delta_params,
+    const FecProtectionParams& key_params) {
+  RTC_DCHECK_GE(delta_params.fec_rate, 0);
+  RTC_DCHECK_LE(delta_params.fec_rate, 255);
+  RTC_DCHECK_GE(key_params.fec_rate, 0);
+  RTC_DCHECK_LE(key_params.fec_rate, 255);
+  pending_params_.emplace(delta_params, key_params);
+}
+
+void ReedSolomonFecSender::AddPacketAndGenerateFec(
+    const RtpPacketToSend& packet) {
+  RTC_DCHECK_EQ(packet.Ssrc(), protected_media_ssrc_);
+  RTC_DCHECK(generated_fec_payloads_.empty());
+
+  // A block protects consecutive sequence numbers, so a gap ends the block.
+  if (!media_packets_.empty() &&
+      packet.SequenceNumber() !=
+          static_cast<uint16_t>(base_sequence_number_ +
+                                media_packets_.size())) {
+    GenerateFec();
+  }
+  if (media_packets_.empty()) {
+    if (pending_params_) {
+      delta_params_ = pending_params_->first;
+      key_params_ = pending_params_->second;
+      pending_params_.reset();
+    }
+    base_sequence_number_ = packet.SequenceNumber();
+  }
+
+  if (packet.is_key_frame()) {
+    block_contains_key_frame_ = true;
+  }
+  // The mutable extensions are only written after the FEC is generated, so
+  // they are protected as zeros, and zeroed again by the receiver.
+  RtpPacketToSend packet_copy(packet);
+  packet_copy.ZeroMutableExtensions();
+  media_packets_.push_back(packet_copy.Buffer());
+  if (packet.Marker()) {
+    ++num_protected_frames_;
+  }
+
+  const int max_fec_frames = std::max(CurrentParams().max_fec_frames, 1);
+  if ((packet.Marker() && num_protected_frames_ >= max_fec_frames) ||
+      media_packets_.size() == kMaxMediaPackets) {
+    GenerateFec();
+  }
+}
+
+const FecProtectionParams& ReedSolomonFecSender::CurrentParams() const {
+  return block_contains_key_frame_ ? key_params_ : delta_params_;
+}
+
+void ReedSolomonFecSender::GenerateFec() {
+  const size_t num_media_packets = media_packets_.size();
+  // Same rounding of the Q8 FEC rate as ForwardErrorCorrection.
+  const size_t num_fec_packets =
+      std::min((num_media_packets * CurrentParams().fec_rate + (1 << 7)) >> 8,
+               kMaxMediaPackets);
+  if (num_media_packets == 0 || num_fec_packets == 0) {
+    ResetBlock();
+    return;
+  }
+
+  size_t symbol_length = 0;
+  for (const rtc::CopyOnWriteBuffer& media_packet : media_packets_) {
+    symbol_length =
+        std::max(symbol_length, kMediaLengthSize + media_packet.size());
+  }
+  std::vector<uint8_t> media_symbols(num_media_packets * symbol_length, 0);
+  std::vector<const uint8_t*> media(num_media_packets);
+  for (size_t i = 0; i < num_media_packets; ++i) {
+    uint8_t* symbol = &media_symbols[i * symbol_length];
+    ByteWriter<uint16_t>::WriteBigEndian(
+        symbol, static_cast<uint16_t>(media_packets_[i].size()));
+    memcpy(symbol + kMediaLengthSize, media_packets_[i].cdata(),
+           media_packets_[i].size());
+    media[i] = symbol;
+  }
+
+  const size_t first_fec_payload = generated_fec_payloads_.size();
+  for (size_t i = 0; i < num_fec_packets; ++i) {
+    generated_fec_payloads_.emplace_back(kReedSolomonFecHeaderSize +
+                                         symbol_length);
+    uint8_t* payload = generated_fec_payloads_.back().MutableData();
+    ByteWriter<uint16_t>::WriteBigEndian(&payload[0], base_sequence_number_);
+    payload[2] = static_cast<uint8_t>(num_media_packets);
+    payload[3] = static_cast<uint8_t>(num_fec_packets);
+    payload[4] = static_cast<uint8_t>(i);
+    payload[5] = 0;
+    ByteWriter<uint16_t>::WriteBigEndian(&payload[6],
+                                         static_cast<uint16_t>(symbol_length));
+  }
+  // Take the pointers once all payloads are allocated.
+  std::vector<uint8_t*> fec(num_fec_packets);
+  for (size_t i = 0; i < num_fec_packets; ++i) {
+    fec[i] = generated_fec_payloads_[first_fec_payload + i].MutableData() +
+             kReedSolomonFecHeaderSize;
+  }
+  ReedSolomonErasureCode(num_media_packets, num_fec_packets)
+      .Encode(media, symbol_length, fec);
+
+  ResetBlock();
+}
+
+void ReedSolomonFecSender::ResetBlock() {
+  media_packets_.clear();
+  num_protected_frames_ = 0;
+  block_contains_key_frame_ = false;
+}
+
+std::vector<std::unique_ptr<RtpPacketToSend>>
+ReedSolomonFecSender::GetFecPackets() {
+  std::vector<std::unique_ptr<RtpPacketToSend>> fec_packets_to_send;
+  fec_packets_to_send.reserve(generated_fec_payloads_.size());
+  size_t total_fec_data_bytes = 0;
+  for (const rtc::CopyOnWriteBuffer& fec_payload : generated_fec_payloads_) {
+    auto fec_packet_to_send =
+        std::make_unique<RtpPacketToSend>(&rtp_header_extension_map_);
+    fec_packet_to_send->set_packet_type(
+        RtpPacketMediaType::kForwardErrorCorrection);
+    fec_packet_to_send->set_allow_retransmission(false);
+
+    // RTP header.
+    fec_packet_to_send->SetMarker(false);
+    fec_packet_to_send->SetPayloadType(payload_type_);
+    fec_packet_to_send->SetSequenceNumber(seq_num_++);
+    fec_packet_to_send->SetTimestamp(
+        timestamp_offset_ +
+        static_cast<uint32_t>(kMsToRtpTimestamp *
+                              clock_->TimeInMilliseconds()));
+    fec_packet_to_send->set_capture_time(clock_->CurrentTime());
+    fec_packet_to_send->SetSsrc(ssrc_);
+    // Reserve extensions, if registered. These will be set by the RTPSender.
+    fec_packet_to_send->ReserveExtension<AbsoluteSendTime>();
+    fec_packet_to_send->ReserveExtension<TransmissionOffset>();
+    fec_packet_to_send->ReserveExtension<TransportSequenceNumber>();
+    if (!mid_.empty()) {
+      // This is a no-op if the MID header extension is not registered.
+      fec_packet_to_send->SetExtension<RtpMid>(mid_);
+    }
+
+    // RTP payload.
+    uint8_t* payload = fec_packet_to_send->AllocatePayload(fec_payload.size());
+    memcpy(payload, fec_payload.cdata(), fec_payload.size());
+
+    total_fec_data_bytes += fec_packet_to_send->size();
+    fec_packets_to_send.push_back(std::move(fec_packet_to_send));
+  }
+  generated_fec_payloads_.clear();
+
+  Timestamp now = clock_->CurrentTime();
+  if (!fec_packets_to_send.empty() &&
+      now - last_generated_packet_ > kPacketLogInterval) {
+    RTC_LOG(LS_VERBOSE) << "Generated " << fec_packets_to_send.size()
+                        << " Reed-Solomon FEC packets with payload type: "
+                        << payload_type_ << " and SSRC: " << ssrc_ << ".";
+    last_generated_packet_ = now;
+  }
+
+  MutexLock lock(&mutex_);
+  fec_bitrate_.Update(total_fec_data_bytes, now);
+
+  return fec_packets_to_send;
+}
+
+size_t ReedSolomonFecSender::MaxPacketOverhead() const {
+  return header_extensions_size_ + kReedSolomonFecHeaderSize +
+         kMediaLengthSize + kRtpHeaderSize;
+}
+
+DataRate ReedSolomonFecSender::CurrentFecRate() const {
+  MutexLock lock(&mutex_);
+  return fec_bitrate_.Rate(clock_->CurrentTime()).value_or(DataRate::Zero());
+}
+
+absl::optional<RtpState> ReedSolomonFecSender::GetRtpState() {
+  RtpState rtp_state;
+  rtp_state.sequence_number = seq_num_;
+  rtp_state.start_timestamp = timestamp_offset_;
+  return rtp_state;
+}
+
+}  // namespace webrtc
@@ -0,0 +1,147 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_RTP_RTCP_SOURCE_REED_SOLOMON_FEC_SENDER_H_
+#define MODULES_RTP_RTCP_SOURCE_REED_SOLOMON_FEC_SENDER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+#include "api/array_view.h"
+#include "api/rtp_parameters.h"
+#include "api/units/data_rate.h"
+#include "api/units/timestamp.h"
+#include "modules/include/module_fec_types.h"
+#include "modules/rtp_rtcp/include/rtp_header_extension_map.h"
+#include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
+#include "modules/rtp_rtcp/source/rtp_header_extension_size.h"
+#include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
+#include "modules/rtp_rtcp/source/video_fec_generator.h"
+#include "rtc_base/bitrate_tracker.h"
+#include "rtc_base/copy_on_write_buffer.h"
+#include "rtc_base/random.h"
+#include "rtc_base/synchronization/mutex.h"
+
+namespace webrtc {
+
+class Clock;
+
+// Protects a media stream with Cauchy Reed-Solomon FEC packets sent on a
+// separate SSRC, like FlexFEC. Each FEC packet carries a
+// `kReedSolomonFecHeaderSize` byte header followed by one FEC symbol:
+//
+//   0                   1                   2                   3
+//   0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
+//  +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//  |      Base sequence number     |   Num media   |    Num FEC    |
+//  +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//  |   FEC index   |   Reserved    |         Symbol length         |
+//  +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//
+// The block protects the media packets with the consecutive sequence numbers
+// starting at the base sequence number. The media symbol of a packet is its
+// 16 bit big-endian length followed by the whole RTP packet, zero padded to
+// the symbol length. Any `Num media` packets of a block recover all of its
+// media packets.
+//
+// Like FlexfecSender, this class is not thread safe and requires external
+// synchronization.
+class ReedSolomonFecSender : public VideoFecGenerator {
+ public:
+  static constexpr size_t kReedSolomonFecHeaderSize = 8;
+  // Maximum number of media packets protected by a block.
+  static constexpr size_t kMaxMediaPackets = 48;
+
+  ReedSolomonFecSender(int payload_type,
+                       uint32_t ssrc,
+                       uint32_t protected_media_ssrc,
+                       absl::string_view mid,
+                       const std::vector<RtpExtension>& rtp_header_extensions,
+                       rtc::ArrayView<const RtpExtensionSize> extension_sizes,
+                       const RtpState* rtp_state,
+                       Clock* clock);
+  ~ReedSolomonFecSender() override;
+
+  FecType GetFecType() const override {
+    return VideoFecGenerator::FecType::kReedSolomon;
+  }
+  absl::optional<uint32_t> FecSsrc() override { return ssrc_; }
+
+  // Sets the FEC rate and the max number of frames protected by a block. The
+  // mask type is not used, since every loss pattern is recoverable.
+  void SetProtectionParameters(const FecProtectionParams& delta_params,
+                               const FecProtectionParams& key_params) override;
+
+  // Adds a media packet to the current block. When the block is complete, its
+  // FEC packets are generated and stored until GetFecPackets() is called.
+  void AddPacketAndGenerateFec(const RtpPacketToSend& packet) override;
+
+  std::vector<std::unique_ptr<RtpPacketToSend>> GetFecPackets() override;
+
+  // The overhead is the BWE RTP header extensions, the FEC header, the media
+  // packet length prefix and the protected RTP header of the media packet.
+  size_t MaxPacketOverhead() const override;
+
+  DataRate CurrentFecRate() const override;
+
+  // Only called on the VideoSendStream queue, after operation has shut down.
+  absl::optional<RtpState> GetRtpState() override;
+
+ private:
+  const FecProtectionParams& CurrentParams() const;
+  void GenerateFec();
+  void ResetBlock();
+
+  // Utility.
+  Clock* const clock_;
+  Random random_;
+  Timestamp last_generated_packet_ = Timestamp::MinusInfinity();
+
+  // Config.
+  const int payload_type_;
+  const uint32_t timestamp_offset_;
+  const uint32_t ssrc_;
+  const uint32_t protected_media_ssrc_;
+  // MID value to send in the MID header extension.
+  const std::string mid_;
+  // Sequence number of next packet to generate.
+  uint16_t seq_num_;
+  const RtpHeaderExtensionMap rtp_header_extension_map_;
+  const size_t header_extensions_size_;
+
+  // Protection parameters, applied from the start of the next block.
+  absl::optional<std::pair<FecProtectionParams, FecProtectionParams>>
+      pending_params_;
+  FecProtectionParams delta_params_;
+  FecProtectionParams key_params_;
+
+  // Current block.
+  std::vector<rtc::CopyOnWriteBuffer> media_packets_;
+  uint16_t base_sequence_number_ = 0;
+  int num_protected_frames_ = 0;
+  bool block_contains_key_frame_ = false;
+
+  // FEC payloads of the last completed block, without RTP header.
+  std::vector<rtc::CopyOnWriteBuffer> generated_fec_payloads_;
+
+  mutable Mutex mutex_;
+  BitrateTracker fec_bitrate_ RTC_GUARDED_BY(mutex_);
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_RTP_RTCP_SOURCE_REED_SOLOMON_FEC_SENDER_H_
@@ -0,0 +1,205 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <memory>
+#include <vector>
+
+#include "api/rtp_parameters.h"
+#include "modules/rtp_rtcp/mocks/mock_recovered_packet_receiver.h"
+#include "modules/rtp_rtcp/source/reed_solomon_fec_receiver.h"
+#include "modules/rtp_rtcp/source/reed_solomon_fec_sender.h"
+#include "modules/rtp_rtcp/source/rtp_packet_received.h"
+#include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
+#include "rtc_base/random.h"
+#include "system_wrappers/include/clock.h"
+#include "test/gmock.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+using ::testing::_;
+using ::testing::Property;
+
+constexpr int kFecPayloadType = 123;
+constexpr int kMediaPayloadType = 96;
+constexpr uint32_t kMediaSsrc = 1234;
+constexpr uint32_t kFecSsrc = 5678;
+constexpr uint16_t kFirstSequenceNumber = 65530;
+const char kNoMid[] = "";
+const std::vector<RtpExtension> kNoRtpHeaderExtensions;
+const std::vector<RtpExtensionSize> kNoRtpHeaderExtensionSizes;
+
+class ReedSolomonFecTest : public ::testing::Test {
+ protected:
+  ReedSolomonFecTest()
+      : clock_(1),
+        random_(1234),
+        sender_(kFecPayloadType,
+                kFecSsrc,
+                kMediaSsrc,
+                kNoMid,
+                kNoRtpHeaderExtensions,
+                kNoRtpHeaderExtensionSizes,
+                /*rtp_state=*/nullptr,
+                &clock_),
+        receiver_(kFecSsrc, kMediaSsrc, &recovered_packet_receiver_) {}
+
+  void SetFecRate(int fec_rate, int max_fec_frames) {
+    FecProtectionParams params;
+    params.fec_rate = fec_rate;
+    params.max_fec_frames = max_fec_frames;
+    sender_.SetProtectionParameters(params, params);
+  }
+
+  // Sends a frame of `num_packets` media packets of random sizes through the
+  // FEC generator and returns the media packets.
+  std::vector<RtpPacketReceived> SendFrame(int num_packets) {
+    std::vector<RtpPacketReceived> media_packets;
+    for (int i = 0; i < num_packets; ++i) {
+      RtpPacketToSend packet(/*extensions=*/nullptr);
+      packet.SetPayloadType(kMediaPayloadType);
+      packet.SetSsrc(kMediaSsrc);
+      packet.SetSequenceNumber(sequence_number_++);
+      packet.SetTimestamp(timestamp_);
+      packet.SetMarker(i == num_packets - 1);
+      const size_t payload_size = random_.Rand(1, 1000);
+      uint8_t* payload = packet.AllocatePayload(payload_size);
+      for (size_t j = 0; j < payload_size; ++j) {
+        payload[j] = random_.Rand<uint8_t>();
+      }
+      sender_.AddPacketAndGenerateFec(packet);
+      for (auto& fec_packet : sender_.GetFecPackets()) {
+        fec_packets_.push_back(std::move(fec_packet));
+      }
+      media_packets.emplace_back();
+      EXPECT_TRUE(media_packets.back().Parse(packet.Buffer()));
+    }
+    timestamp_ += 3000;
+    return media_packets;
+  }
+
+  void ReceiveFecPackets() {
+    for (const auto& fec_packet : fec_packets_) {
+      RtpPacketReceived packet;
+      ASSERT_TRUE(packet.Parse(fec_packet->Buffer()));
+      receiver_.OnRtpPacket(packet);
+    }
+    fec_packets_.clear();
+  }
+
+  SimulatedClock clock_;
+  Random random_;
+  uint16_t sequence_number_ = kFirstSequenceNumber;
+  uint32_t timestamp_ = 0;
+  ReedSolomonFecSender sender_;
+  std::vector<std::unique_ptr<RtpPacketToSend>> fec_packets_;
+  MockRecoveredPacketReceiver recovered_packet_receiver_;
+  ReedSolomonFecReceiver receiver_;
+};
+
+TEST_F(ReedSolomonFecTest, NoFecPacketsAtZeroRate) {
+  SetFecRate(/*fec_rate=*/0, /*max_fec_frames=*/1);
+  SendFrame(10);
+  EXPECT_TRUE(fec_packets_.empty());
+}
+
+TEST_F(ReedSolomonFecTest, GeneratesFecPacketsAtEndOfBlock) {
+  // 50% protection over two frames.
+  SetFecRate(/*fec_rate=*/128, /*max_fec_frames=*/2);
+  SendFrame(4);
+  EXPECT_TRUE(fec_packets_.empty());
+  SendFrame(4);
+  ASSERT_EQ(fec_packets_.size(), 4u);
+  for (size_t i = 0; i < fec_packets_.size(); ++i) {
+    EXPECT_EQ(fec_packets_[i]->Ssrc(), kFecSsrc);
+    EXPECT_EQ(fec_packets_[i]->PayloadType(), kFecPayloadType);
+    EXPECT_EQ(fec_packets_[i]->packet_type(),
+              RtpPacketMediaType::kForwardErrorCorrection);
+    EXPECT_EQ(fec_packets_[i]->SequenceNumber(),
+              static_cast<uint16_t>(fec_packets_[0]->SequenceNumber() + i));
+  }
+}
+
+TEST_F(ReedSolomonFecTest, RecoversBurstLoss) {
+  // 4 FEC packets for 10 media packets.
+  SetFecRate(/*fec_rate=*/102, /*max_fec_frames=*/1);
+  std::vector<RtpPacketReceived> media_packets = SendFrame(10);
+  ASSERT_EQ(fec_packets_.size(), 4u);
+
+  // Lose four consecutive media packets, which XOR parity masks of this size
+  // typically cannot recover.
+  for (size_t i = 0; i < media_packets.size(); ++i) {
+    if (i < 3 || i > 6) {
+      receiver_.OnRtpPacket(media_packets[i]);
+    }
+  }
+  for (size_t i = 3; i <= 6; ++i) {
+    EXPECT_CALL(
+        recovered_packet_receiver_,
+        OnRecoveredPacket(Property(&RtpPacketReceived::Buffer,
+                                   media_packets[i].Buffer())));
+  }
+  ReceiveFecPackets();
+
+  EXPECT_EQ(receiver_.GetPacketCounter().num_recovered_packets, 4u);
+}
+
+TEST_F(ReedSolomonFecTest, RecoversFromFecPacketsReceivedFirst) {
+  SetFecRate(/*fec_rate=*/128, /*max_fec_frames=*/1);
+  std::vector<RtpPacketReceived> media_packets = SendFrame(6);
+  ASSERT_EQ(fec_packets_.size(), 3u);
+
+  ReceiveFecPackets();
+  EXPECT_CALL(recovered_packet_receiver_,
+              OnRecoveredPacket(Property(&RtpPacketReceived::Buffer,
+                                         media_packets[0].Buffer())));
+  EXPECT_CALL(recovered_packet_receiver_,
+              OnRecoveredPacket(Property(&RtpPacketReceived::Buffer,
+                                         media_packets[1].Buffer())));
+  EXPECT_CALL(recovered_packet_receiver_,
+              OnRecoveredPacket(Property(&RtpPacketReceived::Buffer,
+                                         media_packets[5].Buffer())));
+  for (size_t i = 2; i < 5; ++i) {
+    receiver_.OnRtpPacket(media_packets[i]);
+  }
+}
+
+TEST_F(ReedSolomonFecTest, DoesNotRecoverWithTooFewPackets) {
+  SetFecRate(/*fec_rate=*/102, /*max_fec_frames=*/1);
+  std::vector<RtpPacketReceived> media_packets = SendFrame(10);
+  ASSERT_EQ(fec_packets_.size(), 4u);
+
+  for (size_t i = 5; i < media_packets.size(); ++i) {
+    receiver_.OnRtpPacket(media_packets[i]);
+  }
+  EXPECT_CALL(recovered_packet_receiver_, OnRecoveredPacket(_)).Times(0);
+  ReceiveFecPackets();
+}
+
+TEST_F(ReedSolomonFecTest, SequenceNumberGapEndsBlock) {
+  SetFecRate(/*fec_rate=*/255, /*max_fec_frames=*/2);
+  std::vector<RtpPacketReceived> media_packets = SendFrame(2);
+  EXPECT_TRUE(fec_packets_.empty());
+  // Skip a sequence number, as a padding packet would.
+  ++sequence_number_;
+  SendFrame(1);
+  // The first block ends at the gap, before its second frame.
+  ASSERT_EQ(fec_packets_.size(), 2u);
+
+  receiver_.OnRtpPacket(media_packets[1]);
+  EXPECT_CALL(recovered_packet_receiver_,
+              OnRecoveredPacket(Property(&RtpPacketReceived::Buffer,
+                                         media_packets[0].Buffer())));
+  ReceiveFecPackets();
+}
+
+}  // namespace
+}  // namespace webrtc
@@ -108,5 +108,15 @@ bool ReceiverReport::SetReportBlocks(std::vector<ReportBlock> blocks) {
   return true;
 }
 
+bool ReceiverReport::SetReportBlocks(rtc::ArrayView<const ReportBlock> blocks) {
+  if (blocks.size() > kMaxNumberOfReportBlocks) {
+    RTC_LOG(LS_WARNING) << "Too many report blocks (" << blocks.size()
+                        << ") for receiver report.";
+    return false;
+  }
+  report_blocks_.assign(blocks.begin(), blocks.end());
+  return true;
+}
+
 }  // namespace rtcp
 }  // namespace webrtc
@@ -16,6 +16,7 @@
 
 #include <vector>
 
+#include "api/array_view.h"
 #include "modules/rtp_rtcp/source/rtcp_packet.h"
 #include "modules/rtp_rtcp/source/rtcp_packet/report_block.h"
 
@@ -37,6 +38,9 @@ class ReceiverReport : public RtcpPacket {
 
   bool AddReportBlock(const ReportBlock& block);
   bool SetReportBlocks(std::vector<ReportBlock> blocks);
+  // Copies `blocks` into the already allocated storage, so that a report
+  // reused for several packets does not reallocate it for each of them.
+  bool SetReportBlocks(rtc::ArrayView<const ReportBlock> blocks);
 
   const std::vector<ReportBlock>& report_blocks() const {
     return report_blocks_;
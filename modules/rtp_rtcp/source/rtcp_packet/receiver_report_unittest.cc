@@ -158,4 +158,28 @@ TEST(RtcpPacketReceiverReportTest, SetReportBlocksMaxLimit) {
   EXPECT_FALSE(rr.SetReportBlocks(std::move(one_too_many_blocks)));
 }
 
+TEST(RtcpPacketReceiverReportTest, SetReportBlocksFromArrayViewReplacesBlocks) {
+  std::vector<ReportBlock> blocks(4u);
+  for (size_t i = 0; i < blocks.size(); ++i) {
+    blocks[i].SetJitter(1001u + i);
+  }
+  ReceiverReport rr;
+  EXPECT_TRUE(rr.SetReportBlocks(rtc::ArrayView<const ReportBlock>(blocks)));
+  EXPECT_EQ(rr.report_blocks().size(), 4u);
+
+  EXPECT_TRUE(rr.SetReportBlocks(
+      rtc::ArrayView<const ReportBlock>(blocks).subview(2, 2)));
+  ASSERT_EQ(rr.report_blocks().size(), 2u);
+  EXPECT_EQ(rr.report_blocks()[0].jitter(), 1003u);
+  EXPECT_EQ(rr.report_blocks()[1].jitter(), 1004u);
+
+  EXPECT_TRUE(rr.SetReportBlocks(rtc::ArrayView<const ReportBlock>()));
+  EXPECT_THAT(rr.report_blocks(), IsEmpty());
+
+  std::vector<ReportBlock> one_too_many_blocks(
+      ReceiverReport::kMaxNumberOfReportBlocks + 1);
+  EXPECT_FALSE(rr.SetReportBlocks(
+      rtc::ArrayView<const ReportBlock>(one_too_many_blocks)));
+}
+
 }  // namespace webrtc
@@ -137,5 +137,15 @@ bool SenderReport::SetReportBlocks(std::vector<ReportBlock> blocks) {
   return true;
 }
 
+bool SenderReport::SetReportBlocks(rtc::ArrayView<const ReportBlock> blocks) {
+  if (blocks.size() > kMaxNumberOfReportBlocks) {
+    RTC_LOG(LS_WARNING) << "Too many report blocks (" << blocks.size()
+                        << ") for sender report.";
+    return false;
+  }
+  report_blocks_.assign(blocks.begin(), blocks.end());
+  return true;
+}
+
 }  // namespace rtcp
 }  // namespace webrtc
@@ -13,6 +13,7 @@
 
 #include <vector>
 
+#include "api/array_view.h"
 #include "modules/rtp_rtcp/source/rtcp_packet.h"
 #include "modules/rtp_rtcp/source/rtcp_packet/report_block.h"
 #include "system_wrappers/include/ntp_time.h"
@@ -48,6 +49,9 @@ class SenderReport : public RtcpPacket {
   }
   bool AddReportBlock(const ReportBlock& block);
   bool SetReportBlocks(std::vector<ReportBlock> blocks);
+  // Copies `blocks` into the already allocated storage, so that a report
+  // reused for several packets does not reallocate it for each of them.
+  bool SetReportBlocks(rtc::ArrayView<const ReportBlock> blocks);
   void ClearReportBlocks() { report_blocks_.clear(); }
 
   NtpTime ntp() const { return ntp_; }
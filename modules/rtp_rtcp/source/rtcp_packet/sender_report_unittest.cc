@@ -17,6 +17,7 @@
 #include "test/rtcp_packet_parser.h"
 
 using ::testing::ElementsAreArray;
+using ::testing::IsEmpty;
 using ::testing::make_tuple;
 using webrtc::rtcp::ReportBlock;
 using webrtc::rtcp::SenderReport;
@@ -139,4 +140,28 @@ TEST(RtcpPacketSenderReportTest, SetReportBlocksMaxLimit) {
   EXPECT_FALSE(sr.SetReportBlocks(std::move(one_too_many_blocks)));
 }
 
+TEST(RtcpPacketSenderReportTest, SetReportBlocksFromArrayViewReplacesBlocks) {
+  std::vector<ReportBlock> blocks(4u);
+  for (size_t i = 0; i < blocks.size(); ++i) {
+    blocks[i].SetJitter(1001u + i);
+  }
+  SenderReport sr;
+  EXPECT_TRUE(sr.SetReportBlocks(rtc::ArrayView<const ReportBlock>(blocks)));
+  EXPECT_EQ(sr.report_blocks().size(), 4u);
+
+  EXPECT_TRUE(sr.SetReportBlocks(
+      rtc::ArrayView<const ReportBlock>(blocks).subview(2, 2)));
+  ASSERT_EQ(sr.report_blocks().size(), 2u);
+  EXPECT_EQ(sr.report_blocks()[0].jitter(), 1003u);
+  EXPECT_EQ(sr.report_blocks()[1].jitter(), 1004u);
+
+  EXPECT_TRUE(sr.SetReportBlocks(rtc::ArrayView<const ReportBlock>()));
+  EXPECT_THAT(sr.report_blocks(), IsEmpty());
+
+  std::vector<ReportBlock> one_too_many_blocks(
+      SenderReport::kMaxNumberOfReportBlocks + 1);
+  EXPECT_FALSE(sr.SetReportBlocks(
+      rtc::ArrayView<const ReportBlock>(one_too_many_blocks)));
+}
+
 }  // namespace webrtc
@@ -367,6 +367,13 @@ bool TransportFeedback::AddReceivedPacket(uint16_t sequence_number,
   return true;
 }
 
+void TransportFeedback::ReservePackets(size_t num_packets) {
+  num_packets = std::min(num_packets, kMaxReportedPackets);
+  received_packets_.reserve(num_packets);
+  // Status vector chunks with two bits per packet hold the fewest packets.
+  encoded_chunks_.reserve(num_packets / LastChunk::kMaxTwoBitCapacity + 1);
+}
+
 const std::vector<TransportFeedback::ReceivedPacket>&
 TransportFeedback::GetReceivedPackets() const {
   return received_packets_;
@@ -67,6 +67,10 @@ class TransportFeedback : public Rtpfb {
   bool AddReceivedPacket(uint16_t sequence_number, Timestamp timestamp);
   const std::vector<ReceivedPacket>& GetReceivedPackets() const;
 
+  // Reserves memory for `num_packets` consecutive sequence numbers, so that
+  // adding that many packets with AddReceivedPacket() does not reallocate.
+  void ReservePackets(size_t num_packets);
+
   // Calls `handler` for all packets this feedback describes.
   // For received packets pass receieve time as `delta_since_base` since the
   // `BaseTime()`. For missed packets calls `handler` with `delta_since_base =
@@ -113,6 +117,7 @@ class TransportFeedback : public Rtpfb {
    public:
     using DeltaSize = TransportFeedback::DeltaSize;
     static constexpr size_t kMaxRunLengthCapacity = 0x1fff;
+    static constexpr size_t kMaxTwoBitCapacity = 7;
 
     LastChunk();
 
@@ -139,7 +144,6 @@ class TransportFeedback : public Rtpfb {
 
    private:
     static constexpr size_t kMaxOneBitCapacity = 14;
-    static constexpr size_t kMaxTwoBitCapacity = 7;
     static constexpr size_t kMaxVectorCapacity = kMaxOneBitCapacity;
     static constexpr DeltaSize kLarge = 2;
 
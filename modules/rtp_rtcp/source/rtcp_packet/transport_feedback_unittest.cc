@@ -624,6 +624,26 @@ TEST(RtcpPacketTest, TransportFeedbackMoveConstructor) {
   EXPECT_EQ(moved.Build(), feedback_copy.Build());
 }
 
+TEST(TransportFeedbackTest, ReservingPacketsDoesNotChangeFeedback) {
+  const uint16_t kBaseSeqNo = 65000;
+  const Timestamp kBaseTimestamp = Timestamp::Millis(10);
+  TransportFeedback feedback;
+  TransportFeedback reserved_feedback;
+  reserved_feedback.ReservePackets(1000);
+  for (TransportFeedback* builder : {&feedback, &reserved_feedback}) {
+    builder->SetBase(kBaseSeqNo, kBaseTimestamp);
+    // Mix small and large deltas with losses, so that every chunk type is
+    // used.
+    Timestamp arrival_time = kBaseTimestamp;
+    for (int i = 0; i < 1000; i += 1 + i % 3) {
+      arrival_time += (i % 11 == 0) ? 2 * kDeltaLimit : kDeltaLimit / 4;
+      EXPECT_TRUE(builder->AddReceivedPacket(kBaseSeqNo + i, arrival_time));
+    }
+    EXPECT_TRUE(builder->IsConsistent());
+  }
+  EXPECT_EQ(reserved_feedback.Build(), feedback.Build());
+}
+
 TEST(TransportFeedbackTest, ReportsMissingPackets) {
   const uint16_t kBaseSeqNo = 1000;
   const Timestamp kBaseTimestamp = Timestamp::Millis(10);
@@ -724,7 +724,7 @@ absl::optional<int32_t> RTCPSender::ComputeCompoundRTCPPacket(
     uint32_t rtcp_packet_type = it->type;
 
     if (it->is_volatile) {
-      report_flags_.erase(it++);
+      it = report_flags_.erase(it);
     } else {
       ++it;
     }
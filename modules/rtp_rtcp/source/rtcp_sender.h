@@ -13,7 +13,6 @@
 
 #include <map>
 #include <memory>
-#include <set>
 #include <string>
 #include <vector>
 
@@ -34,6 +33,8 @@
 #include "modules/rtp_rtcp/source/rtcp_packet/report_block.h"
 #include "modules/rtp_rtcp/source/rtcp_packet/tmmb_item.h"
 #include "modules/rtp_rtcp/source/rtp_rtcp_interface.h"
+#include "rtc_base/containers/flat_map.h"
+#include "rtc_base/containers/flat_set.h"
 #include "rtc_base/random.h"
 #include "rtc_base/synchronization/mutex.h"
 #include "rtc_base/thread_annotations.h"
@@ -317,15 +318,16 @@ class RTCPSender final {
         : type(type), is_volatile(is_volatile) {}
     bool operator<(const ReportFlag& flag) const { return type < flag.type; }
     bool operator==(const ReportFlag& flag) const { return type == flag.type; }
-    const uint32_t type;
-    const bool is_volatile;
+    uint32_t type;
+    bool is_volatile;
   };
 
-  std::set<ReportFlag> report_flags_ RTC_GUARDED_BY(mutex_rtcp_sender_);
+  // A flat set, since it is small and modified for every packet that is sent.
+  flat_set<ReportFlag> report_flags_ RTC_GUARDED_BY(mutex_rtcp_sender_);
 
   typedef void (RTCPSender::*BuilderFunc)(const RtcpContext&, PacketSender&);
   // Map from RTCPPacketType to builder.
-  std::map<uint32_t, BuilderFunc> builders_;
+  flat_map<uint32_t, BuilderFunc> builders_;
 };
 }  // namespace webrtc
 
@@ -16,6 +16,7 @@
 #include "absl/algorithm/container.h"
 #include "absl/memory/memory.h"
 #include "absl/types/optional.h"
+#include "api/array_view.h"
 #include "api/video/video_bitrate_allocation.h"
 #include "modules/rtp_rtcp/include/receive_statistics.h"
 #include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
@@ -649,8 +650,11 @@ std::vector<uint32_t> RtcpTransceiverImpl::FillReports(
       sender_report_size_bytes;
 
   auto last_handled_sender_it = local_senders_.end();
-  auto report_block_it = report_blocks.begin();
+  rtc::ArrayView<const rtcp::ReportBlock> remaining_blocks = report_blocks;
   std::vector<uint32_t> sender_ssrcs;
+  // Reused for all sender reports, so that only the report blocks are copied
+  // for each of them.
+  rtcp::SenderReport sender_report;
   for (auto it = local_senders_.begin();
        it != local_senders_.end() && sender_ssrcs.size() < max_sender_reports;
        ++it) {
@@ -669,7 +673,6 @@ std::vector<uint32_t> RtcpTransceiverImpl::FillReports(
     rtp_sender.last_num_sent_bytes = stats.num_sent_bytes();
 
     last_handled_sender_it = it;
-    rtcp::SenderReport sender_report;
     sender_report.SetSenderSsrc(rtp_sender.ssrc);
     sender_report.SetPacketCount(stats.num_sent_packets());
     sender_report.SetOctetCount(stats.num_sent_bytes());
@@ -679,15 +682,10 @@ std::vector<uint32_t> RtcpTransceiverImpl::FillReports(
         stats.last_rtp_timestamp() +
         ((now - stats.last_capture_time()) * stats.last_clock_rate())
             .seconds());
-    if (report_block_it != report_blocks.end()) {
-      size_t num_blocks =
-          std::min<size_t>(rtcp::SenderReport::kMaxNumberOfReportBlocks,
-                           report_blocks.end() - report_block_it);
-      std::vector<rtcp::ReportBlock> sub_blocks(report_block_it,
-                                                report_block_it + num_blocks);
-      sender_report.SetReportBlocks(std::move(sub_blocks));
-      report_block_it += num_blocks;
-    }
+    size_t num_blocks = std::min<size_t>(
+        rtcp::SenderReport::kMaxNumberOfReportBlocks, remaining_blocks.size());
+    sender_report.SetReportBlocks(remaining_blocks.subview(0, num_blocks));
+    remaining_blocks = remaining_blocks.subview(num_blocks);
     rtcp_sender.AppendPacket(sender_report);
     sender_ssrcs.push_back(rtp_sender.ssrc);
   }
@@ -702,7 +700,7 @@ std::vector<uint32_t> RtcpTransceiverImpl::FillReports(
 
   // Calculcate number of receiver reports to attach remaining report blocks to.
   size_t num_receiver_reports =
-      DivideRoundUp(report_blocks.end() - report_block_it,
+      DivideRoundUp(remaining_blocks.size(),
                     rtcp::ReceiverReport::kMaxNumberOfReportBlocks);
 
   // In compound mode each RTCP packet has to start with a sender or receiver
@@ -714,20 +712,18 @@ std::vector<uint32_t> RtcpTransceiverImpl::FillReports(
 
   uint32_t sender_ssrc =
       sender_ssrcs.empty() ? config_.feedback_ssrc : sender_ssrcs.front();
+  rtcp::ReceiverReport receiver_report;
+  receiver_report.SetSenderSsrc(sender_ssrc);
   for (size_t i = 0; i < num_receiver_reports; ++i) {
-    rtcp::ReceiverReport receiver_report;
-    receiver_report.SetSenderSsrc(sender_ssrc);
     size_t num_blocks =
         std::min<size_t>(rtcp::ReceiverReport::kMaxNumberOfReportBlocks,
-                         report_blocks.end() - report_block_it);
-    std::vector<rtcp::ReportBlock> sub_blocks(report_block_it,
-                                              report_block_it + num_blocks);
-    receiver_report.SetReportBlocks(std::move(sub_blocks));
-    report_block_it += num_blocks;
+                         remaining_blocks.size());
+    receiver_report.SetReportBlocks(remaining_blocks.subview(0, num_blocks));
+    remaining_blocks = remaining_blocks.subview(num_blocks);
     rtcp_sender.AppendPacket(receiver_report);
   }
   // All report blocks should be attached at this point.
-  RTC_DCHECK_EQ(report_blocks.end() - report_block_it, 0);
+  RTC_DCHECK(remaining_blocks.empty());
   return sender_ssrcs;
 }
 
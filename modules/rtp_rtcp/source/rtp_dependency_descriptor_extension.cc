@@ -33,6 +33,14 @@ bool RtpDependencyDescriptorExtension::Parse(
   return reader.ParseSuccessful();
 }
 
+bool RtpDependencyDescriptorExtension::Parse(
+    rtc::ArrayView<const uint8_t> data,
+    const FrameDependencyStructure* structure,
+    DependencyDescriptorForwardingInfo* info) {
+  RtpDependencyDescriptorReader reader(data, structure, info);
+  return reader.ParseSuccessful();
+}
+
 size_t RtpDependencyDescriptorExtension::ValueSize(
     const FrameDependencyStructure& structure,
     std::bitset<32> active_chains,
@@ -12,14 +12,32 @@
 
 #include <bitset>
 #include <cstdint>
+#include <memory>
 
+#include "absl/container/inlined_vector.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
 #include "api/array_view.h"
 #include "api/rtp_parameters.h"
 #include "api/transport/rtp/dependency_descriptor.h"
 #include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
 
 namespace webrtc {
+
+// Fields of the dependency descriptor that are needed to select the decode
+// targets a packet is forwarded for. Frame and chain diffs are not needed for
+// that, and are not parsed.
+struct DependencyDescriptorForwardingInfo {
+  bool first_packet_in_frame = true;
+  bool last_packet_in_frame = true;
+  int frame_number = 0;
+  int spatial_id = 0;
+  int temporal_id = 0;
+  absl::InlinedVector<DecodeTargetIndication, 10> decode_target_indications;
+  absl::optional<uint32_t> active_decode_targets_bitmask;
+  std::unique_ptr<FrameDependencyStructure> attached_structure;
+};
+
 // Trait to read/write the dependency descriptor extension as described in
 // https://aomediacodec.github.io/av1-rtp-spec/#dependency-descriptor-rtp-header-extension
 class RtpDependencyDescriptorExtension {
@@ -32,6 +50,11 @@ class RtpDependencyDescriptorExtension {
   static bool Parse(rtc::ArrayView<const uint8_t> data,
                     const FrameDependencyStructure* structure,
                     DependencyDescriptor* descriptor);
+  // Parses only what is needed to forward the packet, which is cheaper than
+  // parsing the full descriptor.
+  static bool Parse(rtc::ArrayView<const uint8_t> data,
+                    const FrameDependencyStructure* structure,
+                    DependencyDescriptorForwardingInfo* info);
 
   static size_t ValueSize(const FrameDependencyStructure& structure,
                           const DependencyDescriptor& descriptor) {
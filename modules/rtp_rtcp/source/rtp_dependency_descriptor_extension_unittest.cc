@@ -10,6 +10,8 @@
 
 #include "modules/rtp_rtcp/source/rtp_dependency_descriptor_extension.h"
 
+#include <memory>
+
 #include "api/array_view.h"
 #include "api/transport/rtp/dependency_descriptor.h"
 #include "common_video/generic_frame_descriptor/generic_frame_info.h"
@@ -132,5 +134,70 @@ TEST(RtpDependencyDescriptorExtensionTest, FailsToWriteInvalidDescriptor) {
                                                        descriptor));
 }
 
+TEST(RtpDependencyDescriptorExtensionTest, ParsesForwardingInfo) {
+  uint8_t buffer[256];
+  FrameDependencyStructure structure;
+  structure.num_decode_targets = 3;
+  structure.num_chains = 1;
+  structure.decode_target_protected_by_chain = {0, 0, 0};
+  structure.templates = {
+      FrameDependencyTemplate().T(0).Dtis("SSS").ChainDiffs({0}),
+      FrameDependencyTemplate().T(1).Dtis("-DS").ChainDiffs({1})};
+  DependencyDescriptor descriptor;
+  descriptor.first_packet_in_frame = false;
+  descriptor.frame_number = 0x1234;
+  descriptor.frame_dependencies = structure.templates[1];
+  // Custom DTIs and frame diffs, so that both follow the mandatory fields.
+  descriptor.frame_dependencies.decode_target_indications[1] =
+      DecodeTargetIndication::kRequired;
+  descriptor.frame_dependencies.frame_diffs = {3, 5};
+  descriptor.active_decode_targets_bitmask = 0b011;
+  size_t value_size =
+      RtpDependencyDescriptorExtension::ValueSize(structure, descriptor);
+  ASSERT_TRUE(RtpDependencyDescriptorExtension::Write(
+      rtc::MakeArrayView(buffer, value_size), structure, descriptor));
+
+  DependencyDescriptorForwardingInfo info;
+  ASSERT_TRUE(RtpDependencyDescriptorExtension::Parse(
+      rtc::MakeArrayView(buffer, value_size), &structure, &info));
+  EXPECT_FALSE(info.first_packet_in_frame);
+  EXPECT_TRUE(info.last_packet_in_frame);
+  EXPECT_EQ(info.frame_number, 0x1234);
+  EXPECT_EQ(info.spatial_id, 0);
+  EXPECT_EQ(info.temporal_id, 1);
+  EXPECT_EQ(info.decode_target_indications,
+            descriptor.frame_dependencies.decode_target_indications);
+  EXPECT_EQ(info.active_decode_targets_bitmask, 0b011u);
+  EXPECT_EQ(info.attached_structure, nullptr);
+}
+
+TEST(RtpDependencyDescriptorExtensionTest,
+     ParsesForwardingInfoWithAttachedStructure) {
+  uint8_t buffer[256];
+  FrameDependencyStructure structure;
+  structure.num_decode_targets = 2;
+  structure.num_chains = 0;
+  structure.templates = {FrameDependencyTemplate().S(0).T(0).Dtis("SS"),
+                         FrameDependencyTemplate().S(1).T(0).Dtis("-S")};
+  DependencyDescriptor descriptor;
+  descriptor.frame_dependencies = structure.templates[1];
+  descriptor.attached_structure =
+      std::make_unique<FrameDependencyStructure>(structure);
+  size_t value_size =
+      RtpDependencyDescriptorExtension::ValueSize(structure, descriptor);
+  ASSERT_TRUE(RtpDependencyDescriptorExtension::Write(
+      rtc::MakeArrayView(buffer, value_size), structure, descriptor));
+
+  DependencyDescriptorForwardingInfo info;
+  ASSERT_TRUE(RtpDependencyDescriptorExtension::Parse(
+      rtc::MakeArrayView(buffer, value_size), nullptr, &info));
+  ASSERT_NE(info.attached_structure, nullptr);
+  EXPECT_EQ(*info.attached_structure, structure);
+  EXPECT_EQ(info.spatial_id, 1);
+  EXPECT_EQ(info.decode_target_indications,
+            structure.templates[1].decode_target_indications);
+  EXPECT_EQ(info.active_decode_targets_bitmask, 0b11u);
+}
+
 }  // namespace
 }  // namespace webrtc
@@ -25,20 +25,42 @@ RtpDependencyDescriptorReader::RtpDependencyDescriptorReader(
     DependencyDescriptor* descriptor)
     : descriptor_(descriptor), buffer_(raw_data) {
   RTC_DCHECK(descriptor);
+  ReadDescriptor(structure);
+}
+
+RtpDependencyDescriptorReader::RtpDependencyDescriptorReader(
+    rtc::ArrayView<const uint8_t> raw_data,
+    const FrameDependencyStructure* structure,
+    DependencyDescriptorForwardingInfo* info)
+    : descriptor_(&forwarding_descriptor_),
+      forwarding_info_(info),
+      buffer_(raw_data) {
+  RTC_DCHECK(info);
+  ReadDescriptor(structure);
+  info->first_packet_in_frame = forwarding_descriptor_.first_packet_in_frame;
+  info->last_packet_in_frame = forwarding_descriptor_.last_packet_in_frame;
+  info->frame_number = forwarding_descriptor_.frame_number;
+  info->active_decode_targets_bitmask =
+      forwarding_descriptor_.active_decode_targets_bitmask;
+  info->attached_structure =
+      std::move(forwarding_descriptor_.attached_structure);
+}
 
+void RtpDependencyDescriptorReader::ReadDescriptor(
+    const FrameDependencyStructure* structure) {
   ReadMandatoryFields();
-  if (raw_data.size() > 3)
+  if (buffer_.RemainingBitCount() > 0)
     ReadExtendedFields();
 
-  structure_ = descriptor->attached_structure
-                   ? descriptor->attached_structure.get()
+  structure_ = descriptor_->attached_structure
+                   ? descriptor_->attached_structure.get()
                    : structure;
   if (structure_ == nullptr) {
     buffer_.Invalidate();
     return;
   }
   if (active_decode_targets_present_flag_) {
-    descriptor->active_decode_targets_bitmask =
+    descriptor_->active_decode_targets_bitmask =
         buffer_.ReadBits(structure_->num_decode_targets);
   }
 
@@ -188,6 +210,22 @@ void RtpDependencyDescriptorReader::ReadFrameDependencyDefinition() {
     return;
   }
 
+  if (forwarding_info_ != nullptr) {
+    const FrameDependencyTemplate& frame_template =
+        structure_->templates[template_index];
+    forwarding_info_->spatial_id = frame_template.spatial_id;
+    forwarding_info_->temporal_id = frame_template.temporal_id;
+    forwarding_info_->decode_target_indications =
+        frame_template.decode_target_indications;
+    if (custom_dtis_flag_) {
+      for (auto& dti : forwarding_info_->decode_target_indications) {
+        dti = static_cast<DecodeTargetIndication>(buffer_.ReadBits(2));
+      }
+    }
+    // Custom frame and chain diffs follow the DTIs and are not needed.
+    return;
+  }
+
   // Copy all the fields from the matching template
   descriptor_->frame_dependencies = structure_->templates[template_index];
 
@@ -16,6 +16,7 @@
 
 #include "api/array_view.h"
 #include "api/transport/rtp/dependency_descriptor.h"
+#include "modules/rtp_rtcp/source/rtp_dependency_descriptor_extension.h"
 #include "rtc_base/bitstream_reader.h"
 
 namespace webrtc {
@@ -26,6 +27,10 @@ class RtpDependencyDescriptorReader {
   RtpDependencyDescriptorReader(rtc::ArrayView<const uint8_t> raw_data,
                                 const FrameDependencyStructure* structure,
                                 DependencyDescriptor* descriptor);
+  // Parses the fields of the dependency descriptor needed for forwarding.
+  RtpDependencyDescriptorReader(rtc::ArrayView<const uint8_t> raw_data,
+                                const FrameDependencyStructure* structure,
+                                DependencyDescriptorForwardingInfo* info);
   RtpDependencyDescriptorReader(const RtpDependencyDescriptorReader&) = delete;
   RtpDependencyDescriptorReader& operator=(
       const RtpDependencyDescriptorReader&) = delete;
@@ -34,6 +39,8 @@ class RtpDependencyDescriptorReader {
   bool ParseSuccessful() { return buffer_.Ok(); }
 
  private:
+  void ReadDescriptor(const FrameDependencyStructure* structure);
+
   // Functions to read template dependency structure.
   void ReadTemplateDependencyStructure();
   void ReadTemplateLayers();
@@ -53,6 +60,11 @@ class RtpDependencyDescriptorReader {
 
   // Output.
   DependencyDescriptor* const descriptor_;
+  // Set when only the fields needed for forwarding are parsed. The other
+  // fields are then read into `forwarding_descriptor_`, which is pointed to by
+  // `descriptor_`.
+  DependencyDescriptorForwardingInfo* const forwarding_info_ = nullptr;
+  DependencyDescriptor forwarding_descriptor_;
   // Values that are needed while reading the descriptor, but can be discarded
   // when reading is complete.
   BitstreamReader buffer_;
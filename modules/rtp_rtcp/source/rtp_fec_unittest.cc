@@ -288,6 +288,44 @@ TYPED_TEST(RtpFecTest, FecRecoveryNoLoss) {
   EXPECT_TRUE(this->IsRecoveryComplete());
 }
 
+TYPED_TEST(RtpFecTest, ReusedEncoderMatchesFreshEncoder) {
+  constexpr int kNumImportantPackets = 0;
+  constexpr bool kUseUnequalProtection = false;
+  // More than 12 media packets, so the packet masks are not read from a table.
+  constexpr int kNumMediaPackets = 20;
+
+  this->media_packets_ =
+      this->media_packet_generator_.ConstructMediaPackets(kNumMediaPackets);
+
+  // Alternate between settings, so that the encoder under test both generates
+  // new packet masks and reuses the ones of an earlier frame.
+  for (uint8_t protection_factor : {60, 200, 60, 60}) {
+    for (FecMaskType fec_mask_type : {kFecMaskRandom, kFecMaskBursty}) {
+      this->generated_fec_packets_.clear();
+      EXPECT_EQ(0, this->fec_.EncodeFec(this->media_packets_, protection_factor,
+                                        kNumImportantPackets,
+                                        kUseUnequalProtection, fec_mask_type,
+                                        &this->generated_fec_packets_));
+
+      TypeParam fresh_fec;
+      std::list<ForwardErrorCorrection::Packet*> expected_fec_packets;
+      EXPECT_EQ(0, fresh_fec.EncodeFec(this->media_packets_, protection_factor,
+                                       kNumImportantPackets,
+                                       kUseUnequalProtection, fec_mask_type,
+                                       &expected_fec_packets));
+
+      ASSERT_EQ(expected_fec_packets.size(),
+                this->generated_fec_packets_.size());
+      auto expected_it = expected_fec_packets.begin();
+      for (const ForwardErrorCorrection::Packet* packet :
+           this->generated_fec_packets_) {
+        EXPECT_EQ((*expected_it)->data, packet->data);
+        ++expected_it;
+      }
+    }
+  }
+}
+
 TYPED_TEST(RtpFecTest, FecRecoveryWithLoss) {
   constexpr int kNumImportantPackets = 0;
   constexpr bool kUseUnequalProtection = false;
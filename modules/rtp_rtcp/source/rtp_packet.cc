@@ -122,6 +122,7 @@ void RtpPacket::CopyHeaderFrom(const RtpPacket& packet) {
   payload_offset_ = packet.payload_offset_;
   extensions_ = packet.extensions_;
   extension_entries_ = packet.extension_entries_;
+  one_byte_extension_index_ = packet.one_byte_extension_index_;
   extensions_size_ = packet.extensions_size_;
   buffer_ = packet.buffer_.Slice(0, packet.headers_size());
   // Reset payload and padding.
@@ -326,8 +327,7 @@ rtc::ArrayView<uint8_t> RtpPacket::AllocateRawExtension(int id, size_t length) {
   const uint16_t extension_info_offset = rtc::dchecked_cast<uint16_t>(
       extensions_offset + extensions_size_ + extension_header_size);
   const uint8_t extension_info_length = rtc::dchecked_cast<uint8_t>(length);
-  extension_entries_.emplace_back(id, extension_info_length,
-                                  extension_info_offset);
+  AddExtensionInfo(id, extension_info_length, extension_info_offset);
 
   extensions_size_ = new_extensions_size;
 
@@ -435,7 +435,7 @@ void RtpPacket::Clear() {
   payload_size_ = 0;
   padding_size_ = 0;
   extensions_size_ = 0;
-  extension_entries_.clear();
+  ClearExtensionInfos();
 
   memset(WriteAt(0), 0, kFixedHeaderSize);
   buffer_.SetSize(kFixedHeaderSize);
@@ -465,7 +465,7 @@ bool RtpPacket::ParseBuffer(const uint8_t* buffer, size_t size) {
   payload_offset_ = kFixedHeaderSize + number_of_crcs * 4;
 
   extensions_size_ = 0;
-  extension_entries_.clear();
+  ClearExtensionInfos();
   if (has_extension) {
     /* RTP header extension, RFC 3550.
      0                   1                   2                   3
@@ -561,25 +561,48 @@ bool RtpPacket::ParseBuffer(const uint8_t* buffer, size_t size) {
   return true;
 }
 
-const RtpPacket::ExtensionInfo* RtpPacket::FindExtensionInfo(int id) const {
-  for (const ExtensionInfo& extension : extension_entries_) {
-    if (extension.id == id) {
-      return &extension;
+int RtpPacket::FindExtensionIndex(int id) const {
+  if (id <= RtpExtension::kOneByteHeaderExtensionMaxId) {
+    return static_cast<int>(one_byte_extension_index_[id]) - 1;
+  }
+  for (size_t i = 0; i < extension_entries_.size(); ++i) {
+    if (extension_entries_[i].id == id) {
+      return static_cast<int>(i);
     }
   }
-  return nullptr;
+  return -1;
+}
+
+const RtpPacket::ExtensionInfo* RtpPacket::FindExtensionInfo(int id) const {
+  int index = FindExtensionIndex(id);
+  return index < 0 ? nullptr : &extension_entries_[index];
 }
 
 RtpPacket::ExtensionInfo& RtpPacket::FindOrCreateExtensionInfo(int id) {
-  for (ExtensionInfo& extension : extension_entries_) {
-    if (extension.id == id) {
-      return extension;
-    }
+  int index = FindExtensionIndex(id);
+  if (index >= 0) {
+    return extension_entries_[index];
+  }
+  return AddExtensionInfo(id, 0, 0);
+}
+
+RtpPacket::ExtensionInfo& RtpPacket::AddExtensionInfo(uint8_t id,
+                                                      uint8_t length,
+                                                      uint16_t offset) {
+  RTC_DCHECK_EQ(FindExtensionIndex(id), -1);
+  extension_entries_.emplace_back(id, length, offset);
+  if (id <= RtpExtension::kOneByteHeaderExtensionMaxId) {
+    one_byte_extension_index_[id] =
+        rtc::dchecked_cast<uint8_t>(extension_entries_.size());
   }
-  extension_entries_.emplace_back(id);
   return extension_entries_.back();
 }
 
+void RtpPacket::ClearExtensionInfos() {
+  extension_entries_.clear();
+  one_byte_extension_index_.fill(0);
+}
+
 rtc::ArrayView<const uint8_t> RtpPacket::FindExtension(
     ExtensionType type) const {
   uint8_t id = extensions_.GetId(type);
@@ -10,11 +10,14 @@
 #ifndef MODULES_RTP_RTCP_SOURCE_RTP_PACKET_H_
 #define MODULES_RTP_RTCP_SOURCE_RTP_PACKET_H_
 
+#include <array>
 #include <string>
 #include <vector>
 
+#include "absl/container/inlined_vector.h"
 #include "absl/types/optional.h"
 #include "api/array_view.h"
+#include "api/rtp_parameters.h"
 #include "modules/rtp_rtcp/include/rtp_header_extension_map.h"
 #include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
 #include "rtc_base/copy_on_write_buffer.h"
@@ -180,6 +183,10 @@ class RtpPacket {
   // but does not touch packet own buffer, leaving packet in invalid state.
   bool ParseBuffer(const uint8_t* buffer, size_t size);
 
+  // Returns the index into `extension_entries_` of the extension info for a
+  // given id. Returns -1 if not found.
+  int FindExtensionIndex(int id) const;
+
   // Returns pointer to extension info for a given id. Returns nullptr if not
   // found.
   const ExtensionInfo* FindExtensionInfo(int id) const;
@@ -188,6 +195,11 @@ class RtpPacket {
   // with the specified id if not found.
   ExtensionInfo& FindOrCreateExtensionInfo(int id);
 
+  // Appends a new extension info, which must not exist yet for `id`.
+  ExtensionInfo& AddExtensionInfo(uint8_t id, uint8_t length, uint16_t offset);
+
+  void ClearExtensionInfos();
+
   // Allocates and returns place to store rtp header extension.
   // Returns empty arrayview on failure.
   rtc::ArrayView<uint8_t> AllocateRawExtension(int id, size_t length);
@@ -215,7 +227,15 @@ class RtpPacket {
   size_t payload_size_;
 
   ExtensionManager extensions_;
-  std::vector<ExtensionInfo> extension_entries_;
+  // Inlined for the number of extensions a media packet usually carries, so
+  // that copying a packet, e.g. from a template, does not allocate for them.
+  absl::InlinedVector<ExtensionInfo, 8> extension_entries_;
+  // One plus the index into `extension_entries_` for each one-byte header
+  // extension id, or 0 if the packet has no such extension. Lets the common
+  // extensions be looked up without scanning `extension_entries_`; larger ids
+  // are still searched linearly.
+  std::array<uint8_t, RtpExtension::kOneByteHeaderExtensionMaxId + 1>
+      one_byte_extension_index_ = {};
   size_t extensions_size_ = 0;  // Unaligned.
   rtc::CopyOnWriteBuffer buffer_;
 };
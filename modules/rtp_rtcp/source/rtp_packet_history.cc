@@ -28,6 +28,8 @@ namespace {
 
 constexpr size_t kOldPayloadPaddingSizeHysteresis = 100;
 constexpr uint16_t kMaxOldPayloadPaddingSequenceNumber = 1 << 13;
+// Number of slots allocated when the first packet is stored.
+constexpr size_t kInitialHistorySlots = 64;
 
 }  // namespace
 
@@ -93,6 +95,13 @@ void RtpPacketHistory::SetStorePacketsStatus(StorageMode mode,
     RTC_LOG(LS_WARNING) << "Purging packet history in order to re-set status.";
   }
   Reset();
+  if (mode == StorageMode::kDisabled) {
+    // Release the slots, they are not going to be reused.
+    packet_history_.clear();
+    packet_history_.shrink_to_fit();
+    history_begin_ = 0;
+    history_mask_ = 0;
+  }
   mode_ = mode;
   number_to_store_ = std::min(kMaxCapacity, number_to_store);
 }
@@ -128,9 +137,8 @@ void RtpPacketHistory::PutRtpPacket(std::unique_ptr<RtpPacketToSend> packet,
   // Store packet.
   const uint16_t rtp_seq_no = packet->SequenceNumber();
   int packet_index = GetPacketIndex(rtp_seq_no);
-  if (packet_index >= 0 &&
-      static_cast<size_t>(packet_index) < packet_history_.size() &&
-      packet_history_[packet_index].packet_ != nullptr) {
+  if (packet_index >= 0 && static_cast<size_t>(packet_index) < history_size_ &&
+      PacketAt(packet_index).packet_ != nullptr) {
     RTC_LOG(LS_WARNING) << "Duplicate packet inserted: " << rtp_seq_no;
     // Remove previous packet to avoid inconsistent state.
     RemovePacket(packet_index);
@@ -139,16 +147,16 @@ void RtpPacketHistory::PutRtpPacket(std::unique_ptr<RtpPacketToSend> packet,
 
   // Packet to be inserted ahead of first packet, expand front.
   for (; packet_index < 0; ++packet_index) {
-    packet_history_.emplace_front();
+    PushFrontEmptyPacket();
   }
   // Packet to be inserted behind last packet, expand back.
-  while (static_cast<int>(packet_history_.size()) <= packet_index) {
-    packet_history_.emplace_back();
+  while (static_cast<int>(history_size_) <= packet_index) {
+    PushBackEmptyPacket();
   }
 
   RTC_DCHECK_GE(packet_index, 0);
-  RTC_DCHECK_LT(packet_index, packet_history_.size());
-  RTC_DCHECK(packet_history_[packet_index].packet_ == nullptr);
+  RTC_DCHECK_LT(packet_index, history_size_);
+  RTC_DCHECK(PacketAt(packet_index).packet_ == nullptr);
 
   if (padding_mode_ == PaddingMode::kRecentLargePacket) {
     if ((!large_payload_packet_ ||
@@ -161,14 +169,14 @@ void RtpPacketHistory::PutRtpPacket(std::unique_ptr<RtpPacketToSend> packet,
     }
   }
 
-  packet_history_[packet_index] =
+  PacketAt(packet_index) =
       StoredPacket(std::move(packet), send_time, packets_inserted_++);
 
   if (padding_priority_enabled()) {
     if (padding_priority_.size() >= kMaxPaddingHistory - 1) {
       padding_priority_.erase(std::prev(padding_priority_.end()));
     }
-    auto prio_it = padding_priority_.insert(&packet_history_[packet_index]);
+    auto prio_it = padding_priority_.insert(&PacketAt(packet_index));
     RTC_DCHECK(prio_it.second) << "Failed to insert packet into prio set.";
   }
 }
@@ -241,11 +249,10 @@ bool RtpPacketHistory::GetPacketState(uint16_t sequence_number) const {
   }
 
   int packet_index = GetPacketIndex(sequence_number);
-  if (packet_index < 0 ||
-      static_cast<size_t>(packet_index) >= packet_history_.size()) {
+  if (packet_index < 0 || static_cast<size_t>(packet_index) >= history_size_) {
     return false;
   }
-  const StoredPacket& packet = packet_history_[packet_index];
+  const StoredPacket& packet = PacketAt(packet_index);
   if (packet.packet_ == nullptr) {
     return false;
   }
@@ -293,12 +300,11 @@ std::unique_ptr<RtpPacketToSend> RtpPacketHistory::GetPayloadPaddingPacket(
   if (padding_priority_enabled() && !padding_priority_.empty()) {
     auto best_packet_it = padding_priority_.begin();
     best_packet = *best_packet_it;
-  } else if (!padding_priority_enabled() && !packet_history_.empty()) {
+  } else if (!padding_priority_enabled()) {
     // Prioritization not available, pick the last packet.
-    for (auto it = packet_history_.rbegin(); it != packet_history_.rend();
-         ++it) {
-      if (it->packet_ != nullptr) {
-        best_packet = &(*it);
+    for (size_t i = history_size_; i > 0; --i) {
+      if (PacketAt(i - 1).packet_ != nullptr) {
+        best_packet = &PacketAt(i - 1);
         break;
       }
     }
@@ -334,7 +340,7 @@ void RtpPacketHistory::CullAcknowledgedPackets(
   for (uint16_t sequence_number : sequence_numbers) {
     int packet_index = GetPacketIndex(sequence_number);
     if (packet_index < 0 ||
-        static_cast<size_t>(packet_index) >= packet_history_.size()) {
+        static_cast<size_t>(packet_index) >= history_size_) {
       continue;
     }
     RemovePacket(packet_index);
@@ -347,7 +353,9 @@ void RtpPacketHistory::Clear() {
 }
 
 void RtpPacketHistory::Reset() {
-  packet_history_.clear();
+  while (history_size_ > 0) {
+    PopFrontPacket();
+  }
   padding_priority_.clear();
   large_payload_packet_ = absl::nullopt;
 }
@@ -358,15 +366,15 @@ void RtpPacketHistory::CullOldPackets() {
       rtt_.IsFinite()
           ? std::max(kMinPacketDurationRtt * rtt_, kMinPacketDuration)
           : kMinPacketDuration;
-  while (!packet_history_.empty()) {
-    if (packet_history_.size() >= kMaxCapacity) {
+  while (history_size_ > 0) {
+    if (history_size_ >= kMaxCapacity) {
       // We have reached the absolute max capacity, remove one packet
       // unconditionally.
       RemovePacket(0);
       continue;
     }
 
-    const StoredPacket& stored_packet = packet_history_.front();
+    const StoredPacket& stored_packet = PacketAt(0);
     if (stored_packet.pending_transmission_) {
       // Don't remove packets in the pacer queue, pending tranmission.
       return;
@@ -377,7 +385,7 @@ void RtpPacketHistory::CullOldPackets() {
       return;
     }
 
-    if (packet_history_.size() >= number_to_store_ ||
+    if (history_size_ >= number_to_store_ ||
         stored_packet.send_time() +
                 (packet_duration * kPacketCullingDelayFactor) <=
             now) {
@@ -395,17 +403,16 @@ std::unique_ptr<RtpPacketToSend> RtpPacketHistory::RemovePacket(
     int packet_index) {
   // Move the packet out from the StoredPacket container.
   std::unique_ptr<RtpPacketToSend> rtp_packet =
-      std::move(packet_history_[packet_index].packet_);
+      std::move(PacketAt(packet_index).packet_);
 
   // Erase from padding priority set, if eligible.
   if (padding_mode_ == PaddingMode::kPriority) {
-    padding_priority_.erase(&packet_history_[packet_index]);
+    padding_priority_.erase(&PacketAt(packet_index));
   }
 
   if (packet_index == 0) {
-    while (!packet_history_.empty() &&
-           packet_history_.front().packet_ == nullptr) {
-      packet_history_.pop_front();
+    while (history_size_ > 0 && PacketAt(0).packet_ == nullptr) {
+      PopFrontPacket();
     }
   }
 
@@ -413,12 +420,12 @@ std::unique_ptr<RtpPacketToSend> RtpPacketHistory::RemovePacket(
 }
 
 int RtpPacketHistory::GetPacketIndex(uint16_t sequence_number) const {
-  if (packet_history_.empty()) {
+  if (history_size_ == 0) {
     return 0;
   }
 
-  RTC_DCHECK(packet_history_.front().packet_ != nullptr);
-  int first_seq = packet_history_.front().packet_->SequenceNumber();
+  RTC_DCHECK(PacketAt(0).packet_ != nullptr);
+  int first_seq = PacketAt(0).packet_->SequenceNumber();
   if (first_seq == sequence_number) {
     return 0;
   }
@@ -442,11 +449,55 @@ int RtpPacketHistory::GetPacketIndex(uint16_t sequence_number) const {
 RtpPacketHistory::StoredPacket* RtpPacketHistory::GetStoredPacket(
     uint16_t sequence_number) {
   int index = GetPacketIndex(sequence_number);
-  if (index < 0 || static_cast<size_t>(index) >= packet_history_.size() ||
-      packet_history_[index].packet_ == nullptr) {
+  if (index < 0 || static_cast<size_t>(index) >= history_size_ ||
+      PacketAt(index).packet_ == nullptr) {
     return nullptr;
   }
-  return &packet_history_[index];
+  return &PacketAt(index);
+}
+
+void RtpPacketHistory::PushFrontEmptyPacket() {
+  EnsureRoomForOneMorePacket();
+  history_begin_ = (history_begin_ - 1) & history_mask_;
+  ++history_size_;
+}
+
+void RtpPacketHistory::PushBackEmptyPacket() {
+  EnsureRoomForOneMorePacket();
+  ++history_size_;
+}
+
+void RtpPacketHistory::PopFrontPacket() {
+  RTC_DCHECK_GT(history_size_, 0);
+  PacketAt(0) = StoredPacket();
+  history_begin_ = (history_begin_ + 1) & history_mask_;
+  --history_size_;
+}
+
+void RtpPacketHistory::EnsureRoomForOneMorePacket() {
+  if (history_size_ < packet_history_.size()) {
+    return;
+  }
+  std::vector<StoredPacket> slots(
+      std::max(kInitialHistorySlots, 2 * packet_history_.size()));
+  for (size_t i = 0; i < history_size_; ++i) {
+    slots[i] = std::move(PacketAt(i));
+  }
+  // The padding priority set refers to the entries by address, move it over to
+  // the new slots. The order of the set only depends on the entries' contents,
+  // so it is unchanged.
+  PacketPrioritySet padding_priority;
+  for (StoredPacket* packet : padding_priority_) {
+    const size_t index =
+        (static_cast<size_t>(packet - packet_history_.data()) -
+         history_begin_) &
+        history_mask_;
+    padding_priority.insert(padding_priority.end(), &slots[index]);
+  }
+  padding_priority_.swap(padding_priority);
+  packet_history_.swap(slots);
+  history_begin_ = 0;
+  history_mask_ = packet_history_.size() - 1;
 }
 
 bool RtpPacketHistory::padding_priority_enabled() const {
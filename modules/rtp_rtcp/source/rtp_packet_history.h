@@ -11,7 +11,6 @@
 #ifndef MODULES_RTP_RTCP_SOURCE_RTP_PACKET_HISTORY_H_
 #define MODULES_RTP_RTCP_SOURCE_RTP_PACKET_HISTORY_H_
 
-#include <deque>
 #include <map>
 #include <memory>
 #include <set>
@@ -188,6 +187,23 @@ class RtpPacketHistory {
   StoredPacket* GetStoredPacket(uint16_t sequence_number)
       RTC_EXCLUSIVE_LOCKS_REQUIRED(lock_);
 
+  // Accessors for the ring of stored packets. `index` counts from the oldest
+  // entry, the same way as the return value of GetPacketIndex().
+  StoredPacket& PacketAt(size_t index) RTC_EXCLUSIVE_LOCKS_REQUIRED(lock_) {
+    return packet_history_[(history_begin_ + index) & history_mask_];
+  }
+  const StoredPacket& PacketAt(size_t index) const
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(lock_) {
+    return packet_history_[(history_begin_ + index) & history_mask_];
+  }
+  // Adds an empty entry before the oldest, or after the newest, entry.
+  void PushFrontEmptyPacket() RTC_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+  void PushBackEmptyPacket() RTC_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+  // Releases the oldest entry, keeping its slot for reuse.
+  void PopFrontPacket() RTC_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+  // Makes room for one more entry, doubling the ring if it is full.
+  void EnsureRoomForOneMorePacket() RTC_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+
   Clock* const clock_;
   const PaddingMode padding_mode_;
   mutable Mutex lock_;
@@ -201,7 +217,14 @@ class RtpPacketHistory {
   // Packets may also be removed out-of-order, in which case there will be
   // instances of StoredPacket with `packet_` set to nullptr. The first and last
   // entry in the queue will however always be populated.
-  std::deque<StoredPacket> packet_history_ RTC_GUARDED_BY(lock_);
+  // The queue is a ring with a power of two number of slots, which are reused
+  // as packets are culled so that storing a packet does not allocate once the
+  // history has reached its steady state size. The oldest entry is in slot
+  // `history_begin_` and there are `history_size_` entries.
+  std::vector<StoredPacket> packet_history_ RTC_GUARDED_BY(lock_);
+  size_t history_begin_ RTC_GUARDED_BY(lock_) = 0;
+  size_t history_size_ RTC_GUARDED_BY(lock_) = 0;
+  size_t history_mask_ RTC_GUARDED_BY(lock_) = 0;
 
   // Total number of packets with inserted.
   uint64_t packets_inserted_ RTC_GUARDED_BY(lock_);
@@ -570,6 +570,27 @@ TEST_P(RtpPacketHistoryTest, PrioritizedPayloadPadding) {
   EXPECT_EQ(hist_.GetPayloadPaddingPacket(), nullptr);
 }
 
+TEST_P(RtpPacketHistoryTest, KeepsPacketsAndPaddingOrderWhenHistoryGrows) {
+  constexpr size_t kNumPackets = 1000;
+  hist_.SetStorePacketsStatus(StorageMode::kStoreAndCull, kNumPackets);
+
+  for (size_t i = 0; i < kNumPackets; ++i) {
+    hist_.PutRtpPacket(CreateRtpPacket(To16u(kStartSeqNum + i)),
+                       fake_clock_.CurrentTime());
+  }
+  for (size_t i = 0; i < kNumPackets; ++i) {
+    EXPECT_TRUE(hist_.GetPacketState(To16u(kStartSeqNum + i)));
+  }
+
+  if (GetParam() == RtpPacketHistory::PaddingMode::kPriority) {
+    // The newest packets are preferred as padding, one at a time.
+    EXPECT_EQ(hist_.GetPayloadPaddingPacket()->SequenceNumber(),
+              To16u(kStartSeqNum + kNumPackets - 1));
+    EXPECT_EQ(hist_.GetPayloadPaddingPacket()->SequenceNumber(),
+              To16u(kStartSeqNum + kNumPackets - 2));
+  }
+}
+
 TEST_P(RtpPacketHistoryTest, NoPendingPacketAsPadding) {
   hist_.SetStorePacketsStatus(StorageMode::kStoreAndCull, 1);
 
@@ -791,6 +791,69 @@ TEST(RtpPacketTest, ParseTwoByteHeaderExtensionWithPadding) {
   EXPECT_EQ(kAudioLevel, audio_level);
 }
 
+TEST(RtpPacketTest, ReparseForgetsExtensionsOfPreviousPacket) {
+  RtpPacketToSend::ExtensionManager extensions;
+  extensions.Register<TransmissionOffset>(kTransmissionOffsetExtensionId);
+  extensions.Register<AudioLevel>(kAudioLevelExtensionId);
+  RtpPacketReceived packet(&extensions);
+  ASSERT_TRUE(packet.Parse(kPacketWithTOAndAL, sizeof(kPacketWithTOAndAL)));
+  EXPECT_TRUE(packet.HasExtension<AudioLevel>());
+
+  ASSERT_TRUE(packet.Parse(kPacketWithTO, sizeof(kPacketWithTO)));
+  EXPECT_FALSE(packet.HasExtension<AudioLevel>());
+  int32_t time_offset;
+  EXPECT_TRUE(packet.GetExtension<TransmissionOffset>(&time_offset));
+  EXPECT_EQ(kTimeOffset, time_offset);
+
+  RtpPacketToSend copy(&extensions);
+  copy.CopyHeaderFrom(packet);
+  EXPECT_TRUE(copy.HasExtension<TransmissionOffset>());
+  EXPECT_FALSE(copy.HasExtension<AudioLevel>());
+}
+
+TEST(RtpPacketTest, CopiesPacketWithMoreExtensionsThanCommon) {
+  RtpPacketToSend::ExtensionManager extensions;
+  extensions.Register<TransmissionOffset>(1);
+  extensions.Register<AbsoluteSendTime>(2);
+  extensions.Register<TransportSequenceNumber>(3);
+  extensions.Register<VideoOrientation>(4);
+  extensions.Register<PlayoutDelayLimits>(5);
+  extensions.Register<VideoContentTypeExtension>(6);
+  extensions.Register<AudioLevel>(7);
+  extensions.Register<RtpStreamId>(8);
+  extensions.Register<RepairedRtpStreamId>(9);
+  extensions.Register<RtpMid>(10);
+  RtpPacketToSend packet(&extensions);
+  ASSERT_TRUE(packet.SetExtension<TransmissionOffset>(kTimeOffset));
+  ASSERT_TRUE(packet.SetExtension<AbsoluteSendTime>(0x123456));
+  ASSERT_TRUE(packet.SetExtension<TransportSequenceNumber>(0x4321));
+  ASSERT_TRUE(packet.SetExtension<VideoOrientation>(kVideoRotation_90));
+  ASSERT_TRUE(packet.SetExtension<PlayoutDelayLimits>(
+      VideoPlayoutDelay(/*min_ms=*/0, /*max_ms=*/100)));
+  ASSERT_TRUE(packet.SetExtension<VideoContentTypeExtension>(
+      VideoContentType::SCREENSHARE));
+  ASSERT_TRUE(packet.SetExtension<AudioLevel>(kVoiceActive, kAudioLevel));
+  ASSERT_TRUE(packet.SetExtension<RtpStreamId>(kStreamId));
+  ASSERT_TRUE(packet.SetExtension<RepairedRtpStreamId>(kStreamId));
+  ASSERT_TRUE(packet.SetExtension<RtpMid>(kMid));
+
+  RtpPacketToSend copy(packet);
+  EXPECT_EQ(copy.GetExtension<TransmissionOffset>(), kTimeOffset);
+  EXPECT_EQ(copy.GetExtension<AbsoluteSendTime>(), 0x123456u);
+  EXPECT_EQ(copy.GetExtension<TransportSequenceNumber>(), 0x4321);
+  EXPECT_EQ(copy.GetExtension<VideoOrientation>(), kVideoRotation_90);
+  EXPECT_EQ(copy.GetExtension<VideoContentTypeExtension>(),
+            VideoContentType::SCREENSHARE);
+  EXPECT_EQ(copy.GetExtension<RtpMid>(), kMid);
+
+  RtpPacketReceived parsed(&extensions);
+  ASSERT_TRUE(parsed.Parse(copy.Buffer()));
+  EXPECT_EQ(parsed.GetExtension<TransmissionOffset>(), kTimeOffset);
+  EXPECT_EQ(parsed.GetExtension<RtpStreamId>(), kStreamId);
+  EXPECT_EQ(parsed.GetExtension<RepairedRtpStreamId>(), kStreamId);
+  EXPECT_EQ(parsed.GetExtension<RtpMid>(), kMid);
+}
+
 TEST(RtpPacketTest, ParseWithExtensionDelayed) {
   RtpPacketReceived packet;
   EXPECT_TRUE(packet.Parse(kPacketWithTO, sizeof(kPacketWithTO)));
@@ -655,6 +655,7 @@ bool RTPSenderVideo::SendVideo(int payload_type,
 
   bool first_frame = first_frame_sent_();
   std::vector<std::unique_ptr<RtpPacketToSend>> rtp_packets;
+  rtp_packets.reserve(num_packets);
   for (size_t i = 0; i < num_packets; ++i) {
     std::unique_ptr<RtpPacketToSend> packet;
     int expected_payload_capacity;
@@ -758,7 +759,7 @@ bool RTPSenderVideo::SendEncodedImage(int payload_type,
                                       RTPVideoHeader video_header,
                                       TimeDelta expected_retransmission_time) {
   if (frame_transformer_delegate_) {
-    // The frame will be sent async once transformed.
+    // The frame will be sent once transformed, possibly asynchronously.
     return frame_transformer_delegate_->TransformFrame(
         payload_type, codec_type, rtp_timestamp, encoded_image, video_header,
         expected_retransmission_time);
@@ -10,6 +10,8 @@
 
 #include "modules/rtp_rtcp/source/rtp_sender_video_frame_transformer_delegate.h"
 
+#include <string.h>
+
 #include <utility>
 #include <vector>
 
@@ -17,6 +19,7 @@
 #include "api/task_queue/task_queue_factory.h"
 #include "modules/rtp_rtcp/source/rtp_descriptor_authentication.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/platform_thread_types.h"
 
 namespace webrtc {
 namespace {
@@ -55,7 +58,24 @@ class TransformableVideoSenderFrame : public TransformableVideoFrameInterface {
   }
 
   void SetData(rtc::ArrayView<const uint8_t> data) override {
-    encoded_data_ = EncodedImageBuffer::Create(data.data(), data.size());
+    if (owned_data_) {
+      owned_data_->Realloc(data.size());
+      memcpy(owned_data_->data(), data.data(), data.size());
+      return;
+    }
+    owned_data_ = EncodedImageBuffer::Create(data.data(), data.size());
+    encoded_data_ = owned_data_;
+  }
+
+  rtc::ArrayView<uint8_t> GetMutableData() override {
+    // The encoded data may be shared with other users of the encoded image,
+    // so it is copied before it is first modified.
+    if (!owned_data_) {
+      owned_data_ = EncodedImageBuffer::Create(encoded_data_->data(),
+                                               encoded_data_->size());
+      encoded_data_ = owned_data_;
+    }
+    return rtc::ArrayView<uint8_t>(owned_data_->data(), owned_data_->size());
   }
 
   size_t GetPreTransformPayloadSize() const {
@@ -102,6 +122,8 @@ class TransformableVideoSenderFrame : public TransformableVideoFrameInterface {
 
  private:
   rtc::scoped_refptr<EncodedImageBufferInterface> encoded_data_;
+  // Set once `encoded_data_` is owned by this frame and may be modified.
+  rtc::scoped_refptr<EncodedImageBuffer> owned_data_;
   const size_t pre_transform_payload_size_;
   RTPVideoHeader header_;
   const VideoFrameType frame_type_;
@@ -143,9 +165,17 @@ bool RTPSenderVideoFrameTransformerDelegate::TransformFrame(
     const EncodedImage& encoded_image,
     RTPVideoHeader video_header,
     TimeDelta expected_retransmission_time) {
+  {
+    MutexLock lock(&sender_lock_);
+    transforming_thread_ = rtc::CurrentThreadRef();
+  }
   frame_transformer_->Transform(std::make_unique<TransformableVideoSenderFrame>(
       encoded_image, video_header, payload_type, codec_type, rtp_timestamp,
       expected_retransmission_time, ssrc_, csrcs_));
+  {
+    MutexLock lock(&sender_lock_);
+    transforming_thread_ = absl::nullopt;
+  }
   return true;
 }
 
@@ -156,6 +186,16 @@ void RTPSenderVideoFrameTransformerDelegate::OnTransformedFrame(
   if (!sender_) {
     return;
   }
+  // A transformer that transforms synchronously calls back from within
+  // Transform(). Its frames are sent right away, unless frames it transformed
+  // asynchronously before are still waiting to be sent.
+  if (transforming_thread_ &&
+      rtc::IsThreadRefEqual(*transforming_thread_, rtc::CurrentThreadRef()) &&
+      num_queued_frames_ == 0) {
+    SendVideoLocked(std::move(frame));
+    return;
+  }
+  ++num_queued_frames_;
   rtc::scoped_refptr<RTPSenderVideoFrameTransformerDelegate> delegate(this);
   transformation_queue_->PostTask(
       [delegate = std::move(delegate), frame = std::move(frame)]() mutable {
@@ -165,11 +205,17 @@ void RTPSenderVideoFrameTransformerDelegate::OnTransformedFrame(
 }
 
 void RTPSenderVideoFrameTransformerDelegate::SendVideo(
-    std::unique_ptr<TransformableFrameInterface> transformed_frame) const {
+    std::unique_ptr<TransformableFrameInterface> transformed_frame) {
   RTC_DCHECK_RUN_ON(transformation_queue_.get());
   MutexLock lock(&sender_lock_);
+  --num_queued_frames_;
   if (!sender_)
     return;
+  SendVideoLocked(std::move(transformed_frame));
+}
+
+void RTPSenderVideoFrameTransformerDelegate::SendVideoLocked(
+    std::unique_ptr<TransformableFrameInterface> transformed_frame) const {
   if (transformed_frame->GetDirection() ==
       TransformableFrameInterface::Direction::kSender) {
     auto* transformed_video_frame =
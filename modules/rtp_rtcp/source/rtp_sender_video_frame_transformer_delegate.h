@@ -22,6 +22,7 @@
 #include "api/units/time_delta.h"
 #include "api/units/timestamp.h"
 #include "api/video/video_layers_allocation.h"
+#include "rtc_base/platform_thread_types.h"
 #include "rtc_base/synchronization/mutex.h"
 
 namespace webrtc {
@@ -71,13 +72,16 @@ class RTPSenderVideoFrameTransformerDelegate : public TransformedFrameCallback {
                       RTPVideoHeader video_header,
                       TimeDelta expected_retransmission_time);
 
-  // Implements TransformedFrameCallback. Can be called on any thread. Posts
-  // the transformed frame to be sent on the `encoder_queue_`.
+  // Implements TransformedFrameCallback. Can be called on any thread. Sends
+  // the transformed frame directly when called from within
+  // FrameTransformerInterface::Transform, and otherwise posts it to be sent on
+  // the `transformation_queue_`.
   void OnTransformedFrame(
       std::unique_ptr<TransformableFrameInterface> frame) override;
 
-  // Delegates the call to RTPSendVideo::SendVideo on the `encoder_queue_`.
-  void SendVideo(std::unique_ptr<TransformableFrameInterface> frame) const
+  // Delegates the call to RTPSendVideo::SendVideo on the
+  // `transformation_queue_`.
+  void SendVideo(std::unique_ptr<TransformableFrameInterface> frame)
       RTC_RUN_ON(transformation_queue_);
 
   // Delegates the call to RTPSendVideo::SetVideoStructureAfterTransformation
@@ -100,9 +104,16 @@ class RTPSenderVideoFrameTransformerDelegate : public TransformedFrameCallback {
 
  private:
   void EnsureEncoderQueueCreated();
+  void SendVideoLocked(std::unique_ptr<TransformableFrameInterface> frame) const
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(sender_lock_);
 
   mutable Mutex sender_lock_;
   RTPVideoFrameSenderInterface* sender_ RTC_GUARDED_BY(sender_lock_);
+  // The thread calling FrameTransformerInterface::Transform, if any.
+  absl::optional<rtc::PlatformThreadRef> transforming_thread_
+      RTC_GUARDED_BY(sender_lock_);
+  // Transformed frames posted to the `transformation_queue_` and not sent yet.
+  int num_queued_frames_ RTC_GUARDED_BY(sender_lock_) = 0;
   rtc::scoped_refptr<FrameTransformerInterface> frame_transformer_;
   const uint32_t ssrc_;
   std::vector<uint32_t> csrcs_;
@@ -151,6 +151,65 @@ TEST_F(RtpSenderVideoFrameTransformerDelegateTest,
   event.Wait(TimeDelta::Seconds(1));
 }
 
+TEST_F(RtpSenderVideoFrameTransformerDelegateTest,
+       SendsSynchronouslyTransformedFrameDirectly) {
+  auto delegate = rtc::make_ref_counted<RTPSenderVideoFrameTransformerDelegate>(
+      &test_sender_, frame_transformer_,
+      /*ssrc=*/1111, /*csrcs=*/std::vector<uint32_t>(),
+      time_controller_.CreateTaskQueueFactory().get());
+
+  rtc::scoped_refptr<TransformedFrameCallback> callback;
+  EXPECT_CALL(*frame_transformer_, RegisterTransformedFrameSinkCallback)
+      .WillOnce(SaveArg<0>(&callback));
+  delegate->Init();
+  ASSERT_TRUE(callback);
+
+  EXPECT_CALL(*frame_transformer_, Transform)
+      .WillOnce([&](std::unique_ptr<TransformableFrameInterface> frame) {
+        callback->OnTransformedFrame(std::move(frame));
+      });
+  EXPECT_CALL(test_sender_, SendVideo).WillOnce(Return(true));
+  EncodedImage encoded_image;
+  encoded_image.SetEncodedData(EncodedImageBuffer::Create(1));
+  delegate->TransformFrame(
+      /*payload_type=*/1, VideoCodecType::kVideoCodecVP8, /*rtp_timestamp=*/2,
+      encoded_image, RTPVideoHeader(),
+      /*expected_retransmission_time=*/TimeDelta::PlusInfinity());
+  // Sent without running the transformation queue.
+  testing::Mock::VerifyAndClearExpectations(&test_sender_);
+}
+
+TEST_F(RtpSenderVideoFrameTransformerDelegateTest,
+       TransformsCopyOfEncodedDataInPlace) {
+  auto delegate = rtc::make_ref_counted<RTPSenderVideoFrameTransformerDelegate>(
+      &test_sender_, frame_transformer_,
+      /*ssrc=*/1111, /*csrcs=*/std::vector<uint32_t>(),
+      time_controller_.CreateTaskQueueFactory().get());
+
+  const uint8_t data[] = {1, 2, 3};
+  EncodedImage encoded_image;
+  encoded_image.SetEncodedData(EncodedImageBuffer::Create(data, sizeof(data)));
+  std::unique_ptr<TransformableFrameInterface> frame;
+  EXPECT_CALL(*frame_transformer_, Transform)
+      .WillOnce([&](std::unique_ptr<TransformableFrameInterface>
+                        frame_to_transform) {
+        frame = std::move(frame_to_transform);
+      });
+  delegate->TransformFrame(
+      /*payload_type=*/1, VideoCodecType::kVideoCodecVP8, /*rtp_timestamp=*/2,
+      encoded_image, RTPVideoHeader(),
+      /*expected_retransmission_time=*/TimeDelta::PlusInfinity());
+  ASSERT_TRUE(frame);
+
+  rtc::ArrayView<uint8_t> mutable_data = frame->GetMutableData();
+  ASSERT_EQ(mutable_data.size(), sizeof(data));
+  mutable_data[0] = 42;
+  EXPECT_EQ(frame->GetData()[0], 42);
+  EXPECT_EQ(frame->GetMutableData().data(), mutable_data.data());
+  // The encoded image may be used elsewhere and is left untouched.
+  EXPECT_EQ(encoded_image.data()[0], 1);
+}
+
 TEST_F(RtpSenderVideoFrameTransformerDelegateTest, CloneSenderVideoFrame) {
   auto delegate = rtc::make_ref_counted<RTPSenderVideoFrameTransformerDelegate>(
       &test_sender_, frame_transformer_,
@@ -45,6 +45,14 @@ class TransformableVideoReceiverFrame
         EncodedImageBuffer::Create(data.data(), data.size()));
   }
 
+  // The payload was assembled for this frame only, so it can be modified
+  // without a copy.
+  rtc::ArrayView<uint8_t> GetMutableData() override {
+    rtc::scoped_refptr<EncodedImageBufferInterface> data =
+        frame_->GetEncodedData();
+    return rtc::ArrayView<uint8_t>(data->data(), data->size());
+  }
+
   uint8_t GetPayloadType() const override { return frame_->PayloadType(); }
   uint32_t GetSsrc() const override { return metadata_.GetSsrc(); }
   uint32_t GetTimestamp() const override { return frame_->Timestamp(); }
@@ -111,17 +119,31 @@ void RtpVideoStreamReceiverFrameTransformerDelegate::Reset() {
 void RtpVideoStreamReceiverFrameTransformerDelegate::TransformFrame(
     std::unique_ptr<RtpFrameObject> frame) {
   RTC_DCHECK_RUN_ON(&network_sequence_checker_);
+  transforming_ = true;
   frame_transformer_->Transform(
       std::make_unique<TransformableVideoReceiverFrame>(std::move(frame), ssrc_,
                                                         receiver_));
+  transforming_ = false;
 }
 
 void RtpVideoStreamReceiverFrameTransformerDelegate::OnTransformedFrame(
     std::unique_ptr<TransformableFrameInterface> frame) {
+  // A transformer that transforms synchronously calls back from within
+  // Transform(). Its frames are managed right away, unless frames it
+  // transformed asynchronously before are still waiting to be managed.
+  if (network_thread_->IsCurrent()) {
+    RTC_DCHECK_RUN_ON(&network_sequence_checker_);
+    if (transforming_ && num_queued_frames_.load() == 0) {
+      ManageFrame(std::move(frame));
+      return;
+    }
+  }
+  ++num_queued_frames_;
   rtc::scoped_refptr<RtpVideoStreamReceiverFrameTransformerDelegate> delegate(
       this);
   network_thread_->PostTask(
       [delegate = std::move(delegate), frame = std::move(frame)]() mutable {
+        --delegate->num_queued_frames_;
         delegate->ManageFrame(std::move(frame));
       });
 }
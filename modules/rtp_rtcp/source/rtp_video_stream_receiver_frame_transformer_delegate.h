@@ -11,6 +11,7 @@
 #ifndef MODULES_RTP_RTCP_SOURCE_RTP_VIDEO_STREAM_RECEIVER_FRAME_TRANSFORMER_DELEGATE_H_
 #define MODULES_RTP_RTCP_SOURCE_RTP_VIDEO_STREAM_RECEIVER_FRAME_TRANSFORMER_DELEGATE_H_
 
+#include <atomic>
 #include <memory>
 
 #include "api/frame_transformer_interface.h"
@@ -50,8 +51,10 @@ class RtpVideoStreamReceiverFrameTransformerDelegate
   // Delegates the call to FrameTransformerInterface::TransformFrame.
   void TransformFrame(std::unique_ptr<RtpFrameObject> frame);
 
-  // Implements TransformedFrameCallback. Can be called on any thread. Posts
-  // the transformed frame to be managed on the `network_thread_`.
+  // Implements TransformedFrameCallback. Can be called on any thread. Manages
+  // the transformed frame directly when called from within
+  // FrameTransformerInterface::Transform, and otherwise posts it to be managed
+  // on the `network_thread_`.
   void OnTransformedFrame(
       std::unique_ptr<TransformableFrameInterface> frame) override;
 
@@ -67,6 +70,10 @@ class RtpVideoStreamReceiverFrameTransformerDelegate
   RtpVideoFrameReceiver* receiver_ RTC_GUARDED_BY(network_sequence_checker_);
   rtc::scoped_refptr<FrameTransformerInterface> frame_transformer_
       RTC_GUARDED_BY(network_sequence_checker_);
+  // Whether FrameTransformerInterface::Transform is being called.
+  bool transforming_ RTC_GUARDED_BY(network_sequence_checker_) = false;
+  // Transformed frames posted to the `network_thread_` and not managed yet.
+  std::atomic<int> num_queued_frames_{0};
   rtc::Thread* const network_thread_;
   const uint32_t ssrc_;
   Clock* const clock_;
@@ -143,6 +143,61 @@ TEST(RtpVideoStreamReceiverFrameTransformerDelegateTest,
   rtc::ThreadManager::ProcessAllMessageQueuesForTesting();
 }
 
+TEST(RtpVideoStreamReceiverFrameTransformerDelegateTest,
+     ManagesSynchronouslyTransformedFrameDirectly) {
+  rtc::AutoThread main_thread_;
+  TestRtpVideoFrameReceiver receiver;
+  auto mock_frame_transformer(
+      rtc::make_ref_counted<NiceMock<MockFrameTransformer>>());
+  SimulatedClock clock(0);
+  auto delegate =
+      rtc::make_ref_counted<RtpVideoStreamReceiverFrameTransformerDelegate>(
+          &receiver, &clock, mock_frame_transformer, rtc::Thread::Current(),
+          /*remote_ssrc*/ 1111);
+
+  rtc::scoped_refptr<TransformedFrameCallback> callback;
+  EXPECT_CALL(*mock_frame_transformer, RegisterTransformedFrameSinkCallback)
+      .WillOnce(SaveArg<0>(&callback));
+  delegate->Init();
+  ASSERT_TRUE(callback);
+
+  ON_CALL(*mock_frame_transformer, Transform)
+      .WillByDefault(
+          [&callback](std::unique_ptr<TransformableFrameInterface> frame) {
+            callback->OnTransformedFrame(std::move(frame));
+          });
+  EXPECT_CALL(receiver, ManageFrame);
+  delegate->TransformFrame(CreateRtpFrameObject());
+  // Managed without processing the network thread's queue.
+  testing::Mock::VerifyAndClearExpectations(&receiver);
+}
+
+TEST(RtpVideoStreamReceiverFrameTransformerDelegateTest,
+     TransformsFrameDataInPlace) {
+  TestRtpVideoFrameReceiver receiver;
+  auto mock_frame_transformer =
+      rtc::make_ref_counted<NiceMock<MockFrameTransformer>>();
+  SimulatedClock clock(0);
+  auto delegate =
+      rtc::make_ref_counted<RtpVideoStreamReceiverFrameTransformerDelegate>(
+          &receiver, &clock, mock_frame_transformer, rtc::Thread::Current(),
+          1111);
+  const uint8_t data[] = {1, 2, 3};
+  auto frame_object = CreateRtpFrameObject();
+  frame_object->SetEncodedData(EncodedImageBuffer::Create(data, sizeof(data)));
+  const uint8_t* frame_data = frame_object->data();
+
+  EXPECT_CALL(*mock_frame_transformer, Transform)
+      .WillOnce([&](std::unique_ptr<TransformableFrameInterface> frame) {
+        rtc::ArrayView<uint8_t> mutable_data = frame->GetMutableData();
+        ASSERT_EQ(mutable_data.size(), sizeof(data));
+        EXPECT_EQ(mutable_data.data(), frame_data);
+        mutable_data[0] = 42;
+        EXPECT_EQ(frame->GetData()[0], 42);
+      });
+  delegate->TransformFrame(std::move(frame_object));
+}
+
 TEST(RtpVideoStreamReceiverFrameTransformerDelegateTest,
      TransformableFrameMetadataHasCorrectValue) {
   TestRtpVideoFrameReceiver receiver;
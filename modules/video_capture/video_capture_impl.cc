@@ -169,8 +169,6 @@ int32_t VideoCaptureImpl::IncomingFrame(uint8_t* videoFrame,
     }
   }
 
-  int stride_y = width;
-  int stride_uv = (width + 1) / 2;
   int target_width = width;
   int target_height = abs(height);
 
@@ -186,8 +184,13 @@ int32_t VideoCaptureImpl::IncomingFrame(uint8_t* videoFrame,
   // Setting absolute height (in case it was negative).
   // In Windows, the image starts bottom left, instead of top left.
   // Setting a negative source height, inverts the image (within LibYuv).
-  rtc::scoped_refptr<I420Buffer> buffer = I420Buffer::Create(
-      target_width, target_height, stride_y, stride_uv, stride_uv);
+  rtc::scoped_refptr<I420Buffer> buffer =
+      buffer_pool_.CreateI420Buffer(target_width, target_height);
+  if (!buffer) {
+    RTC_LOG(LS_WARNING) << "Failed to get a buffer from the pool, dropping "
+                           "capture frame.";
+    return -1;
+  }
 
   libyuv::RotationMode rotation_mode = libyuv::kRotate0;
   if (apply_rotation_) {
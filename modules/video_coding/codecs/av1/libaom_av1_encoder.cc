@@ -18,11 +18,13 @@
 
 #include "absl/algorithm/container.h"
 #include "absl/base/macros.h"
+#include "absl/cleanup/cleanup.h"
 #include "absl/strings/match.h"
 #include "absl/types/optional.h"
 #include "api/field_trials_view.h"
 #include "api/scoped_refptr.h"
 #include "api/transport/field_trial_based_config.h"
+#include "api/units/time_delta.h"
 #include "api/video/encoded_image.h"
 #include "api/video/i420_buffer.h"
 #include "api/video/video_frame.h"
@@ -34,9 +36,11 @@
 #include "modules/video_coding/svc/create_scalability_structure.h"
 #include "modules/video_coding/svc/scalable_video_controller.h"
 #include "modules/video_coding/svc/scalable_video_controller_no_layering.h"
+#include "modules/video_coding/svc/spatial_layer_encode_budget.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/experiments/encoder_info_settings.h"
 #include "rtc_base/logging.h"
+#include "rtc_base/time_utils.h"
 #include "third_party/libaom/source/libaom/aom/aom_codec.h"
 #include "third_party/libaom/source/libaom/aom/aom_encoder.h"
 #include "third_party/libaom/source/libaom/aom/aomcx.h"
@@ -128,6 +132,8 @@ class LibaomAv1Encoder final : public VideoEncoder {
   // TODO(webrtc:15225): Kill switch for disabling frame dropping. Remove it
   // after frame dropping is fully rolled out.
   bool disable_frame_dropping_;
+  // Set when CPU-aware layer dropping is enabled by field trial.
+  std::unique_ptr<SpatialLayerEncodeBudget> encode_budget_;
 };
 
 int32_t VerifyCodecSettings(const VideoCodec& codec_settings) {
@@ -169,7 +175,12 @@ LibaomAv1Encoder::LibaomAv1Encoder(
       timestamp_(0),
       disable_frame_dropping_(absl::StartsWith(
           trials.Lookup("WebRTC-LibaomAv1Encoder-DisableFrameDropping"),
-          "Enabled")) {}
+          "Enabled")) {
+  if (absl::optional<SpatialLayerEncodeBudget::Config> budget_config =
+          SpatialLayerEncodeBudget::ParseFieldTrial(trials)) {
+    encode_budget_ = std::make_unique<SpatialLayerEncodeBudget>(*budget_config);
+  }
+}
 
 LibaomAv1Encoder::~LibaomAv1Encoder() {
   Release();
@@ -217,6 +228,9 @@ int LibaomAv1Encoder::InitEncode(const VideoCodec* codec_settings,
   if (!SetSvcParams(svc_controller_->StreamConfig())) {
     return WEBRTC_VIDEO_CODEC_ERROR;
   }
+  if (encode_budget_) {
+    encode_budget_->Reset();
+  }
 
   // Initialize encoder configuration structure with default values
   aom_codec_err_t ret =
@@ -564,6 +578,13 @@ int32_t LibaomAv1Encoder::Encode(
     RTC_LOG(LS_ERROR) << "SVCController returned no configuration for a frame.";
     return WEBRTC_VIDEO_CODEC_ERROR;
   }
+  // Skip the top spatial layers of this frame rather than the whole
+  // picture when encoding all of them would miss the frame deadline.
+  const bool layers_dropped_by_budget =
+      encode_budget_ && SvcEnabled() &&
+      encode_budget_->DropLayersOverBudget(
+          layer_frames,
+          TimeDelta::Seconds(1) / encoder_settings_.maxFramerate) > 0;
 
   rtc::scoped_refptr<VideoFrameBuffer> buffer = frame.video_frame_buffer();
   absl::InlinedVector<VideoFrameBuffer::Type, kMaxPreferredPixelFormats>
@@ -639,6 +660,30 @@ int32_t LibaomAv1Encoder::Encode(
 
   const size_t num_spatial_layers =
       svc_params_ ? svc_params_->number_spatial_layers : 1;
+
+  // libaom produces a frame for every spatial layer that has a target bitrate,
+  // so the dropped layers are disabled for this picture only.
+  absl::optional<aom_svc_params_t> svc_params_before_drop;
+  if (layers_dropped_by_budget) {
+    svc_params_before_drop = svc_params_;
+    for (int sid = layer_frames.back().SpatialId() + 1;
+         sid < svc_params_->number_spatial_layers; ++sid) {
+      for (int tid = 0; tid < svc_params_->number_temporal_layers; ++tid) {
+        svc_params_->layer_target_bitrate
+            [sid * svc_params_->number_temporal_layers + tid] = 0;
+      }
+    }
+    SetEncoderControlParameters(AV1E_SET_SVC_PARAMS, &*svc_params_);
+  }
+  absl::Cleanup restore_svc_params = [&] {
+    if (svc_params_before_drop) {
+      svc_params_ = svc_params_before_drop;
+      if (inited_) {
+        SetEncoderControlParameters(AV1E_SET_SVC_PARAMS, &*svc_params_);
+      }
+    }
+  };
+
   auto next_layer_frame = layer_frames.begin();
   for (size_t i = 0; i < num_spatial_layers; ++i) {
     // The libaom AV1 encoder requires that `aom_codec_encode` is called for
@@ -669,6 +714,7 @@ int32_t LibaomAv1Encoder::Encode(
     // Encode a frame. The presentation timestamp `pts` should not use real
     // timestamps from frames or the wall clock, as that can cause the rate
     // controller to misbehave.
+    const int64_t encode_start_us = rtc::TimeMicros();
     aom_codec_err_t ret =
         aom_codec_encode(&ctx_, frame_for_encode_, timestamp_, duration, flags);
     if (ret != AOM_CODEC_OK) {
@@ -680,6 +726,10 @@ int32_t LibaomAv1Encoder::Encode(
     if (non_encoded_layer_frame) {
       continue;
     }
+    if (encode_budget_) {
+      encode_budget_->OnLayerEncoded(
+          i, TimeDelta::Micros(rtc::TimeMicros() - encode_start_us));
+    }
 
     // Get encoded image data.
     EncodedImage encoded_image;
@@ -294,9 +294,22 @@ bool H264DecoderImpl::Configure(const Settings& settings) {
   av_context_->extradata = nullptr;
   av_context_->extradata_size = 0;
 
-  // If this is ever increased, look at `av_context_->thread_safe_callbacks` and
-  // make it possible to disable the thread checker in the frame buffer pool.
+  // Only slice threading is used, which calls `get_buffer2` on the decoding
+  // thread. If frame threading is ever enabled, look at
+  // `av_context_->thread_safe_callbacks` and make it possible to disable the
+  // thread checker in the frame buffer pool.
   av_context_->thread_count = 1;
+#ifndef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
+  if (resolution.Valid()) {
+    // Decode the slices of high resolution frames in parallel, with the same
+    // number of threads as the VP9 decoder: 2 for 720p, scaling linearly with
+    // the pixel count and capped at the number of cores.
+    int num_threads = std::max(
+        1, 2 * resolution.Width() * resolution.Height() / (1280 * 720));
+    av_context_->thread_count =
+        std::max(1, std::min(settings.number_of_cores(), num_threads));
+  }
+#endif
   av_context_->thread_type = FF_THREAD_SLICE;
 
   // Function used by FFmpeg to get buffers to store decoded frames in.
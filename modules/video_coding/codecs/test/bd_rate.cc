@@ -0,0 +1,125 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/video_coding/codecs/test/bd_rate.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <utility>
+
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+namespace test {
+namespace {
+
+constexpr int kNumCoefficients = 4;
+using Polynomial = std::array<double, kNumCoefficients>;
+
+// Least squares fit of log10(bitrate) as a cubic polynomial of the PSNR minus
+// `offset`. Offsetting the PSNR keeps the normal equations well conditioned.
+absl::optional<Polynomial> FitLogRate(const std::vector<RdPoint>& curve,
+                                      double offset) {
+  // Normal equations, as an augmented matrix.
+  double m[kNumCoefficients][kNumCoefficients + 1] = {};
+  for (const RdPoint& point : curve) {
+    RTC_DCHECK_GT(point.bitrate_kbps, 0);
+    const double x = point.psnr - offset;
+    const double y = std::log10(point.bitrate_kbps);
+    double powers[2 * kNumCoefficients - 1];
+    powers[0] = 1;
+    for (int i = 1; i < 2 * kNumCoefficients - 1; ++i) {
+      powers[i] = powers[i - 1] * x;
+    }
+    for (int row = 0; row < kNumCoefficients; ++row) {
+      for (int col = 0; col < kNumCoefficients; ++col) {
+        m[row][col] += powers[row + col];
+      }
+      m[row][kNumCoefficients] += powers[row] * y;
+    }
+  }
+
+  // Gaussian elimination with partial pivoting.
+  for (int col = 0; col < kNumCoefficients; ++col) {
+    int pivot = col;
+    for (int row = col + 1; row < kNumCoefficients; ++row) {
+      if (std::abs(m[row][col]) > std::abs(m[pivot][col])) {
+        pivot = row;
+      }
+    }
+    if (std::abs(m[pivot][col]) < 1e-12) {
+      return absl::nullopt;
+    }
+    std::swap(m[col], m[pivot]);
+    for (int row = col + 1; row < kNumCoefficients; ++row) {
+      const double factor = m[row][col] / m[col][col];
+      for (int i = col; i <= kNumCoefficients; ++i) {
+        m[row][i] -= factor * m[col][i];
+      }
+    }
+  }
+  Polynomial p;
+  for (int row = kNumCoefficients - 1; row >= 0; --row) {
+    double sum = m[row][kNumCoefficients];
+    for (int col = row + 1; col < kNumCoefficients; ++col) {
+      sum -= m[row][col] * p[col];
+    }
+    p[row] = sum / m[row][row];
+  }
+  return p;
+}
+
+// Integral of `p` from 0 to `x`.
+double Integrate(const Polynomial& p, double x) {
+  double sum = 0;
+  double power = x;
+  for (int i = 0; i < kNumCoefficients; ++i) {
+    sum += p[i] * power / (i + 1);
+    power *= x;
+  }
+  return sum;
+}
+
+std::pair<double, double> PsnrRange(const std::vector<RdPoint>& curve) {
+  auto [min, max] = std::minmax_element(
+      curve.begin(), curve.end(),
+      [](const RdPoint& a, const RdPoint& b) { return a.psnr < b.psnr; });
+  return {min->psnr, max->psnr};
+}
+
+}  // namespace
+
+absl::optional<double> BdRatePercent(const std::vector<RdPoint>& anchor,
+                                     const std::vector<RdPoint>& test) {
+  if (anchor.size() < kNumCoefficients || test.size() < kNumCoefficients) {
+    return absl::nullopt;
+  }
+  auto [anchor_min, anchor_max] = PsnrRange(anchor);
+  auto [test_min, test_max] = PsnrRange(test);
+  const double low = std::max(anchor_min, test_min);
+  const double high = std::min(anchor_max, test_max);
+  if (low >= high) {
+    return absl::nullopt;
+  }
+
+  absl::optional<Polynomial> anchor_fit = FitLogRate(anchor, low);
+  absl::optional<Polynomial> test_fit = FitLogRate(test, low);
+  if (!anchor_fit || !test_fit) {
+    return absl::nullopt;
+  }
+  const double average_log_rate_diff =
+      (Integrate(*test_fit, high - low) - Integrate(*anchor_fit, high - low)) /
+      (high - low);
+  return (std::pow(10, average_log_rate_diff) - 1) * 100;
+}
+
+}  // namespace test
+}  // namespace webrtc
@@ -0,0 +1,39 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_VIDEO_CODING_CODECS_TEST_BD_RATE_H_
+#define MODULES_VIDEO_CODING_CODECS_TEST_BD_RATE_H_
+
+#include <vector>
+
+#include "absl/types/optional.h"
+
+namespace webrtc {
+namespace test {
+
+// A point of a rate-distortion curve.
+struct RdPoint {
+  double bitrate_kbps;
+  double psnr;
+};
+
+// Returns the Bjontegaard delta rate of `test` relative to `anchor`, i.e. the
+// average difference of bitrate in percent at the same quality, over the PSNR
+// range both curves cover. Negative values mean that `test` needs less bitrate
+// than `anchor`. Each curve is fitted with a cubic polynomial, so it needs at
+// least 4 points with distinct PSNR. Returns nullopt if a curve has fewer
+// points or the curves do not overlap.
+absl::optional<double> BdRatePercent(const std::vector<RdPoint>& anchor,
+                                     const std::vector<RdPoint>& test);
+
+}  // namespace test
+}  // namespace webrtc
+
+#endif  // MODULES_VIDEO_CODING_CODECS_TEST_BD_RATE_H_
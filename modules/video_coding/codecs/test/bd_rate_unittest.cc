@@ -0,0 +1,73 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/video_coding/codecs/test/bd_rate.h"
+
+#include <cmath>
+#include <vector>
+
+#include "test/gmock.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace test {
+namespace {
+
+using ::testing::DoubleNear;
+using ::testing::Eq;
+using ::testing::Optional;
+
+const std::vector<RdPoint> kAnchor = {{.bitrate_kbps = 128, .psnr = 31.2},
+                                      {.bitrate_kbps = 256, .psnr = 33.4},
+                                      {.bitrate_kbps = 384, .psnr = 34.9},
+                                      {.bitrate_kbps = 512, .psnr = 36.1}};
+
+std::vector<RdPoint> ScaleBitrate(std::vector<RdPoint> curve, double factor) {
+  for (RdPoint& point : curve) {
+    point.bitrate_kbps *= factor;
+  }
+  return curve;
+}
+
+TEST(BdRateTest, SameCurveHasNoDelta) {
+  EXPECT_THAT(BdRatePercent(kAnchor, kAnchor), Optional(DoubleNear(0, 1e-9)));
+}
+
+TEST(BdRateTest, ReturnsBitrateDifferenceAtSameQuality) {
+  EXPECT_THAT(BdRatePercent(kAnchor, ScaleBitrate(kAnchor, 2)),
+              Optional(DoubleNear(100, 1e-6)));
+  EXPECT_THAT(BdRatePercent(kAnchor, ScaleBitrate(kAnchor, 0.9)),
+              Optional(DoubleNear(-10, 1e-6)));
+}
+
+TEST(BdRateTest, ComparesOverlappingQualityRange) {
+  // Same curve, sampled at other points.
+  std::vector<RdPoint> test = {{.bitrate_kbps = 256, .psnr = 33.4},
+                               {.bitrate_kbps = 384, .psnr = 34.9},
+                               {.bitrate_kbps = 512, .psnr = 36.1},
+                               {.bitrate_kbps = 1024, .psnr = 38.6}};
+  absl::optional<double> bd_rate = BdRatePercent(kAnchor, test);
+  ASSERT_TRUE(bd_rate);
+  EXPECT_LT(std::abs(*bd_rate), 5);
+}
+
+TEST(BdRateTest, NeedsFourPointsAndOverlap) {
+  EXPECT_THAT(BdRatePercent(kAnchor, {kAnchor.begin(), kAnchor.end() - 1}),
+              Eq(absl::nullopt));
+  std::vector<RdPoint> better = kAnchor;
+  for (RdPoint& point : better) {
+    point.psnr += 10;
+  }
+  EXPECT_THAT(BdRatePercent(kAnchor, better), Eq(absl::nullopt));
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace webrtc
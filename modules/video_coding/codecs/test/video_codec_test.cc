@@ -10,6 +10,7 @@
 
 #include "api/video_codecs/video_codec.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 #include <string>
@@ -22,6 +23,7 @@
 #include "api/test/videocodec_test_stats.h"
 #include "api/units/data_rate.h"
 #include "api/units/frequency.h"
+#include "api/units/time_delta.h"
 #include "api/video/encoded_image.h"
 #include "api/video/i420_buffer.h"
 #include "api/video/resolution.h"
@@ -32,12 +34,16 @@
 #include "media/engine/internal_decoder_factory.h"
 #include "media/engine/internal_encoder_factory.h"
 #include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
+#include "modules/video_coding/codecs/test/bd_rate.h"
 #include "modules/video_coding/include/video_error_codes.h"
 #include "modules/video_coding/svc/scalability_mode_util.h"
 #if defined(WEBRTC_ANDROID)
 #include "modules/video_coding/codecs/test/android_codec_factory_helper.h"
 #endif
+#include "rtc_base/cpu_time.h"
 #include "rtc_base/logging.h"
+#include "rtc_base/memory_usage.h"
+#include "rtc_base/time_utils.h"
 #include "system_wrappers/include/field_trial.h"
 #include "test/gtest.h"
 #include "test/testsupport/file_utils.h"
@@ -111,6 +117,19 @@ struct EncodingSettings {
   }
 };
 
+// Settings of the codec implementation, which do not change during a test.
+struct CodecSettings {
+  VideoCodecComplexity complexity = VideoCodecComplexity::kComplexityNormal;
+  int num_cores = 1;
+};
+
+// Resources used to encode and decode a video.
+struct ResourceUsage {
+  TimeDelta wall_time = TimeDelta::Zero();
+  TimeDelta cpu_time = TimeDelta::Zero();
+  int64_t peak_resident_size_bytes = 0;
+};
+
 const VideoInfo kFourPeople_1280x720_30 = {
     .name = "FourPeople_1280x720_30",
     .resolution = {.width = 1280, .height = 720},
@@ -171,6 +190,9 @@ class TestRawVideoSource : public VideoCodecTester::RawVideoSource {
     pulled_frames_[timestamp_rtp_] = pulled_frame;
     timestamp_rtp_ += k90kHz / framerate;
     ++frame_num_;
+    // Sampled here rather than in the codec callbacks, which are timed.
+    peak_resident_size_bytes_ =
+        std::max(peak_resident_size_bytes_, rtc::GetProcessResidentSizeBytes());
 
     return frame;
   }
@@ -190,6 +212,9 @@ class TestRawVideoSource : public VideoCodecTester::RawVideoSource {
         .build();
   }
 
+  // Highest resident size of the process seen while pulling frames.
+  int64_t peak_resident_size_bytes() const { return peak_resident_size_bytes_; }
+
  protected:
   VideoInfo video_info_;
   std::unique_ptr<FrameReader> frame_reader_;
@@ -198,6 +223,7 @@ class TestRawVideoSource : public VideoCodecTester::RawVideoSource {
   int frame_num_;
   uint32_t timestamp_rtp_;
   std::map<uint32_t, int> pulled_frames_;
+  int64_t peak_resident_size_bytes_ = 0;
 };
 
 class TestEncoder : public VideoCodecTester::Encoder,
@@ -205,10 +231,12 @@ class TestEncoder : public VideoCodecTester::Encoder,
  public:
   TestEncoder(std::unique_ptr<VideoEncoder> encoder,
               const std::string codec_type,
-              const std::map<int, EncodingSettings>& frame_settings)
+              const std::map<int, EncodingSettings>& frame_settings,
+              const CodecSettings& codec_settings)
       : encoder_(std::move(encoder)),
         codec_type_(codec_type),
         frame_settings_(frame_settings),
+        codec_settings_(codec_settings),
         frame_num_(0) {
     // Ensure settings for the first frame is provided.
     RTC_CHECK_GT(frame_settings_.size(), 0u);
@@ -280,6 +308,7 @@ class TestEncoder : public VideoCodecTester::Encoder,
     vc.mode = webrtc::VideoCodecMode::kRealtimeVideo;
     vc.SetFrameDropEnabled(true);
     vc.SetScalabilityMode(es.scalability_mode);
+    vc.SetVideoEncoderComplexity(codec_settings_.complexity);
 
     vc.codecType = PayloadStringToCodecType(codec_type_);
     if (vc.codecType == kVideoCodecVP8) {
@@ -292,7 +321,7 @@ class TestEncoder : public VideoCodecTester::Encoder,
 
     VideoEncoder::Settings ves(
         VideoEncoder::Capabilities(/*loss_notification=*/false),
-        /*number_of_cores=*/1,
+        codec_settings_.num_cores,
         /*max_payload_size=*/1440);
 
     int result = encoder_->InitEncode(&vc, ves);
@@ -325,6 +354,7 @@ class TestEncoder : public VideoCodecTester::Encoder,
   std::unique_ptr<VideoEncoder> encoder_;
   const std::string codec_type_;
   const std::map<int, EncodingSettings>& frame_settings_;
+  const CodecSettings codec_settings_;
   int frame_num_;
   std::map<uint32_t, EncodeCallback> callbacks_ RTC_GUARDED_BY(mutex_);
   Mutex mutex_;
@@ -334,15 +364,18 @@ class TestDecoder : public VideoCodecTester::Decoder,
                     public DecodedImageCallback {
  public:
   TestDecoder(std::unique_ptr<VideoDecoder> decoder,
-              const std::string codec_type)
-      : decoder_(std::move(decoder)), codec_type_(codec_type) {
+              const std::string codec_type,
+              const CodecSettings& codec_settings)
+      : decoder_(std::move(decoder)),
+        codec_type_(codec_type),
+        codec_settings_(codec_settings) {
     decoder_->RegisterDecodeCompleteCallback(this);
   }
 
   void Initialize() override {
     VideoDecoder::Settings ds;
     ds.set_codec_type(PayloadStringToCodecType(codec_type_));
-    ds.set_number_of_cores(1);
+    ds.set_number_of_cores(codec_settings_.num_cores);
     ds.set_max_render_resolution({1280, 720});
 
     bool result = decoder_->Configure(ds);
@@ -381,6 +414,7 @@ class TestDecoder : public VideoCodecTester::Decoder,
 
   std::unique_ptr<VideoDecoder> decoder_;
   const std::string codec_type_;
+  const CodecSettings codec_settings_;
   std::map<uint32_t, DecodeCallback> callbacks_ RTC_GUARDED_BY(mutex_);
   Mutex mutex_;
 };
@@ -396,7 +430,8 @@ std::unique_ptr<TestRawVideoSource> CreateVideoSource(
 std::unique_ptr<TestEncoder> CreateEncoder(
     std::string type,
     std::string impl,
-    const std::map<int, EncodingSettings>& frame_settings) {
+    const std::map<int, EncodingSettings>& frame_settings,
+    const CodecSettings& codec_settings) {
   std::unique_ptr<VideoEncoderFactory> factory;
   if (impl == "builtin") {
     factory = std::make_unique<InternalEncoderFactory>();
@@ -412,10 +447,13 @@ std::unique_ptr<TestEncoder> CreateEncoder(
     return nullptr;
   }
   return std::make_unique<TestEncoder>(std::move(encoder), type,
-                                       frame_settings);
+                                       frame_settings, codec_settings);
 }
 
-std::unique_ptr<TestDecoder> CreateDecoder(std::string type, std::string impl) {
+std::unique_ptr<TestDecoder> CreateDecoder(
+    std::string type,
+    std::string impl,
+    const CodecSettings& codec_settings) {
   std::unique_ptr<VideoDecoderFactory> factory;
   if (impl == "builtin") {
     factory = std::make_unique<InternalDecoderFactory>();
@@ -430,7 +468,8 @@ std::unique_ptr<TestDecoder> CreateDecoder(std::string type, std::string impl) {
   if (decoder == nullptr) {
     return nullptr;
   }
-  return std::make_unique<TestDecoder>(std::move(decoder), type);
+  return std::make_unique<TestDecoder>(std::move(decoder), type,
+                                       codec_settings);
 }
 
 void SetTargetRates(const std::map<int, EncodingSettings>& frame_settings,
@@ -471,24 +510,27 @@ std::unique_ptr<VideoCodecStats> RunEncodeDecodeTest(
     const std::map<int, EncodingSettings>& frame_settings,
     int num_frames,
     bool save_codec_input,
-    bool save_codec_output) {
+    bool save_codec_output,
+    const CodecSettings& codec_settings = {},
+    ResourceUsage* resource_usage = nullptr) {
   std::unique_ptr<TestRawVideoSource> video_source =
       CreateVideoSource(video_info, frame_settings, num_frames);
 
   std::unique_ptr<TestEncoder> encoder =
-      CreateEncoder(codec_type, codec_impl, frame_settings);
+      CreateEncoder(codec_type, codec_impl, frame_settings, codec_settings);
   if (encoder == nullptr) {
     return nullptr;
   }
 
-  std::unique_ptr<TestDecoder> decoder = CreateDecoder(codec_type, codec_impl);
+  std::unique_ptr<TestDecoder> decoder =
+      CreateDecoder(codec_type, codec_impl, codec_settings);
   if (decoder == nullptr) {
     // If platform decoder is not available try built-in one.
     if (codec_impl == "builtin") {
       return nullptr;
     }
 
-    decoder = CreateDecoder(codec_type, "builtin");
+    decoder = CreateDecoder(codec_type, "builtin", codec_settings);
     if (decoder == nullptr) {
       return nullptr;
     }
@@ -522,9 +564,20 @@ std::unique_ptr<VideoCodecStats> RunEncodeDecodeTest(
   }
 
   std::unique_ptr<VideoCodecTester> tester = CreateVideoCodecTester();
-  return tester->RunEncodeDecodeTest(video_source.get(), encoder.get(),
-                                     decoder.get(), encoder_settings,
-                                     decoder_settings);
+  const int64_t start_time_us = rtc::TimeMicros();
+  const int64_t start_cpu_time_ns = rtc::GetProcessCpuTimeNanos();
+  std::unique_ptr<VideoCodecStats> stats = tester->RunEncodeDecodeTest(
+      video_source.get(), encoder.get(), decoder.get(), encoder_settings,
+      decoder_settings);
+  if (resource_usage != nullptr) {
+    resource_usage->wall_time =
+        TimeDelta::Micros(rtc::TimeMicros() - start_time_us);
+    resource_usage->cpu_time = TimeDelta::Micros(
+        (rtc::GetProcessCpuTimeNanos() - start_cpu_time_ns) / 1000);
+    resource_usage->peak_resident_size_bytes =
+        video_source->peak_resident_size_bytes();
+  }
+  return stats;
 }
 
 std::unique_ptr<VideoCodecStats> RunEncodeTest(
@@ -539,7 +592,7 @@ std::unique_ptr<VideoCodecStats> RunEncodeTest(
       CreateVideoSource(video_info, frame_settings, num_frames);
 
   std::unique_ptr<TestEncoder> encoder =
-      CreateEncoder(codec_type, codec_impl, frame_settings);
+      CreateEncoder(codec_type, codec_impl, frame_settings, CodecSettings());
   if (encoder == nullptr) {
     return nullptr;
   }
@@ -806,6 +859,203 @@ INSTANTIATE_TEST_SUITE_P(All,
                                  Values(std::pair(30, 15), std::pair(15, 30))),
                          FramerateAdaptationTest::TestParamsToString);
 
+struct RateSweep {
+  Resolution resolution;
+  std::vector<int> bitrates_kbps;
+};
+
+std::string ComplexityToString(VideoCodecComplexity complexity) {
+  switch (complexity) {
+    case VideoCodecComplexity::kComplexityLow:
+      return "low";
+    case VideoCodecComplexity::kComplexityNormal:
+      return "normal";
+    case VideoCodecComplexity::kComplexityHigh:
+      return "high";
+    case VideoCodecComplexity::kComplexityHigher:
+      return "higher";
+    case VideoCodecComplexity::kComplexityMax:
+      return "max";
+  }
+  RTC_CHECK_NOTREACHED();
+}
+
+// Encodes and decodes a video at each bitrate of a sweep, for a matrix of
+// codecs, resolutions, complexities (speed presets) and thread counts, and
+// reports throughput, CPU time, peak memory, and the BD-rate relative to
+// normal complexity on one core.
+class CodecPerformanceTest
+    : public ::testing::TestWithParam<std::tuple</*codec_type=*/std::string,
+                                                 /*codec_impl=*/std::string,
+                                                 VideoInfo,
+                                                 RateSweep,
+                                                 VideoCodecComplexity,
+                                                 /*num_cores=*/int>> {
+ public:
+  static std::string TestParamsToString(
+      const ::testing::TestParamInfo<CodecPerformanceTest::ParamType>& info) {
+    auto [codec_type, codec_impl, video_info, sweep, complexity, num_cores] =
+        info.param;
+    return std::string(codec_type + codec_impl + video_info.name +
+                       std::to_string(sweep.resolution.width) + "x" +
+                       std::to_string(sweep.resolution.height) +
+                       ComplexityToString(complexity) + "complexity" +
+                       std::to_string(num_cores) + "cores");
+  }
+
+ protected:
+  struct Result {
+    std::vector<RdPoint> rd_curve;
+    // Totals over the sweep.
+    int num_frames = 0;
+    SamplesStatsCounter encode_time_ms;
+    SamplesStatsCounter decode_time_ms;
+    ResourceUsage resource_usage;
+  };
+
+  static absl::optional<Result> RunSweep(const std::string& codec_type,
+                                         const std::string& codec_impl,
+                                         const VideoInfo& video_info,
+                                         const RateSweep& sweep,
+                                         const CodecSettings& codec_settings) {
+    const int duration_s = 5;
+    const int num_frames =
+        duration_s * video_info.framerate.millihertz() / 1000;
+    Result result;
+    for (int bitrate_kbps : sweep.bitrates_kbps) {
+      std::map<int, EncodingSettings> frame_settings = {
+          {0,
+           {.scalability_mode = ScalabilityMode::kL1T1,
+            .layer_settings = {
+                {LayerId{.spatial_idx = 0, .temporal_idx = 0},
+                 {.resolution = sweep.resolution,
+                  .framerate = video_info.framerate,
+                  .bitrate = DataRate::KilobitsPerSec(bitrate_kbps)}}}}}};
+      ResourceUsage resource_usage;
+      std::unique_ptr<VideoCodecStats> stats = RunEncodeDecodeTest(
+          codec_type, codec_impl, video_info, frame_settings, num_frames,
+          /*save_codec_input=*/false, /*save_codec_output=*/false,
+          codec_settings, &resource_usage);
+      if (stats == nullptr) {
+        return absl::nullopt;
+      }
+      std::vector<VideoCodecStats::Frame> frames = stats->Slice();
+      SetTargetRates(frame_settings, frames);
+      VideoCodecStats::Stream stream = stats->Aggregate(frames);
+      result.rd_curve.push_back(
+          {.bitrate_kbps = stream.encoded_bitrate_kbps.GetAverage(),
+           .psnr = stream.psnr.y.GetAverage()});
+      result.num_frames += num_frames;
+      result.encode_time_ms.AddSamples(stream.encode_time_ms);
+      result.decode_time_ms.AddSamples(stream.decode_time_ms);
+      result.resource_usage.wall_time += resource_usage.wall_time;
+      result.resource_usage.cpu_time += resource_usage.cpu_time;
+      result.resource_usage.peak_resident_size_bytes =
+          std::max(result.resource_usage.peak_resident_size_bytes,
+                   resource_usage.peak_resident_size_bytes);
+    }
+    return result;
+  }
+
+  // Returns the RD curve of normal complexity on one core for the same codec,
+  // video and resolution, which is measured once.
+  static const std::vector<RdPoint>* AnchorCurve(
+      const std::string& codec_type,
+      const std::string& codec_impl,
+      const VideoInfo& video_info,
+      const RateSweep& sweep) {
+    static auto* const anchors =
+        new std::map<std::string, std::vector<RdPoint>>();
+    const std::string key = codec_type + codec_impl + video_info.name +
+                            std::to_string(sweep.resolution.width) + "x" +
+                            std::to_string(sweep.resolution.height);
+    auto it = anchors->find(key);
+    if (it == anchors->end()) {
+      absl::optional<Result> anchor = RunSweep(
+          codec_type, codec_impl, video_info, sweep, CodecSettings());
+      if (!anchor) {
+        return nullptr;
+      }
+      it = anchors->emplace(key, std::move(anchor->rd_curve)).first;
+    }
+    return &it->second;
+  }
+};
+
+TEST_P(CodecPerformanceTest, Performance) {
+  auto [codec_type, codec_impl, video_info, sweep, complexity, num_cores] =
+      GetParam();
+  const CodecSettings codec_settings = {.complexity = complexity,
+                                        .num_cores = num_cores};
+
+  absl::optional<Result> result =
+      RunSweep(codec_type, codec_impl, video_info, sweep, codec_settings);
+  if (!result) {
+    return;
+  }
+  const std::vector<RdPoint>* anchor =
+      AnchorCurve(codec_type, codec_impl, video_info, sweep);
+
+  const std::string test_case_name =
+      ::testing::UnitTest::GetInstance()->current_test_info()->name();
+  const std::map<std::string, std::string> metadata = {
+      {"codec_type", codec_type},
+      {"codec_impl", codec_impl},
+      {"video_name", video_info.name},
+      {"complexity", ComplexityToString(complexity)},
+      {"num_cores", std::to_string(num_cores)}};
+  MetricsLogger* logger = GetGlobalMetricsLogger();
+  const ResourceUsage& usage = result->resource_usage;
+  logger->LogSingleValueMetric(
+      "encode_decode_fps", test_case_name,
+      result->num_frames / usage.wall_time.seconds<double>(), Unit::kHertz,
+      ImprovementDirection::kBiggerIsBetter, metadata);
+  logger->LogMetric("encode_time_ms", test_case_name,
+                    result->encode_time_ms, Unit::kMilliseconds,
+                    ImprovementDirection::kSmallerIsBetter, metadata);
+  logger->LogMetric("decode_time_ms", test_case_name,
+                    result->decode_time_ms, Unit::kMilliseconds,
+                    ImprovementDirection::kSmallerIsBetter, metadata);
+  logger->LogSingleValueMetric(
+      "cpu_time_per_frame_ms", test_case_name,
+      usage.cpu_time.ms<double>() / result->num_frames, Unit::kMilliseconds,
+      ImprovementDirection::kSmallerIsBetter, metadata);
+  logger->LogSingleValueMetric(
+      "peak_resident_size", test_case_name, usage.peak_resident_size_bytes,
+      Unit::kBytes, ImprovementDirection::kSmallerIsBetter, metadata);
+  if (anchor != nullptr) {
+    absl::optional<double> bd_rate = BdRatePercent(*anchor, result->rd_curve);
+    if (bd_rate) {
+      logger->LogSingleValueMetric("bd_rate", test_case_name, *bd_rate,
+                                   Unit::kPercent,
+                                   ImprovementDirection::kSmallerIsBetter,
+                                   metadata);
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    All,
+    CodecPerformanceTest,
+    Combine(Values("AV1", "VP9", "VP8", "H264", "H265"),
+#if defined(WEBRTC_ANDROID)
+            Values("builtin", "mediacodec"),
+#else
+            Values("builtin"),
+#endif
+            Values(kFourPeople_1280x720_30),
+            Values(RateSweep{.resolution = {.width = 320, .height = 180},
+                             .bitrates_kbps = {32, 64, 128, 256}},
+                   RateSweep{.resolution = {.width = 640, .height = 360},
+                             .bitrates_kbps = {128, 256, 384, 512}},
+                   RateSweep{.resolution = {.width = 1280, .height = 720},
+                             .bitrates_kbps = {256, 512, 1024, 2048}}),
+            Values(VideoCodecComplexity::kComplexityLow,
+                   VideoCodecComplexity::kComplexityNormal,
+                   VideoCodecComplexity::kComplexityHigh),
+            Values(1, 4)),
+    CodecPerformanceTest::TestParamsToString);
+
 }  // namespace test
 
 }  // namespace webrtc
@@ -22,6 +22,7 @@
 #include "absl/memory/memory.h"
 #include "absl/strings/match.h"
 #include "absl/types/optional.h"
+#include "api/units/time_delta.h"
 #include "api/video/color_space.h"
 #include "api/video/i010_buffer.h"
 #include "api/video_codecs/scalability_mode.h"
@@ -33,6 +34,7 @@
 #include "modules/video_coding/svc/scalability_mode_util.h"
 #include "modules/video_coding/svc/scalable_video_controller.h"
 #include "modules/video_coding/svc/scalable_video_controller_no_layering.h"
+#include "modules/video_coding/svc/spatial_layer_encode_budget.h"
 #include "modules/video_coding/svc/svc_rate_allocator.h"
 #include "modules/video_coding/utility/vp9_uncompressed_header_parser.h"
 #include "rtc_base/checks.h"
@@ -265,6 +267,10 @@ LibvpxVp9Encoder::LibvpxVp9Encoder(const cricket::VideoCodec& codec,
       config_changed_(true) {
   codec_ = {};
   memset(&svc_params_, 0, sizeof(vpx_svc_extra_cfg_t));
+  if (absl::optional<SpatialLayerEncodeBudget::Config> budget_config =
+          SpatialLayerEncodeBudget::ParseFieldTrial(trials)) {
+    encode_budget_ = std::make_unique<SpatialLayerEncodeBudget>(*budget_config);
+  }
 }
 
 LibvpxVp9Encoder::~LibvpxVp9Encoder() {
@@ -611,6 +617,9 @@ int LibvpxVp9Encoder::InitEncode(const VideoCodec* inst,
 
   framerate_controller_ = std::vector<FramerateControllerDeprecated>(
       num_spatial_layers_, FramerateControllerDeprecated(codec_.maxFramerate));
+  if (encode_budget_) {
+    encode_budget_->Reset();
+  }
 
   is_svc_ = (num_spatial_layers_ > 1 || num_temporal_layers_ > 1);
 
@@ -1013,6 +1022,12 @@ int LibvpxVp9Encoder::Encode(const VideoFrame& input_image,
     if (layer_frames_.front().IsKeyframe()) {
       force_key_frame_ = true;
     }
+    // Skip the top spatial layers of this frame rather than the whole
+    // picture when encoding all of them would miss the frame deadline.
+    layers_dropped_by_budget_ =
+        encode_budget_ &&
+        encode_budget_->DropLayersOverBudget(
+            layer_frames_, TimeDelta::Seconds(1) / codec_.maxFramerate) > 0;
   }
 
   vpx_svc_layer_id_t layer_id = {0};
@@ -1255,6 +1270,7 @@ int LibvpxVp9Encoder::Encode(const VideoFrame& input_image,
                          .GetTargetRate())
           : codec_.maxFramerate;
   uint32_t duration = static_cast<uint32_t>(90000 / target_framerate_fps);
+  layer_encode_start_us_ = rtc::TimeMicros();
   const vpx_codec_err_t rv = libvpx_->codec_encode(
       encoder_, raw_, timestamp_, duration, flags, VPX_DL_REALTIME);
   if (rv != VPX_CODEC_OK) {
@@ -1693,14 +1709,23 @@ vpx_svc_ref_frame_config_t LibvpxVp9Encoder::SetReferences(
 void LibvpxVp9Encoder::GetEncodedLayerFrame(const vpx_codec_cx_pkt* pkt) {
   RTC_DCHECK_EQ(pkt->kind, VPX_CODEC_CX_FRAME_PKT);
 
+  vpx_svc_layer_id_t layer_id = {0};
+  libvpx_->codec_control(encoder_, VP9E_GET_SVC_LAYER_ID, &layer_id);
+  if (encode_budget_) {
+    // Layers are output as soon as they are encoded, so the time since the
+    // previous layer is the encode time of this one.
+    const int64_t now_us = rtc::TimeMicros();
+    encode_budget_->OnLayerEncoded(
+        layer_id.spatial_layer_id,
+        TimeDelta::Micros(now_us - layer_encode_start_us_));
+    layer_encode_start_us_ = now_us;
+  }
+
   if (pkt->data.frame.sz == 0) {
     // Ignore dropped frame.
     return;
   }
 
-  vpx_svc_layer_id_t layer_id = {0};
-  libvpx_->codec_control(encoder_, VP9E_GET_SVC_LAYER_ID, &layer_id);
-
   encoded_image_.SetEncodedData(EncodedImageBuffer::Create(
       static_cast<const uint8_t*>(pkt->data.frame.buf), pkt->data.frame.sz));
 
@@ -1745,8 +1770,11 @@ void LibvpxVp9Encoder::GetEncodedLayerFrame(const vpx_codec_cx_pkt* pkt) {
   libvpx_->codec_control(encoder_, VP8E_GET_LAST_QUANTIZER, &qp);
   encoded_image_.qp_ = qp;
 
+  const int num_encoded_spatial_layers =
+      layers_dropped_by_budget_ ? layer_frames_.back().SpatialId() + 1
+                                : num_active_spatial_layers_;
   const bool end_of_picture = encoded_image_.SpatialIndex().value_or(0) + 1 ==
-                              num_active_spatial_layers_;
+                              num_encoded_spatial_layers;
   DeliverBufferedFrame(end_of_picture);
 }
 
@@ -28,6 +28,7 @@
 #include "modules/video_coding/codecs/vp9/include/vp9.h"
 #include "modules/video_coding/codecs/vp9/vp9_frame_buffer_pool.h"
 #include "modules/video_coding/svc/scalable_video_controller.h"
+#include "modules/video_coding/svc/spatial_layer_encode_budget.h"
 #include "modules/video_coding/utility/framerate_controller_deprecated.h"
 #include "rtc_base/containers/flat_map.h"
 #include "rtc_base/experiments/encoder_info_settings.h"
@@ -168,6 +169,12 @@ class LibvpxVp9Encoder : public VP9Encoder {
   std::array<RefFrameBuffer, kNumVp9Buffers> ref_buf_;
   std::vector<ScalableVideoController::LayerFrameConfig> layer_frames_;
 
+  // Set when CPU-aware layer dropping is enabled by field trial.
+  std::unique_ptr<SpatialLayerEncodeBudget> encode_budget_;
+  // True if the top spatial layers of the current picture were dropped.
+  bool layers_dropped_by_budget_ = false;
+  int64_t layer_encode_start_us_ = 0;
+
   // Variable frame-rate related fields and methods.
   const struct VariableFramerateExperiment {
     bool enabled;
@@ -47,6 +47,20 @@ H264SpsPpsTracker::SpsInfo::~SpsInfo() = default;
 H264SpsPpsTracker::FixedBitstream H264SpsPpsTracker::CopyAndFixBitstream(
     rtc::ArrayView<const uint8_t> bitstream,
     RTPVideoHeader* video_header) {
+  return FixBitstream(bitstream, /*shared_bitstream=*/nullptr, video_header);
+}
+
+H264SpsPpsTracker::FixedBitstream H264SpsPpsTracker::FixBitstream(
+    const rtc::CopyOnWriteBuffer& bitstream,
+    RTPVideoHeader* video_header) {
+  return FixBitstream(rtc::MakeArrayView(bitstream.cdata(), bitstream.size()),
+                      &bitstream, video_header);
+}
+
+H264SpsPpsTracker::FixedBitstream H264SpsPpsTracker::FixBitstream(
+    rtc::ArrayView<const uint8_t> bitstream,
+    const rtc::CopyOnWriteBuffer* shared_bitstream,
+    RTPVideoHeader* video_header) {
   RTC_DCHECK(video_header);
   RTC_DCHECK(video_header->codec == kVideoCodecH264);
   RTC_DCHECK_GT(bitstream.size(), 0);
@@ -119,6 +133,13 @@ H264SpsPpsTracker::FixedBitstream H264SpsPpsTracker::CopyAndFixBitstream(
   RTC_CHECK(!append_sps_pps ||
             (sps != sps_data_.end() && pps != pps_data_.end()));
 
+  // Without start codes nor parameter sets to insert, the data is unchanged.
+  if (shared_bitstream && !append_sps_pps &&
+      h264_header.packetization_type != kH264StapA &&
+      h264_header.nalus_length == 0) {
+    return {kInsert, *shared_bitstream};
+  }
+
   // Calculate how much space we need for the rest of the bitstream.
   size_t required_size = 0;
 
@@ -38,11 +38,22 @@ class H264SpsPpsTracker {
   // Returns fixed bitstream and modifies `video_header`.
   FixedBitstream CopyAndFixBitstream(rtc::ArrayView<const uint8_t> bitstream,
                                      RTPVideoHeader* video_header);
+  // Like CopyAndFixBitstream(), but shares `bitstream` instead of copying it
+  // when it needs no start code nor parameter sets, e.g. for the continuation
+  // fragments of FU-A NAL units.
+  FixedBitstream FixBitstream(const rtc::CopyOnWriteBuffer& bitstream,
+                              RTPVideoHeader* video_header);
 
   void InsertSpsPpsNalus(const std::vector<uint8_t>& sps,
                          const std::vector<uint8_t>& pps);
 
  private:
+  // Fixes `bitstream`. If `shared_bitstream` is not null, it holds the same
+  // data as `bitstream` and is returned unless the data must be modified.
+  FixedBitstream FixBitstream(rtc::ArrayView<const uint8_t> bitstream,
+                              const rtc::CopyOnWriteBuffer* shared_bitstream,
+                              RTPVideoHeader* video_header);
+
   struct PpsInfo {
     PpsInfo();
     PpsInfo(PpsInfo&& rhs);
@@ -129,6 +129,38 @@ TEST_F(TestH264SpsPpsTracker, NoNalus) {
   EXPECT_THAT(Bitstream(fixed), ElementsAreArray(data));
 }
 
+TEST_F(TestH264SpsPpsTracker, NoNalusSharesBitstream) {
+  const uint8_t data[] = {1, 2, 3};
+  const rtc::CopyOnWriteBuffer bitstream(data);
+  H264VideoHeader header;
+  header.h264().packetization_type = kH264FuA;
+
+  H264SpsPpsTracker::FixedBitstream fixed =
+      tracker_.FixBitstream(bitstream, &header);
+
+  EXPECT_EQ(fixed.action, H264SpsPpsTracker::kInsert);
+  EXPECT_EQ(fixed.bitstream.cdata(), bitstream.cdata());
+  EXPECT_THAT(Bitstream(fixed), ElementsAreArray(data));
+}
+
+TEST_F(TestH264SpsPpsTracker, FuAFirstPacketCopiesSharedBitstream) {
+  const uint8_t data[] = {1, 2, 3};
+  const rtc::CopyOnWriteBuffer bitstream(data);
+  H264VideoHeader header;
+  header.h264().packetization_type = kH264FuA;
+  header.h264().nalus_length = 1;
+  header.is_first_packet_in_frame = true;
+
+  H264SpsPpsTracker::FixedBitstream fixed =
+      tracker_.FixBitstream(bitstream, &header);
+
+  EXPECT_EQ(fixed.action, H264SpsPpsTracker::kInsert);
+  std::vector<uint8_t> expected;
+  expected.insert(expected.end(), start_code, start_code + sizeof(start_code));
+  expected.insert(expected.end(), {1, 2, 3});
+  EXPECT_THAT(Bitstream(fixed), ElementsAreArray(expected));
+}
+
 TEST_F(TestH264SpsPpsTracker, FuAFirstPacket) {
   uint8_t data[] = {1, 2, 3};
   H264VideoHeader header;
@@ -114,6 +114,7 @@ NackRequester::NackRequester(TaskQueueBase* current_queue,
       clock_(clock),
       nack_sender_(nack_sender),
       keyframe_request_sender_(keyframe_request_sender),
+      num_unsent_nacks_(0),
       reordering_histogram_(kNumReorderingBuckets, kMaxReorderedPackets),
       initialized_(false),
       rtt_(kDefaultRtt),
@@ -171,11 +172,11 @@ int NackRequester::OnReceivedPacket(uint16_t seq_num,
 
   if (AheadOf(newest_seq_num_, seq_num)) {
     // An out of order packet has been received.
-    auto nack_list_it = nack_list_.find(seq_num);
+    auto nack_list_it = FindFirstNotOlder(seq_num);
     int nacks_sent_for_packet = 0;
-    if (nack_list_it != nack_list_.end()) {
-      nacks_sent_for_packet = nack_list_it->second.retries;
-      nack_list_.erase(nack_list_it);
+    if (nack_list_it != nack_list_.end() && nack_list_it->seq_num == seq_num) {
+      nacks_sent_for_packet = nack_list_it->retries;
+      EraseNacks(nack_list_it, nack_list_it + 1);
     }
     if (!is_retransmitted)
       UpdateReorderingStatistics(seq_num);
@@ -224,7 +225,7 @@ void NackRequester::ClearUpTo(uint16_t seq_num) {
   // needs to be posted to the worker thread if callers migrate to the network
   // thread.
   RTC_DCHECK_RUN_ON(worker_thread_);
-  nack_list_.erase(nack_list_.begin(), nack_list_.lower_bound(seq_num));
+  EraseNacks(nack_list_.begin(), FindFirstNotOlder(seq_num));
   keyframe_list_.erase(keyframe_list_.begin(),
                        keyframe_list_.lower_bound(seq_num));
   recovered_list_.erase(recovered_list_.begin(),
@@ -239,12 +240,12 @@ void NackRequester::UpdateRtt(int64_t rtt_ms) {
 bool NackRequester::RemovePacketsUntilKeyFrame() {
   // Called on worker_thread_.
   while (!keyframe_list_.empty()) {
-    auto it = nack_list_.lower_bound(*keyframe_list_.begin());
+    auto it = FindFirstNotOlder(*keyframe_list_.begin());
 
     if (it != nack_list_.begin()) {
       // We have found a keyframe that actually is newer than at least one
       // packet in the nack list.
-      nack_list_.erase(nack_list_.begin(), it);
+      EraseNacks(nack_list_.begin(), it);
       return true;
     }
 
@@ -259,8 +260,8 @@ void NackRequester::AddPacketsToNack(uint16_t seq_num_start,
                                      uint16_t seq_num_end) {
   // Called on worker_thread_.
   // Remove old packets.
-  auto it = nack_list_.lower_bound(seq_num_end - kMaxPacketAge);
-  nack_list_.erase(nack_list_.begin(), it);
+  EraseNacks(nack_list_.begin(),
+             FindFirstNotOlder(seq_num_end - kMaxPacketAge));
 
   // If the nack list is too large, remove packets from the nack list until
   // the latest first packet of a keyframe. If the list is still too large,
@@ -273,6 +274,7 @@ void NackRequester::AddPacketsToNack(uint16_t seq_num_start,
 
     if (nack_list_.size() + num_new_nacks > kMaxNackPackets) {
       nack_list_.clear();
+      num_unsent_nacks_ = 0;
       RTC_LOG(LS_WARNING) << "NACK list full, clearing NACK"
                              " list and requesting keyframe.";
       keyframe_request_sender_->RequestKeyFrame();
@@ -286,11 +288,32 @@ void NackRequester::AddPacketsToNack(uint16_t seq_num_start,
       continue;
     NackInfo nack_info(seq_num, seq_num + WaitNumberOfPackets(0.5),
                        clock_->CurrentTime());
-    RTC_DCHECK(nack_list_.find(seq_num) == nack_list_.end());
-    nack_list_[seq_num] = nack_info;
+    RTC_DCHECK(nack_list_.empty() ||
+               AheadOf(seq_num, nack_list_.back().seq_num));
+    nack_list_.push_back(nack_info);
+    ++num_unsent_nacks_;
   }
 }
 
+std::deque<NackRequester::NackInfo>::iterator NackRequester::FindFirstNotOlder(
+    uint16_t seq_num) {
+  // Called on worker_thread_.
+  return std::lower_bound(nack_list_.begin(), nack_list_.end(), seq_num,
+                          [](const NackInfo& nack_info, uint16_t seq_num) {
+                            return AheadOf(seq_num, nack_info.seq_num);
+                          });
+}
+
+void NackRequester::EraseNacks(std::deque<NackInfo>::iterator first,
+                               std::deque<NackInfo>::iterator last) {
+  // Called on worker_thread_.
+  for (auto it = first; it != last; ++it) {
+    if (it->sent_at_time.IsInfinite())
+      --num_unsent_nacks_;
+  }
+  nack_list_.erase(first, last);
+}
+
 std::vector<uint16_t> NackRequester::GetNackBatch(NackFilterOptions options) {
   // Called on worker_thread_.
 
@@ -299,27 +322,46 @@ std::vector<uint16_t> NackRequester::GetNackBatch(NackFilterOptions options) {
   Timestamp now = clock_->CurrentTime();
   std::vector<uint16_t> nack_batch;
   auto it = nack_list_.begin();
-  while (it != nack_list_.end()) {
-    bool delay_timed_out = now - it->second.created_at_time >= send_nack_delay_;
-    bool nack_on_rtt_passed = now - it->second.sent_at_time >= rtt_;
+  if (!consider_timestamp) {
+    // Packets that have been nacked are only nacked again by time, so start
+    // at the oldest packet that has not. Packets are mostly nacked in order,
+    // so search for it from the newest packet.
+    size_t num_unsent = 0;
+    it = nack_list_.end();
+    while (num_unsent < num_unsent_nacks_) {
+      --it;
+      if (it->sent_at_time.IsInfinite())
+        ++num_unsent;
+    }
+  }
+  bool max_retries_reached = false;
+  for (; it != nack_list_.end(); ++it) {
+    bool delay_timed_out = now - it->created_at_time >= send_nack_delay_;
+    bool nack_on_rtt_passed = now - it->sent_at_time >= rtt_;
     bool nack_on_seq_num_passed =
-        it->second.sent_at_time.IsInfinite() &&
-        AheadOrAt(newest_seq_num_, it->second.send_at_seq_num);
+        it->sent_at_time.IsInfinite() &&
+        AheadOrAt(newest_seq_num_, it->send_at_seq_num);
     if (delay_timed_out && ((consider_seq_num && nack_on_seq_num_passed) ||
                             (consider_timestamp && nack_on_rtt_passed))) {
-      nack_batch.emplace_back(it->second.seq_num);
-      ++it->second.retries;
-      it->second.sent_at_time = now;
-      if (it->second.retries >= kMaxNackRetries) {
-        RTC_LOG(LS_WARNING) << "Sequence number " << it->second.seq_num
+      nack_batch.emplace_back(it->seq_num);
+      if (it->sent_at_time.IsInfinite())
+        --num_unsent_nacks_;
+      ++it->retries;
+      it->sent_at_time = now;
+      if (it->retries >= kMaxNackRetries) {
+        RTC_LOG(LS_WARNING) << "Sequence number " << it->seq_num
                             << " removed from NACK list due to max retries.";
-        it = nack_list_.erase(it);
-      } else {
-        ++it;
+        max_retries_reached = true;
       }
-      continue;
     }
-    ++it;
+  }
+  if (max_retries_reached) {
+    nack_list_.erase(std::remove_if(nack_list_.begin(), nack_list_.end(),
+                                    [](const NackInfo& nack_info) {
+                                      return nack_info.retries >=
+                                             kMaxNackRetries;
+                                    }),
+                     nack_list_.end());
   }
   return nack_batch;
 }
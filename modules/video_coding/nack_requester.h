@@ -13,7 +13,7 @@
 
 #include <stdint.h>
 
-#include <map>
+#include <deque>
 #include <set>
 #include <vector>
 
@@ -108,6 +108,14 @@ class NackRequester final : public NackRequesterBase {
   void AddPacketsToNack(uint16_t seq_num_start, uint16_t seq_num_end)
       RTC_EXCLUSIVE_LOCKS_REQUIRED(worker_thread_);
 
+  // Returns the first packet in the nack list that is not older than
+  // `seq_num`.
+  std::deque<NackInfo>::iterator FindFirstNotOlder(uint16_t seq_num)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(worker_thread_);
+  void EraseNacks(std::deque<NackInfo>::iterator first,
+                  std::deque<NackInfo>::iterator last)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(worker_thread_);
+
   // Removes packets from the nack list until the next keyframe. Returns true
   // if packets were removed.
   bool RemovePacketsUntilKeyFrame()
@@ -132,8 +140,14 @@ class NackRequester final : public NackRequesterBase {
   // TODO(philipel): Some of the variables below are consistently used on a
   // known thread (e.g. see `initialized_`). Those probably do not need
   // synchronized access.
-  std::map<uint16_t, NackInfo, DescendingSeqNumComp<uint16_t>> nack_list_
-      RTC_GUARDED_BY(worker_thread_);
+  // Ordered by sequence number, oldest first. New packets are always newer
+  // than the ones in the list, so they are appended without an allocation per
+  // packet, and packets are found by binary search.
+  std::deque<NackInfo> nack_list_ RTC_GUARDED_BY(worker_thread_);
+  // Number of packets in `nack_list_` that have not been nacked yet. Only
+  // those can be nacked by sequence number, which happens on every received
+  // packet, so this bounds the search for them.
+  size_t num_unsent_nacks_ RTC_GUARDED_BY(worker_thread_);
   std::set<uint16_t, DescendingSeqNumComp<uint16_t>> keyframe_list_
       RTC_GUARDED_BY(worker_thread_);
   std::set<uint16_t, DescendingSeqNumComp<uint16_t>> recovered_list_
@@ -324,6 +324,23 @@ TEST_F(TestNackRequester, PacketNackCount) {
   EXPECT_EQ(0, nack_module.OnReceivedPacket(4, false, false));
 }
 
+TEST_F(TestNackRequester, NewPacketsOnlyNackNewGaps) {
+  NackRequester& nack_module = CreateNackModule();
+  nack_module.OnReceivedPacket(0, false, false);
+  nack_module.OnReceivedPacket(10, false, false);
+  ASSERT_EQ(9u, sent_nacks_.size());
+
+  sent_nacks_.clear();
+  EXPECT_EQ(1, nack_module.OnReceivedPacket(5, false, false));
+  nack_module.OnReceivedPacket(11, false, false);
+  EXPECT_TRUE(sent_nacks_.empty());
+
+  nack_module.OnReceivedPacket(14, false, false);
+  ASSERT_EQ(2u, sent_nacks_.size());
+  EXPECT_EQ(12, sent_nacks_[0]);
+  EXPECT_EQ(13, sent_nacks_[1]);
+}
+
 TEST_F(TestNackRequester, NackListFullAndNoOverlapWithKeyframes) {
   NackRequester& nack_module = CreateNackModule();
   const int kMaxNackPackets = 1000;
@@ -243,14 +243,21 @@ std::vector<std::unique_ptr<PacketBuffer::Packet>> PacketBuffer::FindFrames(
 
     size_t index = seq_num % buffer_.size();
     buffer_[index]->continuous = true;
+    // Keep track of where the frame starts, so that it doesn't have to be
+    // searched for when its last packet arrives.
+    if (buffer_[index]->is_first_packet_in_frame()) {
+      buffer_[index]->frame_start_seq_num = seq_num;
+    } else {
+      size_t prev_index = index > 0 ? index - 1 : buffer_.size() - 1;
+      buffer_[index]->frame_start_seq_num =
+          buffer_[prev_index]->frame_start_seq_num;
+    }
 
     // If all packets of the frame is continuous, find the first packet of the
     // frame and add all packets of the frame to the returned packets.
     if (buffer_[index]->is_last_packet_in_frame()) {
       uint16_t start_seq_num = seq_num;
 
-      // Find the start index by searching backward until the packet with
-      // the `frame_begin` flag is set.
       int start_index = index;
       size_t tested_packets = 0;
       int64_t frame_timestamp = buffer_[start_index]->timestamp;
@@ -266,45 +273,46 @@ std::vector<std::unique_ptr<PacketBuffer::Packet>> PacketBuffer::FindFrames(
       int idr_width = -1;
       int idr_height = -1;
       bool full_frame_found = false;
-      while (true) {
+      if (!is_h264_descriptor) {
+        // The packets from the one with the `frame_begin` flag set up to this
+        // one are continuous, unless the first ones have been cleared since.
+        start_seq_num = buffer_[index]->frame_start_seq_num;
+        const auto& start_entry = buffer_[start_seq_num % buffer_.size()];
+        full_frame_found = start_entry != nullptr &&
+                           start_entry->seq_num == start_seq_num &&
+                           start_entry->is_first_packet_in_frame();
+      }
+      // For H.264 the start is found by searching backward, collecting the
+      // NALUs of the frame on the way.
+      while (is_h264_descriptor) {
         ++tested_packets;
 
-        if (!is_h264_descriptor) {
-          if (buffer_[start_index] == nullptr ||
-              buffer_[start_index]->is_first_packet_in_frame()) {
-            full_frame_found = buffer_[start_index] != nullptr;
-            break;
-          }
-        }
+        const auto* h264_header = absl::get_if<RTPVideoHeaderH264>(
+            &buffer_[start_index]->video_header.video_type_header);
+        if (!h264_header || h264_header->nalus_length >= kMaxNalusPerPacket)
+          return found_frames;
 
-        if (is_h264_descriptor) {
-          const auto* h264_header = absl::get_if<RTPVideoHeaderH264>(
-              &buffer_[start_index]->video_header.video_type_header);
-          if (!h264_header || h264_header->nalus_length >= kMaxNalusPerPacket)
-            return found_frames;
-
-          for (size_t j = 0; j < h264_header->nalus_length; ++j) {
-            if (h264_header->nalus[j].type == H264::NaluType::kSps) {
-              has_h264_sps = true;
-            } else if (h264_header->nalus[j].type == H264::NaluType::kPps) {
-              has_h264_pps = true;
-            } else if (h264_header->nalus[j].type == H264::NaluType::kIdr) {
-              has_h264_idr = true;
-            }
+        for (size_t j = 0; j < h264_header->nalus_length; ++j) {
+          if (h264_header->nalus[j].type == H264::NaluType::kSps) {
+            has_h264_sps = true;
+          } else if (h264_header->nalus[j].type == H264::NaluType::kPps) {
+            has_h264_pps = true;
+          } else if (h264_header->nalus[j].type == H264::NaluType::kIdr) {
+            has_h264_idr = true;
           }
-          if ((sps_pps_idr_is_h264_keyframe_ && has_h264_idr && has_h264_sps &&
-               has_h264_pps) ||
-              (!sps_pps_idr_is_h264_keyframe_ && has_h264_idr)) {
-            is_h264_keyframe = true;
-            // Store the resolution of key frame which is the packet with
-            // smallest index and valid resolution; typically its IDR or SPS
-            // packet; there may be packet preceeding this packet, IDR's
-            // resolution will be applied to them.
-            if (buffer_[start_index]->width() > 0 &&
-                buffer_[start_index]->height() > 0) {
-              idr_width = buffer_[start_index]->width();
-              idr_height = buffer_[start_index]->height();
-            }
+        }
+        if ((sps_pps_idr_is_h264_keyframe_ && has_h264_idr && has_h264_sps &&
+             has_h264_pps) ||
+            (!sps_pps_idr_is_h264_keyframe_ && has_h264_idr)) {
+          is_h264_keyframe = true;
+          // Store the resolution of key frame which is the packet with
+          // smallest index and valid resolution; typically its IDR or SPS
+          // packet; there may be packet preceeding this packet, IDR's
+          // resolution will be applied to them.
+          if (buffer_[start_index]->width() > 0 &&
+              buffer_[start_index]->height() > 0) {
+            idr_width = buffer_[start_index]->width();
+            idr_height = buffer_[start_index]->height();
           }
         }
 
@@ -319,9 +327,8 @@ std::vector<std::unique_ptr<PacketBuffer::Packet>> PacketBuffer::FindFrames(
         // the timestamp of that packet is the same as this one. This may cause
         // the PacketBuffer to hand out incomplete frames.
         // See: https://bugs.chromium.org/p/webrtc/issues/detail?id=7106
-        if (is_h264_descriptor &&
-            (buffer_[start_index] == nullptr ||
-             buffer_[start_index]->timestamp != frame_timestamp)) {
+        if (buffer_[start_index] == nullptr ||
+            buffer_[start_index]->timestamp != frame_timestamp) {
           break;
         }
 
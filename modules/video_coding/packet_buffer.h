@@ -55,6 +55,9 @@ class PacketBuffer {
     // If all its previous packets have been inserted into the packet buffer.
     // Set and used internally by the PacketBuffer.
     bool continuous = false;
+    // Sequence number of the first packet of the frame, valid if `continuous`.
+    // Set and used internally by the PacketBuffer.
+    uint16_t frame_start_seq_num = 0;
     bool marker_bit = false;
     uint8_t payload_type = 0;
     uint16_t seq_num = 0;
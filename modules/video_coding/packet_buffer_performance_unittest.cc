@@ -0,0 +1,117 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <stdint.h>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "api/test/metrics/global_metrics_logger_and_exporter.h"
+#include "api/test/metrics/metric.h"
+#include "modules/video_coding/packet_buffer.h"
+#include "rtc_base/copy_on_write_buffer.h"
+#include "rtc_base/time_utils.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace video_coding {
+namespace {
+
+using ::webrtc::test::GetGlobalMetricsLogger;
+using ::webrtc::test::ImprovementDirection;
+using ::webrtc::test::Unit;
+
+// 4K at 30 Mbps and 30 fps, sent in packets of 1200 bytes.
+constexpr int kBitrateBps = 30'000'000;
+constexpr int kFramerateFps = 30;
+constexpr int kPayloadSizeBytes = 1200;
+constexpr int kPacketsPerFrame =
+    kBitrateBps / kFramerateFps / 8 / kPayloadSizeBytes + 1;
+constexpr int kNumWarmupFrames = 30;
+constexpr int kNumMeasuredFrames = 300;
+// Same sizes as RtpVideoStreamReceiver2.
+constexpr size_t kPacketBufferStartSize = 512;
+constexpr size_t kPacketBufferMaxSize = 2048;
+
+std::unique_ptr<PacketBuffer::Packet> CreatePacket(
+    uint16_t seq_num,
+    uint32_t timestamp,
+    bool first,
+    bool last,
+    const rtc::CopyOnWriteBuffer& payload) {
+  auto packet = std::make_unique<PacketBuffer::Packet>();
+  packet->video_header.codec = kVideoCodecGeneric;
+  packet->video_header.is_first_packet_in_frame = first;
+  packet->video_header.is_last_packet_in_frame = last;
+  packet->seq_num = seq_num;
+  packet->timestamp = timestamp;
+  packet->marker_bit = last;
+  packet->video_payload = payload;
+  return packet;
+}
+
+// Returns the time spent inserting the packets of the measured frames, in
+// nanoseconds. With `reorder`, every other pair of packets is swapped.
+int64_t InsertFrames(bool reorder) {
+  PacketBuffer packet_buffer(kPacketBufferStartSize, kPacketBufferMaxSize);
+  rtc::CopyOnWriteBuffer payload(kPayloadSizeBytes);
+  uint16_t seq_num = 0;
+  int64_t total_ns = 0;
+  size_t num_assembled_packets = 0;
+  for (int frame = 0; frame < kNumWarmupFrames + kNumMeasuredFrames;
+       ++frame) {
+    const uint32_t timestamp = frame * (90'000 / kFramerateFps);
+    std::vector<std::unique_ptr<PacketBuffer::Packet>> packets;
+    for (int i = 0; i < kPacketsPerFrame; ++i) {
+      packets.push_back(CreatePacket(seq_num++, timestamp, i == 0,
+                                     i == kPacketsPerFrame - 1, payload));
+    }
+    if (reorder) {
+      for (size_t i = 0; i + 1 < packets.size(); i += 4) {
+        std::swap(packets[i], packets[i + 1]);
+      }
+    }
+
+    const int64_t start_ns = rtc::TimeNanos();
+    for (auto& packet : packets) {
+      PacketBuffer::InsertResult result =
+          packet_buffer.InsertPacket(std::move(packet));
+      num_assembled_packets += result.packets.size();
+    }
+    if (frame >= kNumWarmupFrames) {
+      total_ns += rtc::TimeNanos() - start_ns;
+    }
+  }
+  EXPECT_EQ(num_assembled_packets, static_cast<size_t>(
+                                       (kNumWarmupFrames + kNumMeasuredFrames) *
+                                       kPacketsPerFrame));
+  return total_ns;
+}
+
+}  // namespace
+
+// Measures the time in nanoseconds per packet to insert packets and assemble
+// frames of a 4K stream at 30 Mbps.
+TEST(PacketBufferPerformanceTest, InsertPackets) {
+  for (bool reorder : {false, true}) {
+    SCOPED_TRACE(reorder ? "reordered" : "in_order");
+    const int64_t total_ns = InsertFrames(reorder);
+    GetGlobalMetricsLogger()->LogSingleValueMetric(
+        "packet_buffer_insert_ns_per_packet",
+        reorder ? "4k_30mbps_reordered" : "4k_30mbps_in_order",
+        static_cast<double>(total_ns) /
+            (kNumMeasuredFrames * kPacketsPerFrame),
+        Unit::kUnitless, ImprovementDirection::kSmallerIsBetter);
+  }
+}
+
+}  // namespace video_coding
+}  // namespace webrtc
@@ -197,6 +197,16 @@ TEST_F(PacketBufferTest, FrameSize) {
   EXPECT_THAT(packets, SizeIs(4));
 }
 
+TEST_F(PacketBufferTest, NoFrameIfFirstPacketClearedBeforeLastArrives) {
+  const uint16_t seq_num = Rand();
+
+  Insert(seq_num, kKeyFrame, kFirst, kNotLast);
+  Insert(seq_num + 1, kKeyFrame, kNotFirst, kNotLast);
+  packet_buffer_.ClearTo(seq_num);
+  EXPECT_THAT(Insert(seq_num + 2, kKeyFrame, kNotFirst, kLast).packets,
+              IsEmpty());
+}
+
 TEST_F(PacketBufferTest, ExpandBuffer) {
   const uint16_t seq_num = Rand();
 
@@ -10,8 +10,10 @@
 
 #include "modules/video_coding/rtp_vp8_ref_finder.h"
 
+#include <algorithm>
 #include <utility>
 
+#include "absl/types/optional.h"
 #include "rtc_base/logging.h"
 
 namespace webrtc {
@@ -39,7 +41,7 @@ RtpFrameReferenceFinder::ReturnVector RtpVp8RefFinder::ManageFrame(
       return res;
     case kHandOff:
       res.push_back(std::move(frame));
-      RetryStashedFrames(res);
+      RetryStashedFrames(unwrapped_tl0, res);
       return res;
     case kDrop:
       return res;
@@ -209,11 +211,21 @@ void RtpVp8RefFinder::UpdateLayerInfoVp8(RtpFrameObject* frame,
 }
 
 void RtpVp8RefFinder::RetryStashedFrames(
+    int64_t unwrapped_tl0,
     RtpFrameReferenceFinder::ReturnVector& res) {
-  bool complete_frame = false;
-  do {
-    complete_frame = false;
+  // Handing off a frame only updates the info of its own and later base layer
+  // frames, and a stashed frame only waits for frames at or before its own
+  // base layer frame. Frames of older base layers are therefore still blocked
+  // and are skipped without being managed again.
+  absl::optional<int64_t> retry_from_tl0 = unwrapped_tl0;
+  while (retry_from_tl0) {
+    const int64_t from_tl0 = *retry_from_tl0;
+    retry_from_tl0 = absl::nullopt;
     for (auto it = stashed_frames_.begin(); it != stashed_frames_.end();) {
+      if (it->unwrapped_tl0 < from_tl0) {
+        ++it;
+        continue;
+      }
       const RTPVideoHeaderVP8& codec_header = absl::get<RTPVideoHeaderVP8>(
           it->frame->GetRtpVideoHeader().video_type_header);
       FrameDecision decision =
@@ -224,14 +236,16 @@ void RtpVp8RefFinder::RetryStashedFrames(
           ++it;
           break;
         case kHandOff:
-          complete_frame = true;
+          retry_from_tl0 =
+              std::min(retry_from_tl0.value_or(it->unwrapped_tl0),
+                       it->unwrapped_tl0);
           res.push_back(std::move(it->frame));
           [[fallthrough]];
         case kDrop:
           it = stashed_frames_.erase(it);
       }
     }
-  } while (complete_frame);
+  }
 }
 
 void RtpVp8RefFinder::UnwrapPictureIds(RtpFrameObject* frame) {
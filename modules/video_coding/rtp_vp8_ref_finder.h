@@ -48,7 +48,10 @@ class RtpVp8RefFinder {
   FrameDecision ManageFrameInternal(RtpFrameObject* frame,
                                     const RTPVideoHeaderVP8& codec_header,
                                     int64_t unwrapped_tl0);
-  void RetryStashedFrames(RtpFrameReferenceFinder::ReturnVector& res);
+  // Retries the stashed frames that handing off a frame of base layer
+  // `unwrapped_tl0` may have unblocked.
+  void RetryStashedFrames(int64_t unwrapped_tl0,
+                          RtpFrameReferenceFinder::ReturnVector& res);
   void UpdateLayerInfoVp8(RtpFrameObject* frame,
                           int64_t unwrapped_tl0,
                           uint8_t temporal_idx);
@@ -357,6 +357,20 @@ TEST_F(RtpVp8RefFinderTest, Vp8DetectMissingFrame_0212) {
   EXPECT_THAT(frames_, HasFrameWithIdAndRefs(8, {5, 6, 7}));
 }
 
+TEST_F(RtpVp8RefFinderTest, StashedChainIsReleasedWhenMissingFrameArrives) {
+  Insert(Frame().Pid(0).Tid(0).Tl0(0).AsKeyFrame());
+  for (int i = 2; i <= 20; ++i) {
+    Insert(Frame().Pid(i).Tid(0).Tl0(i));
+  }
+  EXPECT_THAT(frames_, SizeIs(1));
+
+  Insert(Frame().Pid(1).Tid(0).Tl0(1));
+  EXPECT_THAT(frames_, SizeIs(21));
+  for (int i = 1; i <= 20; ++i) {
+    EXPECT_THAT(frames_, HasFrameWithIdAndRefs(i, {i - 1}));
+  }
+}
+
 TEST_F(RtpVp8RefFinderTest, StashedFramesDoNotWrapTl0Backwards) {
   Insert(Frame().Pid(0).Tid(0).Tl0(0));
   EXPECT_THAT(frames_, SizeIs(0));
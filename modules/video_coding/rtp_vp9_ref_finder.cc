@@ -13,6 +13,7 @@
 #include <algorithm>
 #include <utility>
 
+#include "absl/types/optional.h"
 #include "rtc_base/logging.h"
 
 namespace webrtc {
@@ -27,6 +28,7 @@ RtpFrameReferenceFinder::ReturnVector RtpVp9RefFinder::ManageFrame(
   frame->SetId(codec_header.picture_id & (kFrameIdLength - 1));
 
   FrameDecision decision;
+  absl::optional<int64_t> unwrapped_tl0;
   if (codec_header.temporal_idx >= kMaxTemporalLayers ||
       codec_header.spatial_idx >= kMaxSpatialLayers) {
     decision = kDrop;
@@ -38,9 +40,8 @@ RtpFrameReferenceFinder::ReturnVector RtpVp9RefFinder::ManageFrame(
                              "non-flexible mode.";
       decision = kDrop;
     } else {
-      int64_t unwrapped_tl0 =
-          tl0_unwrapper_.Unwrap(codec_header.tl0_pic_idx & 0xFF);
-      decision = ManageFrameGof(frame.get(), codec_header, unwrapped_tl0);
+      unwrapped_tl0 = tl0_unwrapper_.Unwrap(codec_header.tl0_pic_idx & 0xFF);
+      decision = ManageFrameGof(frame.get(), codec_header, *unwrapped_tl0);
 
       if (decision == kStash) {
         if (stashed_frames_.size() > kMaxStashedFrames) {
@@ -48,7 +49,7 @@ RtpFrameReferenceFinder::ReturnVector RtpVp9RefFinder::ManageFrame(
         }
 
         stashed_frames_.push_front(
-            {.unwrapped_tl0 = unwrapped_tl0, .frame = std::move(frame)});
+            {.unwrapped_tl0 = *unwrapped_tl0, .frame = std::move(frame)});
       }
     }
   }
@@ -59,7 +60,11 @@ RtpFrameReferenceFinder::ReturnVector RtpVp9RefFinder::ManageFrame(
       return res;
     case kHandOff:
       res.push_back(std::move(frame));
-      RetryStashedFrames(res);
+      // Frames in flexible mode don't update the GOF info that the stashed
+      // frames are waiting for.
+      if (unwrapped_tl0) {
+        RetryStashedFrames(*unwrapped_tl0, res);
+      }
       return res;
     case kDrop:
       return res;
@@ -310,11 +315,21 @@ bool RtpVp9RefFinder::UpSwitchInIntervalVp9(uint16_t picture_id,
 }
 
 void RtpVp9RefFinder::RetryStashedFrames(
+    int64_t unwrapped_tl0,
     RtpFrameReferenceFinder::ReturnVector& res) {
-  bool complete_frame = false;
-  do {
-    complete_frame = false;
+  // Handing off a frame only updates the info of its own and later base layer
+  // frames, and a stashed frame only waits for frames at or before its own
+  // base layer frame. Frames of older base layers are therefore still blocked
+  // and are skipped without being managed again.
+  absl::optional<int64_t> retry_from_tl0 = unwrapped_tl0;
+  while (retry_from_tl0) {
+    const int64_t from_tl0 = *retry_from_tl0;
+    retry_from_tl0 = absl::nullopt;
     for (auto it = stashed_frames_.begin(); it != stashed_frames_.end();) {
+      if (it->unwrapped_tl0 < from_tl0) {
+        ++it;
+        continue;
+      }
       const RTPVideoHeaderVP9& codec_header = absl::get<RTPVideoHeaderVP9>(
           it->frame->GetRtpVideoHeader().video_type_header);
       RTC_DCHECK(!codec_header.flexible_mode);
@@ -326,14 +341,16 @@ void RtpVp9RefFinder::RetryStashedFrames(
           ++it;
           break;
         case kHandOff:
-          complete_frame = true;
+          retry_from_tl0 =
+              std::min(retry_from_tl0.value_or(it->unwrapped_tl0),
+                       it->unwrapped_tl0);
           res.push_back(std::move(it->frame));
           [[fallthrough]];
         case kDrop:
           it = stashed_frames_.erase(it);
       }
     }
-  } while (complete_frame);
+  }
 }
 
 void RtpVp9RefFinder::FlattenFrameIdAndRefs(RtpFrameObject* frame,
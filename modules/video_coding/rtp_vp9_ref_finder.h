@@ -58,7 +58,10 @@ class RtpVp9RefFinder {
   FrameDecision ManageFrameGof(RtpFrameObject* frame,
                                const RTPVideoHeaderVP9& vp9_header,
                                int64_t unwrapped_tl0);
-  void RetryStashedFrames(RtpFrameReferenceFinder::ReturnVector& res);
+  // Retries the stashed frames that handing off a frame of base layer
+  // `unwrapped_tl0` may have unblocked.
+  void RetryStashedFrames(int64_t unwrapped_tl0,
+                          RtpFrameReferenceFinder::ReturnVector& res);
 
   bool MissingRequiredFrameVp9(uint16_t picture_id, const GofInfo& info);
 
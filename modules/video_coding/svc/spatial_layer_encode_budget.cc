@@ -0,0 +1,94 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/video_coding/svc/spatial_layer_encode_budget.h"
+
+#include "rtc_base/checks.h"
+#include "rtc_base/experiments/field_trial_parser.h"
+
+namespace webrtc {
+namespace {
+
+// Weight of a new sample in the smoothed encode time.
+constexpr double kSmoothingFactor = 0.1;
+
+}  // namespace
+
+absl::optional<SpatialLayerEncodeBudget::Config>
+SpatialLayerEncodeBudget::ParseFieldTrial(const FieldTrialsView& trials) {
+  Config config;
+  FieldTrialFlag enabled("Enabled");
+  FieldTrialParameter<double> budget_fraction("budget",
+                                              config.budget_fraction);
+  FieldTrialParameter<int> max_consecutive_drops("max_drops",
+                                                 config.max_consecutive_drops);
+  webrtc::ParseFieldTrial({&enabled, &budget_fraction, &max_consecutive_drops},
+                          trials.Lookup("WebRTC-Video-SvcCpuLayerDropping"));
+  if (!enabled || budget_fraction.Get() <= 0.0 ||
+      max_consecutive_drops.Get() < 0) {
+    return absl::nullopt;
+  }
+  config.budget_fraction = budget_fraction.Get();
+  config.max_consecutive_drops = max_consecutive_drops.Get();
+  return config;
+}
+
+SpatialLayerEncodeBudget::SpatialLayerEncodeBudget(Config config)
+    : config_(config) {}
+
+int SpatialLayerEncodeBudget::DropLayersOverBudget(
+    std::vector<ScalableVideoController::LayerFrameConfig>& layer_frames,
+    TimeDelta frame_interval) {
+  if (layer_frames.size() < 2 || layer_frames.front().IsKeyframe()) {
+    return 0;
+  }
+  const TimeDelta budget = frame_interval * config_.budget_fraction;
+  TimeDelta used = TimeDelta::Zero();
+  size_t num_kept = 0;
+  for (; num_kept < layer_frames.size(); ++num_kept) {
+    const int sid = layer_frames[num_kept].SpatialId();
+    RTC_DCHECK_GE(sid, 0);
+    RTC_DCHECK_LT(sid, kMaxSpatialLayers);
+    // Layers that weren't measured yet are always encoded.
+    const TimeDelta encode_time = encode_time_[sid].value_or(TimeDelta::Zero());
+    if (num_kept > 0 && used + encode_time > budget &&
+        consecutive_drops_[sid] < config_.max_consecutive_drops) {
+      break;
+    }
+    used += encode_time;
+    consecutive_drops_[sid] = 0;
+  }
+  const int num_dropped = layer_frames.size() - num_kept;
+  for (size_t i = num_kept; i < layer_frames.size(); ++i) {
+    ++consecutive_drops_[layer_frames[i].SpatialId()];
+  }
+  layer_frames.erase(layer_frames.begin() + num_kept, layer_frames.end());
+  return num_dropped;
+}
+
+void SpatialLayerEncodeBudget::OnLayerEncoded(int spatial_id,
+                                              TimeDelta encode_time) {
+  RTC_DCHECK_GE(spatial_id, 0);
+  RTC_DCHECK_LT(spatial_id, kMaxSpatialLayers);
+  absl::optional<TimeDelta>& smoothed = encode_time_[spatial_id];
+  if (!smoothed) {
+    smoothed = encode_time;
+  } else {
+    *smoothed = *smoothed * (1 - kSmoothingFactor) +
+                encode_time * kSmoothingFactor;
+  }
+}
+
+void SpatialLayerEncodeBudget::Reset() {
+  encode_time_.fill(absl::nullopt);
+  consecutive_drops_.fill(0);
+}
+
+}  // namespace webrtc
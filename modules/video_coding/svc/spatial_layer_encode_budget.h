@@ -0,0 +1,73 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_VIDEO_CODING_SVC_SPATIAL_LAYER_ENCODE_BUDGET_H_
+#define MODULES_VIDEO_CODING_SVC_SPATIAL_LAYER_ENCODE_BUDGET_H_
+
+#include <array>
+#include <vector>
+
+#include "absl/types/optional.h"
+#include "api/field_trials_view.h"
+#include "api/units/time_delta.h"
+#include "api/video/video_codec_constants.h"
+#include "modules/video_coding/svc/scalable_video_controller.h"
+
+namespace webrtc {
+
+// Decides, per frame, whether the top spatial layers of an SVC encoder
+// should be skipped so that the frame is encoded within the frame interval.
+// Keeps a smoothed encode time per spatial layer, and drops the layers that
+// would make the frame overrun its budget, starting from the top. The lowest
+// layer of a frame is never dropped, so that the base layer stays smooth when
+// the CPU can't keep up with the full picture.
+//
+// Only frames that are actually encoded are passed on to the rtp layer, so
+// the dependency descriptor of the following frames references the last
+// encoded frame of each layer and stays consistent. A layer is not dropped on
+// more than `max_consecutive_drops` frames in a row, so that receivers of the
+// upper decode targets are not starved, and so that its encode time is
+// measured again.
+class SpatialLayerEncodeBudget {
+ public:
+  struct Config {
+    // Fraction of the frame interval the layers of a frame may use.
+    double budget_fraction = 0.8;
+    int max_consecutive_drops = 2;
+  };
+
+  // Returns the config set by the "WebRTC-Video-SvcCpuLayerDropping" field
+  // trial, or nullopt when layer dropping is disabled.
+  static absl::optional<Config> ParseFieldTrial(const FieldTrialsView& trials);
+
+  explicit SpatialLayerEncodeBudget(Config config);
+
+  // Removes the layers at the end of `layer_frames` that don't fit in the
+  // budget for a frame interval of `frame_interval`. Key frames are encoded
+  // with all their layers. Returns the number of removed layers.
+  int DropLayersOverBudget(
+      std::vector<ScalableVideoController::LayerFrameConfig>& layer_frames,
+      TimeDelta frame_interval);
+
+  // Reports the time it took to encode a layer frame of `spatial_id`.
+  void OnLayerEncoded(int spatial_id, TimeDelta encode_time);
+
+  // Forgets the measured encode times, e.g. after the resolution changed.
+  void Reset();
+
+ private:
+  const Config config_;
+  std::array<absl::optional<TimeDelta>, kMaxSpatialLayers> encode_time_;
+  std::array<int, kMaxSpatialLayers> consecutive_drops_ = {};
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_VIDEO_CODING_SVC_SPATIAL_LAYER_ENCODE_BUDGET_H_
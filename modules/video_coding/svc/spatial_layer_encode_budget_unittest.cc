@@ -0,0 +1,146 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/video_coding/svc/spatial_layer_encode_budget.h"
+
+#include <vector>
+
+#include "api/units/time_delta.h"
+#include "modules/video_coding/svc/scalable_video_controller.h"
+#include "test/explicit_key_value_config.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+using LayerFrameConfig = ScalableVideoController::LayerFrameConfig;
+
+constexpr TimeDelta kFrameInterval = TimeDelta::Millis(33);
+
+std::vector<LayerFrameConfig> DeltaFrame(int num_spatial_layers) {
+  std::vector<LayerFrameConfig> layers(num_spatial_layers);
+  for (int sid = 0; sid < num_spatial_layers; ++sid) {
+    layers[sid].S(sid).T(0);
+  }
+  return layers;
+}
+
+SpatialLayerEncodeBudget::Config MakeConfig(int max_consecutive_drops) {
+  SpatialLayerEncodeBudget::Config config;
+  config.budget_fraction = 1.0;
+  config.max_consecutive_drops = max_consecutive_drops;
+  return config;
+}
+
+TEST(SpatialLayerEncodeBudgetTest, DisabledByDefault) {
+  test::ExplicitKeyValueConfig trials("");
+  EXPECT_FALSE(SpatialLayerEncodeBudget::ParseFieldTrial(trials));
+}
+
+TEST(SpatialLayerEncodeBudgetTest, ParsesFieldTrial) {
+  test::ExplicitKeyValueConfig trials(
+      "WebRTC-Video-SvcCpuLayerDropping/Enabled,budget:0.5,max_drops:4/");
+  absl::optional<SpatialLayerEncodeBudget::Config> config =
+      SpatialLayerEncodeBudget::ParseFieldTrial(trials);
+  ASSERT_TRUE(config);
+  EXPECT_EQ(config->budget_fraction, 0.5);
+  EXPECT_EQ(config->max_consecutive_drops, 4);
+}
+
+TEST(SpatialLayerEncodeBudgetTest, KeepsAllLayersThatFitInBudget) {
+  SpatialLayerEncodeBudget budget(MakeConfig(/*max_consecutive_drops=*/2));
+  budget.OnLayerEncoded(0, TimeDelta::Millis(5));
+  budget.OnLayerEncoded(1, TimeDelta::Millis(10));
+  budget.OnLayerEncoded(2, TimeDelta::Millis(15));
+
+  std::vector<LayerFrameConfig> layers = DeltaFrame(3);
+  EXPECT_EQ(budget.DropLayersOverBudget(layers, kFrameInterval), 0);
+  EXPECT_EQ(layers.size(), 3u);
+}
+
+TEST(SpatialLayerEncodeBudgetTest, DropsTopLayersOverBudget) {
+  SpatialLayerEncodeBudget budget(MakeConfig(/*max_consecutive_drops=*/2));
+  budget.OnLayerEncoded(0, TimeDelta::Millis(10));
+  budget.OnLayerEncoded(1, TimeDelta::Millis(20));
+  budget.OnLayerEncoded(2, TimeDelta::Millis(40));
+
+  std::vector<LayerFrameConfig> layers = DeltaFrame(3);
+  EXPECT_EQ(budget.DropLayersOverBudget(layers, kFrameInterval), 1);
+  ASSERT_EQ(layers.size(), 2u);
+  EXPECT_EQ(layers.back().SpatialId(), 1);
+}
+
+TEST(SpatialLayerEncodeBudgetTest, NeverDropsLowestLayer) {
+  SpatialLayerEncodeBudget budget(MakeConfig(/*max_consecutive_drops=*/2));
+  budget.OnLayerEncoded(1, TimeDelta::Millis(50));
+  budget.OnLayerEncoded(2, TimeDelta::Millis(50));
+
+  // The lowest layer of the frame is kept even when it alone exceeds the
+  // budget.
+  std::vector<LayerFrameConfig> layers = DeltaFrame(3);
+  layers.erase(layers.begin());
+  EXPECT_EQ(budget.DropLayersOverBudget(layers, kFrameInterval), 1);
+  ASSERT_EQ(layers.size(), 1u);
+  EXPECT_EQ(layers.front().SpatialId(), 1);
+}
+
+TEST(SpatialLayerEncodeBudgetTest, KeepsAllLayersOfKeyFrames) {
+  SpatialLayerEncodeBudget budget(MakeConfig(/*max_consecutive_drops=*/2));
+  budget.OnLayerEncoded(0, TimeDelta::Millis(30));
+  budget.OnLayerEncoded(1, TimeDelta::Millis(30));
+
+  std::vector<LayerFrameConfig> layers = DeltaFrame(2);
+  layers[0].Keyframe();
+  EXPECT_EQ(budget.DropLayersOverBudget(layers, kFrameInterval), 0);
+  EXPECT_EQ(layers.size(), 2u);
+}
+
+TEST(SpatialLayerEncodeBudgetTest, EncodesDroppedLayerAfterMaxDrops) {
+  SpatialLayerEncodeBudget budget(MakeConfig(/*max_consecutive_drops=*/2));
+  budget.OnLayerEncoded(0, TimeDelta::Millis(20));
+  budget.OnLayerEncoded(1, TimeDelta::Millis(20));
+
+  for (int i = 0; i < 2; ++i) {
+    std::vector<LayerFrameConfig> layers = DeltaFrame(2);
+    EXPECT_EQ(budget.DropLayersOverBudget(layers, kFrameInterval), 1);
+  }
+  std::vector<LayerFrameConfig> layers = DeltaFrame(2);
+  EXPECT_EQ(budget.DropLayersOverBudget(layers, kFrameInterval), 0);
+  layers = DeltaFrame(2);
+  EXPECT_EQ(budget.DropLayersOverBudget(layers, kFrameInterval), 1);
+}
+
+TEST(SpatialLayerEncodeBudgetTest, KeepsLayersAgainWhenEncodeTimeDrops) {
+  SpatialLayerEncodeBudget budget(MakeConfig(/*max_consecutive_drops=*/100));
+  budget.OnLayerEncoded(0, TimeDelta::Millis(20));
+  budget.OnLayerEncoded(1, TimeDelta::Millis(20));
+  std::vector<LayerFrameConfig> layers = DeltaFrame(2);
+  EXPECT_EQ(budget.DropLayersOverBudget(layers, kFrameInterval), 1);
+
+  // The base layer gets cheaper, e.g. because other load went away.
+  for (int i = 0; i < 30; ++i) {
+    budget.OnLayerEncoded(0, TimeDelta::Millis(5));
+  }
+  layers = DeltaFrame(2);
+  EXPECT_EQ(budget.DropLayersOverBudget(layers, kFrameInterval), 0);
+}
+
+TEST(SpatialLayerEncodeBudgetTest, ResetForgetsEncodeTimes) {
+  SpatialLayerEncodeBudget budget(MakeConfig(/*max_consecutive_drops=*/2));
+  budget.OnLayerEncoded(0, TimeDelta::Millis(20));
+  budget.OnLayerEncoded(1, TimeDelta::Millis(20));
+  budget.Reset();
+
+  std::vector<LayerFrameConfig> layers = DeltaFrame(2);
+  EXPECT_EQ(budget.DropLayersOverBudget(layers, kFrameInterval), 0);
+}
+
+}  // namespace
+}  // namespace webrtc
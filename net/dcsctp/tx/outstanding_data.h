@@ -10,6 +10,7 @@
 #ifndef NET_DCSCTP_TX_OUTSTANDING_DATA_H_
 #define NET_DCSCTP_TX_OUTSTANDING_DATA_H_
 
+#include <deque>
 #include <map>
 #include <set>
 #include <utility>
@@ -298,9 +299,14 @@ class OutstandingData {
       bool is_in_fast_recovery,
       OutstandingData::AckInfo& ack_info);
 
-  // Process the acknowledgement of the chunk referenced by `iter` and updates
-  // state in `ack_info` and the object's state.
-  void AckChunk(AckInfo& ack_info, std::map<UnwrappedTSN, Item>::iterator iter);
+  // Process the acknowledgement of the chunk `item`, with TSN `tsn`, and
+  // updates state in `ack_info` and the object's state.
+  void AckChunk(AckInfo& ack_info, UnwrappedTSN tsn, Item& item);
+
+  // Returns the outstanding item with TSN `tsn`, which must be in the range
+  // (`last_cumulative_tsn_ack_`, `highest_outstanding_tsn()`].
+  Item& GetItem(UnwrappedTSN tsn);
+  const Item& GetItem(UnwrappedTSN tsn) const;
 
   // Helper method to process an incoming nack of an item and perform the
   // correct operations given the action indicated when nacking an item (e.g.
@@ -335,7 +341,11 @@ class OutstandingData {
   // Callback when to discard items from the send queue.
   std::function<bool(IsUnordered, StreamID, MID)> discard_from_send_queue_;
 
-  std::map<UnwrappedTSN, Item> outstanding_data_;
+  // Outstanding items, ordered by TSN. As TSNs are allocated sequentially and
+  // only removed by the cumulative ack, the first item always has the TSN
+  // following `last_cumulative_tsn_ack_`, and the TSNs of the following items
+  // are consecutive. Looking up a TSN is then a matter of indexing.
+  std::deque<Item> outstanding_data_;
   // The number of bytes that are in-flight (sent but not yet acked or nacked).
   size_t outstanding_bytes_ = 0;
   // The number of DATA chunks that are in-flight (sent but not yet acked or
@@ -137,6 +137,28 @@ TEST_F(OutstandingDataTest, AcksAndNacksWithGapAckBlocks) {
                           Pair(TSN(11), State::kAcked)));
 }
 
+TEST_F(OutstandingDataTest, IgnoresGapAckBlocksBeyondOutstandingData) {
+  buf_.Insert(gen_.Ordered({1}, "B"), kNow);
+  buf_.Insert(gen_.Ordered({1}, ""), kNow);
+  buf_.Insert(gen_.Ordered({1}, "E"), kNow);
+
+  // The second block partially, and the third block fully, covers TSNs that
+  // were never sent.
+  std::vector<SackChunk::GapAckBlock> gab = {SackChunk::GapAckBlock(2, 2),
+                                             SackChunk::GapAckBlock(3, 5),
+                                             SackChunk::GapAckBlock(7, 8)};
+  OutstandingData::AckInfo ack =
+      buf_.HandleSack(unwrapper_.Unwrap(TSN(9)), gab, false);
+  EXPECT_EQ(ack.bytes_acked, 2 * (DataChunk::kHeaderSize + RoundUpTo4(1)));
+  EXPECT_EQ(ack.highest_tsn_acked.Wrap(), TSN(12));
+  EXPECT_EQ(buf_.highest_outstanding_tsn().Wrap(), TSN(12));
+  EXPECT_THAT(buf_.GetChunkStatesForTesting(),
+              ElementsAre(Pair(TSN(9), State::kAcked),    //
+                          Pair(TSN(10), State::kNacked),  //
+                          Pair(TSN(11), State::kAcked),   //
+                          Pair(TSN(12), State::kAcked)));
+}
+
 TEST_F(OutstandingDataTest, NacksThreeTimesWithSameTsnDoesntRetransmit) {
   buf_.Insert(gen_.Ordered({1}, "B"), kNow);
   buf_.Insert(gen_.Ordered({1}, "E"), kNow);
@@ -173,11 +173,16 @@ absl::optional<SendQueue::DataToSend> RRSendQueue::OutgoingStream::Produce(
     StreamID stream_id = message.stream_id();
     PPID ppid = message.ppid();
 
-    // Zero-copy the payload if the message fits in a single chunk.
-    std::vector<uint8_t> payload =
-        is_beginning && is_end
-            ? std::move(message).ReleasePayload()
-            : std::vector<uint8_t>(chunk_payload.begin(), chunk_payload.end());
+    // Zero-copy the payload if the message fits in a single chunk. The last
+    // fragment of a larger message reuses the message's buffer, by moving its
+    // remaining bytes to the front, instead of allocating a new one.
+    std::vector<uint8_t> payload;
+    if (is_end) {
+      payload = std::move(message).ReleasePayload();
+      payload.erase(payload.begin(), payload.begin() + item.remaining_offset);
+    } else {
+      payload.assign(chunk_payload.begin(), chunk_payload.end());
+    }
 
     FSN fsn(item.current_fsn);
     item.current_fsn = FSN(*item.current_fsn + 1);
@@ -97,6 +97,25 @@ TEST_F(RRSendQueueTest, CarveOutBeginningMiddleAndEnd) {
   EXPECT_FALSE(buf_.Produce(kNow, kOneFragmentPacketSize).has_value());
 }
 
+TEST_F(RRSendQueueTest, FragmentsCarryTheMessagePayload) {
+  std::vector<uint8_t> payload(50);
+  for (size_t i = 0; i < payload.size(); ++i) {
+    payload[i] = static_cast<uint8_t>(i);
+  }
+  buf_.Add(kNow, DcSctpMessage(kStreamID, kPPID, payload));
+
+  std::vector<uint8_t> produced;
+  while (absl::optional<SendQueue::DataToSend> chunk =
+             buf_.Produce(kNow, /*max_size=*/20)) {
+    produced.insert(produced.end(), chunk->data.payload.begin(),
+                    chunk->data.payload.end());
+    if (chunk->data.is_end) {
+      EXPECT_THAT(chunk->data.payload, SizeIs(10));
+    }
+  }
+  EXPECT_EQ(produced, payload);
+}
+
 TEST_F(RRSendQueueTest, GetChunksFromTwoMessages) {
   std::vector<uint8_t> payload(60);
   buf_.Add(kNow, DcSctpMessage(kStreamID, kPPID, payload));
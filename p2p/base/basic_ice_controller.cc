@@ -175,34 +175,31 @@ const Connection* BasicIceController::FindNextPingableConnection() {
   // Otherwise, treat everything as unpinged.
   // TODO(honghaiz): Instead of adding two separate vectors, we can add a state
   // "pinged" to filter out unpinged connections.
-  if (absl::c_none_of(unpinged_connections_,
-                      [this, now](const Connection* conn) {
-                        return this->IsPingable(conn, now);
-                      })) {
+  const Connection* most_pingable = FindMostPingableUnpingedConnection(now);
+  if (!most_pingable) {
     unpinged_connections_.insert(pinged_connections_.begin(),
                                  pinged_connections_.end());
     pinged_connections_.clear();
+    most_pingable = FindMostPingableUnpingedConnection(now);
   }
+  return most_pingable;
+}
 
-  // Among un-pinged pingable connections, "more pingable" takes precedence.
-  std::vector<const Connection*> pingable_connections;
-  absl::c_copy_if(
-      unpinged_connections_, std::back_inserter(pingable_connections),
-      [this, now](const Connection* conn) { return IsPingable(conn, now); });
-  auto iter = absl::c_max_element(
-      pingable_connections,
-      [this](const Connection* conn1, const Connection* conn2) {
-        // Some implementations of max_element
-        // compare an element with itself.
-        if (conn1 == conn2) {
-          return false;
-        }
-        return MorePingable(conn1, conn2) == conn2;
-      });
-  if (iter != pingable_connections.end()) {
-    return *iter;
+// Among un-pinged pingable connections, "more pingable" takes precedence.
+// This is a single pass so that large connection counts do not pay for an
+// extra scan and a temporary vector on every ping.
+const Connection* BasicIceController::FindMostPingableUnpingedConnection(
+    int64_t now) {
+  const Connection* most_pingable = nullptr;
+  for (const Connection* conn : unpinged_connections_) {
+    if (!IsPingable(conn, now)) {
+      continue;
+    }
+    if (!most_pingable || MorePingable(most_pingable, conn) == conn) {
+      most_pingable = conn;
+    }
   }
-  return nullptr;
+  return most_pingable;
 }
 
 // Find "triggered checks".  We ping first those connections that have
@@ -529,15 +526,20 @@ BasicIceController::SortAndSwitchConnection(IceSwitchReason reason) {
   // one whose estimated latency is lowest.  So it is the only one that we
   // need to consider switching to.
   // TODO(honghaiz): Don't sort;  Just use std::max_element in the right places.
-  absl::c_stable_sort(
-      connections_, [this](const Connection* a, const Connection* b) {
-        int cmp = CompareConnections(a, b, absl::nullopt, nullptr);
-        if (cmp != 0) {
-          return cmp > 0;
-        }
-        // Otherwise, sort based on latency estimate.
-        return a->rtt() < b->rtt();
-      });
+  auto better_connection = [this](const Connection* a, const Connection* b) {
+    int cmp = CompareConnections(a, b, absl::nullopt, nullptr);
+    if (cmp != 0) {
+      return cmp > 0;
+    }
+    // Otherwise, sort based on latency estimate.
+    return a->rtt() < b->rtt();
+  };
+  // Most re-sorts are triggered by state changes that do not affect the order.
+  // Checking that takes a linear number of comparisons, whereas the stable sort
+  // always takes n*log(n) of them.
+  if (!absl::c_is_sorted(connections_, better_connection)) {
+    absl::c_stable_sort(connections_, better_connection);
+  }
 
   RTC_LOG(LS_VERBOSE) << "Sorting " << connections_.size()
                       << " available connections due to: "
@@ -79,6 +79,9 @@ class BasicIceController : public IceControllerInterface {
   }
 
   const Connection* FindOldestConnectionNeedingTriggeredCheck(int64_t now);
+  // Returns the most pingable of the unpinged, pingable connections, or null
+  // if there is none.
+  const Connection* FindMostPingableUnpingedConnection(int64_t now);
   // Between `conn1` and `conn2`, this function returns the one which should
   // be pinged first.
   const Connection* MorePingable(const Connection* conn1,
@@ -10,6 +10,8 @@
 
 #include "p2p/base/turn_server.h"
 
+#include <string.h>
+
 #include <algorithm>
 #include <memory>
 #include <tuple>  // for std::tie
@@ -24,6 +26,7 @@
 #include "api/transport/stun.h"
 #include "p2p/base/async_stun_tcp_socket.h"
 #include "rtc_base/byte_buffer.h"
+#include "rtc_base/byte_order.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/helpers.h"
 #include "rtc_base/logging.h"
@@ -491,9 +494,15 @@ void TurnServer::SendStun(TurnServerConnection* conn, StunMessage* msg) {
 
 void TurnServer::Send(TurnServerConnection* conn,
                       const rtc::ByteBufferWriter& buf) {
+  Send(conn, rtc::MakeArrayView(reinterpret_cast<const uint8_t*>(buf.Data()),
+                                buf.Length()));
+}
+
+void TurnServer::Send(TurnServerConnection* conn,
+                      rtc::ArrayView<const uint8_t> data) {
   RTC_DCHECK_RUN_ON(thread_);
   rtc::PacketOptions options;
-  conn->socket()->SendTo(buf.Data(), buf.Length(), conn->src(), options);
+  conn->socket()->SendTo(data.data(), data.size(), conn->src(), options);
 }
 
 void TurnServer::DestroyAllocation(TurnServerAllocation* allocation) {
@@ -783,11 +792,12 @@ void TurnServerAllocation::OnExternalPacket(
   auto channel = FindChannel(addr);
   if (channel != channels_.end()) {
     // There is a channel bound to this address. Send as a channel message.
-    rtc::ByteBufferWriter buf;
-    buf.WriteUInt16(channel->id);
-    buf.WriteUInt16(static_cast<uint16_t>(size));
-    buf.WriteBytes(data, size);
-    server_->Send(&conn_, buf);
+    channel_data_buffer_.SetSize(TURN_CHANNEL_HEADER_SIZE + size);
+    rtc::SetBE16(channel_data_buffer_.data(),
+                 static_cast<uint16_t>(channel->id));
+    rtc::SetBE16(channel_data_buffer_.data() + 2, static_cast<uint16_t>(size));
+    memcpy(channel_data_buffer_.data() + TURN_CHANNEL_HEADER_SIZE, data, size);
+    server_->Send(&conn_, channel_data_buffer_);
   } else if (!server_->enable_permission_checks_ ||
              HasPermission(addr.ipaddr())) {
     // No channel, but a permission exists. Send as a data indication.
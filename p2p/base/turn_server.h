@@ -20,12 +20,14 @@
 #include <vector>
 
 #include "absl/strings/string_view.h"
+#include "api/array_view.h"
 #include "api/sequence_checker.h"
 #include "api/task_queue/pending_task_safety_flag.h"
 #include "api/task_queue/task_queue_base.h"
 #include "api/units/time_delta.h"
 #include "p2p/base/port_interface.h"
 #include "rtc_base/async_packet_socket.h"
+#include "rtc_base/buffer.h"
 #include "rtc_base/socket_address.h"
 #include "rtc_base/ssl_adapter.h"
 #include "rtc_base/third_party/sigslot/sigslot.h"
@@ -145,6 +147,9 @@ class TurnServerAllocation : public sigslot::has_slots<> {
   std::string last_nonce_;
   PermissionList perms_;
   ChannelList channels_;
+  // Reused for every ChannelData message relayed to the client, so that the
+  // relay path does not allocate per packet.
+  rtc::Buffer channel_data_buffer_;
   webrtc::ScopedTaskSafety safety_;
 };
 
@@ -323,6 +328,7 @@ class TurnServer : public sigslot::has_slots<> {
 
   void SendStun(TurnServerConnection* conn, StunMessage* msg);
   void Send(TurnServerConnection* conn, const rtc::ByteBufferWriter& buf);
+  void Send(TurnServerConnection* conn, rtc::ArrayView<const uint8_t> data);
 
   void DestroyAllocation(TurnServerAllocation* allocation) RTC_RUN_ON(thread_);
   void DestroyInternalSocket(rtc::AsyncPacketSocket* socket)
@@ -0,0 +1,113 @@
+/*
+ *  Copyright 2023 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "p2p/base/udp_port_demuxer.h"
+
+#include "api/transport/stun.h"
+#include "rtc_base/byte_order.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/logging.h"
+
+namespace cricket {
+
+UdpPortDemuxer::UdpPortDemuxer(rtc::AsyncPacketSocket* socket)
+    : socket_(socket) {
+  RTC_DCHECK(socket_);
+  socket_->SignalReadPacket.connect(this, &UdpPortDemuxer::OnReadPacket);
+}
+
+UdpPortDemuxer::~UdpPortDemuxer() {
+  socket_->SignalReadPacket.disconnect(this);
+}
+
+bool UdpPortDemuxer::AddPort(Port* port) {
+  RTC_DCHECK(port->SharedSocket());
+  return ports_by_ufrag_.emplace(port->username_fragment(), port).second;
+}
+
+void UdpPortDemuxer::RemovePort(Port* port) {
+  auto it = ports_by_ufrag_.find(port->username_fragment());
+  if (it != ports_by_ufrag_.end() && it->second == port) {
+    ports_by_ufrag_.erase(it);
+  }
+  for (auto addr_it = ports_by_remote_address_.begin();
+       addr_it != ports_by_remote_address_.end();) {
+    if (addr_it->second == port) {
+      addr_it = ports_by_remote_address_.erase(addr_it);
+    } else {
+      ++addr_it;
+    }
+  }
+}
+
+absl::optional<absl::string_view> UdpPortDemuxer::GetLocalUfrag(
+    const char* data,
+    size_t size) {
+  // The first two bits of a STUN message are zero and the magic cookie
+  // follows the type and length fields.
+  if (size < kStunHeaderSize || (data[0] & 0xC0) != 0 ||
+      rtc::GetBE32(data + 4) != kStunMagicCookie) {
+    return absl::nullopt;
+  }
+  size_t end = kStunHeaderSize + rtc::GetBE16(data + 2);
+  if (end > size) {
+    return absl::nullopt;
+  }
+  size_t pos = kStunHeaderSize;
+  while (pos + kStunAttributeHeaderSize <= end) {
+    uint16_t attr_type = rtc::GetBE16(data + pos);
+    uint16_t attr_length = rtc::GetBE16(data + pos + 2);
+    pos += kStunAttributeHeaderSize;
+    if (pos + attr_length > end) {
+      return absl::nullopt;
+    }
+    if (attr_type == STUN_ATTR_USERNAME) {
+      absl::string_view username(data + pos, attr_length);
+      return username.substr(0, username.find(':'));
+    }
+    // Attributes are padded to a multiple of four bytes.
+    pos += (attr_length + 3) & ~3;
+  }
+  return absl::nullopt;
+}
+
+void UdpPortDemuxer::OnReadPacket(rtc::AsyncPacketSocket* socket,
+                                  const char* data,
+                                  size_t size,
+                                  const rtc::SocketAddress& remote_addr,
+                                  const int64_t& packet_time_us) {
+  RTC_DCHECK_EQ(socket, socket_);
+  Port* port = nullptr;
+  absl::optional<absl::string_view> ufrag = GetLocalUfrag(data, size);
+  if (ufrag) {
+    auto it = ports_by_ufrag_.find(*ufrag);
+    if (it != ports_by_ufrag_.end()) {
+      port = it->second;
+    }
+  } else {
+    auto it = ports_by_remote_address_.find(remote_addr);
+    if (it != ports_by_remote_address_.end()) {
+      port = it->second;
+    }
+  }
+  if (!port) {
+    RTC_LOG(LS_VERBOSE) << "Dropping packet from unknown remote address "
+                        << remote_addr.ToSensitiveString();
+    return;
+  }
+  port->HandleIncomingPacket(socket, data, size, remote_addr, packet_time_us);
+  // Only learn addresses that the port accepted a connection from, so that
+  // unauthenticated requests cannot redirect another port's traffic.
+  if (ufrag && port->GetConnection(remote_addr)) {
+    ports_by_remote_address_[remote_addr] = port;
+  }
+}
+
+}  // namespace cricket
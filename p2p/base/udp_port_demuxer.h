@@ -0,0 +1,71 @@
+/*
+ *  Copyright 2023 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef P2P_BASE_UDP_PORT_DEMUXER_H_
+#define P2P_BASE_UDP_PORT_DEMUXER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <map>
+#include <string>
+
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+#include "p2p/base/port.h"
+#include "rtc_base/async_packet_socket.h"
+#include "rtc_base/socket_address.h"
+#include "rtc_base/third_party/sigslot/sigslot.h"
+
+namespace cricket {
+
+// Lets many UDP ports, typically one per ICE transport on a server, share a
+// single socket. Each port must be created in shared socket mode on the same
+// `socket`, e.g. with `UDPPort::Create(..., socket, ...)`, and is identified
+// by its local ICE username fragment.
+//
+// STUN messages carrying a USERNAME attribute are routed by the local ufrag
+// in it. Everything else (media, DTLS, STUN responses) is routed by the
+// remote address, which is learned once the port has a connection to it.
+// Packets that match no port are dropped.
+class UdpPortDemuxer : public sigslot::has_slots<> {
+ public:
+  // Does not take ownership of `socket`, which must outlive the demuxer.
+  explicit UdpPortDemuxer(rtc::AsyncPacketSocket* socket);
+  ~UdpPortDemuxer() override;
+
+  // Ports are not owned and must be removed before they are destroyed.
+  // Returns false if a port with the same ufrag was already added.
+  bool AddPort(Port* port);
+  void RemovePort(Port* port);
+
+  size_t num_ports() const { return ports_by_ufrag_.size(); }
+
+  // Returns the local ufrag of the USERNAME attribute ("local:remote") of
+  // the STUN message in `data`, without parsing the whole message. Returns
+  // nullopt if `data` is not a STUN message or has no such attribute.
+  static absl::optional<absl::string_view> GetLocalUfrag(const char* data,
+                                                         size_t size);
+
+ private:
+  void OnReadPacket(rtc::AsyncPacketSocket* socket,
+                    const char* data,
+                    size_t size,
+                    const rtc::SocketAddress& remote_addr,
+                    const int64_t& packet_time_us);
+
+  rtc::AsyncPacketSocket* const socket_;
+  std::map<std::string, Port*, std::less<>> ports_by_ufrag_;
+  std::map<rtc::SocketAddress, Port*> ports_by_remote_address_;
+};
+
+}  // namespace cricket
+
+#endif  // P2P_BASE_UDP_PORT_DEMUXER_H_
@@ -0,0 +1,177 @@
+/*
+ *  Copyright 2023 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "p2p/base/udp_port_demuxer.h"
+
+#include <memory>
+#include <string>
+
+#include "api/transport/stun.h"
+#include "p2p/base/basic_packet_socket_factory.h"
+#include "p2p/base/connection.h"
+#include "p2p/base/stun_port.h"
+#include "rtc_base/byte_buffer.h"
+#include "rtc_base/gunit.h"
+#include "rtc_base/network.h"
+#include "rtc_base/socket_address.h"
+#include "rtc_base/virtual_socket_server.h"
+#include "test/gtest.h"
+
+namespace cricket {
+namespace {
+
+const rtc::SocketAddress kLocalAddr("1.1.1.1", 0);
+const rtc::SocketAddress kRemoteAddr("2.2.2.2", 0);
+const char kUfrag1[] = "ufrag1";
+const char kUfrag2[] = "ufrag2";
+const char kPassword[] = "passwordpasswordpassword";
+const int kTimeoutMs = 1000;
+
+std::string CreateBindingRequest(absl::string_view username) {
+  IceMessage msg(STUN_BINDING_REQUEST, "TESTTESTTEST");
+  msg.AddAttribute(std::make_unique<StunByteStringAttribute>(
+      STUN_ATTR_USERNAME, std::string(username)));
+  msg.AddMessageIntegrity(kPassword);
+  msg.AddFingerprint();
+  rtc::ByteBufferWriter buf;
+  msg.Write(&buf);
+  return std::string(buf.Data(), buf.Length());
+}
+
+}  // namespace
+
+class UdpPortDemuxerTest : public ::testing::Test,
+                           public sigslot::has_slots<> {
+ public:
+  UdpPortDemuxerTest()
+      : ss_(new rtc::VirtualSocketServer()),
+        thread_(ss_.get()),
+        network_("unittest", "unittest", kLocalAddr.ipaddr(), 32),
+        socket_factory_(ss_.get()) {
+    network_.AddIP(kLocalAddr.ipaddr());
+    socket_.reset(socket_factory_.CreateUdpSocket(kLocalAddr, 0, 0));
+    remote_socket_.reset(socket_factory_.CreateUdpSocket(kRemoteAddr, 0, 0));
+    demuxer_ = std::make_unique<UdpPortDemuxer>(socket_.get());
+    port1_ = CreatePort(kUfrag1);
+    port2_ = CreatePort(kUfrag2);
+  }
+
+  std::unique_ptr<UDPPort> CreatePort(absl::string_view ufrag) {
+    std::unique_ptr<UDPPort> port = UDPPort::Create(
+        rtc::Thread::Current(), &socket_factory_, &network_, socket_.get(),
+        ufrag, kPassword, false, absl::nullopt);
+    port->SetIceRole(ICEROLE_CONTROLLED);
+    port->PrepareAddress();
+    port->SignalUnknownAddress.connect(this,
+                                       &UdpPortDemuxerTest::OnUnknownAddress);
+    return port;
+  }
+
+  void SendFromRemote(absl::string_view data) {
+    remote_socket_->SendTo(data.data(), data.size(), socket_->GetLocalAddress(),
+                           rtc::PacketOptions());
+  }
+
+  void OnUnknownAddress(PortInterface* port,
+                        const rtc::SocketAddress& address,
+                        ProtocolType proto,
+                        IceMessage* msg,
+                        const std::string& remote_username,
+                        bool port_muxed) {
+    port_with_unknown_address_ = port;
+    if (create_connections_) {
+      Candidate remote_candidate;
+      remote_candidate.set_address(address);
+      remote_candidate.set_protocol(UDP_PROTOCOL_NAME);
+      Connection* conn = port->CreateConnection(
+          remote_candidate, PortInterface::ORIGIN_THIS_PORT);
+      conn->SignalReadPacket.connect(this, &UdpPortDemuxerTest::OnReadPacket);
+    }
+  }
+
+  void OnReadPacket(Connection* conn,
+                    const char* data,
+                    size_t size,
+                    int64_t packet_time_us) {
+    connection_with_data_ = conn;
+  }
+
+ protected:
+  std::unique_ptr<rtc::VirtualSocketServer> ss_;
+  rtc::AutoSocketServerThread thread_;
+  rtc::Network network_;
+  rtc::BasicPacketSocketFactory socket_factory_;
+  std::unique_ptr<rtc::AsyncPacketSocket> socket_;
+  std::unique_ptr<rtc::AsyncPacketSocket> remote_socket_;
+  std::unique_ptr<UdpPortDemuxer> demuxer_;
+  std::unique_ptr<UDPPort> port1_;
+  std::unique_ptr<UDPPort> port2_;
+  bool create_connections_ = false;
+  PortInterface* port_with_unknown_address_ = nullptr;
+  Connection* connection_with_data_ = nullptr;
+};
+
+TEST(UdpPortDemuxerUfragTest, GetLocalUfrag) {
+  std::string request = CreateBindingRequest("local:remote");
+  EXPECT_EQ(UdpPortDemuxer::GetLocalUfrag(request.data(), request.size()),
+            "local");
+  // Truncated messages do not parse.
+  EXPECT_EQ(UdpPortDemuxer::GetLocalUfrag(request.data(), request.size() - 1),
+            absl::nullopt);
+  const char kNotStun[] = "this is not a stun message";
+  EXPECT_EQ(UdpPortDemuxer::GetLocalUfrag(kNotStun, sizeof(kNotStun)),
+            absl::nullopt);
+}
+
+TEST_F(UdpPortDemuxerTest, RejectsDuplicateUfrag) {
+  EXPECT_TRUE(demuxer_->AddPort(port1_.get()));
+  EXPECT_FALSE(demuxer_->AddPort(port1_.get()));
+  EXPECT_TRUE(demuxer_->AddPort(port2_.get()));
+  EXPECT_EQ(demuxer_->num_ports(), 2u);
+  demuxer_->RemovePort(port1_.get());
+  EXPECT_EQ(demuxer_->num_ports(), 1u);
+}
+
+TEST_F(UdpPortDemuxerTest, RoutesStunRequestByUfrag) {
+  demuxer_->AddPort(port1_.get());
+  demuxer_->AddPort(port2_.get());
+  SendFromRemote(CreateBindingRequest("ufrag2:remote"));
+  EXPECT_EQ_WAIT(port_with_unknown_address_, port2_.get(), kTimeoutMs);
+
+  port_with_unknown_address_ = nullptr;
+  SendFromRemote(CreateBindingRequest("ufrag1:remote"));
+  EXPECT_EQ_WAIT(port_with_unknown_address_, port1_.get(), kTimeoutMs);
+}
+
+TEST_F(UdpPortDemuxerTest, RoutesDataByLearnedAddress) {
+  create_connections_ = true;
+  demuxer_->AddPort(port1_.get());
+  demuxer_->AddPort(port2_.get());
+
+  // Data from an address without a connection is dropped.
+  SendFromRemote("data");
+  ss_->ProcessMessagesUntilIdle();
+  EXPECT_EQ(connection_with_data_, nullptr);
+
+  SendFromRemote(CreateBindingRequest("ufrag2:remote"));
+  EXPECT_EQ_WAIT(port_with_unknown_address_, port2_.get(), kTimeoutMs);
+  SendFromRemote("data");
+  ASSERT_TRUE_WAIT(connection_with_data_ != nullptr, kTimeoutMs);
+  EXPECT_EQ(connection_with_data_->PortForTest(), port2_.get());
+
+  // Once the port is removed its traffic is no longer delivered.
+  demuxer_->RemovePort(port2_.get());
+  connection_with_data_ = nullptr;
+  SendFromRemote("data");
+  ss_->ProcessMessagesUntilIdle();
+  EXPECT_EQ(connection_with_data_, nullptr);
+}
+
+}  // namespace cricket
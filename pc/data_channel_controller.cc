@@ -58,11 +58,12 @@ RTCError DataChannelController::SendData(
                                            payload);
 }
 
-void DataChannelController::AddSctpDataStream(StreamId sid) {
+void DataChannelController::AddSctpDataStream(StreamId sid,
+                                              Priority priority) {
   RTC_DCHECK_RUN_ON(network_thread());
   RTC_DCHECK(sid.HasValue());
   if (data_channel_transport_) {
-    data_channel_transport_->OpenChannel(sid.stream_id_int());
+    data_channel_transport_->OpenChannel(sid.stream_id_int(), priority);
   }
 }
 
@@ -308,7 +309,7 @@ DataChannelController::CreateDataChannel(const std::string& label,
 
   // If we have an id already, notify the transport.
   if (sid.HasValue())
-    AddSctpDataStream(sid);
+    AddSctpDataStream(sid, channel->priority());
 
   return channel;
 }
@@ -372,7 +373,7 @@ void DataChannelController::AllocateSctpSids(rtc::SSLRole role) {
       StreamId sid = sid_allocator_.AllocateSid(role);
       if (sid.HasValue()) {
         (*it)->SetSctpSid_n(sid);
-        AddSctpDataStream(sid);
+        AddSctpDataStream(sid, (*it)->priority());
         if (ready_to_send) {
           RTC_LOG(LS_INFO) << "AllocateSctpSids: Id assigned, ready to send.";
           (*it)->OnTransportReady();
@@ -431,7 +432,7 @@ void DataChannelController::NotifyDataChannelsOfTransportCreated() {
 
   for (const auto& channel : sctp_data_channels_n_) {
     if (channel->sid_n().HasValue())
-      AddSctpDataStream(channel->sid_n());
+      AddSctpDataStream(channel->sid_n(), channel->priority());
     channel->OnTransportChannelCreated();
   }
 }
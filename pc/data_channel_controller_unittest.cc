@@ -31,7 +31,10 @@ class MockDataChannelTransport : public webrtc::DataChannelTransportInterface {
  public:
   ~MockDataChannelTransport() override {}
 
-  MOCK_METHOD(RTCError, OpenChannel, (int channel_id), (override));
+  MOCK_METHOD(RTCError,
+              OpenChannel,
+              (int channel_id, Priority priority),
+              (override));
   MOCK_METHOD(RTCError,
               SendData,
               (int channel_id,
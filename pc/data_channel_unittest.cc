@@ -74,6 +74,28 @@ class FakeDataChannelObserver : public DataChannelObserver {
   size_t on_buffered_amount_change_count_ = 0u;
 };
 
+// Observer that opts in to being called on the network thread.
+class NetworkThreadDataChannelObserver : public DataChannelObserver {
+ public:
+  explicit NetworkThreadDataChannelObserver(rtc::Thread* network_thread)
+      : network_thread_(network_thread) {}
+
+  void OnStateChange() override {}
+
+  void OnMessage(const DataBuffer& buffer) override {
+    EXPECT_TRUE(network_thread_->IsCurrent());
+    ++messages_received_;
+  }
+
+  bool IsOkToCallOnTheNetworkThread() override { return true; }
+
+  size_t messages_received() const { return messages_received_; }
+
+ private:
+  rtc::Thread* const network_thread_;
+  size_t messages_received_ = 0u;
+};
+
 class SctpDataChannelTest : public ::testing::Test {
  protected:
   SctpDataChannelTest()
@@ -101,7 +123,7 @@ class SctpDataChannelTest : public ::testing::Test {
       RTC_DCHECK_RUN_ON(&network_thread_);
       if (!inner_channel_->sid_n().HasValue()) {
         inner_channel_->SetSctpSid_n(sid);
-        controller_->AddSctpDataStream(sid);
+        controller_->AddSctpDataStream(sid, inner_channel_->priority());
       }
       inner_channel_->OnTransportChannelCreated();
     });
@@ -119,7 +141,7 @@ class SctpDataChannelTest : public ::testing::Test {
     RTC_DCHECK(sid.HasValue());
     network_thread_.BlockingCall([&]() {
       channel->SetSctpSid_n(sid);
-      controller_->AddSctpDataStream(sid);
+      controller_->AddSctpDataStream(sid, channel->priority());
     });
   }
 
@@ -703,6 +725,23 @@ TEST_F(SctpDataChannelTest, ReceiveDataWithValidId) {
   EXPECT_EQ(1U, observer_->messages_received());
 }
 
+// Tests that observers that can be called on the network thread get messages
+// delivered directly, without a hop to the signaling thread.
+TEST_F(SctpDataChannelTest, ReceiveDataOnNetworkThread) {
+  SetChannelSid(inner_channel_, StreamId(1));
+  SetChannelReady();
+
+  NetworkThreadDataChannelObserver observer(&network_thread_);
+  channel_->RegisterObserver(&observer);
+
+  DataBuffer buffer("abcd");
+  network_thread_.BlockingCall([&] {
+    inner_channel_->OnDataReceived(DataMessageType::kText, buffer.data);
+    EXPECT_EQ(1U, observer.messages_received());
+  });
+  channel_->UnregisterObserver();
+}
+
 // Tests that no CONTROL message is sent if the datachannel is negotiated and
 // not created from an OPEN message.
 TEST_F(SctpDataChannelTest, NoMsgSentIfNegotiatedAndNotFromOpenMsg) {
@@ -864,6 +864,7 @@ RTCErrorOr<rtc::scoped_refptr<RtpSenderInterface>> PeerConnection::AddTrack(
     const std::vector<RtpEncodingParameters>* init_send_encodings) {
   RTC_DCHECK_RUN_ON(signaling_thread());
   TRACE_EVENT0("webrtc", "PeerConnection::AddTrack");
+  RTC_LOG_THREAD_BLOCK_COUNT();
   if (!ConfiguredForMedia()) {
     LOG_AND_RETURN_ERROR(RTCErrorType::UNSUPPORTED_OPERATION,
                          "Not configured for media");
@@ -1491,6 +1492,7 @@ RTCError PeerConnection::SetConfiguration(
     const RTCConfiguration& configuration) {
   RTC_DCHECK_RUN_ON(signaling_thread());
   TRACE_EVENT0("webrtc", "PeerConnection::SetConfiguration");
+  RTC_LOG_THREAD_BLOCK_COUNT();
   if (IsClosed()) {
     LOG_AND_RETURN_ERROR(RTCErrorType::INVALID_STATE,
                          "SetConfiguration: PeerConnection is closed.");
@@ -1605,11 +1607,16 @@ RTCError PeerConnection::SetConfiguration(
           configuration_.GetTurnPortPrunePolicy();
   cricket::IceConfig ice_config = ParseIceConfig(modified_config);
 
+  const bool active_reset_srtp_params_changed =
+      configuration_.active_reset_srtp_params !=
+      modified_config.active_reset_srtp_params;
+
   // Apply part of the configuration on the network thread.  In theory this
   // shouldn't fail.
   if (!network_thread()->BlockingCall(
-          [this, needs_ice_restart, &ice_config, &stun_servers, &turn_servers,
-           &modified_config, has_local_description] {
+          [this, needs_ice_restart, active_reset_srtp_params_changed,
+           &ice_config, &stun_servers, &turn_servers, &modified_config,
+           has_local_description] {
             RTC_DCHECK_RUN_ON(network_thread());
             // As described in JSEP, calling setConfiguration with new ICE
             // servers or candidate policy must set a "needs-ice-restart" bit so
@@ -1619,28 +1626,27 @@ RTCError PeerConnection::SetConfiguration(
               transport_controller_->SetNeedsIceRestartFlag();
 
             transport_controller_->SetIceConfig(ice_config);
-            return ReconfigurePortAllocator_n(
-                stun_servers, turn_servers, modified_config.type,
-                modified_config.ice_candidate_pool_size,
-                modified_config.GetTurnPortPrunePolicy(),
-                modified_config.turn_customizer,
-                modified_config.stun_candidate_keepalive_interval,
-                has_local_description);
+            if (!ReconfigurePortAllocator_n(
+                    stun_servers, turn_servers, modified_config.type,
+                    modified_config.ice_candidate_pool_size,
+                    modified_config.GetTurnPortPrunePolicy(),
+                    modified_config.turn_customizer,
+                    modified_config.stun_candidate_keepalive_interval,
+                    has_local_description)) {
+              return false;
+            }
+
+            // Applied in the same hop to avoid a second blocking call.
+            if (active_reset_srtp_params_changed) {
+              transport_controller_->SetActiveResetSrtpParams(
+                  modified_config.active_reset_srtp_params);
+            }
+            return true;
           })) {
     LOG_AND_RETURN_ERROR(RTCErrorType::INTERNAL_ERROR,
                          "Failed to apply configuration to PortAllocator.");
   }
 
-  if (configuration_.active_reset_srtp_params !=
-      modified_config.active_reset_srtp_params) {
-    // TODO(tommi): merge BlockingCalls
-    network_thread()->BlockingCall([this, &modified_config] {
-      RTC_DCHECK_RUN_ON(network_thread());
-      transport_controller_->SetActiveResetSrtpParams(
-          modified_config.active_reset_srtp_params);
-    });
-  }
-
   if (modified_config.allow_codec_switching.has_value()) {
     std::vector<cricket::VideoMediaSendChannelInterface*> channels;
     for (const auto& transceiver : rtp_manager()->transceivers()->List()) {
@@ -1654,12 +1660,14 @@ RTCError PeerConnection::SetConfiguration(
                 video_channel->media_send_channel()));
     }
 
-    worker_thread()->BlockingCall(
-        [channels = std::move(channels),
-         allow_codec_switching = *modified_config.allow_codec_switching]() {
-          for (auto* ch : channels)
-            ch->SetVideoCodecSwitchingEnabled(allow_codec_switching);
-        });
+    if (!channels.empty()) {
+      worker_thread()->BlockingCall(
+          [channels = std::move(channels),
+           allow_codec_switching = *modified_config.allow_codec_switching]() {
+            for (auto* ch : channels)
+              ch->SetVideoCodecSwitchingEnabled(allow_codec_switching);
+          });
+    }
   }
 
   configuration_ = modified_config;
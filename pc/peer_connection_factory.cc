@@ -10,6 +10,7 @@
 
 #include "pc/peer_connection_factory.h"
 
+#include <memory>
 #include <type_traits>
 #include <utility>
 
@@ -18,6 +19,7 @@
 #include "api/call/call_factory_interface.h"
 #include "api/fec_controller.h"
 #include "api/ice_transport_interface.h"
+#include "api/metronome/task_queue_metronome.h"
 #include "api/network_state_predictor.h"
 #include "api/packet_socket_factory.h"
 #include "api/rtc_event_log/rtc_event_log.h"
@@ -50,6 +52,8 @@
 #include "rtc_base/numerics/safe_conversions.h"
 #include "rtc_base/rtc_certificate_generator.h"
 #include "rtc_base/system/file_wrapper.h"
+#include "rtc_base/task_queue_thread_pool.h"
+#include "system_wrappers/include/clock.h"
 
 namespace webrtc {
 
@@ -101,7 +105,20 @@ PeerConnectionFactory::PeerConnectionFactory(
           (dependencies->transport_controller_send_factory)
               ? std::move(dependencies->transport_controller_send_factory)
               : std::make_unique<RtpTransportControllerSendFactory>()),
-      metronome_(std::move(dependencies->metronome)) {}
+      metronome_(std::move(dependencies->metronome)) {
+  // With thousands of PeerConnections per process, giving each Call its own
+  // pacer, encoder and decoder threads dominates the per-connection cost.
+  // This trial makes all Calls of the factory share a fixed pool of threads.
+  FieldTrialParameter<int> shared_call_threads("threads", 0);
+  ParseFieldTrial({&shared_call_threads},
+                  field_trials().Lookup("WebRTC-PcFactorySharedCallThreads"));
+  if (shared_call_threads > 0) {
+    RTC_LOG(LS_INFO) << "Sharing " << shared_call_threads.Get()
+                     << " threads between all Call instances.";
+    call_task_queue_factory_ =
+        CreateTaskQueueThreadPoolFactory(shared_call_threads);
+  }
+}
 
 PeerConnectionFactory::PeerConnectionFactory(
     PeerConnectionFactoryDependencies dependencies)
@@ -329,7 +346,9 @@ std::unique_ptr<Call> PeerConnectionFactory::CreateCall_w(
       rtc::saturated_cast<int>(max_bandwidth->bps());
 
   call_config.fec_controller_factory = fec_controller_factory_.get();
-  call_config.task_queue_factory = task_queue_factory_.get();
+  call_config.task_queue_factory = call_task_queue_factory_
+                                       ? call_task_queue_factory_.get()
+                                       : task_queue_factory_.get();
   call_config.network_state_predictor_factory =
       network_state_predictor_factory_.get();
   call_config.neteq_factory = neteq_factory_.get();
@@ -345,6 +364,14 @@ std::unique_ptr<Call> PeerConnectionFactory::CreateCall_w(
   call_config.trials = &field_trials;
   call_config.rtp_transport_controller_send_factory =
       transport_controller_send_factory_.get();
+  // Unless a metronome was injected, the calls share a default one, so that
+  // the receive streams of all of them decode on the same ticks.
+  if (!metronome_ &&
+      !absl::StartsWith(field_trials.Lookup("WebRTC-DefaultMetronome"),
+                        "Disabled")) {
+    metronome_ = std::make_unique<TaskQueueMetronome>(
+        Clock::GetRealTimeClock(), TaskQueueMetronome::kDefaultTickPeriod);
+  }
   call_config.metronome = metronome_.get();
   call_config.pacer_burst_interval = configuration.pacer_burst_interval;
   return std::unique_ptr<Call>(
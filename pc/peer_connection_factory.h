@@ -145,6 +145,9 @@ class PeerConnectionFactory : public PeerConnectionFactoryInterface {
   PeerConnectionFactoryInterface::Options options_
       RTC_GUARDED_BY(signaling_thread());
   std::unique_ptr<TaskQueueFactory> task_queue_factory_;
+  // When set, used instead of `task_queue_factory_` for the task queues of
+  // all Call instances, so that they share one pool of threads.
+  std::unique_ptr<TaskQueueFactory> call_task_queue_factory_;
   std::unique_ptr<RtcEventLogFactoryInterface> event_log_factory_;
   std::unique_ptr<FecControllerFactoryInterface> fec_controller_factory_;
   std::unique_ptr<NetworkStatePredictorFactoryInterface>
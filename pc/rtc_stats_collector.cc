@@ -511,6 +511,17 @@ std::unique_ptr<RTCInboundRtpStreamStats> CreateInboundAudioStreamStats(
   return inbound_audio;
 }
 
+std::map<std::string, uint64_t> CallbackTimeHistogramToMap(
+    const AudioDeviceModule::CallbackTimeHistogram& histogram) {
+  std::map<std::string, uint64_t> map;
+  for (size_t i = 0; i < histogram.counts.size(); ++i) {
+    map[rtc::ToString(
+        AudioDeviceModule::CallbackTimeHistogram::kBucketLowerBoundsMs[i])] =
+        histogram.counts[i];
+  }
+  return map;
+}
+
 std::unique_ptr<RTCAudioPlayoutStats> CreateAudioPlayoutStats(
     const AudioDeviceModule::Stats& audio_device_stats,
     webrtc::Timestamp timestamp) {
@@ -523,6 +534,14 @@ std::unique_ptr<RTCAudioPlayoutStats> CreateAudioPlayoutStats(
   stats->total_samples_count = audio_device_stats.total_samples_count;
   stats->total_samples_duration = audio_device_stats.total_samples_duration_s;
   stats->total_playout_delay = audio_device_stats.total_playout_delay_s;
+  stats->playout_callback_interval =
+      CallbackTimeHistogramToMap(audio_device_stats.playout_callback_interval);
+  stats->playout_callback_processing_time = CallbackTimeHistogramToMap(
+      audio_device_stats.playout_callback_processing_time);
+  stats->recording_callback_interval = CallbackTimeHistogramToMap(
+      audio_device_stats.recording_callback_interval);
+  stats->recording_callback_processing_time = CallbackTimeHistogramToMap(
+      audio_device_stats.recording_callback_processing_time);
   return stats;
 }
 
@@ -1080,7 +1099,7 @@ RTCStatsCollector::CreateReportFilteredBySelector(
   }
   if (rtpstream_ids.empty())
     return RTCStatsReport::Create(report->timestamp());
-  return TakeReferencedStats(report->Copy(), rtpstream_ids);
+  return CopyReferencedStats(*report, rtpstream_ids);
 }
 
 RTCStatsCollector::CertificateStatsPair
@@ -2479,6 +2479,11 @@ TEST_F(RTCStatsCollectorTest, CollectRTCAudioPlayoutStats) {
   audio_device_stats.total_samples_count = 3;
   audio_device_stats.total_samples_duration_s = 4;
   audio_device_stats.total_playout_delay_s = 5;
+  audio_device_stats.playout_callback_interval.Add(10000);
+  audio_device_stats.playout_callback_interval.Add(12000);
+  audio_device_stats.playout_callback_processing_time.Add(300);
+  audio_device_stats.recording_callback_interval.Add(150000);
+  audio_device_stats.recording_callback_processing_time.Add(1500);
   pc_->SetAudioDeviceStats(audio_device_stats);
 
   rtc::scoped_refptr<const RTCStatsReport> report = stats_->GetStatsReport();
@@ -2492,6 +2497,21 @@ TEST_F(RTCStatsCollectorTest, CollectRTCAudioPlayoutStats) {
   expected_stats.total_samples_count = 3;
   expected_stats.total_samples_duration = 4;
   expected_stats.total_playout_delay = 5;
+  const std::map<std::string, uint64_t> empty_histogram = {
+      {"0", 0},  {"1", 0},  {"2", 0},  {"5", 0},  {"10", 0},
+      {"15", 0}, {"20", 0}, {"30", 0}, {"50", 0}, {"100", 0}};
+  std::map<std::string, uint64_t> histogram = empty_histogram;
+  histogram["10"] = 2;
+  expected_stats.playout_callback_interval = histogram;
+  histogram = empty_histogram;
+  histogram["0"] = 1;
+  expected_stats.playout_callback_processing_time = histogram;
+  histogram = empty_histogram;
+  histogram["100"] = 1;
+  expected_stats.recording_callback_interval = histogram;
+  histogram = empty_histogram;
+  histogram["1"] = 1;
+  expected_stats.recording_callback_processing_time = histogram;
 
   ASSERT_TRUE(report->Get(expected_stats.id()));
   EXPECT_EQ(report->Get(expected_stats.id())->cast_to<RTCAudioPlayoutStats>(),
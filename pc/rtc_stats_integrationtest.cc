@@ -1004,6 +1004,12 @@ class RTCStatsReportVerifier {
     verifier.TestMemberIsNonNegative<double>(
         audio_playout.total_samples_duration);
     verifier.TestMemberIsNonNegative<double>(audio_playout.total_playout_delay);
+    verifier.TestMemberIsDefined(audio_playout.playout_callback_interval);
+    verifier.TestMemberIsDefined(
+        audio_playout.playout_callback_processing_time);
+    verifier.TestMemberIsDefined(audio_playout.recording_callback_interval);
+    verifier.TestMemberIsDefined(
+        audio_playout.recording_callback_processing_time);
     return verifier.ExpectAllMembersSuccessfullyTested();
   }
 
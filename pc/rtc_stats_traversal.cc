@@ -42,6 +42,26 @@ void TraverseAndTakeVisitedStats(RTCStatsReport* report,
   }
 }
 
+void TraverseAndCopyVisitedStats(const RTCStatsReport& report,
+                                 RTCStatsReport* visited_report,
+                                 const std::string& current_id) {
+  if (visited_report->Get(current_id)) {
+    // This node has already been visited.
+    return;
+  }
+  const RTCStats* current = report.Get(current_id);
+  if (!current) {
+    // Invalid id.
+    return;
+  }
+  visited_report->AddStats(current->copy());
+
+  // Recursively traverse all neighbors.
+  for (const auto* neighbor_id : GetStatsReferencedIds(*current)) {
+    TraverseAndCopyVisitedStats(report, visited_report, *neighbor_id);
+  }
+}
+
 void AddIdIfDefined(const RTCStatsMember<std::string>& id,
                     std::vector<const std::string*>* neighbor_ids) {
   if (id.is_defined())
@@ -61,6 +81,17 @@ rtc::scoped_refptr<RTCStatsReport> TakeReferencedStats(
   return result;
 }
 
+rtc::scoped_refptr<RTCStatsReport> CopyReferencedStats(
+    const RTCStatsReport& report,
+    const std::vector<std::string>& ids) {
+  rtc::scoped_refptr<RTCStatsReport> result =
+      RTCStatsReport::Create(report.timestamp());
+  for (const auto& id : ids) {
+    TraverseAndCopyVisitedStats(report, result.get(), id);
+  }
+  return result;
+}
+
 std::vector<const std::string*> GetStatsReferencedIds(const RTCStats& stats) {
   std::vector<const std::string*> neighbor_ids;
   const char* type = stats.type();
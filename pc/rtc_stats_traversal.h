@@ -29,6 +29,13 @@ rtc::scoped_refptr<RTCStatsReport> TakeReferencedStats(
     rtc::scoped_refptr<RTCStatsReport> report,
     const std::vector<std::string>& ids);
 
+// Like TakeReferencedStats(), but leaves `report` untouched and copies only
+// the stats objects that are visited. This is cheaper than copying the whole
+// report first when the selection is small compared to the report.
+rtc::scoped_refptr<RTCStatsReport> CopyReferencedStats(
+    const RTCStatsReport& report,
+    const std::vector<std::string>& ids);
+
 // Gets pointers to the string values of any members in `stats` that are used as
 // references for looking up other stats objects in the same report by ID. The
 // pointers are valid for the lifetime of `stats` assumings its members are not
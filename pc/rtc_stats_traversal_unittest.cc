@@ -16,7 +16,8 @@
 #include "api/stats/rtcstats_objects.h"
 #include "test/gtest.h"
 
-// This file contains tests for TakeReferencedStats().
+// This file contains tests for TakeReferencedStats() and
+// CopyReferencedStats().
 // GetStatsNeighborIds() is tested in rtcstats_integrationtest.cc.
 
 namespace webrtc {
@@ -207,4 +208,41 @@ TEST_F(RTCStatsTraversalTest, MultipleStartsLeadingToSameNode) {
   EXPECT_VISITED(remote_candidate_);
 }
 
+TEST_F(RTCStatsTraversalTest, CopyLeavesInitialReportUntouched) {
+  //     start:candidate-pair
+  //        |            |
+  //        v            v
+  // local-candidate   remote-candidate
+  //       |               |
+  //       v               v
+  //   transport <---------+
+  candidate_pair_->local_candidate_id = "local-candidate";
+  candidate_pair_->remote_candidate_id = "remote-candidate";
+  local_candidate_->transport_id = "transport";
+  remote_candidate_->transport_id = "transport";
+  result_ = CopyReferencedStats(*initial_report_, {"local-candidate"});
+  EXPECT_EQ(initial_report_->size(), 4u);
+  EXPECT_EQ(result_->size(), 2u);
+  ASSERT_TRUE(result_->Get("local-candidate"));
+  ASSERT_TRUE(result_->Get("transport"));
+  // The copies are not the objects owned by the initial report.
+  EXPECT_NE(result_->Get("local-candidate"), local_candidate_);
+  EXPECT_EQ(*result_->Get("local-candidate"), *local_candidate_);
+}
+
+TEST_F(RTCStatsTraversalTest, CopyCyclicGraphAndBogusReference) {
+  local_candidate_->transport_id = "transport";
+  transport_->selected_candidate_pair_id = "candidate-pair";
+  transport_->rtcp_transport_stats_id = "bogus-reference";
+  candidate_pair_->local_candidate_id = "local-candidate";
+  result_ =
+      CopyReferencedStats(*initial_report_, {"local-candidate", "bogus-start"});
+  EXPECT_EQ(initial_report_->size(), 4u);
+  EXPECT_TRUE(result_->Get("local-candidate"));
+  EXPECT_TRUE(result_->Get("transport"));
+  EXPECT_TRUE(result_->Get("candidate-pair"));
+  EXPECT_FALSE(result_->Get("remote-candidate"));
+  EXPECT_EQ(result_->size(), 3u);
+}
+
 }  // namespace webrtc
@@ -142,6 +142,39 @@ TaskQueueBase* GetCurrentTaskQueueOrThread() {
   return current;
 }
 
+const std::vector<cricket::Codec>* GetCodecs(
+    const cricket::MediaContentDescription& content) {
+  if (content.as_audio())
+    return &content.as_audio()->codecs();
+  if (content.as_video())
+    return &content.as_video()->codecs();
+  return nullptr;
+}
+
+// Compares the parts of two media descriptions that are consumed by
+// BaseChannel::SetLocalContent() and BaseChannel::SetRemoteContent().
+bool EqualChannelContent(const cricket::MediaContentDescription& a,
+                         const cricket::MediaContentDescription& b) {
+  if (a.type() != b.type() || a.direction() != b.direction() ||
+      a.rtcp_mux() != b.rtcp_mux() ||
+      a.rtcp_reduced_size() != b.rtcp_reduced_size() ||
+      a.remote_estimate() != b.remote_estimate() ||
+      a.bandwidth() != b.bandwidth() ||
+      a.bandwidth_type() != b.bandwidth_type() ||
+      a.conference_mode() != b.conference_mode() ||
+      a.extmap_allow_mixed_enum() != b.extmap_allow_mixed_enum() ||
+      a.rtp_header_extensions_set() != b.rtp_header_extensions_set() ||
+      a.rtp_header_extensions() != b.rtp_header_extensions() ||
+      a.streams() != b.streams()) {
+    return false;
+  }
+  const std::vector<cricket::Codec>* a_codecs = GetCodecs(a);
+  const std::vector<cricket::Codec>* b_codecs = GetCodecs(b);
+  if (!a_codecs || !b_codecs)
+    return a_codecs == b_codecs;
+  return *a_codecs == *b_codecs;
+}
+
 }  // namespace
 
 RtpTransceiver::RtpTransceiver(cricket::MediaType media_type,
@@ -313,6 +346,7 @@ void RtpTransceiver::SetChannel(
 
   RTC_DCHECK_EQ(media_type(), channel->media_type());
   signaling_thread_safety_ = PendingTaskSafetyFlag::Create();
+  ResetAppliedContent();
 
   std::unique_ptr<cricket::ChannelInterface> channel_to_delete;
 
@@ -359,6 +393,7 @@ void RtpTransceiver::ClearChannel() {
     signaling_thread_safety_->SetNotAlive();
     signaling_thread_safety_ = nullptr;
   }
+  ResetAppliedContent();
   std::unique_ptr<cricket::ChannelInterface> channel_to_delete;
 
   context()->network_thread()->BlockingCall([&]() {
@@ -786,6 +821,51 @@ void RtpTransceiver::OnNegotiationUpdate(
     negotiated_header_extensions_ = content->rtp_header_extensions();
 }
 
+bool RtpTransceiver::HasAppliedContent(
+    cricket::ContentSource source,
+    SdpType sdp_type,
+    const cricket::MediaContentDescription* content) const {
+  RTC_DCHECK_RUN_ON(thread_);
+  RTC_DCHECK(content);
+  const AppliedContent& applied = source == cricket::CS_LOCAL
+                                      ? applied_local_content_
+                                      : applied_remote_content_;
+  const AppliedContent& other = source == cricket::CS_LOCAL
+                                    ? applied_remote_content_
+                                    : applied_local_content_;
+  return applied.content && applied.sdp_type == sdp_type &&
+         applied.other_version == other.version &&
+         EqualChannelContent(*applied.content, *content);
+}
+
+void RtpTransceiver::OnContentApplied(
+    cricket::ContentSource source,
+    SdpType sdp_type,
+    const cricket::MediaContentDescription* content) {
+  RTC_DCHECK_RUN_ON(thread_);
+  RTC_DCHECK(content);
+  AppliedContent& applied = source == cricket::CS_LOCAL
+                                ? applied_local_content_
+                                : applied_remote_content_;
+  const AppliedContent& other = source == cricket::CS_LOCAL
+                                    ? applied_remote_content_
+                                    : applied_local_content_;
+  if (!applied.content || applied.sdp_type != sdp_type ||
+      !EqualChannelContent(*applied.content, *content)) {
+    applied.content = content->Clone();
+    applied.sdp_type = sdp_type;
+    ++applied.version;
+  }
+  applied.other_version = other.version;
+}
+
+void RtpTransceiver::ResetAppliedContent() {
+  RTC_DCHECK_RUN_ON(thread_);
+  // Versions are kept so that a stale `other_version` can never match.
+  applied_local_content_.content.reset();
+  applied_remote_content_.content.reset();
+}
+
 void RtpTransceiver::SetPeerConnectionClosed() {
   is_pc_closed_ = true;
 }
@@ -296,6 +296,22 @@ class RtpTransceiver : public RtpTransceiverInterface {
   void OnNegotiationUpdate(SdpType sdp_type,
                            const cricket::MediaContentDescription* content);
 
+  // Returns true if `content` of `sdp_type` from `source` is identical to
+  // the content most recently applied to the current channel from that
+  // source, and the content from the other source has not changed since.
+  // In that case pushing `content` down to the channel again would have no
+  // effect and the worker thread hop can be skipped.
+  bool HasAppliedContent(cricket::ContentSource source,
+                         SdpType sdp_type,
+                         const cricket::MediaContentDescription* content) const;
+
+  // Records that `content` of `sdp_type` from `source` was successfully
+  // applied to the current channel. The record is reset whenever the channel
+  // is set or cleared.
+  void OnContentApplied(cricket::ContentSource source,
+                        SdpType sdp_type,
+                        const cricket::MediaContentDescription* content);
+
  private:
   cricket::MediaEngineInterface* media_engine() const {
     return context_->media_engine();
@@ -345,6 +361,21 @@ class RtpTransceiver : public RtpTransceiverInterface {
   cricket::RtpHeaderExtensions negotiated_header_extensions_
       RTC_GUARDED_BY(thread_);
 
+  // The content last applied to `channel_` from each source, used to skip
+  // redundant pushdowns on renegotiation. `version` is bumped every time the
+  // content changes and `other_version` is the version of the other source's
+  // content at the time this content was applied, since applying content of
+  // one source depends on the state of the other (e.g. for answers).
+  struct AppliedContent {
+    std::unique_ptr<cricket::MediaContentDescription> content;
+    SdpType sdp_type = SdpType::kOffer;
+    int version = 0;
+    int other_version = 0;
+  };
+  void ResetAppliedContent();
+  AppliedContent applied_local_content_ RTC_GUARDED_BY(thread_);
+  AppliedContent applied_remote_content_ RTC_GUARDED_BY(thread_);
+
   const std::function<void()> on_negotiation_needed_;
 };
 
@@ -132,6 +132,38 @@ TEST_F(RtpTransceiverTest, CanUnsetChannelOnStoppedTransceiver) {
   EXPECT_EQ(nullptr, transceiver->channel());
 }
 
+// Checks that applied content is only reported as such while neither side of
+// the negotiation changes.
+TEST_F(RtpTransceiverTest, TracksAppliedContent) {
+  auto transceiver = rtc::make_ref_counted<RtpTransceiver>(
+      cricket::MediaType::MEDIA_TYPE_AUDIO, context());
+  cricket::AudioContentDescription local;
+  local.AddCodec(cricket::CreateAudioCodec(111, "opus", 48000, 2));
+  cricket::AudioContentDescription remote = local;
+
+  EXPECT_FALSE(transceiver->HasAppliedContent(cricket::CS_LOCAL,
+                                              SdpType::kOffer, &local));
+  transceiver->OnContentApplied(cricket::CS_LOCAL, SdpType::kOffer, &local);
+  EXPECT_TRUE(transceiver->HasAppliedContent(cricket::CS_LOCAL,
+                                             SdpType::kOffer, &local));
+  EXPECT_FALSE(transceiver->HasAppliedContent(cricket::CS_LOCAL,
+                                              SdpType::kAnswer, &local));
+
+  transceiver->OnContentApplied(cricket::CS_REMOTE, SdpType::kAnswer, &remote);
+  EXPECT_TRUE(transceiver->HasAppliedContent(cricket::CS_REMOTE,
+                                             SdpType::kAnswer, &remote));
+  // The local content was applied before the remote content changed.
+  EXPECT_FALSE(transceiver->HasAppliedContent(cricket::CS_LOCAL,
+                                              SdpType::kOffer, &local));
+  transceiver->OnContentApplied(cricket::CS_LOCAL, SdpType::kOffer, &local);
+  EXPECT_TRUE(transceiver->HasAppliedContent(cricket::CS_LOCAL,
+                                             SdpType::kOffer, &local));
+
+  remote.set_direction(RtpTransceiverDirection::kRecvOnly);
+  EXPECT_FALSE(transceiver->HasAppliedContent(cricket::CS_REMOTE,
+                                              SdpType::kAnswer, &remote));
+}
+
 class RtpTransceiverUnifiedPlanTest : public RtpTransceiverTest {
  public:
   RtpTransceiverUnifiedPlanTest()
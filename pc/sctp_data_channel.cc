@@ -707,11 +707,12 @@ void SctpDataChannel::OnDataReceived(DataMessageType type,
   }
 
   bool binary = (type == DataMessageType::kBinary);
-  auto buffer = std::make_unique<DataBuffer>(payload, binary);
   if (state_ == kOpen && observer_) {
     ++messages_received_;
-    bytes_received_ += buffer->size();
-    observer_->OnMessage(*buffer.get());
+    bytes_received_ += payload.size();
+    // Only allocate the buffer when it has to be queued; observers that run on
+    // the network thread otherwise get the message without any allocation.
+    observer_->OnMessage(DataBuffer(payload, binary));
   } else {
     if (queued_received_data_.byte_count() + payload.size() >
         kMaxQueuedReceivedDataBytes) {
@@ -724,7 +725,8 @@ void SctpDataChannel::OnDataReceived(DataMessageType type,
 
       return;
     }
-    queued_received_data_.PushBack(std::move(buffer));
+    queued_received_data_.PushBack(
+        std::make_unique<DataBuffer>(payload, binary));
   }
 }
 
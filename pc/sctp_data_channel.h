@@ -48,7 +48,7 @@ class SctpDataChannelControllerInterface {
                             const SendDataParams& params,
                             const rtc::CopyOnWriteBuffer& payload) = 0;
   // Adds the data channel SID to the transport for SCTP.
-  virtual void AddSctpDataStream(StreamId sid) = 0;
+  virtual void AddSctpDataStream(StreamId sid, Priority priority) = 0;
   // Begins the closing procedure by sending an outgoing stream reset. Still
   // need to wait for callbacks to tell when this completes.
   virtual void RemoveSctpDataStream(StreamId sid) = 0;
@@ -2247,6 +2247,7 @@ void SdpOfferAnswerHandler::DoSetLocalDescription(
     rtc::scoped_refptr<SetLocalDescriptionObserverInterface> observer) {
   RTC_DCHECK_RUN_ON(signaling_thread());
   TRACE_EVENT0("webrtc", "SdpOfferAnswerHandler::DoSetLocalDescription");
+  RTC_LOG_THREAD_BLOCK_COUNT();
 
   if (!observer) {
     RTC_LOG(LS_ERROR) << "SetLocalDescription - observer is NULL.";
@@ -2353,6 +2354,7 @@ void SdpOfferAnswerHandler::DoCreateOffer(
     rtc::scoped_refptr<CreateSessionDescriptionObserver> observer) {
   RTC_DCHECK_RUN_ON(signaling_thread());
   TRACE_EVENT0("webrtc", "SdpOfferAnswerHandler::DoCreateOffer");
+  RTC_LOG_THREAD_BLOCK_COUNT();
 
   if (!observer) {
     RTC_LOG(LS_ERROR) << "CreateOffer - observer is NULL.";
@@ -2439,6 +2441,7 @@ void SdpOfferAnswerHandler::DoCreateAnswer(
     rtc::scoped_refptr<CreateSessionDescriptionObserver> observer) {
   RTC_DCHECK_RUN_ON(signaling_thread());
   TRACE_EVENT0("webrtc", "SdpOfferAnswerHandler::DoCreateAnswer");
+  RTC_LOG_THREAD_BLOCK_COUNT();
   if (!observer) {
     RTC_LOG(LS_ERROR) << "CreateAnswer - observer is NULL.";
     return;
@@ -2494,6 +2497,7 @@ void SdpOfferAnswerHandler::DoSetRemoteDescription(
     std::unique_ptr<RemoteDescriptionOperation> operation) {
   RTC_DCHECK_RUN_ON(signaling_thread());
   TRACE_EVENT0("webrtc", "SdpOfferAnswerHandler::DoSetRemoteDescription");
+  RTC_LOG_THREAD_BLOCK_COUNT();
 
   if (!operation->ok())
     return;
@@ -4770,8 +4774,7 @@ RTCError SdpOfferAnswerHandler::PushdownMediaDescription(
 
     // Push down the new SDP media section for each audio/video transceiver.
     auto rtp_transceivers = transceivers()->ListInternal();
-    std::vector<
-        std::pair<cricket::ChannelInterface*, const MediaContentDescription*>>
+    std::vector<std::pair<RtpTransceiver*, const MediaContentDescription*>>
         channels;
     for (const auto& transceiver : rtp_transceivers) {
       const ContentInfo* content_info =
@@ -4787,7 +4790,12 @@ RTCError SdpOfferAnswerHandler::PushdownMediaDescription(
       }
 
       transceiver->OnNegotiationUpdate(type, content_desc);
-      channels.push_back(std::make_pair(channel, content_desc));
+      // Only m-sections that changed since they were last applied need to be
+      // pushed down; on renegotiation this is typically a small subset.
+      if (transceiver->HasAppliedContent(source, type, content_desc)) {
+        continue;
+      }
+      channels.push_back(std::make_pair(transceiver, content_desc));
     }
 
     // This for-loop of invokes helps audio impairment during re-negotiations.
@@ -4801,15 +4809,17 @@ RTCError SdpOfferAnswerHandler::PushdownMediaDescription(
     // - crbug.com/1157227
     // - crbug.com/1187289
     for (const auto& entry : channels) {
+      cricket::ChannelInterface* channel = entry.first->channel();
       std::string error;
       bool success = context_->worker_thread()->BlockingCall([&]() {
         return (source == cricket::CS_LOCAL)
-                   ? entry.first->SetLocalContent(entry.second, type, error)
-                   : entry.first->SetRemoteContent(entry.second, type, error);
+                   ? channel->SetLocalContent(entry.second, type, error)
+                   : channel->SetRemoteContent(entry.second, type, error);
       });
       if (!success) {
         LOG_AND_RETURN_ERROR(RTCErrorType::INVALID_PARAMETER, error);
       }
+      entry.first->OnContentApplied(source, type, entry.second);
     }
   }
   // Need complete offer/answer with an SCTP m= section before starting SCTP,
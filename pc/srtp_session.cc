@@ -207,6 +207,42 @@ bool SrtpSession::ProtectRtp(void* p,
   return (index) ? GetSendStreamPacketIndex(p, in_len, index) : true;
 }
 
+bool SrtpSession::ProtectRtpPackets(
+    rtc::ArrayView<rtc::CopyOnWriteBuffer* const> packets) {
+  RTC_DCHECK(thread_checker_.IsCurrent());
+  if (!session_) {
+    RTC_LOG(LS_WARNING) << "Failed to protect SRTP packets: no SRTP Session";
+    return false;
+  }
+  for (const rtc::CopyOnWriteBuffer* packet : packets) {
+    if (packet->capacity() < packet->size() + rtp_auth_tag_len_) {
+      RTC_LOG(LS_WARNING)
+          << "Failed to protect SRTP packets: The buffer length "
+          << packet->capacity() << " is less than the needed "
+          << packet->size() + rtp_auth_tag_len_;
+      return false;
+    }
+  }
+
+  for (rtc::CopyOnWriteBuffer* packet : packets) {
+    int len = static_cast<int>(packet->size());
+    if (dump_plain_rtp_) {
+      DumpPacket(packet->cdata(), len, /*outbound=*/true);
+    }
+    int seq_num = ParseRtpSequenceNumber(*packet);
+    int err = srtp_protect(session_, packet->MutableData(), &len);
+    if (err != srtp_err_status_ok) {
+      RTC_LOG(LS_WARNING) << "Failed to protect SRTP packet, seqnum="
+                          << seq_num << ", err=" << err
+                          << ", last seqnum=" << last_send_seq_num_;
+      return false;
+    }
+    packet->SetSize(len);
+    last_send_seq_num_ = seq_num;
+  }
+  return true;
+}
+
 bool SrtpSession::ProtectRtcp(void* p, int in_len, int max_len, int* out_len) {
   RTC_DCHECK(thread_checker_.IsCurrent());
   if (!session_) {
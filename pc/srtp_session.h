@@ -16,9 +16,11 @@
 
 #include <vector>
 
+#include "api/array_view.h"
 #include "api/field_trials_view.h"
 #include "api/scoped_refptr.h"
 #include "api/sequence_checker.h"
+#include "rtc_base/copy_on_write_buffer.h"
 #include "rtc_base/synchronization/mutex.h"
 
 // Forward declaration to avoid pulling in libsrtp headers here
@@ -73,6 +75,12 @@ class SrtpSession {
                   int max_len,
                   int* out_len,
                   int64_t* index);
+  // Encrypts/signs a batch of RTP packets, in-place and in order, growing
+  // each of them by the auth tag. The session and the capacity of all packets
+  // are checked before any packet is protected, so an invalid batch is left
+  // untouched. Returns false if a packet could not be protected; the packets
+  // before it are protected.
+  bool ProtectRtpPackets(rtc::ArrayView<rtc::CopyOnWriteBuffer* const> packets);
   bool ProtectRtcp(void* data, int in_len, int max_len, int* out_len);
   // Decrypts/verifies an invidiual RTP/RTCP packet.
   // If an HMAC is used, this will decrease the packet size.
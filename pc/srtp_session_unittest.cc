@@ -13,6 +13,7 @@
 #include <string.h>
 
 #include <string>
+#include <vector>
 
 #include "media/base/fake_rtp.h"
 #include "pc/test/srtp_test_util.h"
@@ -194,6 +195,48 @@ TEST_F(SrtpSessionTest, TestBuffersTooSmall) {
                                sizeof(rtcp_packet_) - 14, &out_len));
 }
 
+// Test that a batch of RTP packets is protected like individual packets.
+TEST_F(SrtpSessionTest, TestProtectRtpPackets) {
+  EXPECT_TRUE(s1_.SetSend(kSrtpAes128CmSha1_80, kTestKey1, kTestKeyLen,
+                          kEncryptedHeaderExtensionIds));
+  EXPECT_TRUE(s2_.SetRecv(kSrtpAes128CmSha1_80, kTestKey1, kTestKeyLen,
+                          kEncryptedHeaderExtensionIds));
+  std::vector<CopyOnWriteBuffer> packets;
+  for (uint16_t seq_num = 1; seq_num <= 3; ++seq_num) {
+    packets.emplace_back(kPcmuFrame, rtp_len_, sizeof(rtp_packet_));
+    SetBE16(packets.back().MutableData() + 2, seq_num);
+  }
+  std::vector<CopyOnWriteBuffer> plain_packets = packets;
+  std::vector<CopyOnWriteBuffer*> batch;
+  for (CopyOnWriteBuffer& packet : packets) {
+    batch.push_back(&packet);
+  }
+  EXPECT_TRUE(s1_.ProtectRtpPackets(batch));
+
+  for (size_t i = 0; i < packets.size(); ++i) {
+    EXPECT_EQ(static_cast<int>(packets[i].size()),
+              rtp_len_ + rtp_auth_tag_len(kCsAesCm128HmacSha1_80));
+    int out_len = 0;
+    EXPECT_TRUE(s2_.UnprotectRtp(packets[i].MutableData(),
+                                 static_cast<int>(packets[i].size()),
+                                 &out_len));
+    EXPECT_EQ(out_len, rtp_len_);
+    EXPECT_EQ(0, memcmp(packets[i].data(), plain_packets[i].data(), out_len));
+  }
+}
+
+// Test that no packet of a batch is protected if one of them is too small.
+TEST_F(SrtpSessionTest, TestProtectRtpPacketsBufferTooSmall) {
+  EXPECT_TRUE(s1_.SetSend(kSrtpAes128CmSha1_80, kTestKey1, kTestKeyLen,
+                          kEncryptedHeaderExtensionIds));
+  CopyOnWriteBuffer packet(kPcmuFrame, rtp_len_, sizeof(rtp_packet_));
+  CopyOnWriteBuffer small_packet(kPcmuFrame, rtp_len_, rtp_len_);
+  CopyOnWriteBuffer* batch[] = {&packet, &small_packet};
+  EXPECT_FALSE(s1_.ProtectRtpPackets(batch));
+  EXPECT_EQ(packet.size(), static_cast<size_t>(rtp_len_));
+  EXPECT_EQ(0, memcmp(packet.data(), kPcmuFrame, rtp_len_));
+}
+
 TEST_F(SrtpSessionTest, TestReplay) {
   static const uint16_t kMaxSeqnum = static_cast<uint16_t>(-1);
   static const uint16_t seqnum_big = 62275;
@@ -195,6 +195,9 @@ void VideoRtpReceiver::RestartMediaChannel_w(
     media_channel_->SetDepacketizerToDecoderFrameTransformer(
         signaled_ssrc_.value_or(0), frame_transformer_);
   }
+  if (decode_limit_ != VideoReceiveStreamInterface::DecodeLimit::kNone) {
+    ApplyDecodeLimit();
+  }
 
   if (media_channel_ && signaled_ssrc_) {
     if (frame_decryptor_) {
@@ -341,6 +344,9 @@ void VideoRtpReceiver::SetMediaChannel_w(
       media_channel_->SetDepacketizerToDecoderFrameTransformer(
           signaled_ssrc_.value_or(0), frame_transformer_);
     }
+    if (decode_limit_ != VideoReceiveStreamInterface::DecodeLimit::kNone) {
+      ApplyDecodeLimit();
+    }
   }
 
   if (!media_channel)
@@ -401,6 +407,20 @@ void VideoRtpReceiver::OnEncodedSinkEnabled(bool enable) {
   saved_encoded_sink_enabled_ = enable;
 }
 
+void VideoRtpReceiver::OnDecodeLimitChanged(
+    VideoReceiveStreamInterface::DecodeLimit limit) {
+  RTC_DCHECK_RUN_ON(worker_thread_);
+  decode_limit_ = limit;
+  ApplyDecodeLimit();
+}
+
+void VideoRtpReceiver::ApplyDecodeLimit() {
+  if (!media_channel_)
+    return;
+  // TODO(bugs.webrtc.org/8694): Stop using 0 to mean unsignalled SSRC
+  media_channel_->SetRecvDecodeLimit(signaled_ssrc_.value_or(0), decode_limit_);
+}
+
 void VideoRtpReceiver::SetEncodedSinkEnabled(bool enable) {
   RTC_DCHECK_RUN_ON(worker_thread_);
   if (!media_channel_)
@@ -30,6 +30,7 @@
 #include "api/video/video_frame.h"
 #include "api/video/video_sink_interface.h"
 #include "api/video/video_source_interface.h"
+#include "call/video_receive_stream.h"
 #include "media/base/media_channel.h"
 #include "pc/jitter_buffer_delay.h"
 #include "pc/media_stream_track_proxy.h"
@@ -134,8 +135,10 @@ class VideoRtpReceiver : public RtpReceiverInternal,
   // VideoRtpTrackSource::Callback
   void OnGenerateKeyFrame();
   void OnEncodedSinkEnabled(bool enable);
+  void OnDecodeLimitChanged(VideoReceiveStreamInterface::DecodeLimit limit);
 
   void SetEncodedSinkEnabled(bool enable) RTC_RUN_ON(worker_thread_);
+  void ApplyDecodeLimit() RTC_RUN_ON(worker_thread_);
 
   class SourceCallback : public VideoRtpTrackSource::Callback {
    public:
@@ -147,6 +150,10 @@ class VideoRtpReceiver : public RtpReceiverInternal,
     void OnEncodedSinkEnabled(bool enable) override {
       receiver_->OnEncodedSinkEnabled(enable);
     }
+    void OnDecodeLimitChanged(
+        VideoReceiveStreamInterface::DecodeLimit limit) override {
+      receiver_->OnDecodeLimitChanged(limit);
+    }
 
     VideoRtpReceiver* const receiver_;
   } source_callback_{this};
@@ -185,6 +192,11 @@ class VideoRtpReceiver : public RtpReceiverInternal,
   // or switched.
   bool saved_generate_keyframe_ RTC_GUARDED_BY(worker_thread_) = false;
   bool saved_encoded_sink_enabled_ RTC_GUARDED_BY(worker_thread_) = false;
+  // Latest decode limit of `source_`, applied again when the ssrc or
+  // `media_channel_` changes.
+  VideoReceiveStreamInterface::DecodeLimit decode_limit_
+      RTC_GUARDED_BY(worker_thread_) =
+          VideoReceiveStreamInterface::DecodeLimit::kNone;
   const rtc::scoped_refptr<PendingTaskSafetyFlag> worker_thread_safety_;
 };
 
@@ -63,6 +63,10 @@ class VideoRtpReceiverTest : public testing::Test {
                 (uint32_t),
                 (override));
     MOCK_METHOD(void, RequestRecvKeyFrame, (uint32_t), (override));
+    MOCK_METHOD(void,
+                SetRecvDecodeLimit,
+                (uint32_t, VideoReceiveStreamInterface::DecodeLimit),
+                (override));
   };
 
   class MockVideoSink : public rtc::VideoSinkInterface<RecordableEncodedFrame> {
@@ -140,6 +144,32 @@ TEST_F(VideoRtpReceiverTest,
   SetMediaChannel(nullptr);
 }
 
+TEST_F(VideoRtpReceiverTest, AppliesDecodeLimitOfSinksOnChannelSwitch) {
+  using DecodeLimit = VideoReceiveStreamInterface::DecodeLimit;
+  class FrameSink : public rtc::VideoSinkInterface<VideoFrame> {
+   public:
+    void OnFrame(const VideoFrame& frame) override {}
+  } sink;
+  rtc::VideoSinkWants wants;
+  wants.max_framerate_fps = 0;
+  EXPECT_CALL(channel_,
+              SetRecvDecodeLimit(/*ssrc=*/0, DecodeLimit::kKeyFramesOnly));
+  Source()->AddOrUpdateSink(&sink, wants);
+  Mock::VerifyAndClearExpectations(&channel_);
+
+  MockVideoMediaReceiveChannel channel2{cricket::VideoOptions()};
+  EXPECT_CALL(channel2, SetRecvDecodeLimit(0, DecodeLimit::kKeyFramesOnly));
+  SetMediaChannel(&channel2);
+  Mock::VerifyAndClearExpectations(&channel2);
+
+  EXPECT_CALL(channel2, SetRecvDecodeLimit(0, DecodeLimit::kNone));
+  Source()->RemoveSink(&sink);
+
+  // We must call SetMediaChannel(nullptr) here since the mock media channels
+  // live on the stack and `receiver_` still has a pointer to those objects.
+  SetMediaChannel(nullptr);
+}
+
 TEST_F(VideoRtpReceiverTest, EnablesEncodedOutput) {
   EXPECT_CALL(channel_, SetRecordableEncodedFrameCallback(/*ssrc=*/0, _));
   EXPECT_CALL(channel_, ClearRecordableEncodedFrameCallback).Times(0);
@@ -17,6 +17,23 @@
 #include "rtc_base/checks.h"
 
 namespace webrtc {
+namespace {
+
+// Sinks that render at most this many pixels only get the base layer.
+constexpr int kMaxBaseLayerPixelCount = 320 * 180;
+
+VideoReceiveStreamInterface::DecodeLimit DecodeLimitForWants(
+    const rtc::VideoSinkWants& wants) {
+  if (wants.black_frames || wants.max_framerate_fps == 0) {
+    return VideoReceiveStreamInterface::DecodeLimit::kKeyFramesOnly;
+  }
+  if (wants.max_pixel_count <= kMaxBaseLayerPixelCount) {
+    return VideoReceiveStreamInterface::DecodeLimit::kBaseLayer;
+  }
+  return VideoReceiveStreamInterface::DecodeLimit::kNone;
+}
+
+}  // namespace
 
 VideoRtpTrackSource::VideoRtpTrackSource(Callback* callback)
     : VideoTrackSource(true /* remote */), callback_(callback) {}
@@ -41,6 +58,43 @@ void VideoRtpTrackSource::BroadcastRecordableEncodedFrame(
   }
 }
 
+void VideoRtpTrackSource::AddOrUpdateSink(
+    rtc::VideoSinkInterface<VideoFrame>* sink,
+    const rtc::VideoSinkWants& wants) {
+  RTC_DCHECK_RUN_ON(&worker_sequence_checker_);
+  VideoTrackSource::AddOrUpdateSink(sink, wants);
+  sink_wants_[sink] = wants;
+  UpdateDecodeLimit();
+}
+
+void VideoRtpTrackSource::RemoveSink(
+    rtc::VideoSinkInterface<VideoFrame>* sink) {
+  RTC_DCHECK_RUN_ON(&worker_sequence_checker_);
+  VideoTrackSource::RemoveSink(sink);
+  sink_wants_.erase(sink);
+  UpdateDecodeLimit();
+}
+
+void VideoRtpTrackSource::UpdateDecodeLimit() {
+  // The sink that needs the most frames decides. Without sinks, nothing is
+  // known about how the video is rendered, so all frames are decoded.
+  VideoReceiveStreamInterface::DecodeLimit limit =
+      VideoReceiveStreamInterface::DecodeLimit::kNone;
+  if (!sink_wants_.empty()) {
+    limit = VideoReceiveStreamInterface::DecodeLimit::kKeyFramesOnly;
+    for (const auto& [sink, wants] : sink_wants_) {
+      limit = std::min(limit, DecodeLimitForWants(wants));
+    }
+  }
+  if (limit == decode_limit_) {
+    return;
+  }
+  decode_limit_ = limit;
+  if (callback_) {
+    callback_->OnDecodeLimitChanged(limit);
+  }
+}
+
 bool VideoRtpTrackSource::SupportsEncodedOutput() const {
   return true;
 }
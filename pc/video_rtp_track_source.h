@@ -11,6 +11,7 @@
 #ifndef PC_VIDEO_RTP_TRACK_SOURCE_H_
 #define PC_VIDEO_RTP_TRACK_SOURCE_H_
 
+#include <map>
 #include <vector>
 
 #include "api/sequence_checker.h"
@@ -18,6 +19,7 @@
 #include "api/video/video_frame.h"
 #include "api/video/video_sink_interface.h"
 #include "api/video/video_source_interface.h"
+#include "call/video_receive_stream.h"
 #include "media/base/video_broadcaster.h"
 #include "pc/video_track_source.h"
 #include "rtc_base/synchronization/mutex.h"
@@ -40,6 +42,11 @@ class VideoRtpTrackSource : public VideoTrackSource {
     // frames using BroadcastEncodedFrameBuffer.
     // The implementor should cause a keyframe to be eventually generated.
     virtual void OnEncodedSinkEnabled(bool enable) = 0;
+
+    // Called when the sinks need fewer decoded frames than before, or more,
+    // e.g. when all of them are rendered small or not at all.
+    virtual void OnDecodeLimitChanged(
+        VideoReceiveStreamInterface::DecodeLimit limit) = 0;
   };
 
   explicit VideoRtpTrackSource(Callback* callback);
@@ -61,6 +68,12 @@ class VideoRtpTrackSource : public VideoTrackSource {
   rtc::VideoSourceInterface<VideoFrame>* source() override;
   rtc::VideoSinkInterface<VideoFrame>* sink();
 
+  // Adds or removes a sink and updates the decode limit from the wants of all
+  // sinks. Must be called on the worker thread.
+  void AddOrUpdateSink(rtc::VideoSinkInterface<VideoFrame>* sink,
+                       const rtc::VideoSinkWants& wants) override;
+  void RemoveSink(rtc::VideoSinkInterface<VideoFrame>* sink) override;
+
   // Returns true. This method can be called on any thread.
   bool SupportsEncodedOutput() const override;
 
@@ -76,6 +89,8 @@ class VideoRtpTrackSource : public VideoTrackSource {
       rtc::VideoSinkInterface<RecordableEncodedFrame>* sink) override;
 
  private:
+  void UpdateDecodeLimit() RTC_RUN_ON(worker_sequence_checker_);
+
   RTC_NO_UNIQUE_ADDRESS SequenceChecker worker_sequence_checker_{
       SequenceChecker::kDetached};
   // `broadcaster_` is needed since the decoder can only handle one sink.
@@ -86,6 +101,11 @@ class VideoRtpTrackSource : public VideoTrackSource {
   std::vector<rtc::VideoSinkInterface<RecordableEncodedFrame>*> encoded_sinks_
       RTC_GUARDED_BY(mu_);
   Callback* callback_ RTC_GUARDED_BY(worker_sequence_checker_);
+  std::map<rtc::VideoSinkInterface<VideoFrame>*, rtc::VideoSinkWants>
+      sink_wants_ RTC_GUARDED_BY(worker_sequence_checker_);
+  VideoReceiveStreamInterface::DecodeLimit decode_limit_
+      RTC_GUARDED_BY(worker_sequence_checker_) =
+          VideoReceiveStreamInterface::DecodeLimit::kNone;
 };
 
 }  // namespace webrtc
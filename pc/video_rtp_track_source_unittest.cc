@@ -26,6 +26,10 @@ class MockCallback : public VideoRtpTrackSource::Callback {
  public:
   MOCK_METHOD(void, OnGenerateKeyFrame, (), (override));
   MOCK_METHOD(void, OnEncodedSinkEnabled, (bool), (override));
+  MOCK_METHOD(void,
+              OnDecodeLimitChanged,
+              (VideoReceiveStreamInterface::DecodeLimit),
+              (override));
 };
 
 class MockSink : public rtc::VideoSinkInterface<RecordableEncodedFrame> {
@@ -107,6 +111,41 @@ TEST(VideoRtpTrackSourceTest, NoCallbacksAfterClearedCallback) {
   source->RemoveEncodedSink(&sink);
 }
 
+class MockFrameSink : public rtc::VideoSinkInterface<VideoFrame> {
+ public:
+  MOCK_METHOD(void, OnFrame, (const VideoFrame&), (override));
+};
+
+TEST(VideoRtpTrackSourceTest, DecodeLimitFollowsMostDemandingSink) {
+  using DecodeLimit = VideoReceiveStreamInterface::DecodeLimit;
+  testing::StrictMock<MockCallback> mock_callback;
+  auto source = MakeSource(&mock_callback);
+  MockFrameSink hidden_sink;
+  rtc::VideoSinkWants hidden_wants;
+  hidden_wants.black_frames = true;
+  EXPECT_CALL(mock_callback, OnDecodeLimitChanged(DecodeLimit::kKeyFramesOnly));
+  source->AddOrUpdateSink(&hidden_sink, hidden_wants);
+
+  MockFrameSink small_sink;
+  rtc::VideoSinkWants small_wants;
+  small_wants.max_pixel_count = 160 * 90;
+  EXPECT_CALL(mock_callback, OnDecodeLimitChanged(DecodeLimit::kBaseLayer));
+  source->AddOrUpdateSink(&small_sink, small_wants);
+
+  // Wants that map to the current limit do not notify.
+  small_wants.max_pixel_count = 320 * 180;
+  source->AddOrUpdateSink(&small_sink, small_wants);
+  testing::Mock::VerifyAndClearExpectations(&mock_callback);
+
+  EXPECT_CALL(mock_callback, OnDecodeLimitChanged(DecodeLimit::kNone));
+  source->AddOrUpdateSink(&small_sink, rtc::VideoSinkWants());
+  EXPECT_CALL(mock_callback, OnDecodeLimitChanged(DecodeLimit::kKeyFramesOnly));
+  source->RemoveSink(&small_sink);
+  // Without sinks, all frames are decoded.
+  EXPECT_CALL(mock_callback, OnDecodeLimitChanged(DecodeLimit::kNone));
+  source->RemoveSink(&hidden_sink);
+}
+
 class TestFrame : public RecordableEncodedFrame {
  public:
   rtc::scoped_refptr<const webrtc::EncodedImageBufferInterface> encoded_buffer()
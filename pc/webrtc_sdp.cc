@@ -28,6 +28,7 @@
 #include "absl/algorithm/container.h"
 #include "absl/strings/ascii.h"
 #include "absl/strings/match.h"
+#include "absl/strings/str_cat.h"
 #include "api/candidate.h"
 #include "api/crypto_params.h"
 #include "api/jsep_ice_candidate.h"
@@ -616,25 +617,34 @@ static bool AddSsrcLine(uint32_t ssrc_id,
   return AddLine(os.str(), message);
 }
 
-// Get value only from <attribute>:<value>.
+// Get value only from <attribute>:<value>. `value` refers into `message`.
 static bool GetValue(absl::string_view message,
                      absl::string_view attribute,
-                     std::string* value,
+                     absl::string_view* value,
                      SdpParseError* error) {
-  std::string leftpart;
+  absl::string_view leftpart;
   if (!rtc::tokenize_first(message, kSdpDelimiterColonChar, &leftpart, value)) {
     return ParseFailedGetValue(message, attribute, error);
   }
   // The left part should end with the expected attribute.
-  if (leftpart.length() < attribute.length() ||
-      absl::string_view(leftpart).compare(
-          leftpart.length() - attribute.length(), attribute.length(),
-          attribute) != 0) {
+  if (!absl::EndsWith(leftpart, attribute)) {
     return ParseFailedGetValue(message, attribute, error);
   }
   return true;
 }
 
+static bool GetValue(absl::string_view message,
+                     absl::string_view attribute,
+                     std::string* value,
+                     SdpParseError* error) {
+  absl::string_view value_view;
+  if (!GetValue(message, attribute, &value_view, error)) {
+    return false;
+  }
+  *value = std::string(value_view);
+  return true;
+}
+
 // Get a single [token] from <attribute>:<token>
 static bool GetSingleTokenValue(absl::string_view message,
                                 absl::string_view attribute,
@@ -2911,24 +2921,12 @@ T GetCodecWithPayloadType(cricket::MediaType type,
 }
 
 // Updates or creates a new codec entry in the media description.
+// Replaces the codec in place, since copying all the codecs of the media
+// description for every rtpmap, fmtp and rtcp-fb line dominates the parsing
+// time of large descriptions.
 template <class T, class U>
 void AddOrReplaceCodec(MediaContentDescription* content_desc, const U& codec) {
-  T* desc = static_cast<T*>(content_desc);
-  std::vector<U> codecs = desc->codecs();
-  bool found = false;
-  for (U& existing_codec : codecs) {
-    if (codec.id == existing_codec.id) {
-      // Overwrite existing codec with the new codec.
-      existing_codec = codec;
-      found = true;
-      break;
-    }
-  }
-  if (!found) {
-    desc->AddCodec(codec);
-    return;
-  }
-  desc->set_codecs(codecs);
+  static_cast<T*>(content_desc)->AddOrReplaceCodec(codec);
 }
 
 // Adds or updates existing codec corresponding to `payload_type` according
@@ -3066,8 +3064,8 @@ bool ParseContent(absl::string_view message,
     // RFC 4566
     // b=* (zero or more bandwidth information lines)
     if (IsLineType(*line, kLineTypeSessionBandwidth)) {
-      std::string bandwidth;
-      std::string bandwidth_type;
+      absl::string_view bandwidth;
+      absl::string_view bandwidth_type;
       if (!rtc::tokenize_first(line->substr(kLinePrefixLength),
                                kSdpDelimiterColonChar, &bandwidth_type,
                                &bandwidth)) {
@@ -3097,7 +3095,9 @@ bool ParseContent(absl::string_view message,
       }
       if (b < 0) {
         return ParseFailed(
-            *line, "b=" + bandwidth_type + " value can't be negative.", error);
+            *line,
+            absl::StrCat("b=", bandwidth_type, " value can't be negative."),
+            error);
       }
       // Convert values. Prevent integer overflow.
       if (bandwidth_type == kApplicationSpecificBandwidth) {
@@ -3106,7 +3106,7 @@ bool ParseContent(absl::string_view message,
         b = std::min(b, INT_MAX);
       }
       media_desc->set_bandwidth(b);
-      media_desc->set_bandwidth_type(bandwidth_type);
+      media_desc->set_bandwidth_type(std::string(bandwidth_type));
       continue;
     }
 
@@ -3460,7 +3460,7 @@ bool ParseSsrcAttribute(absl::string_view line,
   // RFC 5576
   // a=ssrc:<ssrc-id> <attribute>
   // a=ssrc:<ssrc-id> <attribute>:<value>
-  std::string field1, field2;
+  absl::string_view field1, field2;
   if (!rtc::tokenize_first(line.substr(kLinePrefixLength),
                            kSdpDelimiterSpaceChar, &field1, &field2)) {
     const size_t expected_fields = 2;
@@ -3468,7 +3468,7 @@ bool ParseSsrcAttribute(absl::string_view line,
   }
 
   // ssrc:<ssrc-id>
-  std::string ssrc_id_s;
+  absl::string_view ssrc_id_s;
   if (!GetValue(field1, kAttributeSsrc, &ssrc_id_s, error)) {
     return false;
   }
@@ -3477,8 +3477,8 @@ bool ParseSsrcAttribute(absl::string_view line,
     return false;
   }
 
-  std::string attribute;
-  std::string value;
+  absl::string_view attribute;
+  absl::string_view value;
   if (!rtc::tokenize_first(field2, kSdpDelimiterColonChar, &attribute,
                            &value)) {
     rtc::StringBuilder description;
@@ -3505,7 +3505,7 @@ bool ParseSsrcAttribute(absl::string_view line,
   if (attribute == kSsrcAttributeCname) {
     // RFC 5576
     // cname:<value>
-    ssrc_info.cname = value;
+    ssrc_info.cname = std::string(value);
   } else if (attribute == kSsrcAttributeMsid) {
     // draft-alvestrand-mmusic-msid-00
     // msid:identifier [appdata]
@@ -3638,7 +3638,7 @@ bool ParseRtpmapAttribute(absl::string_view line,
   if (fields.size() < expected_min_fields) {
     return ParseFailedExpectMinFieldNum(line, expected_min_fields, error);
   }
-  std::string payload_type_value;
+  absl::string_view payload_type_value;
   if (!GetValue(fields[0], kAttributeRtpmap, &payload_type_value, error)) {
     return false;
   }
@@ -3747,8 +3747,8 @@ bool ParseFmtpAttributes(absl::string_view line,
     return true;
   }
 
-  std::string line_payload;
-  std::string line_params;
+  absl::string_view line_payload;
+  absl::string_view line_params;
 
   // https://tools.ietf.org/html/rfc4566#section-6
   // a=fmtp:<format> <format specific parameters>
@@ -3762,7 +3762,7 @@ bool ParseFmtpAttributes(absl::string_view line,
   }
 
   // Parse out the payload information.
-  std::string payload_type_str;
+  absl::string_view payload_type_str;
   if (!GetValue(line_payload, kAttributeFmtp, &payload_type_str, error)) {
     return false;
   }
@@ -3812,7 +3812,7 @@ bool ParsePacketizationAttribute(absl::string_view line,
   if (packetization_fields.size() < 2) {
     return ParseFailedGetValue(line, kAttributePacketization, error);
   }
-  std::string payload_type_string;
+  absl::string_view payload_type_string;
   if (!GetValue(packetization_fields[0], kAttributePacketization,
                 &payload_type_string, error)) {
     return false;
@@ -3841,7 +3841,7 @@ bool ParseRtcpFbAttribute(absl::string_view line,
   if (rtcp_fb_fields.size() < 2) {
     return ParseFailedGetValue(line, kAttributeRtcpFb, error);
   }
-  std::string payload_type_string;
+  absl::string_view payload_type_string;
   if (!GetValue(rtcp_fb_fields[0], kAttributeRtcpFb, &payload_type_string,
                 error)) {
     return false;
@@ -0,0 +1,163 @@
+/*
+ *  Copyright 2023 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <stdint.h>
+
+#include <string>
+
+#include "api/jsep_session_description.h"
+#include "api/test/metrics/global_metrics_logger_and_exporter.h"
+#include "api/test/metrics/metric.h"
+#include "pc/session_description.h"
+#include "pc/webrtc_sdp.h"
+#include "rtc_base/strings/string_builder.h"
+#include "rtc_base/time_utils.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+using ::webrtc::test::GetGlobalMetricsLogger;
+using ::webrtc::test::ImprovementDirection;
+using ::webrtc::test::Unit;
+
+constexpr int kNumWarmupIterations = 5;
+constexpr int kNumMeasuredIterations = 50;
+
+// Creates an offer like the ones an SFU sends to a participant of a large
+// room: one audio m-section and then `num_video_sections` video m-sections,
+// each with three simulcast layers.
+std::string CreateLargeOffer(int num_video_sections) {
+  rtc::StringBuilder sdp;
+  sdp << "v=0\r\n"
+         "o=- 4611731400430051336 2 IN IP4 127.0.0.1\r\n"
+         "s=-\r\n"
+         "t=0 0\r\n"
+         "a=group:BUNDLE 0";
+  for (int i = 1; i <= num_video_sections; ++i) {
+    sdp << " " << i;
+  }
+  sdp << "\r\n"
+         "a=msid-semantic: WMS\r\n"
+         "m=audio 9 UDP/TLS/RTP/SAVPF 111 63 9 0 8 13 110 126\r\n"
+         "c=IN IP4 0.0.0.0\r\n"
+         "a=rtcp:9 IN IP4 0.0.0.0\r\n"
+         "a=ice-ufrag:ETEn\r\n"
+         "a=ice-pwd:OtSK0WpNtpUjkY4+86js7Z/l\r\n"
+         "a=fingerprint:sha-256 "
+         "19:E2:1C:3B:4B:9F:81:E6:B8:5C:F4:A5:A8:D8:73:04:"
+         "BB:05:2F:70:9F:04:A9:0E:05:E9:26:33:E8:70:88:A2\r\n"
+         "a=setup:actpass\r\n"
+         "a=mid:0\r\n"
+         "a=extmap:1 urn:ietf:params:rtp-hdrext:ssrc-audio-level\r\n"
+         "a=extmap:4 urn:ietf:params:rtp-hdrext:sdes:mid\r\n"
+         "a=recvonly\r\n"
+         "a=rtcp-mux\r\n"
+         "a=rtpmap:111 opus/48000/2\r\n"
+         "a=rtcp-fb:111 transport-cc\r\n"
+         "a=fmtp:111 minptime=10;useinbandfec=1\r\n"
+         "a=rtpmap:63 red/48000/2\r\n"
+         "a=fmtp:63 111/111\r\n"
+         "a=rtpmap:9 G722/8000\r\n"
+         "a=rtpmap:0 PCMU/8000\r\n"
+         "a=rtpmap:8 PCMA/8000\r\n"
+         "a=rtpmap:13 CN/8000\r\n"
+         "a=rtpmap:110 telephone-event/48000\r\n"
+         "a=rtpmap:126 telephone-event/8000\r\n";
+  for (int i = 1; i <= num_video_sections; ++i) {
+    sdp << "m=video 9 UDP/TLS/RTP/SAVPF 96 97 98 99 100 101 102 103 104 105\r\n"
+           "c=IN IP4 0.0.0.0\r\n"
+           "a=rtcp:9 IN IP4 0.0.0.0\r\n"
+           "a=ice-ufrag:ETEn\r\n"
+           "a=ice-pwd:OtSK0WpNtpUjkY4+86js7Z/l\r\n"
+           "a=fingerprint:sha-256 "
+           "19:E2:1C:3B:4B:9F:81:E6:B8:5C:F4:A5:A8:D8:73:04:"
+           "BB:05:2F:70:9F:04:A9:0E:05:E9:26:33:E8:70:88:A2\r\n"
+           "a=setup:actpass\r\n"
+        << "a=mid:" << i << "\r\n"
+        << "a=extmap:4 urn:ietf:params:rtp-hdrext:sdes:mid\r\n"
+           "a=extmap:10 urn:ietf:params:rtp-hdrext:sdes:rtp-stream-id\r\n"
+           "a=extmap:11 "
+           "urn:ietf:params:rtp-hdrext:sdes:repaired-rtp-stream-id\r\n"
+           "a=extmap:3 http://www.webrtc.org/experiments/rtp-hdrext/"
+           "abs-send-time\r\n"
+           "a=sendonly\r\n"
+        << "a=msid:stream_" << i << " track_" << i << "\r\n"
+        << "a=rtcp-mux\r\n"
+           "a=rtcp-rsize\r\n";
+    const char* const kCodecs[] = {"VP8", "VP9", "H264", "AV1", "red"};
+    for (int c = 0; c < 5; ++c) {
+      const int payload_type = 96 + 2 * c;
+      sdp << "a=rtpmap:" << payload_type << " " << kCodecs[c] << "/90000\r\n"
+          << "a=rtcp-fb:" << payload_type << " goog-remb\r\n"
+          << "a=rtcp-fb:" << payload_type << " transport-cc\r\n"
+          << "a=rtcp-fb:" << payload_type << " ccm fir\r\n"
+          << "a=rtcp-fb:" << payload_type << " nack\r\n"
+          << "a=rtcp-fb:" << payload_type << " nack pli\r\n";
+      if (c == 2) {
+        sdp << "a=fmtp:" << payload_type
+            << " level-asymmetry-allowed=1;packetization-mode=1;"
+               "profile-level-id=42e01f\r\n";
+      }
+      sdp << "a=rtpmap:" << payload_type + 1 << " rtx/90000\r\n"
+          << "a=fmtp:" << payload_type + 1 << " apt=" << payload_type
+          << "\r\n";
+    }
+    sdp << "a=rid:q send\r\n"
+           "a=rid:h send\r\n"
+           "a=rid:f send\r\n"
+           "a=simulcast:send q;h;f\r\n";
+  }
+  return sdp.Release();
+}
+
+}  // namespace
+
+// Measures the time in nanoseconds per m-section to parse and to serialize
+// large simulcast offers.
+TEST(WebRtcSdpPerformanceTest, LargeSimulcastOffer) {
+  for (int num_video_sections : {10, 100}) {
+    SCOPED_TRACE(num_video_sections);
+    const std::string offer = CreateLargeOffer(num_video_sections);
+    const int num_sections = num_video_sections + 1;
+    int64_t deserialize_ns = 0;
+    int64_t serialize_ns = 0;
+    for (int i = 0; i < kNumWarmupIterations + kNumMeasuredIterations; ++i) {
+      JsepSessionDescription jdesc(SdpType::kOffer);
+      SdpParseError error;
+      const int64_t start_ns = rtc::TimeNanos();
+      ASSERT_TRUE(SdpDeserialize(offer, &jdesc, &error)) << error.description;
+      const int64_t deserialized_ns = rtc::TimeNanos();
+      std::string serialized = SdpSerialize(jdesc);
+      const int64_t serialized_ns = rtc::TimeNanos();
+      EXPECT_FALSE(serialized.empty());
+      ASSERT_EQ(jdesc.description()->contents().size(),
+                static_cast<size_t>(num_sections));
+      if (i >= kNumWarmupIterations) {
+        deserialize_ns += deserialized_ns - start_ns;
+        serialize_ns += serialized_ns - deserialized_ns;
+      }
+    }
+    const std::string story =
+        "simulcast_offer_" + std::to_string(num_sections) + "_sections";
+    GetGlobalMetricsLogger()->LogSingleValueMetric(
+        "sdp_deserialize_ns_per_section", story,
+        static_cast<double>(deserialize_ns) /
+            (kNumMeasuredIterations * num_sections),
+        Unit::kUnitless, ImprovementDirection::kSmallerIsBetter);
+    GetGlobalMetricsLogger()->LogSingleValueMetric(
+        "sdp_serialize_ns_per_section", story,
+        static_cast<double>(serialize_ns) /
+            (kNumMeasuredIterations * num_sections),
+        Unit::kUnitless, ImprovementDirection::kSmallerIsBetter);
+  }
+}
+
+}  // namespace webrtc
@@ -14,6 +14,7 @@
 
 #include <string>
 
+#include "api/task_queue/task_queue_base.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/logging.h"
 #include "rtc_base/network/sent_packet.h"
@@ -47,7 +48,10 @@ AsyncUDPSocket* AsyncUDPSocket::Create(SocketFactory* factory,
   return Create(socket, bind_address);
 }
 
-AsyncUDPSocket::AsyncUDPSocket(Socket* socket) : socket_(socket) {
+AsyncUDPSocket::AsyncUDPSocket(Socket* socket)
+    : socket_(socket),
+      batched_receive_(
+          webrtc::field_trial::IsEnabled("WebRTC-Network-BatchedUdpReceive")) {
   sequence_checker_.Detach();
   // The socket should start out readable but not writable.
   socket_->SignalReadEvent.connect(this, &AsyncUDPSocket::OnReadEvent);
@@ -68,6 +72,8 @@ int AsyncUDPSocket::Send(const void* pv,
   rtc::SentPacket sent_packet(options.packet_id, rtc::TimeMillis(),
                               options.info_signaled_after_sent);
   CopySocketInformationToPacketInfo(cb, *this, false, &sent_packet.info);
+  // Send any batched packets first, to keep the packets in order.
+  SendBatch();
   int ret = socket_->Send(pv, cb);
   SignalSentPacket(this, sent_packet);
   return ret;
@@ -77,6 +83,32 @@ int AsyncUDPSocket::SendTo(const void* pv,
                            size_t cb,
                            const SocketAddress& addr,
                            const rtc::PacketOptions& options) {
+  if (options.batchable) {
+    AddToBatch(pv, cb, addr, options);
+    if (!options.last_packet_in_batch && batch_size_ < kMaxBatchSize) {
+      // Normally the batch is sent when its last packet arrives. In case that
+      // packet never comes, e.g. because it was dropped on the way, also send
+      // the batch once the current task is done.
+      webrtc::TaskQueueBase* current = webrtc::TaskQueueBase::Current();
+      if (current) {
+        if (!batch_send_scheduled_) {
+          batch_send_scheduled_ = true;
+          current->PostTask(webrtc::SafeTask(task_safety_.flag(), [this] {
+            batch_send_scheduled_ = false;
+            SendBatch();
+          }));
+        }
+        return static_cast<int>(cb);
+      }
+    }
+    const size_t batch_size = batch_size_;
+    // Earlier packets in the batch have already been reported as sent, so only
+    // the outcome for this packet is returned.
+    return SendBatch() == batch_size ? static_cast<int>(cb) : -1;
+  }
+
+  // Send any batched packets first, to keep the packets in order.
+  SendBatch();
   rtc::SentPacket sent_packet(options.packet_id, rtc::TimeMillis(),
                               options.info_signaled_after_sent);
   CopySocketInformationToPacketInfo(cb, *this, true, &sent_packet.info);
@@ -86,6 +118,7 @@ int AsyncUDPSocket::SendTo(const void* pv,
 }
 
 int AsyncUDPSocket::Close() {
+  SendBatch();
   return socket_->Close();
 }
 
@@ -113,6 +146,11 @@ void AsyncUDPSocket::OnReadEvent(Socket* socket) {
   RTC_DCHECK(socket_.get() == socket);
   RTC_DCHECK_RUN_ON(&sequence_checker_);
 
+  if (batched_receive_) {
+    ReceiveBatch();
+    return;
+  }
+
   SocketAddress remote_addr;
   int64_t timestamp = -1;
   int len = socket_->RecvFrom(buf_, BUF_SIZE, &remote_addr, &timestamp);
@@ -127,25 +165,95 @@ void AsyncUDPSocket::OnReadEvent(Socket* socket) {
                      << "] receive failed with error " << socket_->GetError();
     return;
   }
-  if (timestamp == -1) {
-    // Timestamp from socket is not available.
-    timestamp = TimeMicros();
-  } else {
-    if (!socket_time_offset_) {
-      socket_time_offset_ =
-          !IsScmTimeStampExperimentDisabled() ? TimeMicros() - timestamp : 0;
-    }
-    timestamp += *socket_time_offset_;
-  }
 
   // TODO: Make sure that we got all of the packet.
   // If we did not, then we should resize our buffer to be large enough.
   SignalReadPacket(this, buf_, static_cast<size_t>(len), remote_addr,
-                   timestamp);
+                   PacketTimeUs(timestamp));
+}
+
+void AsyncUDPSocket::ReceiveBatch() {
+  RTC_DCHECK_RUN_ON(&sequence_checker_);
+  Socket::ReceivedDatagram datagrams[kReceiveBatchSize];
+  for (size_t i = 0; i < kReceiveBatchSize; ++i) {
+    datagrams[i].buffer = &buf_[i * kReceiveBatchSlotSize];
+    datagrams[i].capacity = kReceiveBatchSlotSize;
+  }
+  int received = socket_->RecvFromBatch(datagrams);
+  if (received < 0) {
+    SocketAddress local_addr = socket_->GetLocalAddress();
+    RTC_LOG(LS_INFO) << "AsyncUDPSocket[" << local_addr.ToSensitiveString()
+                     << "] receive failed with error " << socket_->GetError();
+    return;
+  }
+
+  // A read callback may delete this socket.
+  rtc::scoped_refptr<webrtc::PendingTaskSafetyFlag> alive = task_safety_.flag();
+  for (int i = 0; i < received && alive->alive(); ++i) {
+    const Socket::ReceivedDatagram& datagram = datagrams[i];
+    if (datagram.truncated) {
+      RTC_LOG(LS_WARNING) << "Dropping datagram larger than "
+                          << kReceiveBatchSlotSize << " bytes.";
+      continue;
+    }
+    SignalReadPacket(this, static_cast<const char*>(datagram.buffer),
+                     datagram.size, datagram.addr,
+                     PacketTimeUs(datagram.timestamp));
+  }
+}
+
+int64_t AsyncUDPSocket::PacketTimeUs(int64_t socket_timestamp) {
+  if (socket_timestamp == -1) {
+    // Timestamp from socket is not available.
+    return TimeMicros();
+  }
+  if (!socket_time_offset_) {
+    socket_time_offset_ = !IsScmTimeStampExperimentDisabled()
+                              ? TimeMicros() - socket_timestamp
+                              : 0;
+  }
+  return socket_timestamp + *socket_time_offset_;
 }
 
 void AsyncUDPSocket::OnWriteEvent(Socket* socket) {
   SignalReadyToSend(this);
 }
 
+void AsyncUDPSocket::AddToBatch(const void* pv,
+                                size_t cb,
+                                const SocketAddress& addr,
+                                const rtc::PacketOptions& options) {
+  if (batch_size_ == batch_.size()) {
+    batch_.emplace_back();
+    batch_datagrams_.emplace_back();
+  }
+  BatchedPacket& packet = batch_[batch_size_];
+  packet.data.SetData(static_cast<const uint8_t*>(pv), cb);
+  packet.packet_id = options.packet_id;
+  packet.info = options.info_signaled_after_sent;
+  CopySocketInformationToPacketInfo(cb, *this, true, &packet.info);
+  batch_datagrams_[batch_size_] = {packet.data.data(), cb, addr};
+  ++batch_size_;
+}
+
+size_t AsyncUDPSocket::SendBatch() {
+  if (batch_size_ == 0) {
+    return 0;
+  }
+  const int sent = socket_->SendToBatch(
+      rtc::ArrayView<const Socket::Datagram>(batch_datagrams_.data(),
+                                             batch_size_));
+  const int64_t send_time_ms = rtc::TimeMillis();
+  // Like single packets, batched packets are signaled as sent also when the
+  // socket fails to send them.
+  const size_t batch_size = batch_size_;
+  batch_size_ = 0;
+  for (size_t i = 0; i < batch_size; ++i) {
+    const BatchedPacket& packet = batch_[i];
+    SignalSentPacket(
+        this, rtc::SentPacket(packet.packet_id, send_time_ms, packet.info));
+  }
+  return sent > 0 ? static_cast<size_t>(sent) : 0;
+}
+
 }  // namespace rtc
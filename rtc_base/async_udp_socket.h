@@ -15,10 +15,13 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "absl/types/optional.h"
 #include "api/sequence_checker.h"
+#include "api/task_queue/pending_task_safety_flag.h"
 #include "rtc_base/async_packet_socket.h"
+#include "rtc_base/buffer.h"
 #include "rtc_base/socket.h"
 #include "rtc_base/socket_address.h"
 #include "rtc_base/socket_factory.h"
@@ -28,8 +31,20 @@ namespace rtc {
 
 // Provides the ability to receive packets asynchronously.  Sends are not
 // buffered since it is acceptable to drop packets under high load.
+// Packets flagged as `batchable` are the exception: they are held until the
+// last packet of their batch is sent and then handed to the socket together,
+// see Socket::SendToBatch().
 class AsyncUDPSocket : public AsyncPacketSocket {
  public:
+  // Maximum number of packets held back for a batch. A batch which grows
+  // larger is sent in several parts.
+  static constexpr size_t kMaxBatchSize = 64;
+  // With the "WebRTC-Network-BatchedUdpReceive" field trial, up to
+  // kReceiveBatchSize datagrams are read per read event, each into a slot of
+  // kReceiveBatchSlotSize bytes. Larger datagrams are dropped.
+  static constexpr size_t kReceiveBatchSize = 16;
+  static constexpr size_t kReceiveBatchSlotSize = 4 * 1024;
+
   // Binds `socket` and creates AsyncUDPSocket for it. Takes ownership
   // of `socket`. Returns null if bind() fails (`socket` is destroyed
   // in that case).
@@ -64,12 +79,44 @@ class AsyncUDPSocket : public AsyncPacketSocket {
   void OnReadEvent(Socket* socket);
   // Called when the underlying socket is ready to send.
   void OnWriteEvent(Socket* socket);
+  // Reads the waiting datagrams with one RecvFromBatch() call.
+  void ReceiveBatch();
+  // Returns the receive time to report for a packet with `socket_timestamp`,
+  // which is -1 if the socket did not provide a timestamp.
+  int64_t PacketTimeUs(int64_t socket_timestamp)
+      RTC_RUN_ON(sequence_checker_);
+
+  // Copies a batchable packet into `batch_`.
+  void AddToBatch(const void* pv,
+                  size_t cb,
+                  const SocketAddress& addr,
+                  const rtc::PacketOptions& options);
+  // Sends the packets in `batch_` and signals them as sent. Returns the number
+  // of packets that were sent.
+  size_t SendBatch();
+
+  struct BatchedPacket {
+    rtc::Buffer data;
+    int64_t packet_id;
+    rtc::PacketInfo info;
+  };
 
   RTC_NO_UNIQUE_ADDRESS webrtc::SequenceChecker sequence_checker_;
   std::unique_ptr<Socket> socket_;
   static constexpr int BUF_SIZE = 64 * 1024;
+  static_assert(kReceiveBatchSize * kReceiveBatchSlotSize <= BUF_SIZE,
+                "The receive batch must fit in buf_");
+  const bool batched_receive_;
   char buf_[BUF_SIZE] RTC_GUARDED_BY(sequence_checker_);
   absl::optional<int64_t> socket_time_offset_ RTC_GUARDED_BY(sequence_checker_);
+  // Packets waiting for the end of their batch, and the datagrams pointing at
+  // them. Only the first `batch_size_` entries are in use; the others keep
+  // their buffers for reuse.
+  std::vector<BatchedPacket> batch_;
+  std::vector<Socket::Datagram> batch_datagrams_;
+  size_t batch_size_ = 0;
+  bool batch_send_scheduled_ = false;
+  webrtc::ScopedTaskSafetyDetached task_safety_;
 };
 
 }  // namespace rtc
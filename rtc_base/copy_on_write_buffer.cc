@@ -12,10 +12,37 @@
 
 #include <stddef.h>
 
+#include <new>
+
 #include "absl/strings/string_view.h"
 
 namespace rtc {
 
+// static
+CopyOnWriteBuffer::RefCountedBuffer*
+CopyOnWriteBuffer::RefCountedBuffer::Create(size_t size, size_t capacity) {
+  capacity = std::max(size, capacity);
+  void* storage = ::operator new(sizeof(RefCountedBuffer) + capacity);
+  return new (storage) RefCountedBuffer(size, capacity);
+}
+
+// static
+CopyOnWriteBuffer::RefCountedBuffer*
+CopyOnWriteBuffer::RefCountedBuffer::Create(const void* data,
+                                            size_t size,
+                                            size_t capacity) {
+  RefCountedBuffer* buffer = Create(/*size=*/0, std::max(size, capacity));
+  buffer->AppendData(data, size);
+  return buffer;
+}
+
+void CopyOnWriteBuffer::RefCountedBuffer::Release() const {
+  if (ref_count_.DecRef() == RefCountReleaseStatus::kDroppedLastRef) {
+    this->~RefCountedBuffer();
+    ::operator delete(const_cast<RefCountedBuffer*>(this));
+  }
+}
+
 CopyOnWriteBuffer::CopyOnWriteBuffer() : offset_(0), size_(0) {
   RTC_DCHECK(IsConsistent());
 }
@@ -34,15 +61,16 @@ CopyOnWriteBuffer::CopyOnWriteBuffer(absl::string_view s)
     : CopyOnWriteBuffer(s.data(), s.length()) {}
 
 CopyOnWriteBuffer::CopyOnWriteBuffer(size_t size)
-    : buffer_(size > 0 ? new RefCountedBuffer(size) : nullptr),
+    : buffer_(size > 0 ? RefCountedBuffer::Create(size, size) : nullptr),
       offset_(0),
       size_(size) {
   RTC_DCHECK(IsConsistent());
 }
 
 CopyOnWriteBuffer::CopyOnWriteBuffer(size_t size, size_t capacity)
-    : buffer_(size > 0 || capacity > 0 ? new RefCountedBuffer(size, capacity)
-                                       : nullptr),
+    : buffer_(size > 0 || capacity > 0
+                  ? RefCountedBuffer::Create(size, capacity)
+                  : nullptr),
       offset_(0),
       size_(size) {
   RTC_DCHECK(IsConsistent());
@@ -62,7 +90,7 @@ void CopyOnWriteBuffer::SetSize(size_t size) {
   RTC_DCHECK(IsConsistent());
   if (!buffer_) {
     if (size > 0) {
-      buffer_ = new RefCountedBuffer(size);
+      buffer_ = RefCountedBuffer::Create(size, size);
       offset_ = 0;
       size_ = size;
     }
@@ -85,7 +113,7 @@ void CopyOnWriteBuffer::EnsureCapacity(size_t new_capacity) {
   RTC_DCHECK(IsConsistent());
   if (!buffer_) {
     if (new_capacity > 0) {
-      buffer_ = new RefCountedBuffer(0, new_capacity);
+      buffer_ = RefCountedBuffer::Create(0, new_capacity);
       offset_ = 0;
       size_ = 0;
     }
@@ -104,9 +132,9 @@ void CopyOnWriteBuffer::Clear() {
     return;
 
   if (buffer_->HasOneRef()) {
-    buffer_->Clear();
+    buffer_->SetSize(0);
   } else {
-    buffer_ = new RefCountedBuffer(0, capacity());
+    buffer_ = RefCountedBuffer::Create(0, capacity());
   }
   offset_ = 0;
   size_ = 0;
@@ -118,8 +146,8 @@ void CopyOnWriteBuffer::UnshareAndEnsureCapacity(size_t new_capacity) {
     return;
   }
 
-  buffer_ =
-      new RefCountedBuffer(buffer_->data() + offset_, size_, new_capacity);
+  buffer_ = RefCountedBuffer::Create(buffer_->data() + offset_, size_,
+                                     new_capacity);
   offset_ = 0;
   RTC_DCHECK(IsConsistent());
 }
@@ -14,6 +14,7 @@
 #include <stdint.h>
 
 #include <algorithm>
+#include <cstddef>
 #include <cstring>
 #include <string>
 #include <type_traits>
@@ -23,7 +24,7 @@
 #include "api/scoped_refptr.h"
 #include "rtc_base/buffer.h"
 #include "rtc_base/checks.h"
-#include "rtc_base/ref_counted_object.h"
+#include "rtc_base/ref_counter.h"
 #include "rtc_base/system/rtc_export.h"
 #include "rtc_base/type_traits.h"
 
@@ -183,11 +184,13 @@ class RTC_EXPORT CopyOnWriteBuffer {
   void SetData(const T* data, size_t size) {
     RTC_DCHECK(IsConsistent());
     if (!buffer_) {
-      buffer_ = size > 0 ? new RefCountedBuffer(data, size) : nullptr;
-    } else if (!buffer_->HasOneRef()) {
-      buffer_ = new RefCountedBuffer(data, size, capacity());
+      buffer_ = size > 0 ? RefCountedBuffer::Create(data, size, size) : nullptr;
+    } else if (!buffer_->HasOneRef() || size > buffer_->capacity()) {
+      buffer_ = RefCountedBuffer::Create(data, size,
+                                         std::max(size, buffer_->capacity()));
     } else {
-      buffer_->SetData(data, size);
+      buffer_->SetSize(0);
+      buffer_->AppendData(data, size);
     }
     offset_ = 0;
     size_ = size;
@@ -220,7 +223,7 @@ class RTC_EXPORT CopyOnWriteBuffer {
   void AppendData(const T* data, size_t size) {
     RTC_DCHECK(IsConsistent());
     if (!buffer_) {
-      buffer_ = new RefCountedBuffer(data, size);
+      buffer_ = RefCountedBuffer::Create(data, size, size);
       offset_ = 0;
       size_ = size;
       RTC_DCHECK(IsConsistent());
@@ -287,7 +290,55 @@ class RTC_EXPORT CopyOnWriteBuffer {
   }
 
  private:
-  using RefCountedBuffer = FinalRefCountedObject<Buffer>;
+  // Reference counted storage that is allocated together with its data, so
+  // that creating a buffer takes a single allocation.
+  class alignas(std::max_align_t) RefCountedBuffer {
+   public:
+    static RefCountedBuffer* Create(size_t size, size_t capacity);
+    static RefCountedBuffer* Create(const void* data,
+                                    size_t size,
+                                    size_t capacity);
+
+    RefCountedBuffer(const RefCountedBuffer&) = delete;
+    RefCountedBuffer& operator=(const RefCountedBuffer&) = delete;
+
+    void AddRef() const { ref_count_.IncRef(); }
+    void Release() const;
+    bool HasOneRef() const { return ref_count_.HasOneRef(); }
+
+    template <typename T = uint8_t>
+    T* data() {
+      return reinterpret_cast<T*>(this + 1);
+    }
+    template <typename T = uint8_t>
+    const T* data() const {
+      return reinterpret_cast<const T*>(this + 1);
+    }
+    size_t size() const { return size_; }
+    size_t capacity() const { return capacity_; }
+
+    void SetSize(size_t size) {
+      RTC_DCHECK_LE(size, capacity_);
+      size_ = size;
+    }
+    void AppendData(const void* data, size_t size) {
+      RTC_DCHECK_LE(size, capacity_ - size_);
+      if (size > 0) {
+        std::memcpy(this->data() + size_, data, size);
+      }
+      size_ += size;
+    }
+
+   private:
+    RefCountedBuffer(size_t size, size_t capacity)
+        : size_(size), capacity_(capacity) {}
+    ~RefCountedBuffer() = default;
+
+    mutable webrtc::webrtc_impl::RefCounter ref_count_{0};
+    size_t size_;
+    const size_t capacity_;
+  };
+
   // Create a copy of the underlying data if it is referenced from other Buffer
   // objects or there is not enough capacity.
   void UnshareAndEnsureCapacity(size_t new_capacity);
@@ -174,6 +174,23 @@ TEST(CopyOnWriteBufferTest, SetDataOnSharedKeepsCapacity) {
   EXPECT_EQ(10u, buf2.capacity());
 }
 
+TEST(CopyOnWriteBufferTest, SetDataBeyondCapacityGrowsBuffer) {
+  CopyOnWriteBuffer buf(kTestData, 3, 5);
+  const uint8_t* old_data = buf.cdata();
+
+  buf.SetData(kTestData, 10);
+
+  EXPECT_NE(buf.cdata(), old_data);
+  EXPECT_EQ(buf, CopyOnWriteBuffer(kTestData, 10));
+  EXPECT_EQ(10u, buf.capacity());
+
+  // Within the capacity the data is written in place.
+  const uint8_t* new_data = buf.cdata();
+  buf.SetData(kTestData + 4, 6);
+  EXPECT_EQ(buf.cdata(), new_data);
+  EXPECT_EQ(buf, CopyOnWriteBuffer(kTestData + 4, 6));
+}
+
 TEST(CopyOnWriteBufferTest, TestEnsureCapacity) {
   CopyOnWriteBuffer buf1(kTestData, 3, 10);
   CopyOnWriteBuffer buf2(buf1);
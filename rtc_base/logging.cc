@@ -38,6 +38,7 @@ static const int kMaxLogLineSize = 1024 - 60;
 #include <time.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cstdarg>
 #include <vector>
 
@@ -63,9 +64,14 @@ constexpr LoggingSeverity kDefaultLoggingSeverity = LS_INFO;
 constexpr LoggingSeverity kDefaultLoggingSeverity = LS_NONE;
 #endif
 
-// Note: `g_min_sev` and `g_dbg_sev` can be changed while running.
-LoggingSeverity g_min_sev = kDefaultLoggingSeverity;
-LoggingSeverity g_dbg_sev = kDefaultLoggingSeverity;
+// Note: `g_min_sev` and `g_dbg_sev` can be changed while running. They are
+// operated on with std::memory_order_relaxed, like `streams_empty_`.
+// `g_min_sev` is the lowest severity that any stream or the debug output
+// wants.
+ABSL_CONST_INIT std::atomic<LoggingSeverity> g_min_sev = {
+    kDefaultLoggingSeverity};
+ABSL_CONST_INIT std::atomic<LoggingSeverity> g_dbg_sev = {
+    kDefaultLoggingSeverity};
 
 // Return the filename portion of the string (that following the last slash).
 const char* FilenameFromPath(const char* file) {
@@ -208,10 +214,13 @@ LogMessage::~LogMessage() {
 
   log_line_.set_message(print_stream_.Release());
 
-  if (log_line_.severity() >= g_dbg_sev) {
+  if (log_line_.severity() >= g_dbg_sev.load(std::memory_order_relaxed)) {
     OutputToDebug(log_line_);
   }
 
+  if (streams_empty_.load(std::memory_order_relaxed)) {
+    return;
+  }
   webrtc::MutexLock lock(&GetLoggingLock());
   for (LogSink* entry = streams_; entry != nullptr; entry = entry->next_) {
     if (log_line_.severity() >= entry->min_severity_) {
@@ -231,11 +240,11 @@ rtc::StringBuilder& LogMessage::stream() {
 }
 
 int LogMessage::GetMinLogSeverity() {
-  return g_min_sev;
+  return g_min_sev.load(std::memory_order_relaxed);
 }
 
 LoggingSeverity LogMessage::GetLogToDebug() {
-  return g_dbg_sev;
+  return g_dbg_sev.load(std::memory_order_relaxed);
 }
 int64_t LogMessage::LogStartTime() {
   static const int64_t g_start = SystemTimeMillis();
@@ -256,7 +265,7 @@ void LogMessage::LogTimestamps(bool on) {
 }
 
 void LogMessage::LogToDebug(LoggingSeverity min_sev) {
-  g_dbg_sev = min_sev;
+  g_dbg_sev.store(min_sev, std::memory_order_relaxed);
   webrtc::MutexLock lock(&GetLoggingLock());
   UpdateMinLogSeverity();
 }
@@ -349,11 +358,11 @@ void LogMessage::ConfigureLogging(absl::string_view params) {
 
 void LogMessage::UpdateMinLogSeverity()
     RTC_EXCLUSIVE_LOCKS_REQUIRED(GetLoggingLock()) {
-  LoggingSeverity min_sev = g_dbg_sev;
+  LoggingSeverity min_sev = g_dbg_sev.load(std::memory_order_relaxed);
   for (LogSink* entry = streams_; entry != nullptr; entry = entry->next_) {
     min_sev = std::min(min_sev, entry->min_severity_);
   }
-  g_min_sev = min_sev;
+  g_min_sev.store(min_sev, std::memory_order_relaxed);
 }
 
 void LogMessage::OutputToDebug(const LogLineRef& log_line) {
@@ -441,9 +450,7 @@ void LogMessage::OutputToDebug(const LogLineRef& log_line) {
 
 // static
 bool LogMessage::IsNoop(LoggingSeverity severity) {
-  if (severity >= g_dbg_sev || severity >= g_min_sev)
-    return false;
-  return streams_empty_.load(std::memory_order_relaxed);
+  return severity < g_min_sev.load(std::memory_order_relaxed);
 }
 
 void LogMessage::FinishPrintStream() {
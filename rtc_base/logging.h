@@ -533,10 +533,9 @@ class LogMessage {
   // Parses the provided parameter stream to configure the options above.
   // Useful for configuring logging from the command line.
   static void ConfigureLogging(absl::string_view params);
-  // Checks the current global debug severity and if the `streams_` collection
-  // is empty. If `severity` is smaller than the global severity and if the
-  // `streams_` collection is empty, the LogMessage will be considered a noop
-  // LogMessage.
+  // Returns true if `severity` is smaller than both the global debug severity
+  // and the severities of all the `streams_`, in which case no one would
+  // receive the LogMessage and it is considered a noop LogMessage.
   static bool IsNoop(LoggingSeverity severity);
   // Version of IsNoop that uses fewer instructions at the call site, since the
   // caller doesn't have to pass an argument.
@@ -367,6 +367,28 @@ TEST(LogTest, NoopSeverityDoesNotRunStringFormatting) {
   EXPECT_FALSE(was_called);
 }
 
+TEST(LogTest, SeverityBelowAllStreamsIsNoop) {
+  LoggingSeverity old_debug_severity = LogMessage::GetLogToDebug();
+  LogMessage::LogToDebug(LS_NONE);
+  std::string str;
+  LogSinkImpl stream(&str);
+  LogMessage::AddLogToStream(&stream, LS_WARNING);
+
+  EXPECT_TRUE(LogMessage::IsNoop(LS_INFO));
+  EXPECT_FALSE(LogMessage::IsNoop(LS_WARNING));
+  bool was_called = false;
+  auto cb = [&was_called]() {
+    was_called = true;
+    return "This could be an expensive callback.";
+  };
+  RTC_LOG(LS_INFO) << "This should not be logged: " << cb();
+  EXPECT_FALSE(was_called);
+  EXPECT_TRUE(str.empty());
+
+  LogMessage::RemoveLogToStream(&stream);
+  LogMessage::LogToDebug(old_debug_severity);
+}
+
 struct TestStruct {};
 std::string ToLogString(TestStruct foo) {
   return "bar";
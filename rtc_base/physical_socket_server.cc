@@ -95,6 +95,24 @@ int64_t GetSocketRecvTimestamp(int socket) {
 }
 #endif
 
+#if defined(WEBRTC_POSIX)
+// Returns the SCM_TIMESTAMP of a message received with recvmsg(), or -1 if
+// there is none.
+int64_t GetScmTimestamp(msghdr& msg) {
+  for (cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg;
+       cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+    if (cmsg->cmsg_level != SOL_SOCKET)
+      continue;
+    if (cmsg->cmsg_type == SCM_TIMESTAMP) {
+      timeval* ts = reinterpret_cast<timeval*>(CMSG_DATA(cmsg));
+      return rtc::kNumMicrosecsPerSec * static_cast<int64_t>(ts->tv_sec) +
+             static_cast<int64_t>(ts->tv_usec);
+    }
+  }
+  return -1;
+}
+#endif
+
 #if defined(WEBRTC_WIN)
 typedef char* SockOptArg;
 #endif
@@ -403,6 +421,55 @@ int PhysicalSocket::SendTo(const void* buffer,
   return sent;
 }
 
+#if defined(WEBRTC_LINUX)
+int PhysicalSocket::SendToBatch(rtc::ArrayView<const Datagram> datagrams) {
+  // The message headers are kept on the stack, so larger batches are sent with
+  // one sendmmsg() call per chunk.
+  constexpr size_t kMaxMessagesPerCall = 32;
+  mmsghdr messages[kMaxMessagesPerCall];
+  iovec iovecs[kMaxMessagesPerCall];
+  sockaddr_storage addresses[kMaxMessagesPerCall];
+  size_t sent = 0;
+  while (sent < datagrams.size()) {
+    const size_t count =
+        std::min(kMaxMessagesPerCall, datagrams.size() - sent);
+    for (size_t i = 0; i < count; ++i) {
+      const Datagram& datagram = datagrams[sent + i];
+      iovecs[i].iov_base = const_cast<void*>(datagram.data);
+      iovecs[i].iov_len = datagram.size;
+      memset(&messages[i], 0, sizeof(messages[i]));
+      messages[i].msg_hdr.msg_name = &addresses[i];
+      const size_t address_length =
+          datagram.addr.ToSockAddrStorage(&addresses[i]);
+      messages[i].msg_hdr.msg_namelen = static_cast<socklen_t>(address_length);
+      messages[i].msg_hdr.msg_iov = &iovecs[i];
+      messages[i].msg_hdr.msg_iovlen = 1;
+    }
+    int result = ::sendmmsg(s_, messages, static_cast<unsigned int>(count),
+#if !defined(WEBRTC_ANDROID)
+                            // Suppress SIGPIPE. See above for explanation.
+                            MSG_NOSIGNAL);
+#else
+                            0);
+#endif
+    UpdateLastError();
+    MaybeRemapSendError();
+    if (result < 0 && IsBlockingError(GetError())) {
+      EnableEvents(DE_WRITE);
+    }
+    if (result <= 0) {
+      break;
+    }
+    sent += result;
+    if (static_cast<size_t>(result) < count) {
+      // Stop at the first datagram that could not be sent.
+      break;
+    }
+  }
+  return sent > 0 || datagrams.empty() ? static_cast<int>(sent) : -1;
+}
+#endif  // WEBRTC_LINUX
+
 int PhysicalSocket::Recv(void* buffer, size_t length, int64_t* timestamp) {
   int received =
       DoReadFromSocket(buffer, length, /*out_addr*/ nullptr, timestamp);
@@ -447,6 +514,53 @@ int PhysicalSocket::RecvFrom(void* buffer,
   return received;
 }
 
+#if defined(WEBRTC_LINUX)
+int PhysicalSocket::RecvFromBatch(rtc::ArrayView<ReceivedDatagram> datagrams) {
+  if (!read_scm_timestamp_experiment_) {
+    // Without SO_TIMESTAMP only the receive time of the most recent datagram
+    // is available, so datagrams are received one at a time.
+    return Socket::RecvFromBatch(datagrams);
+  }
+  constexpr size_t kMaxMessagesPerCall = 32;
+  const size_t count = std::min(kMaxMessagesPerCall, datagrams.size());
+  mmsghdr messages[kMaxMessagesPerCall];
+  iovec iovecs[kMaxMessagesPerCall];
+  sockaddr_storage addresses[kMaxMessagesPerCall];
+  alignas(cmsghdr) char
+      controls[kMaxMessagesPerCall][CMSG_SPACE(sizeof(struct timeval))];
+  for (size_t i = 0; i < count; ++i) {
+    iovecs[i].iov_base = datagrams[i].buffer;
+    iovecs[i].iov_len = datagrams[i].capacity;
+    memset(&messages[i], 0, sizeof(messages[i]));
+    messages[i].msg_hdr.msg_name = &addresses[i];
+    messages[i].msg_hdr.msg_namelen = sizeof(addresses[i]);
+    messages[i].msg_hdr.msg_iov = &iovecs[i];
+    messages[i].msg_hdr.msg_iovlen = 1;
+    messages[i].msg_hdr.msg_control = controls[i];
+    messages[i].msg_hdr.msg_controllen = sizeof(controls[i]);
+  }
+  int received = ::recvmmsg(s_, messages, static_cast<unsigned int>(count),
+                            /*flags=*/0, /*timeout=*/nullptr);
+  UpdateLastError();
+  int error = GetError();
+  bool success = (received >= 0) || IsBlockingError(error);
+  if (udp_ || success) {
+    EnableEvents(DE_READ);
+  }
+  if (!success) {
+    RTC_LOG_F(LS_VERBOSE) << "Error = " << error;
+  }
+  for (int i = 0; i < received; ++i) {
+    ReceivedDatagram& datagram = datagrams[i];
+    datagram.size = messages[i].msg_len;
+    datagram.truncated = (messages[i].msg_hdr.msg_flags & MSG_TRUNC) != 0;
+    SocketAddressFromSockAddrStorage(addresses[i], &datagram.addr);
+    datagram.timestamp = GetScmTimestamp(messages[i].msg_hdr);
+  }
+  return received;
+}
+#endif  // WEBRTC_LINUX
+
 int PhysicalSocket::DoReadFromSocket(void* buffer,
                                      size_t length,
                                      SocketAddress* out_addr,
@@ -477,18 +591,7 @@ int PhysicalSocket::DoReadFromSocket(void* buffer,
       return received;
     }
     if (timestamp) {
-      struct cmsghdr* cmsg;
-      for (cmsg = CMSG_FIRSTHDR(&msg); cmsg; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
-        if (cmsg->cmsg_level != SOL_SOCKET)
-          continue;
-        if (cmsg->cmsg_type == SCM_TIMESTAMP) {
-          timeval* ts = reinterpret_cast<timeval*>(CMSG_DATA(cmsg));
-          *timestamp =
-              rtc::kNumMicrosecsPerSec * static_cast<int64_t>(ts->tv_sec) +
-              static_cast<int64_t>(ts->tv_usec);
-          break;
-        }
-      }
+      *timestamp = GetScmTimestamp(msg);
     }
     if (out_addr) {
       SocketAddressFromSockAddrStorage(addr_storage, out_addr);
@@ -1466,9 +1569,10 @@ bool PhysicalSocketServer::WaitSelect(int cmsWait, bool process_io) {
       // select; this avoids the ABA problem (a socket being destroyed and a new
       // one created with the same file descriptor).
       for (uint64_t key : current_dispatcher_keys_) {
-        if (!dispatcher_by_key_.count(key))
+        auto it = dispatcher_by_key_.find(key);
+        if (it == dispatcher_by_key_.end())
           continue;
-        Dispatcher* pdispatcher = dispatcher_by_key_.at(key);
+        Dispatcher* pdispatcher = it->second;
 
         int fd = pdispatcher->GetDescriptor();
 
@@ -1614,11 +1718,12 @@ bool PhysicalSocketServer::WaitEpoll(int cmsWait) {
       for (int i = 0; i < n; ++i) {
         const epoll_event& event = epoll_events_[i];
         uint64_t key = event.data.u64;
-        if (!dispatcher_by_key_.count(key)) {
+        auto it = dispatcher_by_key_.find(key);
+        if (it == dispatcher_by_key_.end()) {
           // The dispatcher for this socket no longer exists.
           continue;
         }
-        Dispatcher* pdispatcher = dispatcher_by_key_.at(key);
+        Dispatcher* pdispatcher = it->second;
 
         bool readable = (event.events & (EPOLLIN | EPOLLPRI));
         bool writable = (event.events & EPOLLOUT);
@@ -1747,9 +1852,10 @@ bool PhysicalSocketServer::WaitPoll(int cmsWait, bool process_io) {
       // one created with the same file descriptor).
       for (size_t i = 0; i < current_dispatcher_keys_.size(); ++i) {
         uint64_t key = current_dispatcher_keys_[i];
-        if (!dispatcher_by_key_.count(key))
+        auto it = dispatcher_by_key_.find(key);
+        if (it == dispatcher_by_key_.end())
           continue;
-        ProcessPollEvents(dispatcher_by_key_.at(key), pollfds[i]);
+        ProcessPollEvents(it->second, pollfds[i]);
       }
     }
 
@@ -1799,10 +1905,11 @@ bool PhysicalSocketServer::Wait(webrtc::TimeDelta max_wait_duration,
         current_dispatcher_keys_.push_back(kv.first);
       }
       for (uint64_t key : current_dispatcher_keys_) {
-        if (!dispatcher_by_key_.count(key)) {
+        auto it = dispatcher_by_key_.find(key);
+        if (it == dispatcher_by_key_.end()) {
           continue;
         }
-        Dispatcher* disp = dispatcher_by_key_.at(key);
+        Dispatcher* disp = it->second;
         if (!disp)
           continue;
         if (!process_io && (disp != signal_wakeup_))
@@ -1850,21 +1957,23 @@ bool PhysicalSocketServer::Wait(webrtc::TimeDelta max_wait_duration,
       if (index > 0) {
         --index;  // The first event is the socket event
         uint64_t key = event_owners[index];
-        if (!dispatcher_by_key_.count(key)) {
+        auto it = dispatcher_by_key_.find(key);
+        if (it == dispatcher_by_key_.end()) {
           // The dispatcher could have been removed while waiting for events.
           continue;
         }
-        Dispatcher* disp = dispatcher_by_key_.at(key);
+        Dispatcher* disp = it->second;
         disp->OnEvent(0, 0);
       } else if (process_io) {
         // Iterate only on the dispatchers whose sockets were passed into
         // WSAEventSelect; this avoids the ABA problem (a socket being
         // destroyed and a new one created with the same SOCKET handle).
         for (uint64_t key : current_dispatcher_keys_) {
-          if (!dispatcher_by_key_.count(key)) {
+          auto it = dispatcher_by_key_.find(key);
+          if (it == dispatcher_by_key_.end()) {
             continue;
           }
-          Dispatcher* disp = dispatcher_by_key_.at(key);
+          Dispatcher* disp = it->second;
           SOCKET s = disp->GetSocket();
           if (s == INVALID_SOCKET)
             continue;
@@ -180,12 +180,20 @@ class PhysicalSocket : public Socket, public sigslot::has_slots<> {
   int SendTo(const void* buffer,
              size_t length,
              const SocketAddress& addr) override;
+#if defined(WEBRTC_LINUX)
+  // Sends the whole batch with sendmmsg().
+  int SendToBatch(rtc::ArrayView<const Datagram> datagrams) override;
+#endif
 
   int Recv(void* buffer, size_t length, int64_t* timestamp) override;
   int RecvFrom(void* buffer,
                size_t length,
                SocketAddress* out_addr,
                int64_t* timestamp) override;
+#if defined(WEBRTC_LINUX)
+  // Receives the waiting datagrams with recvmmsg().
+  int RecvFromBatch(rtc::ArrayView<ReceivedDatagram> datagrams) override;
+#endif
 
   int Listen(int backlog) override;
   Socket* Accept(SocketAddress* out_addr) override;
@@ -421,6 +421,24 @@ TEST_F(PhysicalSocketTest, TestUdpIPv6) {
   SocketTest::TestUdpIPv6();
 }
 
+TEST_F(PhysicalSocketTest, TestUdpSendToBatchIPv4) {
+  MAYBE_SKIP_IPV4;
+  SocketTest::TestUdpSendToBatchIPv4();
+}
+
+TEST_F(PhysicalSocketTest, TestUdpSendToBatchIPv6) {
+  SocketTest::TestUdpSendToBatchIPv6();
+}
+
+TEST_F(PhysicalSocketTest, TestUdpRecvFromBatchIPv4) {
+  MAYBE_SKIP_IPV4;
+  SocketTest::TestUdpRecvFromBatchIPv4();
+}
+
+TEST_F(PhysicalSocketTest, TestUdpRecvFromBatchIPv6) {
+  SocketTest::TestUdpRecvFromBatchIPv6();
+}
+
 // Disable for TSan v2, see
 // https://code.google.com/p/webrtc/issues/detail?id=3498 for details.
 // Also disable for MSan, see:
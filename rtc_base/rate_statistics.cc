@@ -20,9 +20,6 @@
 
 namespace webrtc {
 
-RateStatistics::Bucket::Bucket(int64_t timestamp)
-    : sum(0), num_samples(0), timestamp(timestamp) {}
-
 RateStatistics::RateStatistics(int64_t window_size_ms, float scale)
     : accumulated_count_(0),
       first_timestamp_(-1),
@@ -33,6 +30,8 @@ RateStatistics::RateStatistics(int64_t window_size_ms, float scale)
 
 RateStatistics::RateStatistics(const RateStatistics& other)
     : buckets_(other.buckets_),
+      first_bucket_(other.first_bucket_),
+      num_buckets_(other.num_buckets_),
       accumulated_count_(other.accumulated_count_),
       first_timestamp_(other.first_timestamp_),
       overflow_(other.overflow_),
@@ -51,7 +50,8 @@ void RateStatistics::Reset() {
   num_samples_ = 0;
   first_timestamp_ = -1;
   current_window_size_ms_ = max_window_size_ms_;
-  buckets_.clear();
+  first_bucket_ = 0;
+  num_buckets_ = 0;
 }
 
 void RateStatistics::Update(int64_t count, int64_t now_ms) {
@@ -62,17 +62,18 @@ void RateStatistics::Update(int64_t count, int64_t now_ms) {
     first_timestamp_ = now_ms;
   }
 
-  if (buckets_.empty() || now_ms != buckets_.back().timestamp) {
-    if (!buckets_.empty() && now_ms < buckets_.back().timestamp) {
+  if (num_buckets_ == 0 || now_ms != newest_bucket().timestamp) {
+    if (num_buckets_ != 0 && now_ms < newest_bucket().timestamp) {
       RTC_LOG(LS_WARNING) << "Timestamp " << now_ms
                           << " is before the last added "
                              "timestamp in the rate window: "
-                          << buckets_.back().timestamp << ", aligning to that.";
-      now_ms = buckets_.back().timestamp;
+                          << newest_bucket().timestamp
+                          << ", aligning to that.";
+    } else {
+      AddBucket(now_ms);
     }
-    buckets_.emplace_back(now_ms);
   }
-  Bucket& last_bucket = buckets_.back();
+  Bucket& last_bucket = newest_bucket();
   last_bucket.sum += count;
   ++last_bucket.num_samples;
 
@@ -127,18 +128,37 @@ void RateStatistics::EraseOld(int64_t now_ms) {
   const int64_t new_oldest_time = now_ms - current_window_size_ms_ + 1;
 
   // Loop over buckets and remove too old data points.
-  while (!buckets_.empty() && buckets_.front().timestamp < new_oldest_time) {
-    const Bucket& oldest_bucket = buckets_.front();
-    RTC_DCHECK_GE(accumulated_count_, oldest_bucket.sum);
-    RTC_DCHECK_GE(num_samples_, oldest_bucket.num_samples);
-    accumulated_count_ -= oldest_bucket.sum;
-    num_samples_ -= oldest_bucket.num_samples;
-    buckets_.pop_front();
+  while (num_buckets_ != 0 && oldest_bucket().timestamp < new_oldest_time) {
+    RTC_DCHECK_GE(accumulated_count_, oldest_bucket().sum);
+    RTC_DCHECK_GE(num_samples_, oldest_bucket().num_samples);
+    accumulated_count_ -= oldest_bucket().sum;
+    num_samples_ -= oldest_bucket().num_samples;
+    first_bucket_ = (first_bucket_ + 1) % buckets_.size();
+    --num_buckets_;
     // This does not clear overflow_ even when counter is empty.
     // TODO(https://bugs.webrtc.org/11247): Consider if overflow_ can be reset.
   }
 }
 
+void RateStatistics::AddBucket(int64_t timestamp) {
+  if (num_buckets_ == buckets_.size()) {
+    // The buckets have distinct timestamps within the window, so there are
+    // never more of them than ms in the maximum window size.
+    constexpr size_t kMinNumBuckets = 8;
+    const size_t max_num_buckets = std::max<size_t>(
+        rtc::saturated_cast<size_t>(max_window_size_ms_), num_buckets_ + 1);
+    std::vector<Bucket> buckets(std::min(
+        std::max(kMinNumBuckets, 2 * buckets_.size()), max_num_buckets));
+    for (size_t i = 0; i < num_buckets_; ++i) {
+      buckets[i] = buckets_[(first_bucket_ + i) % buckets_.size()];
+    }
+    buckets_ = std::move(buckets);
+    first_bucket_ = 0;
+  }
+  ++num_buckets_;
+  newest_bucket() = Bucket{0, 0, timestamp};
+}
+
 bool RateStatistics::SetWindowSize(int64_t window_size_ms, int64_t now_ms) {
   if (window_size_ms <= 0 || window_size_ms > max_window_size_ms_)
     return false;
@@ -14,8 +14,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
-#include <deque>
 #include <memory>
+#include <vector>
 
 #include "absl/types/optional.h"
 #include "rtc_base/system/rtc_export.h"
@@ -72,13 +72,23 @@ class RTC_EXPORT RateStatistics {
   void EraseOld(int64_t now_ms);
 
   struct Bucket {
-    explicit Bucket(int64_t timestamp);
-    int64_t sum;              // Sum of all samples in this bucket.
-    int num_samples;          // Number of samples in this bucket.
-    const int64_t timestamp;  // Timestamp this bucket corresponds to.
+    int64_t sum;        // Sum of all samples in this bucket.
+    int num_samples;    // Number of samples in this bucket.
+    int64_t timestamp;  // Timestamp this bucket corresponds to.
   };
-  // All buckets within the time window, ordered by time.
-  std::deque<Bucket> buckets_;
+  const Bucket& oldest_bucket() const { return buckets_[first_bucket_]; }
+  Bucket& newest_bucket() {
+    return buckets_[(first_bucket_ + num_buckets_ - 1) % buckets_.size()];
+  }
+  void AddBucket(int64_t timestamp);
+
+  // All buckets within the time window, ordered by time, stored as a circular
+  // buffer of `num_buckets_` elements starting at `first_bucket_`. It grows on
+  // demand, up to one bucket per ms of the maximum window size, and is never
+  // shrunk, so that the steady state does not allocate.
+  std::vector<Bucket> buckets_;
+  size_t first_bucket_ = 0;
+  size_t num_buckets_ = 0;
 
   // Total count recorded in all buckets.
   int64_t accumulated_count_;
@@ -315,4 +315,24 @@ TEST_F(RateStatisticsTest, HandlesSomewhatLargeNumbers) {
   EXPECT_FALSE(stats_.Rate(now_ms));
 }
 
+TEST_F(RateStatisticsTest, HandlesDenseUpdatesAcrossManyWindows) {
+  // One update per ms fills as many buckets as the window is long, which
+  // are then reused while moving the window along.
+  const int64_t kPacketSize = 100;
+  int64_t now_ms = 0;
+  for (int i = 0; i < 10 * kWindowMs; ++i) {
+    stats_.Update(kPacketSize, now_ms++);
+  }
+  RateStatistics copy = stats_;
+  EXPECT_EQ(kPacketSize * 8000, stats_.Rate(now_ms - 1));
+  EXPECT_EQ(kPacketSize * 8000, copy.Rate(now_ms - 1));
+
+  // Skipping ms halves the rate, with all the remaining buckets in use.
+  for (int i = 0; i < 2 * kWindowMs; ++i) {
+    stats_.Update(kPacketSize, now_ms);
+    now_ms += 2;
+  }
+  EXPECT_EQ(kPacketSize * 4000, stats_.Rate(now_ms - 1));
+}
+
 }  // namespace
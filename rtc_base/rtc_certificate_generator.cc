@@ -16,8 +16,10 @@
 #include <memory>
 #include <utility>
 
+#include "api/sequence_checker.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/ssl_identity.h"
+#include "rtc_base/time_utils.h"
 
 namespace rtc {
 
@@ -27,8 +29,101 @@ namespace {
 const char kIdentityName[] = "WebRTC";
 const uint64_t kYearInSeconds = 365 * 24 * 60 * 60;
 
+bool SameKeyParams(const KeyParams& a, const KeyParams& b) {
+  if (a.type() != b.type()) {
+    return false;
+  }
+  switch (a.type()) {
+    case KT_RSA:
+      return a.rsa_params().mod_size == b.rsa_params().mod_size &&
+             a.rsa_params().pub_exp == b.rsa_params().pub_exp;
+    case KT_ECDSA:
+      return a.ec_curve() == b.ec_curve();
+    default:
+      return false;
+  }
+}
+
 }  // namespace
 
+// static
+scoped_refptr<RTCCertificatePool> RTCCertificatePool::Create(
+    const KeyParams& key_params,
+    size_t size,
+    Thread* worker_thread) {
+  // Explicit new, to access private constructor.
+  scoped_refptr<RTCCertificatePool> pool(
+      new RTCCertificatePool(key_params, size, worker_thread));
+  webrtc::MutexLock lock(&pool->mutex_);
+  pool->MaybeRefill();
+  return pool;
+}
+
+RTCCertificatePool::RTCCertificatePool(const KeyParams& key_params,
+                                       size_t size,
+                                       Thread* worker_thread)
+    : key_params_(key_params), max_size_(size), worker_thread_(worker_thread) {
+  RTC_DCHECK(key_params_.IsValid());
+  RTC_DCHECK(worker_thread_);
+}
+
+scoped_refptr<RTCCertificate> RTCCertificatePool::Take(
+    const KeyParams& key_params) {
+  if (!SameKeyParams(key_params, key_params_)) {
+    return nullptr;
+  }
+  webrtc::MutexLock lock(&mutex_);
+  scoped_refptr<RTCCertificate> certificate;
+  // Certificates may expire while waiting in an idle pool.
+  uint64_t now = TimeUTCMillis();
+  while (!certificate && !certificates_.empty()) {
+    if (!certificates_.back()->HasExpired(now)) {
+      certificate = std::move(certificates_.back());
+    }
+    certificates_.pop_back();
+  }
+  MaybeRefill();
+  return certificate;
+}
+
+size_t RTCCertificatePool::size() const {
+  webrtc::MutexLock lock(&mutex_);
+  return certificates_.size();
+}
+
+void RTCCertificatePool::MaybeRefill() {
+  if (refilling_ || certificates_.size() >= max_size_) {
+    return;
+  }
+  refilling_ = true;
+  worker_thread_->PostTask(
+      [pool = scoped_refptr<RTCCertificatePool>(this)] { pool->Refill(); });
+}
+
+void RTCCertificatePool::Refill() {
+  RTC_DCHECK_RUN_ON(worker_thread_);
+  while (true) {
+    {
+      webrtc::MutexLock lock(&mutex_);
+      if (certificates_.size() >= max_size_) {
+        refilling_ = false;
+        return;
+      }
+    }
+    // Generate without holding the lock, so that the pool can be drained
+    // meanwhile.
+    scoped_refptr<RTCCertificate> certificate =
+        RTCCertificateGenerator::GenerateCertificate(key_params_,
+                                                     absl::nullopt);
+    webrtc::MutexLock lock(&mutex_);
+    if (!certificate) {
+      refilling_ = false;
+      return;
+    }
+    certificates_.push_back(std::move(certificate));
+  }
+}
+
 // static
 scoped_refptr<RTCCertificate> RTCCertificateGenerator::GenerateCertificate(
     const KeyParams& key_params,
@@ -61,7 +156,15 @@ scoped_refptr<RTCCertificate> RTCCertificateGenerator::GenerateCertificate(
 
 RTCCertificateGenerator::RTCCertificateGenerator(Thread* signaling_thread,
                                                  Thread* worker_thread)
-    : signaling_thread_(signaling_thread), worker_thread_(worker_thread) {
+    : RTCCertificateGenerator(signaling_thread, worker_thread, nullptr) {}
+
+RTCCertificateGenerator::RTCCertificateGenerator(
+    Thread* signaling_thread,
+    Thread* worker_thread,
+    scoped_refptr<RTCCertificatePool> pool)
+    : signaling_thread_(signaling_thread),
+      worker_thread_(worker_thread),
+      pool_(std::move(pool)) {
   RTC_DCHECK(signaling_thread_);
   RTC_DCHECK(worker_thread_);
 }
@@ -73,6 +176,18 @@ void RTCCertificateGenerator::GenerateCertificateAsync(
   RTC_DCHECK(signaling_thread_->IsCurrent());
   RTC_DCHECK(callback);
 
+  if (pool_ && !expires_ms) {
+    scoped_refptr<RTCCertificate> certificate = pool_->Take(key_params);
+    if (certificate) {
+      // Still complete asynchronously, as callers expect.
+      signaling_thread_->PostTask(
+          [cert = std::move(certificate), cb = std::move(callback)]() mutable {
+            std::move(cb)(std::move(cert));
+          });
+      return;
+    }
+  }
+
   worker_thread_->PostTask([key_params, expires_ms,
                             signaling_thread = signaling_thread_,
                             cb = std::move(callback)]() mutable {
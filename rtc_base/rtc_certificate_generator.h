@@ -13,13 +13,18 @@
 
 #include <stdint.h>
 
+#include <vector>
+
 #include "absl/functional/any_invocable.h"
 #include "absl/types/optional.h"
 #include "api/scoped_refptr.h"
 #include "rtc_base/rtc_certificate.h"
+#include "rtc_base/ref_counted_object.h"
 #include "rtc_base/ssl_identity.h"
+#include "rtc_base/synchronization/mutex.h"
 #include "rtc_base/system/rtc_export.h"
 #include "rtc_base/thread.h"
+#include "rtc_base/thread_annotations.h"
 
 namespace rtc {
 
@@ -44,6 +49,49 @@ class RTCCertificateGeneratorInterface {
       Callback callback) = 0;
 };
 
+// A pool of certificates generated ahead of time, which takes the cost of key
+// generation out of call setup. It can be shared by the generators of all
+// PeerConnections in a process. Each certificate is handed out only once, so
+// PeerConnections still never share a certificate. Taking a certificate
+// triggers a refill in the background on `worker_thread`. Thread safe.
+class RTC_EXPORT RTCCertificatePool final
+    : public RefCountedNonVirtual<RTCCertificatePool> {
+ public:
+  // Creates a pool holding up to `size` certificates with default expiration
+  // of type `key_params`, and starts filling it.
+  static scoped_refptr<RTCCertificatePool> Create(const KeyParams& key_params,
+                                                  size_t size,
+                                                  Thread* worker_thread);
+
+  RTCCertificatePool(const RTCCertificatePool&) = delete;
+  RTCCertificatePool& operator=(const RTCCertificatePool&) = delete;
+
+  // Returns a pooled certificate if `key_params` match those of the pool, or
+  // null if they don't or if the pool is empty.
+  scoped_refptr<RTCCertificate> Take(const KeyParams& key_params);
+
+  // The number of certificates currently in the pool.
+  size_t size() const;
+
+ private:
+  friend class RefCountedNonVirtual<RTCCertificatePool>;
+  RTCCertificatePool(const KeyParams& key_params,
+                     size_t size,
+                     Thread* worker_thread);
+  ~RTCCertificatePool() = default;
+
+  void MaybeRefill() RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+  void Refill();
+
+  const KeyParams key_params_;
+  const size_t max_size_;
+  Thread* const worker_thread_;
+  mutable webrtc::Mutex mutex_;
+  std::vector<scoped_refptr<RTCCertificate>> certificates_
+      RTC_GUARDED_BY(mutex_);
+  bool refilling_ RTC_GUARDED_BY(mutex_) = false;
+};
+
 // Standard implementation of `RTCCertificateGeneratorInterface`.
 // The static function `GenerateCertificate` generates a certificate on the
 // current thread. The `RTCCertificateGenerator` instance generates certificates
@@ -61,6 +109,11 @@ class RTC_EXPORT RTCCertificateGenerator
       const absl::optional<uint64_t>& expires_ms);
 
   RTCCertificateGenerator(Thread* signaling_thread, Thread* worker_thread);
+  // Takes certificates with default expiration from `pool` when it has any
+  // matching the requested key parameters.
+  RTCCertificateGenerator(Thread* signaling_thread,
+                          Thread* worker_thread,
+                          scoped_refptr<RTCCertificatePool> pool);
   ~RTCCertificateGenerator() override {}
 
   // `RTCCertificateGeneratorInterface` overrides.
@@ -75,6 +128,7 @@ class RTC_EXPORT RTCCertificateGenerator
  private:
   Thread* const signaling_thread_;
   Thread* const worker_thread_;
+  const scoped_refptr<RTCCertificatePool> pool_;
 };
 
 }  // namespace rtc
@@ -16,6 +16,7 @@
 #include "api/make_ref_counted.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/gunit.h"
+#include "rtc_base/ssl_certificate.h"
 #include "rtc_base/thread.h"
 #include "test/gtest.h"
 
@@ -34,6 +35,7 @@ class RTCCertificateGeneratorFixture {
   }
 
   RTCCertificateGenerator* generator() const { return generator_.get(); }
+  Thread* worker_thread() const { return worker_thread_.get(); }
   RTCCertificate* certificate() const { return certificate_.get(); }
 
   RTCCertificateGeneratorInterface::Callback OnGenerated() {
@@ -134,4 +136,48 @@ TEST_F(RTCCertificateGeneratorTest, GenerateWithInvalidParamsShouldFail) {
   EXPECT_FALSE(fixture_.certificate());
 }
 
+TEST_F(RTCCertificateGeneratorTest, PoolHandsOutEachCertificateOnce) {
+  scoped_refptr<RTCCertificatePool> pool = RTCCertificatePool::Create(
+      KeyParams::ECDSA(), 2, fixture_.worker_thread());
+  EXPECT_EQ_WAIT(pool->size(), 2u, kGenerationTimeoutMs);
+
+  // Pooled certificates are not handed out for other key parameters.
+  EXPECT_FALSE(pool->Take(KeyParams::RSA()));
+
+  scoped_refptr<RTCCertificate> cert_a = pool->Take(KeyParams::ECDSA());
+  scoped_refptr<RTCCertificate> cert_b = pool->Take(KeyParams::ECDSA());
+  ASSERT_TRUE(cert_a);
+  ASSERT_TRUE(cert_b);
+  EXPECT_NE(cert_a->GetSSLCertificate().ToPEMString(),
+            cert_b->GetSSLCertificate().ToPEMString());
+
+  // The pool refills in the background.
+  EXPECT_EQ_WAIT(pool->size(), 2u, kGenerationTimeoutMs);
+}
+
+TEST_F(RTCCertificateGeneratorTest, GenerateAsyncFromPool) {
+  scoped_refptr<RTCCertificatePool> pool = RTCCertificatePool::Create(
+      KeyParams::ECDSA(), 1, fixture_.worker_thread());
+  EXPECT_EQ_WAIT(pool->size(), 1u, kGenerationTimeoutMs);
+  RTCCertificateGenerator generator(Thread::Current(), fixture_.worker_thread(),
+                                    pool);
+
+  generator.GenerateCertificateAsync(KeyParams::ECDSA(), absl::nullopt,
+                                     fixture_.OnGenerated());
+  // The pooled certificate is taken right away, but still delivered
+  // asynchronously.
+  EXPECT_EQ(pool->size(), 0u);
+  EXPECT_FALSE(fixture_.GenerateAsyncCompleted());
+  EXPECT_TRUE_WAIT(fixture_.GenerateAsyncCompleted(), kGenerationTimeoutMs);
+  EXPECT_TRUE(fixture_.certificate());
+
+  // Requests with an explicit expiration bypass the pool.
+  EXPECT_EQ_WAIT(pool->size(), 1u, kGenerationTimeoutMs);
+  generator.GenerateCertificateAsync(KeyParams::ECDSA(), 60000,
+                                     fixture_.OnGenerated());
+  EXPECT_EQ(pool->size(), 1u);
+  EXPECT_TRUE_WAIT(fixture_.GenerateAsyncCompleted(), kGenerationTimeoutMs);
+  EXPECT_TRUE(fixture_.certificate());
+}
+
 }  // namespace rtc
@@ -10,4 +10,32 @@
 
 #include "rtc_base/socket.h"
 
-namespace rtc {}  // namespace rtc
+namespace rtc {
+
+int Socket::SendToBatch(rtc::ArrayView<const Datagram> datagrams) {
+  int sent = 0;
+  for (const Datagram& datagram : datagrams) {
+    if (SendTo(datagram.data, datagram.size, datagram.addr) < 0) {
+      break;
+    }
+    ++sent;
+  }
+  return sent > 0 || datagrams.empty() ? sent : -1;
+}
+
+int Socket::RecvFromBatch(rtc::ArrayView<ReceivedDatagram> datagrams) {
+  if (datagrams.empty()) {
+    return 0;
+  }
+  ReceivedDatagram& datagram = datagrams[0];
+  int received = RecvFrom(datagram.buffer, datagram.capacity, &datagram.addr,
+                          &datagram.timestamp);
+  if (received < 0) {
+    return -1;
+  }
+  datagram.size = static_cast<size_t>(received);
+  datagram.truncated = false;
+  return 1;
+}
+
+}  // namespace rtc
@@ -25,6 +25,7 @@
 #include "rtc_base/win32.h"
 #endif
 
+#include "api/array_view.h"
 #include "rtc_base/socket_address.h"
 #include "rtc_base/third_party/sigslot/sigslot.h"
 
@@ -97,12 +98,43 @@ class Socket {
   virtual int Connect(const SocketAddress& addr) = 0;
   virtual int Send(const void* pv, size_t cb) = 0;
   virtual int SendTo(const void* pv, size_t cb, const SocketAddress& addr) = 0;
+
+  // A datagram to be sent by SendToBatch().
+  struct Datagram {
+    const void* data;
+    size_t size;
+    SocketAddress addr;
+  };
+  // Sends `datagrams` in order, with as few system calls as the platform
+  // allows. Returns the number of datagrams that were sent, or -1 if none
+  // could be sent. Sending stops at the first datagram that fails, in which
+  // case GetError() tells why. The default implementation calls SendTo() once
+  // per datagram.
+  virtual int SendToBatch(rtc::ArrayView<const Datagram> datagrams);
   // `timestamp` is in units of microseconds.
   virtual int Recv(void* pv, size_t cb, int64_t* timestamp) = 0;
   virtual int RecvFrom(void* pv,
                        size_t cb,
                        SocketAddress* paddr,
                        int64_t* timestamp) = 0;
+
+  // A datagram received by RecvFromBatch() into `buffer`, which can hold
+  // `capacity` bytes.
+  struct ReceivedDatagram {
+    void* buffer;
+    size_t capacity;
+    size_t size = 0;
+    SocketAddress addr;
+    // In units of microseconds, -1 if not available.
+    int64_t timestamp = -1;
+    // True if the datagram was larger than `capacity` and has been cut short.
+    bool truncated = false;
+  };
+  // Receives up to `datagrams.size()` of the datagrams that are waiting on the
+  // socket, with as few system calls as the platform allows. Returns the
+  // number of datagrams received, or -1 on error, see GetError(). The default
+  // implementation receives one datagram with RecvFrom().
+  virtual int RecvFromBatch(rtc::ArrayView<ReceivedDatagram> datagrams);
   virtual int Listen(int backlog) = 0;
   virtual Socket* Accept(SocketAddress* paddr) = 0;
   virtual int Close() = 0;
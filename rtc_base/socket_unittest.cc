@@ -17,6 +17,8 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "absl/memory/memory.h"
 #include "absl/strings/string_view.h"
@@ -191,6 +193,24 @@ void SocketTest::TestUdpIPv6() {
   UdpInternal(kIPv6Loopback);
 }
 
+void SocketTest::TestUdpSendToBatchIPv4() {
+  UdpSendToBatch(kIPv4Loopback);
+}
+
+void SocketTest::TestUdpSendToBatchIPv6() {
+  MAYBE_SKIP_IPV6;
+  UdpSendToBatch(kIPv6Loopback);
+}
+
+void SocketTest::TestUdpRecvFromBatchIPv4() {
+  UdpRecvFromBatch(kIPv4Loopback);
+}
+
+void SocketTest::TestUdpRecvFromBatchIPv6() {
+  MAYBE_SKIP_IPV6;
+  UdpRecvFromBatch(kIPv6Loopback);
+}
+
 void SocketTest::TestUdpReadyToSendIPv4() {
 #if !defined(WEBRTC_MAC)
   // TODO(ronghuawu): Enable this test on mac/ios.
@@ -992,6 +1012,63 @@ void SocketTest::UdpInternal(const IPAddress& loopback) {
   }
 }
 
+void SocketTest::UdpSendToBatch(const IPAddress& loopback) {
+  auto receiver = std::make_unique<TestClient>(absl::WrapUnique(
+      AsyncUDPSocket::Create(socket_factory_, SocketAddress(loopback, 0))));
+  std::unique_ptr<Socket> sender(
+      socket_factory_->CreateSocket(loopback.family(), SOCK_DGRAM));
+  ASSERT_EQ(0, sender->Bind(SocketAddress(loopback, 0)));
+
+  const SocketAddress address = receiver->address();
+  const Socket::Datagram datagrams[] = {
+      {"foo", 3, address}, {"bizbaz", 6, address}, {"qux", 3, address}};
+  EXPECT_EQ(3, sender->SendToBatch(datagrams));
+  SocketAddress sender_address;
+  EXPECT_TRUE(receiver->CheckNextPacket("foo", 3, &sender_address));
+  EXPECT_EQ(sender_address, sender->GetLocalAddress());
+  EXPECT_TRUE(receiver->CheckNextPacket("bizbaz", 6, nullptr));
+  EXPECT_TRUE(receiver->CheckNextPacket("qux", 3, nullptr));
+}
+
+void SocketTest::UdpRecvFromBatch(const IPAddress& loopback) {
+  std::unique_ptr<Socket> receiver(
+      socket_factory_->CreateSocket(loopback.family(), SOCK_DGRAM));
+  ASSERT_EQ(0, receiver->Bind(SocketAddress(loopback, 0)));
+  std::unique_ptr<Socket> sender(
+      socket_factory_->CreateSocket(loopback.family(), SOCK_DGRAM));
+  ASSERT_EQ(0, sender->Bind(SocketAddress(loopback, 0)));
+
+  const std::string kPayloads[] = {"foo", "bizbaz", "qux"};
+  for (const std::string& payload : kPayloads) {
+    EXPECT_EQ(static_cast<int>(payload.size()),
+              sender->SendTo(payload.data(), payload.size(),
+                             receiver->GetLocalAddress()));
+  }
+
+  char buffers[arraysize(kPayloads)][16];
+  std::vector<std::string> received;
+  auto receive = [&] {
+    Socket::ReceivedDatagram datagrams[arraysize(kPayloads)];
+    const size_t num_datagrams = arraysize(kPayloads) - received.size();
+    for (size_t i = 0; i < num_datagrams; ++i) {
+      datagrams[i].buffer = buffers[i];
+      datagrams[i].capacity = sizeof(buffers[i]);
+    }
+    int count = receiver->RecvFromBatch(
+        rtc::ArrayView<Socket::ReceivedDatagram>(datagrams, num_datagrams));
+    for (int i = 0; i < count; ++i) {
+      EXPECT_FALSE(datagrams[i].truncated);
+      EXPECT_EQ(datagrams[i].addr, sender->GetLocalAddress());
+      received.emplace_back(static_cast<const char*>(datagrams[i].buffer),
+                            datagrams[i].size);
+    }
+    return received.size() == arraysize(kPayloads);
+  };
+  EXPECT_TRUE_WAIT(receive(), kTimeout);
+  EXPECT_EQ(received, std::vector<std::string>(std::begin(kPayloads),
+                                               std::end(kPayloads)));
+}
+
 void SocketTest::UdpReadyToSend(const IPAddress& loopback) {
   SocketAddress empty = EmptySocketAddressWithFamily(loopback.family());
   // RFC 5737 - The blocks 192.0.2.0/24 (TEST-NET-1) ... are provided for use in
@@ -56,6 +56,10 @@ class SocketTest : public ::testing::Test {
   void TestSingleFlowControlCallbackIPv6();
   void TestUdpIPv4();
   void TestUdpIPv6();
+  void TestUdpSendToBatchIPv4();
+  void TestUdpSendToBatchIPv6();
+  void TestUdpRecvFromBatchIPv4();
+  void TestUdpRecvFromBatchIPv6();
   void TestUdpReadyToSendIPv4();
   void TestUdpReadyToSendIPv6();
   void TestGetSetOptionsIPv4();
@@ -91,6 +95,8 @@ class SocketTest : public ::testing::Test {
   void SocketServerWaitInternal(const IPAddress& loopback);
   void SingleFlowControlCallbackInternal(const IPAddress& loopback);
   void UdpInternal(const IPAddress& loopback);
+  void UdpSendToBatch(const IPAddress& loopback);
+  void UdpRecvFromBatch(const IPAddress& loopback);
   void UdpReadyToSend(const IPAddress& loopback);
   void GetSetOptionsInternal(const IPAddress& loopback);
   void SocketRecvTimestamp(const IPAddress& loopback);
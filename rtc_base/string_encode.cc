@@ -157,6 +157,20 @@ bool tokenize_first(absl::string_view source,
                     const char delimiter,
                     std::string* token,
                     std::string* rest) {
+  absl::string_view token_view;
+  absl::string_view rest_view;
+  if (!tokenize_first(source, delimiter, &token_view, &rest_view)) {
+    return false;
+  }
+  *token = std::string(token_view);
+  *rest = std::string(rest_view);
+  return true;
+}
+
+bool tokenize_first(absl::string_view source,
+                    const char delimiter,
+                    absl::string_view* token,
+                    absl::string_view* rest) {
   // Find the first delimiter
   size_t left_pos = source.find(delimiter);
   if (left_pos == absl::string_view::npos) {
@@ -169,8 +183,8 @@ bool tokenize_first(absl::string_view source,
     right_pos++;
   }
 
-  *token = std::string(source.substr(0, left_pos));
-  *rest = std::string(source.substr(right_pos));
+  *token = source.substr(0, left_pos);
+  *rest = source.substr(right_pos);
   return true;
 }
 
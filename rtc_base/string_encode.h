@@ -62,6 +62,13 @@ bool tokenize_first(absl::string_view source,
                     std::string* token,
                     std::string* rest);
 
+// Same as above, but `token` and `rest` refer into `source` instead of being
+// copies.
+bool tokenize_first(absl::string_view source,
+                    char delimiter,
+                    absl::string_view* token,
+                    absl::string_view* rest);
+
 // Convert arbitrary values to/from a string.
 // TODO(jonasolsson): Remove these when absl::StrCat becomes available.
 std::string ToString(bool b);
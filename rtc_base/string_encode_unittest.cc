@@ -213,6 +213,21 @@ TEST(TokenizeFirstTest, SingleToken) {
   ASSERT_STREQ("ABC    ", rest.c_str());
 }
 
+TEST(TokenizeFirstTest, StringViews) {
+  absl::string_view source = "A    B& *${}";
+  absl::string_view token;
+  absl::string_view rest;
+
+  ASSERT_TRUE(tokenize_first(source, ' ', &token, &rest));
+  EXPECT_EQ("A", token);
+  EXPECT_EQ("B& *${}", rest);
+  // The tokens refer into the source.
+  EXPECT_EQ(source.data(), token.data());
+  EXPECT_EQ(source.data() + source.size(), rest.data() + rest.size());
+
+  EXPECT_FALSE(tokenize_first("ABC", ' ', &token, &rest));
+}
+
 // Tests counting substrings.
 TEST(SplitTest, CountSubstrings) {
   EXPECT_EQ(5ul, split("one,two,three,four,five", ',').size());
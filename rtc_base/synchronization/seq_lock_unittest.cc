@@ -0,0 +1,82 @@
+/*
+ *  Copyright 2023 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_base/synchronization/seq_lock.h"
+
+#include <stdint.h>
+
+#include <atomic>
+
+#include "rtc_base/platform_thread.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+// Not a multiple of the word size, so that the tail is copied as well.
+struct Value {
+  int64_t counter = 0;
+  int64_t doubled = 0;
+  uint8_t low_byte = 0;
+};
+
+Value MakeValue(int64_t counter) {
+  Value value;
+  value.counter = counter;
+  value.doubled = 2 * counter;
+  value.low_byte = static_cast<uint8_t>(counter);
+  return value;
+}
+
+TEST(SeqLockTest, LoadsDefaultConstructedValue) {
+  SeqLock<Value> seq_lock;
+  Value value = seq_lock.Load();
+  EXPECT_EQ(value.counter, 0);
+  EXPECT_EQ(value.doubled, 0);
+  EXPECT_EQ(value.low_byte, 0);
+}
+
+TEST(SeqLockTest, LoadsLastStoredValue) {
+  SeqLock<Value> seq_lock(MakeValue(1));
+  EXPECT_EQ(seq_lock.Load().counter, 1);
+  seq_lock.Store(MakeValue(300));
+  Value value = seq_lock.Load();
+  EXPECT_EQ(value.counter, 300);
+  EXPECT_EQ(value.doubled, 600);
+  EXPECT_EQ(value.low_byte, 300 & 0xff);
+}
+
+TEST(SeqLockTest, ReaderNeverSeesTornValue) {
+  constexpr int64_t kNumStores = 200000;
+  SeqLock<Value> seq_lock;
+  std::atomic<bool> done(false);
+  auto writer = rtc::PlatformThread::SpawnJoinable(
+      [&] {
+        for (int64_t i = 1; i <= kNumStores; ++i) {
+          seq_lock.Store(MakeValue(i));
+        }
+        done.store(true);
+      },
+      "writer");
+
+  int64_t last_counter = 0;
+  while (!done.load()) {
+    Value value = seq_lock.Load();
+    ASSERT_EQ(value.doubled, 2 * value.counter);
+    ASSERT_EQ(value.low_byte, static_cast<uint8_t>(value.counter));
+    ASSERT_GE(value.counter, last_counter);
+    last_counter = value.counter;
+  }
+  writer.Finalize();
+  EXPECT_EQ(seq_lock.Load().counter, kNumStores);
+}
+
+}  // namespace
+}  // namespace webrtc
@@ -19,6 +19,7 @@
 #include <unistd.h>
 
 #include <list>
+#include <map>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -26,10 +27,12 @@
 #include "absl/container/inlined_vector.h"
 #include "absl/functional/any_invocable.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
 #include "api/task_queue/task_queue_base.h"
 #include "api/units/time_delta.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/logging.h"
+#include "rtc_base/numerics/divide_round.h"
 #include "rtc_base/numerics/safe_conversions.h"
 #include "rtc_base/platform_thread.h"
 #include "rtc_base/platform_thread_types.h"
@@ -43,6 +46,9 @@ namespace {
 constexpr char kQuit = 1;
 constexpr char kRunTasks = 2;
 
+// Granularity of the timers shared by low precision delayed tasks.
+constexpr int64_t kLowPrecisionSlotUs = 16'000;
+
 using Priority = TaskQueueFactory::Priority;
 
 // This ignores the SIGPIPE signal on the calling thread.
@@ -121,7 +127,8 @@ class TaskQueueLibevent final : public TaskQueueBase {
   struct TimerEvent;
 
   void PostDelayedTaskOnTaskQueue(absl::AnyInvocable<void() &&> task,
-                                  TimeDelta delay);
+                                  TimeDelta delay,
+                                  bool high_precision);
 
   ~TaskQueueLibevent() override = default;
 
@@ -139,16 +146,23 @@ class TaskQueueLibevent final : public TaskQueueBase {
       RTC_GUARDED_BY(pending_lock_);
   // Holds a list of events pending timers for cleanup when the loop exits.
   std::list<TimerEvent*> pending_timers_;
+  // Timers shared by the low precision tasks that fire in the same slot,
+  // keyed by the time of the slot.
+  std::map<int64_t, TimerEvent*> low_precision_timers_;
 };
 
 struct TaskQueueLibevent::TimerEvent {
-  TimerEvent(TaskQueueLibevent* task_queue, absl::AnyInvocable<void() &&> task)
-      : task_queue(task_queue), task(std::move(task)) {}
+  explicit TimerEvent(TaskQueueLibevent* task_queue) : task_queue(task_queue) {}
   ~TimerEvent() { event_del(&ev); }
 
   event ev;
   TaskQueueLibevent* task_queue;
-  absl::AnyInvocable<void() &&> task;
+  // Tasks to run in order when the timer fires.
+  absl::InlinedVector<absl::AnyInvocable<void() &&>, 1> tasks;
+  // Position in `pending_timers_`, so that the timer is removed in O(1).
+  std::list<TimerEvent*>::iterator pending_timers_it;
+  // Set for timers in `low_precision_timers_`.
+  absl::optional<int64_t> low_precision_slot_us;
 };
 
 TaskQueueLibevent::TaskQueueLibevent(absl::string_view queue_name,
@@ -242,15 +256,37 @@ void TaskQueueLibevent::PostTaskImpl(absl::AnyInvocable<void() &&> task,
 
 void TaskQueueLibevent::PostDelayedTaskOnTaskQueue(
     absl::AnyInvocable<void() &&> task,
-    TimeDelta delay) {
+    TimeDelta delay,
+    bool high_precision) {
   // libevent api is not thread safe by default, thus event_add need to be
   // called on the `thread_`.
   RTC_DCHECK(IsCurrent());
 
-  TimerEvent* timer = new TimerEvent(this, std::move(task));
+  // Low precision tasks may run up to 17 ms late, so rather than adding an
+  // event for each of them, the ones due within the same slot share a timer.
+  absl::optional<int64_t> slot_us;
+  if (!high_precision) {
+    int64_t now_us = rtc::TimeMicros();
+    slot_us = DivideRoundUp(now_us + delay.us(), kLowPrecisionSlotUs) *
+              kLowPrecisionSlotUs;
+    auto it = low_precision_timers_.find(*slot_us);
+    if (it != low_precision_timers_.end()) {
+      it->second->tasks.push_back(std::move(task));
+      return;
+    }
+    delay = TimeDelta::Micros(*slot_us - now_us);
+  }
+
+  TimerEvent* timer = new TimerEvent(this);
+  timer->tasks.push_back(std::move(task));
   EventAssign(&timer->ev, event_base_, -1, 0, &TaskQueueLibevent::RunTimer,
               timer);
-  pending_timers_.push_back(timer);
+  timer->pending_timers_it =
+      pending_timers_.insert(pending_timers_.end(), timer);
+  if (slot_us) {
+    timer->low_precision_slot_us = slot_us;
+    low_precision_timers_[*slot_us] = timer;
+  }
   timeval tv = {.tv_sec = rtc::dchecked_cast<int>(delay.us() / 1'000'000),
                 .tv_usec = rtc::dchecked_cast<int>(delay.us() % 1'000'000)};
   event_add(&timer->ev, &tv);
@@ -261,14 +297,16 @@ void TaskQueueLibevent::PostDelayedTaskImpl(absl::AnyInvocable<void() &&> task,
                                             const PostDelayedTaskTraits& traits,
                                             const Location& location) {
   if (IsCurrent()) {
-    PostDelayedTaskOnTaskQueue(std::move(task), delay);
+    PostDelayedTaskOnTaskQueue(std::move(task), delay, traits.high_precision);
   } else {
     int64_t posted_us = rtc::TimeMicros();
-    PostTask([posted_us, delay, task = std::move(task), this]() mutable {
+    PostTask([posted_us, delay, high_precision = traits.high_precision,
+              task = std::move(task), this]() mutable {
       // Compensate for the time that has passed since the posting.
       TimeDelta post_time = TimeDelta::Micros(rtc::TimeMicros() - posted_us);
-      PostDelayedTaskOnTaskQueue(
-          std::move(task), std::max(delay - post_time, TimeDelta::Zero()));
+      PostDelayedTaskOnTaskQueue(std::move(task),
+                                 std::max(delay - post_time, TimeDelta::Zero()),
+                                 high_precision);
     });
   }
 }
@@ -311,8 +349,17 @@ void TaskQueueLibevent::RunTimer(int fd,
                                  short flags,  // NOLINT
                                  void* context) {
   TimerEvent* timer = static_cast<TimerEvent*>(context);
-  std::move(timer->task)();
-  timer->task_queue->pending_timers_.remove(timer);
+  TaskQueueLibevent* me = timer->task_queue;
+  // Tasks posted to the slot from now on need a timer of their own.
+  if (timer->low_precision_slot_us) {
+    me->low_precision_timers_.erase(*timer->low_precision_slot_us);
+  }
+  for (auto& task : timer->tasks) {
+    std::move(task)();
+    // Prefer to delete the `task` before running the next one.
+    task = nullptr;
+  }
+  me->pending_timers_.erase(timer->pending_timers_it);
   delete timer;
 }
 
@@ -20,6 +20,7 @@
 
 #include "absl/functional/any_invocable.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
 #include "api/task_queue/task_queue_base.h"
 #include "api/units/time_delta.h"
 #include "rtc_base/checks.h"
@@ -34,6 +35,11 @@
 namespace webrtc {
 namespace {
 
+// Low precision delayed tasks are allowed a 17 ms leeway, so their fire times
+// are rounded up to a multiple of this and tasks sharing a fire time are kept
+// in a single entry and run on a single wake-up.
+constexpr int64_t kLowPrecisionSlotUs = 16'000;
+
 rtc::ThreadPriority TaskQueuePriorityToThreadPriority(
     TaskQueueFactory::Priority priority) {
   switch (priority) {
@@ -88,6 +94,10 @@ class TaskQueueStdlib final : public TaskQueueBase {
 
   NextTask GetNextTask();
 
+  // Removes and returns the first task of the earliest low precision slot.
+  absl::AnyInvocable<void() &&> PopLowPrecisionTask()
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(pending_lock_);
+
   void ProcessTasks();
 
   void NotifyWake();
@@ -118,6 +128,12 @@ class TaskQueueStdlib final : public TaskQueueBase {
   std::map<DelayedEntryTimeout, absl::AnyInvocable<void() &&>> delayed_queue_
       RTC_GUARDED_BY(pending_lock_);
 
+  // Low precision delayed tasks, keyed by their rounded up fire time. Tasks
+  // within a slot run in FIFO order, which is also their posting order.
+  std::map<int64_t,
+           std::queue<std::pair<OrderId, absl::AnyInvocable<void() &&>>>>
+      low_precision_queue_ RTC_GUARDED_BY(pending_lock_);
+
   // Contains the active worker thread assigned to processing
   // tasks (including delayed tasks).
   // Placing this last ensures the thread doesn't touch uninitialized attributes
@@ -182,7 +198,15 @@ void TaskQueueStdlib::PostDelayedTaskImpl(absl::AnyInvocable<void() &&> task,
   {
     MutexLock lock(&pending_lock_);
     delayed_entry.order = ++thread_posting_order_;
-    delayed_queue_[delayed_entry] = std::move(task);
+    if (traits.high_precision) {
+      delayed_queue_[delayed_entry] = std::move(task);
+    } else {
+      int64_t slot_us =
+          DivideRoundUp(delayed_entry.next_fire_at_us, kLowPrecisionSlotUs) *
+          kLowPrecisionSlotUs;
+      low_precision_queue_[slot_us].emplace(delayed_entry.order,
+                                            std::move(task));
+    }
   }
 
   NotifyWake();
@@ -200,10 +224,24 @@ TaskQueueStdlib::NextTask TaskQueueStdlib::GetNextTask() {
     return result;
   }
 
-  if (delayed_queue_.size() > 0) {
-    auto delayed_entry = delayed_queue_.begin();
-    const auto& delay_info = delayed_entry->first;
-    auto& delay_run = delayed_entry->second;
+  // Find the delayed task to run first out of both delayed queues.
+  absl::optional<DelayedEntryTimeout> next_delayed;
+  bool next_is_low_precision = false;
+  if (!delayed_queue_.empty()) {
+    next_delayed = delayed_queue_.begin()->first;
+  }
+  if (!low_precision_queue_.empty()) {
+    const auto& [slot_us, slot_tasks] = *low_precision_queue_.begin();
+    DelayedEntryTimeout low_precision_entry{
+        .next_fire_at_us = slot_us, .order = slot_tasks.front().first};
+    if (!next_delayed || low_precision_entry < *next_delayed) {
+      next_delayed = low_precision_entry;
+      next_is_low_precision = true;
+    }
+  }
+
+  if (next_delayed) {
+    const DelayedEntryTimeout& delay_info = *next_delayed;
     if (tick_us >= delay_info.next_fire_at_us) {
       if (pending_queue_.size() > 0) {
         auto& entry = pending_queue_.front();
@@ -216,8 +254,13 @@ TaskQueueStdlib::NextTask TaskQueueStdlib::GetNextTask() {
         }
       }
 
-      result.run_task = std::move(delay_run);
-      delayed_queue_.erase(delayed_entry);
+      if (next_is_low_precision) {
+        result.run_task = PopLowPrecisionTask();
+      } else {
+        auto delayed_entry = delayed_queue_.begin();
+        result.run_task = std::move(delayed_entry->second);
+        delayed_queue_.erase(delayed_entry);
+      }
       return result;
     }
 
@@ -234,6 +277,16 @@ TaskQueueStdlib::NextTask TaskQueueStdlib::GetNextTask() {
   return result;
 }
 
+absl::AnyInvocable<void() &&> TaskQueueStdlib::PopLowPrecisionTask() {
+  auto slot = low_precision_queue_.begin();
+  absl::AnyInvocable<void() &&> task = std::move(slot->second.front().second);
+  slot->second.pop();
+  if (slot->second.empty()) {
+    low_precision_queue_.erase(slot);
+  }
+  return task;
+}
+
 void TaskQueueStdlib::ProcessTasks() {
   while (true) {
     auto task = GetNextTask();
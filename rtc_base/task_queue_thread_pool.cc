@@ -0,0 +1,412 @@
+/*
+ *  Copyright 2023 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_base/task_queue_thread_pool.h"
+
+#include <stdint.h>
+
+#include <deque>
+#include <limits>
+#include <map>
+#include <memory>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "absl/functional/any_invocable.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+#include "api/ref_counted_base.h"
+#include "api/scoped_refptr.h"
+#include "api/task_queue/task_queue_base.h"
+#include "api/units/time_delta.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/event.h"
+#include "rtc_base/numerics/divide_round.h"
+#include "rtc_base/platform_thread.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/thread_annotations.h"
+#include "rtc_base/time_utils.h"
+
+namespace webrtc {
+namespace {
+
+// Number of tasks a worker thread runs from one queue before it moves on to
+// the next ready queue, so that a busy queue cannot starve the others.
+constexpr int kMaxTasksPerRun = 16;
+
+constexpr int64_t kNoWakeUp = std::numeric_limits<int64_t>::max();
+
+class ThreadPoolTaskQueue;
+
+class ThreadPool {
+ public:
+  explicit ThreadPool(int num_threads);
+  ~ThreadPool();
+
+  // Adds `queue` to the queues waiting for a worker thread. High priority
+  // queues are put ahead of the others.
+  void Schedule(rtc::scoped_refptr<ThreadPoolTaskQueue> queue,
+                bool high_priority);
+
+  // Calls `queue->OnWakeUp()` once the time is `wake_up_us` or later.
+  void ScheduleWakeUp(rtc::scoped_refptr<ThreadPoolTaskQueue> queue,
+                      int64_t wake_up_us);
+
+ private:
+  void RunWorker();
+  void RunTimer();
+
+  Mutex mutex_;
+  bool quit_ RTC_GUARDED_BY(mutex_) = false;
+  std::deque<rtc::scoped_refptr<ThreadPoolTaskQueue>> ready_queues_
+      RTC_GUARDED_BY(mutex_);
+  std::multimap<int64_t, rtc::scoped_refptr<ThreadPoolTaskQueue>> wake_ups_
+      RTC_GUARDED_BY(mutex_);
+
+  // Signaled when a queue becomes ready. A worker that wakes up passes the
+  // signal on while there are more ready queues, so that idle workers pick
+  // them up.
+  rtc::Event worker_wake_;
+  // Signaled when a wake-up earlier than all the pending ones is added.
+  rtc::Event timer_wake_;
+
+  std::vector<rtc::PlatformThread> workers_;
+  rtc::PlatformThread timer_;
+};
+
+class ThreadPoolTaskQueue final : public TaskQueueBase,
+                                  public rtc::RefCountedBase {
+ public:
+  ThreadPoolTaskQueue(ThreadPool* pool, bool high_priority);
+
+  void Delete() override;
+
+  // Runs pending tasks on the calling worker thread until there are none
+  // left or `kMaxTasksPerRun` have run, rescheduling the queue in the latter
+  // case.
+  void RunTasks();
+
+  // Makes the delayed tasks that are due pending.
+  void OnWakeUp();
+
+ protected:
+  void PostTaskImpl(absl::AnyInvocable<void() &&> task,
+                    const PostTaskTraits& traits,
+                    const Location& location) override;
+  void PostDelayedTaskImpl(absl::AnyInvocable<void() &&> task,
+                           TimeDelta delay,
+                           const PostDelayedTaskTraits& traits,
+                           const Location& location) override;
+
+ private:
+  using OrderId = uint64_t;
+
+  ~ThreadPoolTaskQueue() override = default;
+
+  ThreadPool* const pool_;
+  const bool high_priority_;
+
+  // Signaled by the worker thread running the queue once it notices that
+  // the queue has been deleted.
+  rtc::Event stopped_;
+
+  Mutex mutex_;
+  bool deleted_ RTC_GUARDED_BY(mutex_) = false;
+  // True while the queue is waiting for or running on a worker thread.
+  bool scheduled_ RTC_GUARDED_BY(mutex_) = false;
+  // True while a worker thread is running tasks of the queue.
+  bool running_ RTC_GUARDED_BY(mutex_) = false;
+  OrderId next_order_ RTC_GUARDED_BY(mutex_) = 0;
+  // Earliest wake-up requested from the pool.
+  int64_t next_wake_up_us_ RTC_GUARDED_BY(mutex_) = kNoWakeUp;
+  std::queue<absl::AnyInvocable<void() &&>> pending_ RTC_GUARDED_BY(mutex_);
+  // Delayed tasks keyed by their fire time, then by posting order.
+  std::map<std::pair<int64_t, OrderId>, absl::AnyInvocable<void() &&>>
+      delayed_ RTC_GUARDED_BY(mutex_);
+};
+
+ThreadPoolTaskQueue::ThreadPoolTaskQueue(ThreadPool* pool, bool high_priority)
+    : pool_(pool), high_priority_(high_priority) {
+  // Released by Delete().
+  AddRef();
+}
+
+void ThreadPoolTaskQueue::Delete() {
+  RTC_DCHECK(!IsCurrent());
+
+  bool wait_for_worker;
+  {
+    MutexLock lock(&mutex_);
+    deleted_ = true;
+    // A queue that is only waiting for a worker thread is not waited for, so
+    // that Delete() can also be called from a task on another queue of the
+    // pool.
+    wait_for_worker = running_;
+  }
+  if (wait_for_worker) {
+    stopped_.Wait(rtc::Event::kForever);
+  }
+
+  // Ensure remaining deleted tasks are destroyed with Current() set up to this
+  // task queue.
+  std::queue<absl::AnyInvocable<void() &&>> pending;
+  std::map<std::pair<int64_t, OrderId>, absl::AnyInvocable<void() &&>> delayed;
+  {
+    MutexLock lock(&mutex_);
+    pending_.swap(pending);
+    delayed_.swap(delayed);
+  }
+  {
+    CurrentTaskQueueSetter set_current(this);
+    pending = {};
+    delayed.clear();
+  }
+
+  Release();
+}
+
+void ThreadPoolTaskQueue::RunTasks() {
+  CurrentTaskQueueSetter set_current(this);
+  for (int i = 0;; ++i) {
+    absl::AnyInvocable<void() &&> task;
+    {
+      MutexLock lock(&mutex_);
+      if (deleted_ || pending_.empty()) {
+        if (deleted_ && running_) {
+          stopped_.Set();
+        }
+        scheduled_ = false;
+        running_ = false;
+        return;
+      }
+      if (i == kMaxTasksPerRun) {
+        // Leave the queue scheduled, so that posted tasks do not schedule
+        // it a second time.
+        running_ = false;
+        break;
+      }
+      running_ = true;
+      task = std::move(pending_.front());
+      pending_.pop();
+    }
+    std::move(task)();
+    // Prefer to delete the `task` before running the next one.
+    task = nullptr;
+  }
+  pool_->Schedule(rtc::scoped_refptr<ThreadPoolTaskQueue>(this),
+                  high_priority_);
+}
+
+void ThreadPoolTaskQueue::OnWakeUp() {
+  const int64_t now_us = rtc::TimeMicros();
+  absl::optional<int64_t> wake_up_us;
+  bool schedule = false;
+  {
+    MutexLock lock(&mutex_);
+    if (deleted_) {
+      return;
+    }
+    if (next_wake_up_us_ <= now_us) {
+      next_wake_up_us_ = kNoWakeUp;
+    }
+    while (!delayed_.empty() && delayed_.begin()->first.first <= now_us) {
+      pending_.push(std::move(delayed_.begin()->second));
+      delayed_.erase(delayed_.begin());
+    }
+    if (!delayed_.empty() && delayed_.begin()->first.first < next_wake_up_us_) {
+      next_wake_up_us_ = delayed_.begin()->first.first;
+      wake_up_us = next_wake_up_us_;
+    }
+    if (!pending_.empty() && !scheduled_) {
+      scheduled_ = true;
+      schedule = true;
+    }
+  }
+  if (wake_up_us) {
+    pool_->ScheduleWakeUp(rtc::scoped_refptr<ThreadPoolTaskQueue>(this),
+                          *wake_up_us);
+  }
+  if (schedule) {
+    pool_->Schedule(rtc::scoped_refptr<ThreadPoolTaskQueue>(this),
+                    high_priority_);
+  }
+}
+
+void ThreadPoolTaskQueue::PostTaskImpl(absl::AnyInvocable<void() &&> task,
+                                       const PostTaskTraits& traits,
+                                       const Location& location) {
+  {
+    MutexLock lock(&mutex_);
+    if (deleted_) {
+      return;
+    }
+    pending_.push(std::move(task));
+    if (scheduled_) {
+      return;
+    }
+    scheduled_ = true;
+  }
+  pool_->Schedule(rtc::scoped_refptr<ThreadPoolTaskQueue>(this),
+                  high_priority_);
+}
+
+void ThreadPoolTaskQueue::PostDelayedTaskImpl(
+    absl::AnyInvocable<void() &&> task,
+    TimeDelta delay,
+    const PostDelayedTaskTraits& traits,
+    const Location& location) {
+  const int64_t fire_at_us = rtc::TimeMicros() + delay.us();
+  {
+    MutexLock lock(&mutex_);
+    if (deleted_) {
+      return;
+    }
+    delayed_.emplace(std::make_pair(fire_at_us, ++next_order_),
+                     std::move(task));
+    // A wake-up is only needed if there is none in time for this task.
+    if (fire_at_us >= next_wake_up_us_) {
+      return;
+    }
+    next_wake_up_us_ = fire_at_us;
+  }
+  pool_->ScheduleWakeUp(rtc::scoped_refptr<ThreadPoolTaskQueue>(this),
+                        fire_at_us);
+}
+
+ThreadPool::ThreadPool(int num_threads) {
+  RTC_CHECK_GT(num_threads, 0);
+  for (int i = 0; i < num_threads; ++i) {
+    workers_.push_back(rtc::PlatformThread::SpawnJoinable(
+        [this] { RunWorker(); }, "TaskQueuePool"));
+  }
+  timer_ = rtc::PlatformThread::SpawnJoinable([this] { RunTimer(); },
+                                              "TaskQueuePoolTimer");
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    MutexLock lock(&mutex_);
+    quit_ = true;
+  }
+  worker_wake_.Set();
+  timer_wake_.Set();
+  for (rtc::PlatformThread& worker : workers_) {
+    worker.Finalize();
+  }
+  timer_.Finalize();
+}
+
+void ThreadPool::Schedule(rtc::scoped_refptr<ThreadPoolTaskQueue> queue,
+                          bool high_priority) {
+  {
+    MutexLock lock(&mutex_);
+    if (high_priority) {
+      ready_queues_.push_front(std::move(queue));
+    } else {
+      ready_queues_.push_back(std::move(queue));
+    }
+  }
+  worker_wake_.Set();
+}
+
+void ThreadPool::ScheduleWakeUp(rtc::scoped_refptr<ThreadPoolTaskQueue> queue,
+                                int64_t wake_up_us) {
+  bool is_earliest;
+  {
+    MutexLock lock(&mutex_);
+    auto it = wake_ups_.emplace(wake_up_us, std::move(queue));
+    is_earliest = it == wake_ups_.begin();
+  }
+  if (is_earliest) {
+    timer_wake_.Set();
+  }
+}
+
+void ThreadPool::RunWorker() {
+  while (true) {
+    rtc::scoped_refptr<ThreadPoolTaskQueue> queue;
+    bool more_ready = false;
+    {
+      MutexLock lock(&mutex_);
+      if (quit_) {
+        break;
+      }
+      if (!ready_queues_.empty()) {
+        queue = std::move(ready_queues_.front());
+        ready_queues_.pop_front();
+        more_ready = !ready_queues_.empty();
+      }
+    }
+    if (!queue) {
+      worker_wake_.Wait(rtc::Event::kForever);
+      continue;
+    }
+    if (more_ready) {
+      worker_wake_.Set();
+    }
+    queue->RunTasks();
+  }
+  // Let the next worker thread see `quit_` too.
+  worker_wake_.Set();
+}
+
+void ThreadPool::RunTimer() {
+  while (true) {
+    std::vector<rtc::scoped_refptr<ThreadPoolTaskQueue>> due;
+    TimeDelta sleep_time = rtc::Event::kForever;
+    {
+      MutexLock lock(&mutex_);
+      if (quit_) {
+        break;
+      }
+      const int64_t now_us = rtc::TimeMicros();
+      while (!wake_ups_.empty() && wake_ups_.begin()->first <= now_us) {
+        due.push_back(std::move(wake_ups_.begin()->second));
+        wake_ups_.erase(wake_ups_.begin());
+      }
+      if (!wake_ups_.empty()) {
+        sleep_time = TimeDelta::Millis(
+            DivideRoundUp(wake_ups_.begin()->first - now_us, 1'000));
+      }
+    }
+    if (due.empty()) {
+      timer_wake_.Wait(sleep_time);
+      continue;
+    }
+    for (rtc::scoped_refptr<ThreadPoolTaskQueue>& queue : due) {
+      queue->OnWakeUp();
+    }
+  }
+}
+
+class TaskQueueThreadPoolFactory final : public TaskQueueFactory {
+ public:
+  explicit TaskQueueThreadPoolFactory(int num_threads) : pool_(num_threads) {}
+
+  std::unique_ptr<TaskQueueBase, TaskQueueDeleter> CreateTaskQueue(
+      absl::string_view name,
+      Priority priority) const override {
+    return std::unique_ptr<TaskQueueBase, TaskQueueDeleter>(
+        new ThreadPoolTaskQueue(&pool_, priority == Priority::HIGH));
+  }
+
+ private:
+  mutable ThreadPool pool_;
+};
+
+}  // namespace
+
+std::unique_ptr<TaskQueueFactory> CreateTaskQueueThreadPoolFactory(
+    int num_threads) {
+  return std::make_unique<TaskQueueThreadPoolFactory>(num_threads);
+}
+
+}  // namespace webrtc
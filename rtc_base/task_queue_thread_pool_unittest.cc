@@ -0,0 +1,91 @@
+/*
+ *  Copyright 2023 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_base/task_queue_thread_pool.h"
+
+#include <memory>
+#include <vector>
+
+#include "api/task_queue/task_queue_test.h"
+#include "api/units/time_delta.h"
+#include "rtc_base/event.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+std::unique_ptr<TaskQueueFactory> CreateTaskQueueFactory(
+    const webrtc::FieldTrialsView*) {
+  return CreateTaskQueueThreadPoolFactory(/*num_threads=*/2);
+}
+
+INSTANTIATE_TEST_SUITE_P(TaskQueueThreadPool,
+                         TaskQueueTest,
+                         ::testing::Values(CreateTaskQueueFactory));
+
+TEST(TaskQueueThreadPoolTest, RunsTasksOfOneQueueInOrder) {
+  std::unique_ptr<TaskQueueFactory> factory =
+      CreateTaskQueueThreadPoolFactory(/*num_threads=*/4);
+  auto queue = factory->CreateTaskQueue("queue",
+                                        TaskQueueFactory::Priority::NORMAL);
+  // Not synchronized, as the tasks must not run concurrently.
+  int next_task = 0;
+  rtc::Event done;
+  for (int i = 0; i < 1000; ++i) {
+    queue->PostTask([&, i] {
+      EXPECT_TRUE(queue->IsCurrent());
+      EXPECT_EQ(next_task++, i);
+    });
+  }
+  queue->PostTask([&done] { done.Set(); });
+  EXPECT_TRUE(done.Wait(TimeDelta::Seconds(5)));
+}
+
+TEST(TaskQueueThreadPoolTest, SharesThreadsBetweenQueues) {
+  std::unique_ptr<TaskQueueFactory> factory =
+      CreateTaskQueueThreadPoolFactory(/*num_threads=*/1);
+  std::vector<std::unique_ptr<TaskQueueBase, TaskQueueDeleter>> queues;
+  std::vector<rtc::Event> events(10);
+  for (rtc::Event& event : events) {
+    queues.push_back(factory->CreateTaskQueue(
+        "queue", TaskQueueFactory::Priority::NORMAL));
+    TaskQueueBase* queue = queues.back().get();
+    queue->PostDelayedTask(
+        [queue, &event] {
+          EXPECT_EQ(TaskQueueBase::Current(), queue);
+          event.Set();
+        },
+        TimeDelta::Millis(10));
+  }
+  for (rtc::Event& event : events) {
+    EXPECT_TRUE(event.Wait(TimeDelta::Seconds(1)));
+  }
+}
+
+TEST(TaskQueueThreadPoolTest, DeletesQueueFromTaskOfAnotherQueue) {
+  std::unique_ptr<TaskQueueFactory> factory =
+      CreateTaskQueueThreadPoolFactory(/*num_threads=*/1);
+  auto queue = factory->CreateTaskQueue("queue",
+                                        TaskQueueFactory::Priority::NORMAL);
+  auto other_queue = factory->CreateTaskQueue(
+      "other_queue", TaskQueueFactory::Priority::NORMAL);
+  rtc::Event done;
+  queue->PostTask([&] {
+    // The only worker thread is busy with this task, so `other_queue` has to
+    // be deleted without waiting for its task to start.
+    other_queue->PostTask([] { ADD_FAILURE() << "Should not run"; });
+    other_queue = nullptr;
+    done.Set();
+  });
+  EXPECT_TRUE(done.Wait(TimeDelta::Seconds(1)));
+}
+
+}  // namespace
+}  // namespace webrtc
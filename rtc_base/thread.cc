@@ -284,15 +284,26 @@ Thread::ScopedDisallowBlockingCalls::~ScopedDisallowBlockingCalls() {
 #if RTC_DCHECK_IS_ON
 Thread::ScopedCountBlockingCalls::ScopedCountBlockingCalls(
     std::function<void(uint32_t, uint32_t)> callback)
+    : ScopedCountBlockingCalls(
+          [callback = std::move(callback)](uint32_t actual_block,
+                                           uint32_t could_block,
+                                           int64_t blocked_us) {
+            callback(actual_block, could_block);
+          }) {}
+
+Thread::ScopedCountBlockingCalls::ScopedCountBlockingCalls(
+    std::function<void(uint32_t, uint32_t, int64_t)> callback)
     : thread_(Thread::Current()),
       base_blocking_call_count_(thread_->GetBlockingCallCount()),
       base_could_be_blocking_call_count_(
           thread_->GetCouldBeBlockingCallCount()),
+      base_blocking_call_duration_us_(thread_->GetBlockingCallDurationUs()),
       result_callback_(std::move(callback)) {}
 
 Thread::ScopedCountBlockingCalls::~ScopedCountBlockingCalls() {
   if (GetTotalBlockedCallCount() >= min_blocking_calls_for_callback_) {
-    result_callback_(GetBlockingCallCount(), GetCouldBeBlockingCallCount());
+    result_callback_(GetBlockingCallCount(), GetCouldBeBlockingCallCount(),
+                     GetBlockingCallDurationUs());
   }
 }
 
@@ -308,6 +319,10 @@ uint32_t Thread::ScopedCountBlockingCalls::GetCouldBeBlockingCallCount() const {
 uint32_t Thread::ScopedCountBlockingCalls::GetTotalBlockedCallCount() const {
   return GetBlockingCallCount() + GetCouldBeBlockingCallCount();
 }
+
+int64_t Thread::ScopedCountBlockingCalls::GetBlockingCallDurationUs() const {
+  return thread_->GetBlockingCallDurationUs() - base_blocking_call_duration_us_;
+}
 #endif
 
 Thread::Thread(SocketServer* ss) : Thread(ss, /*do_init=*/true) {}
@@ -466,11 +481,17 @@ void Thread::PostTaskImpl(absl::AnyInvocable<void() &&> task,
   // Add the message to the end of the queue
   // Signal for the multiplexer to return
 
+  bool was_empty;
   {
     MutexLock lock(&mutex_);
+    was_empty = messages_.empty();
     messages_.push(std::move(task));
   }
-  WakeUpSocketServer();
+  // `Get` only waits on the socket server after having seen an empty queue, so
+  // only the first of a burst of posts needs to wake it up.
+  if (was_empty) {
+    WakeUpSocketServer();
+  }
 }
 
 void Thread::PostDelayedTaskImpl(absl::AnyInvocable<void() &&> task,
@@ -487,8 +508,13 @@ void Thread::PostDelayedTaskImpl(absl::AnyInvocable<void() &&> task,
 
   int64_t delay_ms = delay.RoundUpTo(webrtc::TimeDelta::Millis(1)).ms<int>();
   int64_t run_time_ms = TimeAfter(delay_ms);
+  bool is_next_to_run;
   {
     MutexLock lock(&mutex_);
+    // Messages with identical times run in posting order, so this message only
+    // goes first if it is strictly earlier than all pending ones.
+    is_next_to_run = delayed_messages_.empty() ||
+                     run_time_ms < delayed_messages_.top().run_time_ms;
     delayed_messages_.push({.delay_ms = delay_ms,
                             .run_time_ms = run_time_ms,
                             .message_number = delayed_next_num_,
@@ -499,7 +525,11 @@ void Thread::PostDelayedTaskImpl(absl::AnyInvocable<void() &&> task,
     ++delayed_next_num_;
     RTC_DCHECK_NE(0, delayed_next_num_);
   }
-  WakeUpSocketServer();
+  // A thread that is waiting wakes up in time for the earliest delayed message
+  // it knows about, so a later message does not need to wake it up sooner.
+  if (is_next_to_run) {
+    WakeUpSocketServer();
+  }
 }
 
 int Thread::GetDelay() {
@@ -742,7 +772,8 @@ void Thread::BlockingCallImpl(rtc::FunctionView<void()> functor,
   }
 
 #if RTC_DCHECK_IS_ON
-  if (Thread* current_thread = Thread::Current()) {
+  Thread* current_thread = Thread::Current();
+  if (current_thread) {
     RTC_DCHECK_RUN_ON(current_thread);
     RTC_DCHECK(current_thread->blocking_calls_allowed_);
     current_thread->blocking_call_count_++;
@@ -750,12 +781,20 @@ void Thread::BlockingCallImpl(rtc::FunctionView<void()> functor,
     ThreadManager::Instance()->RegisterSendAndCheckForCycles(current_thread,
                                                              this);
   }
+  const int64_t start_us = TimeMicros();
 #endif
 
   Event done;
   absl::Cleanup cleanup = [&done] { done.Set(); };
   PostTask([functor, cleanup = std::move(cleanup)] { functor(); });
   done.Wait(Event::kForever);
+
+#if RTC_DCHECK_IS_ON
+  if (current_thread) {
+    RTC_DCHECK_RUN_ON(current_thread);
+    current_thread->blocking_call_duration_us_ += TimeMicros() - start_us;
+  }
+#endif
 }
 
 // Called by the ThreadManager when being set as the current thread.
@@ -802,6 +841,10 @@ uint32_t Thread::GetCouldBeBlockingCallCount() const {
   RTC_DCHECK_RUN_ON(this);
   return could_be_blocking_call_count_;
 }
+int64_t Thread::GetBlockingCallDurationUs() const {
+  RTC_DCHECK_RUN_ON(this);
+  return blocking_call_duration_us_;
+}
 #endif
 
 // Returns true if no policies added or if there is at least one policy
@@ -47,15 +47,18 @@
 
 #if RTC_DCHECK_IS_ON
 // Counts how many `Thread::BlockingCall` are made from within a scope and logs
-// the number of blocking calls at the end of the scope.
+// the number of blocking calls, and the time spent blocked in them, at the end
+// of the scope.
 #define RTC_LOG_THREAD_BLOCK_COUNT()                                        \
   rtc::Thread::ScopedCountBlockingCalls blocked_call_count_printer(         \
-      [func = __func__](uint32_t actual_block, uint32_t could_block) {      \
+      [func = __func__](uint32_t actual_block, uint32_t could_block,        \
+                        int64_t blocked_us) {                               \
         auto total = actual_block + could_block;                            \
         if (total) {                                                        \
           RTC_LOG(LS_WARNING) << "Blocking " << func << ": total=" << total \
                               << " (actual=" << actual_block                \
-                              << ", could=" << could_block << ")";          \
+                              << ", could=" << could_block                  \
+                              << ", blocked_us=" << blocked_us << ")";      \
         }                                                                   \
       })
 
@@ -217,6 +220,10 @@ class RTC_LOCKABLE RTC_EXPORT Thread : public webrtc::TaskQueueBase {
   class ScopedCountBlockingCalls {
    public:
     ScopedCountBlockingCalls(std::function<void(uint32_t, uint32_t)> callback);
+    // As above, additionally reporting the total time in microseconds that
+    // the current thread spent blocked waiting for other threads.
+    ScopedCountBlockingCalls(
+        std::function<void(uint32_t, uint32_t, int64_t)> callback);
     ScopedCountBlockingCalls(const ScopedDisallowBlockingCalls&) = delete;
     ScopedCountBlockingCalls& operator=(const ScopedDisallowBlockingCalls&) =
         delete;
@@ -225,6 +232,7 @@ class RTC_LOCKABLE RTC_EXPORT Thread : public webrtc::TaskQueueBase {
     uint32_t GetBlockingCallCount() const;
     uint32_t GetCouldBeBlockingCallCount() const;
     uint32_t GetTotalBlockedCallCount() const;
+    int64_t GetBlockingCallDurationUs() const;
 
     void set_minimum_call_count_for_callback(uint32_t minimum) {
       min_blocking_calls_for_callback_ = minimum;
@@ -234,16 +242,18 @@ class RTC_LOCKABLE RTC_EXPORT Thread : public webrtc::TaskQueueBase {
     Thread* const thread_;
     const uint32_t base_blocking_call_count_;
     const uint32_t base_could_be_blocking_call_count_;
+    const int64_t base_blocking_call_duration_us_;
     // The minimum number of blocking calls required in order to issue the
     // result_callback_. This is used by RTC_DCHECK_BLOCK_COUNT_NO_MORE_THAN to
     // tame log spam.
     // By default we always issue the callback, regardless of callback count.
     uint32_t min_blocking_calls_for_callback_ = 0;
-    std::function<void(uint32_t, uint32_t)> result_callback_;
+    std::function<void(uint32_t, uint32_t, int64_t)> result_callback_;
   };
 
   uint32_t GetBlockingCallCount() const;
   uint32_t GetCouldBeBlockingCallCount() const;
+  int64_t GetBlockingCallDurationUs() const;
 #endif
 
   SocketServer* socketserver();
@@ -491,6 +501,7 @@ class RTC_LOCKABLE RTC_EXPORT Thread : public webrtc::TaskQueueBase {
 #if RTC_DCHECK_IS_ON
   uint32_t blocking_call_count_ RTC_GUARDED_BY(this) = 0;
   uint32_t could_be_blocking_call_count_ RTC_GUARDED_BY(this) = 0;
+  int64_t blocking_call_duration_us_ RTC_GUARDED_BY(this) = 0;
   std::vector<Thread*> allowed_threads_ RTC_GUARDED_BY(this);
   bool invoke_policy_enabled_ RTC_GUARDED_BY(this) = false;
 #endif
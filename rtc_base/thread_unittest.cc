@@ -10,6 +10,7 @@
 
 #include "rtc_base/thread.h"
 
+#include <atomic>
 #include <memory>
 
 #include "api/field_trials_view.h"
@@ -257,6 +258,27 @@ TEST(ThreadTest, CountBlockingCallsSkipCallback) {
   // We should not have gotten a call back.
   EXPECT_FALSE(was_called_back);
 }
+
+TEST(ThreadTest, CountBlockingCallsDuration) {
+  rtc::AutoThread current;
+  auto thread = Thread::CreateWithSocketServer();
+  thread->Start();
+  int64_t reported_us = -1;
+  {
+    rtc::Thread::ScopedCountBlockingCalls blocked_calls(
+        [&](uint32_t actual_block, uint32_t could_block, int64_t blocked_us) {
+          EXPECT_EQ(1u, actual_block);
+          reported_us = blocked_us;
+        });
+    // Calls on the current thread do not block and add no duration.
+    current.BlockingCall([]() {});
+    EXPECT_EQ(0, blocked_calls.GetBlockingCallDurationUs());
+    thread->BlockingCall([]() { Thread::SleepMs(10); });
+    EXPECT_GT(blocked_calls.GetBlockingCallDurationUs(), 0);
+  }
+  EXPECT_GT(reported_us, 0);
+  thread->Stop();
+}
 #endif
 
 // Test that setting thread names doesn't cause a malfunction.
@@ -509,6 +531,47 @@ TEST(ThreadTest, DelayedPostsWithIdenticalTimesAreProcessedInFifoOrder) {
   DelayedPostsWithIdenticalTimesAreProcessedInFifoOrder(clock, q_nullss);
 }
 
+class WakeUpCountingSocketServer : public NullSocketServer {
+ public:
+  void WakeUp() override {
+    ++wake_ups_;
+    NullSocketServer::WakeUp();
+  }
+
+  int wake_ups() const { return wake_ups_.load(); }
+
+ private:
+  std::atomic<int> wake_ups_{0};
+};
+
+TEST(ThreadTest, WakesUpSocketServerOnlyWhenNeeded) {
+  WakeUpCountingSocketServer ss;
+  Thread thread(&ss, true);
+
+  // Only the first post to an empty queue needs to wake the thread up.
+  thread.PostTask([] {});
+  thread.PostTask([] {});
+  EXPECT_EQ(ss.wake_ups(), 1);
+
+  // Only delayed posts that run before all pending ones do.
+  thread.PostDelayedTask([] {}, TimeDelta::Seconds(10));
+  EXPECT_EQ(ss.wake_ups(), 2);
+  thread.PostDelayedTask([] {}, TimeDelta::Seconds(20));
+  thread.PostDelayedTask([] {}, TimeDelta::Seconds(10));
+  EXPECT_EQ(ss.wake_ups(), 2);
+  thread.PostDelayedTask([] {}, TimeDelta::Seconds(5));
+  EXPECT_EQ(ss.wake_ups(), 3);
+
+  // Tasks posted without a wake-up are still run.
+  int run_count = 0;
+  thread.PostTask([&run_count] { ++run_count; });
+  thread.PostTask([&run_count] { ++run_count; });
+  thread.Start();
+  thread.BlockingCall([] {});
+  EXPECT_EQ(run_count, 2);
+  thread.Stop();
+}
+
 // Ensure that ProcessAllMessageQueues does its essential function; process
 // all messages (both delayed and non delayed) up until the current time, on
 // all registered message queues.
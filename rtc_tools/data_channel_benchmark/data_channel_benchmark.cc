@@ -12,7 +12,14 @@
  *  Create a server using: ./data_channel_benchmark --server --port 12345
  *  Start the flow of data from the server to a client using:
  *  ./data_channel_benchmark --port 12345 --transfer_size 100 --packet_size 8196
- *  The throughput is reported on the server console.
+ *  The throughput and the CPU time used per MiB are reported on the server
+ *  console. The client reports the p50 and p99 latency of the messages, which
+ *  is only meaningful when both peers run on the same host.
+ *
+ *  The data channel is created by the server, so its reliability is set with
+ *  --ordered, --max_retransmits and --max_packet_life_time_ms on the server.
+ *  Unreliable channels may drop messages, in which case the client waits
+ *  forever.
  *
  *  The negotiation does not require a 3rd party server and is done over a gRPC
  *  transport. No TURN server is configured, so both peers need to be reachable
@@ -20,11 +27,15 @@
  */
 #include <inttypes.h>
 
+#include <algorithm>
 #include <charconv>
+#include <ctime>
+#include <vector>
 
 #include "absl/cleanup/cleanup.h"
 #include "absl/flags/flag.h"
 #include "absl/flags/parse.h"
+#include "rtc_base/byte_order.h"
 #include "rtc_base/event.h"
 #include "rtc_base/ssl_adapter.h"
 #include "rtc_base/thread.h"
@@ -39,6 +50,15 @@ ABSL_FLAG(std::string, address, "localhost", "Connect to server address");
 ABSL_FLAG(uint16_t, port, 0, "Connect to port (0 for random)");
 ABSL_FLAG(uint64_t, transfer_size, 2, "Transfer size (MiB)");
 ABSL_FLAG(uint64_t, packet_size, 256 * 1024, "Packet size");
+ABSL_FLAG(bool, ordered, true, "Server mode: use an ordered data channel");
+ABSL_FLAG(int,
+          max_retransmits,
+          -1,
+          "Server mode: max retransmissions of a message (-1 for reliable)");
+ABSL_FLAG(int,
+          max_packet_life_time_ms,
+          -1,
+          "Server mode: max lifetime of a message in ms (-1 for reliable)");
 ABSL_FLAG(std::string,
           force_fieldtrials,
           "",
@@ -46,6 +66,14 @@ ABSL_FLAG(std::string,
           "E.g. running with --force_fieldtrials=WebRTC-FooFeature/Enable/"
           " will assign the group Enable to field trial WebRTC-FooFeature.");
 
+// Messages start with the time they were handed to the data channel, which
+// lets the receiver measure their latency.
+constexpr size_t kSendTimeSize = sizeof(int64_t);
+
+int64_t NowUs() {
+  return webrtc::Clock::GetRealTimeClock()->CurrentTime().us();
+}
+
 struct SetupMessage {
   size_t packet_size;
   size_t transfer_size;
@@ -103,10 +131,7 @@ class DataChannelServerObserverImpl : public webrtc::DataChannelObserver {
     remaining_data_ -= sent_data_size;
     // Allow the transport buffer to be drained before starting again.
     if (buffer_ && dc_->buffered_amount() <= ok_to_resume_sending_threshold_) {
-      total_queued_up_ += buffer_->size();
-      dc_->SendAsync(*buffer_, [this, buffer = buffer_](webrtc::RTCError err) {
-        OnSendAsyncComplete(err, buffer);
-      });
+      SendBuffer(buffer_);
       buffer_ = nullptr;
     }
   }
@@ -124,16 +149,23 @@ class DataChannelServerObserverImpl : public webrtc::DataChannelObserver {
     std::string data(std::min(setup_.packet_size, remaining_data_), '0');
     webrtc::DataBuffer* data_buffer =
         new webrtc::DataBuffer(rtc::CopyOnWriteBuffer(data), true);
-    total_queued_up_ = data_buffer->size();
-    dc_->SendAsync(*data_buffer,
-                   [this, data_buffer = data_buffer](webrtc::RTCError err) {
-                     OnSendAsyncComplete(err, data_buffer);
-                   });
+    total_queued_up_ = 0;
+    SendBuffer(data_buffer);
   }
 
   const struct SetupMessage& parameters() const { return setup_; }
 
  private:
+  void SendBuffer(webrtc::DataBuffer* buffer) {
+    if (buffer->size() >= kSendTimeSize) {
+      rtc::SetBE64(buffer->data.MutableData(), NowUs());
+    }
+    total_queued_up_ += buffer->size();
+    dc_->SendAsync(*buffer, [this, buffer = buffer](webrtc::RTCError err) {
+      OnSendAsyncComplete(err, buffer);
+    });
+  }
+
   void OnSendAsyncComplete(webrtc::RTCError error, webrtc::DataBuffer* buffer) {
     total_queued_up_ -= buffer->size();
     if (!error.ok()) {
@@ -160,10 +192,7 @@ class DataChannelServerObserverImpl : public webrtc::DataChannelObserver {
         buffer->data.SetSize(remaining_data);
       }
 
-      total_queued_up_ += buffer->size();
-      dc_->SendAsync(*buffer, [this, buffer = buffer](webrtc::RTCError err) {
-        OnSendAsyncComplete(err, buffer);
-      });
+      SendBuffer(buffer);
     });
   }
 
@@ -197,6 +226,9 @@ class DataChannelClientObserverImpl : public webrtc::DataChannelObserver {
   }
 
   void OnMessage(const webrtc::DataBuffer& buffer) override {
+    if (buffer.size() >= kSendTimeSize) {
+      latencies_us_.push_back(NowUs() - rtc::GetBE64(buffer.data.cdata()));
+    }
     bytes_received_ += buffer.data.size();
     if (bytes_received_ >= bytes_received_threshold_) {
       bytes_received_event_.Set();
@@ -213,12 +245,28 @@ class DataChannelClientObserverImpl : public webrtc::DataChannelObserver {
     return bytes_received_event_.Wait(rtc::Event::kForever);
   }
 
+  // Returns the latency of the `percentile` fraction of the received
+  // messages, in milliseconds. Must only be called once all data has been
+  // received.
+  double LatencyPercentileMs(double percentile) {
+    if (latencies_us_.empty()) {
+      return 0;
+    }
+    size_t index = std::min(
+        latencies_us_.size() - 1,
+        static_cast<size_t>(percentile * latencies_us_.size()));
+    std::nth_element(latencies_us_.begin(), latencies_us_.begin() + index,
+                     latencies_us_.end());
+    return latencies_us_[index] / 1000.;
+  }
+
  private:
   webrtc::DataChannelInterface* const dc_;
   rtc::Event open_event_;
   rtc::Event bytes_received_event_;
   const uint64_t bytes_received_threshold_;
   uint64_t bytes_received_ = 0u;
+  std::vector<int64_t> latencies_us_;
 };
 
 int RunServer() {
@@ -241,8 +289,17 @@ int RunServer() {
           auto peer_connection = client.peerConnection();
 
           // Set up the data channel
+          webrtc::DataChannelInit init;
+          init.ordered = absl::GetFlag(FLAGS_ordered);
+          if (absl::GetFlag(FLAGS_max_retransmits) >= 0) {
+            init.maxRetransmits = absl::GetFlag(FLAGS_max_retransmits);
+          }
+          if (absl::GetFlag(FLAGS_max_packet_life_time_ms) >= 0) {
+            init.maxRetransmitTime =
+                absl::GetFlag(FLAGS_max_packet_life_time_ms);
+          }
           auto dc_or_error =
-              peer_connection->CreateDataChannelOrError("benchmark", nullptr);
+              peer_connection->CreateDataChannelOrError("benchmark", &init);
           RTC_CHECK(dc_or_error.ok());
           auto data_channel = dc_or_error.MoveValue();
           auto data_channel_observer =
@@ -263,6 +320,7 @@ int RunServer() {
           absl::SleepFor(absl::Seconds(1));
 
           auto begin_time = webrtc::Clock::GetRealTimeClock()->CurrentTime();
+          std::clock_t begin_cpu_time = std::clock();
 
           data_channel_observer->StartSending();
 
@@ -271,12 +329,16 @@ int RunServer() {
           data_channel_observer->WaitForClosedState();
 
           auto end_time = webrtc::Clock::GetRealTimeClock()->CurrentTime();
+          std::clock_t end_cpu_time = std::clock();
           auto duration_ms = (end_time - begin_time).ms<size_t>();
-          double throughput =
-              (data_channel_observer->parameters().transfer_size / 1024. /
-               1024.) /
-              (duration_ms / 1000.);
+          double transfer_size_mib =
+              data_channel_observer->parameters().transfer_size / 1024. / 1024.;
+          double throughput = transfer_size_mib / (duration_ms / 1000.);
+          double cpu_time_ms =
+              1000. * (end_cpu_time - begin_cpu_time) / CLOCKS_PER_SEC;
           printf("Elapsed time: %zums %gMiB/s\n", duration_ms, throughput);
+          printf("CPU time: %gms %gms/MiB\n", cpu_time_ms,
+                 cpu_time_ms / transfer_size_mib);
         },
         port, oneshot);
     grpc_server->Start();
@@ -346,6 +408,8 @@ int RunClient() {
 
     // Wait until we have received all the data
     observer->WaitForBytesReceivedThreshold();
+    printf("Latency p50: %gms p99: %gms\n", observer->LatencyPercentileMs(0.5),
+           observer->LatencyPercentileMs(0.99));
 
     // Close the data channel, signaling to the server we have received
     // all the requested data.
@@ -30,6 +30,7 @@
 #include "rtc_tools/frame_analyzer/video_temporal_aligner.h"
 #include "rtc_tools/video_file_reader.h"
 #include "rtc_tools/video_file_writer.h"
+#include "system_wrappers/include/cpu_info.h"
 
 ABSL_FLAG(int32_t, width, -1, "The width of the reference and test files");
 ABSL_FLAG(int32_t, height, -1, "The height of the reference and test files");
@@ -55,6 +56,11 @@ ABSL_FLAG(std::string,
           "",
           "Where to write aligned YUV ref+test output files, if not present, "
           "no files will be written");
+ABSL_FLAG(int,
+          num_threads,
+          0,
+          "The number of threads computing PSNR and SSIM, or 0 for one per "
+          "CPU core");
 ABSL_FLAG(std::string,
           chartjson_result_file,
           "",
@@ -150,8 +156,14 @@ int main(int argc, char* argv[]) {
   const rtc::scoped_refptr<webrtc::test::Video> color_adjusted_test_video =
       AdjustColors(color_transformation, test_video);
 
-  results.frames = webrtc::test::RunAnalysis(
-      aligned_reference_video, color_adjusted_test_video, matching_indices);
+  const int num_threads =
+      absl::GetFlag(FLAGS_num_threads) > 0
+          ? absl::GetFlag(FLAGS_num_threads)
+          : static_cast<int>(webrtc::CpuInfo::DetectNumberOfCores());
+  results.frames =
+      webrtc::test::RunAnalysis(aligned_reference_video,
+                                color_adjusted_test_video, matching_indices,
+                                num_threads);
 
   const std::vector<webrtc::test::Cluster> clusters =
       webrtc::test::CalculateFrameClusters(matching_indices);
@@ -13,11 +13,13 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <vector>
 
 #include "api/numerics/samples_stats_counter.h"
 #include "api/test/metrics/metric.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/logging.h"
+#include "rtc_base/platform_thread.h"
 #include "third_party/libyuv/include/libyuv/compare.h"
 
 namespace webrtc {
@@ -57,20 +59,51 @@ double Ssim(const rtc::scoped_refptr<I420BufferInterface>& ref_buffer,
 std::vector<AnalysisResult> RunAnalysis(
     const rtc::scoped_refptr<webrtc::test::Video>& reference_video,
     const rtc::scoped_refptr<webrtc::test::Video>& test_video,
-    const std::vector<size_t>& test_frame_indices) {
-  std::vector<AnalysisResult> results;
-  for (size_t i = 0; i < test_video->number_of_frames(); ++i) {
-    const rtc::scoped_refptr<I420BufferInterface>& test_frame =
-        test_video->GetFrame(i);
-    const rtc::scoped_refptr<I420BufferInterface>& reference_frame =
-        reference_video->GetFrame(i);
-
-    // Fill in the result struct.
-    AnalysisResult result;
-    result.frame_number = test_frame_indices[i];
-    result.psnr_value = Psnr(reference_frame, test_frame);
-    result.ssim_value = Ssim(reference_frame, test_frame);
-    results.push_back(result);
+    const std::vector<size_t>& test_frame_indices,
+    int num_threads) {
+  RTC_CHECK_GE(num_threads, 1);
+  RTC_CHECK_LE(test_frame_indices.size(), test_video->number_of_frames());
+  const size_t num_frames = test_frame_indices.size();
+  std::vector<AnalysisResult> results(num_frames);
+
+  // The videos may not support concurrent access, e.g. when they are read from
+  // files, so the frames are read on this thread in batches and the metrics of
+  // each batch are computed in parallel.
+  const size_t batch_size = 2 * num_threads;
+  std::vector<rtc::scoped_refptr<I420BufferInterface>> reference_frames;
+  std::vector<rtc::scoped_refptr<I420BufferInterface>> test_frames;
+  for (size_t batch_start = 0; batch_start < num_frames;
+       batch_start += batch_size) {
+    const size_t batch_end = std::min(num_frames, batch_start + batch_size);
+    reference_frames.clear();
+    test_frames.clear();
+    for (size_t i = batch_start; i < batch_end; ++i) {
+      reference_frames.push_back(reference_video->GetFrame(i));
+      test_frames.push_back(test_video->GetFrame(i));
+    }
+
+    auto analyze_frames = [&](int thread_index) {
+      for (size_t i = batch_start + thread_index; i < batch_end;
+           i += num_threads) {
+        // Fill in the result struct.
+        AnalysisResult& result = results[i];
+        result.frame_number = test_frame_indices[i];
+        result.psnr_value = Psnr(reference_frames[i - batch_start],
+                                 test_frames[i - batch_start]);
+        result.ssim_value = Ssim(reference_frames[i - batch_start],
+                                 test_frames[i - batch_start]);
+      }
+    };
+    std::vector<rtc::PlatformThread> threads;
+    threads.reserve(num_threads - 1);
+    for (int thread_index = 1; thread_index < num_threads; ++thread_index) {
+      threads.push_back(rtc::PlatformThread::SpawnJoinable(
+          [&analyze_frames, thread_index] { analyze_frames(thread_index); },
+          "RunAnalysis"));
+    }
+    analyze_frames(/*thread_index=*/0);
+    // Joins the threads.
+    threads.clear();
   }
 
   return results;
@@ -14,6 +14,8 @@
 
 #include "api/test/metrics/metric.h"
 #include "api/test/metrics/metrics_logger.h"
+#include "rtc_tools/frame_analyzer/video_temporal_aligner.h"
+#include "rtc_tools/video_file_reader.h"
 #include "system_wrappers/include/clock.h"
 #include "test/gmock.h"
 #include "test/gtest.h"
@@ -61,6 +63,33 @@ std::vector<MetricValidationInfo> ToValidationInfo(
   return out;
 }
 
+TEST(VideoQualityAnalysisTest, RunAnalysisIsIndependentOfThreadCount) {
+  rtc::scoped_refptr<Video> reference_video =
+      OpenYuvFile(ResourcePath("foreman_128x96", "yuv"), 128, 96);
+  ASSERT_TRUE(reference_video);
+  // Compare the video with itself shifted by one frame, over a number of
+  // frames which isn't a multiple of the batch sizes.
+  std::vector<size_t> indices;
+  for (size_t i = 1; i < 12; ++i)
+    indices.push_back(i);
+  rtc::scoped_refptr<Video> test_video =
+      ReorderVideo(reference_video, indices);
+
+  const std::vector<AnalysisResult> results =
+      RunAnalysis(reference_video, test_video, indices, /*num_threads=*/1);
+  ASSERT_EQ(indices.size(), results.size());
+  for (int num_threads : {2, 3, 8}) {
+    const std::vector<AnalysisResult> parallel_results =
+        RunAnalysis(reference_video, test_video, indices, num_threads);
+    ASSERT_EQ(results.size(), parallel_results.size());
+    for (size_t i = 0; i < results.size(); ++i) {
+      EXPECT_EQ(results[i].frame_number, parallel_results[i].frame_number);
+      EXPECT_EQ(results[i].psnr_value, parallel_results[i].psnr_value);
+      EXPECT_EQ(results[i].ssim_value, parallel_results[i].ssim_value);
+    }
+  }
+}
+
 TEST(VideoQualityAnalysisTest, PrintAnalysisResultsEmpty) {
   ResultsContainer result;
   DefaultMetricsLogger logger(Clock::GetRealTimeClock());
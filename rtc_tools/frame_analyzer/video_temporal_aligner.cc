@@ -167,13 +167,18 @@ size_t FindBestMatch(const rtc::scoped_refptr<I420BufferInterface>& test_frame,
 size_t FindNextMatch(const rtc::scoped_refptr<I420BufferInterface>& test_frame,
                      const Video& reference_video,
                      size_t start_index) {
-  const double start_ssim =
-      Ssim(test_frame, reference_video.GetFrame(start_index));
+  double start_ssim = Ssim(test_frame, reference_video.GetFrame(start_index));
   for (int i = 1; i < kNumberOfFramesLookAhead; ++i) {
     const size_t next_index = start_index + i;
-    // If we find a better match, restart the search at that point.
-    if (start_ssim < Ssim(test_frame, reference_video.GetFrame(next_index)))
-      return FindNextMatch(test_frame, reference_video, next_index);
+    const double next_ssim =
+        Ssim(test_frame, reference_video.GetFrame(next_index));
+    // If we find a better match, restart the search at that point, without
+    // computing its SSIM again.
+    if (start_ssim < next_ssim) {
+      start_index = next_index;
+      start_ssim = next_ssim;
+      i = 0;
+    }
   }
   // The starting index was the best match.
   return start_index;
@@ -12,7 +12,9 @@
 #include <stdlib.h>
 
 #include <algorithm>
+#include <numeric>
 #include <string>
+#include <vector>
 
 #include "absl/flags/flag.h"
 #include "absl/flags/parse.h"
@@ -21,6 +23,7 @@
 #include "api/video/video_frame_buffer.h"
 #include "rtc_tools/frame_analyzer/video_quality_analysis.h"
 #include "rtc_tools/video_file_reader.h"
+#include "system_wrappers/include/cpu_info.h"
 
 ABSL_FLAG(std::string,
           results_file,
@@ -34,26 +37,30 @@ ABSL_FLAG(std::string,
           test_file,
           "test.yuv",
           "The test YUV file to run the analysis for");
+ABSL_FLAG(int,
+          num_threads,
+          0,
+          "The number of threads computing PSNR and SSIM, or 0 for one per "
+          "CPU core");
 
 void CompareFiles(
     const rtc::scoped_refptr<webrtc::test::Video>& reference_video,
     const rtc::scoped_refptr<webrtc::test::Video>& test_video,
-    const char* results_file_name) {
+    const char* results_file_name,
+    int num_threads) {
   FILE* results_file = fopen(results_file_name, "w");
 
   const size_t num_frames = std::min(reference_video->number_of_frames(),
                                      test_video->number_of_frames());
-  for (size_t i = 0; i < num_frames; ++i) {
-    const rtc::scoped_refptr<webrtc::I420BufferInterface> ref_buffer =
-        reference_video->GetFrame(i);
-    const rtc::scoped_refptr<webrtc::I420BufferInterface> test_buffer =
-        test_video->GetFrame(i);
-
-    // Calculate the PSNR and SSIM.
-    double result_psnr = webrtc::test::Psnr(ref_buffer, test_buffer);
-    double result_ssim = webrtc::test::Ssim(ref_buffer, test_buffer);
-    fprintf(results_file, "Frame: %zu, PSNR: %f, SSIM: %f\n", i, result_psnr,
-            result_ssim);
+  std::vector<size_t> frame_indices(num_frames);
+  std::iota(frame_indices.begin(), frame_indices.end(), 0);
+  // Calculate the PSNR and SSIM.
+  const std::vector<webrtc::test::AnalysisResult> results =
+      webrtc::test::RunAnalysis(reference_video, test_video, frame_indices,
+                                num_threads);
+  for (const webrtc::test::AnalysisResult& result : results) {
+    fprintf(results_file, "Frame: %d, PSNR: %f, SSIM: %f\n",
+            result.frame_number, result.psnr_value, result.ssim_value);
   }
 
   fclose(results_file);
@@ -102,7 +109,11 @@ int main(int argc, char* argv[]) {
     return 0;
   }
 
+  const int num_threads =
+      absl::GetFlag(FLAGS_num_threads) > 0
+          ? absl::GetFlag(FLAGS_num_threads)
+          : static_cast<int>(webrtc::CpuInfo::DetectNumberOfCores());
   CompareFiles(reference_video, test_video,
-               absl::GetFlag(FLAGS_results_file).c_str());
+               absl::GetFlag(FLAGS_results_file).c_str(), num_threads);
   return 0;
 }
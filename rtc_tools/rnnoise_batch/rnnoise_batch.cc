@@ -0,0 +1,229 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+// Denoises WAV files with the noise suppression of the audio processing
+// module, processing several files in parallel, and reports the processing
+// speed as a realtime factor.
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "absl/flags/flag.h"
+#include "absl/flags/parse.h"
+#include "absl/strings/string_view.h"
+#include "common_audio/wav_file.h"
+#include "modules/audio_processing/include/audio_processing.h"
+#include "rtc_base/platform_thread.h"
+#include "rtc_base/system/file_wrapper.h"
+#include "rtc_base/time_utils.h"
+
+ABSL_FLAG(std::string,
+          output_dir,
+          "",
+          "Directory where the denoised files are written, with the names of "
+          "the input files. Required.");
+ABSL_FLAG(int,
+          num_threads,
+          0,
+          "Number of files processed in parallel, 0 for the number of cores.");
+ABSL_FLAG(int,
+          level,
+          1,
+          "Noise suppression level: 0 (low), 1 (moderate), 2 (high) or 3 "
+          "(very high).");
+ABSL_FLAG(bool,
+          rnnoise_full_band,
+          false,
+          "Run RNNoise on the full band at 48 kHz.");
+ABSL_FLAG(bool,
+          rnnoise_hybrid,
+          false,
+          "Fuse the RNNoise gains into the classic noise suppression filter.");
+ABSL_FLAG(bool,
+          rnnoise_low_delay,
+          false,
+          "Use the low-delay RNNoise synthesis.");
+ABSL_FLAG(std::string,
+          rnnoise_model,
+          "",
+          "RNNoise model file to use instead of the built-in model.");
+
+namespace webrtc {
+namespace {
+
+constexpr char kUsage[] =
+    "Denoises WAV files with the noise suppression of APM.\n"
+    "Example usage:\n"
+    "  %s --output_dir=out/ --num_threads=8 meeting1.wav meeting2.wav\n";
+
+struct FileResult {
+  bool ok = false;
+  double audio_duration_s = 0.0;
+  double processing_time_s = 0.0;
+};
+
+// Returns the last component of `path`.
+absl::string_view BaseName(absl::string_view path) {
+  const size_t separator = path.find_last_of("/\\");
+  return separator == absl::string_view::npos ? path
+                                              : path.substr(separator + 1);
+}
+
+AudioProcessing::Config CreateConfig() {
+  AudioProcessing::Config config;
+  config.pipeline.multi_channel_capture = true;
+  config.noise_suppression.enabled = true;
+  config.noise_suppression.level =
+      static_cast<AudioProcessing::Config::NoiseSuppression::Level>(
+          absl::GetFlag(FLAGS_level));
+  config.noise_suppression.rnnoise_full_band =
+      absl::GetFlag(FLAGS_rnnoise_full_band);
+  config.noise_suppression.rnnoise_hybrid = absl::GetFlag(FLAGS_rnnoise_hybrid);
+  config.noise_suppression.rnnoise_low_delay =
+      absl::GetFlag(FLAGS_rnnoise_low_delay);
+  return config;
+}
+
+// Denoises `input_path` into `output_path` with an APM instance of its own,
+// reading and writing the files 10 ms at a time.
+FileResult ProcessFile(const std::string& input_path,
+                       const std::string& output_path,
+                       const AudioProcessing::Config& config) {
+  FileResult result;
+  FileWrapper input_file = FileWrapper::OpenReadOnly(input_path);
+  if (!input_file.is_open()) {
+    fprintf(stderr, "Cannot open %s\n", input_path.c_str());
+    return result;
+  }
+  FileWrapper output_file = FileWrapper::OpenWriteOnly(output_path);
+  if (!output_file.is_open()) {
+    fprintf(stderr, "Cannot create %s\n", output_path.c_str());
+    return result;
+  }
+  WavReader reader(std::move(input_file));
+  WavWriter writer(std::move(output_file), reader.sample_rate(),
+                   reader.num_channels());
+
+  rtc::scoped_refptr<AudioProcessing> apm =
+      AudioProcessingBuilder()
+          .SetConfig(config)
+          .SetRnnoiseModelPath(absl::GetFlag(FLAGS_rnnoise_model))
+          .Create();
+  const StreamConfig stream_config(reader.sample_rate(), reader.num_channels());
+  std::vector<int16_t> frame(stream_config.num_samples());
+
+  const int64_t start_ns = rtc::TimeNanos();
+  size_t num_samples_read;
+  do {
+    num_samples_read = reader.ReadSamples(frame.size(), frame.data());
+    if (num_samples_read == 0) {
+      break;
+    }
+    // The last frame is padded with silence.
+    std::fill(frame.begin() + num_samples_read, frame.end(), 0);
+    if (apm->ProcessStream(frame.data(), stream_config, stream_config,
+                           frame.data()) != AudioProcessing::kNoError) {
+      fprintf(stderr, "Processing error in %s\n", input_path.c_str());
+      return result;
+    }
+    writer.WriteSamples(frame.data(), num_samples_read);
+  } while (num_samples_read == frame.size());
+
+  result.ok = true;
+  result.processing_time_s =
+      static_cast<double>(rtc::TimeNanos() - start_ns) /
+      rtc::kNumNanosecsPerSec;
+  result.audio_duration_s =
+      static_cast<double>(reader.num_samples()) /
+      (reader.sample_rate() * reader.num_channels());
+  return result;
+}
+
+int RunBatch(int argc, char* argv[]) {
+  std::vector<char*> args = absl::ParseCommandLine(argc, argv);
+  const std::string output_dir = absl::GetFlag(FLAGS_output_dir);
+  const int level = absl::GetFlag(FLAGS_level);
+  if (args.size() < 2 || output_dir.empty() || level < 0 || level > 3) {
+    fprintf(stderr, kUsage, args[0]);
+    return 1;
+  }
+  const std::vector<std::string> input_paths(args.begin() + 1, args.end());
+  int num_threads = absl::GetFlag(FLAGS_num_threads);
+  if (num_threads <= 0) {
+    num_threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  num_threads = std::min(num_threads, static_cast<int>(input_paths.size()));
+
+  const AudioProcessing::Config config = CreateConfig();
+  std::vector<FileResult> results(input_paths.size());
+  std::atomic<size_t> next_file(0);
+  const int64_t start_ns = rtc::TimeNanos();
+  {
+    // Each worker takes the next unprocessed file until all are processed.
+    std::vector<rtc::PlatformThread> workers;
+    for (int i = 0; i < num_threads; ++i) {
+      workers.push_back(rtc::PlatformThread::SpawnJoinable(
+          [&] {
+            for (size_t file = next_file++; file < input_paths.size();
+                 file = next_file++) {
+              results[file] = ProcessFile(
+                  input_paths[file],
+                  output_dir + "/" + std::string(BaseName(input_paths[file])),
+                  config);
+            }
+          },
+          "rnnoise_batch"));
+    }
+    // The workers are joined when they go out of scope.
+  }
+  const double wall_time_s = static_cast<double>(rtc::TimeNanos() - start_ns) /
+                             rtc::kNumNanosecsPerSec;
+
+  // The realtime factor is the processing time over the audio duration.
+  double total_audio_duration_s = 0.0;
+  int num_failed_files = 0;
+  for (size_t file = 0; file < input_paths.size(); ++file) {
+    const FileResult& result = results[file];
+    if (!result.ok) {
+      ++num_failed_files;
+      continue;
+    }
+    total_audio_duration_s += result.audio_duration_s;
+    printf("%s: %.1f s of audio, realtime factor %.4f\n",
+           input_paths[file].c_str(), result.audio_duration_s,
+           result.audio_duration_s > 0.0
+               ? result.processing_time_s / result.audio_duration_s
+               : 0.0);
+  }
+  printf("Processed %.1f s of audio in %.1f s with %d threads: realtime "
+         "factor %.4f, %.1fx realtime.\n",
+         total_audio_duration_s, wall_time_s, num_threads,
+         total_audio_duration_s > 0.0 ? wall_time_s / total_audio_duration_s
+                                      : 0.0,
+         wall_time_s > 0.0 ? total_audio_duration_s / wall_time_s : 0.0);
+  if (num_failed_files > 0) {
+    fprintf(stderr, "%d files failed.\n", num_failed_files);
+    return 1;
+  }
+  return 0;
+}
+
+}  // namespace
+}  // namespace webrtc
+
+int main(int argc, char* argv[]) {
+  return webrtc::RunBatch(argc, argv);
+}
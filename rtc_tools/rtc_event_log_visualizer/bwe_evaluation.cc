@@ -0,0 +1,192 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#include "rtc_tools/rtc_event_log_visualizer/bwe_evaluation.h"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "api/numerics/samples_stats_counter.h"
+#include "api/transport/goog_cc_factory.h"
+#include "api/units/data_size.h"
+#include "api/units/timestamp.h"
+#include "rtc_base/strings/string_builder.h"
+#include "rtc_tools/rtc_event_log_visualizer/log_simulation.h"
+
+namespace webrtc {
+namespace {
+
+void AddFeedbackMetrics(const ParsedRtcEventLog& parsed_log,
+                        BweEvaluationResult& result) {
+  std::vector<LoggedPacketInfo> packets = parsed_log.GetOutgoingPacketInfos();
+  TimeDelta min_delay = TimeDelta::PlusInfinity();
+  for (const LoggedPacketInfo& packet : packets) {
+    if (packet.reported_recv_time.IsFinite()) {
+      min_delay = std::min(min_delay,
+                           packet.reported_recv_time - packet.log_packet_time);
+    }
+  }
+
+  int num_received = 0;
+  int num_lost = 0;
+  DataSize received_size = DataSize::Zero();
+  Timestamp first_send_time = Timestamp::PlusInfinity();
+  Timestamp last_send_time = Timestamp::MinusInfinity();
+  SamplesStatsCounter queuing_delay_ms;
+  for (const LoggedPacketInfo& packet : packets) {
+    // Packets without feedback, e.g. from streams without transport sequence
+    // numbers, are neither received nor lost.
+    if (packet.reported_recv_time.IsMinusInfinity()) {
+      continue;
+    }
+    if (packet.reported_recv_time.IsPlusInfinity()) {
+      ++num_lost;
+      continue;
+    }
+    ++num_received;
+    received_size += DataSize::Bytes(packet.size);
+    first_send_time = std::min(first_send_time, packet.log_packet_time);
+    last_send_time = std::max(last_send_time, packet.log_packet_time);
+    TimeDelta delay = packet.reported_recv_time - packet.log_packet_time;
+    queuing_delay_ms.AddSample((delay - min_delay).ms<double>());
+  }
+
+  if (num_received + num_lost > 0) {
+    result.loss_ratio =
+        static_cast<double>(num_lost) / (num_received + num_lost);
+  }
+  if (last_send_time > first_send_time) {
+    result.acknowledged_rate =
+        received_size / (last_send_time - first_send_time);
+  }
+  if (!queuing_delay_ms.IsEmpty()) {
+    result.mean_queuing_delay =
+        TimeDelta::Micros(1000 * queuing_delay_ms.GetAverage());
+    result.p95_queuing_delay =
+        TimeDelta::Micros(1000 * queuing_delay_ms.GetPercentile(0.95));
+  }
+}
+
+void AppendDistribution(absl::string_view name,
+                        SamplesStatsCounter& samples,
+                        rtc::StringBuilder& sb) {
+  sb << name;
+  if (samples.IsEmpty()) {
+    sb << " no samples\n";
+    return;
+  }
+  sb << " mean=" << samples.GetAverage()
+     << " p5=" << samples.GetPercentile(0.05)
+     << " p50=" << samples.GetPercentile(0.5)
+     << " p95=" << samples.GetPercentile(0.95) << "\n";
+}
+
+}  // namespace
+
+std::string BweEvaluationResult::ToString() const {
+  rtc::StringBuilder sb;
+  sb << "simulated_duration_s=" << simulated_duration.seconds<double>()
+     << " mean_target_rate_kbps=" << mean_target_rate.kbps<double>()
+     << " min_target_rate_kbps="
+     << (min_target_rate.IsFinite() ? min_target_rate.kbps<double>() : 0.0)
+     << " max_target_rate_kbps=" << max_target_rate.kbps<double>()
+     << " acknowledged_rate_kbps=" << acknowledged_rate.kbps<double>()
+     << " mean_queuing_delay_ms=" << mean_queuing_delay.ms<double>()
+     << " p95_queuing_delay_ms=" << p95_queuing_delay.ms<double>()
+     << " loss_ratio=" << loss_ratio;
+  return sb.Release();
+}
+
+BweEvaluationResult EvaluateBweOnLog(
+    const ParsedRtcEventLog& parsed_log,
+    NetworkStatePredictorFactoryInterface* predictor_factory) {
+  BweEvaluationResult result;
+  Timestamp first_update_time = Timestamp::PlusInfinity();
+  Timestamp last_update_time = Timestamp::PlusInfinity();
+  DataRate last_target_rate = DataRate::Zero();
+  // Integral of the target rate over time, to get a time weighted mean.
+  DataSize target_rate_integral = DataSize::Zero();
+
+  GoogCcFactoryConfig config;
+  config.network_state_predictor_factory = predictor_factory;
+  LogBasedNetworkControllerSimulation simulation(
+      std::make_unique<GoogCcNetworkControllerFactory>(std::move(config)),
+      [&](const NetworkControlUpdate& update, Timestamp at_time) {
+        if (!update.target_rate) {
+          return;
+        }
+        if (last_update_time.IsFinite()) {
+          target_rate_integral +=
+              last_target_rate * (at_time - last_update_time);
+        } else {
+          first_update_time = at_time;
+        }
+        last_update_time = at_time;
+        last_target_rate = update.target_rate->target_rate;
+        result.min_target_rate =
+            std::min(result.min_target_rate, last_target_rate);
+        result.max_target_rate =
+            std::max(result.max_target_rate, last_target_rate);
+      });
+  simulation.ProcessEventsInLog(parsed_log);
+
+  if (last_update_time.IsFinite()) {
+    Timestamp end_time =
+        std::max(parsed_log.last_timestamp(), last_update_time);
+    target_rate_integral += last_target_rate * (end_time - last_update_time);
+    result.simulated_duration = end_time - first_update_time;
+    result.mean_target_rate = result.simulated_duration.IsZero()
+                                  ? last_target_rate
+                                  : target_rate_integral /
+                                        result.simulated_duration;
+  }
+  AddFeedbackMetrics(parsed_log, result);
+  return result;
+}
+
+std::string SummarizeBweEvaluationResults(
+    rtc::ArrayView<const BweEvaluationResult> results) {
+  SamplesStatsCounter mean_target_rate_kbps;
+  SamplesStatsCounter min_target_rate_kbps;
+  SamplesStatsCounter max_target_rate_kbps;
+  SamplesStatsCounter acknowledged_rate_kbps;
+  SamplesStatsCounter mean_queuing_delay_ms;
+  SamplesStatsCounter p95_queuing_delay_ms;
+  SamplesStatsCounter loss_ratio;
+  for (const BweEvaluationResult& result : results) {
+    // Logs that never produced a target rate, e.g. without any outgoing
+    // video, would only skew the target rate distributions.
+    if (result.min_target_rate.IsFinite()) {
+      mean_target_rate_kbps.AddSample(result.mean_target_rate.kbps<double>());
+      min_target_rate_kbps.AddSample(result.min_target_rate.kbps<double>());
+      max_target_rate_kbps.AddSample(result.max_target_rate.kbps<double>());
+    }
+    acknowledged_rate_kbps.AddSample(result.acknowledged_rate.kbps<double>());
+    mean_queuing_delay_ms.AddSample(result.mean_queuing_delay.ms<double>());
+    p95_queuing_delay_ms.AddSample(result.p95_queuing_delay.ms<double>());
+    loss_ratio.AddSample(result.loss_ratio);
+  }
+
+  rtc::StringBuilder sb;
+  sb << "logs=" << results.size()
+     << " with_target_rate=" << mean_target_rate_kbps.NumSamples() << "\n";
+  AppendDistribution("mean_target_rate_kbps", mean_target_rate_kbps, sb);
+  AppendDistribution("min_target_rate_kbps", min_target_rate_kbps, sb);
+  AppendDistribution("max_target_rate_kbps", max_target_rate_kbps, sb);
+  AppendDistribution("acknowledged_rate_kbps", acknowledged_rate_kbps, sb);
+  AppendDistribution("mean_queuing_delay_ms", mean_queuing_delay_ms, sb);
+  AppendDistribution("p95_queuing_delay_ms", p95_queuing_delay_ms, sb);
+  AppendDistribution("loss_ratio", loss_ratio, sb);
+  return sb.Release();
+}
+
+}  // namespace webrtc
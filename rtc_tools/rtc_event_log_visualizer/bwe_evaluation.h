@@ -0,0 +1,61 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#ifndef RTC_TOOLS_RTC_EVENT_LOG_VISUALIZER_BWE_EVALUATION_H_
+#define RTC_TOOLS_RTC_EVENT_LOG_VISUALIZER_BWE_EVALUATION_H_
+
+#include <string>
+
+#include "api/array_view.h"
+#include "api/network_state_predictor.h"
+#include "api/units/data_rate.h"
+#include "api/units/time_delta.h"
+#include "logging/rtc_event_log/rtc_event_log_parser.h"
+
+namespace webrtc {
+
+struct BweEvaluationResult {
+  // Metrics of the simulated estimate, from the first target rate to the end
+  // of the log.
+  TimeDelta simulated_duration = TimeDelta::Zero();
+  DataRate mean_target_rate = DataRate::Zero();
+  DataRate min_target_rate = DataRate::PlusInfinity();
+  DataRate max_target_rate = DataRate::Zero();
+
+  // Metrics of the recorded session, from the transport feedback in the log.
+  // The network in the log does not react to the simulated estimate, so these
+  // are the same for every predictor. They tell how much the simulated
+  // estimate can be trusted to be reachable, e.g. a mean target rate well
+  // above the acknowledged rate of a session with high queuing delay or loss
+  // means that the estimate overshoots.
+  DataRate acknowledged_rate = DataRate::Zero();
+  // The one-way delay of received packets above the lowest one in the log.
+  TimeDelta mean_queuing_delay = TimeDelta::Zero();
+  TimeDelta p95_queuing_delay = TimeDelta::Zero();
+  double loss_ratio = 0.0;
+
+  std::string ToString() const;
+};
+
+// Replays the outgoing packets and transport feedback of `parsed_log` through
+// a GoogCcNetworkController, which uses a predictor from
+// `predictor_factory` if it is not null. That allows network state predictors
+// to be compared offline on recorded traffic, before shipping them.
+BweEvaluationResult EvaluateBweOnLog(
+    const ParsedRtcEventLog& parsed_log,
+    NetworkStatePredictorFactoryInterface* predictor_factory);
+
+// Returns the distributions of the metrics over `results`, one line per
+// metric, e.g. to compare two versions of GoogCC on the same set of logs.
+std::string SummarizeBweEvaluationResults(
+    rtc::ArrayView<const BweEvaluationResult> results);
+
+}  // namespace webrtc
+
+#endif  // RTC_TOOLS_RTC_EVENT_LOG_VISUALIZER_BWE_EVALUATION_H_
@@ -0,0 +1,134 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "absl/flags/flag.h"
+#include "absl/flags/parse.h"
+#include "absl/flags/usage.h"
+#include "absl/types/optional.h"
+#include "logging/rtc_event_log/rtc_event_log_parser.h"
+#include "rtc_base/logging.h"
+#include "rtc_base/platform_thread.h"
+#include "rtc_tools/rtc_event_log_visualizer/bwe_evaluation.h"
+#include "system_wrappers/include/cpu_info.h"
+#include "system_wrappers/include/field_trial.h"
+
+ABSL_FLAG(
+    std::string,
+    force_fieldtrials,
+    "",
+    "Field trials control experimental feature code which can be forced. "
+    "E.g. running with --force_fieldtrials=WebRTC-FooFeature/Enabled/"
+    " will assign the group Enabled to field trial WebRTC-FooFeature. Multiple "
+    "trials are separated by \"/\"");
+ABSL_FLAG(int,
+          num_threads,
+          0,
+          "Number of logs to evaluate in parallel. Defaults to the number of "
+          "cores.");
+ABSL_FLAG(bool,
+          print_each_log,
+          true,
+          "Print the metrics of each log, and not only their distributions.");
+
+namespace {
+
+absl::optional<webrtc::BweEvaluationResult> EvaluateFile(
+    const std::string& filename) {
+  webrtc::ParsedRtcEventLog parsed_log(
+      webrtc::ParsedRtcEventLog::UnconfiguredHeaderExtensions::
+          kAttemptWebrtcDefaultConfig,
+      /*allow_incomplete_logs*/ true);
+  auto status = parsed_log.ParseFile(filename);
+  if (!status.ok()) {
+    RTC_LOG(LS_ERROR) << "Failed to parse " << filename << ": "
+                      << status.message();
+    return absl::nullopt;
+  }
+  return webrtc::EvaluateBweOnLog(parsed_log, /*predictor_factory=*/nullptr);
+}
+
+}  // namespace
+
+// Replays RTC event logs through GoogCC and prints the metrics of the
+// simulated estimate for each log, followed by their distributions over all
+// logs. Network state predictors are evaluated by passing their factory to
+// webrtc::EvaluateBweOnLog() instead.
+int main(int argc, char* argv[]) {
+  absl::SetProgramUsageMessage(
+      "A tool for evaluating the bandwidth estimate of GoogCC on recorded\n"
+      "WebRTC event logs. The logs are replayed in parallel, as fast as\n"
+      "possible.\n"
+      "\n"
+      "Example usage:\n"
+      "./event_log_bwe_evaluation <inputfile> [<inputfile> ...]\n");
+  std::vector<char*> args = absl::ParseCommandLine(argc, argv);
+  if (args.size() < 2) {
+    std::cerr << absl::ProgramUsageMessage();
+    return 1;
+  }
+
+  // Print RTC_LOG warnings and errors even in release builds.
+  if (rtc::LogMessage::GetLogToDebug() > rtc::LS_WARNING) {
+    rtc::LogMessage::LogToDebug(rtc::LS_WARNING);
+  }
+  rtc::LogMessage::SetLogToStderr(true);
+
+  // InitFieldTrialsFromString stores the char*, so the char array must outlive
+  // the application.
+  const std::string field_trials = absl::GetFlag(FLAGS_force_fieldtrials);
+  webrtc::field_trial::InitFieldTrialsFromString(field_trials.c_str());
+
+  // The logs are replayed in log time, as fast as they can be processed, and
+  // independently of each other, so they are spread over the threads.
+  std::vector<std::string> filenames(args.begin() + 1, args.end());
+  std::vector<absl::optional<webrtc::BweEvaluationResult>> results(
+      filenames.size());
+  std::atomic<size_t> next_file(0);
+  int num_threads = absl::GetFlag(FLAGS_num_threads);
+  if (num_threads <= 0) {
+    num_threads = webrtc::CpuInfo::DetectNumberOfCores();
+  }
+  num_threads = std::min<int>(num_threads, filenames.size());
+  std::vector<rtc::PlatformThread> threads;
+  for (int i = 0; i < num_threads; ++i) {
+    threads.push_back(rtc::PlatformThread::SpawnJoinable(
+        [&] {
+          for (size_t file = next_file++; file < filenames.size();
+               file = next_file++) {
+            results[file] = EvaluateFile(filenames[file]);
+          }
+        },
+        "bwe_evaluation"));
+  }
+  for (rtc::PlatformThread& thread : threads) {
+    thread.Finalize();
+  }
+
+  bool success = true;
+  std::vector<webrtc::BweEvaluationResult> evaluated;
+  for (size_t i = 0; i < filenames.size(); ++i) {
+    if (!results[i]) {
+      success = false;
+      continue;
+    }
+    if (absl::GetFlag(FLAGS_print_each_log)) {
+      std::cout << filenames[i] << " " << results[i]->ToString() << std::endl;
+    }
+    evaluated.push_back(*results[i]);
+  }
+  std::cout << webrtc::SummarizeBweEvaluationResults(evaluated);
+  return success ? 0 : 1;
+}
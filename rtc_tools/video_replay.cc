@@ -18,6 +18,7 @@
 #include "absl/flags/parse.h"
 #include "api/field_trials.h"
 #include "api/media_types.h"
+#include "api/numerics/samples_stats_counter.h"
 #include "api/rtc_event_log/rtc_event_log.h"
 #include "api/task_queue/default_task_queue_factory.h"
 #include "api/test/video/function_video_decoder_factory.h"
@@ -25,6 +26,7 @@
 #include "api/units/timestamp.h"
 #include "api/video/video_codec_type.h"
 #include "api/video_codecs/video_decoder.h"
+#include "api/video_codecs/video_decoder_factory.h"
 #include "call/call.h"
 #include "common_video/libyuv/include/webrtc_libyuv.h"
 #include "media/engine/internal_decoder_factory.h"
@@ -34,8 +36,11 @@
 #include "modules/rtp_rtcp/source/rtp_util.h"
 #include "modules/video_coding/utility/ivf_file_writer.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/cpu_time.h"
 #include "rtc_base/string_to_number.h"
 #include "rtc_base/strings/json.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/system_time.h"
 #include "rtc_base/time_utils.h"
 #include "system_wrappers/include/clock.h"
 #include "system_wrappers/include/sleep.h"
@@ -163,6 +168,12 @@ ABSL_FLAG(bool, disable_preview, false, "Disable decoded video preview.");
 
 ABSL_FLAG(bool, disable_decoding, false, "Disable video decoding.");
 
+ABSL_FLAG(bool,
+          benchmark,
+          false,
+          "Replay the input as fast as possible in simulated time without "
+          "preview, and print decode speed and CPU usage when done.");
+
 ABSL_FLAG(int,
           extend_run_time_duration,
           0,
@@ -289,6 +300,96 @@ class DecoderIvfFileWriter : public test::FakeDecoder {
   VideoCodecType video_codec_type_;
 };
 
+// Collects the wall clock time spent in `VideoDecoder::Decode()` by all
+// decoders created by a `DecodeTimingFactory`. `rtc::SystemTimeNanos()` is
+// used since `rtc::TimeNanos()` follows the simulated clock.
+class DecodeTimes {
+ public:
+  void AddDecode(int64_t duration_ns) {
+    MutexLock lock(&mutex_);
+    total_ns_ += duration_ns;
+    decode_ms_.AddSample(duration_ns / 1e6);
+  }
+
+  int64_t total_ns() {
+    MutexLock lock(&mutex_);
+    return total_ns_;
+  }
+
+  SamplesStatsCounter decode_ms() {
+    MutexLock lock(&mutex_);
+    return decode_ms_;
+  }
+
+ private:
+  Mutex mutex_;
+  int64_t total_ns_ RTC_GUARDED_BY(mutex_) = 0;
+  SamplesStatsCounter decode_ms_ RTC_GUARDED_BY(mutex_);
+};
+
+class DecodeTimingDecoder : public VideoDecoder {
+ public:
+  DecodeTimingDecoder(std::unique_ptr<VideoDecoder> decoder,
+                      DecodeTimes* decode_times)
+      : decoder_(std::move(decoder)), decode_times_(decode_times) {}
+
+  bool Configure(const Settings& settings) override {
+    return decoder_->Configure(settings);
+  }
+
+  int32_t Decode(const EncodedImage& input_image,
+                 bool missing_frames,
+                 int64_t render_time_ms) override {
+    const int64_t start_ns = rtc::SystemTimeNanos();
+    const int32_t result =
+        decoder_->Decode(input_image, missing_frames, render_time_ms);
+    if (result == WEBRTC_VIDEO_CODEC_OK) {
+      decode_times_->AddDecode(rtc::SystemTimeNanos() - start_ns);
+    }
+    return result;
+  }
+
+  int32_t RegisterDecodeCompleteCallback(
+      DecodedImageCallback* callback) override {
+    return decoder_->RegisterDecodeCompleteCallback(callback);
+  }
+
+  int32_t Release() override { return decoder_->Release(); }
+
+  DecoderInfo GetDecoderInfo() const override {
+    return decoder_->GetDecoderInfo();
+  }
+
+ private:
+  const std::unique_ptr<VideoDecoder> decoder_;
+  DecodeTimes* const decode_times_;
+};
+
+class DecodeTimingFactory : public VideoDecoderFactory {
+ public:
+  DecodeTimingFactory(std::unique_ptr<VideoDecoderFactory> factory,
+                      DecodeTimes* decode_times)
+      : factory_(std::move(factory)), decode_times_(decode_times) {}
+
+  std::vector<SdpVideoFormat> GetSupportedFormats() const override {
+    return factory_->GetSupportedFormats();
+  }
+
+  std::unique_ptr<VideoDecoder> CreateVideoDecoder(
+      const SdpVideoFormat& format) override {
+    std::unique_ptr<VideoDecoder> decoder =
+        factory_->CreateVideoDecoder(format);
+    if (!decoder)
+      return nullptr;
+    return std::make_unique<DecodeTimingDecoder>(std::move(decoder),
+                                                 decode_times_);
+  }
+
+ private:
+  const std::unique_ptr<VideoDecoderFactory> factory_;
+  DecodeTimes* const decode_times_;
+};
+
 // Holds all the shared memory structures required for a receive stream. This
 // structure is used to prevent members being deallocated before the replay
 // has been finished.
@@ -297,9 +398,24 @@ struct StreamState {
   std::vector<std::unique_ptr<rtc::VideoSinkInterface<VideoFrame>>> sinks;
   std::vector<VideoReceiveStreamInterface*> receive_streams;
   std::vector<FlexfecReceiveStream*> flexfec_streams;
+  DecodeTimes decode_times;
   std::unique_ptr<VideoDecoderFactory> decoder_factory;
 };
 
+bool UseNullRenderer() {
+  return absl::GetFlag(FLAGS_disable_preview) ||
+         absl::GetFlag(FLAGS_benchmark);
+}
+
+// Measures the decode times of `stream_state->decoder_factory` decoders when
+// benchmarking.
+void MaybeTimeDecoders(StreamState* stream_state) {
+  if (absl::GetFlag(FLAGS_benchmark)) {
+    stream_state->decoder_factory = std::make_unique<DecodeTimingFactory>(
+        std::move(stream_state->decoder_factory), &stream_state->decode_times);
+  }
+}
+
 // Loads multiple configurations from the provided configuration file.
 std::unique_ptr<StreamState> ConfigureFromFile(const std::string& config_path,
                                                Call* call) {
@@ -327,6 +443,7 @@ std::unique_ptr<StreamState> ConfigureFromFile(const std::string& config_path,
   } else {
     stream_state->decoder_factory = std::make_unique<InternalDecoderFactory>();
   }
+  MaybeTimeDecoders(stream_state.get());
   size_t config_count = 0;
   for (const auto& json : json_configs) {
     // Create the configuration and parse the JSON into the config.
@@ -340,7 +457,7 @@ std::unique_ptr<StreamState> ConfigureFromFile(const std::string& config_path,
     // Create a window for this config.
     std::stringstream window_title;
     window_title << "Playback Video (" << config_count++ << ")";
-    if (absl::GetFlag(FLAGS_disable_preview)) {
+    if (UseNullRenderer()) {
       stream_state->sinks.emplace_back(std::make_unique<NullRenderer>());
     } else {
       stream_state->sinks.emplace_back(test::VideoRenderer::Create(
@@ -366,7 +483,7 @@ std::unique_ptr<StreamState> ConfigureFromFlags(
   std::stringstream window_title;
   window_title << "Playback Video (" << rtp_dump_path << ")";
   std::unique_ptr<rtc::VideoSinkInterface<VideoFrame>> playback_video;
-  if (absl::GetFlag(FLAGS_disable_preview)) {
+  if (UseNullRenderer()) {
     playback_video = std::make_unique<NullRenderer>();
   } else {
     playback_video.reset(test::VideoRenderer::Create(
@@ -435,6 +552,7 @@ std::unique_ptr<StreamState> ConfigureFromFlags(
   } else {
     stream_state->decoder_factory = std::make_unique<InternalDecoderFactory>();
   }
+  MaybeTimeDecoders(stream_state.get());
   receive_config.decoder_factory = stream_state->decoder_factory.get();
   receive_config.decoders.push_back(decoder);
 
@@ -557,6 +675,9 @@ class RtpReplayer final {
     uint32_t start_timestamp = absl::GetFlag(FLAGS_start_timestamp);
     uint32_t stop_timestamp = absl::GetFlag(FLAGS_stop_timestamp);
 
+    const int64_t wall_start_ns = rtc::SystemTimeNanos();
+    const int64_t cpu_start_ns = rtc::GetProcessCpuTimeNanos();
+
     RtpHeaderExtensionMap extensions;
     if (absl::GetFlag(FLAGS_transmission_offset_id) != -1) {
       extensions.RegisterByUri(absl::GetFlag(FLAGS_transmission_offset_id),
@@ -647,6 +768,10 @@ class RtpReplayer final {
     SleepOrAdvanceTime(absl::GetFlag(FLAGS_extend_run_time_duration) * 1000);
 
     fprintf(stderr, "num_packets: %d\n", num_packets);
+    if (absl::GetFlag(FLAGS_benchmark)) {
+      PrintBenchmarkResults(rtc::SystemTimeNanos() - wall_start_ns,
+                            rtc::GetProcessCpuTimeNanos() - cpu_start_ns);
+    }
 
     for (std::map<uint32_t, int>::const_iterator it = unknown_packets.begin();
          it != unknown_packets.end(); ++it) {
@@ -655,6 +780,30 @@ class RtpReplayer final {
     }
   }
 
+  // Prints the decode rate and decode time percentiles. The CPU time spent
+  // outside of the decoders covers packet parsing, the jitter buffer and frame
+  // scheduling.
+  void PrintBenchmarkResults(int64_t wall_time_ns, int64_t cpu_time_ns) {
+    SamplesStatsCounter decode_ms = stream_state_->decode_times.decode_ms();
+    const int64_t decode_ns = stream_state_->decode_times.total_ns();
+    fprintf(stderr, "frames_decoded: %d\n",
+            static_cast<int>(decode_ms.NumSamples()));
+    fprintf(stderr, "wall_time_ms: %.1f\n", wall_time_ns / 1e6);
+    if (wall_time_ns > 0) {
+      fprintf(stderr, "decode_fps: %.1f\n",
+              decode_ms.NumSamples() * 1e9 / wall_time_ns);
+    }
+    if (!decode_ms.IsEmpty()) {
+      fprintf(stderr,
+              "decode_time_ms: p50=%.2f p90=%.2f p99=%.2f max=%.2f\n",
+              decode_ms.GetPercentile(0.5), decode_ms.GetPercentile(0.9),
+              decode_ms.GetPercentile(0.99), decode_ms.GetMax());
+    }
+    fprintf(stderr, "cpu_time_ms: %.1f\n", cpu_time_ns / 1e6);
+    fprintf(stderr, "non_decode_cpu_time_ms: %.1f\n",
+            (cpu_time_ns - decode_ns) / 1e6);
+  }
+
   int64_t CurrentTimeMs() {
     return time_sim_ ? time_sim_->GetClock()->TimeInMilliseconds()
                      : rtc::TimeMillis();
@@ -684,7 +833,7 @@ void RtpReplay() {
   RtpReplayer replayer(
       absl::GetFlag(FLAGS_config_file), absl::GetFlag(FLAGS_input_file),
       std::make_unique<FieldTrials>(absl::GetFlag(FLAGS_force_fieldtrials)),
-      absl::GetFlag(FLAGS_simulated_time));
+      absl::GetFlag(FLAGS_simulated_time) || absl::GetFlag(FLAGS_benchmark));
   replayer.Run();
 }
 
@@ -361,12 +361,14 @@ class HardwareVideoEncoder implements VideoEncoder {
       return VideoCodecStatus.UNINITIALIZED;
     }
 
-    final boolean isTextureBuffer = videoFrame.getBuffer() instanceof VideoFrame.TextureBuffer;
-
     // If input resolution changed, restart the codec with the new resolution.
     final int frameWidth = videoFrame.getBuffer().getWidth();
     final int frameHeight = videoFrame.getBuffer().getHeight();
-    final boolean shouldUseSurfaceMode = canUseSurface() && isTextureBuffer;
+    // Whenever the codec accepts surface input, all frames are drawn onto the input surface.
+    // Texture frames are then encoded without leaving the GPU, and for memory buffers the YUV
+    // conversion is done by the GPU. This also avoids a codec restart every time the source
+    // switches between texture and memory buffers.
+    final boolean shouldUseSurfaceMode = canUseSurface();
     if (frameWidth != width || frameHeight != height || shouldUseSurfaceMode != useSurfaceMode) {
       VideoCodecStatus status = resetCodec(frameWidth, frameHeight, shouldUseSurfaceMode);
       if (status != VideoCodecStatus.OK) {
@@ -22,6 +22,14 @@ namespace webrtc {
 
 namespace jni {
 
+namespace {
+
+// Time without underruns after which the output buffer size is decreased by
+// one burst in low latency mode.
+constexpr int kBufferDecreaseIntervalSeconds = 10;
+
+}  // namespace
+
 AAudioPlayer::AAudioPlayer(const AudioParameters& audio_parameters)
     : main_thread_(TaskQueueBase::Current()),
       aaudio_(audio_parameters, AAUDIO_DIRECTION_OUTPUT, this) {
@@ -33,7 +41,7 @@ AAudioPlayer::~AAudioPlayer() {
   RTC_LOG(LS_INFO) << "dtor";
   RTC_DCHECK_RUN_ON(&main_thread_checker_);
   Terminate();
-  RTC_LOG(LS_INFO) << "#detected underruns: " << underrun_count_;
+  RTC_LOG(LS_INFO) << "#detected underruns: " << underrun_count_.load();
 }
 
 int AAudioPlayer::Init() {
@@ -174,6 +182,7 @@ aaudio_data_callback_result_t AAudioPlayer::OnDataCallback(void* audio_data,
                         "device id="
                      << aaudio_.device_id();
     first_data_callback_ = false;
+    last_buffer_change_frames_ = 0;
   }
 
   // Check if the underrun count has increased. If it has, increase the buffer
@@ -185,6 +194,14 @@ aaudio_data_callback_result_t AAudioPlayer::OnDataCallback(void* audio_data,
     RTC_LOG(LS_ERROR) << "Underrun detected: " << underrun_count;
     underrun_count_ = underrun_count;
     aaudio_.IncreaseOutputBufferSize();
+    last_buffer_change_frames_ = aaudio_.frames_written();
+  } else if (aaudio_.low_latency_mode() &&
+             aaudio_.frames_written() - last_buffer_change_frames_ >
+                 kBufferDecreaseIntervalSeconds * aaudio_.sample_rate()) {
+    // No underrun for a while; try to win back some latency. A new underrun
+    // will increase the buffer size again.
+    aaudio_.DecreaseOutputBufferSize();
+    last_buffer_change_frames_ = aaudio_.frames_written();
   }
 
   // Estimate latency between writing an audio frame to the output stream and
@@ -13,6 +13,7 @@
 
 #include <aaudio/AAudio.h>
 
+#include <atomic>
 #include <memory>
 
 #include "absl/types/optional.h"
@@ -50,7 +51,10 @@ namespace jni {
 // Also supports automatic buffer-size adjustment based on underrun detections
 // where the internal AAudio buffer can be increased when needed. It will
 // reduce the risk of underruns (~glitches) at the expense of an increased
-// latency.
+// latency. If the WebRTC-Audio-AAudioLowLatency field trial is enabled, the
+// stream is opened in exclusive (MMAP) mode when possible, and the buffer size
+// is also lowered again, one burst at a time, after a long enough period
+// without underruns.
 class AAudioPlayer final : public AudioOutput, public AAudioObserverInterface {
  public:
   explicit AAudioPlayer(const AudioParameters& audio_parameters);
@@ -88,8 +92,7 @@ class AAudioPlayer final : public AudioOutput, public AAudioObserverInterface {
   void OnErrorCallback(aaudio_result_t error) override;
 
  private:
-  // TODO(henrika): Implement.
-  int GetPlayoutUnderrunCount() override { return 0; }
+  int GetPlayoutUnderrunCount() override { return underrun_count_.load(); }
 
   // Closes the existing stream and starts a new stream.
   void HandleStreamDisconnected();
@@ -124,8 +127,14 @@ class AAudioPlayer final : public AudioOutput, public AAudioObserverInterface {
   // second callback and also cache non-utilized audio.
   std::unique_ptr<FineAudioBuffer> fine_audio_buffer_;
 
-  // Counts number of detected underrun events reported by AAudio.
-  int32_t underrun_count_ = 0;
+  // Counts number of detected underrun events reported by AAudio. Written on
+  // the real-time thread and read on the main thread.
+  std::atomic<int32_t> underrun_count_{0};
+
+  // Number of frames written at the last change of the output buffer size, or
+  // at the last underrun. Only used in low latency mode.
+  int64_t last_buffer_change_frames_ RTC_GUARDED_BY(thread_checker_aaudio_) =
+      0;
 
   // True only for the first data callback in each audio session.
   bool first_data_callback_ = true;
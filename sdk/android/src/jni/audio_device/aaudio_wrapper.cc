@@ -13,6 +13,7 @@
 #include "rtc_base/logging.h"
 #include "rtc_base/strings/string_builder.h"
 #include "rtc_base/time_utils.h"
+#include "system_wrappers/include/field_trial.h"
 
 #define LOG_ON_ERROR(op)                                                      \
   do {                                                                        \
@@ -136,6 +137,8 @@ AAudioWrapper::AAudioWrapper(const AudioParameters& audio_parameters,
                              AAudioObserverInterface* observer)
     : audio_parameters_(audio_parameters),
       direction_(direction),
+      low_latency_mode_(
+          webrtc::field_trial::IsEnabled("WebRTC-Audio-AAudioLowLatency")),
       observer_(observer) {
   RTC_LOG(LS_INFO) << "ctor";
   RTC_DCHECK(observer_);
@@ -267,6 +270,29 @@ bool AAudioWrapper::IncreaseOutputBufferSize() {
   return true;
 }
 
+bool AAudioWrapper::DecreaseOutputBufferSize() {
+  RTC_LOG(LS_INFO) << "DecreaseBufferSize";
+  RTC_DCHECK(stream_);
+  RTC_DCHECK(aaudio_thread_checker_.IsCurrent());
+  RTC_DCHECK_EQ(direction(), AAUDIO_DIRECTION_OUTPUT);
+  aaudio_result_t buffer_size = AAudioStream_getBufferSizeInFrames(stream_);
+  // Keep the buffer size aligned with the burst size and never go below a
+  // single burst.
+  buffer_size = (buffer_size - 1) / frames_per_burst() * frames_per_burst();
+  if (buffer_size < frames_per_burst()) {
+    return false;
+  }
+  RTC_LOG(LS_INFO) << "Updating buffer size to: " << buffer_size;
+  buffer_size = AAudioStream_setBufferSizeInFrames(stream_, buffer_size);
+  if (buffer_size < 0) {
+    RTC_LOG(LS_ERROR) << "Failed to change buffer size: "
+                      << AAudio_convertResultToText(buffer_size);
+    return false;
+  }
+  RTC_LOG(LS_INFO) << "Buffer size changed to: " << buffer_size;
+  return true;
+}
+
 void AAudioWrapper::ClearInputStream(void* audio_data, int32_t num_frames) {
   RTC_LOG(LS_INFO) << "ClearInputStream";
   RTC_DCHECK(stream_);
@@ -370,10 +396,13 @@ void AAudioWrapper::SetStreamConfiguration(AAudioStreamBuilder* builder) {
   AAudioStreamBuilder_setChannelCount(builder, audio_parameters().channels());
   // Always use 16-bit PCM audio sample format.
   AAudioStreamBuilder_setFormat(builder, AAUDIO_FORMAT_PCM_I16);
-  // TODO(henrika): investigate effect of using AAUDIO_SHARING_MODE_EXCLUSIVE.
-  // Ask for exclusive mode since this will give us the lowest possible latency.
-  // If exclusive mode isn't available, shared mode will be used instead.
-  AAudioStreamBuilder_setSharingMode(builder, AAUDIO_SHARING_MODE_SHARED);
+  // In low latency mode, ask for exclusive mode since this will give us the
+  // lowest possible latency. If exclusive mode isn't available, shared mode
+  // will be used instead.
+  AAudioStreamBuilder_setSharingMode(builder,
+                                     low_latency_mode_
+                                         ? AAUDIO_SHARING_MODE_EXCLUSIVE
+                                         : AAUDIO_SHARING_MODE_SHARED);
   // Use the direction that was given at construction.
   AAudioStreamBuilder_setDirection(builder, direction_);
   // TODO(henrika): investigate performance using different performance modes.
@@ -444,7 +473,12 @@ bool AAudioWrapper::VerifyStreamConfiguration() {
     RTC_LOG(LS_ERROR) << "Stream unable to use requested format";
     return false;
   }
-  if (AAudioStream_getSharingMode(stream_) != AAUDIO_SHARING_MODE_SHARED) {
+  if (low_latency_mode_) {
+    if (AAudioStream_getSharingMode(stream_) != AAUDIO_SHARING_MODE_EXCLUSIVE) {
+      RTC_LOG(LS_WARNING) << "Exclusive mode not available, using shared mode";
+    }
+  } else if (AAudioStream_getSharingMode(stream_) !=
+             AAUDIO_SHARING_MODE_SHARED) {
     RTC_LOG(LS_ERROR) << "Stream unable to use requested sharing mode";
     return false;
   }
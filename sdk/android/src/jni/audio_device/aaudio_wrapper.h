@@ -79,6 +79,11 @@ class AAudioWrapper {
   // reduce the risk of underruns. Can be used while a stream is active.
   bool IncreaseOutputBufferSize();
 
+  // Decreases the internal buffer size for output streams by one burst size,
+  // but not below one burst, to reduce the latency. Can be used while a stream
+  // is active.
+  bool DecreaseOutputBufferSize();
+
   // Drains the recording stream of any existing data by reading from it until
   // it's empty. Can be used to clear out old data before starting a new audio
   // session.
@@ -104,6 +109,12 @@ class AAudioWrapper {
   AAudioStream* stream() const { return stream_; }
   int32_t frames_per_burst() const { return frames_per_burst_; }
 
+  // True if the stream is opened in the opt-in low latency mode, enabled by
+  // the WebRTC-Audio-AAudioLowLatency field trial. In this mode exclusive
+  // (MMAP) access to the device is requested and the output buffer size is
+  // also reduced when no underruns occur.
+  bool low_latency_mode() const { return low_latency_mode_; }
+
  private:
   void SetStreamConfiguration(AAudioStreamBuilder* builder);
   bool OpenStream(AAudioStreamBuilder* builder);
@@ -117,6 +128,7 @@ class AAudioWrapper {
   SequenceChecker aaudio_thread_checker_;
   const AudioParameters audio_parameters_;
   const aaudio_direction_t direction_;
+  const bool low_latency_mode_;
   AAudioObserverInterface* observer_ = nullptr;
   AAudioStream* stream_ = nullptr;
   int32_t frames_per_burst_ = 0;
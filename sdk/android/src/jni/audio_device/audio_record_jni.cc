@@ -251,8 +251,11 @@ void AudioRecordJni::DataIsRecorded(JNIEnv* env,
     RTC_LOG(LS_ERROR) << "AttachAudioBuffer has not been called";
     return;
   }
-  audio_device_buffer_->SetRecordedBuffer(
-      direct_buffer_address_, frames_per_buffer_, capture_timestamp_ns);
+  // The Java side has written the samples to the direct ByteBuffer, which
+  // stays untouched until this call returns, so deliver them in place.
+  audio_device_buffer_->SetRecordedBufferNoCopy(
+      static_cast<const int16_t*>(direct_buffer_address_), frames_per_buffer_,
+      capture_timestamp_ns);
   // We provide one (combined) fixed delay estimate for the APM and use the
   // `playDelayMs` parameter only. Components like the AEC only sees the sum
   // of `playDelayMs` and `recDelayMs`, hence the distributions does not matter.
@@ -252,16 +252,15 @@ void AudioTrackJni::GetPlayoutData(JNIEnv* env, size_t length) {
     RTC_LOG(LS_ERROR) << "AttachAudioBuffer has not been called";
     return;
   }
-  // Pull decoded data (in 16-bit PCM format) from jitter buffer.
-  int samples = audio_device_buffer_->RequestPlayoutData(frames_per_buffer_);
+  // Pull decoded data (in 16-bit PCM format) from jitter buffer, directly
+  // into the byte buffer that is written to the Java based audio track.
+  int samples = audio_device_buffer_->RequestAndGetPlayoutData(
+      frames_per_buffer_, static_cast<int16_t*>(direct_buffer_address_));
   if (samples <= 0) {
-    RTC_LOG(LS_ERROR) << "AudioDeviceBuffer::RequestPlayoutData failed";
+    RTC_LOG(LS_ERROR) << "AudioDeviceBuffer::RequestAndGetPlayoutData failed";
     return;
   }
   RTC_DCHECK_EQ(samples, frames_per_buffer_);
-  // Copy decoded data into common byte buffer to ensure that it can be
-  // written to the Java based audio track.
-  samples = audio_device_buffer_->GetPlayoutData(direct_buffer_address_);
   RTC_DCHECK_EQ(length, bytes_per_frame * samples);
 }
 
@@ -362,6 +362,9 @@ NSUInteger GetMaxSampleRate(const webrtc::H264ProfileLevelId &profile_level_id)
   int32_t _height;
   VTCompressionSessionRef _compressionSession;
   CVPixelBufferPoolRef _pixelBufferPool;
+  // Crops and scales native frames into buffers from the compression session
+  // pool without copying them through CPU memory. Created lazily.
+  VTPixelTransferSessionRef _pixelTransferSession;
   RTCVideoCodecMode _codecMode;
   unsigned int _maxQP;
   unsigned int _minBitrate;
@@ -480,19 +483,21 @@ NSUInteger GetMaxSampleRate(const webrtc::H264ProfileLevelId &profile_level_id)
       if (!pixelBuffer) {
         return WEBRTC_VIDEO_CODEC_ERROR;
       }
-      int dstWidth = CVPixelBufferGetWidth(pixelBuffer);
-      int dstHeight = CVPixelBufferGetHeight(pixelBuffer);
-      if ([rtcPixelBuffer requiresScalingToWidth:dstWidth height:dstHeight]) {
-        int size = [rtcPixelBuffer bufferSizeForCroppingAndScalingToWidth:dstWidth
-                                                                   height:dstHeight];
-        _frameScaleBuffer.resize(size);
-      } else {
-        _frameScaleBuffer.clear();
-      }
-      _frameScaleBuffer.shrink_to_fit();
-      if (![rtcPixelBuffer cropAndScaleTo:pixelBuffer withTempBuffer:_frameScaleBuffer.data()]) {
-        CVBufferRelease(pixelBuffer);
-        return WEBRTC_VIDEO_CODEC_ERROR;
+      if (![self transferPixelBuffer:rtcPixelBuffer toPixelBuffer:pixelBuffer]) {
+        // Fall back to cropping and scaling on the CPU.
+        int dstWidth = CVPixelBufferGetWidth(pixelBuffer);
+        int dstHeight = CVPixelBufferGetHeight(pixelBuffer);
+        if ([rtcPixelBuffer requiresScalingToWidth:dstWidth height:dstHeight]) {
+          int size = [rtcPixelBuffer bufferSizeForCroppingAndScalingToWidth:dstWidth
+                                                                     height:dstHeight];
+          _frameScaleBuffer.resize(size);
+        } else {
+          _frameScaleBuffer.clear();
+        }
+        if (![rtcPixelBuffer cropAndScaleTo:pixelBuffer withTempBuffer:_frameScaleBuffer.data()]) {
+          CVBufferRelease(pixelBuffer);
+          return WEBRTC_VIDEO_CODEC_ERROR;
+        }
       }
     }
   }
@@ -787,6 +792,49 @@ NSUInteger GetMaxSampleRate(const webrtc::H264ProfileLevelId &profile_level_id)
     CFRelease(_compressionSession);
     _compressionSession = nullptr;
   }
+  if (_pixelTransferSession) {
+    if (@available(iOS 16, macOS 10.8, *)) {
+      VTPixelTransferSessionInvalidate(_pixelTransferSession);
+    }
+    CFRelease(_pixelTransferSession);
+    _pixelTransferSession = nullptr;
+  }
+}
+
+// Crops and scales `rtcPixelBuffer` into `pixelBuffer` with VideoToolbox, which
+// keeps the frame in IOSurface backed memory and converts the pixel format if
+// needed. Returns NO if the transfer is unavailable or fails, in which case the
+// caller should fall back to the libyuv path.
+- (BOOL)transferPixelBuffer:(RTC_OBJC_TYPE(RTCCVPixelBuffer) *)rtcPixelBuffer
+              toPixelBuffer:(CVPixelBufferRef)pixelBuffer {
+  if (@available(iOS 16, macOS 10.8, *)) {
+    if (!_pixelTransferSession) {
+      OSStatus status = VTPixelTransferSessionCreate(nullptr, &_pixelTransferSession);
+      if (status != noErr) {
+        RTC_LOG(LS_WARNING) << "Failed to create pixel transfer session: " << status;
+        _pixelTransferSession = nullptr;
+        return NO;
+      }
+    }
+    CGRect cropRect = CGRectMake(rtcPixelBuffer.cropX,
+                                 rtcPixelBuffer.cropY,
+                                 rtcPixelBuffer.cropWidth,
+                                 rtcPixelBuffer.cropHeight);
+    CFDictionaryRef cropRectDictionary = CGRectCreateDictionaryRepresentation(cropRect);
+    OSStatus status = VTSessionSetProperty(
+        _pixelTransferSession, kVTPixelTransferPropertyKey_SourceCropRectangle, cropRectDictionary);
+    CFRelease(cropRectDictionary);
+    if (status == noErr) {
+      status = VTPixelTransferSessionTransferImage(
+          _pixelTransferSession, rtcPixelBuffer.pixelBuffer, pixelBuffer);
+    }
+    if (status != noErr) {
+      RTC_LOG(LS_WARNING) << "Pixel transfer failed: " << status;
+      return NO;
+    }
+    return YES;
+  }
+  return NO;
 }
 
 - (NSString *)implementationName {
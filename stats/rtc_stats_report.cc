@@ -10,14 +10,176 @@
 
 #include "api/stats/rtc_stats_report.h"
 
+#include <string.h>
+
+#include <map>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "rtc_base/checks.h"
 #include "rtc_base/strings/string_builder.h"
 
 namespace webrtc {
 
+namespace {
+
+// Bumped whenever the layout written by `RTCStatsReport::ToBinary()` changes.
+constexpr uint8_t kBinaryFormatVersion = 1;
+
+void AppendVarInt(uint64_t value, std::string* output) {
+  while (value >= 0x80) {
+    output->push_back(static_cast<char>((value & 0x7f) | 0x80));
+    value >>= 7;
+  }
+  output->push_back(static_cast<char>(value));
+}
+
+uint64_t ToZigZag(int64_t value) {
+  return (static_cast<uint64_t>(value) << 1) ^
+         static_cast<uint64_t>(value >> 63);
+}
+
+void AppendString(const std::string& value, std::string* output) {
+  AppendVarInt(value.size(), output);
+  output->append(value);
+}
+
+void AppendDouble(double value, std::string* output) {
+  uint64_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  for (int i = 0; i < 8; ++i) {
+    output->push_back(static_cast<char>(bits & 0xff));
+    bits >>= 8;
+  }
+}
+
+// Signed values are zigzag encoded so that small negative numbers stay short.
+// With a `base`, the wrapping difference to it is written instead.
+template <typename T>
+void AppendInteger(T value, const T* base, std::string* output) {
+  if (base) {
+    uint64_t delta =
+        static_cast<uint64_t>(value) - static_cast<uint64_t>(*base);
+    AppendVarInt(ToZigZag(static_cast<int64_t>(delta)), output);
+  } else if (std::is_signed<T>::value) {
+    AppendVarInt(ToZigZag(static_cast<int64_t>(value)), output);
+  } else {
+    AppendVarInt(static_cast<uint64_t>(value), output);
+  }
+}
+
+template <typename T>
+void AppendIntegerMember(const RTCStatsMemberInterface& member,
+                         const RTCStatsMemberInterface* previous,
+                         std::string* output) {
+  const T* base = previous ? &previous->cast_to<RTCStatsMember<T>>().value()
+                           : nullptr;
+  AppendInteger(member.cast_to<RTCStatsMember<T>>().value(), base, output);
+}
+
+template <typename T>
+void AppendIntegerSequence(const RTCStatsMemberInterface& member,
+                           std::string* output) {
+  const std::vector<T>& values =
+      member.cast_to<RTCStatsMember<std::vector<T>>>().value();
+  AppendVarInt(values.size(), output);
+  for (T value : values)
+    AppendInteger<T>(value, nullptr, output);
+}
+
+// `previous` is the same member of the previous report's stats object, or
+// null if there is none or it was not defined.
+void AppendMember(const RTCStatsMemberInterface& member,
+                  const RTCStatsMemberInterface* previous,
+                  std::string* output) {
+  switch (member.type()) {
+    case RTCStatsMemberInterface::kBool:
+      output->push_back(member.cast_to<RTCStatsMember<bool>>().value() ? 1
+                                                                        : 0);
+      break;
+    case RTCStatsMemberInterface::kInt32:
+      AppendIntegerMember<int32_t>(member, previous, output);
+      break;
+    case RTCStatsMemberInterface::kUint32:
+      AppendIntegerMember<uint32_t>(member, previous, output);
+      break;
+    case RTCStatsMemberInterface::kInt64:
+      AppendIntegerMember<int64_t>(member, previous, output);
+      break;
+    case RTCStatsMemberInterface::kUint64:
+      AppendIntegerMember<uint64_t>(member, previous, output);
+      break;
+    case RTCStatsMemberInterface::kDouble:
+      AppendDouble(member.cast_to<RTCStatsMember<double>>().value(), output);
+      break;
+    case RTCStatsMemberInterface::kString:
+      AppendString(member.cast_to<RTCStatsMember<std::string>>().value(),
+                   output);
+      break;
+    case RTCStatsMemberInterface::kSequenceBool: {
+      const std::vector<bool>& values =
+          member.cast_to<RTCStatsMember<std::vector<bool>>>().value();
+      AppendVarInt(values.size(), output);
+      for (bool value : values)
+        output->push_back(value ? 1 : 0);
+      break;
+    }
+    case RTCStatsMemberInterface::kSequenceInt32:
+      AppendIntegerSequence<int32_t>(member, output);
+      break;
+    case RTCStatsMemberInterface::kSequenceUint32:
+      AppendIntegerSequence<uint32_t>(member, output);
+      break;
+    case RTCStatsMemberInterface::kSequenceInt64:
+      AppendIntegerSequence<int64_t>(member, output);
+      break;
+    case RTCStatsMemberInterface::kSequenceUint64:
+      AppendIntegerSequence<uint64_t>(member, output);
+      break;
+    case RTCStatsMemberInterface::kSequenceDouble: {
+      const std::vector<double>& values =
+          member.cast_to<RTCStatsMember<std::vector<double>>>().value();
+      AppendVarInt(values.size(), output);
+      for (double value : values)
+        AppendDouble(value, output);
+      break;
+    }
+    case RTCStatsMemberInterface::kSequenceString: {
+      const std::vector<std::string>& values =
+          member.cast_to<RTCStatsMember<std::vector<std::string>>>().value();
+      AppendVarInt(values.size(), output);
+      for (const std::string& value : values)
+        AppendString(value, output);
+      break;
+    }
+    case RTCStatsMemberInterface::kMapStringUint64: {
+      const std::map<std::string, uint64_t>& values =
+          member.cast_to<RTCStatsMember<std::map<std::string, uint64_t>>>()
+              .value();
+      AppendVarInt(values.size(), output);
+      for (const auto& [key, value] : values) {
+        AppendString(key, output);
+        AppendVarInt(value, output);
+      }
+      break;
+    }
+    case RTCStatsMemberInterface::kMapStringDouble: {
+      const std::map<std::string, double>& values =
+          member.cast_to<RTCStatsMember<std::map<std::string, double>>>()
+              .value();
+      AppendVarInt(values.size(), output);
+      for (const auto& [key, value] : values) {
+        AppendString(key, output);
+        AppendDouble(value, output);
+      }
+      break;
+    }
+  }
+}
+
+}  // namespace
+
 RTCStatsReport::ConstIterator::ConstIterator(
     const rtc::scoped_refptr<const RTCStatsReport>& report,
     StatsMap::const_iterator it)
@@ -129,4 +291,45 @@ std::string RTCStatsReport::ToJson() const {
   return sb.Release();
 }
 
+std::string RTCStatsReport::ToBinary(const RTCStatsReport* previous) const {
+  std::string output;
+  output.push_back(static_cast<char>(kBinaryFormatVersion));
+  output.push_back(previous ? 1 : 0);
+  AppendVarInt(
+      ToZigZag(timestamp_.us() - (previous ? previous->timestamp_.us() : 0)),
+      &output);
+  AppendVarInt(stats_.size(), &output);
+  for (const auto& [id, stats] : stats_) {
+    const RTCStats* previous_stats = previous ? previous->Get(id) : nullptr;
+    if (previous_stats && previous_stats->type() != stats->type())
+      previous_stats = nullptr;
+    std::vector<const RTCStatsMemberInterface*> members = stats->Members();
+    std::vector<const RTCStatsMemberInterface*> previous_members;
+    if (previous_stats) {
+      previous_members = previous_stats->Members();
+      RTC_DCHECK_EQ(members.size(), previous_members.size());
+    }
+    AppendString(stats->type(), &output);
+    AppendString(id, &output);
+    AppendVarInt(ToZigZag(stats->timestamp().us() - timestamp_.us()), &output);
+    size_t defined_count = 0;
+    for (const RTCStatsMemberInterface* member : members) {
+      if (member->is_defined())
+        ++defined_count;
+    }
+    AppendVarInt(defined_count, &output);
+    for (size_t i = 0; i < members.size(); ++i) {
+      if (!members[i]->is_defined())
+        continue;
+      const RTCStatsMemberInterface* previous_member =
+          previous_stats && previous_members[i]->is_defined()
+              ? previous_members[i]
+              : nullptr;
+      AppendVarInt(i, &output);
+      AppendMember(*members[i], previous_member, &output);
+    }
+  }
+  return output;
+}
+
 }  // namespace webrtc
@@ -166,4 +166,67 @@ TEST(RTCStatsReport, TakeMembersFrom) {
   EXPECT_EQ(i, static_cast<int64_t>(6));
 }
 
+TEST(RTCStatsReport, ToBinary) {
+  rtc::scoped_refptr<RTCStatsReport> report =
+      RTCStatsReport::Create(Timestamp::Micros(1337));
+  std::unique_ptr<RTCTestStats1> stats(
+      new RTCTestStats1("a0", Timestamp::Micros(1337)));
+  stats->integer = 5;
+  report->AddStats(std::move(stats));
+  // An undefined member is not written.
+  report->AddStats(std::unique_ptr<RTCStats>(
+      new RTCTestStats2("b0", Timestamp::Micros(1338))));
+
+  const char kExpected[] =
+      "\x01\x00"  // Version, no previous report.
+      "\xf2\x14"  // Report timestamp.
+      "\x02"       // Number of stats objects.
+      "\x0c"
+      "test-stats-1"
+      "\x02"
+      "a0"
+      "\x00"   // Timestamp relative to the report.
+      "\x01"   // Number of defined members.
+      "\x00"   // Member index.
+      "\x0a"   // Zigzag encoded 5.
+      "\x0c"
+      "test-stats-2"
+      "\x02"
+      "b0"
+      "\x02"   // Timestamp relative to the report.
+      "\x00";  // Number of defined members.
+  EXPECT_EQ(report->ToBinary(), std::string(kExpected, sizeof(kExpected) - 1));
+}
+
+TEST(RTCStatsReport, ToBinaryWithPreviousReport) {
+  rtc::scoped_refptr<RTCStatsReport> previous =
+      RTCStatsReport::Create(Timestamp::Micros(1000));
+  std::unique_ptr<RTCTestStats1> previous_stats(
+      new RTCTestStats1("a0", Timestamp::Micros(1000)));
+  previous_stats->integer = 3;
+  previous->AddStats(std::move(previous_stats));
+
+  rtc::scoped_refptr<RTCStatsReport> report =
+      RTCStatsReport::Create(Timestamp::Micros(1337));
+  std::unique_ptr<RTCTestStats1> stats(
+      new RTCTestStats1("a0", Timestamp::Micros(1337)));
+  stats->integer = 5;
+  report->AddStats(std::move(stats));
+
+  const char kExpected[] =
+      "\x01\x01"  // Version, delta against a previous report.
+      "\xa2\x05"  // Report timestamp relative to the previous report.
+      "\x01"
+      "\x0c"
+      "test-stats-1"
+      "\x02"
+      "a0"
+      "\x00"
+      "\x01"
+      "\x00"
+      "\x04";  // Zigzag encoded delta of 2.
+  EXPECT_EQ(report->ToBinary(previous.get()),
+            std::string(kExpected, sizeof(kExpected) - 1));
+}
+
 }  // namespace webrtc
@@ -676,7 +676,11 @@ RTCAudioPlayoutStats::RTCAudioPlayoutStats(const std::string& id,
       synthesized_samples_events("synthesizedSamplesEvents"),
       total_samples_duration("totalSamplesDuration"),
       total_playout_delay("totalPlayoutDelay"),
-      total_samples_count("totalSamplesCount") {}
+      total_samples_count("totalSamplesCount"),
+      playout_callback_interval("playoutCallbackInterval"),
+      playout_callback_processing_time("playoutCallbackProcessingTime"),
+      recording_callback_interval("recordingCallbackInterval"),
+      recording_callback_processing_time("recordingCallbackProcessingTime") {}
 
 RTCAudioPlayoutStats::RTCAudioPlayoutStats(const RTCAudioPlayoutStats& other) =
     default;
@@ -690,7 +694,11 @@ WEBRTC_RTCSTATS_IMPL(RTCAudioPlayoutStats, RTCStats, "media-playout",
     &synthesized_samples_events,
     &total_samples_duration,
     &total_playout_delay,
-    &total_samples_count)
+    &total_samples_count,
+    &playout_callback_interval,
+    &playout_callback_processing_time,
+    &recording_callback_interval,
+    &recording_callback_processing_time)
 // clang-format on
 
 }  // namespace webrtc
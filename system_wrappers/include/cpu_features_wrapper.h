@@ -16,7 +16,7 @@
 namespace webrtc {
 
 // List of features in x86.
-typedef enum { kSSE2, kSSE3, kAVX2, kFMA3 } CPUFeature;
+typedef enum { kSSE2, kSSE3, kAVX2, kFMA3, kAVX512 } CPUFeature;
 
 // List of features in ARM.
 enum {
@@ -26,7 +26,11 @@ enum {
   kCPUFeatureLDREXSTREX = (1 << 3)
 };
 
-// Returns true if the CPU supports the feature.
+// Returns true if the CPU supports the feature. The features are detected on
+// the first call and cached for the lifetime of the process. The
+// "WebRTC-MaxCpuFeatureTier" field trial, with the group name "None", "SSE2"
+// or "AVX2", hides the x86 features above that tier and must be set before the
+// first call to take effect.
 int GetCPUInfo(CPUFeature feature);
 
 // No CPU feature is available => straight C path.
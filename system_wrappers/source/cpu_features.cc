@@ -10,9 +10,15 @@
 
 // Parts of this file derived from Chromium's base/cpu.cc.
 
+#include <array>
+#include <string>
+
+#include "absl/strings/string_view.h"
+#include "rtc_base/checks.h"
 #include "rtc_base/system/arch.h"
 #include "system_wrappers/include/cpu_features_wrapper.h"
 #include "system_wrappers/include/field_trial.h"
+#include "system_wrappers/source/cpu_features_internal.h"
 
 #if defined(WEBRTC_ARCH_X86_FAMILY) && defined(_MSC_VER)
 #include <intrin.h>
@@ -26,6 +32,41 @@ int GetCPUInfoNoASM(CPUFeature feature) {
   return 0;
 }
 
+namespace cpu_features_internal {
+
+int MaxCpuFeatureTier(absl::string_view trial_group) {
+  if (trial_group == "None") {
+    return 0;
+  }
+  if (trial_group == "SSE2") {
+    return 1;
+  }
+  if (trial_group == "AVX2") {
+    return 2;
+  }
+  return 3;
+}
+
+int CapCpuFeature(CPUFeature feature, int detected, int max_tier) {
+  int tier = 3;
+  switch (feature) {
+    case kSSE2:
+    case kSSE3:
+      tier = 1;
+      break;
+    case kAVX2:
+    case kFMA3:
+      tier = 2;
+      break;
+    case kAVX512:
+      tier = 3;
+      break;
+  }
+  return tier <= max_tier ? detected : 0;
+}
+
+}  // namespace cpu_features_internal
+
 #if defined(WEBRTC_ARCH_X86_FAMILY)
 
 #if defined(WEBRTC_ENABLE_AVX2)
@@ -68,7 +109,7 @@ static inline void __cpuid(int cpu_info[4], int info_type) {
 
 #if defined(WEBRTC_ARCH_X86_FAMILY)
 // Actual feature detection for x86.
-int GetCPUInfo(CPUFeature feature) {
+static int DetectCPUFeature(CPUFeature feature) {
   int cpu_info[4];
   __cpuid(cpu_info, 1);
   if (feature == kSSE2) {
@@ -103,11 +144,42 @@ int GetCPUInfo(CPUFeature feature) {
            (cpu_info7[1] & 0x00000100) != 0 /* BMI2 */;
   }
 #endif  // WEBRTC_ENABLE_AVX2
+#if defined(WEBRTC_ENABLE_AVX512)
+  if (feature == kAVX512 && DetectCPUFeature(kAVX2) &&
+      !webrtc::field_trial::IsEnabled("WebRTC-Avx512SupportKillSwitch")) {
+    int cpu_info7[4];
+    __cpuid(cpu_info7, 7);
+
+    // AVX-512 instructions can be used when, in addition to AVX2,
+    //     a) AVX-512F is supported by the CPU,
+    //     b) the opmask and ZMM registers are enabled by the kernel.
+    return (cpu_info7[1] & 0x00010000) != 0 /* AVX512F */ &&
+           (xgetbv(0) & 0x000000E6) == 0xE6 /* ZMM state enabled */;
+  }
+#endif  // WEBRTC_ENABLE_AVX512
   if (feature == kFMA3) {
     return 0 != (cpu_info[2] & 0x00001000);
   }
   return 0;
 }
+
+int GetCPUInfo(CPUFeature feature) {
+  // The features are detected once, so that the same implementations get
+  // selected by all components for the lifetime of the process.
+  static const std::array<int, kAVX512 + 1> features = [] {
+    std::array<int, kAVX512 + 1> detected_features;
+    const int max_tier = cpu_features_internal::MaxCpuFeatureTier(
+        webrtc::field_trial::FindFullName("WebRTC-MaxCpuFeatureTier"));
+    for (int i = 0; i < static_cast<int>(detected_features.size()); ++i) {
+      const CPUFeature f = static_cast<CPUFeature>(i);
+      detected_features[i] = cpu_features_internal::CapCpuFeature(
+          f, DetectCPUFeature(f), max_tier);
+    }
+    return detected_features;
+  }();
+  RTC_DCHECK_LT(static_cast<size_t>(feature), features.size());
+  return features[feature];
+}
 #else
 // Default to straight C for other platforms.
 int GetCPUInfo(CPUFeature feature) {
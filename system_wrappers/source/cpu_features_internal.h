@@ -0,0 +1,32 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef SYSTEM_WRAPPERS_SOURCE_CPU_FEATURES_INTERNAL_H_
+#define SYSTEM_WRAPPERS_SOURCE_CPU_FEATURES_INTERNAL_H_
+
+#include "absl/strings/string_view.h"
+#include "system_wrappers/include/cpu_features_wrapper.h"
+
+namespace webrtc {
+namespace cpu_features_internal {
+
+// Returns the highest x86 feature tier allowed by a "WebRTC-MaxCpuFeatureTier"
+// group name: 0 for "None", 1 (SSE2, SSE3) for "SSE2", 2 (AVX2, FMA3) for
+// "AVX2" and 3 (AVX-512), i.e. no cap, for any other name.
+int MaxCpuFeatureTier(absl::string_view trial_group);
+
+// Returns `detected` if the tier of `feature` is at most `max_tier`, and 0
+// otherwise.
+int CapCpuFeature(CPUFeature feature, int detected, int max_tier);
+
+}  // namespace cpu_features_internal
+}  // namespace webrtc
+
+#endif  // SYSTEM_WRAPPERS_SOURCE_CPU_FEATURES_INTERNAL_H_
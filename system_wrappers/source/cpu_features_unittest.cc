@@ -0,0 +1,66 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "system_wrappers/source/cpu_features_internal.h"
+
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace cpu_features_internal {
+namespace {
+
+// Returns the features reported with a `trial_group` cap when every feature
+// is detected.
+int CappedFeature(absl::string_view trial_group, CPUFeature feature) {
+  return CapCpuFeature(feature, /*detected=*/1, MaxCpuFeatureTier(trial_group));
+}
+
+TEST(CpuFeaturesTest, NoneHidesAllFeatures) {
+  EXPECT_EQ(CappedFeature("None", kSSE2), 0);
+  EXPECT_EQ(CappedFeature("None", kSSE3), 0);
+  EXPECT_EQ(CappedFeature("None", kAVX2), 0);
+  EXPECT_EQ(CappedFeature("None", kFMA3), 0);
+  EXPECT_EQ(CappedFeature("None", kAVX512), 0);
+}
+
+TEST(CpuFeaturesTest, Sse2HidesAvx2AndAvx512) {
+  EXPECT_EQ(CappedFeature("SSE2", kSSE2), 1);
+  EXPECT_EQ(CappedFeature("SSE2", kSSE3), 1);
+  EXPECT_EQ(CappedFeature("SSE2", kAVX2), 0);
+  EXPECT_EQ(CappedFeature("SSE2", kFMA3), 0);
+  EXPECT_EQ(CappedFeature("SSE2", kAVX512), 0);
+}
+
+TEST(CpuFeaturesTest, Avx2HidesAvx512) {
+  EXPECT_EQ(CappedFeature("AVX2", kSSE2), 1);
+  EXPECT_EQ(CappedFeature("AVX2", kSSE3), 1);
+  EXPECT_EQ(CappedFeature("AVX2", kAVX2), 1);
+  EXPECT_EQ(CappedFeature("AVX2", kFMA3), 1);
+  EXPECT_EQ(CappedFeature("AVX2", kAVX512), 0);
+}
+
+TEST(CpuFeaturesTest, UnknownOrMissingGroupDoesNotCap) {
+  for (absl::string_view group : {"", "Enabled", "AVX512", "sse2"}) {
+    EXPECT_EQ(MaxCpuFeatureTier(group), 3) << group;
+    EXPECT_EQ(CappedFeature(group, kSSE2), 1) << group;
+    EXPECT_EQ(CappedFeature(group, kAVX2), 1) << group;
+    EXPECT_EQ(CappedFeature(group, kAVX512), 1) << group;
+  }
+}
+
+TEST(CpuFeaturesTest, CapDoesNotReportUndetectedFeatures) {
+  EXPECT_EQ(CapCpuFeature(kSSE2, /*detected=*/0, MaxCpuFeatureTier("")), 0);
+  EXPECT_EQ(CapCpuFeature(kAVX2, /*detected=*/0, MaxCpuFeatureTier("AVX2")),
+            0);
+}
+
+}  // namespace
+}  // namespace cpu_features_internal
+}  // namespace webrtc
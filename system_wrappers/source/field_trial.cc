@@ -11,14 +11,18 @@
 
 #include <stddef.h>
 
+#include <atomic>
 #include <map>
+#include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "absl/algorithm/container.h"
 #include "absl/strings/string_view.h"
 #include "experiments/registered_field_trials.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/containers/flat_map.h"
 #include "rtc_base/containers/flat_set.h"
 #include "rtc_base/logging.h"
 #include "rtc_base/string_encode.h"
@@ -39,6 +43,50 @@ flat_set<std::string>& TestKeys() {
   return *test_keys;
 }
 
+using ParsedFieldTrials = flat_map<std::string, std::string>;
+
+// The global trial string parsed into a map when it is set, so that
+// FindFullName() does not scan the string on every call. Readers load the
+// pointer without locking, so a replaced map can still be in use and is kept
+// alive until process exit. Outside of tests the string is set only once.
+std::atomic<const ParsedFieldTrials*> parsed_trials{nullptr};
+
+std::vector<std::unique_ptr<const ParsedFieldTrials>>& RetainedTrials() {
+  static auto* retained =
+      new std::vector<std::unique_ptr<const ParsedFieldTrials>>();
+  return *retained;
+}
+
+// Parses `trials_string` the way FindFullName() used to scan it: stops at the
+// first malformed item and the first occurrence of a name wins.
+std::unique_ptr<const ParsedFieldTrials> ParseFieldTrials(
+    absl::string_view trials_string) {
+  std::vector<std::pair<std::string, std::string>> items;
+  size_t next_item = 0;
+  while (next_item < trials_string.length()) {
+    // Find next name/value pair in field trial configuration string.
+    size_t field_name_end =
+        trials_string.find(kPersistentStringSeparator, next_item);
+    if (field_name_end == trials_string.npos || field_name_end == next_item)
+      break;
+    size_t field_value_end =
+        trials_string.find(kPersistentStringSeparator, field_name_end + 1);
+    if (field_value_end == trials_string.npos ||
+        field_value_end == field_name_end + 1)
+      break;
+    absl::string_view field_name =
+        trials_string.substr(next_item, field_name_end - next_item);
+    absl::string_view field_value = trials_string.substr(
+        field_name_end + 1, field_value_end - field_name_end - 1);
+    next_item = field_value_end + 1;
+
+    items.emplace_back(std::string(field_name), std::string(field_value));
+  }
+  // flat_map keeps the first of several equal keys when constructed from a
+  // range, matching the linear scan.
+  return std::make_unique<const ParsedFieldTrials>(std::move(items));
+}
+
 // Validates the given field trial string.
 //  E.g.:
 //    "WebRTC-experimentFoo/Enabled/WebRTC-experimentBar/Enabled100kbps/"
@@ -127,35 +175,15 @@ std::string FindFullName(absl::string_view name) {
       << name << " is not registered, see g3doc/field-trials.md.";
 #endif
 
-  if (trials_init_string == NULL)
+  const ParsedFieldTrials* trials =
+      parsed_trials.load(std::memory_order_acquire);
+  if (trials == nullptr)
     return std::string();
 
-  absl::string_view trials_string(trials_init_string);
-  if (trials_string.empty())
+  auto it = trials->find(name);
+  if (it == trials->end())
     return std::string();
-
-  size_t next_item = 0;
-  while (next_item < trials_string.length()) {
-    // Find next name/value pair in field trial configuration string.
-    size_t field_name_end =
-        trials_string.find(kPersistentStringSeparator, next_item);
-    if (field_name_end == trials_string.npos || field_name_end == next_item)
-      break;
-    size_t field_value_end =
-        trials_string.find(kPersistentStringSeparator, field_name_end + 1);
-    if (field_value_end == trials_string.npos ||
-        field_value_end == field_name_end + 1)
-      break;
-    absl::string_view field_name =
-        trials_string.substr(next_item, field_name_end - next_item);
-    absl::string_view field_value = trials_string.substr(
-        field_name_end + 1, field_value_end - field_name_end - 1);
-    next_item = field_value_end + 1;
-
-    if (name == field_name)
-      return std::string(field_value);
-  }
-  return std::string();
+  return it->second;
 }
 #endif  // WEBRTC_EXCLUDE_FIELD_TRIAL_DEFAULT
 
@@ -167,6 +195,13 @@ void InitFieldTrialsFromString(const char* trials_string) {
         << "Invalid field trials string:" << trials_string;
   };
   trials_init_string = trials_string;
+
+  std::unique_ptr<const ParsedFieldTrials> parsed;
+  if (trials_string && trials_string[0] != '\0')
+    parsed = ParseFieldTrials(trials_string);
+  parsed_trials.store(parsed.get(), std::memory_order_release);
+  if (parsed)
+    RetainedTrials().push_back(std::move(parsed));
 }
 
 const char* GetFieldTrialString() {
@@ -103,5 +103,28 @@ TEST(FieldTrialMergingTest, HandlesEmptyInput) {
 #endif  // GTEST_HAS_DEATH_TEST && RTC_DCHECK_IS_ON && !defined(WEBRTC_ANDROID)
         // && !defined(WEBRTC_EXCLUDE_FIELD_TRIAL_DEFAULT)
 
+#if !defined(WEBRTC_EXCLUDE_FIELD_TRIAL_DEFAULT)
+TEST(FieldTrialTest, FindsFullNameOfLatestString) {
+  FieldTrialsAllowedInScopeForTesting keys({"Audio", "Video", "Other"});
+  const char* previous = GetFieldTrialString();
+
+  InitFieldTrialsFromString("Audio/Enabled/Video/Disabled-50/");
+  EXPECT_EQ(FindFullName("Audio"), "Enabled");
+  EXPECT_EQ(FindFullName("Video"), "Disabled-50");
+  EXPECT_EQ(FindFullName("Other"), "");
+  EXPECT_TRUE(IsEnabled("Audio"));
+  EXPECT_TRUE(IsDisabled("Video"));
+
+  InitFieldTrialsFromString("Other/Enabled/");
+  EXPECT_EQ(FindFullName("Audio"), "");
+  EXPECT_EQ(FindFullName("Other"), "Enabled");
+
+  InitFieldTrialsFromString("");
+  EXPECT_EQ(FindFullName("Other"), "");
+
+  InitFieldTrialsFromString(previous);
+}
+#endif  // !defined(WEBRTC_EXCLUDE_FIELD_TRIAL_DEFAULT)
+
 }  // namespace field_trial
 }  // namespace webrtc
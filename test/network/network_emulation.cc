@@ -15,6 +15,7 @@
 #include <memory>
 #include <utility>
 
+#include "absl/algorithm/container.h"
 #include "absl/types/optional.h"
 #include "api/numerics/samples_stats_counter.h"
 #include "api/sequence_checker.h"
@@ -310,45 +311,55 @@ EmulatedNetworkNodeStats EmulatedNetworkNodeStatsBuilder::Build() const {
 }
 
 void LinkEmulation::OnPacketReceived(EmulatedIpPacket packet) {
+  // Packets are routed on the network task queue, so avoid posting a task per
+  // packet and hop in that case.
+  if (task_queue_->IsCurrent()) {
+    RTC_DCHECK_RUN_ON(task_queue_);
+    EnqueuePacket(std::move(packet));
+    return;
+  }
   task_queue_->PostTask([this, packet = std::move(packet)]() mutable {
     RTC_DCHECK_RUN_ON(task_queue_);
-
-    uint64_t packet_id = next_packet_id_++;
-    bool sent = network_behavior_->EnqueuePacket(PacketInFlightInfo(
-        packet.ip_packet_size(), packet.arrival_time.us(), packet_id));
-    if (sent) {
-      packets_.emplace_back(StoredPacket{.id = packet_id,
-                                         .sent_time = clock_->CurrentTime(),
-                                         .packet = std::move(packet),
-                                         .removed = false});
-    }
-    if (process_task_.Running())
-      return;
-    absl::optional<int64_t> next_time_us =
-        network_behavior_->NextDeliveryTimeUs();
-    if (!next_time_us)
-      return;
-    Timestamp current_time = clock_->CurrentTime();
-    process_task_ = RepeatingTaskHandle::DelayedStart(
-        task_queue_->Get(),
-        std::max(TimeDelta::Zero(),
-                 Timestamp::Micros(*next_time_us) - current_time),
-        [this]() {
-          RTC_DCHECK_RUN_ON(task_queue_);
-          Timestamp current_time = clock_->CurrentTime();
-          Process(current_time);
-          absl::optional<int64_t> next_time_us =
-              network_behavior_->NextDeliveryTimeUs();
-          if (!next_time_us) {
-            process_task_.Stop();
-            return TimeDelta::Zero();  // This is ignored.
-          }
-          RTC_DCHECK_GE(*next_time_us, current_time.us());
-          return Timestamp::Micros(*next_time_us) - current_time;
-        });
+    EnqueuePacket(std::move(packet));
   });
 }
 
+void LinkEmulation::EnqueuePacket(EmulatedIpPacket packet) {
+  uint64_t packet_id = next_packet_id_++;
+  bool sent = network_behavior_->EnqueuePacket(PacketInFlightInfo(
+      packet.ip_packet_size(), packet.arrival_time.us(), packet_id));
+  if (sent) {
+    packets_.emplace_back(StoredPacket{.id = packet_id,
+                                       .sent_time = clock_->CurrentTime(),
+                                       .packet = std::move(packet),
+                                       .removed = false});
+  }
+  if (process_task_.Running())
+    return;
+  absl::optional<int64_t> next_time_us =
+      network_behavior_->NextDeliveryTimeUs();
+  if (!next_time_us)
+    return;
+  Timestamp current_time = clock_->CurrentTime();
+  process_task_ = RepeatingTaskHandle::DelayedStart(
+      task_queue_->Get(),
+      std::max(TimeDelta::Zero(),
+               Timestamp::Micros(*next_time_us) - current_time),
+      [this]() {
+        RTC_DCHECK_RUN_ON(task_queue_);
+        Timestamp current_time = clock_->CurrentTime();
+        Process(current_time);
+        absl::optional<int64_t> next_time_us =
+            network_behavior_->NextDeliveryTimeUs();
+        if (!next_time_us) {
+          process_task_.Stop();
+          return TimeDelta::Zero();  // This is ignored.
+        }
+        RTC_DCHECK_GE(*next_time_us, current_time.us());
+        return Timestamp::Micros(*next_time_us) - current_time;
+      });
+}
+
 EmulatedNetworkNodeStats LinkEmulation::stats() const {
   RTC_DCHECK_RUN_ON(task_queue_);
   return stats_builder_.Build();
@@ -358,14 +369,12 @@ void LinkEmulation::Process(Timestamp at_time) {
   std::vector<PacketDeliveryInfo> delivery_infos =
       network_behavior_->DequeueDeliverablePackets(at_time.us());
   for (PacketDeliveryInfo& delivery_info : delivery_infos) {
-    StoredPacket* packet = nullptr;
-    for (auto& stored_packet : packets_) {
-      if (stored_packet.id == delivery_info.packet_id) {
-        packet = &stored_packet;
-        break;
-      }
-    }
-    RTC_CHECK(packet);
+    // The packets are stored in increasing id order.
+    auto it = absl::c_lower_bound(
+        packets_, delivery_info.packet_id,
+        [](const StoredPacket& packet, uint64_t id) { return packet.id < id; });
+    RTC_CHECK(it != packets_.end() && it->id == delivery_info.packet_id);
+    StoredPacket* packet = &*it;
     RTC_DCHECK(!packet->removed);
     packet->removed = true;
     stats_builder_.AddPacketTransportTime(
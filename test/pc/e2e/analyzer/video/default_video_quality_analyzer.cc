@@ -133,7 +133,9 @@ DefaultVideoQualityAnalyzer::DefaultVideoQualityAnalyzer(
     : options_(options),
       clock_(clock),
       metrics_logger_(metrics_logger),
-      frames_storage_(options.max_frames_storage_duration, clock_),
+      frames_storage_(options.max_frames_storage_duration,
+                      clock_,
+                      options.max_frames_storage_size_bytes),
       frames_comparator_(clock, cpu_measurer_, options) {
   RTC_CHECK(metrics_logger_);
 }
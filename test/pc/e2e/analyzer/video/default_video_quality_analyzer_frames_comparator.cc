@@ -37,6 +37,9 @@ using ::webrtc::webrtc_pc_e2e::SampleMetadataKey;
 
 constexpr TimeDelta kFreezeThreshold = TimeDelta::Millis(150);
 constexpr int kMaxActiveComparisons = 10;
+// Minimum number of queued comparisons per comparator thread, so that all
+// threads can be kept busy before the comparisons get overloaded.
+constexpr int kMinActiveComparisonsPerThread = 2;
 constexpr int kMillisInSecond = 1000;
 
 SamplesStatsCounter::StatsSample StatsSample(
@@ -195,6 +198,9 @@ void DefaultVideoQualityAnalyzerFramesComparator::Start(int max_threads_count) {
     MutexLock lock(&mutex_);
     RTC_CHECK_EQ(state_, State::kNew) << "Frames comparator is already started";
     state_ = State::kActive;
+    max_active_comparisons_ =
+        std::max(kMaxActiveComparisons,
+                 kMinActiveComparisonsPerThread * max_threads_count);
   }
   cpu_measurer_.StartMeasuringCpuProcessTime();
 }
@@ -358,7 +364,7 @@ void DefaultVideoQualityAnalyzerFramesComparator::AddComparisonInternal(
       StatsSample(comparisons_.size(), Now(), /*metadata=*/{}));
   // If there too many computations waiting in the queue, we won't provide
   // frames itself to make future computations lighter.
-  if (comparisons_.size() >= kMaxActiveComparisons) {
+  if (comparisons_.size() >= max_active_comparisons_) {
     comparisons_.emplace_back(ValidateFrameComparison(
         FrameComparison(std::move(stats_key), /*captured=*/absl::nullopt,
                         /*rendered=*/absl::nullopt, type,
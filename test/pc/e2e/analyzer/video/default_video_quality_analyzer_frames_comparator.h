@@ -146,6 +146,8 @@ class DefaultVideoQualityAnalyzerFramesComparator {
   std::map<InternalStatsKey, Timestamp> stream_last_freeze_end_time_
       RTC_GUARDED_BY(mutex_);
   std::deque<FrameComparison> comparisons_ RTC_GUARDED_BY(mutex_);
+  // Number of queued comparisons above which they get overloaded.
+  size_t max_active_comparisons_ RTC_GUARDED_BY(mutex_) = 0;
   FramesComparatorStats frames_comparator_stats_ RTC_GUARDED_BY(mutex_);
 
   std::vector<rtc::PlatformThread> thread_pool_;
@@ -11,7 +11,9 @@
 #ifndef TEST_PC_E2E_ANALYZER_VIDEO_DEFAULT_VIDEO_QUALITY_ANALYZER_SHARED_OBJECTS_H_
 #define TEST_PC_E2E_ANALYZER_VIDEO_DEFAULT_VIDEO_QUALITY_ANALYZER_SHARED_OBJECTS_H_
 
+#include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <map>
 #include <memory>
 #include <ostream>
@@ -278,6 +280,10 @@ struct DefaultVideoQualityAnalyzerOptions {
   // Amount of time for which DefaultVideoQualityAnalyzer will store frames
   // which were captured but not yet rendered on all receivers per stream.
   TimeDelta max_frames_storage_duration = kDefaultMaxFramesStorageDuration;
+  // Maximum total size of the frames stored by DefaultVideoQualityAnalyzer.
+  // When exceeded, the oldest frames are removed and their comparisons are
+  // done without PSNR and SSIM, like for frames stored for too long.
+  size_t max_frames_storage_size_bytes = std::numeric_limits<size_t>::max();
   // If true, the analyzer will expect peers to receive their own video streams.
   bool enable_receive_own_stream = false;
 };
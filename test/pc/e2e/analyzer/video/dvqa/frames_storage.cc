@@ -18,8 +18,16 @@
 #include "api/video/video_frame.h"
 
 namespace webrtc {
+namespace {
+
+size_t FrameSizeBytes(const VideoFrame& frame) {
+  return static_cast<size_t>(frame.width()) * frame.height() * 3 / 2;
+}
+
+}  // namespace
 
 void FramesStorage::Add(const VideoFrame& frame, Timestamp captured_time) {
+  size_bytes_ += FrameSizeBytes(frame);
   heap_.push_back(HeapNode{.frame = frame, .captured_time = captured_time});
   frame_id_index_[frame.id()] = heap_.size() - 1;
   Heapify(heap_.size() - 1);
@@ -48,6 +56,7 @@ void FramesStorage::RemoveInternal(uint16_t frame_id) {
 
   size_t index = it->second;
   frame_id_index_.erase(it);
+  size_bytes_ -= FrameSizeBytes(heap_[index].frame);
 
   // If it's not the last element in the heap, swap the last element in the heap
   // with element to remove.
@@ -121,7 +130,8 @@ void FramesStorage::HeapifyDown(size_t index) {
 void FramesStorage::RemoveTooOldFrames() {
   Timestamp now = clock_->CurrentTime();
   while (!heap_.empty() &&
-         (heap_[0].captured_time + max_storage_duration_) < now) {
+         ((heap_[0].captured_time + max_storage_duration_) < now ||
+          size_bytes_ > max_storage_size_bytes_)) {
     RemoveInternal(heap_[0].frame.id());
   }
 }
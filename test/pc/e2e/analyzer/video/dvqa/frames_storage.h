@@ -11,7 +11,9 @@
 #ifndef TEST_PC_E2E_ANALYZER_VIDEO_DVQA_FRAMES_STORAGE_H_
 #define TEST_PC_E2E_ANALYZER_VIDEO_DVQA_FRAMES_STORAGE_H_
 
+#include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <unordered_map>
 #include <vector>
 
@@ -24,18 +26,24 @@
 namespace webrtc {
 
 // Stores video frames for DefaultVideoQualityAnalyzer. Frames are cleaned up
-// when the time elapsed from their capture time exceeds `max_storage_duration`.
+// when the time elapsed from their capture time exceeds `max_storage_duration`
+// or, oldest first, when their total size exceeds `max_storage_size_bytes`.
 class FramesStorage {
  public:
-  FramesStorage(TimeDelta max_storage_duration, Clock* clock)
-      : max_storage_duration_(max_storage_duration), clock_(clock) {}
+  FramesStorage(TimeDelta max_storage_duration,
+                Clock* clock,
+                size_t max_storage_size_bytes =
+                    std::numeric_limits<size_t>::max())
+      : max_storage_duration_(max_storage_duration),
+        max_storage_size_bytes_(max_storage_size_bytes),
+        clock_(clock) {}
   FramesStorage(const FramesStorage&) = delete;
   FramesStorage& operator=(const FramesStorage&) = delete;
   FramesStorage(FramesStorage&&) = default;
   FramesStorage& operator=(FramesStorage&&) = default;
 
   // Adds frame to the storage. It is guaranteed to be stored at least
-  // `max_storage_duration` from `captured_time`.
+  // `max_storage_duration` from `captured_time`, unless the storage is full.
   //
   // Complexity: O(log(n))
   void Add(const VideoFrame& frame, Timestamp captured_time);
@@ -61,12 +69,18 @@ class FramesStorage {
   void HeapifyUp(size_t index);
   void HeapifyDown(size_t index);
 
+  // Also removes the oldest frames while the storage is over its size limit.
+  //
   // Complexity: O(#(of too old frames) * log(n))
   void RemoveTooOldFrames();
 
   TimeDelta max_storage_duration_;
+  size_t max_storage_size_bytes_;
   Clock* clock_;
 
+  // Total size of the stored frames, assuming I420.
+  size_t size_bytes_ = 0;
+
   std::unordered_map<uint16_t, size_t> frame_id_index_;
   // Min-heap based on HeapNode::captured_time.
   std::vector<HeapNode> heap_;
@@ -154,5 +154,31 @@ TEST_F(FramesStorageTest, AllFramesAutoCleaned) {
   EXPECT_FALSE(storage.Get(/*frame_id=*/3).has_value());
 }
 
+TEST_F(FramesStorageTest, OldestFramesRemovedWhenSizeLimitIsExceeded) {
+  VideoFrame frame1 = Create2x2Frame(/*frame_id=*/1);
+  VideoFrame frame2 = Create2x2Frame(/*frame_id=*/2);
+  VideoFrame frame3 = Create2x2Frame(/*frame_id=*/3);
+
+  // Room for two 2x2 I420 frames.
+  FramesStorage storage(TimeDelta::Seconds(1), GetClock(),
+                        /*max_storage_size_bytes=*/12);
+
+  storage.Add(frame1, /*captured_time=*/NowPlusSeconds(1));
+  storage.Add(frame2, /*captured_time=*/NowPlusSeconds(0));
+  AssertHasFrame(storage, /*frame_id=*/1);
+  AssertHasFrame(storage, /*frame_id=*/2);
+
+  storage.Add(frame3, /*captured_time=*/NowPlusSeconds(2));
+  AssertHasFrame(storage, /*frame_id=*/1);
+  AssertHasFrame(storage, /*frame_id=*/3);
+  EXPECT_FALSE(storage.Get(/*frame_id=*/2).has_value());
+
+  // Removing a frame makes room for a new one.
+  storage.Remove(/*frame_id=*/1);
+  storage.Add(frame2, /*captured_time=*/NowPlusSeconds(0));
+  AssertHasFrame(storage, /*frame_id=*/2);
+  AssertHasFrame(storage, /*frame_id=*/3);
+}
+
 }  // namespace
 }  // namespace webrtc
@@ -30,7 +30,9 @@ class FakeSctpTransport : public cricket::SctpTransportInternal {
     max_message_size_ = max_message_size;
     return true;
   }
-  bool OpenStream(int sid) override { return true; }
+  bool OpenStream(int sid, webrtc::Priority priority) override {
+    return true;
+  }
   bool ResetStream(int sid) override { return true; }
   webrtc::RTCError SendData(int sid,
                             const webrtc::SendDataParams& params,
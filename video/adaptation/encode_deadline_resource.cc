@@ -0,0 +1,106 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "video/adaptation/encode_deadline_resource.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "api/make_ref_counted.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/experiments/field_trial_parser.h"
+#include "rtc_base/logging.h"
+#include "rtc_base/time_utils.h"
+
+namespace webrtc {
+
+namespace {
+
+constexpr char kFieldTrialName[] = "WebRTC-EncodeDeadlineResource";
+constexpr double kPercentile = 0.95;
+
+}  // namespace
+
+// static
+rtc::scoped_refptr<EncodeDeadlineResource>
+EncodeDeadlineResource::CreateIfEnabled(const FieldTrialsView& field_trials) {
+  if (!field_trials.IsEnabled(kFieldTrialName)) {
+    return nullptr;
+  }
+  Config config;
+  FieldTrialParameter<double> overuse_fraction("overuse",
+                                               config.overuse_fraction);
+  FieldTrialParameter<double> underuse_fraction("underuse",
+                                                config.underuse_fraction);
+  FieldTrialParameter<int> window_frames("window", config.window_frames);
+  ParseFieldTrial({&overuse_fraction, &underuse_fraction, &window_frames},
+                  field_trials.Lookup(kFieldTrialName));
+  if (underuse_fraction.Get() <= 0.0 ||
+      underuse_fraction.Get() >= overuse_fraction.Get() ||
+      window_frames.Get() <= 0) {
+    RTC_LOG(LS_WARNING) << "Invalid " << kFieldTrialName
+                        << " config, using the defaults.";
+  } else {
+    config.overuse_fraction = overuse_fraction.Get();
+    config.underuse_fraction = underuse_fraction.Get();
+    config.window_frames = window_frames.Get();
+  }
+  return Create(config);
+}
+
+// static
+rtc::scoped_refptr<EncodeDeadlineResource> EncodeDeadlineResource::Create(
+    Config config) {
+  return rtc::make_ref_counted<EncodeDeadlineResource>(config);
+}
+
+EncodeDeadlineResource::EncodeDeadlineResource(Config config)
+    : VideoStreamEncoderResource("EncodeDeadlineResource"), config_(config) {
+  RTC_DCHECK_GT(config_.window_frames, 0);
+  encode_durations_us_.reserve(config_.window_frames);
+}
+
+EncodeDeadlineResource::~EncodeDeadlineResource() = default;
+
+void EncodeDeadlineResource::SetTargetFrameRate(
+    absl::optional<double> target_frame_rate) {
+  RTC_DCHECK_RUN_ON(encoder_queue());
+  if (target_frame_rate == target_frame_rate_)
+    return;
+  target_frame_rate_ = target_frame_rate;
+  encode_durations_us_.clear();
+}
+
+void EncodeDeadlineResource::OnEncodeCompleted(
+    absl::optional<int> encode_duration_us) {
+  RTC_DCHECK_RUN_ON(encoder_queue());
+  if (!encode_duration_us || !target_frame_rate_ || *target_frame_rate_ <= 0)
+    return;
+  encode_durations_us_.push_back(*encode_duration_us);
+  if (encode_durations_us_.size() < static_cast<size_t>(config_.window_frames))
+    return;
+
+  auto percentile_it =
+      encode_durations_us_.begin() +
+      static_cast<size_t>(kPercentile * (encode_durations_us_.size() - 1));
+  std::nth_element(encode_durations_us_.begin(), percentile_it,
+                   encode_durations_us_.end());
+  const double deadline_us = rtc::kNumMicrosecsPerSec / *target_frame_rate_;
+  const double usage = *percentile_it / deadline_us;
+  encode_durations_us_.clear();
+
+  if (usage > config_.overuse_fraction) {
+    OnResourceUsageStateMeasured(ResourceUsageState::kOveruse);
+  } else if (usage < config_.underuse_fraction) {
+    OnResourceUsageStateMeasured(ResourceUsageState::kUnderuse);
+  }
+}
+
+}  // namespace webrtc
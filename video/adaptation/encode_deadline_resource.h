@@ -0,0 +1,64 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef VIDEO_ADAPTATION_ENCODE_DEADLINE_RESOURCE_H_
+#define VIDEO_ADAPTATION_ENCODE_DEADLINE_RESOURCE_H_
+
+#include <vector>
+
+#include "absl/types/optional.h"
+#include "api/field_trials_view.h"
+#include "api/scoped_refptr.h"
+#include "video/adaptation/video_stream_encoder_resource.h"
+
+namespace webrtc {
+
+// Predicts from the measured per-frame encode times that the encoder is about
+// to miss its frame deadlines, i.e. the frame interval at the target frame
+// rate, and reports overuse before frames start being dropped. Unlike the
+// EncodeUsageResource, which filters the encode time relative to the capture
+// interval, this looks at the slowest frames in a window, which are the ones
+// causing stutter.
+//
+// At the end of each window of encoded frames, the 95th percentile of their
+// encode times is compared to the frame deadline. Overuse is reported when it
+// exceeds `overuse_fraction` of the deadline, and underuse when it is below
+// `underuse_fraction`. A new window starts after each of these checks and
+// when the target frame rate changes.
+class EncodeDeadlineResource : public VideoStreamEncoderResource {
+ public:
+  struct Config {
+    double overuse_fraction = 0.85;
+    double underuse_fraction = 0.45;
+    int window_frames = 60;
+  };
+
+  // Returns null unless the "WebRTC-EncodeDeadlineResource" field trial is
+  // enabled. The thresholds and window can be configured by the trial, e.g.
+  // "Enabled,overuse:0.8,underuse:0.4,window:30".
+  static rtc::scoped_refptr<EncodeDeadlineResource> CreateIfEnabled(
+      const FieldTrialsView& field_trials);
+  static rtc::scoped_refptr<EncodeDeadlineResource> Create(Config config);
+
+  explicit EncodeDeadlineResource(Config config);
+  ~EncodeDeadlineResource() override;
+
+  void SetTargetFrameRate(absl::optional<double> target_frame_rate);
+  void OnEncodeCompleted(absl::optional<int> encode_duration_us);
+
+ private:
+  const Config config_;
+  absl::optional<double> target_frame_rate_ RTC_GUARDED_BY(encoder_queue());
+  std::vector<int> encode_durations_us_ RTC_GUARDED_BY(encoder_queue());
+};
+
+}  // namespace webrtc
+
+#endif  // VIDEO_ADAPTATION_ENCODE_DEADLINE_RESOURCE_H_
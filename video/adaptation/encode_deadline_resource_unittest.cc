@@ -0,0 +1,117 @@
+/*
+ *  Copyright (c) 2023 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "video/adaptation/encode_deadline_resource.h"
+
+#include "absl/types/optional.h"
+#include "api/task_queue/task_queue_base.h"
+#include "call/adaptation/test/mock_resource_listener.h"
+#include "rtc_base/thread.h"
+#include "test/gmock.h"
+#include "test/gtest.h"
+#include "test/scoped_key_value_config.h"
+
+namespace webrtc {
+namespace {
+
+using ::testing::Eq;
+using ::testing::StrictMock;
+
+constexpr double kFrameRate = 30.0;
+// The frame deadline at `kFrameRate`.
+constexpr int kDeadlineUs = 33'333;
+constexpr int kWindowFrames = 10;
+
+class EncodeDeadlineResourceTest : public ::testing::Test {
+ public:
+  EncodeDeadlineResourceTest()
+      : resource_(EncodeDeadlineResource::Create(
+            {.overuse_fraction = 0.85,
+             .underuse_fraction = 0.45,
+             .window_frames = kWindowFrames})) {
+    resource_->RegisterEncoderTaskQueue(TaskQueueBase::Current());
+    resource_->SetResourceListener(&resource_listener_);
+    resource_->SetTargetFrameRate(kFrameRate);
+  }
+
+  ~EncodeDeadlineResourceTest() override {
+    resource_->SetResourceListener(nullptr);
+  }
+
+  void EncodeFrames(int num_frames, int encode_duration_us) {
+    for (int i = 0; i < num_frames; ++i) {
+      resource_->OnEncodeCompleted(encode_duration_us);
+    }
+  }
+
+ protected:
+  rtc::AutoThread main_thread_;
+  StrictMock<MockResourceListener> resource_listener_;
+  rtc::scoped_refptr<EncodeDeadlineResource> resource_;
+};
+
+TEST_F(EncodeDeadlineResourceTest, ReportsOveruseWhenSlowFramesNearDeadline) {
+  // Most frames are fast, but the slowest ones are close to the deadline.
+  EncodeFrames(kWindowFrames - 2, kDeadlineUs / 4);
+  EncodeFrames(1, kDeadlineUs * 9 / 10);
+  EXPECT_CALL(resource_listener_,
+              OnResourceUsageStateMeasured(Eq(resource_),
+                                           Eq(ResourceUsageState::kOveruse)));
+  EncodeFrames(1, kDeadlineUs * 9 / 10);
+}
+
+TEST_F(EncodeDeadlineResourceTest, ReportsUnderuseWhenFramesAreFast) {
+  EXPECT_CALL(resource_listener_,
+              OnResourceUsageStateMeasured(Eq(resource_),
+                                           Eq(ResourceUsageState::kUnderuse)));
+  EncodeFrames(kWindowFrames, kDeadlineUs / 4);
+}
+
+TEST_F(EncodeDeadlineResourceTest, SilentWithinThresholds) {
+  EncodeFrames(3 * kWindowFrames, kDeadlineUs * 6 / 10);
+}
+
+TEST_F(EncodeDeadlineResourceTest, IgnoresOutlierBelowPercentile) {
+  // A single slow frame in a window of fast frames doesn't cause overuse.
+  EXPECT_CALL(resource_listener_,
+              OnResourceUsageStateMeasured(Eq(resource_),
+                                           Eq(ResourceUsageState::kUnderuse)));
+  EncodeFrames(1, 2 * kDeadlineUs);
+  EncodeFrames(kWindowFrames - 1, kDeadlineUs / 4);
+}
+
+TEST_F(EncodeDeadlineResourceTest, WindowRestartsOnFrameRateChange) {
+  EncodeFrames(kWindowFrames - 1, 2 * kDeadlineUs);
+  // The frames encoded at the old frame rate are not taken into account.
+  resource_->SetTargetFrameRate(kFrameRate / 2);
+  EXPECT_CALL(resource_listener_,
+              OnResourceUsageStateMeasured(Eq(resource_),
+                                           Eq(ResourceUsageState::kUnderuse)));
+  EncodeFrames(kWindowFrames, kDeadlineUs / 4);
+}
+
+TEST_F(EncodeDeadlineResourceTest, SilentWithoutTargetFrameRate) {
+  resource_->SetTargetFrameRate(absl::nullopt);
+  EncodeFrames(kWindowFrames, 2 * kDeadlineUs);
+}
+
+TEST(EncodeDeadlineResourceFieldTrialTest, DisabledByDefault) {
+  test::ScopedKeyValueConfig field_trials;
+  EXPECT_FALSE(EncodeDeadlineResource::CreateIfEnabled(field_trials));
+}
+
+TEST(EncodeDeadlineResourceFieldTrialTest, CreatedWhenEnabled) {
+  test::ScopedKeyValueConfig field_trials(
+      "WebRTC-EncodeDeadlineResource/Enabled,overuse:0.8,window:30/");
+  EXPECT_TRUE(EncodeDeadlineResource::CreateIfEnabled(field_trials));
+}
+
+}  // namespace
+}  // namespace webrtc
@@ -275,6 +275,8 @@ VideoStreamEncoderResourceManager::VideoStreamEncoderResourceManager(
                                                field_trials)),
       encode_usage_resource_(
           EncodeUsageResource::Create(std::move(overuse_detector))),
+      encode_deadline_resource_(
+          EncodeDeadlineResource::CreateIfEnabled(field_trials)),
       quality_scaler_resource_(QualityScalerResource::Create()),
       pixel_limit_resource_(nullptr),
       bandwidth_quality_scaler_resource_(
@@ -313,6 +315,9 @@ void VideoStreamEncoderResourceManager::Initialize(
   RTC_DCHECK(encoder_queue);
   encoder_queue_ = encoder_queue;
   encode_usage_resource_->RegisterEncoderTaskQueue(encoder_queue_);
+  if (encode_deadline_resource_) {
+    encode_deadline_resource_->RegisterEncoderTaskQueue(encoder_queue_);
+  }
   quality_scaler_resource_->RegisterEncoderTaskQueue(encoder_queue_);
   bandwidth_quality_scaler_resource_->RegisterEncoderTaskQueue(encoder_queue_);
 }
@@ -346,6 +351,9 @@ void VideoStreamEncoderResourceManager::ConfigureEncodeUsageResource() {
   } else {
     // If the resource has not yet started then it needs to be added.
     AddResource(encode_usage_resource_, VideoAdaptationReason::kCpu);
+    if (encode_deadline_resource_) {
+      AddResource(encode_deadline_resource_, VideoAdaptationReason::kCpu);
+    }
   }
   encode_usage_resource_->StartCheckForOveruse(GetCpuOveruseOptions());
 }
@@ -384,6 +392,9 @@ void VideoStreamEncoderResourceManager::StopManagedResources() {
   if (encode_usage_resource_->is_started()) {
     encode_usage_resource_->StopCheckForOveruse();
     RemoveResource(encode_usage_resource_);
+    if (encode_deadline_resource_) {
+      RemoveResource(encode_deadline_resource_);
+    }
   }
   if (quality_scaler_resource_->is_started()) {
     quality_scaler_resource_->StopCheckForOveruse();
@@ -512,6 +523,9 @@ void VideoStreamEncoderResourceManager::OnEncodeCompleted(
       encoded_image.capture_time_ms_ * rtc::kNumMicrosecsPerMillisec;
   encode_usage_resource_->OnEncodeCompleted(
       timestamp, time_sent_in_us, capture_time_us, encode_duration_us);
+  if (encode_deadline_resource_) {
+    encode_deadline_resource_->OnEncodeCompleted(encode_duration_us);
+  }
   quality_scaler_resource_->OnEncodeCompleted(encoded_image, time_sent_in_us);
   bandwidth_quality_scaler_resource_->OnEncodeCompleted(
       encoded_image, time_sent_in_us, frame_size.bytes());
@@ -770,6 +784,9 @@ void VideoStreamEncoderResourceManager::MaybeUpdateTargetFrameRate() {
     target_frame_rate = codec_max_frame_rate;
   }
   encode_usage_resource_->SetTargetFrameRate(target_frame_rate);
+  if (encode_deadline_resource_) {
+    encode_deadline_resource_->SetTargetFrameRate(target_frame_rate);
+  }
 }
 
 void VideoStreamEncoderResourceManager::UpdateStatsAdaptationSettings() const {
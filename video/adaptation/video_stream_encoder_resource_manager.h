@@ -45,6 +45,7 @@
 #include "video/adaptation/bitrate_constraint.h"
 #include "video/adaptation/encode_usage_resource.h"
 #include "video/adaptation/overuse_frame_detector.h"
+#include "video/adaptation/encode_deadline_resource.h"
 #include "video/adaptation/pixel_limit_resource.h"
 #include "video/adaptation/quality_rampup_experiment_helper.h"
 #include "video/adaptation/quality_scaler_resource.h"
@@ -166,7 +167,7 @@ class VideoStreamEncoderResourceManager
   int LastFrameSizeOrDefault() const;
 
   // Calculates an up-to-date value of the target frame rate and informs the
-  // `encode_usage_resource_` of the new value.
+  // `encode_usage_resource_` and `encode_deadline_resource_` of the new value.
   void MaybeUpdateTargetFrameRate();
 
   // Use nullopt to disable quality scaling.
@@ -191,6 +192,9 @@ class VideoStreamEncoderResourceManager
   const std::unique_ptr<BalancedConstraint> balanced_constraint_
       RTC_GUARDED_BY(encoder_queue_);
   const rtc::scoped_refptr<EncodeUsageResource> encode_usage_resource_;
+  // Null unless the "WebRTC-EncodeDeadlineResource" field trial is enabled.
+  // Added and removed together with the `encode_usage_resource_`.
+  const rtc::scoped_refptr<EncodeDeadlineResource> encode_deadline_resource_;
   const rtc::scoped_refptr<QualityScalerResource> quality_scaler_resource_;
   rtc::scoped_refptr<PixelLimitResource> pixel_limit_resource_;
   const rtc::scoped_refptr<BandwidthQualityScalerResource>
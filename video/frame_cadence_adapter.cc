@@ -166,6 +166,10 @@ class ZeroHertzAdapterMode : public AdapterMode {
   // Resets quality convergence information. HasQualityConverged() returns false
   // after this call.
   void ResetQualityConvergenceInfo() RTC_RUN_ON(sequence_checker_);
+  // Returns true if `frame` reports that it has no changes compared to the
+  // frame being repeated.
+  bool IsUnchanged(const VideoFrame& frame) const
+      RTC_RUN_ON(sequence_checker_);
   // Processes incoming frames on a delayed cadence.
   void ProcessOnDelayedCadence() RTC_RUN_ON(sequence_checker_);
   // Schedules a later repeat with delay depending on state of layer trackers.
@@ -245,7 +249,7 @@ class FrameCadenceAdapterImpl : public FrameCadenceAdapterInterface {
       const VideoTrackSourceConstraints& constraints) override;
 
  private:
-  // Called from OnFrame in zero-hertz mode.
+  // Called from OnFrame, on `queue_`.
   void OnFrameOnMainQueue(Timestamp post_time,
                           int frames_scheduled_for_processing,
                           const VideoFrame& frame) RTC_RUN_ON(queue_);
@@ -267,6 +271,9 @@ class FrameCadenceAdapterImpl : public FrameCadenceAdapterInterface {
   // 0 Hz.
   const bool zero_hertz_screenshare_enabled_;
 
+  // True if frames arriving on `queue_` may be processed without posting them.
+  const bool direct_frame_delivery_enabled_;
+
   // The two possible modes we're under.
   absl::optional<PassthroughAdapterMode> passthrough_adapter_;
   absl::optional<ZeroHertzAdapterMode> zero_hertz_adapter_;
@@ -362,6 +369,15 @@ void ZeroHertzAdapterMode::OnFrame(Timestamp post_time,
                        << this;
   refresh_frame_requester_.Stop();
 
+  // A frame that reports no changes carries the same content as the frame
+  // being repeated. Keep repeating that one instead, so that the frame doesn't
+  // cost an encode and quality convergence isn't reset.
+  if (scheduled_repeat_.has_value() && IsUnchanged(frame)) {
+    RTC_DLOG(LS_VERBOSE) << __func__ << " this " << this
+                         << " drop frame without updates";
+    return;
+  }
+
   // Assume all enabled layers are unconverged after frame entry.
   ResetQualityConvergenceInfo();
 
@@ -457,6 +473,15 @@ bool ZeroHertzAdapterMode::HasQualityConverged() const {
   return quality_converged;
 }
 
+bool ZeroHertzAdapterMode::IsUnchanged(const VideoFrame& frame) const {
+  RTC_DCHECK_RUN_ON(&sequence_checker_);
+  RTC_DCHECK(!queued_frames_.empty());
+  const VideoFrame& repeated_frame = queued_frames_.front();
+  return frame.has_update_rect() && frame.update_rect().IsEmpty() &&
+         frame.width() == repeated_frame.width() &&
+         frame.height() == repeated_frame.height();
+}
+
 void ZeroHertzAdapterMode::ResetQualityConvergenceInfo() {
   RTC_DCHECK_RUN_ON(&sequence_checker_);
   RTC_DLOG(LS_INFO) << __func__ << " this " << this;
@@ -589,7 +614,9 @@ FrameCadenceAdapterImpl::FrameCadenceAdapterImpl(
     : clock_(clock),
       queue_(queue),
       zero_hertz_screenshare_enabled_(
-          !field_trials.IsDisabled("WebRTC-ZeroHertzScreenshare")) {}
+          !field_trials.IsDisabled("WebRTC-ZeroHertzScreenshare")),
+      direct_frame_delivery_enabled_(field_trials.IsEnabled(
+          "WebRTC-FrameCadenceAdapter-DirectFrameDelivery")) {}
 
 FrameCadenceAdapterImpl::~FrameCadenceAdapterImpl() {
   RTC_DLOG(LS_VERBOSE) << __func__ << " this " << this;
@@ -653,18 +680,19 @@ void FrameCadenceAdapterImpl::OnFrame(const VideoFrame& frame) {
 
   // Local time in webrtc time base.
   Timestamp post_time = clock_->CurrentTime();
+
+  // A frame that arrives on `queue_` when no earlier frame waits for it can
+  // be processed right away without changing the frame order.
+  if (direct_frame_delivery_enabled_ && queue_->IsCurrent() &&
+      frames_scheduled_for_processing_.load(std::memory_order_relaxed) == 0) {
+    RTC_DCHECK_RUN_ON(queue_);
+    OnFrameOnMainQueue(post_time, /*frames_scheduled_for_processing=*/1, frame);
+    return;
+  }
+
   frames_scheduled_for_processing_.fetch_add(1, std::memory_order_relaxed);
   queue_->PostTask(SafeTask(safety_.flag(), [this, post_time, frame] {
     RTC_DCHECK_RUN_ON(queue_);
-    if (zero_hertz_adapter_created_timestamp_.has_value()) {
-      TimeDelta time_until_first_frame =
-          clock_->CurrentTime() - *zero_hertz_adapter_created_timestamp_;
-      zero_hertz_adapter_created_timestamp_ = absl::nullopt;
-      RTC_HISTOGRAM_COUNTS_10000(
-          "WebRTC.Screenshare.ZeroHz.TimeUntilFirstFrameMs",
-          time_until_first_frame.ms());
-    }
-
     const int frames_scheduled_for_processing =
         frames_scheduled_for_processing_.fetch_sub(1,
                                                    std::memory_order_relaxed);
@@ -701,6 +729,15 @@ void FrameCadenceAdapterImpl::OnFrameOnMainQueue(
     int frames_scheduled_for_processing,
     const VideoFrame& frame) {
   RTC_DCHECK_RUN_ON(queue_);
+  if (zero_hertz_adapter_created_timestamp_.has_value()) {
+    TimeDelta time_until_first_frame =
+        clock_->CurrentTime() - *zero_hertz_adapter_created_timestamp_;
+    zero_hertz_adapter_created_timestamp_ = absl::nullopt;
+    RTC_HISTOGRAM_COUNTS_10000(
+        "WebRTC.Screenshare.ZeroHz.TimeUntilFirstFrameMs",
+        time_until_first_frame.ms());
+  }
+
   current_adapter_mode_->OnFrame(post_time, frames_scheduled_for_processing,
                                  frame);
 }
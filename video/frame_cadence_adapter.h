@@ -80,7 +80,11 @@ class FrameCadenceAdapterInterface
   // Factory function creating a production instance. Deletion of the returned
   // instance needs to happen on the same sequence that Create() was called on.
   // Frames arriving in FrameCadenceAdapterInterface::OnFrame are posted to
-  // Callback::OnFrame on the |queue|.
+  // Callback::OnFrame on the |queue|. Under the
+  // WebRTC-FrameCadenceAdapter-DirectFrameDelivery field trial, frames that
+  // arrive on the |queue| while no other frames are scheduled for processing
+  // are passed to Callback::OnFrame right away instead, saving a task per
+  // frame for sources that deliver frames on the encoder queue.
   static std::unique_ptr<FrameCadenceAdapterInterface> Create(
       Clock* clock,
       TaskQueueBase* queue,
@@ -91,7 +95,8 @@ class FrameCadenceAdapterInterface
 
   // Pass zero hertz parameters in |params| as a prerequisite to enable
   // zero-hertz operation. If absl:::nullopt is passed, the cadence adapter will
-  // switch to passthrough mode.
+  // switch to passthrough mode. In zero-hertz mode, frames with an empty
+  // update rect that arrive while a previous frame is repeated are dropped.
   virtual void SetZeroHertzModeEnabled(
       absl::optional<ZeroHertzModeParams> params) = 0;
 
@@ -124,6 +124,33 @@ TEST(FrameCadenceAdapterTest, CountsOutstandingFramesToProcess) {
   time_controller.AdvanceTime(TimeDelta::Zero());
 }
 
+TEST(FrameCadenceAdapterTest, DeliversFramesOnQueueDirectlyUnderFieldTrial) {
+  test::ScopedKeyValueConfig field_trials(
+      "WebRTC-FrameCadenceAdapter-DirectFrameDelivery/Enabled/");
+  GlobalSimulatedTimeController time_controller(Timestamp::Millis(1));
+  MockCallback callback;
+  auto adapter = CreateAdapter(field_trials, time_controller.GetClock());
+  adapter->Initialize(&callback);
+  auto frame = CreateFrame();
+
+  // The adapter runs on the current queue, so frames need no posting.
+  EXPECT_CALL(callback, OnFrame(_, 1, _)).Times(2);
+  adapter->OnFrame(frame);
+  adapter->OnFrame(frame);
+  Mock::VerifyAndClearExpectations(&callback);
+
+  // Frames from other threads are still posted.
+  std::unique_ptr<TaskQueueBase, TaskQueueDeleter> queue =
+      time_controller.GetTaskQueueFactory()->CreateTaskQueue(
+          "source", TaskQueueFactory::Priority::NORMAL);
+  TaskQueueBase* adapter_queue = TaskQueueBase::Current();
+  EXPECT_CALL(callback, OnFrame(_, 1, _)).WillOnce(Invoke([&] {
+    EXPECT_TRUE(adapter_queue->IsCurrent());
+  }));
+  queue->PostTask([&] { adapter->OnFrame(frame); });
+  time_controller.AdvanceTime(TimeDelta::Zero());
+}
+
 TEST(FrameCadenceAdapterTest, FrameRateFollowsRateStatisticsByDefault) {
   test::ScopedKeyValueConfig no_field_trials;
   GlobalSimulatedTimeController time_controller(Timestamp::Zero());
@@ -361,6 +388,48 @@ TEST(FrameCadenceAdapterTest, StopsRepeatingFramesDelayed) {
   time_controller.AdvanceTime(TimeDelta::Seconds(1));
 }
 
+TEST(FrameCadenceAdapterTest, DropsUnchangedFramesWhileRepeating) {
+  ZeroHertzFieldTrialEnabler enabler;
+  MockCallback callback;
+  GlobalSimulatedTimeController time_controller(Timestamp::Zero());
+  auto adapter = CreateAdapter(enabler, time_controller.GetClock());
+  adapter->Initialize(&callback);
+  adapter->SetZeroHertzModeEnabled(
+      FrameCadenceAdapterInterface::ZeroHertzModeParams{});
+  adapter->OnConstraintsChanged(VideoTrackSourceConstraints{0, 1});
+  VideoFrame::UpdateRect empty_update_rect;
+  empty_update_rect.MakeEmptyUpdate();
+
+  // The first frame is forwarded even without updates, as there's nothing to
+  // repeat yet.
+  VideoFrame frame = CreateFrame();
+  frame.set_update_rect(empty_update_rect);
+  adapter->OnFrame(frame);
+  EXPECT_CALL(callback, OnFrame).Times(1);
+  time_controller.AdvanceTime(TimeDelta::Millis(1500));
+  Mock::VerifyAndClearExpectations(&callback);
+
+  // An unchanged frame at 1.5s doesn't interrupt the repeat at 2s.
+  adapter->OnFrame(frame);
+  EXPECT_CALL(callback, OnFrame).Times(1);
+  time_controller.AdvanceTime(TimeDelta::Millis(1000));
+  Mock::VerifyAndClearExpectations(&callback);
+
+  // A changed frame at 2.5s restarts the cadence and appears at 3.5s, the
+  // repeat at 3s being cancelled.
+  VideoFrame::UpdateRect update_rect{0, 0, 8, 8};
+  frame.set_update_rect(update_rect);
+  adapter->OnFrame(frame);
+  EXPECT_CALL(callback, OnFrame).Times(0);
+  time_controller.AdvanceTime(TimeDelta::Millis(999));
+  Mock::VerifyAndClearExpectations(&callback);
+  EXPECT_CALL(callback, OnFrame)
+      .WillOnce(Invoke([&](Timestamp, int, const VideoFrame& frame) {
+        EXPECT_EQ(frame.update_rect(), update_rect);
+      }));
+  time_controller.AdvanceTime(TimeDelta::Millis(1));
+}
+
 TEST(FrameCadenceAdapterTest, RequestsRefreshFrameOnKeyFrameRequestWhenNew) {
   ZeroHertzFieldTrialEnabler enabler;
   MockCallback callback;
@@ -34,6 +34,9 @@ const int64_t kFreqOffsetProcessIntervalMs = 40000;
 // This should be synchronized with a typical getStats polling interval in
 // the clients.
 const int kMovingMaxWindowMs = 1000;
+// Decoded frames that can be queued for the worker thread before they are
+// posted one by one.
+const size_t kMaxQueuedDecodedFrames = 64;
 
 // How large window we use to calculate the framerate/bitrate.
 const int kRateStatisticsWindowSizeMs = 1000;
@@ -84,7 +87,8 @@ ReceiveStatisticsProxy::ReceiveStatisticsProxy(uint32_t remote_ssrc,
       num_delayed_frames_rendered_(0),
       sum_missed_render_deadline_ms_(0),
       timing_frame_info_counter_(kMovingMaxWindowMs),
-      worker_thread_(worker_thread) {
+      worker_thread_(worker_thread),
+      decoded_frames_(kMaxQueuedDecodedFrames) {
   RTC_DCHECK(worker_thread);
   decode_queue_.Detach();
   incoming_render_queue_.Detach();
@@ -100,6 +104,7 @@ void ReceiveStatisticsProxy::UpdateHistograms(
     const StreamDataCounters& rtp_stats,
     const StreamDataCounters* rtx_stats) {
   RTC_DCHECK_RUN_ON(&main_thread_);
+  ProcessQueuedDecodedFrames();
 
   char log_stream_buf[8 * 1024];
   rtc::SimpleStringBuilder log_stream(log_stream_buf);
@@ -614,13 +619,46 @@ void ReceiveStatisticsProxy::OnDecodedFrame(const VideoFrame& frame,
   // See VCMDecodedFrameCallback::Decoded for more info on what thread/queue we
   // may be on. E.g. on iOS this gets called on
   // "com.apple.coremedia.decompressionsession.clientcallback"
-  VideoFrameMetaData meta(frame, current_time);
-  worker_thread_->PostTask(
-      SafeTask(task_safety_.flag(), [meta, qp, decode_time, processing_delay,
-                                     assembly_time, content_type, this]() {
-        OnDecodedFrame(meta, qp, decode_time, processing_delay, assembly_time,
-                       content_type);
-      }));
+  // The callbacks are serialized, which is all the queue requires of its
+  // producer.
+  DecodedFrame decoded_frame;
+  decoded_frame.rtp_timestamp = frame.timestamp();
+  decoded_frame.decode_timestamp = current_time;
+  decoded_frame.qp = qp;
+  decoded_frame.decode_time = decode_time;
+  decoded_frame.processing_delay = processing_delay;
+  decoded_frame.assembly_time = assembly_time;
+  decoded_frame.content_type = content_type;
+  if (num_posted_decoded_frames_.load() > 0 ||
+      !decoded_frames_.Insert(&decoded_frame)) {
+    // The worker thread is far behind. Frames that were queued before have a
+    // task pending already, which runs before this one.
+    num_posted_decoded_frames_.fetch_add(1);
+    worker_thread_->PostTask(
+        SafeTask(task_safety_.flag(), [decoded_frame, this]() {
+          RTC_DCHECK_RUN_ON(&main_thread_);
+          ProcessDecodedFrame(decoded_frame);
+          num_posted_decoded_frames_.fetch_sub(1);
+        }));
+    return;
+  }
+  if (!decoded_frames_task_pending_.exchange(true)) {
+    worker_thread_->PostTask(SafeTask(task_safety_.flag(), [this]() {
+      RTC_DCHECK_RUN_ON(&main_thread_);
+      ProcessQueuedDecodedFrames();
+    }));
+  }
+}
+
+void ReceiveStatisticsProxy::ProcessQueuedDecodedFrames() {
+  RTC_DCHECK_RUN_ON(&main_thread_);
+  // Cleared before the queue is drained, so that a frame queued while it is
+  // drained either is processed by this call, or posts a new task.
+  decoded_frames_task_pending_.store(false);
+  DecodedFrame decoded_frame;
+  while (decoded_frames_.Remove(&decoded_frame)) {
+    ProcessDecodedFrame(decoded_frame);
+  }
 }
 
 void ReceiveStatisticsProxy::OnDecodedFrame(
@@ -631,6 +669,24 @@ void ReceiveStatisticsProxy::OnDecodedFrame(
     TimeDelta assembly_time,
     VideoContentType content_type) {
   RTC_DCHECK_RUN_ON(&main_thread_);
+  ProcessQueuedDecodedFrames();
+  DecodedFrame decoded_frame;
+  decoded_frame.rtp_timestamp = frame_meta.rtp_timestamp;
+  decoded_frame.decode_timestamp = frame_meta.decode_timestamp;
+  decoded_frame.qp = qp;
+  decoded_frame.decode_time = decode_time;
+  decoded_frame.processing_delay = processing_delay;
+  decoded_frame.assembly_time = assembly_time;
+  decoded_frame.content_type = content_type;
+  ProcessDecodedFrame(decoded_frame);
+}
+
+void ReceiveStatisticsProxy::ProcessDecodedFrame(const DecodedFrame& frame) {
+  RTC_DCHECK_RUN_ON(&main_thread_);
+  const VideoContentType content_type = frame.content_type;
+  const absl::optional<uint8_t> qp = frame.qp;
+  const TimeDelta decode_time = frame.decode_time;
+  const int64_t decode_timestamp_ms = frame.decode_timestamp.ms();
 
   const bool is_screenshare =
       videocontenttypehelpers::IsScreenshare(content_type);
@@ -644,7 +700,7 @@ void ReceiveStatisticsProxy::OnDecodedFrame(
     video_quality_observer_.reset(new VideoQualityObserver());
   }
 
-  video_quality_observer_->OnDecodedFrame(frame_meta.rtp_timestamp, qp,
+  video_quality_observer_->OnDecodedFrame(frame.rtp_timestamp, qp,
                                           last_codec_type_);
 
   ContentSpecificStats* content_specific_stats =
@@ -669,36 +725,36 @@ void ReceiveStatisticsProxy::OnDecodedFrame(
   decode_time_counter_.Add(decode_time.ms());
   stats_.decode_ms = decode_time.ms();
   stats_.total_decode_time += decode_time;
-  stats_.total_processing_delay += processing_delay;
-  stats_.total_assembly_time += assembly_time;
-  if (!assembly_time.IsZero()) {
+  stats_.total_processing_delay += frame.processing_delay;
+  stats_.total_assembly_time += frame.assembly_time;
+  if (!frame.assembly_time.IsZero()) {
     ++stats_.frames_assembled_from_multiple_packets;
   }
 
   last_content_type_ = content_type;
-  decode_fps_estimator_.Update(1, frame_meta.decode_timestamp.ms());
+  decode_fps_estimator_.Update(1, decode_timestamp_ms);
 
   if (last_decoded_frame_time_ms_) {
     int64_t interframe_delay_ms =
-        frame_meta.decode_timestamp.ms() - *last_decoded_frame_time_ms_;
+        decode_timestamp_ms - *last_decoded_frame_time_ms_;
     RTC_DCHECK_GE(interframe_delay_ms, 0);
-    interframe_delay_max_moving_.Add(interframe_delay_ms,
-                                     frame_meta.decode_timestamp.ms());
+    interframe_delay_max_moving_.Add(interframe_delay_ms, decode_timestamp_ms);
     content_specific_stats->interframe_delay_counter.Add(interframe_delay_ms);
     content_specific_stats->interframe_delay_percentiles.Add(
         interframe_delay_ms);
     content_specific_stats->flow_duration_ms += interframe_delay_ms;
   }
   if (stats_.frames_decoded == 1) {
-    first_decoded_frame_time_ms_.emplace(frame_meta.decode_timestamp.ms());
+    first_decoded_frame_time_ms_.emplace(decode_timestamp_ms);
   }
-  last_decoded_frame_time_ms_.emplace(frame_meta.decode_timestamp.ms());
+  last_decoded_frame_time_ms_.emplace(decode_timestamp_ms);
 }
 
 void ReceiveStatisticsProxy::OnRenderedFrame(
     const VideoFrameMetaData& frame_meta) {
   RTC_DCHECK_RUN_ON(&main_thread_);
   // Called from VideoReceiveStream2::OnFrame.
+  ProcessQueuedDecodedFrames();
 
   RTC_DCHECK_GT(frame_meta.width, 0);
   RTC_DCHECK_GT(frame_meta.height, 0);
@@ -11,6 +11,7 @@
 #ifndef VIDEO_RECEIVE_STATISTICS_PROXY_H_
 #define VIDEO_RECEIVE_STATISTICS_PROXY_H_
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <string>
@@ -20,6 +21,7 @@
 #include "api/sequence_checker.h"
 #include "api/task_queue/pending_task_safety_flag.h"
 #include "api/task_queue/task_queue_base.h"
+#include "api/units/time_delta.h"
 #include "api/units/timestamp.h"
 #include "api/video_codecs/video_decoder.h"
 #include "call/video_receive_stream.h"
@@ -29,6 +31,7 @@
 #include "rtc_base/numerics/sample_counter.h"
 #include "rtc_base/rate_statistics.h"
 #include "rtc_base/rate_tracker.h"
+#include "rtc_base/swap_queue.h"
 #include "rtc_base/system/no_unique_address.h"
 #include "rtc_base/thread_annotations.h"
 #include "video/stats_counter.h"
@@ -60,9 +63,9 @@ class ReceiveStatisticsProxy : public VideoStreamBufferControllerStatsObserver,
                       TimeDelta decode_time,
                       VideoContentType content_type);
 
-  // Called asyncronously on the worker thread as a result of a call to the
-  // above OnDecodedFrame method, which is called back on the thread where
-  // the actual decoding happens.
+  // Called on the worker thread with the frames passed to the above
+  // OnDecodedFrame method, which is called back on the thread where the actual
+  // decoding happens.
   void OnDecodedFrame(const VideoFrameMetaData& frame_meta,
                       absl::optional<uint8_t> qp,
                       TimeDelta decode_time,
@@ -143,6 +146,22 @@ class ReceiveStatisticsProxy : public VideoStreamBufferControllerStatsObserver,
     rtc::HistogramPercentileCounter interframe_delay_percentiles;
   };
 
+  // What the stats need of a decoded frame. Passed from the decoding thread to
+  // the worker thread.
+  struct DecodedFrame {
+    uint32_t rtp_timestamp = 0;
+    Timestamp decode_timestamp = Timestamp::Zero();
+    absl::optional<uint8_t> qp;
+    TimeDelta decode_time = TimeDelta::Zero();
+    TimeDelta processing_delay = TimeDelta::Zero();
+    TimeDelta assembly_time = TimeDelta::Zero();
+    VideoContentType content_type = VideoContentType::UNSPECIFIED;
+  };
+
+  void ProcessDecodedFrame(const DecodedFrame& frame);
+  // Processes the frames queued by the decoding thread.
+  void ProcessQueuedDecodedFrames();
+
   // Removes info about old frames and then updates the framerate.
   void UpdateFramerate(int64_t now_ms) const;
 
@@ -201,6 +220,16 @@ class ReceiveStatisticsProxy : public VideoStreamBufferControllerStatsObserver,
   // methods are invoked on such as GetStats().
   TaskQueueBase* const worker_thread_;
 
+  // Decoded frames are queued without locking, and processed in batches on the
+  // worker thread. A task to process them is only posted when none is pending,
+  // so that a busy worker thread drains many frames in one task.
+  SwapQueue<DecodedFrame> decoded_frames_;
+  std::atomic<bool> decoded_frames_task_pending_{false};
+  // When the queue is full, frames are posted one by one. Until those tasks
+  // have run, later frames are posted too, so that frames are processed in
+  // decoding order.
+  std::atomic<int> num_posted_decoded_frames_{0};
+
   ScopedTaskSafety task_safety_;
 
   RTC_NO_UNIQUE_ADDRESS SequenceChecker decode_queue_;
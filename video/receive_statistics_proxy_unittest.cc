@@ -120,6 +120,28 @@ TEST_F(ReceiveStatisticsProxyTest, OnDecodedFrameIncreasesFramesDecoded) {
   }
 }
 
+TEST_F(ReceiveStatisticsProxyTest, CountsBurstOfDecodedFramesInOrder) {
+  // More frames than are queued for the worker thread, to also cover the
+  // frames that are posted one by one.
+  constexpr int kNumFrames = 200;
+  webrtc::VideoFrame frame = CreateFrame(kWidth, kHeight);
+  for (int i = 0; i < kNumFrames; ++i) {
+    statistics_proxy_->OnDecodedFrame(frame, 1u, TimeDelta::Millis(2),
+                                      VideoContentType::UNSPECIFIED);
+  }
+  VideoReceiveStreamInterface::Stats stats = FlushAndGetStats();
+  EXPECT_EQ(stats.frames_decoded, static_cast<uint32_t>(kNumFrames));
+  EXPECT_EQ(stats.qp_sum, kNumFrames);
+  EXPECT_EQ(stats.total_decode_time, TimeDelta::Millis(2 * kNumFrames));
+  EXPECT_EQ(stats.interframe_delay_max_ms, 0);
+
+  // Frames queued after the burst are processed as well.
+  statistics_proxy_->OnDecodedFrame(frame, 1u, TimeDelta::Millis(2),
+                                    VideoContentType::UNSPECIFIED);
+  EXPECT_EQ(FlushAndGetStats().frames_decoded,
+            static_cast<uint32_t>(kNumFrames + 1));
+}
+
 TEST_F(ReceiveStatisticsProxyTest, DecodedFpsIsReported) {
   const Frequency kFps = Frequency::Hertz(20);
   const int kRequiredSamples =
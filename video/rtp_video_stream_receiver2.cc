@@ -671,9 +671,7 @@ void RtpVideoStreamReceiver2::OnReceivedPayloadData(
     }
 
     video_coding::H264SpsPpsTracker::FixedBitstream fixed =
-        tracker_.CopyAndFixBitstream(
-            rtc::MakeArrayView(codec_payload.cdata(), codec_payload.size()),
-            &packet->video_header);
+        tracker_.FixBitstream(codec_payload, &packet->video_header);
 
     switch (fixed.action) {
       case video_coding::H264SpsPpsTracker::kRequestKeyframe:
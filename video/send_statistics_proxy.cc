@@ -160,6 +160,7 @@ SendStatisticsProxy::SendStatisticsProxy(
 
 SendStatisticsProxy::~SendStatisticsProxy() {
   MutexLock lock(&mutex_);
+  UpdateFrameDropStats();
   uma_container_->UpdateHistograms(rtp_config_, stats_);
 
   int64_t elapsed_sec = (clock_->TimeInMilliseconds() - start_ms_) / 1000;
@@ -679,6 +680,7 @@ void SendStatisticsProxy::OnEncoderReconfigured(
   MutexLock lock(&mutex_);
 
   if (content_type_ != config.content_type) {
+    UpdateFrameDropStats();
     uma_container_->UpdateHistograms(rtp_config_, stats_);
     uma_container_.reset(new UmaSamplesContainer(
         GetUmaPrefix(config.content_type), stats_, clock_));
@@ -741,6 +743,7 @@ void SendStatisticsProxy::OnSuspendChange(bool is_suspended) {
 VideoSendStream::Stats SendStatisticsProxy::GetStats() {
   MutexLock lock(&mutex_);
   PurgeOldStats();
+  UpdateFrameDropStats();
   stats_.input_frame_rate =
       uma_container_->input_frame_rate_tracker_.ComputeRate();
   stats_.frames = uma_container_->input_frame_rate_tracker_.TotalSampleCount();
@@ -1095,26 +1098,39 @@ void SendStatisticsProxy::OnIncomingFrame(int width, int height) {
 }
 
 void SendStatisticsProxy::OnFrameDropped(DropReason reason) {
-  MutexLock lock(&mutex_);
   switch (reason) {
     case DropReason::kSource:
-      ++stats_.frames_dropped_by_capturer;
+      frames_dropped_by_capturer_.fetch_add(1, std::memory_order_relaxed);
       break;
     case DropReason::kEncoderQueue:
-      ++stats_.frames_dropped_by_encoder_queue;
+      frames_dropped_by_encoder_queue_.fetch_add(1, std::memory_order_relaxed);
       break;
     case DropReason::kEncoder:
-      ++stats_.frames_dropped_by_encoder;
+      frames_dropped_by_encoder_.fetch_add(1, std::memory_order_relaxed);
       break;
     case DropReason::kMediaOptimization:
-      ++stats_.frames_dropped_by_rate_limiter;
+      frames_dropped_by_rate_limiter_.fetch_add(1, std::memory_order_relaxed);
       break;
     case DropReason::kCongestionWindow:
-      ++stats_.frames_dropped_by_congestion_window;
+      frames_dropped_by_congestion_window_.fetch_add(1,
+                                                     std::memory_order_relaxed);
       break;
   }
 }
 
+void SendStatisticsProxy::UpdateFrameDropStats() {
+  stats_.frames_dropped_by_capturer =
+      frames_dropped_by_capturer_.load(std::memory_order_relaxed);
+  stats_.frames_dropped_by_encoder_queue =
+      frames_dropped_by_encoder_queue_.load(std::memory_order_relaxed);
+  stats_.frames_dropped_by_encoder =
+      frames_dropped_by_encoder_.load(std::memory_order_relaxed);
+  stats_.frames_dropped_by_rate_limiter =
+      frames_dropped_by_rate_limiter_.load(std::memory_order_relaxed);
+  stats_.frames_dropped_by_congestion_window =
+      frames_dropped_by_congestion_window_.load(std::memory_order_relaxed);
+}
+
 void SendStatisticsProxy::ClearAdaptationStats() {
   MutexLock lock(&mutex_);
   adaptation_limitations_.set_cpu_counts(VideoAdaptationCounters());
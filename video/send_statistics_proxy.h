@@ -12,6 +12,7 @@
 #define VIDEO_SEND_STATISTICS_PROXY_H_
 
 #include <array>
+#include <atomic>
 #include <map>
 #include <memory>
 #include <string>
@@ -222,6 +223,8 @@ class SendStatisticsProxy : public VideoStreamEncoderObserver,
   typedef std::map<uint32_t, Frame, TimestampOlderThan> EncodedFrameMap;
 
   void PurgeOldStats() RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+  // Copies the frame drop counts to `stats_`.
+  void UpdateFrameDropStats() RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
   VideoSendStream::StreamStats* GetStatsEntry(uint32_t ssrc)
       RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
 
@@ -277,6 +280,14 @@ class SendStatisticsProxy : public VideoStreamEncoderObserver,
   const absl::optional<int> fallback_max_pixels_;
   const absl::optional<int> fallback_max_pixels_disabled_;
   mutable Mutex mutex_;
+  // Frames are dropped on the capture thread as well as on the encoder queue.
+  // The drops are counted without taking `mutex_`, and copied to `stats_`
+  // when it is read.
+  std::atomic<uint32_t> frames_dropped_by_capturer_{0};
+  std::atomic<uint32_t> frames_dropped_by_encoder_queue_{0};
+  std::atomic<uint32_t> frames_dropped_by_encoder_{0};
+  std::atomic<uint32_t> frames_dropped_by_rate_limiter_{0};
+  std::atomic<uint32_t> frames_dropped_by_congestion_window_{0};
   VideoEncoderConfig::ContentType content_type_ RTC_GUARDED_BY(mutex_);
   const int64_t start_ms_;
   VideoSendStream::Stats stats_ RTC_GUARDED_BY(mutex_);
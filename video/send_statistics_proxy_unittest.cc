@@ -354,6 +354,25 @@ TEST_F(SendStatisticsProxyTest, OnEncodedFrameTimeMeasured) {
   EXPECT_EQ(encode_usage_percent, stats.encode_usage_percent);
 }
 
+TEST_F(SendStatisticsProxyTest, CountsDroppedFramesPerReason) {
+  using DropReason = VideoStreamEncoderObserver::DropReason;
+  statistics_proxy_->OnFrameDropped(DropReason::kSource);
+  statistics_proxy_->OnFrameDropped(DropReason::kEncoderQueue);
+  statistics_proxy_->OnFrameDropped(DropReason::kEncoderQueue);
+  statistics_proxy_->OnFrameDropped(DropReason::kEncoder);
+  statistics_proxy_->OnFrameDropped(DropReason::kMediaOptimization);
+  statistics_proxy_->OnFrameDropped(DropReason::kCongestionWindow);
+  statistics_proxy_->OnFrameDropped(DropReason::kCongestionWindow);
+  statistics_proxy_->OnFrameDropped(DropReason::kCongestionWindow);
+
+  VideoSendStream::Stats stats = statistics_proxy_->GetStats();
+  EXPECT_EQ(stats.frames_dropped_by_capturer, 1u);
+  EXPECT_EQ(stats.frames_dropped_by_encoder_queue, 2u);
+  EXPECT_EQ(stats.frames_dropped_by_encoder, 1u);
+  EXPECT_EQ(stats.frames_dropped_by_rate_limiter, 1u);
+  EXPECT_EQ(stats.frames_dropped_by_congestion_window, 3u);
+}
+
 TEST_F(SendStatisticsProxyTest, TotalEncodeTimeIncreasesPerFrameMeasured) {
   const int kEncodeUsagePercent = 0;  // Don't care for this test.
   EXPECT_EQ(0u, statistics_proxy_->GetStats().total_encode_time_ms);
@@ -31,6 +31,7 @@
 #include "api/units/time_delta.h"
 #include "api/units/timestamp.h"
 #include "api/video/encoded_image.h"
+#include "api/video/video_codec_constants.h"
 #include "api/video_codecs/sdp_video_format.h"
 #include "api/video_codecs/video_codec.h"
 #include "api/video_codecs/video_decoder_factory.h"
@@ -158,6 +159,11 @@ bool IsKeyFrameAndUnspecifiedResolution(const EncodedFrame& frame) {
          frame.EncodedImage()._encodedHeight == 0;
 }
 
+// Layer indices out of range mean that the index is not signaled.
+bool IsUpperLayer(absl::optional<int> index, int num_layers) {
+  return index.has_value() && *index > 0 && *index < num_layers;
+}
+
 std::string OptionalDelayToLogString(const absl::optional<TimeDelta> opt) {
   return opt.has_value() ? ToLogString(*opt) : "<unset>";
 }
@@ -689,6 +695,13 @@ void VideoReceiveStream2::RequestKeyFrame(Timestamp now) {
 
 void VideoReceiveStream2::OnCompleteFrame(std::unique_ptr<EncodedFrame> frame) {
   RTC_DCHECK_RUN_ON(&worker_sequence_checker_);
+  {
+    // TODO(bugs.webrtc.org/11993): Call on the network thread.
+    RTC_DCHECK_RUN_ON(&packet_sequence_checker_);
+    if (IsDroppedByDecodeLimit(*frame)) {
+      return;
+    }
+  }
 
   const VideoPlayoutDelay& playout_delay = frame->EncodedImage().playout_delay_;
   if (playout_delay.min_ms >= 0) {
@@ -819,7 +832,10 @@ void VideoReceiveStream2::OnDecodableFrameTimeout(TimeDelta wait) {
   if (!stream_is_active)
     stats_proxy_.OnStreamInactive();
 
+  // A stream that only decodes key frames waits for the sender's key frames
+  // instead of requesting them.
   if (stream_is_active && !IsReceivingKeyFrame(now) &&
+      decode_limit_ != DecodeLimit::kKeyFramesOnly &&
       (!config_.crypto_options.sframe.require_frame_encryption ||
        rtp_video_stream_receiver_.IsDecryptable())) {
     absl::optional<uint32_t> last_timestamp =
@@ -1081,6 +1097,51 @@ void VideoReceiveStream2::GenerateKeyFrame() {
   keyframe_generation_requested_ = true;
 }
 
+void VideoReceiveStream2::SetDecodeLimit(DecodeLimit limit) {
+  RTC_DCHECK_RUN_ON(&packet_sequence_checker_);
+  if (limit == decode_limit_) {
+    return;
+  }
+  RTC_LOG(LS_INFO) << "Decode limit changed from "
+                   << static_cast<int>(decode_limit_) << " to "
+                   << static_cast<int>(limit) << " for ssrc "
+                   << remote_ssrc() << ".";
+  if (limit < decode_limit_) {
+    // The next frames may reference frames that were dropped.
+    decode_limit_awaits_key_frame_ = true;
+    RequestKeyFrame(clock_->CurrentTime());
+  }
+  decode_limit_ = limit;
+}
+
+bool VideoReceiveStream2::IsDroppedByDecodeLimit(EncodedFrame& frame) {
+  if (decode_limit_awaits_key_frame_) {
+    if (!frame.is_keyframe()) {
+      return true;
+    }
+    decode_limit_awaits_key_frame_ = false;
+  }
+  switch (decode_limit_) {
+    case DecodeLimit::kNone:
+      return false;
+    case DecodeLimit::kBaseLayer:
+      if (IsUpperLayer(frame.TemporalIndex(), kMaxTemporalStreams)) {
+        return true;
+      }
+      break;
+    case DecodeLimit::kKeyFramesOnly:
+      if (!frame.is_keyframe()) {
+        return true;
+      }
+      break;
+  }
+  if (IsUpperLayer(frame.SpatialIndex(), kMaxSpatialLayers)) {
+    return true;
+  }
+  frame.is_last_spatial_layer = true;
+  return false;
+}
+
 void VideoReceiveStream2::UpdateRtxSsrc(uint32_t ssrc) {
   RTC_DCHECK_RUN_ON(&packet_sequence_checker_);
   RTC_DCHECK(rtx_receive_stream_);
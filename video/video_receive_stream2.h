@@ -195,6 +195,7 @@ class VideoReceiveStream2
   RecordingState SetAndGetRecordingState(RecordingState state,
                                          bool generate_key_frame) override;
   void GenerateKeyFrame() override;
+  void SetDecodeLimit(DecodeLimit limit) override;
 
   void UpdateRtxSsrc(uint32_t ssrc) override;
 
@@ -238,6 +239,10 @@ class VideoReceiveStream2
       RTC_RUN_ON(packet_sequence_checker_);
   bool IsReceivingKeyFrame(Timestamp timestamp) const
       RTC_RUN_ON(packet_sequence_checker_);
+  // Returns true if `frame` should not be decoded under `decode_limit_`.
+  // Kept frames of the lowest spatial layer are marked as the last one.
+  bool IsDroppedByDecodeLimit(EncodedFrame& frame)
+      RTC_RUN_ON(packet_sequence_checker_);
   int DecodeAndMaybeDispatchEncodedFrame(std::unique_ptr<EncodedFrame> frame)
       RTC_RUN_ON(decode_queue_);
 
@@ -333,6 +338,11 @@ class VideoReceiveStream2
   // Set to true while we're requesting keyframes but not yet received one.
   bool keyframe_generation_requested_ RTC_GUARDED_BY(packet_sequence_checker_) =
       false;
+  DecodeLimit decode_limit_ RTC_GUARDED_BY(packet_sequence_checker_) =
+      DecodeLimit::kNone;
+  // Set when `decode_limit_` is relaxed, until the next key frame arrives.
+  bool decode_limit_awaits_key_frame_
+      RTC_GUARDED_BY(packet_sequence_checker_) = false;
   // Lock to avoid unnecessary per-frame idle wakeups in the code.
   webrtc::Mutex pending_resolution_mutex_;
   // Signal from decode queue to OnFrame callback to fill pending_resolution_.
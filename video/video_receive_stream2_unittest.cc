@@ -899,6 +899,83 @@ TEST_P(VideoReceiveStream2Test, WaitsforAllSpatialLayers) {
   video_receive_stream_->Stop();
 }
 
+TEST_P(VideoReceiveStream2Test, DecodeLimitDropsFramesBeforeDecode) {
+  video_receive_stream_->Start();
+  video_receive_stream_->SetDecodeLimit(
+      VideoReceiveStreamInterface::DecodeLimit::kKeyFramesOnly);
+
+  auto key_sl0 = test::FakeFrameBuilder()
+                     .Id(0)
+                     .PayloadType(99)
+                     .Time(kFirstRtpTimestamp)
+                     .ReceivedTime(kStartTime)
+                     .Build();
+  auto key_sl1 = test::FakeFrameBuilder()
+                     .Id(1)
+                     .PayloadType(99)
+                     .Time(kFirstRtpTimestamp)
+                     .ReceivedTime(kStartTime)
+                     .SpatialLayer(1)
+                     .Refs({0})
+                     .AsLast()
+                     .Build();
+  auto delta_frame = test::FakeFrameBuilder()
+                         .Id(2)
+                         .PayloadType(99)
+                         .Time(RtpTimestampForFrame(1))
+                         .ReceivedTime(ReceiveTimeForFrame(1))
+                         .Refs({0})
+                         .AsLast()
+                         .Build();
+  auto next_delta_frame = test::FakeFrameBuilder()
+                              .Id(3)
+                              .PayloadType(99)
+                              .Time(RtpTimestampForFrame(2))
+                              .ReceivedTime(ReceiveTimeForFrame(2))
+                              .Refs({2})
+                              .AsLast()
+                              .Build();
+  auto next_key_frame = test::FakeFrameBuilder()
+                            .Id(4)
+                            .PayloadType(99)
+                            .Time(RtpTimestampForFrame(3))
+                            .ReceivedTime(ReceiveTimeForFrame(3))
+                            .AsLast()
+                            .Build();
+
+  // Only the lowest spatial layer of the key frame is decoded.
+  EXPECT_CALL(mock_decoder_,
+              Decode(test::RtpTimestamp(kFirstRtpTimestamp), _, _))
+      .Times(1);
+  video_receive_stream_->OnCompleteFrame(std::move(key_sl0));
+  video_receive_stream_->OnCompleteFrame(std::move(key_sl1));
+  EXPECT_THAT(fake_renderer_.WaitForFrame(TimeDelta::Zero()), RenderedFrame());
+  testing::Mock::VerifyAndClearExpectations(&mock_decoder_);
+
+  // Delta frames are dropped.
+  EXPECT_CALL(mock_decoder_, Decode).Times(0);
+  time_controller_.AdvanceTime(k30FpsDelay);
+  video_receive_stream_->OnCompleteFrame(std::move(delta_frame));
+  EXPECT_THAT(fake_renderer_.WaitForFrame(k30FpsDelay), DidNotReceiveFrame());
+
+  // Relaxing the limit requests a key frame, and frames that may reference
+  // dropped frames are not decoded until it arrives.
+  video_receive_stream_->SetDecodeLimit(
+      VideoReceiveStreamInterface::DecodeLimit::kNone);
+  time_controller_.AdvanceTime(TimeDelta::Zero());
+  EXPECT_THAT(rtcp_packet_parser_.pli()->num_packets(), Eq(1));
+  video_receive_stream_->OnCompleteFrame(std::move(next_delta_frame));
+  EXPECT_THAT(fake_renderer_.WaitForFrame(k30FpsDelay), DidNotReceiveFrame());
+  testing::Mock::VerifyAndClearExpectations(&mock_decoder_);
+
+  EXPECT_CALL(mock_decoder_,
+              Decode(test::RtpTimestamp(RtpTimestampForFrame(3)), _, _))
+      .Times(1);
+  video_receive_stream_->OnCompleteFrame(std::move(next_key_frame));
+  EXPECT_THAT(fake_renderer_.WaitForFrame(k30FpsDelay), RenderedFrame());
+  video_receive_stream_->Stop();
+}
+
 TEST_P(VideoReceiveStream2Test, FramesFastForwardOnSystemHalt) {
   video_receive_stream_->Start();
 
@@ -49,6 +49,10 @@ static constexpr int64_t kMaxVbaThrottleTimeMs = 500;
 
 constexpr TimeDelta kEncoderTimeOut = TimeDelta::Seconds(2);
 
+// Window of the encoded bitrate, as of the encoder rate utilization in
+// EncoderBitrateAdjuster.
+constexpr TimeDelta kEncodedBitrateWindowSize = TimeDelta::Seconds(3);
+
 constexpr double kVideoHysteresis = 1.2;
 constexpr double kScreenshareHysteresis = 1.35;
 
@@ -244,6 +248,7 @@ VideoSendStreamImpl::VideoSendStreamImpl(
           GetInitialEncoderMaxBitrate(initial_encoder_max_bitrate)),
       encoder_target_rate_bps_(0),
       encoder_bitrate_priority_(initial_encoder_bitrate_priority),
+      encoded_bitrate_(kEncodedBitrateWindowSize),
       video_stream_encoder_(video_stream_encoder),
       rtp_video_sender_(rtp_video_sender),
       configured_pacing_factor_(
@@ -540,8 +545,9 @@ EncodedImageCallback::Result VideoSendStreamImpl::OnEncodedImage(
   activity_ = true;
   RTC_DCHECK(!worker_queue_->IsCurrent());
 
-  auto task_to_run_on_worker = [this]() {
+  auto task_to_run_on_worker = [this, size_bytes = encoded_image.size()]() {
     RTC_DCHECK_RUN_ON(&thread_checker_);
+    encoded_bitrate_.Update(size_bytes, clock_->CurrentTime());
     if (disable_padding_) {
       disable_padding_ = false;
       // To ensure that padding bitrate is propagated to the bitrate allocator.
@@ -620,5 +626,20 @@ uint32_t VideoSendStreamImpl::OnBitrateUpdated(BitrateAllocationUpdate update) {
   return protection_bitrate_bps;
 }
 
+// The EncoderOvershootDetector factors of the encoder are floored at one, so
+// the encoded bitrate is measured here to also tell an undershoot.
+absl::optional<double> VideoSendStreamImpl::GetUtilizationFactor() const {
+  RTC_DCHECK_RUN_ON(&thread_checker_);
+  if (encoder_target_rate_bps_ == 0) {
+    return absl::nullopt;
+  }
+  absl::optional<DataRate> encoded_bitrate =
+      encoded_bitrate_.Rate(clock_->CurrentTime());
+  if (!encoded_bitrate) {
+    return absl::nullopt;
+  }
+  return encoded_bitrate->bps<double>() / encoder_target_rate_bps_;
+}
+
 }  // namespace internal
 }  // namespace webrtc
@@ -33,6 +33,7 @@
 #include "modules/include/module_common_types.h"
 #include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
 #include "modules/video_coding/include/video_codec_interface.h"
+#include "rtc_base/bitrate_tracker.h"
 #include "rtc_base/experiments/field_trial_parser.h"
 #include "rtc_base/system/no_unique_address.h"
 #include "rtc_base/task_utils/repeating_task.h"
@@ -93,6 +94,7 @@ class VideoSendStreamImpl : public webrtc::BitrateAllocatorObserver,
  private:
   // Implements BitrateAllocatorObserver.
   uint32_t OnBitrateUpdated(BitrateAllocationUpdate update) override;
+  absl::optional<double> GetUtilizationFactor() const override;
 
   // Implements VideoStreamEncoderInterface::EncoderSink
   void OnEncoderConfigurationChanged(
@@ -154,6 +156,9 @@ class VideoSendStreamImpl : public webrtc::BitrateAllocatorObserver,
   uint32_t encoder_max_bitrate_bps_ RTC_GUARDED_BY(thread_checker_);
   uint32_t encoder_target_rate_bps_ RTC_GUARDED_BY(thread_checker_);
   double encoder_bitrate_priority_ RTC_GUARDED_BY(thread_checker_);
+  // Rate of the encoded frames, which GetUtilizationFactor() relates to the
+  // encoder target rate.
+  BitrateTracker encoded_bitrate_ RTC_GUARDED_BY(thread_checker_);
 
   VideoStreamEncoderInterface* const video_stream_encoder_;
   RtpVideoSenderInterface* const rtp_video_sender_;
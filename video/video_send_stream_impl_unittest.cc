@@ -681,6 +681,42 @@ TEST_F(VideoSendStreamImplTest, ForwardsVideoBitrateAllocationAfterTimeout) {
   vss_impl->Stop();
 }
 
+TEST_F(VideoSendStreamImplTest, ReportsEncodedBitrateUtilization) {
+  auto vss_impl = CreateVideoSendStreamImpl(
+      kDefaultInitialBitrateBps, kDefaultBitratePriority,
+      VideoEncoderConfig::ContentType::kRealtimeVideo);
+  vss_impl->StartPerRtpStream({true});
+  BitrateAllocatorObserver* const observer = vss_impl.get();
+  EXPECT_EQ(observer->GetUtilizationFactor(), absl::nullopt);
+
+  constexpr uint32_t kBitrateBps = 240000;
+  EXPECT_CALL(rtp_video_sender_, GetPayloadBitrateBps())
+      .WillRepeatedly(Return(kBitrateBps));
+  observer->OnBitrateUpdated(CreateAllocation(kBitrateBps));
+  EXPECT_CALL(rtp_video_sender_, OnEncodedImage)
+      .WillRepeatedly(Return(
+          EncodedImageCallback::Result(EncodedImageCallback::Result::OK)));
+
+  // Encode 30 fps at half of the target bitrate.
+  constexpr size_t kFrameSizeBytes = kBitrateBps / 8 / 30 / 2;
+  for (int i = 0; i < 90; ++i) {
+    encoder_queue_->PostTask([&] {
+      EncodedImage encoded_image;
+      encoded_image.SetEncodedData(
+          EncodedImageBuffer::Create(kFrameSizeBytes));
+      CodecSpecificInfo codec_specific;
+      static_cast<EncodedImageCallback*>(vss_impl.get())
+          ->OnEncodedImage(encoded_image, &codec_specific);
+    });
+    time_controller_.AdvanceTime(TimeDelta::Seconds(1) / 30);
+  }
+  absl::optional<double> utilization = observer->GetUtilizationFactor();
+  ASSERT_TRUE(utilization.has_value());
+  EXPECT_NEAR(*utilization, 0.5, 0.05);
+
+  vss_impl->Stop();
+}
+
 TEST_F(VideoSendStreamImplTest, CallsVideoStreamEncoderOnBitrateUpdate) {
   const bool kSuspend = false;
   config_.suspend_below_min_bitrate = kSuspend;
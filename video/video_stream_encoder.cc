@@ -564,6 +564,31 @@ absl::optional<VideoSourceRestrictions> MergeRestrictions(
   return return_value;
 }
 
+// Crops and scales `buffer` for an encoder with `info`. NV12 buffers are
+// converted to I420 in the same pass when the encoder does not take NV12,
+// instead of having the encoder convert the cropped NV12 buffer.
+rtc::scoped_refptr<VideoFrameBuffer> CropAndScaleForEncoder(
+    const rtc::scoped_refptr<VideoFrameBuffer>& buffer,
+    int offset_x,
+    int offset_y,
+    int crop_width,
+    int crop_height,
+    int scaled_width,
+    int scaled_height,
+    const VideoEncoder::EncoderInfo& info) {
+  if (buffer->type() != VideoFrameBuffer::Type::kNV12 ||
+      absl::c_linear_search(info.preferred_pixel_formats,
+                            VideoFrameBuffer::Type::kNV12)) {
+    return buffer->CropAndScale(offset_x, offset_y, crop_width, crop_height,
+                                scaled_width, scaled_height);
+  }
+  rtc::scoped_refptr<I420Buffer> scaled =
+      I420Buffer::Create(scaled_width, scaled_height);
+  scaled->CropAndScaleFrom(*buffer->GetNV12(), offset_x, offset_y, crop_width,
+                           crop_height);
+  return scaled;
+}
+
 }  //  namespace
 
 VideoStreamEncoder::EncoderRateSettings::EncoderRateSettings()
@@ -1550,11 +1575,8 @@ void VideoStreamEncoder::OnFrame(Timestamp post_time,
                         << incoming_frame.ntp_time_ms()
                         << " <= " << last_captured_timestamp_
                         << ") for incoming frame. Dropping.";
-    encoder_queue_.PostTask([this, incoming_frame]() {
-      RTC_DCHECK_RUN_ON(&encoder_queue_);
-      accumulated_update_rect_.Union(incoming_frame.update_rect());
-      accumulated_update_rect_is_valid_ &= incoming_frame.has_update_rect();
-    });
+    accumulated_update_rect_.Union(incoming_frame.update_rect());
+    accumulated_update_rect_is_valid_ &= incoming_frame.has_update_rect();
     return;
   }
 
@@ -1978,9 +2000,9 @@ void VideoStreamEncoder::EncodeVideoFrame(const VideoFrame& video_frame,
     VideoFrame::UpdateRect update_rect = video_frame.update_rect();
     if (crop_width_ < 4 && crop_height_ < 4) {
       // The difference is small, crop without scaling.
-      cropped_buffer = video_frame.video_frame_buffer()->CropAndScale(
-          crop_width_ / 2, crop_height_ / 2, cropped_width, cropped_height,
-          cropped_width, cropped_height);
+      cropped_buffer = CropAndScaleForEncoder(
+          video_frame.video_frame_buffer(), crop_width_ / 2, crop_height_ / 2,
+          cropped_width, cropped_height, cropped_width, cropped_height, info);
       update_rect.offset_x -= crop_width_ / 2;
       update_rect.offset_y -= crop_height_ / 2;
       update_rect.Intersect(
@@ -1988,8 +2010,9 @@ void VideoStreamEncoder::EncodeVideoFrame(const VideoFrame& video_frame,
 
     } else {
       // The difference is large, scale it.
-      cropped_buffer = video_frame.video_frame_buffer()->Scale(cropped_width,
-                                                               cropped_height);
+      cropped_buffer = CropAndScaleForEncoder(
+          video_frame.video_frame_buffer(), 0, 0, video_frame.width(),
+          video_frame.height(), cropped_width, cropped_height, info);
       if (!update_rect.IsEmpty()) {
         // Since we can't reason about pixels after scaling, we invalidate whole
         // picture, if anything changed.